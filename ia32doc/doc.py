@@ -38,6 +38,12 @@ PDPTE with such an address causes a general-protection fault.
 '''
 MAXPHYADDR = 48
 
+#
+# Architectural maximum of MAXPHYADDR. Fields ending at (MAXPHYADDR-1) may extend up to this bit on
+# processors with more physical-address bits.
+#
+MAXPHYADDR_MAX = 52
+
 
 class Doc(object):
     doc_cache = { }
@@ -337,6 +343,18 @@ class DocGroup(DocBase):
     def __init__(self, doc: dict, parent: DocBase=None):
         super().__init__(doc, parent)
 
+    @property
+    def snapshot(self) -> str:
+        if 'snapshot' in self._doc:
+            return self._doc['snapshot']
+        return ''
+
+    @property
+    def slot_table(self) -> str:
+        if 'slot_table' in self._doc:
+            return self._doc['slot_table']
+        return ''
+
 
 class DocDefinition(DocBase):
     def __init__(self, doc: dict, parent: DocBase=None):
@@ -346,6 +364,12 @@ class DocDefinition(DocBase):
     def value(self) -> str:
         return self._doc['value']
 
+    @property
+    def parameters(self) -> List[str]:
+        if 'parameters' in self._doc:
+            return self._doc['parameters']
+        return []
+
 
 class DocEnum(DocBase):
     def __init__(self, doc: dict, parent: DocBase=None):
@@ -371,6 +395,18 @@ class DocStruct(DocBase):
             return self._doc['size']
         return -1
 
+    @property
+    def leaf(self) -> int:
+        if 'leaf' in self._doc:
+            return self._doc['leaf']
+        return -1
+
+    @property
+    def subleaf(self) -> int:
+        if 'subleaf' in self._doc:
+            return self._doc['subleaf']
+        return 0
+
 
 class DocStructField(DocBase):
     def __init__(self, doc: dict, parent: DocBase=None):
@@ -419,3 +455,24 @@ class DocBitfieldField(DocBase):
             bit_to += 1
 
         return bit_from, bit_to
+
+    @property
+    def address_bit(self) -> Tuple[int, int]:
+        #
+        # Bits which may belong to the field depending on MAXPHYADDR of the processor, or None.
+        #
+        if isinstance(self._doc['bit'], str) and 'MAXPHYADDR' in self._doc['bit']:
+            return self.bit[0], MAXPHYADDR_MAX
+
+        return None
+
+    @property
+    def reserved(self) -> bool:
+        #
+        # Fields named after reserved bits (e.g. RESERVED, RESERVED_1, MUST_BE_ZERO), as opposed
+        # to fields of ignored bits, which software is free to use.
+        #
+        return any(
+            re.match(r'^(RESERVED|MUST_BE_ZERO)(_?\d+)?$', name)
+            for name in (self.short_name_standalone, self.long_name_standalone)
+        )
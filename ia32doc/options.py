@@ -118,17 +118,37 @@ class DocProcessorOptions(object):
         # Group category.
         #
         self.group_defgroup = True
+        self.group_with_define_slot_table = True
 
         #
         # Definition category.
         #
         self.definition_no_indent = True
+        self.definition_with_define_slot_suffix = '_SLOT'
+        self.definition_check_duplicates = True
 
         #
-        # Bitfield field category.
+        # Struct category.
+        #
+        self.struct_with_define_snapshot = True
+        self.struct_with_define_snapshot_feature_suffix = '_FEATURE'
+        self.struct_with_define_snapshot_policy = ''
+
+        #
+        # Bitfield category.
         #
         self.bitfield_create_struct = True
 
+        self.bitfield_with_define_reserved = True
+        self.bitfield_with_define_reserved_suffix = '_RESERVED_BITS'
+        self.bitfield_with_define_address_bits_suffix = '_ADDRESS_BITS'
+
+        self.bitfield_with_define_struct_scope = True
+
+        #
+        # Bitfield field category.
+        #
+
         self.bitfield_field_long_description_with_bit_range = True
         self.bitfield_field_fill_with_reserved = True
         self.bitfield_field_reserved_prefix = 'Reserved'
@@ -1,14 +1,23 @@
-from typing import Union, Tuple
+import re
+from typing import List, Union, Tuple
+
+import yaml
 
 from .base import DocProcessor
 
 from ..doc import DocBase, DocGroup, DocDefinition, DocEnum, DocEnumField,\
                   DocBitfield, DocBitfieldField, DocStruct, DocStructField
 from ..doc import DOC_DEFINITION, DOC_STRUCT, DOC_BITFIELD, DOC_STRUCT_FIELD, DOC_ENUM_FIELD
+from ..doc import MAXPHYADDR_MAX
 from ..text import DocText
 
 
 class DocCProcessor(DocProcessor):
+    #
+    # Registers held by each entry of the snapshot table (in this order).
+    #
+    SNAPSHOT_REGISTERS = [ 'EAX', 'EBX', 'ECX', 'EDX' ]
+
     def __init__(self):
         super().__init__()
 
@@ -27,11 +36,86 @@ class DocCProcessor(DocProcessor):
         #
         self._bitfield_reserved_count = None
 
+        #
+        # Bits of "Reserved" bitfield fields in current bitfield.
+        #
+        self._bitfield_reserved_mask = None
+
+        #
+        # Group which owns the snapshot table and structs enumerated into it.
+        #
+        self._snapshot_group = None
+        self._snapshot = None
+
+        #
+        # Struct (with 'leaf') currently being enumerated into snapshot table.
+        #
+        self._snapshot_struct = None
+
+        #
+        # Features cleared/set by the snapshot policy and resulting AND/OR masks
+        # of each enumerated struct.
+        #
+        self._snapshot_policy = None
+        self._snapshot_policy_masks = None
+
+        #
+        # Slot table (perfect hash) of definitions of group with 'slot_table'.
+        #
+        self._slot_table = None
+
         #
         # Make C++ code.
         #
         self._output_cpp = False
 
+        #
+        # Names and values of all printed definitions (checked for duplicates).
+        #
+        self._definitions = None
+
+        #
+        # Named bitfields which can be referenced from values of definitions.
+        #
+        self._bitfields = None
+
+    def run(self, doc_list: List[DocBase]) -> None:
+        self._definitions = {}
+        self._bitfields = {}
+        self.collect_bitfields(doc_list)
+        super().run(doc_list)
+        self._definitions = None
+        self._bitfields = None
+
+    def collect_bitfields(self, doc_list: List[DocBase]) -> None:
+        for doc in doc_list:
+            #
+            # Names shared by more bitfields (e.g. EAX of CPUID leaves) cannot be referenced.
+            #
+            if isinstance(doc, DocBitfield) and doc.short_name:
+                for name in { doc.short_name, doc.long_name }:
+                    self._bitfields[name] = doc if self._bitfields.get(name, doc) is doc else None
+
+            self.collect_bitfields(doc.fields)
+
+    def print(self, text: str) -> None:
+        if self.opt.definition_check_duplicates and self._definitions is not None and text:
+            for line in text.splitlines():
+                match = re.match(r'\s*#define\s+(\w+)(.*)', line)
+                if match:
+                    name, value = match.group(1), match.group(2).strip()
+
+                    #
+                    # Without struct scope, fields of bitfields nested in structs (e.g. RESERVED of CPUID
+                    # registers) share their names, identical redefinitions are therefore expected.
+                    #
+                    if name in self._definitions and \
+                       (self.opt.bitfield_with_define_struct_scope or self._definitions[name] != value):
+                        raise Exception(f'Duplicate definition {name}!')
+                    self._definitions[name] = value
+
+        super().print(text)
+
     def process_group(self, doc: DocGroup) -> None:
         if self.opt.group_comments and doc.long_description or self.opt.group_defgroup:
             self.print(f'/**')
@@ -41,8 +125,45 @@ class DocCProcessor(DocProcessor):
                 self.print(f' * @{{')
             self.print(f' */')
 
+        #
+        # Start enumerating structs into snapshot table.
+        #
+        if doc.snapshot and self.opt.struct_with_define_snapshot:
+            assert self._snapshot is None
+            self._snapshot_group = doc
+            self._snapshot = []
+
+            if self.opt.struct_with_define_snapshot_policy:
+                with open(self.opt.struct_with_define_snapshot_policy) as f:
+                    policy = yaml.load(f.read(), yaml.FullLoader) or {}
+
+                self._snapshot_policy = {
+                    'clear': set(policy.get('clear') or []),
+                    'set':   set(policy.get('set') or []),
+                }
+                self._snapshot_policy_masks = []
+
+        #
+        # Compute slot table before definitions are printed - each definition
+        # gets its own slot definition.
+        #
+        if doc.slot_table and self.opt.group_with_define_slot_table:
+            assert self._slot_table is None
+            self._slot_table = self.make_slot_table(doc)
+
         self.process(doc.fields)
 
+        if doc.slot_table and self.opt.group_with_define_slot_table:
+            self.print_slot_table(doc)
+            self._slot_table = None
+
+        if doc.snapshot and self.opt.struct_with_define_snapshot:
+            self.print_snapshot(doc)
+            self._snapshot_group = None
+            self._snapshot = None
+            self._snapshot_policy = None
+            self._snapshot_policy_masks = None
+
         if self.opt.group_defgroup:
             self.print(f'/**')
             self.print(f' * @}}')
@@ -71,9 +192,20 @@ class DocCProcessor(DocProcessor):
                 self.align_indent_adjusted
 
         value = f'0x{doc.value:08X}' if isinstance(doc.value, int) else \
-                f'{doc.value}'
+                re.sub(r'\{(\w+)(?:\.(\w+))?\}', self.make_reference, f'{doc.value}')
+
+        #
+        # Function-like macro (enum fields do not have parameters).
+        #
+        definition = name
+        if getattr(doc, 'parameters', None):
+            definition = f'{name}({", ".join(doc.parameters)})'
+
+        self.print(f'#define {definition:<{align}} {value}')
 
-        self.print(f'#define {name:<{align}} {value}')
+        if self._slot_table is not None and doc in self._slot_table['slots']:
+            definition = f'{name}{self.opt.definition_with_define_slot_suffix}'
+            self.print(f'#define {definition:<{align}} {self._slot_table["slots"][doc]}')
 
         self.process(doc.fields)
 
@@ -288,8 +420,10 @@ class DocCProcessor(DocProcessor):
                 with self.indent:
                     assert self._bitfield_position is None
                     assert self._bitfield_reserved_count is None
+                    assert self._bitfield_reserved_mask is None
                     self._bitfield_position = 0
                     self._bitfield_reserved_count = 0
+                    self._bitfield_reserved_mask = 0
 
                     last_field = None
                     for field in doc.fields:
@@ -301,17 +435,27 @@ class DocCProcessor(DocProcessor):
                     # Check if we have to create last "Reserved" field.
                     #
                     last_bit_from, last_bit_to = last_field.bit
-                    if last_bit_to < doc.size and self.opt.bitfield_field_fill_with_reserved:
-                        self._bitfield_reserved_count += 1
+                    if last_bit_to < doc.size:
                         bit_length = doc.size - self._bitfield_position
-                        long_name = f'{self.opt.bitfield_field_reserved_prefix}{self._bitfield_reserved_count}'
-                        self.print(
-                            f'{self.make_size_type(doc.size)[0]} {long_name:<{self.align_indent_adjusted}}: '
-                            f'{bit_length};'
-                        )
+                        self._bitfield_reserved_mask |= ((1 << bit_length) - 1) << self._bitfield_position
+
+                        if self.opt.bitfield_field_fill_with_reserved:
+                            self._bitfield_reserved_count += 1
+                            long_name = f'{self.opt.bitfield_field_reserved_prefix}{self._bitfield_reserved_count}'
+                            self.print(
+                                f'{self.make_size_type(doc.size)[0]} {long_name:<{self.align_indent_adjusted}}: '
+                                f'{bit_length};'
+                            )
+
+                    #
+                    # "Reserved" fields must fill exactly the bits not covered by the field list.
+                    #
+                    if self._bitfield_reserved_mask != self.make_uncovered_mask(doc):
+                        raise Exception(f'{self.make_name(doc)} has overlapping or unordered fields!')
 
                     self._bitfield_position = None
                     self._bitfield_reserved_count = None
+                    self._bitfield_reserved_mask = None
 
                 self.print(f'}};')
 
@@ -336,6 +480,8 @@ class DocCProcessor(DocProcessor):
                     )
                     self.print(f'}} {name};')
 
+                self.print_bitfield_reserved(doc)
+
             self._typedef_nesting -= 1
         else:
             #
@@ -345,8 +491,32 @@ class DocCProcessor(DocProcessor):
                 if isinstance(field, DocBitfieldField):
                     self.process_bitfield_field(field)
 
+            if doc.short_name or doc.long_name:
+                self.print_bitfield_reserved(doc)
+
         self.print(f'')
 
+    def print_bitfield_reserved(self, doc: DocBitfield) -> None:
+        if not self.opt.bitfield_with_define_reserved:
+            return
+
+        align = self.opt.align if self.opt.definition_no_indent else \
+                self.align_indent_adjusted
+
+        prefix = self.make_bitfield_reserved_prefix(doc)
+
+        definition = f'{prefix}{self.opt.bitfield_with_define_reserved_suffix}'
+        self.print(f'#define {definition:<{align}} 0x{self.make_reserved_mask(doc):02X}')
+
+        #
+        # Bits of fields depending on MAXPHYADDR are reserved only above MAXPHYADDR of the processor,
+        # they are left out of the reserved bits and printed separately.
+        #
+        address_mask = self.make_address_mask(doc)
+        if address_mask:
+            definition = f'{prefix}{self.opt.bitfield_with_define_address_bits_suffix}'
+            self.print(f'#define {definition:<{align}} 0x{address_mask:02X}')
+
     def process_bitfield_field(self, doc: DocBitfieldField) -> None:
         bit_from, bit_to = doc.bit
 
@@ -358,6 +528,7 @@ class DocCProcessor(DocProcessor):
                 self._bitfield_reserved_count += 1
 
                 bit_length = bit_from - self._bitfield_position
+                self._bitfield_reserved_mask |= ((1 << bit_length) - 1) << self._bitfield_position
                 long_name = f'{self.opt.bitfield_field_reserved_prefix}{self._bitfield_reserved_count}'
                 self.print(
                     f'{self.make_size_type(doc.parent.size)[0]} {long_name:<{self.align_indent_adjusted}}: '
@@ -399,18 +570,11 @@ class DocCProcessor(DocProcessor):
             ])
 
             if bitfield_field_with_define_any:
-                part1 = self.make_name(doc.parent, override_name_letter_case=self.opt.definition_name_letter_case)
+                part1 = self.make_bitfield_definition_prefix(doc.parent)
                 part2 = self.make_name(doc, override_name_letter_case=self.opt.definition_name_letter_case)
                 align = self.opt.align if self.opt.definition_no_indent else \
                         self.align_indent_adjusted
 
-                #
-                # !!! INCREDIBLY UGLY HACK !!!
-                # Remove _REGISTER suffix.
-                #
-                if 'name_with_suffix' in doc.parent._doc:
-                    part1 = part1[0:(len(part1) - len(doc.parent._doc['name_with_suffix']) - 1)]
-
             if self.opt.bitfield_field_with_define_bit:
                 definition = f'{part1}_{part2}{self.opt.bitfield_field_with_define_bit_suffix}'
                 self.print(f'#define {definition:<{align}} {bit_from}')
@@ -431,6 +595,24 @@ class DocCProcessor(DocProcessor):
                     f'0x{((1 << bit_shift) - 1):02X})'
                 )
 
+            #
+            # Print feature identifier (bit index into the snapshot table) for single-bit fields.
+            #
+            if self._snapshot_struct is not None and bit_shift == 1:
+                struct = self._snapshot_struct
+                assert doc.parent in struct.fields
+
+                struct_bit_offset = 0
+                for field in struct.fields[:struct.fields.index(doc.parent)]:
+                    struct_bit_offset += field.size
+
+                feature = (len(self._snapshot) - 1) * 128 + struct_bit_offset + bit_from
+                align = self.opt.align if self.opt.definition_no_indent else \
+                        self.align_indent_adjusted
+
+                definition = self.make_snapshot_feature_name(struct, doc)
+                self.print(f'#define {definition:<{align}} {feature}')
+
         self._bitfield_position = bit_to
 
         self.process(doc.fields)
@@ -438,6 +620,13 @@ class DocCProcessor(DocProcessor):
     def process_struct(self, doc: DocStruct) -> None:
         self._typedef_nesting += 1
 
+        #
+        # Enumerate root structs with 'leaf' into snapshot table.
+        #
+        if self._snapshot is not None and self._typedef_nesting == 1 and doc.leaf >= 0:
+            self._snapshot_struct = doc
+            self._snapshot.append(doc)
+
         if self.opt.struct_comments and doc.long_description:
             self.print(f'/**')
             self.print_details(doc, treat_description_as_short=True)
@@ -466,6 +655,16 @@ class DocCProcessor(DocProcessor):
         if self._typedef_nesting == 1:
             assert has_name
             self.print(f'}} {self.make_name(doc)};')
+
+            if self._snapshot_struct == doc:
+                part1 = self.make_name(doc, override_name_letter_case=self.opt.definition_name_letter_case)
+                definition = f'{part1}_{self._snapshot_group.snapshot}_INDEX'
+                self.print(f'#define {definition:<{self.opt.align}} {len(self._snapshot) - 1}')
+
+                if self._snapshot_policy is not None:
+                    self.print_snapshot_policy(doc)
+
+                self._snapshot_struct = None
         else:
             if has_name:
                 name = self.make_name(
@@ -506,6 +705,135 @@ class DocCProcessor(DocProcessor):
     # ================================================================================================================ #
     #                                                                                                                  #
 
+    def print_snapshot_policy(self, doc: DocStruct) -> None:
+        #
+        # AND mask keeps only bits described by named fields (except of reserved ones), minus features
+        # cleared by the policy. OR mask holds features set by the policy.
+        #
+        and_masks = []
+        or_masks = []
+
+        for field in doc.fields:
+            assert field.size == 32
+            and_mask = 0
+            or_mask = 0
+
+            if isinstance(field, DocBitfield):
+                for bitfield_field in field.fields:
+                    if bitfield_field.reserved:
+                        continue
+
+                    bit_from, bit_to = bitfield_field.bit
+                    flag = ((1 << (bit_to - bit_from)) - 1) << bit_from
+                    and_mask |= flag
+
+                    if bit_to - bit_from == 1:
+                        name = self.make_snapshot_feature_name(doc, bitfield_field)
+
+                        if name in self._snapshot_policy['clear']:
+                            self._snapshot_policy['clear'].remove(name)
+                            and_mask &= ~flag
+
+                        if name in self._snapshot_policy['set']:
+                            self._snapshot_policy['set'].remove(name)
+                            or_mask |= flag
+            else:
+                and_mask = (1 << field.size) - 1
+
+            and_masks.append(and_mask)
+            or_masks.append(or_mask)
+
+        part1 = self.make_name(doc, override_name_letter_case=self.opt.definition_name_letter_case)
+        for register, and_mask, or_mask in zip(self.SNAPSHOT_REGISTERS, and_masks, or_masks):
+            definition = f'{part1}_{register}_POLICY_AND'
+            self.print(f'#define {definition:<{self.opt.align}} 0x{and_mask:08X}')
+            definition = f'{part1}_{register}_POLICY_OR'
+            self.print(f'#define {definition:<{self.opt.align}} 0x{or_mask:08X}')
+
+        self._snapshot_policy_masks.append((and_masks, or_masks))
+
+    def print_snapshot(self, doc: DocGroup) -> None:
+        name = self.make_table_name(doc, doc.snapshot)
+        argument = self.opt.bitfield_field_with_define_get_macro_argument_name
+
+        #
+        # Number of entries in the snapshot table.
+        #
+        if self.opt.definition_comments:
+            self.print(f'/**')
+            self.print(f' * @brief Number of entries in the {name} table')
+            self.print(f' */')
+
+        self.print(f'#define {name + "_COUNT":<{self.opt.align}} {len(self._snapshot)}')
+        self.print(f'')
+
+        #
+        # Initializer of { leaf, subleaf } pairs, in the order of *_INDEX definitions.
+        #
+        if self.opt.definition_comments:
+            self.print(f'/**')
+            self.print(f' * @brief Initializer of {{ leaf, sub-leaf }} pairs enumerated by the {name} table')
+            self.print(f' *')
+            self.print(f' * Entry n of the table holds EAX, EBX, ECX and EDX (in this order) returned by CPUID executed')
+            self.print(f' * with the leaf and sub-leaf of entry n of this initializer.')
+            self.print(f' */')
+
+        width = len('#define ') + self.opt.align + 1
+        self.print(f'{"#define " + name + "_INITIALIZER":<{width}}\\')
+        self.print(f'{"{":<{width}}\\')
+        for struct in self._snapshot:
+            entry = f'  {{ 0x{struct.leaf:08X}, 0x{struct.subleaf:08X} }},'
+            self.print(f'{entry:<{width}}\\')
+        self.print(f'}}')
+        self.print(f'')
+
+        #
+        # Feature test - single bit test of the *_FEATURE bit index.
+        #
+        if self.opt.definition_comments:
+            self.print(f'/**')
+            self.print(f' * @brief Tests *_FEATURE bit in the {name} table')
+            self.print(f' *')
+            self.print(f' * The table is an array of ({name}_COUNT * 4) 32-bit values.')
+            self.print(f' */')
+
+        definition = f'{name}_HAS_FEATURE({argument}, _feature)'
+        self.print(
+            f'#define {definition:<{self.opt.align}} '
+            f'(((((const {self.opt.int_type_32} *)({argument}))[(_feature) >> 5]) >> ((_feature) & 0x1F)) & 0x01)'
+        )
+
+        if self._snapshot_policy is None:
+            return
+
+        #
+        # Every feature referenced by the policy must exist.
+        #
+        for name_ in self._snapshot_policy['clear'] | self._snapshot_policy['set']:
+            raise Exception(f'{name_} is not valid snapshot feature!')
+
+        #
+        # Initializer of { AND[4], OR[4] } masks, in the order of *_INDEX definitions.
+        #
+        self.print(f'')
+        if self.opt.definition_comments:
+            self.print(f'/**')
+            self.print(f' * @brief Initializer of {{ AND, OR }} policy masks of the {name} table')
+            self.print(f' *')
+            self.print(f' * Value of register r of entry n returned to the guest is:')
+            self.print(f' * (table[n][r] & policy[n][0][r]) | policy[n][1][r]')
+            self.print(f' * where table holds either values of CPUID executed on behalf of the guest or cached host')
+            self.print(f' * values (in which case CPUID does not need to be executed at all).')
+            self.print(f' */')
+
+        self.print(f'{"#define " + name + "_POLICY_INITIALIZER":<{width}}\\')
+        self.print(f'{"{":<{width}}\\')
+        for and_masks, or_masks in self._snapshot_policy_masks:
+            and_entry = ', '.join(f'0x{mask:08X}' for mask in and_masks)
+            or_entry = ', '.join(f'0x{mask:08X}' for mask in or_masks)
+            self.print(f'  {{ {{ {and_entry} }}, {{ {or_entry} }} }}, \\')
+        self.print(f'}}')
+
     def print_details(self, doc: DocBase, treat_description_as_short=False) -> None:
         #
         # Handle group-related comments.
@@ -605,6 +933,329 @@ class DocCProcessor(DocProcessor):
             else:
                 self.print(f' * @see {doc.reference} (reference)')
 
+    def print_slot_table(self, doc: DocGroup) -> None:
+        name = self.make_table_name(doc, doc.slot_table)
+        argument = self.opt.bitfield_field_with_define_get_macro_argument_name
+        table = self._slot_table
+
+        slot_shift = 32 - table['slot_bits']
+        bucket_shift = 32 - table['bucket_bits']
+
+        #
+        # Number of slots in the slot table.
+        #
+        if self.opt.definition_comments:
+            self.print(f'/**')
+            self.print(f' * @brief Number of slots in the {name} table')
+            self.print(f' */')
+
+        self.print(f'#define {name + "_COUNT":<{self.opt.align}} {1 << table["slot_bits"]}')
+        self.print(f'')
+
+        #
+        # Hash functions.
+        #
+        if self.opt.definition_comments:
+            self.print(f'/**')
+            self.print(f' * @brief Index into the {name}_DISPLACEMENT table')
+            self.print(f' */')
+
+        definition = f'{name}_BUCKET({argument})'
+        self.print(
+            f'#define {definition:<{self.opt.align}} '
+            f'(((({self.opt.int_type_32})({argument})) * 0x{table["bucket_multiplier"]:08X}) >> {bucket_shift})'
+        )
+        self.print(f'')
+
+        if self.opt.definition_comments:
+            self.print(f'/**')
+            self.print(f' * @brief Slot of the address in the {name} table')
+            self.print(f' *')
+            self.print(f' * Every address defined in this group maps to its own slot (see *{self.opt.definition_with_define_slot_suffix} definitions).')
+            self.print(f' * Other addresses map to arbitrary slot, therefore the address held by the slot must be compared')
+            self.print(f' * with the looked up address. _displacement is an array initialized with {name}_DISPLACEMENT_INITIALIZER.')
+            self.print(f' */')
+
+        definition = f'{name}({argument}, _displacement)'
+        self.print(
+            f'#define {definition:<{self.opt.align}} '
+            f'((((({self.opt.int_type_32})({argument})) * 0x{table["slot_multiplier"]:08X}) >> {slot_shift}) ^ '
+            f'((_displacement)[{name}_BUCKET({argument})]))'
+        )
+        self.print(f'')
+
+        #
+        # Displacement of each bucket.
+        #
+        if self.opt.definition_comments:
+            self.print(f'/**')
+            self.print(f' * @brief Initializer of {name}_DISPLACEMENT table')
+            self.print(f' */')
+
+        lines = [
+            '  ' + ' '.join(f'0x{displacement:04X},' for displacement in table['displacement'][i:i + 8])
+            for i in range(0, len(table['displacement']), 8)
+        ]
+        self.print_initializer(f'{name}_DISPLACEMENT_INITIALIZER', lines)
+        self.print(f'')
+
+        #
+        # Address and reserved bits of each slot.
+        #
+        if self.opt.definition_comments:
+            self.print(f'/**')
+            self.print(f' * @brief Initializer of {{ address, reserved bits, address bits }} entries of the {name} table')
+            self.print(f' *')
+            self.print(f' * Value written to the address held by the slot is valid only if')
+            self.print(f' * (value & (reserved bits | (address bits & ~((1ULL << MAXPHYADDR) - 1)))) == 0, where address bits')
+            self.print(f' * are bits of physical-address fields (up to bit {MAXPHYADDR_MAX - 1}) and MAXPHYADDR is the physical-address')
+            self.print(f' * width of the processor. Addresses without bitfield hold no reserved bits, so any value passes.')
+            self.print(f' * Unused slots hold address 0x{0xFFFFFFFF:08X} and all bits reserved.')
+            self.print(f' */')
+
+        entries = [
+            f'{{ 0x{address:08X}, 0x{reserved:016X}, 0x{address_bits:016X} }},'
+            for address, reserved, address_bits in table['entries']
+        ]
+        lines = [
+            '  ' + ' '.join(entries[i:i + 2])
+            for i in range(0, len(entries), 2)
+        ]
+        self.print_initializer(f'{name}_INITIALIZER', lines)
+
+    def print_initializer(self, name: str, lines: List[str]) -> None:
+        width = max(len('#define ') + self.opt.align, max(len(line) for line in lines)) + 1
+        self.print(f'{"#define " + name:<{width}}\\')
+        self.print(f'{"{":<{width}}\\')
+        for line in lines:
+            self.print(f'{line:<{width}}\\')
+        self.print(f'}}')
+
+    def make_slot_table(self, doc: DocGroup) -> dict:
+        #
+        # Collect definitions of addresses (helper constants are tagged 'Custom').
+        # Reserved bits are taken from bitfield of the definition or bitfield shared
+        # by the whole subgroup.
+        #
+        definitions = []
+
+        def collect(group: DocGroup, shared_bitfield: DocBitfield) -> None:
+            bitfield = next((field for field in group.fields if isinstance(field, DocBitfield)), shared_bitfield)
+
+            for field in group.fields:
+                if isinstance(field, DocGroup):
+                    collect(field, bitfield)
+                elif isinstance(field, DocDefinition) and isinstance(field.value, int) and field.tag != 'Custom':
+                    definition_bitfield = next((f for f in field.fields if isinstance(f, DocBitfield)), bitfield)
+                    definitions.append((field, definition_bitfield))
+
+        collect(doc, None)
+
+        addresses = [ definition.value for definition, _ in definitions ]
+        if len(set(addresses)) != len(addresses):
+            raise Exception(f'{doc.short_name} contains duplicate addresses!')
+
+        #
+        # Load factor is kept at most 3/4, each bucket holds 4 slots on average.
+        #
+        slot_bits = (len(definitions) * 4 // 3 - 1).bit_length()
+        bucket_bits = max(0, slot_bits - 2)
+        slot_count = 1 << slot_bits
+        bucket_count = 1 << bucket_bits
+
+        def hash_(value: int, multiplier: int, bits: int) -> int:
+            return ((value * multiplier) & 0xFFFFFFFF) >> (32 - bits)
+
+        #
+        # Hash-and-displace: addresses are split into buckets by first hash, then each bucket
+        # (largest first) gets displacement XOR-ed with second hash, such that all its addresses
+        # land in free slots. Multipliers come from fixed LCG, so the output is stable.
+        #
+        state = 0x853C49E6748FEA9B
+
+        for _ in range(1000):
+            state = (state * 6364136223846793005 + 1442695040888963407) & 0xFFFFFFFFFFFFFFFF
+            bucket_multiplier = (state >> 32) | 1
+            state = (state * 6364136223846793005 + 1442695040888963407) & 0xFFFFFFFFFFFFFFFF
+            slot_multiplier = (state >> 32) | 1
+
+            buckets = [ [] for _ in range(bucket_count) ]
+            for definition, bitfield in definitions:
+                buckets[hash_(definition.value, bucket_multiplier, bucket_bits)].append((definition, bitfield))
+
+            displacement = [ 0 ] * bucket_count
+            slots = [ None ] * slot_count
+
+            for bucket in sorted(range(bucket_count), key=lambda b: -len(buckets[b])):
+                hashes = [ hash_(definition.value, slot_multiplier, slot_bits) for definition, _ in buckets[bucket] ]
+                if len(set(hashes)) != len(hashes):
+                    break
+
+                for candidate in range(slot_count):
+                    if all(slots[hash__ ^ candidate] is None for hash__ in hashes):
+                        break
+                else:
+                    break
+
+                displacement[bucket] = candidate
+                for hash__, entry in zip(hashes, buckets[bucket]):
+                    slots[hash__ ^ candidate] = entry
+            else:
+                return {
+                    'slot_bits': slot_bits,
+                    'bucket_bits': bucket_bits,
+                    'slot_multiplier': slot_multiplier,
+                    'bucket_multiplier': bucket_multiplier,
+                    'displacement': displacement,
+                    'slots': { entry[0]: slot for slot, entry in enumerate(slots) if entry },
+                    'entries': [
+                        (entry[0].value, self.make_reserved_mask(entry[1]), self.make_address_mask(entry[1])) if entry else
+                        (0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0)
+                        for entry in slots
+                    ],
+                }
+
+        raise Exception(f'Cannot create slot table of {doc.short_name}!')
+
+    @staticmethod
+    def make_uncovered_mask(doc: DocBitfield) -> int:
+        #
+        # Bits not covered by any bitfield field - the same ones which are filled with
+        # "Reserved" fields.
+        #
+        mask = (1 << doc.size) - 1
+        for field in doc.fields:
+            if isinstance(field, DocBitfieldField):
+                bit_from, bit_to = field.bit
+                mask &= ~(((1 << (bit_to - bit_from)) - 1) << bit_from)
+
+        return mask
+
+    @classmethod
+    def make_address_mask(cls, doc: DocBitfield) -> int:
+        #
+        # Bits of fields ending at (MAXPHYADDR-1), extended up to the architectural maximum
+        # of MAXPHYADDR (as long as the bits are not covered by other fields).
+        #
+        if doc is None:
+            return 0
+
+        uncovered = cls.make_uncovered_mask(doc)
+
+        mask = 0
+        for field in doc.fields:
+            if isinstance(field, DocBitfieldField) and field.address_bit:
+                bit_from, bit_to = field.bit
+                address_from, address_to = field.address_bit
+                field_mask = ((1 << (bit_to - bit_from)) - 1) << bit_from
+                mask |= (((1 << (address_to - address_from)) - 1) << address_from) & (uncovered | field_mask)
+
+        return mask & ((1 << doc.size) - 1)
+
+    @classmethod
+    def make_reserved_mask(cls, doc: DocBitfield) -> int:
+        #
+        # Bits not covered by any bitfield field and bits of fields named as reserved, except of bits
+        # which belong to physical-address fields on processors with larger MAXPHYADDR. Without bitfield,
+        # nothing is known to be reserved.
+        #
+        if doc is None:
+            return 0
+
+        mask = cls.make_uncovered_mask(doc)
+        for field in doc.fields:
+            if isinstance(field, DocBitfieldField) and field.reserved:
+                bit_from, bit_to = field.bit
+                mask |= ((1 << (bit_to - bit_from)) - 1) << bit_from
+
+        return mask & ~cls.make_address_mask(doc)
+
+    def make_bitfield_definition_prefix(self, doc: DocBitfield) -> str:
+        #
+        # Bitfields nested in structs without alternative name (e.g. 'Lower64' of VT-d
+        # entries) would share prefix with bitfields of other structs.
+        #
+        if self.opt.bitfield_with_define_struct_scope and isinstance(doc.parent, DocStruct) and \
+           not doc.alternative_name:
+            return self.make_struct_scoped_prefix(doc)
+
+        result = self.make_name(doc, override_name_letter_case=self.opt.definition_name_letter_case)
+
+        #
+        # !!! INCREDIBLY UGLY HACK !!!
+        # Remove _REGISTER suffix.
+        #
+        if 'name_with_suffix' in doc._doc:
+            result = result[0:(len(result) - len(doc._doc['name_with_suffix']) - 1)]
+
+        return result
+
+    def make_bitfield_reserved_prefix(self, doc: DocBitfield) -> str:
+        #
+        # Names of bitfields nested in structs are not unique (e.g. EAX of CPUID leaves),
+        # scope them by name of the root struct.
+        #
+        if isinstance(doc.parent, DocStruct):
+            return self.make_struct_scoped_prefix(doc)
+
+        return self.make_bitfield_definition_prefix(doc)
+
+    def make_reference(self, match: re.Match) -> str:
+        #
+        # {BITFIELD} stands for reserved bits of the bitfield and {BITFIELD.FIELD} for flag of its field.
+        # Reference is printed as the definition of these bits if it is printed with current options,
+        # otherwise as the value itself.
+        #
+        name, field_name = match.groups()
+        if not self._bitfields.get(name):
+            raise Exception(f'Unknown reference {match.group(0)}!')
+
+        bitfield = self._bitfields[name]
+
+        if field_name is None:
+            if self.opt.bitfield_with_define_reserved:
+                return f'{self.make_bitfield_reserved_prefix(bitfield)}{self.opt.bitfield_with_define_reserved_suffix}'
+
+            return f'0x{self.make_reserved_mask(bitfield):02X}'
+
+        for field in bitfield.fields:
+            if isinstance(field, DocBitfieldField) and \
+               field_name in (field.short_name_standalone, field.long_name_standalone, field._doc.get('alternative_name')):
+                if self.opt.bitfield_field_with_define_flag:
+                    part1 = self.make_bitfield_definition_prefix(bitfield)
+                    part2 = self.make_name(field, override_name_letter_case=self.opt.definition_name_letter_case)
+                    return f'{part1}_{part2}{self.opt.bitfield_field_with_define_flag_suffix}'
+
+                bit_from, bit_to = field.bit
+                return f'0x{(((1 << (bit_to - bit_from)) - 1) << bit_from):02X}'
+
+        raise Exception(f'Unknown reference {match.group(0)}!')
+
+    def make_struct_scoped_prefix(self, doc: DocBitfield) -> str:
+        struct = doc.parent
+        while isinstance(struct.parent, DocStruct):
+            struct = struct.parent
+
+        result = self.make_name(struct, override_name_letter_case=self.opt.definition_name_letter_case)
+
+        #
+        # Anonymous bitfields are scoped by the struct only.
+        #
+        if doc.short_name_standalone:
+            name = DocText.convert_case(doc.short_name_standalone.upper(), self.opt.definition_name_letter_case)
+            result = f'{result}_{name}'
+
+        return result
+
+    def make_table_name(self, doc: DocGroup, suffix: str) -> str:
+        #
+        # Prefer prefix of children (e.g. IA32 for MSRs) over name of the group.
+        #
+        prefix = doc.children_name_with_prefix or \
+                 self.make_name(doc, override_name_letter_case=self.opt.definition_name_letter_case)
+
+        return f'{prefix}_{suffix}'
+
     def make_name(self, doc: DocBase,
                   long: bool=None, raw: bool=False, standalone: bool=False,
                   override_name_letter_case: str=None) -> str:
@@ -665,6 +1316,13 @@ class DocCProcessor(DocProcessor):
 
         return result
 
+    def make_snapshot_feature_name(self, struct: DocStruct, doc: DocBitfieldField) -> str:
+        part0 = self.make_name(struct, override_name_letter_case=self.opt.definition_name_letter_case)
+        part1 = doc.parent.short_name_standalone
+        part2 = self.make_name(doc, override_name_letter_case=self.opt.definition_name_letter_case)
+
+        return f'{part0}_{part1}_{part2}{self.opt.struct_with_define_snapshot_feature_suffix}'
+
     @property
     def align_indent_adjusted(self) -> int:
         return max(0, self.opt.align - self.indent.indent)
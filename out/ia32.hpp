@@ -254,12 +254,20 @@ typedef union
 
   uint64_t flags;
 } cr0;
+#define CR0_RESERVED_BITS                                            0xFFFFFFFF1FFAFFC0
 
 typedef union
 {
   struct
   {
-    uint64_t reserved1                                               : 3;
+    /**
+     * [Bits 2:0] Ignored. With CR4.PCIDE = 1, bits 11:0 hold the current PCID.
+     */
+    uint64_t ignored_1                                               : 3;
+#define CR3_IGNORED_1_BIT                                            0
+#define CR3_IGNORED_1_FLAG                                           0x07
+#define CR3_IGNORED_1_MASK                                           0x07
+#define CR3_IGNORED_1(_)                                             (((_) >> 0) & 0x07)
 
     /**
      * @brief Page-level Write-Through
@@ -288,7 +296,15 @@ typedef union
 #define CR3_PAGE_LEVEL_CACHE_DISABLE_FLAG                            0x10
 #define CR3_PAGE_LEVEL_CACHE_DISABLE_MASK                            0x01
 #define CR3_PAGE_LEVEL_CACHE_DISABLE(_)                              (((_) >> 4) & 0x01)
-    uint64_t reserved2                                               : 7;
+
+    /**
+     * [Bits 11:5] Ignored. With CR4.PCIDE = 1, bits 11:0 hold the current PCID.
+     */
+    uint64_t ignored_2                                               : 7;
+#define CR3_IGNORED_2_BIT                                            5
+#define CR3_IGNORED_2_FLAG                                           0xFE0
+#define CR3_IGNORED_2_MASK                                           0x7F
+#define CR3_IGNORED_2(_)                                             (((_) >> 5) & 0x7F)
 
     /**
      * @brief Address of page directory
@@ -304,11 +320,13 @@ typedef union
 #define CR3_ADDRESS_OF_PAGE_DIRECTORY_FLAG                           0xFFFFFFFFF000
 #define CR3_ADDRESS_OF_PAGE_DIRECTORY_MASK                           0xFFFFFFFFF
 #define CR3_ADDRESS_OF_PAGE_DIRECTORY(_)                             (((_) >> 12) & 0xFFFFFFFFF)
-    uint64_t reserved3                                               : 16;
+    uint64_t reserved1                                               : 16;
   };
 
   uint64_t flags;
 } cr3;
+#define CR3_RESERVED_BITS                                            0xFFF0000000000000
+#define CR3_ADDRESS_BITS                                             0xFFFFFFFFFF000
 
 typedef union
 {
@@ -714,6 +732,7 @@ typedef union
 
   uint64_t flags;
 } cr4;
+#define CR4_RESERVED_BITS                                            0xFFFFFFFEE4008000
 
 typedef union
 {
@@ -746,6 +765,7 @@ typedef union
 
   uint64_t flags;
 } cr8;
+#define CR8_RESERVED_BITS                                            0xFFFFFFFFFFFFFFF0
 
 /**
  * @}
@@ -852,6 +872,7 @@ typedef union
 
   uint64_t flags;
 } dr6;
+#define DR6_RESERVED_BITS                                            0xFFFFFFFFFFFE1FF0
 
 typedef union
 {
@@ -1043,6 +1064,7 @@ typedef union
 
   uint64_t flags;
 } dr7;
+#define DR7_RESERVED_BITS                                            0xFFFFFFFF0000D400
 
 /**
  * @}
@@ -1097,6 +1119,15 @@ typedef struct
    */
   uint32_t edx_value_inei;
 } cpuid_eax_00;
+#define CPUID_EAX_00_SNAPSHOT_INDEX                                  0
+#define CPUID_EAX_00_EAX_POLICY_AND                                  0xFFFFFFFF
+#define CPUID_EAX_00_EAX_POLICY_OR                                   0x00000000
+#define CPUID_EAX_00_EBX_POLICY_AND                                  0xFFFFFFFF
+#define CPUID_EAX_00_EBX_POLICY_OR                                   0x00000000
+#define CPUID_EAX_00_ECX_POLICY_AND                                  0xFFFFFFFF
+#define CPUID_EAX_00_ECX_POLICY_OR                                   0x00000000
+#define CPUID_EAX_00_EDX_POLICY_AND                                  0xFFFFFFFF
+#define CPUID_EAX_00_EDX_POLICY_OR                                   0x00000000
 
 
 /**
@@ -1168,6 +1199,7 @@ typedef struct
 
     uint32_t flags;
   } cpuid_version_information;
+#define CPUID_EAX_01_EAX_RESERVED_BITS                               0xF000C000
 
   /**
    * @brief When CPUID executes with EAX set to 01H, additional information is returned to the EBX register
@@ -1224,6 +1256,7 @@ typedef struct
 
     uint32_t flags;
   } cpuid_additional_information;
+#define CPUID_EAX_01_EBX_RESERVED_BITS                               0x00
 
   /**
    * @brief When CPUID executes with EAX set to 01H, feature information is returned in ECX and EDX
@@ -1242,6 +1275,7 @@ typedef struct
 #define CPUID_FEATURE_INFORMATION_ECX_STREAMING_SIMD_EXTENSIONS_3_FLAG 0x01
 #define CPUID_FEATURE_INFORMATION_ECX_STREAMING_SIMD_EXTENSIONS_3_MASK 0x01
 #define CPUID_FEATURE_INFORMATION_ECX_STREAMING_SIMD_EXTENSIONS_3(_) (((_) >> 0) & 0x01)
+#define CPUID_EAX_01_ECX_STREAMING_SIMD_EXTENSIONS_3_FEATURE         192
 
       /**
        * @brief PCLMULQDQ instruction
@@ -1253,6 +1287,7 @@ typedef struct
 #define CPUID_FEATURE_INFORMATION_ECX_PCLMULQDQ_INSTRUCTION_FLAG     0x02
 #define CPUID_FEATURE_INFORMATION_ECX_PCLMULQDQ_INSTRUCTION_MASK     0x01
 #define CPUID_FEATURE_INFORMATION_ECX_PCLMULQDQ_INSTRUCTION(_)       (((_) >> 1) & 0x01)
+#define CPUID_EAX_01_ECX_PCLMULQDQ_INSTRUCTION_FEATURE               193
 
       /**
        * @brief 64-bit DS Area
@@ -1264,6 +1299,7 @@ typedef struct
 #define CPUID_FEATURE_INFORMATION_ECX_DS_AREA_64BIT_LAYOUT_FLAG      0x04
 #define CPUID_FEATURE_INFORMATION_ECX_DS_AREA_64BIT_LAYOUT_MASK      0x01
 #define CPUID_FEATURE_INFORMATION_ECX_DS_AREA_64BIT_LAYOUT(_)        (((_) >> 2) & 0x01)
+#define CPUID_EAX_01_ECX_DS_AREA_64BIT_LAYOUT_FEATURE                194
 
       /**
        * @brief MONITOR/MWAIT instruction
@@ -1275,6 +1311,7 @@ typedef struct
 #define CPUID_FEATURE_INFORMATION_ECX_MONITOR_MWAIT_INSTRUCTION_FLAG 0x08
 #define CPUID_FEATURE_INFORMATION_ECX_MONITOR_MWAIT_INSTRUCTION_MASK 0x01
 #define CPUID_FEATURE_INFORMATION_ECX_MONITOR_MWAIT_INSTRUCTION(_)   (((_) >> 3) & 0x01)
+#define CPUID_EAX_01_ECX_MONITOR_MWAIT_INSTRUCTION_FEATURE           195
 
       /**
        * @brief CPL Qualified Debug Store
@@ -1287,6 +1324,7 @@ typedef struct
 #define CPUID_FEATURE_INFORMATION_ECX_CPL_QUALIFIED_DEBUG_STORE_FLAG 0x10
 #define CPUID_FEATURE_INFORMATION_ECX_CPL_QUALIFIED_DEBUG_STORE_MASK 0x01
 #define CPUID_FEATURE_INFORMATION_ECX_CPL_QUALIFIED_DEBUG_STORE(_)   (((_) >> 4) & 0x01)
+#define CPUID_EAX_01_ECX_CPL_QUALIFIED_DEBUG_STORE_FEATURE           196
 
       /**
        * @brief Virtual Machine Extensions
@@ -1298,6 +1336,7 @@ typedef struct
 #define CPUID_FEATURE_INFORMATION_ECX_VIRTUAL_MACHINE_EXTENSIONS_FLAG 0x20
 #define CPUID_FEATURE_INFORMATION_ECX_VIRTUAL_MACHINE_EXTENSIONS_MASK 0x01
 #define CPUID_FEATURE_INFORMATION_ECX_VIRTUAL_MACHINE_EXTENSIONS(_)  (((_) >> 5) & 0x01)
+#define CPUID_EAX_01_ECX_VIRTUAL_MACHINE_EXTENSIONS_FEATURE          197
 
       /**
        * @brief Safer Mode Extensions
@@ -1311,6 +1350,7 @@ typedef struct
 #define CPUID_FEATURE_INFORMATION_ECX_SAFER_MODE_EXTENSIONS_FLAG     0x40
 #define CPUID_FEATURE_INFORMATION_ECX_SAFER_MODE_EXTENSIONS_MASK     0x01
 #define CPUID_FEATURE_INFORMATION_ECX_SAFER_MODE_EXTENSIONS(_)       (((_) >> 6) & 0x01)
+#define CPUID_EAX_01_ECX_SAFER_MODE_EXTENSIONS_FEATURE               198
 
       /**
        * @brief Enhanced Intel SpeedStep(R) technology
@@ -1322,6 +1362,7 @@ typedef struct
 #define CPUID_FEATURE_INFORMATION_ECX_ENHANCED_INTEL_SPEEDSTEP_TECHNOLOGY_FLAG 0x80
 #define CPUID_FEATURE_INFORMATION_ECX_ENHANCED_INTEL_SPEEDSTEP_TECHNOLOGY_MASK 0x01
 #define CPUID_FEATURE_INFORMATION_ECX_ENHANCED_INTEL_SPEEDSTEP_TECHNOLOGY(_) (((_) >> 7) & 0x01)
+#define CPUID_EAX_01_ECX_ENHANCED_INTEL_SPEEDSTEP_TECHNOLOGY_FEATURE 199
 
       /**
        * @brief Thermal Monitor 2
@@ -1333,6 +1374,7 @@ typedef struct
 #define CPUID_FEATURE_INFORMATION_ECX_THERMAL_MONITOR_2_FLAG         0x100
 #define CPUID_FEATURE_INFORMATION_ECX_THERMAL_MONITOR_2_MASK         0x01
 #define CPUID_FEATURE_INFORMATION_ECX_THERMAL_MONITOR_2(_)           (((_) >> 8) & 0x01)
+#define CPUID_EAX_01_ECX_THERMAL_MONITOR_2_FEATURE                   200
 
       /**
        * @brief Supplemental Streaming SIMD Extensions 3 (SSSE3)
@@ -1345,6 +1387,7 @@ typedef struct
 #define CPUID_FEATURE_INFORMATION_ECX_SUPPLEMENTAL_STREAMING_SIMD_EXTENSIONS_3_FLAG 0x200
 #define CPUID_FEATURE_INFORMATION_ECX_SUPPLEMENTAL_STREAMING_SIMD_EXTENSIONS_3_MASK 0x01
 #define CPUID_FEATURE_INFORMATION_ECX_SUPPLEMENTAL_STREAMING_SIMD_EXTENSIONS_3(_) (((_) >> 9) & 0x01)
+#define CPUID_EAX_01_ECX_SUPPLEMENTAL_STREAMING_SIMD_EXTENSIONS_3_FEATURE 201
 
       /**
        * @brief L1 Context ID
@@ -1358,6 +1401,7 @@ typedef struct
 #define CPUID_FEATURE_INFORMATION_ECX_L1_CONTEXT_ID_FLAG             0x400
 #define CPUID_FEATURE_INFORMATION_ECX_L1_CONTEXT_ID_MASK             0x01
 #define CPUID_FEATURE_INFORMATION_ECX_L1_CONTEXT_ID(_)               (((_) >> 10) & 0x01)
+#define CPUID_EAX_01_ECX_L1_CONTEXT_ID_FEATURE                       202
 
       /**
        * @brief IA32_DEBUG_INTERFACE MSR for silicon debug
@@ -1369,6 +1413,7 @@ typedef struct
 #define CPUID_FEATURE_INFORMATION_ECX_SILICON_DEBUG_FLAG             0x800
 #define CPUID_FEATURE_INFORMATION_ECX_SILICON_DEBUG_MASK             0x01
 #define CPUID_FEATURE_INFORMATION_ECX_SILICON_DEBUG(_)               (((_) >> 11) & 0x01)
+#define CPUID_EAX_01_ECX_SILICON_DEBUG_FEATURE                       203
 
       /**
        * @brief FMA extensions using YMM state
@@ -1380,6 +1425,7 @@ typedef struct
 #define CPUID_FEATURE_INFORMATION_ECX_FMA_EXTENSIONS_FLAG            0x1000
 #define CPUID_FEATURE_INFORMATION_ECX_FMA_EXTENSIONS_MASK            0x01
 #define CPUID_FEATURE_INFORMATION_ECX_FMA_EXTENSIONS(_)              (((_) >> 12) & 0x01)
+#define CPUID_EAX_01_ECX_FMA_EXTENSIONS_FEATURE                      204
 
       /**
        * @brief CMPXCHG16B instruction
@@ -1391,6 +1437,7 @@ typedef struct
 #define CPUID_FEATURE_INFORMATION_ECX_CMPXCHG16B_INSTRUCTION_FLAG    0x2000
 #define CPUID_FEATURE_INFORMATION_ECX_CMPXCHG16B_INSTRUCTION_MASK    0x01
 #define CPUID_FEATURE_INFORMATION_ECX_CMPXCHG16B_INSTRUCTION(_)      (((_) >> 13) & 0x01)
+#define CPUID_EAX_01_ECX_CMPXCHG16B_INSTRUCTION_FEATURE              205
 
       /**
        * @brief xTPR Update Control
@@ -1402,6 +1449,7 @@ typedef struct
 #define CPUID_FEATURE_INFORMATION_ECX_XTPR_UPDATE_CONTROL_FLAG       0x4000
 #define CPUID_FEATURE_INFORMATION_ECX_XTPR_UPDATE_CONTROL_MASK       0x01
 #define CPUID_FEATURE_INFORMATION_ECX_XTPR_UPDATE_CONTROL(_)         (((_) >> 14) & 0x01)
+#define CPUID_EAX_01_ECX_XTPR_UPDATE_CONTROL_FEATURE                 206
 
       /**
        * @brief Perfmon and Debug Capability
@@ -1414,6 +1462,7 @@ typedef struct
 #define CPUID_FEATURE_INFORMATION_ECX_PERFMON_AND_DEBUG_CAPABILITY_FLAG 0x8000
 #define CPUID_FEATURE_INFORMATION_ECX_PERFMON_AND_DEBUG_CAPABILITY_MASK 0x01
 #define CPUID_FEATURE_INFORMATION_ECX_PERFMON_AND_DEBUG_CAPABILITY(_) (((_) >> 15) & 0x01)
+#define CPUID_EAX_01_ECX_PERFMON_AND_DEBUG_CAPABILITY_FEATURE        207
       uint32_t reserved1                                             : 1;
 
       /**
@@ -1426,6 +1475,7 @@ typedef struct
 #define CPUID_FEATURE_INFORMATION_ECX_PROCESS_CONTEXT_IDENTIFIERS_FLAG 0x20000
 #define CPUID_FEATURE_INFORMATION_ECX_PROCESS_CONTEXT_IDENTIFIERS_MASK 0x01
 #define CPUID_FEATURE_INFORMATION_ECX_PROCESS_CONTEXT_IDENTIFIERS(_) (((_) >> 17) & 0x01)
+#define CPUID_EAX_01_ECX_PROCESS_CONTEXT_IDENTIFIERS_FEATURE         209
 
       /**
        * @brief Direct Cache Access
@@ -1438,6 +1488,7 @@ typedef struct
 #define CPUID_FEATURE_INFORMATION_ECX_DIRECT_CACHE_ACCESS_FLAG       0x40000
 #define CPUID_FEATURE_INFORMATION_ECX_DIRECT_CACHE_ACCESS_MASK       0x01
 #define CPUID_FEATURE_INFORMATION_ECX_DIRECT_CACHE_ACCESS(_)         (((_) >> 18) & 0x01)
+#define CPUID_EAX_01_ECX_DIRECT_CACHE_ACCESS_FEATURE                 210
 
       /**
        * @brief SSE4.1 support
@@ -1449,6 +1500,7 @@ typedef struct
 #define CPUID_FEATURE_INFORMATION_ECX_SSE41_SUPPORT_FLAG             0x80000
 #define CPUID_FEATURE_INFORMATION_ECX_SSE41_SUPPORT_MASK             0x01
 #define CPUID_FEATURE_INFORMATION_ECX_SSE41_SUPPORT(_)               (((_) >> 19) & 0x01)
+#define CPUID_EAX_01_ECX_SSE41_SUPPORT_FEATURE                       211
 
       /**
        * @brief SSE4.2 support
@@ -1460,6 +1512,7 @@ typedef struct
 #define CPUID_FEATURE_INFORMATION_ECX_SSE42_SUPPORT_FLAG             0x100000
 #define CPUID_FEATURE_INFORMATION_ECX_SSE42_SUPPORT_MASK             0x01
 #define CPUID_FEATURE_INFORMATION_ECX_SSE42_SUPPORT(_)               (((_) >> 20) & 0x01)
+#define CPUID_EAX_01_ECX_SSE42_SUPPORT_FEATURE                       212
 
       /**
        * @brief x2APIC support
@@ -1471,6 +1524,7 @@ typedef struct
 #define CPUID_FEATURE_INFORMATION_ECX_X2APIC_SUPPORT_FLAG            0x200000
 #define CPUID_FEATURE_INFORMATION_ECX_X2APIC_SUPPORT_MASK            0x01
 #define CPUID_FEATURE_INFORMATION_ECX_X2APIC_SUPPORT(_)              (((_) >> 21) & 0x01)
+#define CPUID_EAX_01_ECX_X2APIC_SUPPORT_FEATURE                      213
 
       /**
        * @brief MOVBE instruction
@@ -1482,6 +1536,7 @@ typedef struct
 #define CPUID_FEATURE_INFORMATION_ECX_MOVBE_INSTRUCTION_FLAG         0x400000
 #define CPUID_FEATURE_INFORMATION_ECX_MOVBE_INSTRUCTION_MASK         0x01
 #define CPUID_FEATURE_INFORMATION_ECX_MOVBE_INSTRUCTION(_)           (((_) >> 22) & 0x01)
+#define CPUID_EAX_01_ECX_MOVBE_INSTRUCTION_FEATURE                   214
 
       /**
        * @brief POPCNT instruction
@@ -1493,6 +1548,7 @@ typedef struct
 #define CPUID_FEATURE_INFORMATION_ECX_POPCNT_INSTRUCTION_FLAG        0x800000
 #define CPUID_FEATURE_INFORMATION_ECX_POPCNT_INSTRUCTION_MASK        0x01
 #define CPUID_FEATURE_INFORMATION_ECX_POPCNT_INSTRUCTION(_)          (((_) >> 23) & 0x01)
+#define CPUID_EAX_01_ECX_POPCNT_INSTRUCTION_FEATURE                  215
 
       /**
        * @brief TSC Deadline
@@ -1505,6 +1561,7 @@ typedef struct
 #define CPUID_FEATURE_INFORMATION_ECX_TSC_DEADLINE_FLAG              0x1000000
 #define CPUID_FEATURE_INFORMATION_ECX_TSC_DEADLINE_MASK              0x01
 #define CPUID_FEATURE_INFORMATION_ECX_TSC_DEADLINE(_)                (((_) >> 24) & 0x01)
+#define CPUID_EAX_01_ECX_TSC_DEADLINE_FEATURE                        216
 
       /**
        * @brief AESNI instruction extensions
@@ -1516,6 +1573,7 @@ typedef struct
 #define CPUID_FEATURE_INFORMATION_ECX_AESNI_INSTRUCTION_EXTENSIONS_FLAG 0x2000000
 #define CPUID_FEATURE_INFORMATION_ECX_AESNI_INSTRUCTION_EXTENSIONS_MASK 0x01
 #define CPUID_FEATURE_INFORMATION_ECX_AESNI_INSTRUCTION_EXTENSIONS(_) (((_) >> 25) & 0x01)
+#define CPUID_EAX_01_ECX_AESNI_INSTRUCTION_EXTENSIONS_FEATURE        217
 
       /**
        * @brief XSAVE/XRSTOR instruction extensions
@@ -1528,6 +1586,7 @@ typedef struct
 #define CPUID_FEATURE_INFORMATION_ECX_XSAVE_XRSTOR_INSTRUCTION_FLAG  0x4000000
 #define CPUID_FEATURE_INFORMATION_ECX_XSAVE_XRSTOR_INSTRUCTION_MASK  0x01
 #define CPUID_FEATURE_INFORMATION_ECX_XSAVE_XRSTOR_INSTRUCTION(_)    (((_) >> 26) & 0x01)
+#define CPUID_EAX_01_ECX_XSAVE_XRSTOR_INSTRUCTION_FEATURE            218
 
       /**
        * @brief CR4.OSXSAVE[bit 18] set
@@ -1540,6 +1599,7 @@ typedef struct
 #define CPUID_FEATURE_INFORMATION_ECX_OSX_SAVE_FLAG                  0x8000000
 #define CPUID_FEATURE_INFORMATION_ECX_OSX_SAVE_MASK                  0x01
 #define CPUID_FEATURE_INFORMATION_ECX_OSX_SAVE(_)                    (((_) >> 27) & 0x01)
+#define CPUID_EAX_01_ECX_OSX_SAVE_FEATURE                            219
 
       /**
        * @brief AVX instruction extensions support
@@ -1551,6 +1611,7 @@ typedef struct
 #define CPUID_FEATURE_INFORMATION_ECX_AVX_SUPPORT_FLAG               0x10000000
 #define CPUID_FEATURE_INFORMATION_ECX_AVX_SUPPORT_MASK               0x01
 #define CPUID_FEATURE_INFORMATION_ECX_AVX_SUPPORT(_)                 (((_) >> 28) & 0x01)
+#define CPUID_EAX_01_ECX_AVX_SUPPORT_FEATURE                         220
 
       /**
        * @brief 16-bit floating-point conversion instructions support
@@ -1562,6 +1623,7 @@ typedef struct
 #define CPUID_FEATURE_INFORMATION_ECX_HALF_PRECISION_CONVERSION_INSTRUCTIONS_FLAG 0x20000000
 #define CPUID_FEATURE_INFORMATION_ECX_HALF_PRECISION_CONVERSION_INSTRUCTIONS_MASK 0x01
 #define CPUID_FEATURE_INFORMATION_ECX_HALF_PRECISION_CONVERSION_INSTRUCTIONS(_) (((_) >> 29) & 0x01)
+#define CPUID_EAX_01_ECX_HALF_PRECISION_CONVERSION_INSTRUCTIONS_FEATURE 221
 
       /**
        * @brief RDRAND instruction support
@@ -1573,11 +1635,13 @@ typedef struct
 #define CPUID_FEATURE_INFORMATION_ECX_RDRAND_INSTRUCTION_FLAG        0x40000000
 #define CPUID_FEATURE_INFORMATION_ECX_RDRAND_INSTRUCTION_MASK        0x01
 #define CPUID_FEATURE_INFORMATION_ECX_RDRAND_INSTRUCTION(_)          (((_) >> 30) & 0x01)
+#define CPUID_EAX_01_ECX_RDRAND_INSTRUCTION_FEATURE                  222
       uint32_t reserved2                                             : 1;
     };
 
     uint32_t flags;
   } cpuid_feature_information_ecx;
+#define CPUID_EAX_01_ECX_RESERVED_BITS                               0x80010000
 
   /**
    * @brief When CPUID executes with EAX set to 01H, feature information is returned in ECX and EDX
@@ -1596,6 +1660,7 @@ typedef struct
 #define CPUID_FEATURE_INFORMATION_EDX_FLOATING_POINT_UNIT_ON_CHIP_FLAG 0x01
 #define CPUID_FEATURE_INFORMATION_EDX_FLOATING_POINT_UNIT_ON_CHIP_MASK 0x01
 #define CPUID_FEATURE_INFORMATION_EDX_FLOATING_POINT_UNIT_ON_CHIP(_) (((_) >> 0) & 0x01)
+#define CPUID_EAX_01_EDX_FLOATING_POINT_UNIT_ON_CHIP_FEATURE         224
 
       /**
        * @brief Virtual 8086 Mode Enhancements
@@ -1609,6 +1674,7 @@ typedef struct
 #define CPUID_FEATURE_INFORMATION_EDX_VIRTUAL_8086_MODE_ENHANCEMENTS_FLAG 0x02
 #define CPUID_FEATURE_INFORMATION_EDX_VIRTUAL_8086_MODE_ENHANCEMENTS_MASK 0x01
 #define CPUID_FEATURE_INFORMATION_EDX_VIRTUAL_8086_MODE_ENHANCEMENTS(_) (((_) >> 1) & 0x01)
+#define CPUID_EAX_01_EDX_VIRTUAL_8086_MODE_ENHANCEMENTS_FEATURE      225
 
       /**
        * @brief Debugging Extensions
@@ -1621,6 +1687,7 @@ typedef struct
 #define CPUID_FEATURE_INFORMATION_EDX_DEBUGGING_EXTENSIONS_FLAG      0x04
 #define CPUID_FEATURE_INFORMATION_EDX_DEBUGGING_EXTENSIONS_MASK      0x01
 #define CPUID_FEATURE_INFORMATION_EDX_DEBUGGING_EXTENSIONS(_)        (((_) >> 2) & 0x01)
+#define CPUID_EAX_01_EDX_DEBUGGING_EXTENSIONS_FEATURE                226
 
       /**
        * @brief Page Size Extension
@@ -1633,6 +1700,7 @@ typedef struct
 #define CPUID_FEATURE_INFORMATION_EDX_PAGE_SIZE_EXTENSION_FLAG       0x08
 #define CPUID_FEATURE_INFORMATION_EDX_PAGE_SIZE_EXTENSION_MASK       0x01
 #define CPUID_FEATURE_INFORMATION_EDX_PAGE_SIZE_EXTENSION(_)         (((_) >> 3) & 0x01)
+#define CPUID_EAX_01_EDX_PAGE_SIZE_EXTENSION_FEATURE                 227
 
       /**
        * @brief Time Stamp Counter
@@ -1644,6 +1712,7 @@ typedef struct
 #define CPUID_FEATURE_INFORMATION_EDX_TIMESTAMP_COUNTER_FLAG         0x10
 #define CPUID_FEATURE_INFORMATION_EDX_TIMESTAMP_COUNTER_MASK         0x01
 #define CPUID_FEATURE_INFORMATION_EDX_TIMESTAMP_COUNTER(_)           (((_) >> 4) & 0x01)
+#define CPUID_EAX_01_EDX_TIMESTAMP_COUNTER_FEATURE                   228
 
       /**
        * @brief Model Specific Registers RDMSR and WRMSR Instructions
@@ -1655,6 +1724,7 @@ typedef struct
 #define CPUID_FEATURE_INFORMATION_EDX_RDMSR_WRMSR_INSTRUCTIONS_FLAG  0x20
 #define CPUID_FEATURE_INFORMATION_EDX_RDMSR_WRMSR_INSTRUCTIONS_MASK  0x01
 #define CPUID_FEATURE_INFORMATION_EDX_RDMSR_WRMSR_INSTRUCTIONS(_)    (((_) >> 5) & 0x01)
+#define CPUID_EAX_01_EDX_RDMSR_WRMSR_INSTRUCTIONS_FEATURE            229
 
       /**
        * @brief Physical Address Extension
@@ -1667,6 +1737,7 @@ typedef struct
 #define CPUID_FEATURE_INFORMATION_EDX_PHYSICAL_ADDRESS_EXTENSION_FLAG 0x40
 #define CPUID_FEATURE_INFORMATION_EDX_PHYSICAL_ADDRESS_EXTENSION_MASK 0x01
 #define CPUID_FEATURE_INFORMATION_EDX_PHYSICAL_ADDRESS_EXTENSION(_)  (((_) >> 6) & 0x01)
+#define CPUID_EAX_01_EDX_PHYSICAL_ADDRESS_EXTENSION_FEATURE          230
 
       /**
        * @brief Machine Check Exception
@@ -1681,6 +1752,7 @@ typedef struct
 #define CPUID_FEATURE_INFORMATION_EDX_MACHINE_CHECK_EXCEPTION_FLAG   0x80
 #define CPUID_FEATURE_INFORMATION_EDX_MACHINE_CHECK_EXCEPTION_MASK   0x01
 #define CPUID_FEATURE_INFORMATION_EDX_MACHINE_CHECK_EXCEPTION(_)     (((_) >> 7) & 0x01)
+#define CPUID_EAX_01_EDX_MACHINE_CHECK_EXCEPTION_FEATURE             231
 
       /**
        * @brief CMPXCHG8B Instruction
@@ -1692,6 +1764,7 @@ typedef struct
 #define CPUID_FEATURE_INFORMATION_EDX_CMPXCHG8B_FLAG                 0x100
 #define CPUID_FEATURE_INFORMATION_EDX_CMPXCHG8B_MASK                 0x01
 #define CPUID_FEATURE_INFORMATION_EDX_CMPXCHG8B(_)                   (((_) >> 8) & 0x01)
+#define CPUID_EAX_01_EDX_CMPXCHG8B_FEATURE                           232
 
       /**
        * @brief APIC On-Chip
@@ -1705,6 +1778,7 @@ typedef struct
 #define CPUID_FEATURE_INFORMATION_EDX_APIC_ON_CHIP_FLAG              0x200
 #define CPUID_FEATURE_INFORMATION_EDX_APIC_ON_CHIP_MASK              0x01
 #define CPUID_FEATURE_INFORMATION_EDX_APIC_ON_CHIP(_)                (((_) >> 9) & 0x01)
+#define CPUID_EAX_01_EDX_APIC_ON_CHIP_FEATURE                        233
       uint32_t reserved1                                             : 1;
 
       /**
@@ -1717,6 +1791,7 @@ typedef struct
 #define CPUID_FEATURE_INFORMATION_EDX_SYSENTER_SYSEXIT_INSTRUCTIONS_FLAG 0x800
 #define CPUID_FEATURE_INFORMATION_EDX_SYSENTER_SYSEXIT_INSTRUCTIONS_MASK 0x01
 #define CPUID_FEATURE_INFORMATION_EDX_SYSENTER_SYSEXIT_INSTRUCTIONS(_) (((_) >> 11) & 0x01)
+#define CPUID_EAX_01_EDX_SYSENTER_SYSEXIT_INSTRUCTIONS_FEATURE       235
 
       /**
        * @brief Memory Type Range Registers
@@ -1729,6 +1804,7 @@ typedef struct
 #define CPUID_FEATURE_INFORMATION_EDX_MEMORY_TYPE_RANGE_REGISTERS_FLAG 0x1000
 #define CPUID_FEATURE_INFORMATION_EDX_MEMORY_TYPE_RANGE_REGISTERS_MASK 0x01
 #define CPUID_FEATURE_INFORMATION_EDX_MEMORY_TYPE_RANGE_REGISTERS(_) (((_) >> 12) & 0x01)
+#define CPUID_EAX_01_EDX_MEMORY_TYPE_RANGE_REGISTERS_FEATURE         236
 
       /**
        * @brief Page Global Bit
@@ -1741,6 +1817,7 @@ typedef struct
 #define CPUID_FEATURE_INFORMATION_EDX_PAGE_GLOBAL_BIT_FLAG           0x2000
 #define CPUID_FEATURE_INFORMATION_EDX_PAGE_GLOBAL_BIT_MASK           0x01
 #define CPUID_FEATURE_INFORMATION_EDX_PAGE_GLOBAL_BIT(_)             (((_) >> 13) & 0x01)
+#define CPUID_EAX_01_EDX_PAGE_GLOBAL_BIT_FEATURE                     237
 
       /**
        * @brief Machine Check Architecture
@@ -1753,6 +1830,7 @@ typedef struct
 #define CPUID_FEATURE_INFORMATION_EDX_MACHINE_CHECK_ARCHITECTURE_FLAG 0x4000
 #define CPUID_FEATURE_INFORMATION_EDX_MACHINE_CHECK_ARCHITECTURE_MASK 0x01
 #define CPUID_FEATURE_INFORMATION_EDX_MACHINE_CHECK_ARCHITECTURE(_)  (((_) >> 14) & 0x01)
+#define CPUID_EAX_01_EDX_MACHINE_CHECK_ARCHITECTURE_FEATURE          238
 
       /**
        * @brief Conditional Move Instructions
@@ -1765,6 +1843,7 @@ typedef struct
 #define CPUID_FEATURE_INFORMATION_EDX_CONDITIONAL_MOVE_INSTRUCTIONS_FLAG 0x8000
 #define CPUID_FEATURE_INFORMATION_EDX_CONDITIONAL_MOVE_INSTRUCTIONS_MASK 0x01
 #define CPUID_FEATURE_INFORMATION_EDX_CONDITIONAL_MOVE_INSTRUCTIONS(_) (((_) >> 15) & 0x01)
+#define CPUID_EAX_01_EDX_CONDITIONAL_MOVE_INSTRUCTIONS_FEATURE       239
 
       /**
        * @brief Page Attribute Table
@@ -1777,6 +1856,7 @@ typedef struct
 #define CPUID_FEATURE_INFORMATION_EDX_PAGE_ATTRIBUTE_TABLE_FLAG      0x10000
 #define CPUID_FEATURE_INFORMATION_EDX_PAGE_ATTRIBUTE_TABLE_MASK      0x01
 #define CPUID_FEATURE_INFORMATION_EDX_PAGE_ATTRIBUTE_TABLE(_)        (((_) >> 16) & 0x01)
+#define CPUID_EAX_01_EDX_PAGE_ATTRIBUTE_TABLE_FEATURE                240
 
       /**
        * @brief 36-Bit Page Size Extension
@@ -1790,6 +1870,7 @@ typedef struct
 #define CPUID_FEATURE_INFORMATION_EDX_PAGE_SIZE_EXTENSION_36BIT_FLAG 0x20000
 #define CPUID_FEATURE_INFORMATION_EDX_PAGE_SIZE_EXTENSION_36BIT_MASK 0x01
 #define CPUID_FEATURE_INFORMATION_EDX_PAGE_SIZE_EXTENSION_36BIT(_)   (((_) >> 17) & 0x01)
+#define CPUID_EAX_01_EDX_PAGE_SIZE_EXTENSION_36BIT_FEATURE           241
 
       /**
        * @brief Processor Serial Number
@@ -1801,6 +1882,7 @@ typedef struct
 #define CPUID_FEATURE_INFORMATION_EDX_PROCESSOR_SERIAL_NUMBER_FLAG   0x40000
 #define CPUID_FEATURE_INFORMATION_EDX_PROCESSOR_SERIAL_NUMBER_MASK   0x01
 #define CPUID_FEATURE_INFORMATION_EDX_PROCESSOR_SERIAL_NUMBER(_)     (((_) >> 18) & 0x01)
+#define CPUID_EAX_01_EDX_PROCESSOR_SERIAL_NUMBER_FEATURE             242
 
       /**
        * @brief CLFLUSH Instruction
@@ -1812,6 +1894,7 @@ typedef struct
 #define CPUID_FEATURE_INFORMATION_EDX_CLFLUSH_FLAG                   0x80000
 #define CPUID_FEATURE_INFORMATION_EDX_CLFLUSH_MASK                   0x01
 #define CPUID_FEATURE_INFORMATION_EDX_CLFLUSH(_)                     (((_) >> 19) & 0x01)
+#define CPUID_EAX_01_EDX_CLFLUSH_FEATURE                             243
       uint32_t reserved2                                             : 1;
 
       /**
@@ -1827,6 +1910,7 @@ typedef struct
 #define CPUID_FEATURE_INFORMATION_EDX_DEBUG_STORE_FLAG               0x200000
 #define CPUID_FEATURE_INFORMATION_EDX_DEBUG_STORE_MASK               0x01
 #define CPUID_FEATURE_INFORMATION_EDX_DEBUG_STORE(_)                 (((_) >> 21) & 0x01)
+#define CPUID_EAX_01_EDX_DEBUG_STORE_FEATURE                         245
 
       /**
        * @brief Thermal Monitor and Software Controlled Clock Facilities
@@ -1839,6 +1923,7 @@ typedef struct
 #define CPUID_FEATURE_INFORMATION_EDX_THERMAL_CONTROL_MSRS_FOR_ACPI_FLAG 0x400000
 #define CPUID_FEATURE_INFORMATION_EDX_THERMAL_CONTROL_MSRS_FOR_ACPI_MASK 0x01
 #define CPUID_FEATURE_INFORMATION_EDX_THERMAL_CONTROL_MSRS_FOR_ACPI(_) (((_) >> 22) & 0x01)
+#define CPUID_EAX_01_EDX_THERMAL_CONTROL_MSRS_FOR_ACPI_FEATURE       246
 
       /**
        * @brief Intel MMX Technology
@@ -1850,6 +1935,7 @@ typedef struct
 #define CPUID_FEATURE_INFORMATION_EDX_MMX_SUPPORT_FLAG               0x800000
 #define CPUID_FEATURE_INFORMATION_EDX_MMX_SUPPORT_MASK               0x01
 #define CPUID_FEATURE_INFORMATION_EDX_MMX_SUPPORT(_)                 (((_) >> 23) & 0x01)
+#define CPUID_EAX_01_EDX_MMX_SUPPORT_FEATURE                         247
 
       /**
        * @brief FXSAVE and FXRSTOR Instructions
@@ -1863,6 +1949,7 @@ typedef struct
 #define CPUID_FEATURE_INFORMATION_EDX_FXSAVE_FXRSTOR_INSTRUCTIONS_FLAG 0x1000000
 #define CPUID_FEATURE_INFORMATION_EDX_FXSAVE_FXRSTOR_INSTRUCTIONS_MASK 0x01
 #define CPUID_FEATURE_INFORMATION_EDX_FXSAVE_FXRSTOR_INSTRUCTIONS(_) (((_) >> 24) & 0x01)
+#define CPUID_EAX_01_EDX_FXSAVE_FXRSTOR_INSTRUCTIONS_FEATURE         248
 
       /**
        * @brief SSE extensions support
@@ -1874,6 +1961,7 @@ typedef struct
 #define CPUID_FEATURE_INFORMATION_EDX_SSE_SUPPORT_FLAG               0x2000000
 #define CPUID_FEATURE_INFORMATION_EDX_SSE_SUPPORT_MASK               0x01
 #define CPUID_FEATURE_INFORMATION_EDX_SSE_SUPPORT(_)                 (((_) >> 25) & 0x01)
+#define CPUID_EAX_01_EDX_SSE_SUPPORT_FEATURE                         249
 
       /**
        * @brief SSE2 extensions support
@@ -1885,6 +1973,7 @@ typedef struct
 #define CPUID_FEATURE_INFORMATION_EDX_SSE2_SUPPORT_FLAG              0x4000000
 #define CPUID_FEATURE_INFORMATION_EDX_SSE2_SUPPORT_MASK              0x01
 #define CPUID_FEATURE_INFORMATION_EDX_SSE2_SUPPORT(_)                (((_) >> 26) & 0x01)
+#define CPUID_EAX_01_EDX_SSE2_SUPPORT_FEATURE                        250
 
       /**
        * @brief Self Snoop
@@ -1897,6 +1986,7 @@ typedef struct
 #define CPUID_FEATURE_INFORMATION_EDX_SELF_SNOOP_FLAG                0x8000000
 #define CPUID_FEATURE_INFORMATION_EDX_SELF_SNOOP_MASK                0x01
 #define CPUID_FEATURE_INFORMATION_EDX_SELF_SNOOP(_)                  (((_) >> 27) & 0x01)
+#define CPUID_EAX_01_EDX_SELF_SNOOP_FEATURE                          251
 
       /**
        * @brief Max APIC IDs reserved field is Valid
@@ -1910,6 +2000,7 @@ typedef struct
 #define CPUID_FEATURE_INFORMATION_EDX_HYPER_THREADING_TECHNOLOGY_FLAG 0x10000000
 #define CPUID_FEATURE_INFORMATION_EDX_HYPER_THREADING_TECHNOLOGY_MASK 0x01
 #define CPUID_FEATURE_INFORMATION_EDX_HYPER_THREADING_TECHNOLOGY(_)  (((_) >> 28) & 0x01)
+#define CPUID_EAX_01_EDX_HYPER_THREADING_TECHNOLOGY_FEATURE          252
 
       /**
        * @brief Thermal Monitor
@@ -1921,6 +2012,7 @@ typedef struct
 #define CPUID_FEATURE_INFORMATION_EDX_THERMAL_MONITOR_FLAG           0x20000000
 #define CPUID_FEATURE_INFORMATION_EDX_THERMAL_MONITOR_MASK           0x01
 #define CPUID_FEATURE_INFORMATION_EDX_THERMAL_MONITOR(_)             (((_) >> 29) & 0x01)
+#define CPUID_EAX_01_EDX_THERMAL_MONITOR_FEATURE                     253
       uint32_t reserved3                                             : 1;
 
       /**
@@ -1935,12 +2027,23 @@ typedef struct
 #define CPUID_FEATURE_INFORMATION_EDX_PENDING_BREAK_ENABLE_FLAG      0x80000000
 #define CPUID_FEATURE_INFORMATION_EDX_PENDING_BREAK_ENABLE_MASK      0x01
 #define CPUID_FEATURE_INFORMATION_EDX_PENDING_BREAK_ENABLE(_)        (((_) >> 31) & 0x01)
+#define CPUID_EAX_01_EDX_PENDING_BREAK_ENABLE_FEATURE                255
     };
 
     uint32_t flags;
   } cpuid_feature_information_edx;
+#define CPUID_EAX_01_EDX_RESERVED_BITS                               0x40100400
 
 } cpuid_eax_01;
+#define CPUID_EAX_01_SNAPSHOT_INDEX                                  1
+#define CPUID_EAX_01_EAX_POLICY_AND                                  0x0FFF3FFF
+#define CPUID_EAX_01_EAX_POLICY_OR                                   0x00000000
+#define CPUID_EAX_01_EBX_POLICY_AND                                  0xFFFFFFFF
+#define CPUID_EAX_01_EBX_POLICY_OR                                   0x00000000
+#define CPUID_EAX_01_ECX_POLICY_AND                                  0x7FFE760B
+#define CPUID_EAX_01_ECX_POLICY_OR                                   0x00000000
+#define CPUID_EAX_01_EDX_POLICY_AND                                  0x1F8BFBFF
+#define CPUID_EAX_01_EDX_POLICY_OR                                   0x00000000
 
 
 /**
@@ -1976,37 +2079,37 @@ typedef struct
        * - 4-31 = Reserved.
        */
       uint32_t cache_type_field                                      : 5;
-#define CPUID_EAX_CACHE_TYPE_FIELD_BIT                               0
-#define CPUID_EAX_CACHE_TYPE_FIELD_FLAG                              0x1F
-#define CPUID_EAX_CACHE_TYPE_FIELD_MASK                              0x1F
-#define CPUID_EAX_CACHE_TYPE_FIELD(_)                                (((_) >> 0) & 0x1F)
+#define CPUID_EAX_04_EAX_CACHE_TYPE_FIELD_BIT                        0
+#define CPUID_EAX_04_EAX_CACHE_TYPE_FIELD_FLAG                       0x1F
+#define CPUID_EAX_04_EAX_CACHE_TYPE_FIELD_MASK                       0x1F
+#define CPUID_EAX_04_EAX_CACHE_TYPE_FIELD(_)                         (((_) >> 0) & 0x1F)
 
       /**
        * [Bits 7:5] Cache Level (starts at 1).
        */
       uint32_t cache_level                                           : 3;
-#define CPUID_EAX_CACHE_LEVEL_BIT                                    5
-#define CPUID_EAX_CACHE_LEVEL_FLAG                                   0xE0
-#define CPUID_EAX_CACHE_LEVEL_MASK                                   0x07
-#define CPUID_EAX_CACHE_LEVEL(_)                                     (((_) >> 5) & 0x07)
+#define CPUID_EAX_04_EAX_CACHE_LEVEL_BIT                             5
+#define CPUID_EAX_04_EAX_CACHE_LEVEL_FLAG                            0xE0
+#define CPUID_EAX_04_EAX_CACHE_LEVEL_MASK                            0x07
+#define CPUID_EAX_04_EAX_CACHE_LEVEL(_)                              (((_) >> 5) & 0x07)
 
       /**
        * [Bit 8] Self Initializing cache level (does not need SW initialization).
        */
       uint32_t self_initializing_cache_level                         : 1;
-#define CPUID_EAX_SELF_INITIALIZING_CACHE_LEVEL_BIT                  8
-#define CPUID_EAX_SELF_INITIALIZING_CACHE_LEVEL_FLAG                 0x100
-#define CPUID_EAX_SELF_INITIALIZING_CACHE_LEVEL_MASK                 0x01
-#define CPUID_EAX_SELF_INITIALIZING_CACHE_LEVEL(_)                   (((_) >> 8) & 0x01)
+#define CPUID_EAX_04_EAX_SELF_INITIALIZING_CACHE_LEVEL_BIT           8
+#define CPUID_EAX_04_EAX_SELF_INITIALIZING_CACHE_LEVEL_FLAG          0x100
+#define CPUID_EAX_04_EAX_SELF_INITIALIZING_CACHE_LEVEL_MASK          0x01
+#define CPUID_EAX_04_EAX_SELF_INITIALIZING_CACHE_LEVEL(_)            (((_) >> 8) & 0x01)
 
       /**
        * [Bit 9] Fully Associative cache.
        */
       uint32_t fully_associative_cache                               : 1;
-#define CPUID_EAX_FULLY_ASSOCIATIVE_CACHE_BIT                        9
-#define CPUID_EAX_FULLY_ASSOCIATIVE_CACHE_FLAG                       0x200
-#define CPUID_EAX_FULLY_ASSOCIATIVE_CACHE_MASK                       0x01
-#define CPUID_EAX_FULLY_ASSOCIATIVE_CACHE(_)                         (((_) >> 9) & 0x01)
+#define CPUID_EAX_04_EAX_FULLY_ASSOCIATIVE_CACHE_BIT                 9
+#define CPUID_EAX_04_EAX_FULLY_ASSOCIATIVE_CACHE_FLAG                0x200
+#define CPUID_EAX_04_EAX_FULLY_ASSOCIATIVE_CACHE_MASK                0x01
+#define CPUID_EAX_04_EAX_FULLY_ASSOCIATIVE_CACHE(_)                  (((_) >> 9) & 0x01)
       uint32_t reserved1                                             : 4;
 
       /**
@@ -2017,10 +2120,10 @@ typedef struct
        *       reserved for addressing different logical processors sharing this cache.
        */
       uint32_t max_addressable_ids_for_logical_processors_sharing_this_cache: 12;
-#define CPUID_EAX_MAX_ADDRESSABLE_IDS_FOR_LOGICAL_PROCESSORS_SHARING_THIS_CACHE_BIT 14
-#define CPUID_EAX_MAX_ADDRESSABLE_IDS_FOR_LOGICAL_PROCESSORS_SHARING_THIS_CACHE_FLAG 0x3FFC000
-#define CPUID_EAX_MAX_ADDRESSABLE_IDS_FOR_LOGICAL_PROCESSORS_SHARING_THIS_CACHE_MASK 0xFFF
-#define CPUID_EAX_MAX_ADDRESSABLE_IDS_FOR_LOGICAL_PROCESSORS_SHARING_THIS_CACHE(_) (((_) >> 14) & 0xFFF)
+#define CPUID_EAX_04_EAX_MAX_ADDRESSABLE_IDS_FOR_LOGICAL_PROCESSORS_SHARING_THIS_CACHE_BIT 14
+#define CPUID_EAX_04_EAX_MAX_ADDRESSABLE_IDS_FOR_LOGICAL_PROCESSORS_SHARING_THIS_CACHE_FLAG 0x3FFC000
+#define CPUID_EAX_04_EAX_MAX_ADDRESSABLE_IDS_FOR_LOGICAL_PROCESSORS_SHARING_THIS_CACHE_MASK 0xFFF
+#define CPUID_EAX_04_EAX_MAX_ADDRESSABLE_IDS_FOR_LOGICAL_PROCESSORS_SHARING_THIS_CACHE(_) (((_) >> 14) & 0xFFF)
 
       /**
        * [Bits 31:26] Maximum number of addressable IDs for processor cores in the physical package.
@@ -2031,14 +2134,15 @@ typedef struct
        *       The returned value is constant for valid initial values in ECX. Valid ECX values start from 0.
        */
       uint32_t max_addressable_ids_for_processor_cores_in_physical_package: 6;
-#define CPUID_EAX_MAX_ADDRESSABLE_IDS_FOR_PROCESSOR_CORES_IN_PHYSICAL_PACKAGE_BIT 26
-#define CPUID_EAX_MAX_ADDRESSABLE_IDS_FOR_PROCESSOR_CORES_IN_PHYSICAL_PACKAGE_FLAG 0xFC000000
-#define CPUID_EAX_MAX_ADDRESSABLE_IDS_FOR_PROCESSOR_CORES_IN_PHYSICAL_PACKAGE_MASK 0x3F
-#define CPUID_EAX_MAX_ADDRESSABLE_IDS_FOR_PROCESSOR_CORES_IN_PHYSICAL_PACKAGE(_) (((_) >> 26) & 0x3F)
+#define CPUID_EAX_04_EAX_MAX_ADDRESSABLE_IDS_FOR_PROCESSOR_CORES_IN_PHYSICAL_PACKAGE_BIT 26
+#define CPUID_EAX_04_EAX_MAX_ADDRESSABLE_IDS_FOR_PROCESSOR_CORES_IN_PHYSICAL_PACKAGE_FLAG 0xFC000000
+#define CPUID_EAX_04_EAX_MAX_ADDRESSABLE_IDS_FOR_PROCESSOR_CORES_IN_PHYSICAL_PACKAGE_MASK 0x3F
+#define CPUID_EAX_04_EAX_MAX_ADDRESSABLE_IDS_FOR_PROCESSOR_CORES_IN_PHYSICAL_PACKAGE(_) (((_) >> 26) & 0x3F)
     };
 
     uint32_t flags;
   } eax;
+#define CPUID_EAX_04_EAX_RESERVED_BITS                               0x3C00
 
   union
   {
@@ -2050,10 +2154,10 @@ typedef struct
        * @note Add one to the return value to get the result.
        */
       uint32_t system_coherency_line_size                            : 12;
-#define CPUID_EBX_SYSTEM_COHERENCY_LINE_SIZE_BIT                     0
-#define CPUID_EBX_SYSTEM_COHERENCY_LINE_SIZE_FLAG                    0xFFF
-#define CPUID_EBX_SYSTEM_COHERENCY_LINE_SIZE_MASK                    0xFFF
-#define CPUID_EBX_SYSTEM_COHERENCY_LINE_SIZE(_)                      (((_) >> 0) & 0xFFF)
+#define CPUID_EAX_04_EBX_SYSTEM_COHERENCY_LINE_SIZE_BIT              0
+#define CPUID_EAX_04_EBX_SYSTEM_COHERENCY_LINE_SIZE_FLAG             0xFFF
+#define CPUID_EAX_04_EBX_SYSTEM_COHERENCY_LINE_SIZE_MASK             0xFFF
+#define CPUID_EAX_04_EBX_SYSTEM_COHERENCY_LINE_SIZE(_)               (((_) >> 0) & 0xFFF)
 
       /**
        * [Bits 21:12] Physical Line partitions.
@@ -2061,10 +2165,10 @@ typedef struct
        * @note Add one to the return value to get the result.
        */
       uint32_t physical_line_partitions                              : 10;
-#define CPUID_EBX_PHYSICAL_LINE_PARTITIONS_BIT                       12
-#define CPUID_EBX_PHYSICAL_LINE_PARTITIONS_FLAG                      0x3FF000
-#define CPUID_EBX_PHYSICAL_LINE_PARTITIONS_MASK                      0x3FF
-#define CPUID_EBX_PHYSICAL_LINE_PARTITIONS(_)                        (((_) >> 12) & 0x3FF)
+#define CPUID_EAX_04_EBX_PHYSICAL_LINE_PARTITIONS_BIT                12
+#define CPUID_EAX_04_EBX_PHYSICAL_LINE_PARTITIONS_FLAG               0x3FF000
+#define CPUID_EAX_04_EBX_PHYSICAL_LINE_PARTITIONS_MASK               0x3FF
+#define CPUID_EAX_04_EBX_PHYSICAL_LINE_PARTITIONS(_)                 (((_) >> 12) & 0x3FF)
 
       /**
        * [Bits 31:22] Ways of associativity.
@@ -2072,14 +2176,15 @@ typedef struct
        * @note Add one to the return value to get the result.
        */
       uint32_t ways_of_associativity                                 : 10;
-#define CPUID_EBX_WAYS_OF_ASSOCIATIVITY_BIT                          22
-#define CPUID_EBX_WAYS_OF_ASSOCIATIVITY_FLAG                         0xFFC00000
-#define CPUID_EBX_WAYS_OF_ASSOCIATIVITY_MASK                         0x3FF
-#define CPUID_EBX_WAYS_OF_ASSOCIATIVITY(_)                           (((_) >> 22) & 0x3FF)
+#define CPUID_EAX_04_EBX_WAYS_OF_ASSOCIATIVITY_BIT                   22
+#define CPUID_EAX_04_EBX_WAYS_OF_ASSOCIATIVITY_FLAG                  0xFFC00000
+#define CPUID_EAX_04_EBX_WAYS_OF_ASSOCIATIVITY_MASK                  0x3FF
+#define CPUID_EAX_04_EBX_WAYS_OF_ASSOCIATIVITY(_)                    (((_) >> 22) & 0x3FF)
     };
 
     uint32_t flags;
   } ebx;
+#define CPUID_EAX_04_EBX_RESERVED_BITS                               0x00
 
   union
   {
@@ -2091,14 +2196,15 @@ typedef struct
        * @note Add one to the return value to get the result.
        */
       uint32_t number_of_sets                                        : 32;
-#define CPUID_ECX_NUMBER_OF_SETS_BIT                                 0
-#define CPUID_ECX_NUMBER_OF_SETS_FLAG                                0xFFFFFFFF
-#define CPUID_ECX_NUMBER_OF_SETS_MASK                                0xFFFFFFFF
-#define CPUID_ECX_NUMBER_OF_SETS(_)                                  (((_) >> 0) & 0xFFFFFFFF)
+#define CPUID_EAX_04_ECX_NUMBER_OF_SETS_BIT                          0
+#define CPUID_EAX_04_ECX_NUMBER_OF_SETS_FLAG                         0xFFFFFFFF
+#define CPUID_EAX_04_ECX_NUMBER_OF_SETS_MASK                         0xFFFFFFFF
+#define CPUID_EAX_04_ECX_NUMBER_OF_SETS(_)                           (((_) >> 0) & 0xFFFFFFFF)
     };
 
     uint32_t flags;
   } ecx;
+#define CPUID_EAX_04_ECX_RESERVED_BITS                               0x00
 
   union
   {
@@ -2111,10 +2217,10 @@ typedef struct
        * - 1 = WBINVD/INVD is not guaranteed to act upon lower level caches of non-originating threads sharing this cache.
        */
       uint32_t write_back_invalidate                                 : 1;
-#define CPUID_EDX_WRITE_BACK_INVALIDATE_BIT                          0
-#define CPUID_EDX_WRITE_BACK_INVALIDATE_FLAG                         0x01
-#define CPUID_EDX_WRITE_BACK_INVALIDATE_MASK                         0x01
-#define CPUID_EDX_WRITE_BACK_INVALIDATE(_)                           (((_) >> 0) & 0x01)
+#define CPUID_EAX_04_EDX_WRITE_BACK_INVALIDATE_BIT                   0
+#define CPUID_EAX_04_EDX_WRITE_BACK_INVALIDATE_FLAG                  0x01
+#define CPUID_EAX_04_EDX_WRITE_BACK_INVALIDATE_MASK                  0x01
+#define CPUID_EAX_04_EDX_WRITE_BACK_INVALIDATE(_)                    (((_) >> 0) & 0x01)
 
       /**
        * @brief Cache Inclusiveness
@@ -2123,10 +2229,10 @@ typedef struct
        * - 1 = Cache is inclusive of lower cache levels.
        */
       uint32_t cache_inclusiveness                                   : 1;
-#define CPUID_EDX_CACHE_INCLUSIVENESS_BIT                            1
-#define CPUID_EDX_CACHE_INCLUSIVENESS_FLAG                           0x02
-#define CPUID_EDX_CACHE_INCLUSIVENESS_MASK                           0x01
-#define CPUID_EDX_CACHE_INCLUSIVENESS(_)                             (((_) >> 1) & 0x01)
+#define CPUID_EAX_04_EDX_CACHE_INCLUSIVENESS_BIT                     1
+#define CPUID_EAX_04_EDX_CACHE_INCLUSIVENESS_FLAG                    0x02
+#define CPUID_EAX_04_EDX_CACHE_INCLUSIVENESS_MASK                    0x01
+#define CPUID_EAX_04_EDX_CACHE_INCLUSIVENESS(_)                      (((_) >> 1) & 0x01)
 
       /**
        * @brief Complex Cache Indexing
@@ -2135,15 +2241,16 @@ typedef struct
        * - 1 = A complex function is used to index the cache, potentially using all address bits.
        */
       uint32_t complex_cache_indexing                                : 1;
-#define CPUID_EDX_COMPLEX_CACHE_INDEXING_BIT                         2
-#define CPUID_EDX_COMPLEX_CACHE_INDEXING_FLAG                        0x04
-#define CPUID_EDX_COMPLEX_CACHE_INDEXING_MASK                        0x01
-#define CPUID_EDX_COMPLEX_CACHE_INDEXING(_)                          (((_) >> 2) & 0x01)
+#define CPUID_EAX_04_EDX_COMPLEX_CACHE_INDEXING_BIT                  2
+#define CPUID_EAX_04_EDX_COMPLEX_CACHE_INDEXING_FLAG                 0x04
+#define CPUID_EAX_04_EDX_COMPLEX_CACHE_INDEXING_MASK                 0x01
+#define CPUID_EAX_04_EDX_COMPLEX_CACHE_INDEXING(_)                   (((_) >> 2) & 0x01)
       uint32_t reserved1                                             : 29;
     };
 
     uint32_t flags;
   } edx;
+#define CPUID_EAX_04_EDX_RESERVED_BITS                               0xFFFFFFF8
 
 } cpuid_eax_04;
 
@@ -2166,15 +2273,16 @@ typedef struct
        * [Bits 15:0] Smallest monitor-line size in bytes (default is processor's monitor granularity).
        */
       uint32_t smallest_monitor_line_size                            : 16;
-#define CPUID_EAX_SMALLEST_MONITOR_LINE_SIZE_BIT                     0
-#define CPUID_EAX_SMALLEST_MONITOR_LINE_SIZE_FLAG                    0xFFFF
-#define CPUID_EAX_SMALLEST_MONITOR_LINE_SIZE_MASK                    0xFFFF
-#define CPUID_EAX_SMALLEST_MONITOR_LINE_SIZE(_)                      (((_) >> 0) & 0xFFFF)
+#define CPUID_EAX_05_EAX_SMALLEST_MONITOR_LINE_SIZE_BIT              0
+#define CPUID_EAX_05_EAX_SMALLEST_MONITOR_LINE_SIZE_FLAG             0xFFFF
+#define CPUID_EAX_05_EAX_SMALLEST_MONITOR_LINE_SIZE_MASK             0xFFFF
+#define CPUID_EAX_05_EAX_SMALLEST_MONITOR_LINE_SIZE(_)               (((_) >> 0) & 0xFFFF)
       uint32_t reserved1                                             : 16;
     };
 
     uint32_t flags;
   } eax;
+#define CPUID_EAX_05_EAX_RESERVED_BITS                               0xFFFF0000
 
   union
   {
@@ -2184,15 +2292,16 @@ typedef struct
        * [Bits 15:0] Largest monitor-line size in bytes (default is processor's monitor granularity).
        */
       uint32_t largest_monitor_line_size                             : 16;
-#define CPUID_EBX_LARGEST_MONITOR_LINE_SIZE_BIT                      0
-#define CPUID_EBX_LARGEST_MONITOR_LINE_SIZE_FLAG                     0xFFFF
-#define CPUID_EBX_LARGEST_MONITOR_LINE_SIZE_MASK                     0xFFFF
-#define CPUID_EBX_LARGEST_MONITOR_LINE_SIZE(_)                       (((_) >> 0) & 0xFFFF)
+#define CPUID_EAX_05_EBX_LARGEST_MONITOR_LINE_SIZE_BIT               0
+#define CPUID_EAX_05_EBX_LARGEST_MONITOR_LINE_SIZE_FLAG              0xFFFF
+#define CPUID_EAX_05_EBX_LARGEST_MONITOR_LINE_SIZE_MASK              0xFFFF
+#define CPUID_EAX_05_EBX_LARGEST_MONITOR_LINE_SIZE(_)                (((_) >> 0) & 0xFFFF)
       uint32_t reserved1                                             : 16;
     };
 
     uint32_t flags;
   } ebx;
+#define CPUID_EAX_05_EBX_RESERVED_BITS                               0xFFFF0000
 
   union
   {
@@ -2202,24 +2311,27 @@ typedef struct
        * [Bit 0] Enumeration of Monitor-Mwait extensions (beyond EAX and EBX registers) supported.
        */
       uint32_t enumeration_of_monitor_mwait_extensions               : 1;
-#define CPUID_ECX_ENUMERATION_OF_MONITOR_MWAIT_EXTENSIONS_BIT        0
-#define CPUID_ECX_ENUMERATION_OF_MONITOR_MWAIT_EXTENSIONS_FLAG       0x01
-#define CPUID_ECX_ENUMERATION_OF_MONITOR_MWAIT_EXTENSIONS_MASK       0x01
-#define CPUID_ECX_ENUMERATION_OF_MONITOR_MWAIT_EXTENSIONS(_)         (((_) >> 0) & 0x01)
+#define CPUID_EAX_05_ECX_ENUMERATION_OF_MONITOR_MWAIT_EXTENSIONS_BIT 0
+#define CPUID_EAX_05_ECX_ENUMERATION_OF_MONITOR_MWAIT_EXTENSIONS_FLAG 0x01
+#define CPUID_EAX_05_ECX_ENUMERATION_OF_MONITOR_MWAIT_EXTENSIONS_MASK 0x01
+#define CPUID_EAX_05_ECX_ENUMERATION_OF_MONITOR_MWAIT_EXTENSIONS(_)  (((_) >> 0) & 0x01)
+#define CPUID_EAX_05_ECX_ENUMERATION_OF_MONITOR_MWAIT_EXTENSIONS_FEATURE 320
 
       /**
        * [Bit 1] Supports treating interrupts as break-event for MWAIT, even when interrupts disabled.
        */
       uint32_t supports_treating_interrupts_as_break_event_for_mwait : 1;
-#define CPUID_ECX_SUPPORTS_TREATING_INTERRUPTS_AS_BREAK_EVENT_FOR_MWAIT_BIT 1
-#define CPUID_ECX_SUPPORTS_TREATING_INTERRUPTS_AS_BREAK_EVENT_FOR_MWAIT_FLAG 0x02
-#define CPUID_ECX_SUPPORTS_TREATING_INTERRUPTS_AS_BREAK_EVENT_FOR_MWAIT_MASK 0x01
-#define CPUID_ECX_SUPPORTS_TREATING_INTERRUPTS_AS_BREAK_EVENT_FOR_MWAIT(_) (((_) >> 1) & 0x01)
+#define CPUID_EAX_05_ECX_SUPPORTS_TREATING_INTERRUPTS_AS_BREAK_EVENT_FOR_MWAIT_BIT 1
+#define CPUID_EAX_05_ECX_SUPPORTS_TREATING_INTERRUPTS_AS_BREAK_EVENT_FOR_MWAIT_FLAG 0x02
+#define CPUID_EAX_05_ECX_SUPPORTS_TREATING_INTERRUPTS_AS_BREAK_EVENT_FOR_MWAIT_MASK 0x01
+#define CPUID_EAX_05_ECX_SUPPORTS_TREATING_INTERRUPTS_AS_BREAK_EVENT_FOR_MWAIT(_) (((_) >> 1) & 0x01)
+#define CPUID_EAX_05_ECX_SUPPORTS_TREATING_INTERRUPTS_AS_BREAK_EVENT_FOR_MWAIT_FEATURE 321
       uint32_t reserved1                                             : 30;
     };
 
     uint32_t flags;
   } ecx;
+#define CPUID_EAX_05_ECX_RESERVED_BITS                               0xFFFFFFFC
 
   union
   {
@@ -2229,79 +2341,89 @@ typedef struct
        * [Bits 3:0] Number of C0 sub C-states supported using MWAIT.
        */
       uint32_t number_of_c0_sub_c_states                             : 4;
-#define CPUID_EDX_NUMBER_OF_C0_SUB_C_STATES_BIT                      0
-#define CPUID_EDX_NUMBER_OF_C0_SUB_C_STATES_FLAG                     0x0F
-#define CPUID_EDX_NUMBER_OF_C0_SUB_C_STATES_MASK                     0x0F
-#define CPUID_EDX_NUMBER_OF_C0_SUB_C_STATES(_)                       (((_) >> 0) & 0x0F)
+#define CPUID_EAX_05_EDX_NUMBER_OF_C0_SUB_C_STATES_BIT               0
+#define CPUID_EAX_05_EDX_NUMBER_OF_C0_SUB_C_STATES_FLAG              0x0F
+#define CPUID_EAX_05_EDX_NUMBER_OF_C0_SUB_C_STATES_MASK              0x0F
+#define CPUID_EAX_05_EDX_NUMBER_OF_C0_SUB_C_STATES(_)                (((_) >> 0) & 0x0F)
 
       /**
        * [Bits 7:4] Number of C1 sub C-states supported using MWAIT.
        */
       uint32_t number_of_c1_sub_c_states                             : 4;
-#define CPUID_EDX_NUMBER_OF_C1_SUB_C_STATES_BIT                      4
-#define CPUID_EDX_NUMBER_OF_C1_SUB_C_STATES_FLAG                     0xF0
-#define CPUID_EDX_NUMBER_OF_C1_SUB_C_STATES_MASK                     0x0F
-#define CPUID_EDX_NUMBER_OF_C1_SUB_C_STATES(_)                       (((_) >> 4) & 0x0F)
+#define CPUID_EAX_05_EDX_NUMBER_OF_C1_SUB_C_STATES_BIT               4
+#define CPUID_EAX_05_EDX_NUMBER_OF_C1_SUB_C_STATES_FLAG              0xF0
+#define CPUID_EAX_05_EDX_NUMBER_OF_C1_SUB_C_STATES_MASK              0x0F
+#define CPUID_EAX_05_EDX_NUMBER_OF_C1_SUB_C_STATES(_)                (((_) >> 4) & 0x0F)
 
       /**
        * [Bits 11:8] Number of C2 sub C-states supported using MWAIT.
        */
       uint32_t number_of_c2_sub_c_states                             : 4;
-#define CPUID_EDX_NUMBER_OF_C2_SUB_C_STATES_BIT                      8
-#define CPUID_EDX_NUMBER_OF_C2_SUB_C_STATES_FLAG                     0xF00
-#define CPUID_EDX_NUMBER_OF_C2_SUB_C_STATES_MASK                     0x0F
-#define CPUID_EDX_NUMBER_OF_C2_SUB_C_STATES(_)                       (((_) >> 8) & 0x0F)
+#define CPUID_EAX_05_EDX_NUMBER_OF_C2_SUB_C_STATES_BIT               8
+#define CPUID_EAX_05_EDX_NUMBER_OF_C2_SUB_C_STATES_FLAG              0xF00
+#define CPUID_EAX_05_EDX_NUMBER_OF_C2_SUB_C_STATES_MASK              0x0F
+#define CPUID_EAX_05_EDX_NUMBER_OF_C2_SUB_C_STATES(_)                (((_) >> 8) & 0x0F)
 
       /**
        * [Bits 15:12] Number of C3 sub C-states supported using MWAIT.
        */
       uint32_t number_of_c3_sub_c_states                             : 4;
-#define CPUID_EDX_NUMBER_OF_C3_SUB_C_STATES_BIT                      12
-#define CPUID_EDX_NUMBER_OF_C3_SUB_C_STATES_FLAG                     0xF000
-#define CPUID_EDX_NUMBER_OF_C3_SUB_C_STATES_MASK                     0x0F
-#define CPUID_EDX_NUMBER_OF_C3_SUB_C_STATES(_)                       (((_) >> 12) & 0x0F)
+#define CPUID_EAX_05_EDX_NUMBER_OF_C3_SUB_C_STATES_BIT               12
+#define CPUID_EAX_05_EDX_NUMBER_OF_C3_SUB_C_STATES_FLAG              0xF000
+#define CPUID_EAX_05_EDX_NUMBER_OF_C3_SUB_C_STATES_MASK              0x0F
+#define CPUID_EAX_05_EDX_NUMBER_OF_C3_SUB_C_STATES(_)                (((_) >> 12) & 0x0F)
 
       /**
        * [Bits 19:16] Number of C4 sub C-states supported using MWAIT.
        */
       uint32_t number_of_c4_sub_c_states                             : 4;
-#define CPUID_EDX_NUMBER_OF_C4_SUB_C_STATES_BIT                      16
-#define CPUID_EDX_NUMBER_OF_C4_SUB_C_STATES_FLAG                     0xF0000
-#define CPUID_EDX_NUMBER_OF_C4_SUB_C_STATES_MASK                     0x0F
-#define CPUID_EDX_NUMBER_OF_C4_SUB_C_STATES(_)                       (((_) >> 16) & 0x0F)
+#define CPUID_EAX_05_EDX_NUMBER_OF_C4_SUB_C_STATES_BIT               16
+#define CPUID_EAX_05_EDX_NUMBER_OF_C4_SUB_C_STATES_FLAG              0xF0000
+#define CPUID_EAX_05_EDX_NUMBER_OF_C4_SUB_C_STATES_MASK              0x0F
+#define CPUID_EAX_05_EDX_NUMBER_OF_C4_SUB_C_STATES(_)                (((_) >> 16) & 0x0F)
 
       /**
        * [Bits 23:20] Number of C5 sub C-states supported using MWAIT.
        */
       uint32_t number_of_c5_sub_c_states                             : 4;
-#define CPUID_EDX_NUMBER_OF_C5_SUB_C_STATES_BIT                      20
-#define CPUID_EDX_NUMBER_OF_C5_SUB_C_STATES_FLAG                     0xF00000
-#define CPUID_EDX_NUMBER_OF_C5_SUB_C_STATES_MASK                     0x0F
-#define CPUID_EDX_NUMBER_OF_C5_SUB_C_STATES(_)                       (((_) >> 20) & 0x0F)
+#define CPUID_EAX_05_EDX_NUMBER_OF_C5_SUB_C_STATES_BIT               20
+#define CPUID_EAX_05_EDX_NUMBER_OF_C5_SUB_C_STATES_FLAG              0xF00000
+#define CPUID_EAX_05_EDX_NUMBER_OF_C5_SUB_C_STATES_MASK              0x0F
+#define CPUID_EAX_05_EDX_NUMBER_OF_C5_SUB_C_STATES(_)                (((_) >> 20) & 0x0F)
 
       /**
        * [Bits 27:24] Number of C6 sub C-states supported using MWAIT.
        */
       uint32_t number_of_c6_sub_c_states                             : 4;
-#define CPUID_EDX_NUMBER_OF_C6_SUB_C_STATES_BIT                      24
-#define CPUID_EDX_NUMBER_OF_C6_SUB_C_STATES_FLAG                     0xF000000
-#define CPUID_EDX_NUMBER_OF_C6_SUB_C_STATES_MASK                     0x0F
-#define CPUID_EDX_NUMBER_OF_C6_SUB_C_STATES(_)                       (((_) >> 24) & 0x0F)
+#define CPUID_EAX_05_EDX_NUMBER_OF_C6_SUB_C_STATES_BIT               24
+#define CPUID_EAX_05_EDX_NUMBER_OF_C6_SUB_C_STATES_FLAG              0xF000000
+#define CPUID_EAX_05_EDX_NUMBER_OF_C6_SUB_C_STATES_MASK              0x0F
+#define CPUID_EAX_05_EDX_NUMBER_OF_C6_SUB_C_STATES(_)                (((_) >> 24) & 0x0F)
 
       /**
        * [Bits 31:28] Number of C7 sub C-states supported using MWAIT.
        */
       uint32_t number_of_c7_sub_c_states                             : 4;
-#define CPUID_EDX_NUMBER_OF_C7_SUB_C_STATES_BIT                      28
-#define CPUID_EDX_NUMBER_OF_C7_SUB_C_STATES_FLAG                     0xF0000000
-#define CPUID_EDX_NUMBER_OF_C7_SUB_C_STATES_MASK                     0x0F
-#define CPUID_EDX_NUMBER_OF_C7_SUB_C_STATES(_)                       (((_) >> 28) & 0x0F)
+#define CPUID_EAX_05_EDX_NUMBER_OF_C7_SUB_C_STATES_BIT               28
+#define CPUID_EAX_05_EDX_NUMBER_OF_C7_SUB_C_STATES_FLAG              0xF0000000
+#define CPUID_EAX_05_EDX_NUMBER_OF_C7_SUB_C_STATES_MASK              0x0F
+#define CPUID_EAX_05_EDX_NUMBER_OF_C7_SUB_C_STATES(_)                (((_) >> 28) & 0x0F)
     };
 
     uint32_t flags;
   } edx;
+#define CPUID_EAX_05_EDX_RESERVED_BITS                               0x00
 
 } cpuid_eax_05;
+#define CPUID_EAX_05_SNAPSHOT_INDEX                                  2
+#define CPUID_EAX_05_EAX_POLICY_AND                                  0x0000FFFF
+#define CPUID_EAX_05_EAX_POLICY_OR                                   0x00000000
+#define CPUID_EAX_05_EBX_POLICY_AND                                  0x0000FFFF
+#define CPUID_EAX_05_EBX_POLICY_OR                                   0x00000000
+#define CPUID_EAX_05_ECX_POLICY_AND                                  0x00000003
+#define CPUID_EAX_05_ECX_POLICY_OR                                   0x00000000
+#define CPUID_EAX_05_EDX_POLICY_AND                                  0xFFFFFFFF
+#define CPUID_EAX_05_EDX_POLICY_OR                                   0x00000000
 
 
 /**
@@ -2320,167 +2442,185 @@ typedef struct
        * [Bit 0] Digital temperature sensor is supported if set.
        */
       uint32_t temperature_sensor_supported                          : 1;
-#define CPUID_EAX_TEMPERATURE_SENSOR_SUPPORTED_BIT                   0
-#define CPUID_EAX_TEMPERATURE_SENSOR_SUPPORTED_FLAG                  0x01
-#define CPUID_EAX_TEMPERATURE_SENSOR_SUPPORTED_MASK                  0x01
-#define CPUID_EAX_TEMPERATURE_SENSOR_SUPPORTED(_)                    (((_) >> 0) & 0x01)
+#define CPUID_EAX_06_EAX_TEMPERATURE_SENSOR_SUPPORTED_BIT            0
+#define CPUID_EAX_06_EAX_TEMPERATURE_SENSOR_SUPPORTED_FLAG           0x01
+#define CPUID_EAX_06_EAX_TEMPERATURE_SENSOR_SUPPORTED_MASK           0x01
+#define CPUID_EAX_06_EAX_TEMPERATURE_SENSOR_SUPPORTED(_)             (((_) >> 0) & 0x01)
+#define CPUID_EAX_06_EAX_TEMPERATURE_SENSOR_SUPPORTED_FEATURE        384
 
       /**
        * [Bit 1] Intel Turbo Boost Technology available (see description of IA32_MISC_ENABLE[38]).
        */
       uint32_t intel_turbo_boost_technology_available                : 1;
-#define CPUID_EAX_INTEL_TURBO_BOOST_TECHNOLOGY_AVAILABLE_BIT         1
-#define CPUID_EAX_INTEL_TURBO_BOOST_TECHNOLOGY_AVAILABLE_FLAG        0x02
-#define CPUID_EAX_INTEL_TURBO_BOOST_TECHNOLOGY_AVAILABLE_MASK        0x01
-#define CPUID_EAX_INTEL_TURBO_BOOST_TECHNOLOGY_AVAILABLE(_)          (((_) >> 1) & 0x01)
+#define CPUID_EAX_06_EAX_INTEL_TURBO_BOOST_TECHNOLOGY_AVAILABLE_BIT  1
+#define CPUID_EAX_06_EAX_INTEL_TURBO_BOOST_TECHNOLOGY_AVAILABLE_FLAG 0x02
+#define CPUID_EAX_06_EAX_INTEL_TURBO_BOOST_TECHNOLOGY_AVAILABLE_MASK 0x01
+#define CPUID_EAX_06_EAX_INTEL_TURBO_BOOST_TECHNOLOGY_AVAILABLE(_)   (((_) >> 1) & 0x01)
+#define CPUID_EAX_06_EAX_INTEL_TURBO_BOOST_TECHNOLOGY_AVAILABLE_FEATURE 385
 
       /**
        * [Bit 2] ARAT. APIC-Timer-always-running feature is supported if set.
        */
       uint32_t apic_timer_always_running                             : 1;
-#define CPUID_EAX_APIC_TIMER_ALWAYS_RUNNING_BIT                      2
-#define CPUID_EAX_APIC_TIMER_ALWAYS_RUNNING_FLAG                     0x04
-#define CPUID_EAX_APIC_TIMER_ALWAYS_RUNNING_MASK                     0x01
-#define CPUID_EAX_APIC_TIMER_ALWAYS_RUNNING(_)                       (((_) >> 2) & 0x01)
+#define CPUID_EAX_06_EAX_APIC_TIMER_ALWAYS_RUNNING_BIT               2
+#define CPUID_EAX_06_EAX_APIC_TIMER_ALWAYS_RUNNING_FLAG              0x04
+#define CPUID_EAX_06_EAX_APIC_TIMER_ALWAYS_RUNNING_MASK              0x01
+#define CPUID_EAX_06_EAX_APIC_TIMER_ALWAYS_RUNNING(_)                (((_) >> 2) & 0x01)
+#define CPUID_EAX_06_EAX_APIC_TIMER_ALWAYS_RUNNING_FEATURE           386
       uint32_t reserved1                                             : 1;
 
       /**
        * [Bit 4] PLN. Power limit notification controls are supported if set.
        */
       uint32_t power_limit_notification                              : 1;
-#define CPUID_EAX_POWER_LIMIT_NOTIFICATION_BIT                       4
-#define CPUID_EAX_POWER_LIMIT_NOTIFICATION_FLAG                      0x10
-#define CPUID_EAX_POWER_LIMIT_NOTIFICATION_MASK                      0x01
-#define CPUID_EAX_POWER_LIMIT_NOTIFICATION(_)                        (((_) >> 4) & 0x01)
+#define CPUID_EAX_06_EAX_POWER_LIMIT_NOTIFICATION_BIT                4
+#define CPUID_EAX_06_EAX_POWER_LIMIT_NOTIFICATION_FLAG               0x10
+#define CPUID_EAX_06_EAX_POWER_LIMIT_NOTIFICATION_MASK               0x01
+#define CPUID_EAX_06_EAX_POWER_LIMIT_NOTIFICATION(_)                 (((_) >> 4) & 0x01)
+#define CPUID_EAX_06_EAX_POWER_LIMIT_NOTIFICATION_FEATURE            388
 
       /**
        * [Bit 5] ECMD. Clock modulation duty cycle extension is supported if set.
        */
       uint32_t clock_modulation_duty                                 : 1;
-#define CPUID_EAX_CLOCK_MODULATION_DUTY_BIT                          5
-#define CPUID_EAX_CLOCK_MODULATION_DUTY_FLAG                         0x20
-#define CPUID_EAX_CLOCK_MODULATION_DUTY_MASK                         0x01
-#define CPUID_EAX_CLOCK_MODULATION_DUTY(_)                           (((_) >> 5) & 0x01)
+#define CPUID_EAX_06_EAX_CLOCK_MODULATION_DUTY_BIT                   5
+#define CPUID_EAX_06_EAX_CLOCK_MODULATION_DUTY_FLAG                  0x20
+#define CPUID_EAX_06_EAX_CLOCK_MODULATION_DUTY_MASK                  0x01
+#define CPUID_EAX_06_EAX_CLOCK_MODULATION_DUTY(_)                    (((_) >> 5) & 0x01)
+#define CPUID_EAX_06_EAX_CLOCK_MODULATION_DUTY_FEATURE               389
 
       /**
        * [Bit 6] PTM. Package thermal management is supported if set.
        */
       uint32_t package_thermal_management                            : 1;
-#define CPUID_EAX_PACKAGE_THERMAL_MANAGEMENT_BIT                     6
-#define CPUID_EAX_PACKAGE_THERMAL_MANAGEMENT_FLAG                    0x40
-#define CPUID_EAX_PACKAGE_THERMAL_MANAGEMENT_MASK                    0x01
-#define CPUID_EAX_PACKAGE_THERMAL_MANAGEMENT(_)                      (((_) >> 6) & 0x01)
+#define CPUID_EAX_06_EAX_PACKAGE_THERMAL_MANAGEMENT_BIT              6
+#define CPUID_EAX_06_EAX_PACKAGE_THERMAL_MANAGEMENT_FLAG             0x40
+#define CPUID_EAX_06_EAX_PACKAGE_THERMAL_MANAGEMENT_MASK             0x01
+#define CPUID_EAX_06_EAX_PACKAGE_THERMAL_MANAGEMENT(_)               (((_) >> 6) & 0x01)
+#define CPUID_EAX_06_EAX_PACKAGE_THERMAL_MANAGEMENT_FEATURE          390
 
       /**
        * [Bit 7] HWP. HWP base registers (IA32_PM_ENABLE[bit 0], IA32_HWP_CAPABILITIES, IA32_HWP_REQUEST, IA32_HWP_STATUS) are
        * supported if set.
        */
       uint32_t hwp_base_registers                                    : 1;
-#define CPUID_EAX_HWP_BASE_REGISTERS_BIT                             7
-#define CPUID_EAX_HWP_BASE_REGISTERS_FLAG                            0x80
-#define CPUID_EAX_HWP_BASE_REGISTERS_MASK                            0x01
-#define CPUID_EAX_HWP_BASE_REGISTERS(_)                              (((_) >> 7) & 0x01)
+#define CPUID_EAX_06_EAX_HWP_BASE_REGISTERS_BIT                      7
+#define CPUID_EAX_06_EAX_HWP_BASE_REGISTERS_FLAG                     0x80
+#define CPUID_EAX_06_EAX_HWP_BASE_REGISTERS_MASK                     0x01
+#define CPUID_EAX_06_EAX_HWP_BASE_REGISTERS(_)                       (((_) >> 7) & 0x01)
+#define CPUID_EAX_06_EAX_HWP_BASE_REGISTERS_FEATURE                  391
 
       /**
        * [Bit 8] HWP_Notification. IA32_HWP_INTERRUPT MSR is supported if set.
        */
       uint32_t hwp_notification                                      : 1;
-#define CPUID_EAX_HWP_NOTIFICATION_BIT                               8
-#define CPUID_EAX_HWP_NOTIFICATION_FLAG                              0x100
-#define CPUID_EAX_HWP_NOTIFICATION_MASK                              0x01
-#define CPUID_EAX_HWP_NOTIFICATION(_)                                (((_) >> 8) & 0x01)
+#define CPUID_EAX_06_EAX_HWP_NOTIFICATION_BIT                        8
+#define CPUID_EAX_06_EAX_HWP_NOTIFICATION_FLAG                       0x100
+#define CPUID_EAX_06_EAX_HWP_NOTIFICATION_MASK                       0x01
+#define CPUID_EAX_06_EAX_HWP_NOTIFICATION(_)                         (((_) >> 8) & 0x01)
+#define CPUID_EAX_06_EAX_HWP_NOTIFICATION_FEATURE                    392
 
       /**
        * [Bit 9] HWP_Activity_Window. IA32_HWP_REQUEST[bits 41:32] is supported if set.
        */
       uint32_t hwp_activity_window                                   : 1;
-#define CPUID_EAX_HWP_ACTIVITY_WINDOW_BIT                            9
-#define CPUID_EAX_HWP_ACTIVITY_WINDOW_FLAG                           0x200
-#define CPUID_EAX_HWP_ACTIVITY_WINDOW_MASK                           0x01
-#define CPUID_EAX_HWP_ACTIVITY_WINDOW(_)                             (((_) >> 9) & 0x01)
+#define CPUID_EAX_06_EAX_HWP_ACTIVITY_WINDOW_BIT                     9
+#define CPUID_EAX_06_EAX_HWP_ACTIVITY_WINDOW_FLAG                    0x200
+#define CPUID_EAX_06_EAX_HWP_ACTIVITY_WINDOW_MASK                    0x01
+#define CPUID_EAX_06_EAX_HWP_ACTIVITY_WINDOW(_)                      (((_) >> 9) & 0x01)
+#define CPUID_EAX_06_EAX_HWP_ACTIVITY_WINDOW_FEATURE                 393
 
       /**
        * [Bit 10] HWP_Energy_Performance_Preference. IA32_HWP_REQUEST[bits 31:24] is supported if set.
        */
       uint32_t hwp_energy_performance_preference                     : 1;
-#define CPUID_EAX_HWP_ENERGY_PERFORMANCE_PREFERENCE_BIT              10
-#define CPUID_EAX_HWP_ENERGY_PERFORMANCE_PREFERENCE_FLAG             0x400
-#define CPUID_EAX_HWP_ENERGY_PERFORMANCE_PREFERENCE_MASK             0x01
-#define CPUID_EAX_HWP_ENERGY_PERFORMANCE_PREFERENCE(_)               (((_) >> 10) & 0x01)
+#define CPUID_EAX_06_EAX_HWP_ENERGY_PERFORMANCE_PREFERENCE_BIT       10
+#define CPUID_EAX_06_EAX_HWP_ENERGY_PERFORMANCE_PREFERENCE_FLAG      0x400
+#define CPUID_EAX_06_EAX_HWP_ENERGY_PERFORMANCE_PREFERENCE_MASK      0x01
+#define CPUID_EAX_06_EAX_HWP_ENERGY_PERFORMANCE_PREFERENCE(_)        (((_) >> 10) & 0x01)
+#define CPUID_EAX_06_EAX_HWP_ENERGY_PERFORMANCE_PREFERENCE_FEATURE   394
 
       /**
        * [Bit 11] HWP_Package_Level_Request. IA32_HWP_REQUEST_PKG MSR is supported if set.
        */
       uint32_t hwp_package_level_request                             : 1;
-#define CPUID_EAX_HWP_PACKAGE_LEVEL_REQUEST_BIT                      11
-#define CPUID_EAX_HWP_PACKAGE_LEVEL_REQUEST_FLAG                     0x800
-#define CPUID_EAX_HWP_PACKAGE_LEVEL_REQUEST_MASK                     0x01
-#define CPUID_EAX_HWP_PACKAGE_LEVEL_REQUEST(_)                       (((_) >> 11) & 0x01)
+#define CPUID_EAX_06_EAX_HWP_PACKAGE_LEVEL_REQUEST_BIT               11
+#define CPUID_EAX_06_EAX_HWP_PACKAGE_LEVEL_REQUEST_FLAG              0x800
+#define CPUID_EAX_06_EAX_HWP_PACKAGE_LEVEL_REQUEST_MASK              0x01
+#define CPUID_EAX_06_EAX_HWP_PACKAGE_LEVEL_REQUEST(_)                (((_) >> 11) & 0x01)
+#define CPUID_EAX_06_EAX_HWP_PACKAGE_LEVEL_REQUEST_FEATURE           395
       uint32_t reserved2                                             : 1;
 
       /**
        * [Bit 13] HDC. HDC base registers IA32_PKG_HDC_CTL, IA32_PM_CTL1, IA32_THREAD_STALL MSRs are supported if set.
        */
       uint32_t hdc                                                   : 1;
-#define CPUID_EAX_HDC_BIT                                            13
-#define CPUID_EAX_HDC_FLAG                                           0x2000
-#define CPUID_EAX_HDC_MASK                                           0x01
-#define CPUID_EAX_HDC(_)                                             (((_) >> 13) & 0x01)
+#define CPUID_EAX_06_EAX_HDC_BIT                                     13
+#define CPUID_EAX_06_EAX_HDC_FLAG                                    0x2000
+#define CPUID_EAX_06_EAX_HDC_MASK                                    0x01
+#define CPUID_EAX_06_EAX_HDC(_)                                      (((_) >> 13) & 0x01)
+#define CPUID_EAX_06_EAX_HDC_FEATURE                                 397
 
       /**
        * [Bit 14] Intel(R) Turbo Boost Max Technology 3.0 available.
        */
       uint32_t intel_turbo_boost_max_technology_3_available          : 1;
-#define CPUID_EAX_INTEL_TURBO_BOOST_MAX_TECHNOLOGY_3_AVAILABLE_BIT   14
-#define CPUID_EAX_INTEL_TURBO_BOOST_MAX_TECHNOLOGY_3_AVAILABLE_FLAG  0x4000
-#define CPUID_EAX_INTEL_TURBO_BOOST_MAX_TECHNOLOGY_3_AVAILABLE_MASK  0x01
-#define CPUID_EAX_INTEL_TURBO_BOOST_MAX_TECHNOLOGY_3_AVAILABLE(_)    (((_) >> 14) & 0x01)
+#define CPUID_EAX_06_EAX_INTEL_TURBO_BOOST_MAX_TECHNOLOGY_3_AVAILABLE_BIT 14
+#define CPUID_EAX_06_EAX_INTEL_TURBO_BOOST_MAX_TECHNOLOGY_3_AVAILABLE_FLAG 0x4000
+#define CPUID_EAX_06_EAX_INTEL_TURBO_BOOST_MAX_TECHNOLOGY_3_AVAILABLE_MASK 0x01
+#define CPUID_EAX_06_EAX_INTEL_TURBO_BOOST_MAX_TECHNOLOGY_3_AVAILABLE(_) (((_) >> 14) & 0x01)
+#define CPUID_EAX_06_EAX_INTEL_TURBO_BOOST_MAX_TECHNOLOGY_3_AVAILABLE_FEATURE 398
 
       /**
        * [Bit 15] HWP Capabilities. Highest Performance change is supported if set.
        */
       uint32_t hwp_capabilities                                      : 1;
-#define CPUID_EAX_HWP_CAPABILITIES_BIT                               15
-#define CPUID_EAX_HWP_CAPABILITIES_FLAG                              0x8000
-#define CPUID_EAX_HWP_CAPABILITIES_MASK                              0x01
-#define CPUID_EAX_HWP_CAPABILITIES(_)                                (((_) >> 15) & 0x01)
+#define CPUID_EAX_06_EAX_HWP_CAPABILITIES_BIT                        15
+#define CPUID_EAX_06_EAX_HWP_CAPABILITIES_FLAG                       0x8000
+#define CPUID_EAX_06_EAX_HWP_CAPABILITIES_MASK                       0x01
+#define CPUID_EAX_06_EAX_HWP_CAPABILITIES(_)                         (((_) >> 15) & 0x01)
+#define CPUID_EAX_06_EAX_HWP_CAPABILITIES_FEATURE                    399
 
       /**
        * [Bit 16] HWP PECI override is supported if set.
        */
       uint32_t hwp_peci_override                                     : 1;
-#define CPUID_EAX_HWP_PECI_OVERRIDE_BIT                              16
-#define CPUID_EAX_HWP_PECI_OVERRIDE_FLAG                             0x10000
-#define CPUID_EAX_HWP_PECI_OVERRIDE_MASK                             0x01
-#define CPUID_EAX_HWP_PECI_OVERRIDE(_)                               (((_) >> 16) & 0x01)
+#define CPUID_EAX_06_EAX_HWP_PECI_OVERRIDE_BIT                       16
+#define CPUID_EAX_06_EAX_HWP_PECI_OVERRIDE_FLAG                      0x10000
+#define CPUID_EAX_06_EAX_HWP_PECI_OVERRIDE_MASK                      0x01
+#define CPUID_EAX_06_EAX_HWP_PECI_OVERRIDE(_)                        (((_) >> 16) & 0x01)
+#define CPUID_EAX_06_EAX_HWP_PECI_OVERRIDE_FEATURE                   400
 
       /**
        * [Bit 17] Flexible HWP is supported if set.
        */
       uint32_t flexible_hwp                                          : 1;
-#define CPUID_EAX_FLEXIBLE_HWP_BIT                                   17
-#define CPUID_EAX_FLEXIBLE_HWP_FLAG                                  0x20000
-#define CPUID_EAX_FLEXIBLE_HWP_MASK                                  0x01
-#define CPUID_EAX_FLEXIBLE_HWP(_)                                    (((_) >> 17) & 0x01)
+#define CPUID_EAX_06_EAX_FLEXIBLE_HWP_BIT                            17
+#define CPUID_EAX_06_EAX_FLEXIBLE_HWP_FLAG                           0x20000
+#define CPUID_EAX_06_EAX_FLEXIBLE_HWP_MASK                           0x01
+#define CPUID_EAX_06_EAX_FLEXIBLE_HWP(_)                             (((_) >> 17) & 0x01)
+#define CPUID_EAX_06_EAX_FLEXIBLE_HWP_FEATURE                        401
 
       /**
        * [Bit 18] Fast access mode for the IA32_HWP_REQUEST MSR is supported if set.
        */
       uint32_t fast_access_mode_for_hwp_request_msr                  : 1;
-#define CPUID_EAX_FAST_ACCESS_MODE_FOR_HWP_REQUEST_MSR_BIT           18
-#define CPUID_EAX_FAST_ACCESS_MODE_FOR_HWP_REQUEST_MSR_FLAG          0x40000
-#define CPUID_EAX_FAST_ACCESS_MODE_FOR_HWP_REQUEST_MSR_MASK          0x01
-#define CPUID_EAX_FAST_ACCESS_MODE_FOR_HWP_REQUEST_MSR(_)            (((_) >> 18) & 0x01)
+#define CPUID_EAX_06_EAX_FAST_ACCESS_MODE_FOR_HWP_REQUEST_MSR_BIT    18
+#define CPUID_EAX_06_EAX_FAST_ACCESS_MODE_FOR_HWP_REQUEST_MSR_FLAG   0x40000
+#define CPUID_EAX_06_EAX_FAST_ACCESS_MODE_FOR_HWP_REQUEST_MSR_MASK   0x01
+#define CPUID_EAX_06_EAX_FAST_ACCESS_MODE_FOR_HWP_REQUEST_MSR(_)     (((_) >> 18) & 0x01)
+#define CPUID_EAX_06_EAX_FAST_ACCESS_MODE_FOR_HWP_REQUEST_MSR_FEATURE 402
       uint32_t reserved3                                             : 1;
 
       /**
        * [Bit 20] Ignoring Idle Logical Processor HWP request is supported if set.
        */
       uint32_t ignoring_idle_logical_processor_hwp_request           : 1;
-#define CPUID_EAX_IGNORING_IDLE_LOGICAL_PROCESSOR_HWP_REQUEST_BIT    20
-#define CPUID_EAX_IGNORING_IDLE_LOGICAL_PROCESSOR_HWP_REQUEST_FLAG   0x100000
-#define CPUID_EAX_IGNORING_IDLE_LOGICAL_PROCESSOR_HWP_REQUEST_MASK   0x01
-#define CPUID_EAX_IGNORING_IDLE_LOGICAL_PROCESSOR_HWP_REQUEST(_)     (((_) >> 20) & 0x01)
+#define CPUID_EAX_06_EAX_IGNORING_IDLE_LOGICAL_PROCESSOR_HWP_REQUEST_BIT 20
+#define CPUID_EAX_06_EAX_IGNORING_IDLE_LOGICAL_PROCESSOR_HWP_REQUEST_FLAG 0x100000
+#define CPUID_EAX_06_EAX_IGNORING_IDLE_LOGICAL_PROCESSOR_HWP_REQUEST_MASK 0x01
+#define CPUID_EAX_06_EAX_IGNORING_IDLE_LOGICAL_PROCESSOR_HWP_REQUEST(_) (((_) >> 20) & 0x01)
+#define CPUID_EAX_06_EAX_IGNORING_IDLE_LOGICAL_PROCESSOR_HWP_REQUEST_FEATURE 404
       uint32_t reserved4                                             : 2;
 
       /**
@@ -2488,15 +2628,17 @@ typedef struct
        * supported if set.
        */
       uint32_t intel_thread_director                                 : 1;
-#define CPUID_EAX_INTEL_THREAD_DIRECTOR_BIT                          23
-#define CPUID_EAX_INTEL_THREAD_DIRECTOR_FLAG                         0x800000
-#define CPUID_EAX_INTEL_THREAD_DIRECTOR_MASK                         0x01
-#define CPUID_EAX_INTEL_THREAD_DIRECTOR(_)                           (((_) >> 23) & 0x01)
+#define CPUID_EAX_06_EAX_INTEL_THREAD_DIRECTOR_BIT                   23
+#define CPUID_EAX_06_EAX_INTEL_THREAD_DIRECTOR_FLAG                  0x800000
+#define CPUID_EAX_06_EAX_INTEL_THREAD_DIRECTOR_MASK                  0x01
+#define CPUID_EAX_06_EAX_INTEL_THREAD_DIRECTOR(_)                    (((_) >> 23) & 0x01)
+#define CPUID_EAX_06_EAX_INTEL_THREAD_DIRECTOR_FEATURE               407
       uint32_t reserved5                                             : 8;
     };
 
     uint32_t flags;
   } eax;
+#define CPUID_EAX_06_EAX_RESERVED_BITS                               0xFF681008
 
   union
   {
@@ -2506,15 +2648,16 @@ typedef struct
        * [Bits 3:0] Number of Interrupt Thresholds in Digital Thermal Sensor.
        */
       uint32_t number_of_interrupt_thresholds_in_thermal_sensor      : 4;
-#define CPUID_EBX_NUMBER_OF_INTERRUPT_THRESHOLDS_IN_THERMAL_SENSOR_BIT 0
-#define CPUID_EBX_NUMBER_OF_INTERRUPT_THRESHOLDS_IN_THERMAL_SENSOR_FLAG 0x0F
-#define CPUID_EBX_NUMBER_OF_INTERRUPT_THRESHOLDS_IN_THERMAL_SENSOR_MASK 0x0F
-#define CPUID_EBX_NUMBER_OF_INTERRUPT_THRESHOLDS_IN_THERMAL_SENSOR(_) (((_) >> 0) & 0x0F)
+#define CPUID_EAX_06_EBX_NUMBER_OF_INTERRUPT_THRESHOLDS_IN_THERMAL_SENSOR_BIT 0
+#define CPUID_EAX_06_EBX_NUMBER_OF_INTERRUPT_THRESHOLDS_IN_THERMAL_SENSOR_FLAG 0x0F
+#define CPUID_EAX_06_EBX_NUMBER_OF_INTERRUPT_THRESHOLDS_IN_THERMAL_SENSOR_MASK 0x0F
+#define CPUID_EAX_06_EBX_NUMBER_OF_INTERRUPT_THRESHOLDS_IN_THERMAL_SENSOR(_) (((_) >> 0) & 0x0F)
       uint32_t reserved1                                             : 28;
     };
 
     uint32_t flags;
   } ebx;
+#define CPUID_EAX_06_EBX_RESERVED_BITS                               0xFFFFFFF0
 
   union
   {
@@ -2526,10 +2669,11 @@ typedef struct
        * performance when running at the TSC frequency.
        */
       uint32_t hardware_coordination_feedback_capability             : 1;
-#define CPUID_ECX_HARDWARE_COORDINATION_FEEDBACK_CAPABILITY_BIT      0
-#define CPUID_ECX_HARDWARE_COORDINATION_FEEDBACK_CAPABILITY_FLAG     0x01
-#define CPUID_ECX_HARDWARE_COORDINATION_FEEDBACK_CAPABILITY_MASK     0x01
-#define CPUID_ECX_HARDWARE_COORDINATION_FEEDBACK_CAPABILITY(_)       (((_) >> 0) & 0x01)
+#define CPUID_EAX_06_ECX_HARDWARE_COORDINATION_FEEDBACK_CAPABILITY_BIT 0
+#define CPUID_EAX_06_ECX_HARDWARE_COORDINATION_FEEDBACK_CAPABILITY_FLAG 0x01
+#define CPUID_EAX_06_ECX_HARDWARE_COORDINATION_FEEDBACK_CAPABILITY_MASK 0x01
+#define CPUID_EAX_06_ECX_HARDWARE_COORDINATION_FEEDBACK_CAPABILITY(_) (((_) >> 0) & 0x01)
+#define CPUID_EAX_06_ECX_HARDWARE_COORDINATION_FEEDBACK_CAPABILITY_FEATURE 448
       uint32_t reserved1                                             : 2;
 
       /**
@@ -2537,10 +2681,11 @@ typedef struct
        * into the Intel Thread Director Table by the hardware.
        */
       uint32_t number_of_intel_thread_director_classes               : 1;
-#define CPUID_ECX_NUMBER_OF_INTEL_THREAD_DIRECTOR_CLASSES_BIT        3
-#define CPUID_ECX_NUMBER_OF_INTEL_THREAD_DIRECTOR_CLASSES_FLAG       0x08
-#define CPUID_ECX_NUMBER_OF_INTEL_THREAD_DIRECTOR_CLASSES_MASK       0x01
-#define CPUID_ECX_NUMBER_OF_INTEL_THREAD_DIRECTOR_CLASSES(_)         (((_) >> 3) & 0x01)
+#define CPUID_EAX_06_ECX_NUMBER_OF_INTEL_THREAD_DIRECTOR_CLASSES_BIT 3
+#define CPUID_EAX_06_ECX_NUMBER_OF_INTEL_THREAD_DIRECTOR_CLASSES_FLAG 0x08
+#define CPUID_EAX_06_ECX_NUMBER_OF_INTEL_THREAD_DIRECTOR_CLASSES_MASK 0x01
+#define CPUID_EAX_06_ECX_NUMBER_OF_INTEL_THREAD_DIRECTOR_CLASSES(_)  (((_) >> 3) & 0x01)
+#define CPUID_EAX_06_ECX_NUMBER_OF_INTEL_THREAD_DIRECTOR_CLASSES_FEATURE 451
       uint32_t reserved2                                             : 4;
 
       /**
@@ -2548,15 +2693,16 @@ typedef struct
        * implies the presence of a new architectural MSR called IA32_ENERGY_PERF_BIAS (1B0H).
        */
       uint32_t performance_energy_bias_preference                    : 8;
-#define CPUID_ECX_PERFORMANCE_ENERGY_BIAS_PREFERENCE_BIT             8
-#define CPUID_ECX_PERFORMANCE_ENERGY_BIAS_PREFERENCE_FLAG            0xFF00
-#define CPUID_ECX_PERFORMANCE_ENERGY_BIAS_PREFERENCE_MASK            0xFF
-#define CPUID_ECX_PERFORMANCE_ENERGY_BIAS_PREFERENCE(_)              (((_) >> 8) & 0xFF)
+#define CPUID_EAX_06_ECX_PERFORMANCE_ENERGY_BIAS_PREFERENCE_BIT      8
+#define CPUID_EAX_06_ECX_PERFORMANCE_ENERGY_BIAS_PREFERENCE_FLAG     0xFF00
+#define CPUID_EAX_06_ECX_PERFORMANCE_ENERGY_BIAS_PREFERENCE_MASK     0xFF
+#define CPUID_EAX_06_ECX_PERFORMANCE_ENERGY_BIAS_PREFERENCE(_)       (((_) >> 8) & 0xFF)
       uint32_t reserved3                                             : 16;
     };
 
     uint32_t flags;
   } ecx;
+#define CPUID_EAX_06_ECX_RESERVED_BITS                               0xFFFF00F6
 
   union
   {
@@ -2566,16 +2712,26 @@ typedef struct
        * [Bits 31:0] EDX is reserved.
        */
       uint32_t reserved                                              : 32;
-#define CPUID_EDX_RESERVED_BIT                                       0
-#define CPUID_EDX_RESERVED_FLAG                                      0xFFFFFFFF
-#define CPUID_EDX_RESERVED_MASK                                      0xFFFFFFFF
-#define CPUID_EDX_RESERVED(_)                                        (((_) >> 0) & 0xFFFFFFFF)
+#define CPUID_EAX_06_EDX_RESERVED_BIT                                0
+#define CPUID_EAX_06_EDX_RESERVED_FLAG                               0xFFFFFFFF
+#define CPUID_EAX_06_EDX_RESERVED_MASK                               0xFFFFFFFF
+#define CPUID_EAX_06_EDX_RESERVED(_)                                 (((_) >> 0) & 0xFFFFFFFF)
     };
 
     uint32_t flags;
   } edx;
+#define CPUID_EAX_06_EDX_RESERVED_BITS                               0xFFFFFFFF
 
 } cpuid_eax_06;
+#define CPUID_EAX_06_SNAPSHOT_INDEX                                  3
+#define CPUID_EAX_06_EAX_POLICY_AND                                  0x0097EFF7
+#define CPUID_EAX_06_EAX_POLICY_OR                                   0x00000000
+#define CPUID_EAX_06_EBX_POLICY_AND                                  0x0000000F
+#define CPUID_EAX_06_EBX_POLICY_OR                                   0x00000000
+#define CPUID_EAX_06_ECX_POLICY_AND                                  0x0000FF09
+#define CPUID_EAX_06_ECX_POLICY_OR                                   0x00000000
+#define CPUID_EAX_06_EDX_POLICY_AND                                  0x00000000
+#define CPUID_EAX_06_EDX_POLICY_OR                                   0x00000000
 
 /**
  * @defgroup cpuid_eax_07 \
@@ -2599,14 +2755,15 @@ typedef struct
        * [Bits 31:0] Reports the maximum input value for supported leaf 7 sub-leaves.
        */
       uint32_t number_of_sub_leaves                                  : 32;
-#define CPUID_EAX_NUMBER_OF_SUB_LEAVES_BIT                           0
-#define CPUID_EAX_NUMBER_OF_SUB_LEAVES_FLAG                          0xFFFFFFFF
-#define CPUID_EAX_NUMBER_OF_SUB_LEAVES_MASK                          0xFFFFFFFF
-#define CPUID_EAX_NUMBER_OF_SUB_LEAVES(_)                            (((_) >> 0) & 0xFFFFFFFF)
+#define CPUID_EAX_07_EAX_NUMBER_OF_SUB_LEAVES_BIT                    0
+#define CPUID_EAX_07_EAX_NUMBER_OF_SUB_LEAVES_FLAG                   0xFFFFFFFF
+#define CPUID_EAX_07_EAX_NUMBER_OF_SUB_LEAVES_MASK                   0xFFFFFFFF
+#define CPUID_EAX_07_EAX_NUMBER_OF_SUB_LEAVES(_)                     (((_) >> 0) & 0xFFFFFFFF)
     };
 
     uint32_t flags;
   } eax;
+#define CPUID_EAX_07_EAX_RESERVED_BITS                               0x00
 
   union
   {
@@ -2616,285 +2773,317 @@ typedef struct
        * [Bit 0] Supports RDFSBASE/RDGSBASE/WRFSBASE/WRGSBASE if 1.
        */
       uint32_t fsgsbase                                              : 1;
-#define CPUID_EBX_FSGSBASE_BIT                                       0
-#define CPUID_EBX_FSGSBASE_FLAG                                      0x01
-#define CPUID_EBX_FSGSBASE_MASK                                      0x01
-#define CPUID_EBX_FSGSBASE(_)                                        (((_) >> 0) & 0x01)
+#define CPUID_EAX_07_EBX_FSGSBASE_BIT                                0
+#define CPUID_EAX_07_EBX_FSGSBASE_FLAG                               0x01
+#define CPUID_EAX_07_EBX_FSGSBASE_MASK                               0x01
+#define CPUID_EAX_07_EBX_FSGSBASE(_)                                 (((_) >> 0) & 0x01)
+#define CPUID_EAX_07_EBX_FSGSBASE_FEATURE                            544
 
       /**
        * [Bit 1] IA32_TSC_ADJUST MSR is supported if 1.
        */
       uint32_t ia32_tsc_adjust_msr                                   : 1;
-#define CPUID_EBX_IA32_TSC_ADJUST_MSR_BIT                            1
-#define CPUID_EBX_IA32_TSC_ADJUST_MSR_FLAG                           0x02
-#define CPUID_EBX_IA32_TSC_ADJUST_MSR_MASK                           0x01
-#define CPUID_EBX_IA32_TSC_ADJUST_MSR(_)                             (((_) >> 1) & 0x01)
+#define CPUID_EAX_07_EBX_IA32_TSC_ADJUST_MSR_BIT                     1
+#define CPUID_EAX_07_EBX_IA32_TSC_ADJUST_MSR_FLAG                    0x02
+#define CPUID_EAX_07_EBX_IA32_TSC_ADJUST_MSR_MASK                    0x01
+#define CPUID_EAX_07_EBX_IA32_TSC_ADJUST_MSR(_)                      (((_) >> 1) & 0x01)
+#define CPUID_EAX_07_EBX_IA32_TSC_ADJUST_MSR_FEATURE                 545
 
       /**
        * [Bit 2] Supports Intel(R) Software Guard Extensions (Intel(R) SGX Extensions) if 1.
        */
       uint32_t sgx                                                   : 1;
-#define CPUID_EBX_SGX_BIT                                            2
-#define CPUID_EBX_SGX_FLAG                                           0x04
-#define CPUID_EBX_SGX_MASK                                           0x01
-#define CPUID_EBX_SGX(_)                                             (((_) >> 2) & 0x01)
+#define CPUID_EAX_07_EBX_SGX_BIT                                     2
+#define CPUID_EAX_07_EBX_SGX_FLAG                                    0x04
+#define CPUID_EAX_07_EBX_SGX_MASK                                    0x01
+#define CPUID_EAX_07_EBX_SGX(_)                                      (((_) >> 2) & 0x01)
+#define CPUID_EAX_07_EBX_SGX_FEATURE                                 546
 
       /**
        * [Bit 3] BMI1.
        */
       uint32_t bmi1                                                  : 1;
-#define CPUID_EBX_BMI1_BIT                                           3
-#define CPUID_EBX_BMI1_FLAG                                          0x08
-#define CPUID_EBX_BMI1_MASK                                          0x01
-#define CPUID_EBX_BMI1(_)                                            (((_) >> 3) & 0x01)
+#define CPUID_EAX_07_EBX_BMI1_BIT                                    3
+#define CPUID_EAX_07_EBX_BMI1_FLAG                                   0x08
+#define CPUID_EAX_07_EBX_BMI1_MASK                                   0x01
+#define CPUID_EAX_07_EBX_BMI1(_)                                     (((_) >> 3) & 0x01)
+#define CPUID_EAX_07_EBX_BMI1_FEATURE                                547
 
       /**
        * [Bit 4] HLE.
        */
       uint32_t hle                                                   : 1;
-#define CPUID_EBX_HLE_BIT                                            4
-#define CPUID_EBX_HLE_FLAG                                           0x10
-#define CPUID_EBX_HLE_MASK                                           0x01
-#define CPUID_EBX_HLE(_)                                             (((_) >> 4) & 0x01)
+#define CPUID_EAX_07_EBX_HLE_BIT                                     4
+#define CPUID_EAX_07_EBX_HLE_FLAG                                    0x10
+#define CPUID_EAX_07_EBX_HLE_MASK                                    0x01
+#define CPUID_EAX_07_EBX_HLE(_)                                      (((_) >> 4) & 0x01)
+#define CPUID_EAX_07_EBX_HLE_FEATURE                                 548
 
       /**
        * [Bit 5] AVX2.
        */
       uint32_t avx2                                                  : 1;
-#define CPUID_EBX_AVX2_BIT                                           5
-#define CPUID_EBX_AVX2_FLAG                                          0x20
-#define CPUID_EBX_AVX2_MASK                                          0x01
-#define CPUID_EBX_AVX2(_)                                            (((_) >> 5) & 0x01)
+#define CPUID_EAX_07_EBX_AVX2_BIT                                    5
+#define CPUID_EAX_07_EBX_AVX2_FLAG                                   0x20
+#define CPUID_EAX_07_EBX_AVX2_MASK                                   0x01
+#define CPUID_EAX_07_EBX_AVX2(_)                                     (((_) >> 5) & 0x01)
+#define CPUID_EAX_07_EBX_AVX2_FEATURE                                549
 
       /**
        * [Bit 6] x87 FPU Data Pointer updated only on x87 exceptions if 1.
        */
       uint32_t fdp_excptn_only                                       : 1;
-#define CPUID_EBX_FDP_EXCPTN_ONLY_BIT                                6
-#define CPUID_EBX_FDP_EXCPTN_ONLY_FLAG                               0x40
-#define CPUID_EBX_FDP_EXCPTN_ONLY_MASK                               0x01
-#define CPUID_EBX_FDP_EXCPTN_ONLY(_)                                 (((_) >> 6) & 0x01)
+#define CPUID_EAX_07_EBX_FDP_EXCPTN_ONLY_BIT                         6
+#define CPUID_EAX_07_EBX_FDP_EXCPTN_ONLY_FLAG                        0x40
+#define CPUID_EAX_07_EBX_FDP_EXCPTN_ONLY_MASK                        0x01
+#define CPUID_EAX_07_EBX_FDP_EXCPTN_ONLY(_)                          (((_) >> 6) & 0x01)
+#define CPUID_EAX_07_EBX_FDP_EXCPTN_ONLY_FEATURE                     550
 
       /**
        * [Bit 7] Supports Supervisor-Mode Execution Prevention if 1.
        */
       uint32_t smep                                                  : 1;
-#define CPUID_EBX_SMEP_BIT                                           7
-#define CPUID_EBX_SMEP_FLAG                                          0x80
-#define CPUID_EBX_SMEP_MASK                                          0x01
-#define CPUID_EBX_SMEP(_)                                            (((_) >> 7) & 0x01)
+#define CPUID_EAX_07_EBX_SMEP_BIT                                    7
+#define CPUID_EAX_07_EBX_SMEP_FLAG                                   0x80
+#define CPUID_EAX_07_EBX_SMEP_MASK                                   0x01
+#define CPUID_EAX_07_EBX_SMEP(_)                                     (((_) >> 7) & 0x01)
+#define CPUID_EAX_07_EBX_SMEP_FEATURE                                551
 
       /**
        * [Bit 8] BMI2.
        */
       uint32_t bmi2                                                  : 1;
-#define CPUID_EBX_BMI2_BIT                                           8
-#define CPUID_EBX_BMI2_FLAG                                          0x100
-#define CPUID_EBX_BMI2_MASK                                          0x01
-#define CPUID_EBX_BMI2(_)                                            (((_) >> 8) & 0x01)
+#define CPUID_EAX_07_EBX_BMI2_BIT                                    8
+#define CPUID_EAX_07_EBX_BMI2_FLAG                                   0x100
+#define CPUID_EAX_07_EBX_BMI2_MASK                                   0x01
+#define CPUID_EAX_07_EBX_BMI2(_)                                     (((_) >> 8) & 0x01)
+#define CPUID_EAX_07_EBX_BMI2_FEATURE                                552
 
       /**
        * [Bit 9] Supports Enhanced REP MOVSB/STOSB if 1.
        */
       uint32_t enhanced_rep_movsb_stosb                              : 1;
-#define CPUID_EBX_ENHANCED_REP_MOVSB_STOSB_BIT                       9
-#define CPUID_EBX_ENHANCED_REP_MOVSB_STOSB_FLAG                      0x200
-#define CPUID_EBX_ENHANCED_REP_MOVSB_STOSB_MASK                      0x01
-#define CPUID_EBX_ENHANCED_REP_MOVSB_STOSB(_)                        (((_) >> 9) & 0x01)
+#define CPUID_EAX_07_EBX_ENHANCED_REP_MOVSB_STOSB_BIT                9
+#define CPUID_EAX_07_EBX_ENHANCED_REP_MOVSB_STOSB_FLAG               0x200
+#define CPUID_EAX_07_EBX_ENHANCED_REP_MOVSB_STOSB_MASK               0x01
+#define CPUID_EAX_07_EBX_ENHANCED_REP_MOVSB_STOSB(_)                 (((_) >> 9) & 0x01)
+#define CPUID_EAX_07_EBX_ENHANCED_REP_MOVSB_STOSB_FEATURE            553
 
       /**
        * [Bit 10] If 1, supports INVPCID instruction for system software that manages process-context identifiers.
        */
       uint32_t invpcid                                               : 1;
-#define CPUID_EBX_INVPCID_BIT                                        10
-#define CPUID_EBX_INVPCID_FLAG                                       0x400
-#define CPUID_EBX_INVPCID_MASK                                       0x01
-#define CPUID_EBX_INVPCID(_)                                         (((_) >> 10) & 0x01)
+#define CPUID_EAX_07_EBX_INVPCID_BIT                                 10
+#define CPUID_EAX_07_EBX_INVPCID_FLAG                                0x400
+#define CPUID_EAX_07_EBX_INVPCID_MASK                                0x01
+#define CPUID_EAX_07_EBX_INVPCID(_)                                  (((_) >> 10) & 0x01)
+#define CPUID_EAX_07_EBX_INVPCID_FEATURE                             554
 
       /**
        * [Bit 11] RTM.
        */
       uint32_t rtm                                                   : 1;
-#define CPUID_EBX_RTM_BIT                                            11
-#define CPUID_EBX_RTM_FLAG                                           0x800
-#define CPUID_EBX_RTM_MASK                                           0x01
-#define CPUID_EBX_RTM(_)                                             (((_) >> 11) & 0x01)
+#define CPUID_EAX_07_EBX_RTM_BIT                                     11
+#define CPUID_EAX_07_EBX_RTM_FLAG                                    0x800
+#define CPUID_EAX_07_EBX_RTM_MASK                                    0x01
+#define CPUID_EAX_07_EBX_RTM(_)                                      (((_) >> 11) & 0x01)
+#define CPUID_EAX_07_EBX_RTM_FEATURE                                 555
 
       /**
        * [Bit 12] Supports Intel(R) Resource Director Technology (Intel(R) RDT) Monitoring capability if 1.
        */
       uint32_t rdt_m                                                 : 1;
-#define CPUID_EBX_RDT_M_BIT                                          12
-#define CPUID_EBX_RDT_M_FLAG                                         0x1000
-#define CPUID_EBX_RDT_M_MASK                                         0x01
-#define CPUID_EBX_RDT_M(_)                                           (((_) >> 12) & 0x01)
+#define CPUID_EAX_07_EBX_RDT_M_BIT                                   12
+#define CPUID_EAX_07_EBX_RDT_M_FLAG                                  0x1000
+#define CPUID_EAX_07_EBX_RDT_M_MASK                                  0x01
+#define CPUID_EAX_07_EBX_RDT_M(_)                                    (((_) >> 12) & 0x01)
+#define CPUID_EAX_07_EBX_RDT_M_FEATURE                               556
 
       /**
        * [Bit 13] Deprecates FPU CS and FPU DS values if 1.
        */
       uint32_t deprecates                                            : 1;
-#define CPUID_EBX_DEPRECATES_BIT                                     13
-#define CPUID_EBX_DEPRECATES_FLAG                                    0x2000
-#define CPUID_EBX_DEPRECATES_MASK                                    0x01
-#define CPUID_EBX_DEPRECATES(_)                                      (((_) >> 13) & 0x01)
+#define CPUID_EAX_07_EBX_DEPRECATES_BIT                              13
+#define CPUID_EAX_07_EBX_DEPRECATES_FLAG                             0x2000
+#define CPUID_EAX_07_EBX_DEPRECATES_MASK                             0x01
+#define CPUID_EAX_07_EBX_DEPRECATES(_)                               (((_) >> 13) & 0x01)
+#define CPUID_EAX_07_EBX_DEPRECATES_FEATURE                          557
 
       /**
        * [Bit 14] Supports Intel(R) Memory Protection Extensions if 1.
        */
       uint32_t mpx                                                   : 1;
-#define CPUID_EBX_MPX_BIT                                            14
-#define CPUID_EBX_MPX_FLAG                                           0x4000
-#define CPUID_EBX_MPX_MASK                                           0x01
-#define CPUID_EBX_MPX(_)                                             (((_) >> 14) & 0x01)
+#define CPUID_EAX_07_EBX_MPX_BIT                                     14
+#define CPUID_EAX_07_EBX_MPX_FLAG                                    0x4000
+#define CPUID_EAX_07_EBX_MPX_MASK                                    0x01
+#define CPUID_EAX_07_EBX_MPX(_)                                      (((_) >> 14) & 0x01)
+#define CPUID_EAX_07_EBX_MPX_FEATURE                                 558
 
       /**
        * [Bit 15] Supports Intel(R) Resource Director Technology (Intel(R) RDT) Allocation capability if 1.
        */
       uint32_t rdt                                                   : 1;
-#define CPUID_EBX_RDT_BIT                                            15
-#define CPUID_EBX_RDT_FLAG                                           0x8000
-#define CPUID_EBX_RDT_MASK                                           0x01
-#define CPUID_EBX_RDT(_)                                             (((_) >> 15) & 0x01)
+#define CPUID_EAX_07_EBX_RDT_BIT                                     15
+#define CPUID_EAX_07_EBX_RDT_FLAG                                    0x8000
+#define CPUID_EAX_07_EBX_RDT_MASK                                    0x01
+#define CPUID_EAX_07_EBX_RDT(_)                                      (((_) >> 15) & 0x01)
+#define CPUID_EAX_07_EBX_RDT_FEATURE                                 559
 
       /**
        * [Bit 16] AVX512F.
        */
       uint32_t avx512f                                               : 1;
-#define CPUID_EBX_AVX512F_BIT                                        16
-#define CPUID_EBX_AVX512F_FLAG                                       0x10000
-#define CPUID_EBX_AVX512F_MASK                                       0x01
-#define CPUID_EBX_AVX512F(_)                                         (((_) >> 16) & 0x01)
+#define CPUID_EAX_07_EBX_AVX512F_BIT                                 16
+#define CPUID_EAX_07_EBX_AVX512F_FLAG                                0x10000
+#define CPUID_EAX_07_EBX_AVX512F_MASK                                0x01
+#define CPUID_EAX_07_EBX_AVX512F(_)                                  (((_) >> 16) & 0x01)
+#define CPUID_EAX_07_EBX_AVX512F_FEATURE                             560
 
       /**
        * [Bit 17] AVX512DQ.
        */
       uint32_t avx512dq                                              : 1;
-#define CPUID_EBX_AVX512DQ_BIT                                       17
-#define CPUID_EBX_AVX512DQ_FLAG                                      0x20000
-#define CPUID_EBX_AVX512DQ_MASK                                      0x01
-#define CPUID_EBX_AVX512DQ(_)                                        (((_) >> 17) & 0x01)
+#define CPUID_EAX_07_EBX_AVX512DQ_BIT                                17
+#define CPUID_EAX_07_EBX_AVX512DQ_FLAG                               0x20000
+#define CPUID_EAX_07_EBX_AVX512DQ_MASK                               0x01
+#define CPUID_EAX_07_EBX_AVX512DQ(_)                                 (((_) >> 17) & 0x01)
+#define CPUID_EAX_07_EBX_AVX512DQ_FEATURE                            561
 
       /**
        * [Bit 18] RDSEED.
        */
       uint32_t rdseed                                                : 1;
-#define CPUID_EBX_RDSEED_BIT                                         18
-#define CPUID_EBX_RDSEED_FLAG                                        0x40000
-#define CPUID_EBX_RDSEED_MASK                                        0x01
-#define CPUID_EBX_RDSEED(_)                                          (((_) >> 18) & 0x01)
+#define CPUID_EAX_07_EBX_RDSEED_BIT                                  18
+#define CPUID_EAX_07_EBX_RDSEED_FLAG                                 0x40000
+#define CPUID_EAX_07_EBX_RDSEED_MASK                                 0x01
+#define CPUID_EAX_07_EBX_RDSEED(_)                                   (((_) >> 18) & 0x01)
+#define CPUID_EAX_07_EBX_RDSEED_FEATURE                              562
 
       /**
        * [Bit 19] ADX.
        */
       uint32_t adx                                                   : 1;
-#define CPUID_EBX_ADX_BIT                                            19
-#define CPUID_EBX_ADX_FLAG                                           0x80000
-#define CPUID_EBX_ADX_MASK                                           0x01
-#define CPUID_EBX_ADX(_)                                             (((_) >> 19) & 0x01)
+#define CPUID_EAX_07_EBX_ADX_BIT                                     19
+#define CPUID_EAX_07_EBX_ADX_FLAG                                    0x80000
+#define CPUID_EAX_07_EBX_ADX_MASK                                    0x01
+#define CPUID_EAX_07_EBX_ADX(_)                                      (((_) >> 19) & 0x01)
+#define CPUID_EAX_07_EBX_ADX_FEATURE                                 563
 
       /**
        * [Bit 20] Supports Supervisor-Mode Access Prevention (and the CLAC/STAC instructions) if 1.
        */
       uint32_t smap                                                  : 1;
-#define CPUID_EBX_SMAP_BIT                                           20
-#define CPUID_EBX_SMAP_FLAG                                          0x100000
-#define CPUID_EBX_SMAP_MASK                                          0x01
-#define CPUID_EBX_SMAP(_)                                            (((_) >> 20) & 0x01)
+#define CPUID_EAX_07_EBX_SMAP_BIT                                    20
+#define CPUID_EAX_07_EBX_SMAP_FLAG                                   0x100000
+#define CPUID_EAX_07_EBX_SMAP_MASK                                   0x01
+#define CPUID_EAX_07_EBX_SMAP(_)                                     (((_) >> 20) & 0x01)
+#define CPUID_EAX_07_EBX_SMAP_FEATURE                                564
 
       /**
        * [Bit 21] AVX512_IFMA.
        */
       uint32_t avx512_ifma                                           : 1;
-#define CPUID_EBX_AVX512_IFMA_BIT                                    21
-#define CPUID_EBX_AVX512_IFMA_FLAG                                   0x200000
-#define CPUID_EBX_AVX512_IFMA_MASK                                   0x01
-#define CPUID_EBX_AVX512_IFMA(_)                                     (((_) >> 21) & 0x01)
+#define CPUID_EAX_07_EBX_AVX512_IFMA_BIT                             21
+#define CPUID_EAX_07_EBX_AVX512_IFMA_FLAG                            0x200000
+#define CPUID_EAX_07_EBX_AVX512_IFMA_MASK                            0x01
+#define CPUID_EAX_07_EBX_AVX512_IFMA(_)                              (((_) >> 21) & 0x01)
+#define CPUID_EAX_07_EBX_AVX512_IFMA_FEATURE                         565
       uint32_t reserved1                                             : 1;
 
       /**
        * [Bit 23] CLFLUSHOPT.
        */
       uint32_t clflushopt                                            : 1;
-#define CPUID_EBX_CLFLUSHOPT_BIT                                     23
-#define CPUID_EBX_CLFLUSHOPT_FLAG                                    0x800000
-#define CPUID_EBX_CLFLUSHOPT_MASK                                    0x01
-#define CPUID_EBX_CLFLUSHOPT(_)                                      (((_) >> 23) & 0x01)
+#define CPUID_EAX_07_EBX_CLFLUSHOPT_BIT                              23
+#define CPUID_EAX_07_EBX_CLFLUSHOPT_FLAG                             0x800000
+#define CPUID_EAX_07_EBX_CLFLUSHOPT_MASK                             0x01
+#define CPUID_EAX_07_EBX_CLFLUSHOPT(_)                               (((_) >> 23) & 0x01)
+#define CPUID_EAX_07_EBX_CLFLUSHOPT_FEATURE                          567
 
       /**
        * [Bit 24] CLWB.
        */
       uint32_t clwb                                                  : 1;
-#define CPUID_EBX_CLWB_BIT                                           24
-#define CPUID_EBX_CLWB_FLAG                                          0x1000000
-#define CPUID_EBX_CLWB_MASK                                          0x01
-#define CPUID_EBX_CLWB(_)                                            (((_) >> 24) & 0x01)
+#define CPUID_EAX_07_EBX_CLWB_BIT                                    24
+#define CPUID_EAX_07_EBX_CLWB_FLAG                                   0x1000000
+#define CPUID_EAX_07_EBX_CLWB_MASK                                   0x01
+#define CPUID_EAX_07_EBX_CLWB(_)                                     (((_) >> 24) & 0x01)
+#define CPUID_EAX_07_EBX_CLWB_FEATURE                                568
 
       /**
        * [Bit 25] Intel Processor Trace.
        */
       uint32_t intel                                                 : 1;
-#define CPUID_EBX_INTEL_BIT                                          25
-#define CPUID_EBX_INTEL_FLAG                                         0x2000000
-#define CPUID_EBX_INTEL_MASK                                         0x01
-#define CPUID_EBX_INTEL(_)                                           (((_) >> 25) & 0x01)
+#define CPUID_EAX_07_EBX_INTEL_BIT                                   25
+#define CPUID_EAX_07_EBX_INTEL_FLAG                                  0x2000000
+#define CPUID_EAX_07_EBX_INTEL_MASK                                  0x01
+#define CPUID_EAX_07_EBX_INTEL(_)                                    (((_) >> 25) & 0x01)
+#define CPUID_EAX_07_EBX_INTEL_FEATURE                               569
 
       /**
        * [Bit 26] (Intel(R) Xeon Phi(TM) only).
        */
       uint32_t avx512pf                                              : 1;
-#define CPUID_EBX_AVX512PF_BIT                                       26
-#define CPUID_EBX_AVX512PF_FLAG                                      0x4000000
-#define CPUID_EBX_AVX512PF_MASK                                      0x01
-#define CPUID_EBX_AVX512PF(_)                                        (((_) >> 26) & 0x01)
+#define CPUID_EAX_07_EBX_AVX512PF_BIT                                26
+#define CPUID_EAX_07_EBX_AVX512PF_FLAG                               0x4000000
+#define CPUID_EAX_07_EBX_AVX512PF_MASK                               0x01
+#define CPUID_EAX_07_EBX_AVX512PF(_)                                 (((_) >> 26) & 0x01)
+#define CPUID_EAX_07_EBX_AVX512PF_FEATURE                            570
 
       /**
        * [Bit 27] (Intel(R) Xeon Phi(TM) only).
        */
       uint32_t avx512er                                              : 1;
-#define CPUID_EBX_AVX512ER_BIT                                       27
-#define CPUID_EBX_AVX512ER_FLAG                                      0x8000000
-#define CPUID_EBX_AVX512ER_MASK                                      0x01
-#define CPUID_EBX_AVX512ER(_)                                        (((_) >> 27) & 0x01)
+#define CPUID_EAX_07_EBX_AVX512ER_BIT                                27
+#define CPUID_EAX_07_EBX_AVX512ER_FLAG                               0x8000000
+#define CPUID_EAX_07_EBX_AVX512ER_MASK                               0x01
+#define CPUID_EAX_07_EBX_AVX512ER(_)                                 (((_) >> 27) & 0x01)
+#define CPUID_EAX_07_EBX_AVX512ER_FEATURE                            571
 
       /**
        * [Bit 28] AVX512CD.
        */
       uint32_t avx512cd                                              : 1;
-#define CPUID_EBX_AVX512CD_BIT                                       28
-#define CPUID_EBX_AVX512CD_FLAG                                      0x10000000
-#define CPUID_EBX_AVX512CD_MASK                                      0x01
-#define CPUID_EBX_AVX512CD(_)                                        (((_) >> 28) & 0x01)
+#define CPUID_EAX_07_EBX_AVX512CD_BIT                                28
+#define CPUID_EAX_07_EBX_AVX512CD_FLAG                               0x10000000
+#define CPUID_EAX_07_EBX_AVX512CD_MASK                               0x01
+#define CPUID_EAX_07_EBX_AVX512CD(_)                                 (((_) >> 28) & 0x01)
+#define CPUID_EAX_07_EBX_AVX512CD_FEATURE                            572
 
       /**
        * [Bit 29] Supports Intel(R) Secure Hash Algorithm Extensions (Intel(R) SHA Extensions) if 1.
        */
       uint32_t sha                                                   : 1;
-#define CPUID_EBX_SHA_BIT                                            29
-#define CPUID_EBX_SHA_FLAG                                           0x20000000
-#define CPUID_EBX_SHA_MASK                                           0x01
-#define CPUID_EBX_SHA(_)                                             (((_) >> 29) & 0x01)
+#define CPUID_EAX_07_EBX_SHA_BIT                                     29
+#define CPUID_EAX_07_EBX_SHA_FLAG                                    0x20000000
+#define CPUID_EAX_07_EBX_SHA_MASK                                    0x01
+#define CPUID_EAX_07_EBX_SHA(_)                                      (((_) >> 29) & 0x01)
+#define CPUID_EAX_07_EBX_SHA_FEATURE                                 573
 
       /**
        * [Bit 30] AVX512BW.
        */
       uint32_t avx512bw                                              : 1;
-#define CPUID_EBX_AVX512BW_BIT                                       30
-#define CPUID_EBX_AVX512BW_FLAG                                      0x40000000
-#define CPUID_EBX_AVX512BW_MASK                                      0x01
-#define CPUID_EBX_AVX512BW(_)                                        (((_) >> 30) & 0x01)
+#define CPUID_EAX_07_EBX_AVX512BW_BIT                                30
+#define CPUID_EAX_07_EBX_AVX512BW_FLAG                               0x40000000
+#define CPUID_EAX_07_EBX_AVX512BW_MASK                               0x01
+#define CPUID_EAX_07_EBX_AVX512BW(_)                                 (((_) >> 30) & 0x01)
+#define CPUID_EAX_07_EBX_AVX512BW_FEATURE                            574
 
       /**
        * [Bit 31] AVX512VL.
        */
       uint32_t avx512vl                                              : 1;
-#define CPUID_EBX_AVX512VL_BIT                                       31
-#define CPUID_EBX_AVX512VL_FLAG                                      0x80000000
-#define CPUID_EBX_AVX512VL_MASK                                      0x01
-#define CPUID_EBX_AVX512VL(_)                                        (((_) >> 31) & 0x01)
+#define CPUID_EAX_07_EBX_AVX512VL_BIT                                31
+#define CPUID_EAX_07_EBX_AVX512VL_FLAG                               0x80000000
+#define CPUID_EAX_07_EBX_AVX512VL_MASK                               0x01
+#define CPUID_EAX_07_EBX_AVX512VL(_)                                 (((_) >> 31) & 0x01)
+#define CPUID_EAX_07_EBX_AVX512VL_FEATURE                            575
     };
 
     uint32_t flags;
   } ebx;
+#define CPUID_EAX_07_EBX_RESERVED_BITS                               0x400000
 
   union
   {
@@ -2904,64 +3093,71 @@ typedef struct
        * [Bit 0] (Intel(R) Xeon Phi(TM) only).
        */
       uint32_t prefetchwt1                                           : 1;
-#define CPUID_ECX_PREFETCHWT1_BIT                                    0
-#define CPUID_ECX_PREFETCHWT1_FLAG                                   0x01
-#define CPUID_ECX_PREFETCHWT1_MASK                                   0x01
-#define CPUID_ECX_PREFETCHWT1(_)                                     (((_) >> 0) & 0x01)
+#define CPUID_EAX_07_ECX_PREFETCHWT1_BIT                             0
+#define CPUID_EAX_07_ECX_PREFETCHWT1_FLAG                            0x01
+#define CPUID_EAX_07_ECX_PREFETCHWT1_MASK                            0x01
+#define CPUID_EAX_07_ECX_PREFETCHWT1(_)                              (((_) >> 0) & 0x01)
+#define CPUID_EAX_07_ECX_PREFETCHWT1_FEATURE                         576
 
       /**
        * [Bit 1] AVX512_VBMI.
        */
       uint32_t avx512_vbmi                                           : 1;
-#define CPUID_ECX_AVX512_VBMI_BIT                                    1
-#define CPUID_ECX_AVX512_VBMI_FLAG                                   0x02
-#define CPUID_ECX_AVX512_VBMI_MASK                                   0x01
-#define CPUID_ECX_AVX512_VBMI(_)                                     (((_) >> 1) & 0x01)
+#define CPUID_EAX_07_ECX_AVX512_VBMI_BIT                             1
+#define CPUID_EAX_07_ECX_AVX512_VBMI_FLAG                            0x02
+#define CPUID_EAX_07_ECX_AVX512_VBMI_MASK                            0x01
+#define CPUID_EAX_07_ECX_AVX512_VBMI(_)                              (((_) >> 1) & 0x01)
+#define CPUID_EAX_07_ECX_AVX512_VBMI_FEATURE                         577
 
       /**
        * [Bit 2] Supports user-mode instruction prevention if 1.
        */
       uint32_t umip                                                  : 1;
-#define CPUID_ECX_UMIP_BIT                                           2
-#define CPUID_ECX_UMIP_FLAG                                          0x04
-#define CPUID_ECX_UMIP_MASK                                          0x01
-#define CPUID_ECX_UMIP(_)                                            (((_) >> 2) & 0x01)
+#define CPUID_EAX_07_ECX_UMIP_BIT                                    2
+#define CPUID_EAX_07_ECX_UMIP_FLAG                                   0x04
+#define CPUID_EAX_07_ECX_UMIP_MASK                                   0x01
+#define CPUID_EAX_07_ECX_UMIP(_)                                     (((_) >> 2) & 0x01)
+#define CPUID_EAX_07_ECX_UMIP_FEATURE                                578
 
       /**
        * [Bit 3] Supports protection keys for user-mode pages if 1.
        */
       uint32_t pku                                                   : 1;
-#define CPUID_ECX_PKU_BIT                                            3
-#define CPUID_ECX_PKU_FLAG                                           0x08
-#define CPUID_ECX_PKU_MASK                                           0x01
-#define CPUID_ECX_PKU(_)                                             (((_) >> 3) & 0x01)
+#define CPUID_EAX_07_ECX_PKU_BIT                                     3
+#define CPUID_EAX_07_ECX_PKU_FLAG                                    0x08
+#define CPUID_EAX_07_ECX_PKU_MASK                                    0x01
+#define CPUID_EAX_07_ECX_PKU(_)                                      (((_) >> 3) & 0x01)
+#define CPUID_EAX_07_ECX_PKU_FEATURE                                 579
 
       /**
        * [Bit 4] If 1, OS has set CR4.PKE to enable protection keys (and the RDPKRU/WRPKRU instructions).
        */
       uint32_t ospke                                                 : 1;
-#define CPUID_ECX_OSPKE_BIT                                          4
-#define CPUID_ECX_OSPKE_FLAG                                         0x10
-#define CPUID_ECX_OSPKE_MASK                                         0x01
-#define CPUID_ECX_OSPKE(_)                                           (((_) >> 4) & 0x01)
+#define CPUID_EAX_07_ECX_OSPKE_BIT                                   4
+#define CPUID_EAX_07_ECX_OSPKE_FLAG                                  0x10
+#define CPUID_EAX_07_ECX_OSPKE_MASK                                  0x01
+#define CPUID_EAX_07_ECX_OSPKE(_)                                    (((_) >> 4) & 0x01)
+#define CPUID_EAX_07_ECX_OSPKE_FEATURE                               580
 
       /**
        * [Bit 5] WAITPKG.
        */
       uint32_t waitpkg                                               : 1;
-#define CPUID_ECX_WAITPKG_BIT                                        5
-#define CPUID_ECX_WAITPKG_FLAG                                       0x20
-#define CPUID_ECX_WAITPKG_MASK                                       0x01
-#define CPUID_ECX_WAITPKG(_)                                         (((_) >> 5) & 0x01)
+#define CPUID_EAX_07_ECX_WAITPKG_BIT                                 5
+#define CPUID_EAX_07_ECX_WAITPKG_FLAG                                0x20
+#define CPUID_EAX_07_ECX_WAITPKG_MASK                                0x01
+#define CPUID_EAX_07_ECX_WAITPKG(_)                                  (((_) >> 5) & 0x01)
+#define CPUID_EAX_07_ECX_WAITPKG_FEATURE                             581
 
       /**
        * [Bit 6] AVX512_VBMI2.
        */
       uint32_t avx512_vbmi2                                          : 1;
-#define CPUID_ECX_AVX512_VBMI2_BIT                                   6
-#define CPUID_ECX_AVX512_VBMI2_FLAG                                  0x40
-#define CPUID_ECX_AVX512_VBMI2_MASK                                  0x01
-#define CPUID_ECX_AVX512_VBMI2(_)                                    (((_) >> 6) & 0x01)
+#define CPUID_EAX_07_ECX_AVX512_VBMI2_BIT                            6
+#define CPUID_EAX_07_ECX_AVX512_VBMI2_FLAG                           0x40
+#define CPUID_EAX_07_ECX_AVX512_VBMI2_MASK                           0x01
+#define CPUID_EAX_07_ECX_AVX512_VBMI2(_)                             (((_) >> 6) & 0x01)
+#define CPUID_EAX_07_ECX_AVX512_VBMI2_FEATURE                        582
 
       /**
        * [Bit 7] Supports CET shadow stack features if 1. Processors that set this bit define bits 1:0 of the IA32_U_CET and
@@ -2969,163 +3165,180 @@ typedef struct
        * IA32_PL1_SSP, and IA32_PL0_SSP.
        */
       uint32_t cet_ss                                                : 1;
-#define CPUID_ECX_CET_SS_BIT                                         7
-#define CPUID_ECX_CET_SS_FLAG                                        0x80
-#define CPUID_ECX_CET_SS_MASK                                        0x01
-#define CPUID_ECX_CET_SS(_)                                          (((_) >> 7) & 0x01)
+#define CPUID_EAX_07_ECX_CET_SS_BIT                                  7
+#define CPUID_EAX_07_ECX_CET_SS_FLAG                                 0x80
+#define CPUID_EAX_07_ECX_CET_SS_MASK                                 0x01
+#define CPUID_EAX_07_ECX_CET_SS(_)                                   (((_) >> 7) & 0x01)
+#define CPUID_EAX_07_ECX_CET_SS_FEATURE                              583
 
       /**
        * [Bit 8] GFNI.
        */
       uint32_t gfni                                                  : 1;
-#define CPUID_ECX_GFNI_BIT                                           8
-#define CPUID_ECX_GFNI_FLAG                                          0x100
-#define CPUID_ECX_GFNI_MASK                                          0x01
-#define CPUID_ECX_GFNI(_)                                            (((_) >> 8) & 0x01)
+#define CPUID_EAX_07_ECX_GFNI_BIT                                    8
+#define CPUID_EAX_07_ECX_GFNI_FLAG                                   0x100
+#define CPUID_EAX_07_ECX_GFNI_MASK                                   0x01
+#define CPUID_EAX_07_ECX_GFNI(_)                                     (((_) >> 8) & 0x01)
+#define CPUID_EAX_07_ECX_GFNI_FEATURE                                584
 
       /**
        * [Bit 9] VAES.
        */
       uint32_t vaes                                                  : 1;
-#define CPUID_ECX_VAES_BIT                                           9
-#define CPUID_ECX_VAES_FLAG                                          0x200
-#define CPUID_ECX_VAES_MASK                                          0x01
-#define CPUID_ECX_VAES(_)                                            (((_) >> 9) & 0x01)
+#define CPUID_EAX_07_ECX_VAES_BIT                                    9
+#define CPUID_EAX_07_ECX_VAES_FLAG                                   0x200
+#define CPUID_EAX_07_ECX_VAES_MASK                                   0x01
+#define CPUID_EAX_07_ECX_VAES(_)                                     (((_) >> 9) & 0x01)
+#define CPUID_EAX_07_ECX_VAES_FEATURE                                585
 
       /**
        * [Bit 10] VPCLMULQDQ.
        */
       uint32_t vpclmulqdq                                            : 1;
-#define CPUID_ECX_VPCLMULQDQ_BIT                                     10
-#define CPUID_ECX_VPCLMULQDQ_FLAG                                    0x400
-#define CPUID_ECX_VPCLMULQDQ_MASK                                    0x01
-#define CPUID_ECX_VPCLMULQDQ(_)                                      (((_) >> 10) & 0x01)
+#define CPUID_EAX_07_ECX_VPCLMULQDQ_BIT                              10
+#define CPUID_EAX_07_ECX_VPCLMULQDQ_FLAG                             0x400
+#define CPUID_EAX_07_ECX_VPCLMULQDQ_MASK                             0x01
+#define CPUID_EAX_07_ECX_VPCLMULQDQ(_)                               (((_) >> 10) & 0x01)
+#define CPUID_EAX_07_ECX_VPCLMULQDQ_FEATURE                          586
 
       /**
        * [Bit 11] AVX512_VNNI.
        */
       uint32_t avx512_vnni                                           : 1;
-#define CPUID_ECX_AVX512_VNNI_BIT                                    11
-#define CPUID_ECX_AVX512_VNNI_FLAG                                   0x800
-#define CPUID_ECX_AVX512_VNNI_MASK                                   0x01
-#define CPUID_ECX_AVX512_VNNI(_)                                     (((_) >> 11) & 0x01)
+#define CPUID_EAX_07_ECX_AVX512_VNNI_BIT                             11
+#define CPUID_EAX_07_ECX_AVX512_VNNI_FLAG                            0x800
+#define CPUID_EAX_07_ECX_AVX512_VNNI_MASK                            0x01
+#define CPUID_EAX_07_ECX_AVX512_VNNI(_)                              (((_) >> 11) & 0x01)
+#define CPUID_EAX_07_ECX_AVX512_VNNI_FEATURE                         587
 
       /**
        * [Bit 12] AVX512_BITALG.
        */
       uint32_t avx512_bitalg                                         : 1;
-#define CPUID_ECX_AVX512_BITALG_BIT                                  12
-#define CPUID_ECX_AVX512_BITALG_FLAG                                 0x1000
-#define CPUID_ECX_AVX512_BITALG_MASK                                 0x01
-#define CPUID_ECX_AVX512_BITALG(_)                                   (((_) >> 12) & 0x01)
+#define CPUID_EAX_07_ECX_AVX512_BITALG_BIT                           12
+#define CPUID_EAX_07_ECX_AVX512_BITALG_FLAG                          0x1000
+#define CPUID_EAX_07_ECX_AVX512_BITALG_MASK                          0x01
+#define CPUID_EAX_07_ECX_AVX512_BITALG(_)                            (((_) >> 12) & 0x01)
+#define CPUID_EAX_07_ECX_AVX512_BITALG_FEATURE                       588
 
       /**
        * [Bit 13] If 1, the following MSRs are supported: IA32_TME_CAPABILITY, IA32_TME_ACTIVATE, IA32_TME_EXCLUDE_MASK, and
        * IA32_TME_EXCLUDE_BASE.
        */
       uint32_t tme_en                                                : 1;
-#define CPUID_ECX_TME_EN_BIT                                         13
-#define CPUID_ECX_TME_EN_FLAG                                        0x2000
-#define CPUID_ECX_TME_EN_MASK                                        0x01
-#define CPUID_ECX_TME_EN(_)                                          (((_) >> 13) & 0x01)
+#define CPUID_EAX_07_ECX_TME_EN_BIT                                  13
+#define CPUID_EAX_07_ECX_TME_EN_FLAG                                 0x2000
+#define CPUID_EAX_07_ECX_TME_EN_MASK                                 0x01
+#define CPUID_EAX_07_ECX_TME_EN(_)                                   (((_) >> 13) & 0x01)
+#define CPUID_EAX_07_ECX_TME_EN_FEATURE                              589
 
       /**
        * [Bit 14] AVX512_VPOPCNTDQ.
        */
       uint32_t avx512_vpopcntdq                                      : 1;
-#define CPUID_ECX_AVX512_VPOPCNTDQ_BIT                               14
-#define CPUID_ECX_AVX512_VPOPCNTDQ_FLAG                              0x4000
-#define CPUID_ECX_AVX512_VPOPCNTDQ_MASK                              0x01
-#define CPUID_ECX_AVX512_VPOPCNTDQ(_)                                (((_) >> 14) & 0x01)
+#define CPUID_EAX_07_ECX_AVX512_VPOPCNTDQ_BIT                        14
+#define CPUID_EAX_07_ECX_AVX512_VPOPCNTDQ_FLAG                       0x4000
+#define CPUID_EAX_07_ECX_AVX512_VPOPCNTDQ_MASK                       0x01
+#define CPUID_EAX_07_ECX_AVX512_VPOPCNTDQ(_)                         (((_) >> 14) & 0x01)
+#define CPUID_EAX_07_ECX_AVX512_VPOPCNTDQ_FEATURE                    590
       uint32_t reserved1                                             : 1;
 
       /**
        * [Bit 16] Supports 57-bit linear addresses and five-level paging if 1.
        */
       uint32_t la57                                                  : 1;
-#define CPUID_ECX_LA57_BIT                                           16
-#define CPUID_ECX_LA57_FLAG                                          0x10000
-#define CPUID_ECX_LA57_MASK                                          0x01
-#define CPUID_ECX_LA57(_)                                            (((_) >> 16) & 0x01)
+#define CPUID_EAX_07_ECX_LA57_BIT                                    16
+#define CPUID_EAX_07_ECX_LA57_FLAG                                   0x10000
+#define CPUID_EAX_07_ECX_LA57_MASK                                   0x01
+#define CPUID_EAX_07_ECX_LA57(_)                                     (((_) >> 16) & 0x01)
+#define CPUID_EAX_07_ECX_LA57_FEATURE                                592
 
       /**
        * [Bits 21:17] The value of MAWAU used by the BNDLDX and BNDSTX instructions in 64-bit mode.
        */
       uint32_t mawau                                                 : 5;
-#define CPUID_ECX_MAWAU_BIT                                          17
-#define CPUID_ECX_MAWAU_FLAG                                         0x3E0000
-#define CPUID_ECX_MAWAU_MASK                                         0x1F
-#define CPUID_ECX_MAWAU(_)                                           (((_) >> 17) & 0x1F)
+#define CPUID_EAX_07_ECX_MAWAU_BIT                                   17
+#define CPUID_EAX_07_ECX_MAWAU_FLAG                                  0x3E0000
+#define CPUID_EAX_07_ECX_MAWAU_MASK                                  0x1F
+#define CPUID_EAX_07_ECX_MAWAU(_)                                    (((_) >> 17) & 0x1F)
 
       /**
        * [Bit 22] RDPID and IA32_TSC_AUX are available if 1.
        */
       uint32_t rdpid                                                 : 1;
-#define CPUID_ECX_RDPID_BIT                                          22
-#define CPUID_ECX_RDPID_FLAG                                         0x400000
-#define CPUID_ECX_RDPID_MASK                                         0x01
-#define CPUID_ECX_RDPID(_)                                           (((_) >> 22) & 0x01)
+#define CPUID_EAX_07_ECX_RDPID_BIT                                   22
+#define CPUID_EAX_07_ECX_RDPID_FLAG                                  0x400000
+#define CPUID_EAX_07_ECX_RDPID_MASK                                  0x01
+#define CPUID_EAX_07_ECX_RDPID(_)                                    (((_) >> 22) & 0x01)
+#define CPUID_EAX_07_ECX_RDPID_FEATURE                               598
 
       /**
        * [Bit 23] KL. Supports Key Locker if 1.
        */
       uint32_t kl                                                    : 1;
-#define CPUID_ECX_KL_BIT                                             23
-#define CPUID_ECX_KL_FLAG                                            0x800000
-#define CPUID_ECX_KL_MASK                                            0x01
-#define CPUID_ECX_KL(_)                                              (((_) >> 23) & 0x01)
+#define CPUID_EAX_07_ECX_KL_BIT                                      23
+#define CPUID_EAX_07_ECX_KL_FLAG                                     0x800000
+#define CPUID_EAX_07_ECX_KL_MASK                                     0x01
+#define CPUID_EAX_07_ECX_KL(_)                                       (((_) >> 23) & 0x01)
+#define CPUID_EAX_07_ECX_KL_FEATURE                                  599
       uint32_t reserved2                                             : 1;
 
       /**
        * [Bit 25] Supports cache line demote if 1.
        */
       uint32_t cldemote                                              : 1;
-#define CPUID_ECX_CLDEMOTE_BIT                                       25
-#define CPUID_ECX_CLDEMOTE_FLAG                                      0x2000000
-#define CPUID_ECX_CLDEMOTE_MASK                                      0x01
-#define CPUID_ECX_CLDEMOTE(_)                                        (((_) >> 25) & 0x01)
+#define CPUID_EAX_07_ECX_CLDEMOTE_BIT                                25
+#define CPUID_EAX_07_ECX_CLDEMOTE_FLAG                               0x2000000
+#define CPUID_EAX_07_ECX_CLDEMOTE_MASK                               0x01
+#define CPUID_EAX_07_ECX_CLDEMOTE(_)                                 (((_) >> 25) & 0x01)
+#define CPUID_EAX_07_ECX_CLDEMOTE_FEATURE                            601
       uint32_t reserved3                                             : 1;
 
       /**
        * [Bit 27] Supports MOVDIRI if 1.
        */
       uint32_t movdiri                                               : 1;
-#define CPUID_ECX_MOVDIRI_BIT                                        27
-#define CPUID_ECX_MOVDIRI_FLAG                                       0x8000000
-#define CPUID_ECX_MOVDIRI_MASK                                       0x01
-#define CPUID_ECX_MOVDIRI(_)                                         (((_) >> 27) & 0x01)
+#define CPUID_EAX_07_ECX_MOVDIRI_BIT                                 27
+#define CPUID_EAX_07_ECX_MOVDIRI_FLAG                                0x8000000
+#define CPUID_EAX_07_ECX_MOVDIRI_MASK                                0x01
+#define CPUID_EAX_07_ECX_MOVDIRI(_)                                  (((_) >> 27) & 0x01)
+#define CPUID_EAX_07_ECX_MOVDIRI_FEATURE                             603
 
       /**
        * [Bit 28] Supports MOVDIR64B if 1.
        */
       uint32_t movdir64b                                             : 1;
-#define CPUID_ECX_MOVDIR64B_BIT                                      28
-#define CPUID_ECX_MOVDIR64B_FLAG                                     0x10000000
-#define CPUID_ECX_MOVDIR64B_MASK                                     0x01
-#define CPUID_ECX_MOVDIR64B(_)                                       (((_) >> 28) & 0x01)
+#define CPUID_EAX_07_ECX_MOVDIR64B_BIT                               28
+#define CPUID_EAX_07_ECX_MOVDIR64B_FLAG                              0x10000000
+#define CPUID_EAX_07_ECX_MOVDIR64B_MASK                              0x01
+#define CPUID_EAX_07_ECX_MOVDIR64B(_)                                (((_) >> 28) & 0x01)
+#define CPUID_EAX_07_ECX_MOVDIR64B_FEATURE                           604
       uint32_t reserved4                                             : 1;
 
       /**
        * [Bit 30] Supports SGX Launch Configuration if 1.
        */
       uint32_t sgx_lc                                                : 1;
-#define CPUID_ECX_SGX_LC_BIT                                         30
-#define CPUID_ECX_SGX_LC_FLAG                                        0x40000000
-#define CPUID_ECX_SGX_LC_MASK                                        0x01
-#define CPUID_ECX_SGX_LC(_)                                          (((_) >> 30) & 0x01)
+#define CPUID_EAX_07_ECX_SGX_LC_BIT                                  30
+#define CPUID_EAX_07_ECX_SGX_LC_FLAG                                 0x40000000
+#define CPUID_EAX_07_ECX_SGX_LC_MASK                                 0x01
+#define CPUID_EAX_07_ECX_SGX_LC(_)                                   (((_) >> 30) & 0x01)
+#define CPUID_EAX_07_ECX_SGX_LC_FEATURE                              606
 
       /**
        * [Bit 31] Supports protection keys for supervisor-mode pages if 1.
        */
       uint32_t pks                                                   : 1;
-#define CPUID_ECX_PKS_BIT                                            31
-#define CPUID_ECX_PKS_FLAG                                           0x80000000
-#define CPUID_ECX_PKS_MASK                                           0x01
-#define CPUID_ECX_PKS(_)                                             (((_) >> 31) & 0x01)
+#define CPUID_EAX_07_ECX_PKS_BIT                                     31
+#define CPUID_EAX_07_ECX_PKS_FLAG                                    0x80000000
+#define CPUID_EAX_07_ECX_PKS_MASK                                    0x01
+#define CPUID_EAX_07_ECX_PKS(_)                                      (((_) >> 31) & 0x01)
+#define CPUID_EAX_07_ECX_PKS_FEATURE                                 607
     };
 
     uint32_t flags;
   } ecx;
+#define CPUID_EAX_07_ECX_RESERVED_BITS                               0x25008000
 
   union
   {
@@ -3137,77 +3350,85 @@ typedef struct
        * [Bit 2] (Intel(R) Xeon Phi(TM) only.)
        */
       uint32_t avx512_4vnniw                                         : 1;
-#define CPUID_EDX_AVX512_4VNNIW_BIT                                  2
-#define CPUID_EDX_AVX512_4VNNIW_FLAG                                 0x04
-#define CPUID_EDX_AVX512_4VNNIW_MASK                                 0x01
-#define CPUID_EDX_AVX512_4VNNIW(_)                                   (((_) >> 2) & 0x01)
+#define CPUID_EAX_07_EDX_AVX512_4VNNIW_BIT                           2
+#define CPUID_EAX_07_EDX_AVX512_4VNNIW_FLAG                          0x04
+#define CPUID_EAX_07_EDX_AVX512_4VNNIW_MASK                          0x01
+#define CPUID_EAX_07_EDX_AVX512_4VNNIW(_)                            (((_) >> 2) & 0x01)
+#define CPUID_EAX_07_EDX_AVX512_4VNNIW_FEATURE                       610
 
       /**
        * [Bit 3] (Intel(R) Xeon Phi(TM) only.)
        */
       uint32_t avx512_4fmaps                                         : 1;
-#define CPUID_EDX_AVX512_4FMAPS_BIT                                  3
-#define CPUID_EDX_AVX512_4FMAPS_FLAG                                 0x08
-#define CPUID_EDX_AVX512_4FMAPS_MASK                                 0x01
-#define CPUID_EDX_AVX512_4FMAPS(_)                                   (((_) >> 3) & 0x01)
+#define CPUID_EAX_07_EDX_AVX512_4FMAPS_BIT                           3
+#define CPUID_EAX_07_EDX_AVX512_4FMAPS_FLAG                          0x08
+#define CPUID_EAX_07_EDX_AVX512_4FMAPS_MASK                          0x01
+#define CPUID_EAX_07_EDX_AVX512_4FMAPS(_)                            (((_) >> 3) & 0x01)
+#define CPUID_EAX_07_EDX_AVX512_4FMAPS_FEATURE                       611
 
       /**
        * [Bit 4] Fast Short REP MOV.
        */
       uint32_t fast_short_rep_mov                                    : 1;
-#define CPUID_EDX_FAST_SHORT_REP_MOV_BIT                             4
-#define CPUID_EDX_FAST_SHORT_REP_MOV_FLAG                            0x10
-#define CPUID_EDX_FAST_SHORT_REP_MOV_MASK                            0x01
-#define CPUID_EDX_FAST_SHORT_REP_MOV(_)                              (((_) >> 4) & 0x01)
+#define CPUID_EAX_07_EDX_FAST_SHORT_REP_MOV_BIT                      4
+#define CPUID_EAX_07_EDX_FAST_SHORT_REP_MOV_FLAG                     0x10
+#define CPUID_EAX_07_EDX_FAST_SHORT_REP_MOV_MASK                     0x01
+#define CPUID_EAX_07_EDX_FAST_SHORT_REP_MOV(_)                       (((_) >> 4) & 0x01)
+#define CPUID_EAX_07_EDX_FAST_SHORT_REP_MOV_FEATURE                  612
       uint32_t reserved2                                             : 3;
 
       /**
        * [Bit 8] AVX512_VP2INTERSECT.
        */
       uint32_t avx512_vp2intersect                                   : 1;
-#define CPUID_EDX_AVX512_VP2INTERSECT_BIT                            8
-#define CPUID_EDX_AVX512_VP2INTERSECT_FLAG                           0x100
-#define CPUID_EDX_AVX512_VP2INTERSECT_MASK                           0x01
-#define CPUID_EDX_AVX512_VP2INTERSECT(_)                             (((_) >> 8) & 0x01)
+#define CPUID_EAX_07_EDX_AVX512_VP2INTERSECT_BIT                     8
+#define CPUID_EAX_07_EDX_AVX512_VP2INTERSECT_FLAG                    0x100
+#define CPUID_EAX_07_EDX_AVX512_VP2INTERSECT_MASK                    0x01
+#define CPUID_EAX_07_EDX_AVX512_VP2INTERSECT(_)                      (((_) >> 8) & 0x01)
+#define CPUID_EAX_07_EDX_AVX512_VP2INTERSECT_FEATURE                 616
       uint32_t reserved3                                             : 1;
 
       /**
        * [Bit 10] MD_CLEAR supported.
        */
       uint32_t md_clear                                              : 1;
-#define CPUID_EDX_MD_CLEAR_BIT                                       10
-#define CPUID_EDX_MD_CLEAR_FLAG                                      0x400
-#define CPUID_EDX_MD_CLEAR_MASK                                      0x01
-#define CPUID_EDX_MD_CLEAR(_)                                        (((_) >> 10) & 0x01)
+#define CPUID_EAX_07_EDX_MD_CLEAR_BIT                                10
+#define CPUID_EAX_07_EDX_MD_CLEAR_FLAG                               0x400
+#define CPUID_EAX_07_EDX_MD_CLEAR_MASK                               0x01
+#define CPUID_EAX_07_EDX_MD_CLEAR(_)                                 (((_) >> 10) & 0x01)
+#define CPUID_EAX_07_EDX_MD_CLEAR_FEATURE                            618
       uint32_t reserved4                                             : 3;
 
       /**
        * [Bit 14] SERIALIZE supported.
        */
       uint32_t serialize                                             : 1;
-#define CPUID_EDX_SERIALIZE_BIT                                      14
-#define CPUID_EDX_SERIALIZE_FLAG                                     0x4000
-#define CPUID_EDX_SERIALIZE_MASK                                     0x01
-#define CPUID_EDX_SERIALIZE(_)                                       (((_) >> 14) & 0x01)
+#define CPUID_EAX_07_EDX_SERIALIZE_BIT                               14
+#define CPUID_EAX_07_EDX_SERIALIZE_FLAG                              0x4000
+#define CPUID_EAX_07_EDX_SERIALIZE_MASK                              0x01
+#define CPUID_EAX_07_EDX_SERIALIZE(_)                                (((_) >> 14) & 0x01)
+#define CPUID_EAX_07_EDX_SERIALIZE_FEATURE                           622
 
       /**
        * [Bit 15] If 1, the processor is identified as a hybrid part.
        */
       uint32_t hybrid                                                : 1;
-#define CPUID_EDX_HYBRID_BIT                                         15
-#define CPUID_EDX_HYBRID_FLAG                                        0x8000
-#define CPUID_EDX_HYBRID_MASK                                        0x01
-#define CPUID_EDX_HYBRID(_)                                          (((_) >> 15) & 0x01)
+#define CPUID_EAX_07_EDX_HYBRID_BIT                                  15
+#define CPUID_EAX_07_EDX_HYBRID_FLAG                                 0x8000
+#define CPUID_EAX_07_EDX_HYBRID_MASK                                 0x01
+#define CPUID_EAX_07_EDX_HYBRID(_)                                   (((_) >> 15) & 0x01)
+#define CPUID_EAX_07_EDX_HYBRID_FEATURE                              623
       uint32_t reserved5                                             : 2;
 
       /**
        * [Bit 18] Supports PCONFIG if 1.
        */
       uint32_t pconfig                                               : 1;
-#define CPUID_EDX_PCONFIG_BIT                                        18
-#define CPUID_EDX_PCONFIG_FLAG                                       0x40000
-#define CPUID_EDX_PCONFIG_MASK                                       0x01
-#define CPUID_EDX_PCONFIG(_)                                         (((_) >> 18) & 0x01)
+#define CPUID_EAX_07_EDX_PCONFIG_BIT                                 18
+#define CPUID_EAX_07_EDX_PCONFIG_FLAG                                0x40000
+#define CPUID_EAX_07_EDX_PCONFIG_MASK                                0x01
+#define CPUID_EAX_07_EDX_PCONFIG(_)                                  (((_) >> 18) & 0x01)
+#define CPUID_EAX_07_EDX_PCONFIG_FEATURE                             626
       uint32_t reserved6                                             : 1;
 
       /**
@@ -3215,10 +3436,11 @@ typedef struct
        * 63:10 of the IA32_U_CET and IA32_S_CET MSRs.
        */
       uint32_t cet_ibt                                               : 1;
-#define CPUID_EDX_CET_IBT_BIT                                        20
-#define CPUID_EDX_CET_IBT_FLAG                                       0x100000
-#define CPUID_EDX_CET_IBT_MASK                                       0x01
-#define CPUID_EDX_CET_IBT(_)                                         (((_) >> 20) & 0x01)
+#define CPUID_EAX_07_EDX_CET_IBT_BIT                                 20
+#define CPUID_EAX_07_EDX_CET_IBT_FLAG                                0x100000
+#define CPUID_EAX_07_EDX_CET_IBT_MASK                                0x01
+#define CPUID_EAX_07_EDX_CET_IBT(_)                                  (((_) >> 20) & 0x01)
+#define CPUID_EAX_07_EDX_CET_IBT_FEATURE                             628
       uint32_t reserved7                                             : 5;
 
       /**
@@ -3227,64 +3449,80 @@ typedef struct
        * set IA32_SPEC_CTRL[0] (IBRS) and IA32_PRED_CMD[0] (IBPB).
        */
       uint32_t ibrs_ibpb                                             : 1;
-#define CPUID_EDX_IBRS_IBPB_BIT                                      26
-#define CPUID_EDX_IBRS_IBPB_FLAG                                     0x4000000
-#define CPUID_EDX_IBRS_IBPB_MASK                                     0x01
-#define CPUID_EDX_IBRS_IBPB(_)                                       (((_) >> 26) & 0x01)
+#define CPUID_EAX_07_EDX_IBRS_IBPB_BIT                               26
+#define CPUID_EAX_07_EDX_IBRS_IBPB_FLAG                              0x4000000
+#define CPUID_EAX_07_EDX_IBRS_IBPB_MASK                              0x01
+#define CPUID_EAX_07_EDX_IBRS_IBPB(_)                                (((_) >> 26) & 0x01)
+#define CPUID_EAX_07_EDX_IBRS_IBPB_FEATURE                           634
 
       /**
        * [Bit 27] Enumerates support for single thread indirect branch predictors (STIBP). Processors that set this bit support
        * the IA32_SPEC_CTRL MSR. They allow software to set IA32_SPEC_CTRL[1] (STIBP).
        */
       uint32_t stibp                                                 : 1;
-#define CPUID_EDX_STIBP_BIT                                          27
-#define CPUID_EDX_STIBP_FLAG                                         0x8000000
-#define CPUID_EDX_STIBP_MASK                                         0x01
-#define CPUID_EDX_STIBP(_)                                           (((_) >> 27) & 0x01)
+#define CPUID_EAX_07_EDX_STIBP_BIT                                   27
+#define CPUID_EAX_07_EDX_STIBP_FLAG                                  0x8000000
+#define CPUID_EAX_07_EDX_STIBP_MASK                                  0x01
+#define CPUID_EAX_07_EDX_STIBP(_)                                    (((_) >> 27) & 0x01)
+#define CPUID_EAX_07_EDX_STIBP_FEATURE                               635
 
       /**
        * [Bit 28] Enumerates support for L1D_FLUSH. Processors that set this bit support the IA32_FLUSH_CMD MSR. They allow
        * software to set IA32_FLUSH_CMD[0] (L1D_FLUSH).
        */
       uint32_t l1d_flush                                             : 1;
-#define CPUID_EDX_L1D_FLUSH_BIT                                      28
-#define CPUID_EDX_L1D_FLUSH_FLAG                                     0x10000000
-#define CPUID_EDX_L1D_FLUSH_MASK                                     0x01
-#define CPUID_EDX_L1D_FLUSH(_)                                       (((_) >> 28) & 0x01)
+#define CPUID_EAX_07_EDX_L1D_FLUSH_BIT                               28
+#define CPUID_EAX_07_EDX_L1D_FLUSH_FLAG                              0x10000000
+#define CPUID_EAX_07_EDX_L1D_FLUSH_MASK                              0x01
+#define CPUID_EAX_07_EDX_L1D_FLUSH(_)                                (((_) >> 28) & 0x01)
+#define CPUID_EAX_07_EDX_L1D_FLUSH_FEATURE                           636
 
       /**
        * [Bit 29] Enumerates support for the IA32_ARCH_CAPABILITIES MSR.
        */
       uint32_t ia32_arch_capabilities                                : 1;
-#define CPUID_EDX_IA32_ARCH_CAPABILITIES_BIT                         29
-#define CPUID_EDX_IA32_ARCH_CAPABILITIES_FLAG                        0x20000000
-#define CPUID_EDX_IA32_ARCH_CAPABILITIES_MASK                        0x01
-#define CPUID_EDX_IA32_ARCH_CAPABILITIES(_)                          (((_) >> 29) & 0x01)
+#define CPUID_EAX_07_EDX_IA32_ARCH_CAPABILITIES_BIT                  29
+#define CPUID_EAX_07_EDX_IA32_ARCH_CAPABILITIES_FLAG                 0x20000000
+#define CPUID_EAX_07_EDX_IA32_ARCH_CAPABILITIES_MASK                 0x01
+#define CPUID_EAX_07_EDX_IA32_ARCH_CAPABILITIES(_)                   (((_) >> 29) & 0x01)
+#define CPUID_EAX_07_EDX_IA32_ARCH_CAPABILITIES_FEATURE              637
 
       /**
        * [Bit 30] Enumerates support for the IA32_CORE_CAPABILITIES MSR.
        */
       uint32_t ia32_core_capabilities                                : 1;
-#define CPUID_EDX_IA32_CORE_CAPABILITIES_BIT                         30
-#define CPUID_EDX_IA32_CORE_CAPABILITIES_FLAG                        0x40000000
-#define CPUID_EDX_IA32_CORE_CAPABILITIES_MASK                        0x01
-#define CPUID_EDX_IA32_CORE_CAPABILITIES(_)                          (((_) >> 30) & 0x01)
+#define CPUID_EAX_07_EDX_IA32_CORE_CAPABILITIES_BIT                  30
+#define CPUID_EAX_07_EDX_IA32_CORE_CAPABILITIES_FLAG                 0x40000000
+#define CPUID_EAX_07_EDX_IA32_CORE_CAPABILITIES_MASK                 0x01
+#define CPUID_EAX_07_EDX_IA32_CORE_CAPABILITIES(_)                   (((_) >> 30) & 0x01)
+#define CPUID_EAX_07_EDX_IA32_CORE_CAPABILITIES_FEATURE              638
 
       /**
        * [Bit 31] Enumerates support for Speculative Store Bypass Disable (SSBD). Processors that set this bit support the
        * IA32_SPEC_CTRL MSR. They allow software to set IA32_SPEC_CTRL[2] (SSBD).
        */
       uint32_t ssbd                                                  : 1;
-#define CPUID_EDX_SSBD_BIT                                           31
-#define CPUID_EDX_SSBD_FLAG                                          0x80000000
-#define CPUID_EDX_SSBD_MASK                                          0x01
-#define CPUID_EDX_SSBD(_)                                            (((_) >> 31) & 0x01)
+#define CPUID_EAX_07_EDX_SSBD_BIT                                    31
+#define CPUID_EAX_07_EDX_SSBD_FLAG                                   0x80000000
+#define CPUID_EAX_07_EDX_SSBD_MASK                                   0x01
+#define CPUID_EAX_07_EDX_SSBD(_)                                     (((_) >> 31) & 0x01)
+#define CPUID_EAX_07_EDX_SSBD_FEATURE                                639
     };
 
     uint32_t flags;
   } edx;
+#define CPUID_EAX_07_EDX_RESERVED_BITS                               0x3EB3AE3
 
 } cpuid_eax_07;
+#define CPUID_EAX_07_SNAPSHOT_INDEX                                  4
+#define CPUID_EAX_07_EAX_POLICY_AND                                  0xFFFFFFFF
+#define CPUID_EAX_07_EAX_POLICY_OR                                   0x00000000
+#define CPUID_EAX_07_EBX_POLICY_AND                                  0xFFBFFFFB
+#define CPUID_EAX_07_EBX_POLICY_OR                                   0x00000000
+#define CPUID_EAX_07_ECX_POLICY_AND                                  0x9AFF7FFF
+#define CPUID_EAX_07_ECX_POLICY_OR                                   0x00000000
+#define CPUID_EAX_07_EDX_POLICY_AND                                  0xFC14C51C
+#define CPUID_EAX_07_EDX_POLICY_OR                                   0x00000000
 
 /**
  * @brief Structured Extended Feature Flags Sub-Leaf 1
@@ -3299,192 +3537,213 @@ typedef struct
        * [Bit 0] If 1, supports the SHA512 instructions.
        */
       uint32_t sha512                                                : 1;
-#define CPUID_EAX_SHA512_BIT                                         0
-#define CPUID_EAX_SHA512_FLAG                                        0x01
-#define CPUID_EAX_SHA512_MASK                                        0x01
-#define CPUID_EAX_SHA512(_)                                          (((_) >> 0) & 0x01)
+#define CPUID_EAX_07_ECX_01_EAX_SHA512_BIT                           0
+#define CPUID_EAX_07_ECX_01_EAX_SHA512_FLAG                          0x01
+#define CPUID_EAX_07_ECX_01_EAX_SHA512_MASK                          0x01
+#define CPUID_EAX_07_ECX_01_EAX_SHA512(_)                            (((_) >> 0) & 0x01)
+#define CPUID_EAX_07_ECX_01_EAX_SHA512_FEATURE                       640
 
       /**
        * [Bit 1] If 1, supports the SM3 instructions.
        */
       uint32_t sm3                                                   : 1;
-#define CPUID_EAX_SM3_BIT                                            1
-#define CPUID_EAX_SM3_FLAG                                           0x02
-#define CPUID_EAX_SM3_MASK                                           0x01
-#define CPUID_EAX_SM3(_)                                             (((_) >> 1) & 0x01)
+#define CPUID_EAX_07_ECX_01_EAX_SM3_BIT                              1
+#define CPUID_EAX_07_ECX_01_EAX_SM3_FLAG                             0x02
+#define CPUID_EAX_07_ECX_01_EAX_SM3_MASK                             0x01
+#define CPUID_EAX_07_ECX_01_EAX_SM3(_)                               (((_) >> 1) & 0x01)
+#define CPUID_EAX_07_ECX_01_EAX_SM3_FEATURE                          641
 
       /**
        * [Bit 2] If 1, supports the SM4 instructions.
        */
       uint32_t sm4                                                   : 1;
-#define CPUID_EAX_SM4_BIT                                            2
-#define CPUID_EAX_SM4_FLAG                                           0x04
-#define CPUID_EAX_SM4_MASK                                           0x01
-#define CPUID_EAX_SM4(_)                                             (((_) >> 2) & 0x01)
+#define CPUID_EAX_07_ECX_01_EAX_SM4_BIT                              2
+#define CPUID_EAX_07_ECX_01_EAX_SM4_FLAG                             0x04
+#define CPUID_EAX_07_ECX_01_EAX_SM4_MASK                             0x01
+#define CPUID_EAX_07_ECX_01_EAX_SM4(_)                               (((_) >> 2) & 0x01)
+#define CPUID_EAX_07_ECX_01_EAX_SM4_FEATURE                          642
       uint32_t reserved1                                             : 1;
 
       /**
        * [Bit 4] If 1, supports the VEX-encoded versions of the Vector Neural Network Instructions.
        */
       uint32_t avx_vnni                                              : 1;
-#define CPUID_EAX_AVX_VNNI_BIT                                       4
-#define CPUID_EAX_AVX_VNNI_FLAG                                      0x10
-#define CPUID_EAX_AVX_VNNI_MASK                                      0x01
-#define CPUID_EAX_AVX_VNNI(_)                                        (((_) >> 4) & 0x01)
+#define CPUID_EAX_07_ECX_01_EAX_AVX_VNNI_BIT                         4
+#define CPUID_EAX_07_ECX_01_EAX_AVX_VNNI_FLAG                        0x10
+#define CPUID_EAX_07_ECX_01_EAX_AVX_VNNI_MASK                        0x01
+#define CPUID_EAX_07_ECX_01_EAX_AVX_VNNI(_)                          (((_) >> 4) & 0x01)
+#define CPUID_EAX_07_ECX_01_EAX_AVX_VNNI_FEATURE                     644
 
       /**
        * [Bit 5] If 1, supports BFLOAT16 vector neural network instructions.
        */
       uint32_t avx512_bf16                                           : 1;
-#define CPUID_EAX_AVX512_BF16_BIT                                    5
-#define CPUID_EAX_AVX512_BF16_FLAG                                   0x20
-#define CPUID_EAX_AVX512_BF16_MASK                                   0x01
-#define CPUID_EAX_AVX512_BF16(_)                                     (((_) >> 5) & 0x01)
+#define CPUID_EAX_07_ECX_01_EAX_AVX512_BF16_BIT                      5
+#define CPUID_EAX_07_ECX_01_EAX_AVX512_BF16_FLAG                     0x20
+#define CPUID_EAX_07_ECX_01_EAX_AVX512_BF16_MASK                     0x01
+#define CPUID_EAX_07_ECX_01_EAX_AVX512_BF16(_)                       (((_) >> 5) & 0x01)
+#define CPUID_EAX_07_ECX_01_EAX_AVX512_BF16_FEATURE                  645
 
       /**
        * [Bit 6] If 1, supports Linear Address Space Separation.
        */
       uint32_t lass                                                  : 1;
-#define CPUID_EAX_LASS_BIT                                           6
-#define CPUID_EAX_LASS_FLAG                                          0x40
-#define CPUID_EAX_LASS_MASK                                          0x01
-#define CPUID_EAX_LASS(_)                                            (((_) >> 6) & 0x01)
+#define CPUID_EAX_07_ECX_01_EAX_LASS_BIT                             6
+#define CPUID_EAX_07_ECX_01_EAX_LASS_FLAG                            0x40
+#define CPUID_EAX_07_ECX_01_EAX_LASS_MASK                            0x01
+#define CPUID_EAX_07_ECX_01_EAX_LASS(_)                              (((_) >> 6) & 0x01)
+#define CPUID_EAX_07_ECX_01_EAX_LASS_FEATURE                         646
 
       /**
        * [Bit 7] If 1, supports the CMPCCXADD instruction.
        */
       uint32_t cmpccxadd                                             : 1;
-#define CPUID_EAX_CMPCCXADD_BIT                                      7
-#define CPUID_EAX_CMPCCXADD_FLAG                                     0x80
-#define CPUID_EAX_CMPCCXADD_MASK                                     0x01
-#define CPUID_EAX_CMPCCXADD(_)                                       (((_) >> 7) & 0x01)
+#define CPUID_EAX_07_ECX_01_EAX_CMPCCXADD_BIT                        7
+#define CPUID_EAX_07_ECX_01_EAX_CMPCCXADD_FLAG                       0x80
+#define CPUID_EAX_07_ECX_01_EAX_CMPCCXADD_MASK                       0x01
+#define CPUID_EAX_07_ECX_01_EAX_CMPCCXADD(_)                         (((_) >> 7) & 0x01)
+#define CPUID_EAX_07_ECX_01_EAX_CMPCCXADD_FEATURE                    647
 
       /**
        * [Bit 8] If 1, indicates Architectural Performance Monitoring Extended Leaf is valid.
        */
       uint32_t arch_perfmon_ext                                      : 1;
-#define CPUID_EAX_ARCH_PERFMON_EXT_BIT                               8
-#define CPUID_EAX_ARCH_PERFMON_EXT_FLAG                              0x100
-#define CPUID_EAX_ARCH_PERFMON_EXT_MASK                              0x01
-#define CPUID_EAX_ARCH_PERFMON_EXT(_)                                (((_) >> 8) & 0x01)
+#define CPUID_EAX_07_ECX_01_EAX_ARCH_PERFMON_EXT_BIT                 8
+#define CPUID_EAX_07_ECX_01_EAX_ARCH_PERFMON_EXT_FLAG                0x100
+#define CPUID_EAX_07_ECX_01_EAX_ARCH_PERFMON_EXT_MASK                0x01
+#define CPUID_EAX_07_ECX_01_EAX_ARCH_PERFMON_EXT(_)                  (((_) >> 8) & 0x01)
+#define CPUID_EAX_07_ECX_01_EAX_ARCH_PERFMON_EXT_FEATURE             648
       uint32_t reserved2                                             : 1;
 
       /**
        * [Bit 10] If 1, supports fast zero-length REP MOVSB.
        */
       uint32_t fast_rep_movsb                                        : 1;
-#define CPUID_EAX_FAST_REP_MOVSB_BIT                                 10
-#define CPUID_EAX_FAST_REP_MOVSB_FLAG                                0x400
-#define CPUID_EAX_FAST_REP_MOVSB_MASK                                0x01
-#define CPUID_EAX_FAST_REP_MOVSB(_)                                  (((_) >> 10) & 0x01)
+#define CPUID_EAX_07_ECX_01_EAX_FAST_REP_MOVSB_BIT                   10
+#define CPUID_EAX_07_ECX_01_EAX_FAST_REP_MOVSB_FLAG                  0x400
+#define CPUID_EAX_07_ECX_01_EAX_FAST_REP_MOVSB_MASK                  0x01
+#define CPUID_EAX_07_ECX_01_EAX_FAST_REP_MOVSB(_)                    (((_) >> 10) & 0x01)
+#define CPUID_EAX_07_ECX_01_EAX_FAST_REP_MOVSB_FEATURE               650
 
       /**
        * [Bit 11] If 1, supports fast short REP STOSB.
        */
       uint32_t fast_rep_stosb                                        : 1;
-#define CPUID_EAX_FAST_REP_STOSB_BIT                                 11
-#define CPUID_EAX_FAST_REP_STOSB_FLAG                                0x800
-#define CPUID_EAX_FAST_REP_STOSB_MASK                                0x01
-#define CPUID_EAX_FAST_REP_STOSB(_)                                  (((_) >> 11) & 0x01)
+#define CPUID_EAX_07_ECX_01_EAX_FAST_REP_STOSB_BIT                   11
+#define CPUID_EAX_07_ECX_01_EAX_FAST_REP_STOSB_FLAG                  0x800
+#define CPUID_EAX_07_ECX_01_EAX_FAST_REP_STOSB_MASK                  0x01
+#define CPUID_EAX_07_ECX_01_EAX_FAST_REP_STOSB(_)                    (((_) >> 11) & 0x01)
+#define CPUID_EAX_07_ECX_01_EAX_FAST_REP_STOSB_FEATURE               651
 
       /**
        * [Bit 12] If 1, supports fast short REP CMPSB / SCASB.
        */
       uint32_t fast_rep_cmpsb_scasb                                  : 1;
-#define CPUID_EAX_FAST_REP_CMPSB_SCASB_BIT                           12
-#define CPUID_EAX_FAST_REP_CMPSB_SCASB_FLAG                          0x1000
-#define CPUID_EAX_FAST_REP_CMPSB_SCASB_MASK                          0x01
-#define CPUID_EAX_FAST_REP_CMPSB_SCASB(_)                            (((_) >> 12) & 0x01)
+#define CPUID_EAX_07_ECX_01_EAX_FAST_REP_CMPSB_SCASB_BIT             12
+#define CPUID_EAX_07_ECX_01_EAX_FAST_REP_CMPSB_SCASB_FLAG            0x1000
+#define CPUID_EAX_07_ECX_01_EAX_FAST_REP_CMPSB_SCASB_MASK            0x01
+#define CPUID_EAX_07_ECX_01_EAX_FAST_REP_CMPSB_SCASB(_)              (((_) >> 12) & 0x01)
+#define CPUID_EAX_07_ECX_01_EAX_FAST_REP_CMPSB_SCASB_FEATURE         652
       uint32_t reserved3                                             : 4;
 
       /**
        * [Bit 17] If 1, supports Flexible Return and Event Delivery.
        */
       uint32_t fred                                                  : 1;
-#define CPUID_EAX_FRED_BIT                                           17
-#define CPUID_EAX_FRED_FLAG                                          0x20000
-#define CPUID_EAX_FRED_MASK                                          0x01
-#define CPUID_EAX_FRED(_)                                            (((_) >> 17) & 0x01)
+#define CPUID_EAX_07_ECX_01_EAX_FRED_BIT                             17
+#define CPUID_EAX_07_ECX_01_EAX_FRED_FLAG                            0x20000
+#define CPUID_EAX_07_ECX_01_EAX_FRED_MASK                            0x01
+#define CPUID_EAX_07_ECX_01_EAX_FRED(_)                              (((_) >> 17) & 0x01)
+#define CPUID_EAX_07_ECX_01_EAX_FRED_FEATURE                         657
 
       /**
        * [Bit 18] If 1, supports LKGS (load IA32_KERNEL_GS_BASE).
        */
       uint32_t lkgs                                                  : 1;
-#define CPUID_EAX_LKGS_BIT                                           18
-#define CPUID_EAX_LKGS_FLAG                                          0x40000
-#define CPUID_EAX_LKGS_MASK                                          0x01
-#define CPUID_EAX_LKGS(_)                                            (((_) >> 18) & 0x01)
+#define CPUID_EAX_07_ECX_01_EAX_LKGS_BIT                             18
+#define CPUID_EAX_07_ECX_01_EAX_LKGS_FLAG                            0x40000
+#define CPUID_EAX_07_ECX_01_EAX_LKGS_MASK                            0x01
+#define CPUID_EAX_07_ECX_01_EAX_LKGS(_)                              (((_) >> 18) & 0x01)
+#define CPUID_EAX_07_ECX_01_EAX_LKGS_FEATURE                         658
 
       /**
        * [Bit 19] If 1, supports WRMSRNS instruction.
        */
       uint32_t wrmsrns                                               : 1;
-#define CPUID_EAX_WRMSRNS_BIT                                        19
-#define CPUID_EAX_WRMSRNS_FLAG                                       0x80000
-#define CPUID_EAX_WRMSRNS_MASK                                       0x01
-#define CPUID_EAX_WRMSRNS(_)                                         (((_) >> 19) & 0x01)
+#define CPUID_EAX_07_ECX_01_EAX_WRMSRNS_BIT                          19
+#define CPUID_EAX_07_ECX_01_EAX_WRMSRNS_FLAG                         0x80000
+#define CPUID_EAX_07_ECX_01_EAX_WRMSRNS_MASK                         0x01
+#define CPUID_EAX_07_ECX_01_EAX_WRMSRNS(_)                           (((_) >> 19) & 0x01)
+#define CPUID_EAX_07_ECX_01_EAX_WRMSRNS_FEATURE                      659
       uint32_t reserved4                                             : 1;
 
       /**
        * [Bit 21] If 1, supports AMX FP16 tile operations.
        */
       uint32_t amx_fp16                                              : 1;
-#define CPUID_EAX_AMX_FP16_BIT                                       21
-#define CPUID_EAX_AMX_FP16_FLAG                                      0x200000
-#define CPUID_EAX_AMX_FP16_MASK                                      0x01
-#define CPUID_EAX_AMX_FP16(_)                                        (((_) >> 21) & 0x01)
+#define CPUID_EAX_07_ECX_01_EAX_AMX_FP16_BIT                         21
+#define CPUID_EAX_07_ECX_01_EAX_AMX_FP16_FLAG                        0x200000
+#define CPUID_EAX_07_ECX_01_EAX_AMX_FP16_MASK                        0x01
+#define CPUID_EAX_07_ECX_01_EAX_AMX_FP16(_)                          (((_) >> 21) & 0x01)
+#define CPUID_EAX_07_ECX_01_EAX_AMX_FP16_FEATURE                     661
 
       /**
        * [Bit 22] If 1, supports history reset via HRESET instruction.
        */
       uint32_t hreset                                                : 1;
-#define CPUID_EAX_HRESET_BIT                                         22
-#define CPUID_EAX_HRESET_FLAG                                        0x400000
-#define CPUID_EAX_HRESET_MASK                                        0x01
-#define CPUID_EAX_HRESET(_)                                          (((_) >> 22) & 0x01)
+#define CPUID_EAX_07_ECX_01_EAX_HRESET_BIT                           22
+#define CPUID_EAX_07_ECX_01_EAX_HRESET_FLAG                          0x400000
+#define CPUID_EAX_07_ECX_01_EAX_HRESET_MASK                          0x01
+#define CPUID_EAX_07_ECX_01_EAX_HRESET(_)                            (((_) >> 22) & 0x01)
+#define CPUID_EAX_07_ECX_01_EAX_HRESET_FEATURE                       662
 
       /**
        * [Bit 23] If 1, supports AVX-IFMA instructions.
        */
       uint32_t avx_ifma                                              : 1;
-#define CPUID_EAX_AVX_IFMA_BIT                                       23
-#define CPUID_EAX_AVX_IFMA_FLAG                                      0x800000
-#define CPUID_EAX_AVX_IFMA_MASK                                      0x01
-#define CPUID_EAX_AVX_IFMA(_)                                        (((_) >> 23) & 0x01)
+#define CPUID_EAX_07_ECX_01_EAX_AVX_IFMA_BIT                         23
+#define CPUID_EAX_07_ECX_01_EAX_AVX_IFMA_FLAG                        0x800000
+#define CPUID_EAX_07_ECX_01_EAX_AVX_IFMA_MASK                        0x01
+#define CPUID_EAX_07_ECX_01_EAX_AVX_IFMA(_)                          (((_) >> 23) & 0x01)
+#define CPUID_EAX_07_ECX_01_EAX_AVX_IFMA_FEATURE                     663
       uint32_t reserved5                                             : 2;
 
       /**
        * [Bit 26] If 1, supports Linear Address Masking.
        */
       uint32_t lam                                                   : 1;
-#define CPUID_EAX_LAM_BIT                                            26
-#define CPUID_EAX_LAM_FLAG                                           0x4000000
-#define CPUID_EAX_LAM_MASK                                           0x01
-#define CPUID_EAX_LAM(_)                                             (((_) >> 26) & 0x01)
+#define CPUID_EAX_07_ECX_01_EAX_LAM_BIT                              26
+#define CPUID_EAX_07_ECX_01_EAX_LAM_FLAG                             0x4000000
+#define CPUID_EAX_07_ECX_01_EAX_LAM_MASK                             0x01
+#define CPUID_EAX_07_ECX_01_EAX_LAM(_)                               (((_) >> 26) & 0x01)
+#define CPUID_EAX_07_ECX_01_EAX_LAM_FEATURE                          666
 
       /**
        * [Bit 27] If 1, supports RDMSRLIST / WRMSRLIST and IA32_BARRIER MSR.
        */
       uint32_t msrlist                                               : 1;
-#define CPUID_EAX_MSRLIST_BIT                                        27
-#define CPUID_EAX_MSRLIST_FLAG                                       0x8000000
-#define CPUID_EAX_MSRLIST_MASK                                       0x01
-#define CPUID_EAX_MSRLIST(_)                                         (((_) >> 27) & 0x01)
+#define CPUID_EAX_07_ECX_01_EAX_MSRLIST_BIT                          27
+#define CPUID_EAX_07_ECX_01_EAX_MSRLIST_FLAG                         0x8000000
+#define CPUID_EAX_07_ECX_01_EAX_MSRLIST_MASK                         0x01
+#define CPUID_EAX_07_ECX_01_EAX_MSRLIST(_)                           (((_) >> 27) & 0x01)
+#define CPUID_EAX_07_ECX_01_EAX_MSRLIST_FEATURE                      667
       uint32_t reserved6                                             : 2;
 
       /**
        * [Bit 30] If 1, supports INVD execution prevention after BIOS Done.
        */
       uint32_t invd_disable_post_bios_done                           : 1;
-#define CPUID_EAX_INVD_DISABLE_POST_BIOS_DONE_BIT                    30
-#define CPUID_EAX_INVD_DISABLE_POST_BIOS_DONE_FLAG                   0x40000000
-#define CPUID_EAX_INVD_DISABLE_POST_BIOS_DONE_MASK                   0x01
-#define CPUID_EAX_INVD_DISABLE_POST_BIOS_DONE(_)                     (((_) >> 30) & 0x01)
+#define CPUID_EAX_07_ECX_01_EAX_INVD_DISABLE_POST_BIOS_DONE_BIT      30
+#define CPUID_EAX_07_ECX_01_EAX_INVD_DISABLE_POST_BIOS_DONE_FLAG     0x40000000
+#define CPUID_EAX_07_ECX_01_EAX_INVD_DISABLE_POST_BIOS_DONE_MASK     0x01
+#define CPUID_EAX_07_ECX_01_EAX_INVD_DISABLE_POST_BIOS_DONE(_)       (((_) >> 30) & 0x01)
+#define CPUID_EAX_07_ECX_01_EAX_INVD_DISABLE_POST_BIOS_DONE_FEATURE  670
       uint32_t reserved7                                             : 1;
     };
 
     uint32_t flags;
   } eax;
+#define CPUID_EAX_07_ECX_01_EAX_RESERVED_BITS                        0xB311E208
 
   union
   {
@@ -3494,34 +3753,38 @@ typedef struct
        * [Bit 0] If 1, supports IA32_PPIN and IA32_PPIN_CTL MSRs.
        */
       uint32_t ppin                                                  : 1;
-#define CPUID_EBX_PPIN_BIT                                           0
-#define CPUID_EBX_PPIN_FLAG                                          0x01
-#define CPUID_EBX_PPIN_MASK                                          0x01
-#define CPUID_EBX_PPIN(_)                                            (((_) >> 0) & 0x01)
+#define CPUID_EAX_07_ECX_01_EBX_PPIN_BIT                             0
+#define CPUID_EAX_07_ECX_01_EBX_PPIN_FLAG                            0x01
+#define CPUID_EAX_07_ECX_01_EBX_PPIN_MASK                            0x01
+#define CPUID_EAX_07_ECX_01_EBX_PPIN(_)                              (((_) >> 0) & 0x01)
+#define CPUID_EAX_07_ECX_01_EBX_PPIN_FEATURE                         672
 
       /**
        * [Bit 1] If 1, supports PBNDKB instruction and IA32_TSE_CAPABILITY MSR.
        */
       uint32_t pbndkb                                                : 1;
-#define CPUID_EBX_PBNDKB_BIT                                         1
-#define CPUID_EBX_PBNDKB_FLAG                                        0x02
-#define CPUID_EBX_PBNDKB_MASK                                        0x01
-#define CPUID_EBX_PBNDKB(_)                                          (((_) >> 1) & 0x01)
+#define CPUID_EAX_07_ECX_01_EBX_PBNDKB_BIT                           1
+#define CPUID_EAX_07_ECX_01_EBX_PBNDKB_FLAG                          0x02
+#define CPUID_EAX_07_ECX_01_EBX_PBNDKB_MASK                          0x01
+#define CPUID_EAX_07_ECX_01_EBX_PBNDKB(_)                            (((_) >> 1) & 0x01)
+#define CPUID_EAX_07_ECX_01_EBX_PBNDKB_FEATURE                       673
       uint32_t reserved1                                             : 1;
 
       /**
        * [Bit 3] If 1, IA32_MISC_ENABLE[22] limits CPUID.00H:EAX[7:0].
        */
       uint32_t cpuidmaxval_lim_rmv                                   : 1;
-#define CPUID_EBX_CPUIDMAXVAL_LIM_RMV_BIT                            3
-#define CPUID_EBX_CPUIDMAXVAL_LIM_RMV_FLAG                           0x08
-#define CPUID_EBX_CPUIDMAXVAL_LIM_RMV_MASK                           0x01
-#define CPUID_EBX_CPUIDMAXVAL_LIM_RMV(_)                             (((_) >> 3) & 0x01)
+#define CPUID_EAX_07_ECX_01_EBX_CPUIDMAXVAL_LIM_RMV_BIT              3
+#define CPUID_EAX_07_ECX_01_EBX_CPUIDMAXVAL_LIM_RMV_FLAG             0x08
+#define CPUID_EAX_07_ECX_01_EBX_CPUIDMAXVAL_LIM_RMV_MASK             0x01
+#define CPUID_EAX_07_ECX_01_EBX_CPUIDMAXVAL_LIM_RMV(_)               (((_) >> 3) & 0x01)
+#define CPUID_EAX_07_ECX_01_EBX_CPUIDMAXVAL_LIM_RMV_FEATURE          675
       uint32_t reserved2                                             : 28;
     };
 
     uint32_t flags;
   } ebx;
+#define CPUID_EAX_07_ECX_01_EBX_RESERVED_BITS                        0xFFFFFFF4
 
   union
   {
@@ -3531,24 +3794,27 @@ typedef struct
        * [Bit 0] If 1, supports Asymmetrical Intel RDT Monitoring capability.
        */
       uint32_t rdt_m_asym                                            : 1;
-#define CPUID_ECX_RDT_M_ASYM_BIT                                     0
-#define CPUID_ECX_RDT_M_ASYM_FLAG                                    0x01
-#define CPUID_ECX_RDT_M_ASYM_MASK                                    0x01
-#define CPUID_ECX_RDT_M_ASYM(_)                                      (((_) >> 0) & 0x01)
+#define CPUID_EAX_07_ECX_01_ECX_RDT_M_ASYM_BIT                       0
+#define CPUID_EAX_07_ECX_01_ECX_RDT_M_ASYM_FLAG                      0x01
+#define CPUID_EAX_07_ECX_01_ECX_RDT_M_ASYM_MASK                      0x01
+#define CPUID_EAX_07_ECX_01_ECX_RDT_M_ASYM(_)                        (((_) >> 0) & 0x01)
+#define CPUID_EAX_07_ECX_01_ECX_RDT_M_ASYM_FEATURE                   704
 
       /**
        * [Bit 1] If 1, supports Asymmetrical Intel RDT Allocation capability.
        */
       uint32_t rdt_a_asym                                            : 1;
-#define CPUID_ECX_RDT_A_ASYM_BIT                                     1
-#define CPUID_ECX_RDT_A_ASYM_FLAG                                    0x02
-#define CPUID_ECX_RDT_A_ASYM_MASK                                    0x01
-#define CPUID_ECX_RDT_A_ASYM(_)                                      (((_) >> 1) & 0x01)
+#define CPUID_EAX_07_ECX_01_ECX_RDT_A_ASYM_BIT                       1
+#define CPUID_EAX_07_ECX_01_ECX_RDT_A_ASYM_FLAG                      0x02
+#define CPUID_EAX_07_ECX_01_ECX_RDT_A_ASYM_MASK                      0x01
+#define CPUID_EAX_07_ECX_01_ECX_RDT_A_ASYM(_)                        (((_) >> 1) & 0x01)
+#define CPUID_EAX_07_ECX_01_ECX_RDT_A_ASYM_FEATURE                   705
       uint32_t reserved1                                             : 30;
     };
 
     uint32_t flags;
   } ecx;
+#define CPUID_EAX_07_ECX_01_ECX_RESERVED_BITS                        0xFFFFFFFC
 
   union
   {
@@ -3560,112 +3826,133 @@ typedef struct
        * [Bit 4] If 1, supports AVX-VNNI-INT8 instructions.
        */
       uint32_t avx_vnni_int8                                         : 1;
-#define CPUID_EDX_AVX_VNNI_INT8_BIT                                  4
-#define CPUID_EDX_AVX_VNNI_INT8_FLAG                                 0x10
-#define CPUID_EDX_AVX_VNNI_INT8_MASK                                 0x01
-#define CPUID_EDX_AVX_VNNI_INT8(_)                                   (((_) >> 4) & 0x01)
+#define CPUID_EAX_07_ECX_01_EDX_AVX_VNNI_INT8_BIT                    4
+#define CPUID_EAX_07_ECX_01_EDX_AVX_VNNI_INT8_FLAG                   0x10
+#define CPUID_EAX_07_ECX_01_EDX_AVX_VNNI_INT8_MASK                   0x01
+#define CPUID_EAX_07_ECX_01_EDX_AVX_VNNI_INT8(_)                     (((_) >> 4) & 0x01)
+#define CPUID_EAX_07_ECX_01_EDX_AVX_VNNI_INT8_FEATURE                740
 
       /**
        * [Bit 5] If 1, supports AVX-NE-CONVERT instructions.
        */
       uint32_t avx_ne_convert                                        : 1;
-#define CPUID_EDX_AVX_NE_CONVERT_BIT                                 5
-#define CPUID_EDX_AVX_NE_CONVERT_FLAG                                0x20
-#define CPUID_EDX_AVX_NE_CONVERT_MASK                                0x01
-#define CPUID_EDX_AVX_NE_CONVERT(_)                                  (((_) >> 5) & 0x01)
+#define CPUID_EAX_07_ECX_01_EDX_AVX_NE_CONVERT_BIT                   5
+#define CPUID_EAX_07_ECX_01_EDX_AVX_NE_CONVERT_FLAG                  0x20
+#define CPUID_EAX_07_ECX_01_EDX_AVX_NE_CONVERT_MASK                  0x01
+#define CPUID_EAX_07_ECX_01_EDX_AVX_NE_CONVERT(_)                    (((_) >> 5) & 0x01)
+#define CPUID_EAX_07_ECX_01_EDX_AVX_NE_CONVERT_FEATURE               741
       uint32_t reserved2                                             : 2;
 
       /**
        * [Bit 8] If 1, supports AMX_COMPLEX instructions.
        */
       uint32_t amx_complex                                           : 1;
-#define CPUID_EDX_AMX_COMPLEX_BIT                                    8
-#define CPUID_EDX_AMX_COMPLEX_FLAG                                   0x100
-#define CPUID_EDX_AMX_COMPLEX_MASK                                   0x01
-#define CPUID_EDX_AMX_COMPLEX(_)                                     (((_) >> 8) & 0x01)
+#define CPUID_EAX_07_ECX_01_EDX_AMX_COMPLEX_BIT                      8
+#define CPUID_EAX_07_ECX_01_EDX_AMX_COMPLEX_FLAG                     0x100
+#define CPUID_EAX_07_ECX_01_EDX_AMX_COMPLEX_MASK                     0x01
+#define CPUID_EAX_07_ECX_01_EDX_AMX_COMPLEX(_)                       (((_) >> 8) & 0x01)
+#define CPUID_EAX_07_ECX_01_EDX_AMX_COMPLEX_FEATURE                  744
       uint32_t reserved3                                             : 1;
 
       /**
        * [Bit 10] If 1, supports AVX-VNNI-INT16 instructions.
        */
       uint32_t avx_vnni_int16                                        : 1;
-#define CPUID_EDX_AVX_VNNI_INT16_BIT                                 10
-#define CPUID_EDX_AVX_VNNI_INT16_FLAG                                0x400
-#define CPUID_EDX_AVX_VNNI_INT16_MASK                                0x01
-#define CPUID_EDX_AVX_VNNI_INT16(_)                                  (((_) >> 10) & 0x01)
+#define CPUID_EAX_07_ECX_01_EDX_AVX_VNNI_INT16_BIT                   10
+#define CPUID_EAX_07_ECX_01_EDX_AVX_VNNI_INT16_FLAG                  0x400
+#define CPUID_EAX_07_ECX_01_EDX_AVX_VNNI_INT16_MASK                  0x01
+#define CPUID_EAX_07_ECX_01_EDX_AVX_VNNI_INT16(_)                    (((_) >> 10) & 0x01)
+#define CPUID_EAX_07_ECX_01_EDX_AVX_VNNI_INT16_FEATURE               746
       uint32_t reserved4                                             : 3;
 
       /**
        * [Bit 14] If 1, supports PREFETCHIT0/1 instructions.
        */
       uint32_t prefetchi                                             : 1;
-#define CPUID_EDX_PREFETCHI_BIT                                      14
-#define CPUID_EDX_PREFETCHI_FLAG                                     0x4000
-#define CPUID_EDX_PREFETCHI_MASK                                     0x01
-#define CPUID_EDX_PREFETCHI(_)                                       (((_) >> 14) & 0x01)
+#define CPUID_EAX_07_ECX_01_EDX_PREFETCHI_BIT                        14
+#define CPUID_EAX_07_ECX_01_EDX_PREFETCHI_FLAG                       0x4000
+#define CPUID_EAX_07_ECX_01_EDX_PREFETCHI_MASK                       0x01
+#define CPUID_EAX_07_ECX_01_EDX_PREFETCHI(_)                         (((_) >> 14) & 0x01)
+#define CPUID_EAX_07_ECX_01_EDX_PREFETCHI_FEATURE                    750
       uint32_t reserved5                                             : 2;
 
       /**
        * [Bit 17] If 1, UIRET sets UIF from RFLAGS image.
        */
       uint32_t uiret_uif                                             : 1;
-#define CPUID_EDX_UIRET_UIF_BIT                                      17
-#define CPUID_EDX_UIRET_UIF_FLAG                                     0x20000
-#define CPUID_EDX_UIRET_UIF_MASK                                     0x01
-#define CPUID_EDX_UIRET_UIF(_)                                       (((_) >> 17) & 0x01)
+#define CPUID_EAX_07_ECX_01_EDX_UIRET_UIF_BIT                        17
+#define CPUID_EAX_07_ECX_01_EDX_UIRET_UIF_FLAG                       0x20000
+#define CPUID_EAX_07_ECX_01_EDX_UIRET_UIF_MASK                       0x01
+#define CPUID_EAX_07_ECX_01_EDX_UIRET_UIF(_)                         (((_) >> 17) & 0x01)
+#define CPUID_EAX_07_ECX_01_EDX_UIRET_UIF_FEATURE                    753
 
       /**
        * [Bit 18] If 1, supports CET supervisor shadow stack.
        */
       uint32_t cet_sss                                               : 1;
-#define CPUID_EDX_CET_SSS_BIT                                        18
-#define CPUID_EDX_CET_SSS_FLAG                                       0x40000
-#define CPUID_EDX_CET_SSS_MASK                                       0x01
-#define CPUID_EDX_CET_SSS(_)                                         (((_) >> 18) & 0x01)
+#define CPUID_EAX_07_ECX_01_EDX_CET_SSS_BIT                          18
+#define CPUID_EAX_07_ECX_01_EDX_CET_SSS_FLAG                         0x40000
+#define CPUID_EAX_07_ECX_01_EDX_CET_SSS_MASK                         0x01
+#define CPUID_EAX_07_ECX_01_EDX_CET_SSS(_)                           (((_) >> 18) & 0x01)
+#define CPUID_EAX_07_ECX_01_EDX_CET_SSS_FEATURE                      754
 
       /**
        * [Bit 19] If 1, supports AVX10 instructions.
        */
       uint32_t avx10                                                 : 1;
-#define CPUID_EDX_AVX10_BIT                                          19
-#define CPUID_EDX_AVX10_FLAG                                         0x80000
-#define CPUID_EDX_AVX10_MASK                                         0x01
-#define CPUID_EDX_AVX10(_)                                           (((_) >> 19) & 0x01)
+#define CPUID_EAX_07_ECX_01_EDX_AVX10_BIT                            19
+#define CPUID_EAX_07_ECX_01_EDX_AVX10_FLAG                           0x80000
+#define CPUID_EAX_07_ECX_01_EDX_AVX10_MASK                           0x01
+#define CPUID_EAX_07_ECX_01_EDX_AVX10(_)                             (((_) >> 19) & 0x01)
+#define CPUID_EAX_07_ECX_01_EDX_AVX10_FEATURE                        755
       uint32_t reserved6                                             : 2;
 
       /**
        * [Bit 22] If 1, supports secure TEE attestation.
        */
       uint32_t sec_tee_attestation                                   : 1;
-#define CPUID_EDX_SEC_TEE_ATTESTATION_BIT                            22
-#define CPUID_EDX_SEC_TEE_ATTESTATION_FLAG                           0x400000
-#define CPUID_EDX_SEC_TEE_ATTESTATION_MASK                           0x01
-#define CPUID_EDX_SEC_TEE_ATTESTATION(_)                             (((_) >> 22) & 0x01)
+#define CPUID_EAX_07_ECX_01_EDX_SEC_TEE_ATTESTATION_BIT              22
+#define CPUID_EAX_07_ECX_01_EDX_SEC_TEE_ATTESTATION_FLAG             0x400000
+#define CPUID_EAX_07_ECX_01_EDX_SEC_TEE_ATTESTATION_MASK             0x01
+#define CPUID_EAX_07_ECX_01_EDX_SEC_TEE_ATTESTATION(_)               (((_) >> 22) & 0x01)
+#define CPUID_EAX_07_ECX_01_EDX_SEC_TEE_ATTESTATION_FEATURE          758
 
       /**
        * [Bit 23] If 1, supports MWAIT instruction.
        */
       uint32_t mwait                                                 : 1;
-#define CPUID_EDX_MWAIT_BIT                                          23
-#define CPUID_EDX_MWAIT_FLAG                                         0x800000
-#define CPUID_EDX_MWAIT_MASK                                         0x01
-#define CPUID_EDX_MWAIT(_)                                           (((_) >> 23) & 0x01)
+#define CPUID_EAX_07_ECX_01_EDX_MWAIT_BIT                            23
+#define CPUID_EAX_07_ECX_01_EDX_MWAIT_FLAG                           0x800000
+#define CPUID_EAX_07_ECX_01_EDX_MWAIT_MASK                           0x01
+#define CPUID_EAX_07_ECX_01_EDX_MWAIT(_)                             (((_) >> 23) & 0x01)
+#define CPUID_EAX_07_ECX_01_EDX_MWAIT_FEATURE                        759
 
       /**
        * [Bit 24] If 1, supports Static LSM (IA32_INTEGRITY_STATUS available).
        */
       uint32_t slsm                                                  : 1;
-#define CPUID_EDX_SLSM_BIT                                           24
-#define CPUID_EDX_SLSM_FLAG                                          0x1000000
-#define CPUID_EDX_SLSM_MASK                                          0x01
-#define CPUID_EDX_SLSM(_)                                            (((_) >> 24) & 0x01)
+#define CPUID_EAX_07_ECX_01_EDX_SLSM_BIT                             24
+#define CPUID_EAX_07_ECX_01_EDX_SLSM_FLAG                            0x1000000
+#define CPUID_EAX_07_ECX_01_EDX_SLSM_MASK                            0x01
+#define CPUID_EAX_07_ECX_01_EDX_SLSM(_)                              (((_) >> 24) & 0x01)
+#define CPUID_EAX_07_ECX_01_EDX_SLSM_FEATURE                         760
       uint32_t reserved7                                             : 7;
     };
 
     uint32_t flags;
   } edx;
+#define CPUID_EAX_07_ECX_01_EDX_RESERVED_BITS                        0xFE31BACF
 
 } cpuid_eax_07_ecx_01;
+#define CPUID_EAX_07_ECX_01_SNAPSHOT_INDEX                           5
+#define CPUID_EAX_07_ECX_01_EAX_POLICY_AND                           0x4CEE1DF7
+#define CPUID_EAX_07_ECX_01_EAX_POLICY_OR                            0x00000000
+#define CPUID_EAX_07_ECX_01_EBX_POLICY_AND                           0x0000000B
+#define CPUID_EAX_07_ECX_01_EBX_POLICY_OR                            0x00000000
+#define CPUID_EAX_07_ECX_01_ECX_POLICY_AND                           0x00000003
+#define CPUID_EAX_07_ECX_01_ECX_POLICY_OR                            0x00000000
+#define CPUID_EAX_07_ECX_01_EDX_POLICY_AND                           0x01CE4530
+#define CPUID_EAX_07_ECX_01_EDX_POLICY_OR                            0x00000000
 
 /**
  * @}
@@ -3688,14 +3975,15 @@ typedef struct
        * [Bits 31:0] Value of bits [31:0] of IA32_PLATFORM_DCA_CAP MSR (address 1F8H).
        */
       uint32_t ia32_platform_dca_cap                                 : 32;
-#define CPUID_EAX_IA32_PLATFORM_DCA_CAP_BIT                          0
-#define CPUID_EAX_IA32_PLATFORM_DCA_CAP_FLAG                         0xFFFFFFFF
-#define CPUID_EAX_IA32_PLATFORM_DCA_CAP_MASK                         0xFFFFFFFF
-#define CPUID_EAX_IA32_PLATFORM_DCA_CAP(_)                           (((_) >> 0) & 0xFFFFFFFF)
+#define CPUID_EAX_09_EAX_IA32_PLATFORM_DCA_CAP_BIT                   0
+#define CPUID_EAX_09_EAX_IA32_PLATFORM_DCA_CAP_FLAG                  0xFFFFFFFF
+#define CPUID_EAX_09_EAX_IA32_PLATFORM_DCA_CAP_MASK                  0xFFFFFFFF
+#define CPUID_EAX_09_EAX_IA32_PLATFORM_DCA_CAP(_)                    (((_) >> 0) & 0xFFFFFFFF)
     };
 
     uint32_t flags;
   } eax;
+#define CPUID_EAX_09_EAX_RESERVED_BITS                               0x00
 
   union
   {
@@ -3705,14 +3993,15 @@ typedef struct
        * [Bits 31:0] EBX is reserved.
        */
       uint32_t reserved                                              : 32;
-#define CPUID_EBX_RESERVED_BIT                                       0
-#define CPUID_EBX_RESERVED_FLAG                                      0xFFFFFFFF
-#define CPUID_EBX_RESERVED_MASK                                      0xFFFFFFFF
-#define CPUID_EBX_RESERVED(_)                                        (((_) >> 0) & 0xFFFFFFFF)
+#define CPUID_EAX_09_EBX_RESERVED_BIT                                0
+#define CPUID_EAX_09_EBX_RESERVED_FLAG                               0xFFFFFFFF
+#define CPUID_EAX_09_EBX_RESERVED_MASK                               0xFFFFFFFF
+#define CPUID_EAX_09_EBX_RESERVED(_)                                 (((_) >> 0) & 0xFFFFFFFF)
     };
 
     uint32_t flags;
   } ebx;
+#define CPUID_EAX_09_EBX_RESERVED_BITS                               0xFFFFFFFF
 
   union
   {
@@ -3722,14 +4011,15 @@ typedef struct
        * [Bits 31:0] ECX is reserved.
        */
       uint32_t reserved                                              : 32;
-#define CPUID_ECX_RESERVED_BIT                                       0
-#define CPUID_ECX_RESERVED_FLAG                                      0xFFFFFFFF
-#define CPUID_ECX_RESERVED_MASK                                      0xFFFFFFFF
-#define CPUID_ECX_RESERVED(_)                                        (((_) >> 0) & 0xFFFFFFFF)
+#define CPUID_EAX_09_ECX_RESERVED_BIT                                0
+#define CPUID_EAX_09_ECX_RESERVED_FLAG                               0xFFFFFFFF
+#define CPUID_EAX_09_ECX_RESERVED_MASK                               0xFFFFFFFF
+#define CPUID_EAX_09_ECX_RESERVED(_)                                 (((_) >> 0) & 0xFFFFFFFF)
     };
 
     uint32_t flags;
   } ecx;
+#define CPUID_EAX_09_ECX_RESERVED_BITS                               0xFFFFFFFF
 
   union
   {
@@ -3739,16 +4029,26 @@ typedef struct
        * [Bits 31:0] EDX is reserved.
        */
       uint32_t reserved                                              : 32;
-#define CPUID_EDX_RESERVED_BIT                                       0
-#define CPUID_EDX_RESERVED_FLAG                                      0xFFFFFFFF
-#define CPUID_EDX_RESERVED_MASK                                      0xFFFFFFFF
-#define CPUID_EDX_RESERVED(_)                                        (((_) >> 0) & 0xFFFFFFFF)
+#define CPUID_EAX_09_EDX_RESERVED_BIT                                0
+#define CPUID_EAX_09_EDX_RESERVED_FLAG                               0xFFFFFFFF
+#define CPUID_EAX_09_EDX_RESERVED_MASK                               0xFFFFFFFF
+#define CPUID_EAX_09_EDX_RESERVED(_)                                 (((_) >> 0) & 0xFFFFFFFF)
     };
 
     uint32_t flags;
   } edx;
+#define CPUID_EAX_09_EDX_RESERVED_BITS                               0xFFFFFFFF
 
 } cpuid_eax_09;
+#define CPUID_EAX_09_SNAPSHOT_INDEX                                  6
+#define CPUID_EAX_09_EAX_POLICY_AND                                  0xFFFFFFFF
+#define CPUID_EAX_09_EAX_POLICY_OR                                   0x00000000
+#define CPUID_EAX_09_EBX_POLICY_AND                                  0x00000000
+#define CPUID_EAX_09_EBX_POLICY_OR                                   0x00000000
+#define CPUID_EAX_09_ECX_POLICY_AND                                  0x00000000
+#define CPUID_EAX_09_ECX_POLICY_OR                                   0x00000000
+#define CPUID_EAX_09_EDX_POLICY_AND                                  0x00000000
+#define CPUID_EAX_09_EDX_POLICY_OR                                   0x00000000
 
 
 /**
@@ -3772,41 +4072,42 @@ typedef struct
        * [Bits 7:0] Version ID of architectural performance monitoring.
        */
       uint32_t version_id_of_architectural_performance_monitoring    : 8;
-#define CPUID_EAX_VERSION_ID_OF_ARCHITECTURAL_PERFORMANCE_MONITORING_BIT 0
-#define CPUID_EAX_VERSION_ID_OF_ARCHITECTURAL_PERFORMANCE_MONITORING_FLAG 0xFF
-#define CPUID_EAX_VERSION_ID_OF_ARCHITECTURAL_PERFORMANCE_MONITORING_MASK 0xFF
-#define CPUID_EAX_VERSION_ID_OF_ARCHITECTURAL_PERFORMANCE_MONITORING(_) (((_) >> 0) & 0xFF)
+#define CPUID_EAX_0A_EAX_VERSION_ID_OF_ARCHITECTURAL_PERFORMANCE_MONITORING_BIT 0
+#define CPUID_EAX_0A_EAX_VERSION_ID_OF_ARCHITECTURAL_PERFORMANCE_MONITORING_FLAG 0xFF
+#define CPUID_EAX_0A_EAX_VERSION_ID_OF_ARCHITECTURAL_PERFORMANCE_MONITORING_MASK 0xFF
+#define CPUID_EAX_0A_EAX_VERSION_ID_OF_ARCHITECTURAL_PERFORMANCE_MONITORING(_) (((_) >> 0) & 0xFF)
 
       /**
        * [Bits 15:8] Number of general-purpose performance monitoring counter per logical processor.
        */
       uint32_t number_of_performance_monitoring_counter_per_logical_processor: 8;
-#define CPUID_EAX_NUMBER_OF_PERFORMANCE_MONITORING_COUNTER_PER_LOGICAL_PROCESSOR_BIT 8
-#define CPUID_EAX_NUMBER_OF_PERFORMANCE_MONITORING_COUNTER_PER_LOGICAL_PROCESSOR_FLAG 0xFF00
-#define CPUID_EAX_NUMBER_OF_PERFORMANCE_MONITORING_COUNTER_PER_LOGICAL_PROCESSOR_MASK 0xFF
-#define CPUID_EAX_NUMBER_OF_PERFORMANCE_MONITORING_COUNTER_PER_LOGICAL_PROCESSOR(_) (((_) >> 8) & 0xFF)
+#define CPUID_EAX_0A_EAX_NUMBER_OF_PERFORMANCE_MONITORING_COUNTER_PER_LOGICAL_PROCESSOR_BIT 8
+#define CPUID_EAX_0A_EAX_NUMBER_OF_PERFORMANCE_MONITORING_COUNTER_PER_LOGICAL_PROCESSOR_FLAG 0xFF00
+#define CPUID_EAX_0A_EAX_NUMBER_OF_PERFORMANCE_MONITORING_COUNTER_PER_LOGICAL_PROCESSOR_MASK 0xFF
+#define CPUID_EAX_0A_EAX_NUMBER_OF_PERFORMANCE_MONITORING_COUNTER_PER_LOGICAL_PROCESSOR(_) (((_) >> 8) & 0xFF)
 
       /**
        * [Bits 23:16] Bit width of general-purpose, performance monitoring counter.
        */
       uint32_t bit_width_of_performance_monitoring_counter           : 8;
-#define CPUID_EAX_BIT_WIDTH_OF_PERFORMANCE_MONITORING_COUNTER_BIT    16
-#define CPUID_EAX_BIT_WIDTH_OF_PERFORMANCE_MONITORING_COUNTER_FLAG   0xFF0000
-#define CPUID_EAX_BIT_WIDTH_OF_PERFORMANCE_MONITORING_COUNTER_MASK   0xFF
-#define CPUID_EAX_BIT_WIDTH_OF_PERFORMANCE_MONITORING_COUNTER(_)     (((_) >> 16) & 0xFF)
+#define CPUID_EAX_0A_EAX_BIT_WIDTH_OF_PERFORMANCE_MONITORING_COUNTER_BIT 16
+#define CPUID_EAX_0A_EAX_BIT_WIDTH_OF_PERFORMANCE_MONITORING_COUNTER_FLAG 0xFF0000
+#define CPUID_EAX_0A_EAX_BIT_WIDTH_OF_PERFORMANCE_MONITORING_COUNTER_MASK 0xFF
+#define CPUID_EAX_0A_EAX_BIT_WIDTH_OF_PERFORMANCE_MONITORING_COUNTER(_) (((_) >> 16) & 0xFF)
 
       /**
        * [Bits 31:24] Length of EBX bit vector to enumerate architectural performance monitoring events.
        */
       uint32_t ebx_bit_vector_length                                 : 8;
-#define CPUID_EAX_EBX_BIT_VECTOR_LENGTH_BIT                          24
-#define CPUID_EAX_EBX_BIT_VECTOR_LENGTH_FLAG                         0xFF000000
-#define CPUID_EAX_EBX_BIT_VECTOR_LENGTH_MASK                         0xFF
-#define CPUID_EAX_EBX_BIT_VECTOR_LENGTH(_)                           (((_) >> 24) & 0xFF)
+#define CPUID_EAX_0A_EAX_EBX_BIT_VECTOR_LENGTH_BIT                   24
+#define CPUID_EAX_0A_EAX_EBX_BIT_VECTOR_LENGTH_FLAG                  0xFF000000
+#define CPUID_EAX_0A_EAX_EBX_BIT_VECTOR_LENGTH_MASK                  0xFF
+#define CPUID_EAX_0A_EAX_EBX_BIT_VECTOR_LENGTH(_)                    (((_) >> 24) & 0xFF)
     };
 
     uint32_t flags;
   } eax;
+#define CPUID_EAX_0A_EAX_RESERVED_BITS                               0x00
 
   union
   {
@@ -3816,69 +4117,77 @@ typedef struct
        * [Bit 0] Core cycle event not available if 1.
        */
       uint32_t core_cycle_event_not_available                        : 1;
-#define CPUID_EBX_CORE_CYCLE_EVENT_NOT_AVAILABLE_BIT                 0
-#define CPUID_EBX_CORE_CYCLE_EVENT_NOT_AVAILABLE_FLAG                0x01
-#define CPUID_EBX_CORE_CYCLE_EVENT_NOT_AVAILABLE_MASK                0x01
-#define CPUID_EBX_CORE_CYCLE_EVENT_NOT_AVAILABLE(_)                  (((_) >> 0) & 0x01)
+#define CPUID_EAX_0A_EBX_CORE_CYCLE_EVENT_NOT_AVAILABLE_BIT          0
+#define CPUID_EAX_0A_EBX_CORE_CYCLE_EVENT_NOT_AVAILABLE_FLAG         0x01
+#define CPUID_EAX_0A_EBX_CORE_CYCLE_EVENT_NOT_AVAILABLE_MASK         0x01
+#define CPUID_EAX_0A_EBX_CORE_CYCLE_EVENT_NOT_AVAILABLE(_)           (((_) >> 0) & 0x01)
+#define CPUID_EAX_0A_EBX_CORE_CYCLE_EVENT_NOT_AVAILABLE_FEATURE      928
 
       /**
        * [Bit 1] Instruction retired event not available if 1.
        */
       uint32_t instruction_retired_event_not_available               : 1;
-#define CPUID_EBX_INSTRUCTION_RETIRED_EVENT_NOT_AVAILABLE_BIT        1
-#define CPUID_EBX_INSTRUCTION_RETIRED_EVENT_NOT_AVAILABLE_FLAG       0x02
-#define CPUID_EBX_INSTRUCTION_RETIRED_EVENT_NOT_AVAILABLE_MASK       0x01
-#define CPUID_EBX_INSTRUCTION_RETIRED_EVENT_NOT_AVAILABLE(_)         (((_) >> 1) & 0x01)
+#define CPUID_EAX_0A_EBX_INSTRUCTION_RETIRED_EVENT_NOT_AVAILABLE_BIT 1
+#define CPUID_EAX_0A_EBX_INSTRUCTION_RETIRED_EVENT_NOT_AVAILABLE_FLAG 0x02
+#define CPUID_EAX_0A_EBX_INSTRUCTION_RETIRED_EVENT_NOT_AVAILABLE_MASK 0x01
+#define CPUID_EAX_0A_EBX_INSTRUCTION_RETIRED_EVENT_NOT_AVAILABLE(_)  (((_) >> 1) & 0x01)
+#define CPUID_EAX_0A_EBX_INSTRUCTION_RETIRED_EVENT_NOT_AVAILABLE_FEATURE 929
 
       /**
        * [Bit 2] Reference cycles event not available if 1.
        */
       uint32_t reference_cycles_event_not_available                  : 1;
-#define CPUID_EBX_REFERENCE_CYCLES_EVENT_NOT_AVAILABLE_BIT           2
-#define CPUID_EBX_REFERENCE_CYCLES_EVENT_NOT_AVAILABLE_FLAG          0x04
-#define CPUID_EBX_REFERENCE_CYCLES_EVENT_NOT_AVAILABLE_MASK          0x01
-#define CPUID_EBX_REFERENCE_CYCLES_EVENT_NOT_AVAILABLE(_)            (((_) >> 2) & 0x01)
+#define CPUID_EAX_0A_EBX_REFERENCE_CYCLES_EVENT_NOT_AVAILABLE_BIT    2
+#define CPUID_EAX_0A_EBX_REFERENCE_CYCLES_EVENT_NOT_AVAILABLE_FLAG   0x04
+#define CPUID_EAX_0A_EBX_REFERENCE_CYCLES_EVENT_NOT_AVAILABLE_MASK   0x01
+#define CPUID_EAX_0A_EBX_REFERENCE_CYCLES_EVENT_NOT_AVAILABLE(_)     (((_) >> 2) & 0x01)
+#define CPUID_EAX_0A_EBX_REFERENCE_CYCLES_EVENT_NOT_AVAILABLE_FEATURE 930
 
       /**
        * [Bit 3] Last-level cache reference event not available if 1.
        */
       uint32_t last_level_cache_reference_event_not_available        : 1;
-#define CPUID_EBX_LAST_LEVEL_CACHE_REFERENCE_EVENT_NOT_AVAILABLE_BIT 3
-#define CPUID_EBX_LAST_LEVEL_CACHE_REFERENCE_EVENT_NOT_AVAILABLE_FLAG 0x08
-#define CPUID_EBX_LAST_LEVEL_CACHE_REFERENCE_EVENT_NOT_AVAILABLE_MASK 0x01
-#define CPUID_EBX_LAST_LEVEL_CACHE_REFERENCE_EVENT_NOT_AVAILABLE(_)  (((_) >> 3) & 0x01)
+#define CPUID_EAX_0A_EBX_LAST_LEVEL_CACHE_REFERENCE_EVENT_NOT_AVAILABLE_BIT 3
+#define CPUID_EAX_0A_EBX_LAST_LEVEL_CACHE_REFERENCE_EVENT_NOT_AVAILABLE_FLAG 0x08
+#define CPUID_EAX_0A_EBX_LAST_LEVEL_CACHE_REFERENCE_EVENT_NOT_AVAILABLE_MASK 0x01
+#define CPUID_EAX_0A_EBX_LAST_LEVEL_CACHE_REFERENCE_EVENT_NOT_AVAILABLE(_) (((_) >> 3) & 0x01)
+#define CPUID_EAX_0A_EBX_LAST_LEVEL_CACHE_REFERENCE_EVENT_NOT_AVAILABLE_FEATURE 931
 
       /**
        * [Bit 4] Last-level cache misses event not available if 1.
        */
       uint32_t last_level_cache_misses_event_not_available           : 1;
-#define CPUID_EBX_LAST_LEVEL_CACHE_MISSES_EVENT_NOT_AVAILABLE_BIT    4
-#define CPUID_EBX_LAST_LEVEL_CACHE_MISSES_EVENT_NOT_AVAILABLE_FLAG   0x10
-#define CPUID_EBX_LAST_LEVEL_CACHE_MISSES_EVENT_NOT_AVAILABLE_MASK   0x01
-#define CPUID_EBX_LAST_LEVEL_CACHE_MISSES_EVENT_NOT_AVAILABLE(_)     (((_) >> 4) & 0x01)
+#define CPUID_EAX_0A_EBX_LAST_LEVEL_CACHE_MISSES_EVENT_NOT_AVAILABLE_BIT 4
+#define CPUID_EAX_0A_EBX_LAST_LEVEL_CACHE_MISSES_EVENT_NOT_AVAILABLE_FLAG 0x10
+#define CPUID_EAX_0A_EBX_LAST_LEVEL_CACHE_MISSES_EVENT_NOT_AVAILABLE_MASK 0x01
+#define CPUID_EAX_0A_EBX_LAST_LEVEL_CACHE_MISSES_EVENT_NOT_AVAILABLE(_) (((_) >> 4) & 0x01)
+#define CPUID_EAX_0A_EBX_LAST_LEVEL_CACHE_MISSES_EVENT_NOT_AVAILABLE_FEATURE 932
 
       /**
        * [Bit 5] Branch instruction retired event not available if 1.
        */
       uint32_t branch_instruction_retired_event_not_available        : 1;
-#define CPUID_EBX_BRANCH_INSTRUCTION_RETIRED_EVENT_NOT_AVAILABLE_BIT 5
-#define CPUID_EBX_BRANCH_INSTRUCTION_RETIRED_EVENT_NOT_AVAILABLE_FLAG 0x20
-#define CPUID_EBX_BRANCH_INSTRUCTION_RETIRED_EVENT_NOT_AVAILABLE_MASK 0x01
-#define CPUID_EBX_BRANCH_INSTRUCTION_RETIRED_EVENT_NOT_AVAILABLE(_)  (((_) >> 5) & 0x01)
+#define CPUID_EAX_0A_EBX_BRANCH_INSTRUCTION_RETIRED_EVENT_NOT_AVAILABLE_BIT 5
+#define CPUID_EAX_0A_EBX_BRANCH_INSTRUCTION_RETIRED_EVENT_NOT_AVAILABLE_FLAG 0x20
+#define CPUID_EAX_0A_EBX_BRANCH_INSTRUCTION_RETIRED_EVENT_NOT_AVAILABLE_MASK 0x01
+#define CPUID_EAX_0A_EBX_BRANCH_INSTRUCTION_RETIRED_EVENT_NOT_AVAILABLE(_) (((_) >> 5) & 0x01)
+#define CPUID_EAX_0A_EBX_BRANCH_INSTRUCTION_RETIRED_EVENT_NOT_AVAILABLE_FEATURE 933
 
       /**
        * [Bit 6] Branch mispredict retired event not available if 1.
        */
       uint32_t branch_mispredict_retired_event_not_available         : 1;
-#define CPUID_EBX_BRANCH_MISPREDICT_RETIRED_EVENT_NOT_AVAILABLE_BIT  6
-#define CPUID_EBX_BRANCH_MISPREDICT_RETIRED_EVENT_NOT_AVAILABLE_FLAG 0x40
-#define CPUID_EBX_BRANCH_MISPREDICT_RETIRED_EVENT_NOT_AVAILABLE_MASK 0x01
-#define CPUID_EBX_BRANCH_MISPREDICT_RETIRED_EVENT_NOT_AVAILABLE(_)   (((_) >> 6) & 0x01)
+#define CPUID_EAX_0A_EBX_BRANCH_MISPREDICT_RETIRED_EVENT_NOT_AVAILABLE_BIT 6
+#define CPUID_EAX_0A_EBX_BRANCH_MISPREDICT_RETIRED_EVENT_NOT_AVAILABLE_FLAG 0x40
+#define CPUID_EAX_0A_EBX_BRANCH_MISPREDICT_RETIRED_EVENT_NOT_AVAILABLE_MASK 0x01
+#define CPUID_EAX_0A_EBX_BRANCH_MISPREDICT_RETIRED_EVENT_NOT_AVAILABLE(_) (((_) >> 6) & 0x01)
+#define CPUID_EAX_0A_EBX_BRANCH_MISPREDICT_RETIRED_EVENT_NOT_AVAILABLE_FEATURE 934
       uint32_t reserved1                                             : 25;
     };
 
     uint32_t flags;
   } ebx;
+#define CPUID_EAX_0A_EBX_RESERVED_BITS                               0xFFFFFF80
 
   union
   {
@@ -3888,14 +4197,15 @@ typedef struct
        * [Bits 31:0] ECX is reserved.
        */
       uint32_t reserved                                              : 32;
-#define CPUID_ECX_RESERVED_BIT                                       0
-#define CPUID_ECX_RESERVED_FLAG                                      0xFFFFFFFF
-#define CPUID_ECX_RESERVED_MASK                                      0xFFFFFFFF
-#define CPUID_ECX_RESERVED(_)                                        (((_) >> 0) & 0xFFFFFFFF)
+#define CPUID_EAX_0A_ECX_RESERVED_BIT                                0
+#define CPUID_EAX_0A_ECX_RESERVED_FLAG                               0xFFFFFFFF
+#define CPUID_EAX_0A_ECX_RESERVED_MASK                               0xFFFFFFFF
+#define CPUID_EAX_0A_ECX_RESERVED(_)                                 (((_) >> 0) & 0xFFFFFFFF)
     };
 
     uint32_t flags;
   } ecx;
+#define CPUID_EAX_0A_ECX_RESERVED_BITS                               0xFFFFFFFF
 
   union
   {
@@ -3905,36 +4215,47 @@ typedef struct
        * [Bits 4:0] Number of fixed-function performance counters (if Version ID > 1).
        */
       uint32_t number_of_fixed_function_performance_counters         : 5;
-#define CPUID_EDX_NUMBER_OF_FIXED_FUNCTION_PERFORMANCE_COUNTERS_BIT  0
-#define CPUID_EDX_NUMBER_OF_FIXED_FUNCTION_PERFORMANCE_COUNTERS_FLAG 0x1F
-#define CPUID_EDX_NUMBER_OF_FIXED_FUNCTION_PERFORMANCE_COUNTERS_MASK 0x1F
-#define CPUID_EDX_NUMBER_OF_FIXED_FUNCTION_PERFORMANCE_COUNTERS(_)   (((_) >> 0) & 0x1F)
+#define CPUID_EAX_0A_EDX_NUMBER_OF_FIXED_FUNCTION_PERFORMANCE_COUNTERS_BIT 0
+#define CPUID_EAX_0A_EDX_NUMBER_OF_FIXED_FUNCTION_PERFORMANCE_COUNTERS_FLAG 0x1F
+#define CPUID_EAX_0A_EDX_NUMBER_OF_FIXED_FUNCTION_PERFORMANCE_COUNTERS_MASK 0x1F
+#define CPUID_EAX_0A_EDX_NUMBER_OF_FIXED_FUNCTION_PERFORMANCE_COUNTERS(_) (((_) >> 0) & 0x1F)
 
       /**
        * [Bits 12:5] Bit width of fixed-function performance counters (if Version ID > 1).
        */
       uint32_t bit_width_of_fixed_function_performance_counters      : 8;
-#define CPUID_EDX_BIT_WIDTH_OF_FIXED_FUNCTION_PERFORMANCE_COUNTERS_BIT 5
-#define CPUID_EDX_BIT_WIDTH_OF_FIXED_FUNCTION_PERFORMANCE_COUNTERS_FLAG 0x1FE0
-#define CPUID_EDX_BIT_WIDTH_OF_FIXED_FUNCTION_PERFORMANCE_COUNTERS_MASK 0xFF
-#define CPUID_EDX_BIT_WIDTH_OF_FIXED_FUNCTION_PERFORMANCE_COUNTERS(_) (((_) >> 5) & 0xFF)
+#define CPUID_EAX_0A_EDX_BIT_WIDTH_OF_FIXED_FUNCTION_PERFORMANCE_COUNTERS_BIT 5
+#define CPUID_EAX_0A_EDX_BIT_WIDTH_OF_FIXED_FUNCTION_PERFORMANCE_COUNTERS_FLAG 0x1FE0
+#define CPUID_EAX_0A_EDX_BIT_WIDTH_OF_FIXED_FUNCTION_PERFORMANCE_COUNTERS_MASK 0xFF
+#define CPUID_EAX_0A_EDX_BIT_WIDTH_OF_FIXED_FUNCTION_PERFORMANCE_COUNTERS(_) (((_) >> 5) & 0xFF)
       uint32_t reserved1                                             : 2;
 
       /**
        * [Bit 15] AnyThread deprecation.
        */
       uint32_t any_thread_deprecation                                : 1;
-#define CPUID_EDX_ANY_THREAD_DEPRECATION_BIT                         15
-#define CPUID_EDX_ANY_THREAD_DEPRECATION_FLAG                        0x8000
-#define CPUID_EDX_ANY_THREAD_DEPRECATION_MASK                        0x01
-#define CPUID_EDX_ANY_THREAD_DEPRECATION(_)                          (((_) >> 15) & 0x01)
+#define CPUID_EAX_0A_EDX_ANY_THREAD_DEPRECATION_BIT                  15
+#define CPUID_EAX_0A_EDX_ANY_THREAD_DEPRECATION_FLAG                 0x8000
+#define CPUID_EAX_0A_EDX_ANY_THREAD_DEPRECATION_MASK                 0x01
+#define CPUID_EAX_0A_EDX_ANY_THREAD_DEPRECATION(_)                   (((_) >> 15) & 0x01)
+#define CPUID_EAX_0A_EDX_ANY_THREAD_DEPRECATION_FEATURE              1007
       uint32_t reserved2                                             : 16;
     };
 
     uint32_t flags;
   } edx;
+#define CPUID_EAX_0A_EDX_RESERVED_BITS                               0xFFFF6000
 
 } cpuid_eax_0a;
+#define CPUID_EAX_0A_SNAPSHOT_INDEX                                  7
+#define CPUID_EAX_0A_EAX_POLICY_AND                                  0xFFFFFFFF
+#define CPUID_EAX_0A_EAX_POLICY_OR                                   0x00000000
+#define CPUID_EAX_0A_EBX_POLICY_AND                                  0x0000007F
+#define CPUID_EAX_0A_EBX_POLICY_OR                                   0x00000000
+#define CPUID_EAX_0A_ECX_POLICY_AND                                  0x00000000
+#define CPUID_EAX_0A_ECX_POLICY_OR                                   0x00000000
+#define CPUID_EAX_0A_EDX_POLICY_AND                                  0x00009FFF
+#define CPUID_EAX_0A_EDX_POLICY_OR                                   0x00000000
 
 
 /**
@@ -3965,15 +4286,16 @@ typedef struct
        * @note Software should use this field (EAX[4:0]) to enumerate processor topology of the system.
        */
       uint32_t x2apic_id_to_unique_topology_id_shift                 : 5;
-#define CPUID_EAX_X2APIC_ID_TO_UNIQUE_TOPOLOGY_ID_SHIFT_BIT          0
-#define CPUID_EAX_X2APIC_ID_TO_UNIQUE_TOPOLOGY_ID_SHIFT_FLAG         0x1F
-#define CPUID_EAX_X2APIC_ID_TO_UNIQUE_TOPOLOGY_ID_SHIFT_MASK         0x1F
-#define CPUID_EAX_X2APIC_ID_TO_UNIQUE_TOPOLOGY_ID_SHIFT(_)           (((_) >> 0) & 0x1F)
+#define CPUID_EAX_0B_EAX_X2APIC_ID_TO_UNIQUE_TOPOLOGY_ID_SHIFT_BIT   0
+#define CPUID_EAX_0B_EAX_X2APIC_ID_TO_UNIQUE_TOPOLOGY_ID_SHIFT_FLAG  0x1F
+#define CPUID_EAX_0B_EAX_X2APIC_ID_TO_UNIQUE_TOPOLOGY_ID_SHIFT_MASK  0x1F
+#define CPUID_EAX_0B_EAX_X2APIC_ID_TO_UNIQUE_TOPOLOGY_ID_SHIFT(_)    (((_) >> 0) & 0x1F)
       uint32_t reserved1                                             : 27;
     };
 
     uint32_t flags;
   } eax;
+#define CPUID_EAX_0B_EAX_RESERVED_BITS                               0xFFFFFFE0
 
   union
   {
@@ -3988,15 +4310,16 @@ typedef struct
        *       configurations.
        */
       uint32_t number_of_logical_processors_at_this_level_type       : 16;
-#define CPUID_EBX_NUMBER_OF_LOGICAL_PROCESSORS_AT_THIS_LEVEL_TYPE_BIT 0
-#define CPUID_EBX_NUMBER_OF_LOGICAL_PROCESSORS_AT_THIS_LEVEL_TYPE_FLAG 0xFFFF
-#define CPUID_EBX_NUMBER_OF_LOGICAL_PROCESSORS_AT_THIS_LEVEL_TYPE_MASK 0xFFFF
-#define CPUID_EBX_NUMBER_OF_LOGICAL_PROCESSORS_AT_THIS_LEVEL_TYPE(_) (((_) >> 0) & 0xFFFF)
+#define CPUID_EAX_0B_EBX_NUMBER_OF_LOGICAL_PROCESSORS_AT_THIS_LEVEL_TYPE_BIT 0
+#define CPUID_EAX_0B_EBX_NUMBER_OF_LOGICAL_PROCESSORS_AT_THIS_LEVEL_TYPE_FLAG 0xFFFF
+#define CPUID_EAX_0B_EBX_NUMBER_OF_LOGICAL_PROCESSORS_AT_THIS_LEVEL_TYPE_MASK 0xFFFF
+#define CPUID_EAX_0B_EBX_NUMBER_OF_LOGICAL_PROCESSORS_AT_THIS_LEVEL_TYPE(_) (((_) >> 0) & 0xFFFF)
       uint32_t reserved1                                             : 16;
     };
 
     uint32_t flags;
   } ebx;
+#define CPUID_EAX_0B_EBX_RESERVED_BITS                               0xFFFF0000
 
   union
   {
@@ -4006,10 +4329,10 @@ typedef struct
        * [Bits 7:0] Level number. Same value in ECX input.
        */
       uint32_t level_number                                          : 8;
-#define CPUID_ECX_LEVEL_NUMBER_BIT                                   0
-#define CPUID_ECX_LEVEL_NUMBER_FLAG                                  0xFF
-#define CPUID_ECX_LEVEL_NUMBER_MASK                                  0xFF
-#define CPUID_ECX_LEVEL_NUMBER(_)                                    (((_) >> 0) & 0xFF)
+#define CPUID_EAX_0B_ECX_LEVEL_NUMBER_BIT                            0
+#define CPUID_EAX_0B_ECX_LEVEL_NUMBER_FLAG                           0xFF
+#define CPUID_EAX_0B_ECX_LEVEL_NUMBER_MASK                           0xFF
+#define CPUID_EAX_0B_ECX_LEVEL_NUMBER(_)                             (((_) >> 0) & 0xFF)
 
       /**
        * [Bits 15:8] Level type.
@@ -4022,15 +4345,16 @@ typedef struct
        *       - 3-255: Reserved.
        */
       uint32_t level_type                                            : 8;
-#define CPUID_ECX_LEVEL_TYPE_BIT                                     8
-#define CPUID_ECX_LEVEL_TYPE_FLAG                                    0xFF00
-#define CPUID_ECX_LEVEL_TYPE_MASK                                    0xFF
-#define CPUID_ECX_LEVEL_TYPE(_)                                      (((_) >> 8) & 0xFF)
+#define CPUID_EAX_0B_ECX_LEVEL_TYPE_BIT                              8
+#define CPUID_EAX_0B_ECX_LEVEL_TYPE_FLAG                             0xFF00
+#define CPUID_EAX_0B_ECX_LEVEL_TYPE_MASK                             0xFF
+#define CPUID_EAX_0B_ECX_LEVEL_TYPE(_)                               (((_) >> 8) & 0xFF)
       uint32_t reserved1                                             : 16;
     };
 
     uint32_t flags;
   } ecx;
+#define CPUID_EAX_0B_ECX_RESERVED_BITS                               0xFFFF0000
 
   union
   {
@@ -4040,14 +4364,15 @@ typedef struct
        * [Bits 31:0] x2APIC ID the current logical processor.
        */
       uint32_t x2apic_id                                             : 32;
-#define CPUID_EDX_X2APIC_ID_BIT                                      0
-#define CPUID_EDX_X2APIC_ID_FLAG                                     0xFFFFFFFF
-#define CPUID_EDX_X2APIC_ID_MASK                                     0xFFFFFFFF
-#define CPUID_EDX_X2APIC_ID(_)                                       (((_) >> 0) & 0xFFFFFFFF)
+#define CPUID_EAX_0B_EDX_X2APIC_ID_BIT                               0
+#define CPUID_EAX_0B_EDX_X2APIC_ID_FLAG                              0xFFFFFFFF
+#define CPUID_EAX_0B_EDX_X2APIC_ID_MASK                              0xFFFFFFFF
+#define CPUID_EAX_0B_EDX_X2APIC_ID(_)                                (((_) >> 0) & 0xFFFFFFFF)
     };
 
     uint32_t flags;
   } edx;
+#define CPUID_EAX_0B_EDX_RESERVED_BITS                               0x00
 
 } cpuid_eax_0b;
 
@@ -4083,79 +4408,86 @@ typedef struct
        * [Bit 0] x87 state.
        */
       uint32_t x87_state                                             : 1;
-#define CPUID_EAX_X87_STATE_BIT                                      0
-#define CPUID_EAX_X87_STATE_FLAG                                     0x01
-#define CPUID_EAX_X87_STATE_MASK                                     0x01
-#define CPUID_EAX_X87_STATE(_)                                       (((_) >> 0) & 0x01)
+#define CPUID_EAX_0D_ECX_00_EAX_X87_STATE_BIT                        0
+#define CPUID_EAX_0D_ECX_00_EAX_X87_STATE_FLAG                       0x01
+#define CPUID_EAX_0D_ECX_00_EAX_X87_STATE_MASK                       0x01
+#define CPUID_EAX_0D_ECX_00_EAX_X87_STATE(_)                         (((_) >> 0) & 0x01)
+#define CPUID_EAX_0D_ECX_00_EAX_X87_STATE_FEATURE                    1024
 
       /**
        * [Bit 1] SSE state.
        */
       uint32_t sse_state                                             : 1;
-#define CPUID_EAX_SSE_STATE_BIT                                      1
-#define CPUID_EAX_SSE_STATE_FLAG                                     0x02
-#define CPUID_EAX_SSE_STATE_MASK                                     0x01
-#define CPUID_EAX_SSE_STATE(_)                                       (((_) >> 1) & 0x01)
+#define CPUID_EAX_0D_ECX_00_EAX_SSE_STATE_BIT                        1
+#define CPUID_EAX_0D_ECX_00_EAX_SSE_STATE_FLAG                       0x02
+#define CPUID_EAX_0D_ECX_00_EAX_SSE_STATE_MASK                       0x01
+#define CPUID_EAX_0D_ECX_00_EAX_SSE_STATE(_)                         (((_) >> 1) & 0x01)
+#define CPUID_EAX_0D_ECX_00_EAX_SSE_STATE_FEATURE                    1025
 
       /**
        * [Bit 2] AVX state.
        */
       uint32_t avx_state                                             : 1;
-#define CPUID_EAX_AVX_STATE_BIT                                      2
-#define CPUID_EAX_AVX_STATE_FLAG                                     0x04
-#define CPUID_EAX_AVX_STATE_MASK                                     0x01
-#define CPUID_EAX_AVX_STATE(_)                                       (((_) >> 2) & 0x01)
+#define CPUID_EAX_0D_ECX_00_EAX_AVX_STATE_BIT                        2
+#define CPUID_EAX_0D_ECX_00_EAX_AVX_STATE_FLAG                       0x04
+#define CPUID_EAX_0D_ECX_00_EAX_AVX_STATE_MASK                       0x01
+#define CPUID_EAX_0D_ECX_00_EAX_AVX_STATE(_)                         (((_) >> 2) & 0x01)
+#define CPUID_EAX_0D_ECX_00_EAX_AVX_STATE_FEATURE                    1026
 
       /**
        * [Bits 4:3] MPX state.
        */
       uint32_t mpx_state                                             : 2;
-#define CPUID_EAX_MPX_STATE_BIT                                      3
-#define CPUID_EAX_MPX_STATE_FLAG                                     0x18
-#define CPUID_EAX_MPX_STATE_MASK                                     0x03
-#define CPUID_EAX_MPX_STATE(_)                                       (((_) >> 3) & 0x03)
+#define CPUID_EAX_0D_ECX_00_EAX_MPX_STATE_BIT                        3
+#define CPUID_EAX_0D_ECX_00_EAX_MPX_STATE_FLAG                       0x18
+#define CPUID_EAX_0D_ECX_00_EAX_MPX_STATE_MASK                       0x03
+#define CPUID_EAX_0D_ECX_00_EAX_MPX_STATE(_)                         (((_) >> 3) & 0x03)
 
       /**
        * [Bits 7:5] AVX-512 state.
        */
       uint32_t avx_512_state                                         : 3;
-#define CPUID_EAX_AVX_512_STATE_BIT                                  5
-#define CPUID_EAX_AVX_512_STATE_FLAG                                 0xE0
-#define CPUID_EAX_AVX_512_STATE_MASK                                 0x07
-#define CPUID_EAX_AVX_512_STATE(_)                                   (((_) >> 5) & 0x07)
+#define CPUID_EAX_0D_ECX_00_EAX_AVX_512_STATE_BIT                    5
+#define CPUID_EAX_0D_ECX_00_EAX_AVX_512_STATE_FLAG                   0xE0
+#define CPUID_EAX_0D_ECX_00_EAX_AVX_512_STATE_MASK                   0x07
+#define CPUID_EAX_0D_ECX_00_EAX_AVX_512_STATE(_)                     (((_) >> 5) & 0x07)
 
       /**
        * [Bit 8] Used for IA32_XSS.
        */
       uint32_t used_for_ia32_xss_1                                   : 1;
-#define CPUID_EAX_USED_FOR_IA32_XSS_1_BIT                            8
-#define CPUID_EAX_USED_FOR_IA32_XSS_1_FLAG                           0x100
-#define CPUID_EAX_USED_FOR_IA32_XSS_1_MASK                           0x01
-#define CPUID_EAX_USED_FOR_IA32_XSS_1(_)                             (((_) >> 8) & 0x01)
+#define CPUID_EAX_0D_ECX_00_EAX_USED_FOR_IA32_XSS_1_BIT              8
+#define CPUID_EAX_0D_ECX_00_EAX_USED_FOR_IA32_XSS_1_FLAG             0x100
+#define CPUID_EAX_0D_ECX_00_EAX_USED_FOR_IA32_XSS_1_MASK             0x01
+#define CPUID_EAX_0D_ECX_00_EAX_USED_FOR_IA32_XSS_1(_)               (((_) >> 8) & 0x01)
+#define CPUID_EAX_0D_ECX_00_EAX_USED_FOR_IA32_XSS_1_FEATURE          1032
 
       /**
        * [Bit 9] PKRU state.
        */
       uint32_t pkru_state                                            : 1;
-#define CPUID_EAX_PKRU_STATE_BIT                                     9
-#define CPUID_EAX_PKRU_STATE_FLAG                                    0x200
-#define CPUID_EAX_PKRU_STATE_MASK                                    0x01
-#define CPUID_EAX_PKRU_STATE(_)                                      (((_) >> 9) & 0x01)
+#define CPUID_EAX_0D_ECX_00_EAX_PKRU_STATE_BIT                       9
+#define CPUID_EAX_0D_ECX_00_EAX_PKRU_STATE_FLAG                      0x200
+#define CPUID_EAX_0D_ECX_00_EAX_PKRU_STATE_MASK                      0x01
+#define CPUID_EAX_0D_ECX_00_EAX_PKRU_STATE(_)                        (((_) >> 9) & 0x01)
+#define CPUID_EAX_0D_ECX_00_EAX_PKRU_STATE_FEATURE                   1033
       uint32_t reserved1                                             : 3;
 
       /**
        * [Bit 13] Used for IA32_XSS.
        */
       uint32_t used_for_ia32_xss_2                                   : 1;
-#define CPUID_EAX_USED_FOR_IA32_XSS_2_BIT                            13
-#define CPUID_EAX_USED_FOR_IA32_XSS_2_FLAG                           0x2000
-#define CPUID_EAX_USED_FOR_IA32_XSS_2_MASK                           0x01
-#define CPUID_EAX_USED_FOR_IA32_XSS_2(_)                             (((_) >> 13) & 0x01)
+#define CPUID_EAX_0D_ECX_00_EAX_USED_FOR_IA32_XSS_2_BIT              13
+#define CPUID_EAX_0D_ECX_00_EAX_USED_FOR_IA32_XSS_2_FLAG             0x2000
+#define CPUID_EAX_0D_ECX_00_EAX_USED_FOR_IA32_XSS_2_MASK             0x01
+#define CPUID_EAX_0D_ECX_00_EAX_USED_FOR_IA32_XSS_2(_)               (((_) >> 13) & 0x01)
+#define CPUID_EAX_0D_ECX_00_EAX_USED_FOR_IA32_XSS_2_FEATURE          1037
       uint32_t reserved2                                             : 18;
     };
 
     uint32_t flags;
   } eax;
+#define CPUID_EAX_0D_ECX_00_EAX_RESERVED_BITS                        0xFFFFDC00
 
   union
   {
@@ -4166,14 +4498,15 @@ typedef struct
        * May be different than ECX if some features at the end of the XSAVE save area are not enabled.
        */
       uint32_t max_size_required_by_enabled_features_in_xcr0         : 32;
-#define CPUID_EBX_MAX_SIZE_REQUIRED_BY_ENABLED_FEATURES_IN_XCR0_BIT  0
-#define CPUID_EBX_MAX_SIZE_REQUIRED_BY_ENABLED_FEATURES_IN_XCR0_FLAG 0xFFFFFFFF
-#define CPUID_EBX_MAX_SIZE_REQUIRED_BY_ENABLED_FEATURES_IN_XCR0_MASK 0xFFFFFFFF
-#define CPUID_EBX_MAX_SIZE_REQUIRED_BY_ENABLED_FEATURES_IN_XCR0(_)   (((_) >> 0) & 0xFFFFFFFF)
+#define CPUID_EAX_0D_ECX_00_EBX_MAX_SIZE_REQUIRED_BY_ENABLED_FEATURES_IN_XCR0_BIT 0
+#define CPUID_EAX_0D_ECX_00_EBX_MAX_SIZE_REQUIRED_BY_ENABLED_FEATURES_IN_XCR0_FLAG 0xFFFFFFFF
+#define CPUID_EAX_0D_ECX_00_EBX_MAX_SIZE_REQUIRED_BY_ENABLED_FEATURES_IN_XCR0_MASK 0xFFFFFFFF
+#define CPUID_EAX_0D_ECX_00_EBX_MAX_SIZE_REQUIRED_BY_ENABLED_FEATURES_IN_XCR0(_) (((_) >> 0) & 0xFFFFFFFF)
     };
 
     uint32_t flags;
   } ebx;
+#define CPUID_EAX_0D_ECX_00_EBX_RESERVED_BITS                        0x00
 
   union
   {
@@ -4184,14 +4517,15 @@ typedef struct
        * required by all supported features in the processor, i.e., all the valid bit fields in XCR0.
        */
       uint32_t max_size_of_xsave_xrstor_save_area                    : 32;
-#define CPUID_ECX_MAX_SIZE_OF_XSAVE_XRSTOR_SAVE_AREA_BIT             0
-#define CPUID_ECX_MAX_SIZE_OF_XSAVE_XRSTOR_SAVE_AREA_FLAG            0xFFFFFFFF
-#define CPUID_ECX_MAX_SIZE_OF_XSAVE_XRSTOR_SAVE_AREA_MASK            0xFFFFFFFF
-#define CPUID_ECX_MAX_SIZE_OF_XSAVE_XRSTOR_SAVE_AREA(_)              (((_) >> 0) & 0xFFFFFFFF)
+#define CPUID_EAX_0D_ECX_00_ECX_MAX_SIZE_OF_XSAVE_XRSTOR_SAVE_AREA_BIT 0
+#define CPUID_EAX_0D_ECX_00_ECX_MAX_SIZE_OF_XSAVE_XRSTOR_SAVE_AREA_FLAG 0xFFFFFFFF
+#define CPUID_EAX_0D_ECX_00_ECX_MAX_SIZE_OF_XSAVE_XRSTOR_SAVE_AREA_MASK 0xFFFFFFFF
+#define CPUID_EAX_0D_ECX_00_ECX_MAX_SIZE_OF_XSAVE_XRSTOR_SAVE_AREA(_) (((_) >> 0) & 0xFFFFFFFF)
     };
 
     uint32_t flags;
   } ecx;
+#define CPUID_EAX_0D_ECX_00_ECX_RESERVED_BITS                        0x00
 
   union
   {
@@ -4201,16 +4535,26 @@ typedef struct
        * [Bits 31:0] Reports the supported bits of the upper 32 bits of XCR0. XCR0[n+32] can be set to 1 only if EDX[n] is 1.
        */
       uint32_t xcr0_supported_bits                                   : 32;
-#define CPUID_EDX_XCR0_SUPPORTED_BITS_BIT                            0
-#define CPUID_EDX_XCR0_SUPPORTED_BITS_FLAG                           0xFFFFFFFF
-#define CPUID_EDX_XCR0_SUPPORTED_BITS_MASK                           0xFFFFFFFF
-#define CPUID_EDX_XCR0_SUPPORTED_BITS(_)                             (((_) >> 0) & 0xFFFFFFFF)
+#define CPUID_EAX_0D_ECX_00_EDX_XCR0_SUPPORTED_BITS_BIT              0
+#define CPUID_EAX_0D_ECX_00_EDX_XCR0_SUPPORTED_BITS_FLAG             0xFFFFFFFF
+#define CPUID_EAX_0D_ECX_00_EDX_XCR0_SUPPORTED_BITS_MASK             0xFFFFFFFF
+#define CPUID_EAX_0D_ECX_00_EDX_XCR0_SUPPORTED_BITS(_)               (((_) >> 0) & 0xFFFFFFFF)
     };
 
     uint32_t flags;
   } edx;
+#define CPUID_EAX_0D_ECX_00_EDX_RESERVED_BITS                        0x00
 
 } cpuid_eax_0d_ecx_00;
+#define CPUID_EAX_0D_ECX_00_SNAPSHOT_INDEX                           8
+#define CPUID_EAX_0D_ECX_00_EAX_POLICY_AND                           0x000023FF
+#define CPUID_EAX_0D_ECX_00_EAX_POLICY_OR                            0x00000000
+#define CPUID_EAX_0D_ECX_00_EBX_POLICY_AND                           0xFFFFFFFF
+#define CPUID_EAX_0D_ECX_00_EBX_POLICY_OR                            0x00000000
+#define CPUID_EAX_0D_ECX_00_ECX_POLICY_AND                           0xFFFFFFFF
+#define CPUID_EAX_0D_ECX_00_ECX_POLICY_OR                            0x00000000
+#define CPUID_EAX_0D_ECX_00_EDX_POLICY_AND                           0xFFFFFFFF
+#define CPUID_EAX_0D_ECX_00_EDX_POLICY_OR                            0x00000000
 
 /**
  * @brief Direct Cache Access Information Leaf
@@ -4227,33 +4571,37 @@ typedef struct
        * [Bit 1] Supports XSAVEC and the compacted form of XRSTOR if set.
        */
       uint32_t supports_xsavec_and_compacted_xrstor                  : 1;
-#define CPUID_EAX_SUPPORTS_XSAVEC_AND_COMPACTED_XRSTOR_BIT           1
-#define CPUID_EAX_SUPPORTS_XSAVEC_AND_COMPACTED_XRSTOR_FLAG          0x02
-#define CPUID_EAX_SUPPORTS_XSAVEC_AND_COMPACTED_XRSTOR_MASK          0x01
-#define CPUID_EAX_SUPPORTS_XSAVEC_AND_COMPACTED_XRSTOR(_)            (((_) >> 1) & 0x01)
+#define CPUID_EAX_0D_ECX_01_EAX_SUPPORTS_XSAVEC_AND_COMPACTED_XRSTOR_BIT 1
+#define CPUID_EAX_0D_ECX_01_EAX_SUPPORTS_XSAVEC_AND_COMPACTED_XRSTOR_FLAG 0x02
+#define CPUID_EAX_0D_ECX_01_EAX_SUPPORTS_XSAVEC_AND_COMPACTED_XRSTOR_MASK 0x01
+#define CPUID_EAX_0D_ECX_01_EAX_SUPPORTS_XSAVEC_AND_COMPACTED_XRSTOR(_) (((_) >> 1) & 0x01)
+#define CPUID_EAX_0D_ECX_01_EAX_SUPPORTS_XSAVEC_AND_COMPACTED_XRSTOR_FEATURE 1153
 
       /**
        * [Bit 2] Supports XGETBV with ECX = 1 if set.
        */
       uint32_t supports_xgetbv_with_ecx_1                            : 1;
-#define CPUID_EAX_SUPPORTS_XGETBV_WITH_ECX_1_BIT                     2
-#define CPUID_EAX_SUPPORTS_XGETBV_WITH_ECX_1_FLAG                    0x04
-#define CPUID_EAX_SUPPORTS_XGETBV_WITH_ECX_1_MASK                    0x01
-#define CPUID_EAX_SUPPORTS_XGETBV_WITH_ECX_1(_)                      (((_) >> 2) & 0x01)
+#define CPUID_EAX_0D_ECX_01_EAX_SUPPORTS_XGETBV_WITH_ECX_1_BIT       2
+#define CPUID_EAX_0D_ECX_01_EAX_SUPPORTS_XGETBV_WITH_ECX_1_FLAG      0x04
+#define CPUID_EAX_0D_ECX_01_EAX_SUPPORTS_XGETBV_WITH_ECX_1_MASK      0x01
+#define CPUID_EAX_0D_ECX_01_EAX_SUPPORTS_XGETBV_WITH_ECX_1(_)        (((_) >> 2) & 0x01)
+#define CPUID_EAX_0D_ECX_01_EAX_SUPPORTS_XGETBV_WITH_ECX_1_FEATURE   1154
 
       /**
        * [Bit 3] Supports XSAVES/XRSTORS and IA32_XSS if set.
        */
       uint32_t supports_xsave_xrstor_and_ia32_xss                    : 1;
-#define CPUID_EAX_SUPPORTS_XSAVE_XRSTOR_AND_IA32_XSS_BIT             3
-#define CPUID_EAX_SUPPORTS_XSAVE_XRSTOR_AND_IA32_XSS_FLAG            0x08
-#define CPUID_EAX_SUPPORTS_XSAVE_XRSTOR_AND_IA32_XSS_MASK            0x01
-#define CPUID_EAX_SUPPORTS_XSAVE_XRSTOR_AND_IA32_XSS(_)              (((_) >> 3) & 0x01)
+#define CPUID_EAX_0D_ECX_01_EAX_SUPPORTS_XSAVE_XRSTOR_AND_IA32_XSS_BIT 3
+#define CPUID_EAX_0D_ECX_01_EAX_SUPPORTS_XSAVE_XRSTOR_AND_IA32_XSS_FLAG 0x08
+#define CPUID_EAX_0D_ECX_01_EAX_SUPPORTS_XSAVE_XRSTOR_AND_IA32_XSS_MASK 0x01
+#define CPUID_EAX_0D_ECX_01_EAX_SUPPORTS_XSAVE_XRSTOR_AND_IA32_XSS(_) (((_) >> 3) & 0x01)
+#define CPUID_EAX_0D_ECX_01_EAX_SUPPORTS_XSAVE_XRSTOR_AND_IA32_XSS_FEATURE 1155
       uint32_t reserved2                                             : 28;
     };
 
     uint32_t flags;
   } eax;
+#define CPUID_EAX_0D_ECX_01_EAX_RESERVED_BITS                        0xFFFFFFF1
 
   union
   {
@@ -4263,14 +4611,15 @@ typedef struct
        * [Bits 31:0] The size in bytes of the XSAVE area containing all states enabled by XCRO | IA32_XSS.
        */
       uint32_t size_of_xsave_aread                                   : 32;
-#define CPUID_EBX_SIZE_OF_XSAVE_AREAD_BIT                            0
-#define CPUID_EBX_SIZE_OF_XSAVE_AREAD_FLAG                           0xFFFFFFFF
-#define CPUID_EBX_SIZE_OF_XSAVE_AREAD_MASK                           0xFFFFFFFF
-#define CPUID_EBX_SIZE_OF_XSAVE_AREAD(_)                             (((_) >> 0) & 0xFFFFFFFF)
+#define CPUID_EAX_0D_ECX_01_EBX_SIZE_OF_XSAVE_AREAD_BIT              0
+#define CPUID_EAX_0D_ECX_01_EBX_SIZE_OF_XSAVE_AREAD_FLAG             0xFFFFFFFF
+#define CPUID_EAX_0D_ECX_01_EBX_SIZE_OF_XSAVE_AREAD_MASK             0xFFFFFFFF
+#define CPUID_EAX_0D_ECX_01_EBX_SIZE_OF_XSAVE_AREAD(_)               (((_) >> 0) & 0xFFFFFFFF)
     };
 
     uint32_t flags;
   } ebx;
+#define CPUID_EAX_0D_ECX_01_EBX_RESERVED_BITS                        0x00
 
   union
   {
@@ -4280,80 +4629,88 @@ typedef struct
        * [Bits 7:0] Used for XCR0.
        */
       uint32_t used_for_xcr0_1                                       : 8;
-#define CPUID_ECX_USED_FOR_XCR0_1_BIT                                0
-#define CPUID_ECX_USED_FOR_XCR0_1_FLAG                               0xFF
-#define CPUID_ECX_USED_FOR_XCR0_1_MASK                               0xFF
-#define CPUID_ECX_USED_FOR_XCR0_1(_)                                 (((_) >> 0) & 0xFF)
+#define CPUID_EAX_0D_ECX_01_ECX_USED_FOR_XCR0_1_BIT                  0
+#define CPUID_EAX_0D_ECX_01_ECX_USED_FOR_XCR0_1_FLAG                 0xFF
+#define CPUID_EAX_0D_ECX_01_ECX_USED_FOR_XCR0_1_MASK                 0xFF
+#define CPUID_EAX_0D_ECX_01_ECX_USED_FOR_XCR0_1(_)                   (((_) >> 0) & 0xFF)
 
       /**
        * [Bit 8] PT state.
        */
       uint32_t pt_state                                              : 1;
-#define CPUID_ECX_PT_STATE_BIT                                       8
-#define CPUID_ECX_PT_STATE_FLAG                                      0x100
-#define CPUID_ECX_PT_STATE_MASK                                      0x01
-#define CPUID_ECX_PT_STATE(_)                                        (((_) >> 8) & 0x01)
+#define CPUID_EAX_0D_ECX_01_ECX_PT_STATE_BIT                         8
+#define CPUID_EAX_0D_ECX_01_ECX_PT_STATE_FLAG                        0x100
+#define CPUID_EAX_0D_ECX_01_ECX_PT_STATE_MASK                        0x01
+#define CPUID_EAX_0D_ECX_01_ECX_PT_STATE(_)                          (((_) >> 8) & 0x01)
+#define CPUID_EAX_0D_ECX_01_ECX_PT_STATE_FEATURE                     1224
 
       /**
        * [Bit 9] Used for XCR0.
        */
       uint32_t used_for_xcr0_2                                       : 1;
-#define CPUID_ECX_USED_FOR_XCR0_2_BIT                                9
-#define CPUID_ECX_USED_FOR_XCR0_2_FLAG                               0x200
-#define CPUID_ECX_USED_FOR_XCR0_2_MASK                               0x01
-#define CPUID_ECX_USED_FOR_XCR0_2(_)                                 (((_) >> 9) & 0x01)
+#define CPUID_EAX_0D_ECX_01_ECX_USED_FOR_XCR0_2_BIT                  9
+#define CPUID_EAX_0D_ECX_01_ECX_USED_FOR_XCR0_2_FLAG                 0x200
+#define CPUID_EAX_0D_ECX_01_ECX_USED_FOR_XCR0_2_MASK                 0x01
+#define CPUID_EAX_0D_ECX_01_ECX_USED_FOR_XCR0_2(_)                   (((_) >> 9) & 0x01)
+#define CPUID_EAX_0D_ECX_01_ECX_USED_FOR_XCR0_2_FEATURE              1225
       uint32_t reserved1                                             : 1;
 
       /**
        * [Bit 11] CET user state.
        */
       uint32_t cet_user_state                                        : 1;
-#define CPUID_ECX_CET_USER_STATE_BIT                                 11
-#define CPUID_ECX_CET_USER_STATE_FLAG                                0x800
-#define CPUID_ECX_CET_USER_STATE_MASK                                0x01
-#define CPUID_ECX_CET_USER_STATE(_)                                  (((_) >> 11) & 0x01)
+#define CPUID_EAX_0D_ECX_01_ECX_CET_USER_STATE_BIT                   11
+#define CPUID_EAX_0D_ECX_01_ECX_CET_USER_STATE_FLAG                  0x800
+#define CPUID_EAX_0D_ECX_01_ECX_CET_USER_STATE_MASK                  0x01
+#define CPUID_EAX_0D_ECX_01_ECX_CET_USER_STATE(_)                    (((_) >> 11) & 0x01)
+#define CPUID_EAX_0D_ECX_01_ECX_CET_USER_STATE_FEATURE               1227
 
       /**
        * [Bit 12] CET supervisor state.
        */
       uint32_t cet_supervisor_state                                  : 1;
-#define CPUID_ECX_CET_SUPERVISOR_STATE_BIT                           12
-#define CPUID_ECX_CET_SUPERVISOR_STATE_FLAG                          0x1000
-#define CPUID_ECX_CET_SUPERVISOR_STATE_MASK                          0x01
-#define CPUID_ECX_CET_SUPERVISOR_STATE(_)                            (((_) >> 12) & 0x01)
+#define CPUID_EAX_0D_ECX_01_ECX_CET_SUPERVISOR_STATE_BIT             12
+#define CPUID_EAX_0D_ECX_01_ECX_CET_SUPERVISOR_STATE_FLAG            0x1000
+#define CPUID_EAX_0D_ECX_01_ECX_CET_SUPERVISOR_STATE_MASK            0x01
+#define CPUID_EAX_0D_ECX_01_ECX_CET_SUPERVISOR_STATE(_)              (((_) >> 12) & 0x01)
+#define CPUID_EAX_0D_ECX_01_ECX_CET_SUPERVISOR_STATE_FEATURE         1228
 
       /**
        * [Bit 13] HDC state.
        */
       uint32_t hdc_state                                             : 1;
-#define CPUID_ECX_HDC_STATE_BIT                                      13
-#define CPUID_ECX_HDC_STATE_FLAG                                     0x2000
-#define CPUID_ECX_HDC_STATE_MASK                                     0x01
-#define CPUID_ECX_HDC_STATE(_)                                       (((_) >> 13) & 0x01)
+#define CPUID_EAX_0D_ECX_01_ECX_HDC_STATE_BIT                        13
+#define CPUID_EAX_0D_ECX_01_ECX_HDC_STATE_FLAG                       0x2000
+#define CPUID_EAX_0D_ECX_01_ECX_HDC_STATE_MASK                       0x01
+#define CPUID_EAX_0D_ECX_01_ECX_HDC_STATE(_)                         (((_) >> 13) & 0x01)
+#define CPUID_EAX_0D_ECX_01_ECX_HDC_STATE_FEATURE                    1229
       uint32_t reserved2                                             : 1;
 
       /**
        * [Bit 15] LBR state.
        */
       uint32_t lbr_state                                             : 1;
-#define CPUID_ECX_LBR_STATE_BIT                                      15
-#define CPUID_ECX_LBR_STATE_FLAG                                     0x8000
-#define CPUID_ECX_LBR_STATE_MASK                                     0x01
-#define CPUID_ECX_LBR_STATE(_)                                       (((_) >> 15) & 0x01)
+#define CPUID_EAX_0D_ECX_01_ECX_LBR_STATE_BIT                        15
+#define CPUID_EAX_0D_ECX_01_ECX_LBR_STATE_FLAG                       0x8000
+#define CPUID_EAX_0D_ECX_01_ECX_LBR_STATE_MASK                       0x01
+#define CPUID_EAX_0D_ECX_01_ECX_LBR_STATE(_)                         (((_) >> 15) & 0x01)
+#define CPUID_EAX_0D_ECX_01_ECX_LBR_STATE_FEATURE                    1231
 
       /**
        * [Bit 16] HWP state.
        */
       uint32_t hwp_state                                             : 1;
-#define CPUID_ECX_HWP_STATE_BIT                                      16
-#define CPUID_ECX_HWP_STATE_FLAG                                     0x10000
-#define CPUID_ECX_HWP_STATE_MASK                                     0x01
-#define CPUID_ECX_HWP_STATE(_)                                       (((_) >> 16) & 0x01)
+#define CPUID_EAX_0D_ECX_01_ECX_HWP_STATE_BIT                        16
+#define CPUID_EAX_0D_ECX_01_ECX_HWP_STATE_FLAG                       0x10000
+#define CPUID_EAX_0D_ECX_01_ECX_HWP_STATE_MASK                       0x01
+#define CPUID_EAX_0D_ECX_01_ECX_HWP_STATE(_)                         (((_) >> 16) & 0x01)
+#define CPUID_EAX_0D_ECX_01_ECX_HWP_STATE_FEATURE                    1232
       uint32_t reserved3                                             : 15;
     };
 
     uint32_t flags;
   } ecx;
+#define CPUID_EAX_0D_ECX_01_ECX_RESERVED_BITS                        0xFFFE4400
 
   union
   {
@@ -4364,16 +4721,26 @@ typedef struct
        * EDX[n] is 1
        */
       uint32_t supported_upper_ia32_xss_bits                         : 32;
-#define CPUID_EDX_SUPPORTED_UPPER_IA32_XSS_BITS_BIT                  0
-#define CPUID_EDX_SUPPORTED_UPPER_IA32_XSS_BITS_FLAG                 0xFFFFFFFF
-#define CPUID_EDX_SUPPORTED_UPPER_IA32_XSS_BITS_MASK                 0xFFFFFFFF
-#define CPUID_EDX_SUPPORTED_UPPER_IA32_XSS_BITS(_)                   (((_) >> 0) & 0xFFFFFFFF)
+#define CPUID_EAX_0D_ECX_01_EDX_SUPPORTED_UPPER_IA32_XSS_BITS_BIT    0
+#define CPUID_EAX_0D_ECX_01_EDX_SUPPORTED_UPPER_IA32_XSS_BITS_FLAG   0xFFFFFFFF
+#define CPUID_EAX_0D_ECX_01_EDX_SUPPORTED_UPPER_IA32_XSS_BITS_MASK   0xFFFFFFFF
+#define CPUID_EAX_0D_ECX_01_EDX_SUPPORTED_UPPER_IA32_XSS_BITS(_)     (((_) >> 0) & 0xFFFFFFFF)
     };
 
     uint32_t flags;
   } edx;
+#define CPUID_EAX_0D_ECX_01_EDX_RESERVED_BITS                        0x00
 
 } cpuid_eax_0d_ecx_01;
+#define CPUID_EAX_0D_ECX_01_SNAPSHOT_INDEX                           9
+#define CPUID_EAX_0D_ECX_01_EAX_POLICY_AND                           0x0000000E
+#define CPUID_EAX_0D_ECX_01_EAX_POLICY_OR                            0x00000000
+#define CPUID_EAX_0D_ECX_01_EBX_POLICY_AND                           0xFFFFFFFF
+#define CPUID_EAX_0D_ECX_01_EBX_POLICY_OR                            0x00000000
+#define CPUID_EAX_0D_ECX_01_ECX_POLICY_AND                           0x0001BBFF
+#define CPUID_EAX_0D_ECX_01_ECX_POLICY_OR                            0x00000000
+#define CPUID_EAX_0D_ECX_01_EDX_POLICY_AND                           0xFFFFFFFF
+#define CPUID_EAX_0D_ECX_01_EDX_POLICY_OR                            0x00000000
 
 /**
  * @brief Processor Extended State Enumeration Sub-leaves (EAX = 0DH, ECX = n, n > 1)
@@ -4394,15 +4761,16 @@ typedef struct
        * [Bits 31:0] The size in bytes (from the offset specified in EBX) of the save area for an extended state feature
        * associated with a valid sub-leaf index, n.
        */
-      uint32_t ia32_platform_dca_cap                                 : 32;
-#define CPUID_EAX_IA32_PLATFORM_DCA_CAP_BIT                          0
-#define CPUID_EAX_IA32_PLATFORM_DCA_CAP_FLAG                         0xFFFFFFFF
-#define CPUID_EAX_IA32_PLATFORM_DCA_CAP_MASK                         0xFFFFFFFF
-#define CPUID_EAX_IA32_PLATFORM_DCA_CAP(_)                           (((_) >> 0) & 0xFFFFFFFF)
+      uint32_t size                                                  : 32;
+#define CPUID_EAX_0D_ECX_N_EAX_SIZE_BIT                              0
+#define CPUID_EAX_0D_ECX_N_EAX_SIZE_FLAG                             0xFFFFFFFF
+#define CPUID_EAX_0D_ECX_N_EAX_SIZE_MASK                             0xFFFFFFFF
+#define CPUID_EAX_0D_ECX_N_EAX_SIZE(_)                               (((_) >> 0) & 0xFFFFFFFF)
     };
 
     uint32_t flags;
   } eax;
+#define CPUID_EAX_0D_ECX_N_EAX_RESERVED_BITS                         0x00
 
   union
   {
@@ -4413,15 +4781,16 @@ typedef struct
        * area.
        * This field reports 0 if the sub-leaf index, n, does not map to a valid bit in the XCR0 register.
        */
-      uint32_t reserved                                              : 32;
-#define CPUID_EBX_RESERVED_BIT                                       0
-#define CPUID_EBX_RESERVED_FLAG                                      0xFFFFFFFF
-#define CPUID_EBX_RESERVED_MASK                                      0xFFFFFFFF
-#define CPUID_EBX_RESERVED(_)                                        (((_) >> 0) & 0xFFFFFFFF)
+      uint32_t offset                                                : 32;
+#define CPUID_EAX_0D_ECX_N_EBX_OFFSET_BIT                            0
+#define CPUID_EAX_0D_ECX_N_EBX_OFFSET_FLAG                           0xFFFFFFFF
+#define CPUID_EAX_0D_ECX_N_EBX_OFFSET_MASK                           0xFFFFFFFF
+#define CPUID_EAX_0D_ECX_N_EBX_OFFSET(_)                             (((_) >> 0) & 0xFFFFFFFF)
     };
 
     uint32_t flags;
   } ebx;
+#define CPUID_EAX_0D_ECX_N_EBX_RESERVED_BITS                         0x00
 
   union
   {
@@ -4431,27 +4800,28 @@ typedef struct
        * [Bit 0] Is set if the bit n (corresponding to the sub-leaf index) is supported in the IA32_XSS MSR; it is clear if bit n
        * is instead supported in XCR0.
        */
-      uint32_t ecx_2                                                 : 1;
-#define CPUID_ECX_ECX_2_BIT                                          0
-#define CPUID_ECX_ECX_2_FLAG                                         0x01
-#define CPUID_ECX_ECX_2_MASK                                         0x01
-#define CPUID_ECX_ECX_2(_)                                           (((_) >> 0) & 0x01)
+      uint32_t supported_in_ia32_xss                                 : 1;
+#define CPUID_EAX_0D_ECX_N_ECX_SUPPORTED_IN_IA32_XSS_BIT             0
+#define CPUID_EAX_0D_ECX_N_ECX_SUPPORTED_IN_IA32_XSS_FLAG            0x01
+#define CPUID_EAX_0D_ECX_N_ECX_SUPPORTED_IN_IA32_XSS_MASK            0x01
+#define CPUID_EAX_0D_ECX_N_ECX_SUPPORTED_IN_IA32_XSS(_)              (((_) >> 0) & 0x01)
 
       /**
        * [Bit 1] Is set if, when the compacted format of an XSAVE area is used, this extended state component located on the next
        * 64-byte boundary following the preceding state component (otherwise, it is located immediately following the preceding
        * state component).
        */
-      uint32_t ecx_1                                                 : 1;
-#define CPUID_ECX_ECX_1_BIT                                          1
-#define CPUID_ECX_ECX_1_FLAG                                         0x02
-#define CPUID_ECX_ECX_1_MASK                                         0x01
-#define CPUID_ECX_ECX_1(_)                                           (((_) >> 1) & 0x01)
+      uint32_t aligned_64_bytes                                      : 1;
+#define CPUID_EAX_0D_ECX_N_ECX_ALIGNED_64_BYTES_BIT                  1
+#define CPUID_EAX_0D_ECX_N_ECX_ALIGNED_64_BYTES_FLAG                 0x02
+#define CPUID_EAX_0D_ECX_N_ECX_ALIGNED_64_BYTES_MASK                 0x01
+#define CPUID_EAX_0D_ECX_N_ECX_ALIGNED_64_BYTES(_)                   (((_) >> 1) & 0x01)
       uint32_t reserved1                                             : 30;
     };
 
     uint32_t flags;
   } ecx;
+#define CPUID_EAX_0D_ECX_N_ECX_RESERVED_BITS                         0xFFFFFFFC
 
   union
   {
@@ -4461,14 +4831,15 @@ typedef struct
        * [Bits 31:0] This field reports 0 if the sub-leaf index, n, is invalid; otherwise it is reserved.
        */
       uint32_t reserved                                              : 32;
-#define CPUID_EDX_RESERVED_BIT                                       0
-#define CPUID_EDX_RESERVED_FLAG                                      0xFFFFFFFF
-#define CPUID_EDX_RESERVED_MASK                                      0xFFFFFFFF
-#define CPUID_EDX_RESERVED(_)                                        (((_) >> 0) & 0xFFFFFFFF)
+#define CPUID_EAX_0D_ECX_N_EDX_RESERVED_BIT                          0
+#define CPUID_EAX_0D_ECX_N_EDX_RESERVED_FLAG                         0xFFFFFFFF
+#define CPUID_EAX_0D_ECX_N_EDX_RESERVED_MASK                         0xFFFFFFFF
+#define CPUID_EAX_0D_ECX_N_EDX_RESERVED(_)                           (((_) >> 0) & 0xFFFFFFFF)
     };
 
     uint32_t flags;
   } edx;
+#define CPUID_EAX_0D_ECX_N_EDX_RESERVED_BITS                         0xFFFFFFFF
 
 } cpuid_eax_0d_ecx_n;
 
@@ -4506,14 +4877,15 @@ typedef struct
        * [Bits 31:0] EAX is reserved.
        */
       uint32_t reserved                                              : 32;
-#define CPUID_EAX_RESERVED_BIT                                       0
-#define CPUID_EAX_RESERVED_FLAG                                      0xFFFFFFFF
-#define CPUID_EAX_RESERVED_MASK                                      0xFFFFFFFF
-#define CPUID_EAX_RESERVED(_)                                        (((_) >> 0) & 0xFFFFFFFF)
+#define CPUID_EAX_0F_ECX_00_EAX_RESERVED_BIT                         0
+#define CPUID_EAX_0F_ECX_00_EAX_RESERVED_FLAG                        0xFFFFFFFF
+#define CPUID_EAX_0F_ECX_00_EAX_RESERVED_MASK                        0xFFFFFFFF
+#define CPUID_EAX_0F_ECX_00_EAX_RESERVED(_)                          (((_) >> 0) & 0xFFFFFFFF)
     };
 
     uint32_t flags;
   } eax;
+#define CPUID_EAX_0F_ECX_00_EAX_RESERVED_BITS                        0xFFFFFFFF
 
   union
   {
@@ -4523,14 +4895,15 @@ typedef struct
        * [Bits 31:0] Maximum range (zero-based) of RMID within this physical processor of all types.
        */
       uint32_t rmid_max_range                                        : 32;
-#define CPUID_EBX_RMID_MAX_RANGE_BIT                                 0
-#define CPUID_EBX_RMID_MAX_RANGE_FLAG                                0xFFFFFFFF
-#define CPUID_EBX_RMID_MAX_RANGE_MASK                                0xFFFFFFFF
-#define CPUID_EBX_RMID_MAX_RANGE(_)                                  (((_) >> 0) & 0xFFFFFFFF)
+#define CPUID_EAX_0F_ECX_00_EBX_RMID_MAX_RANGE_BIT                   0
+#define CPUID_EAX_0F_ECX_00_EBX_RMID_MAX_RANGE_FLAG                  0xFFFFFFFF
+#define CPUID_EAX_0F_ECX_00_EBX_RMID_MAX_RANGE_MASK                  0xFFFFFFFF
+#define CPUID_EAX_0F_ECX_00_EBX_RMID_MAX_RANGE(_)                    (((_) >> 0) & 0xFFFFFFFF)
     };
 
     uint32_t flags;
   } ebx;
+#define CPUID_EAX_0F_ECX_00_EBX_RESERVED_BITS                        0x00
 
   union
   {
@@ -4540,14 +4913,15 @@ typedef struct
        * [Bits 31:0] ECX is reserved.
        */
       uint32_t reserved                                              : 32;
-#define CPUID_ECX_RESERVED_BIT                                       0
-#define CPUID_ECX_RESERVED_FLAG                                      0xFFFFFFFF
-#define CPUID_ECX_RESERVED_MASK                                      0xFFFFFFFF
-#define CPUID_ECX_RESERVED(_)                                        (((_) >> 0) & 0xFFFFFFFF)
+#define CPUID_EAX_0F_ECX_00_ECX_RESERVED_BIT                         0
+#define CPUID_EAX_0F_ECX_00_ECX_RESERVED_FLAG                        0xFFFFFFFF
+#define CPUID_EAX_0F_ECX_00_ECX_RESERVED_MASK                        0xFFFFFFFF
+#define CPUID_EAX_0F_ECX_00_ECX_RESERVED(_)                          (((_) >> 0) & 0xFFFFFFFF)
     };
 
     uint32_t flags;
   } ecx;
+#define CPUID_EAX_0F_ECX_00_ECX_RESERVED_BITS                        0xFFFFFFFF
 
   union
   {
@@ -4559,17 +4933,28 @@ typedef struct
        * [Bit 1] Supports L3 Cache Intel RDT Monitoring if 1.
        */
       uint32_t supports_l3_cache_intel_rdt_monitoring                : 1;
-#define CPUID_EDX_SUPPORTS_L3_CACHE_INTEL_RDT_MONITORING_BIT         1
-#define CPUID_EDX_SUPPORTS_L3_CACHE_INTEL_RDT_MONITORING_FLAG        0x02
-#define CPUID_EDX_SUPPORTS_L3_CACHE_INTEL_RDT_MONITORING_MASK        0x01
-#define CPUID_EDX_SUPPORTS_L3_CACHE_INTEL_RDT_MONITORING(_)          (((_) >> 1) & 0x01)
+#define CPUID_EAX_0F_ECX_00_EDX_SUPPORTS_L3_CACHE_INTEL_RDT_MONITORING_BIT 1
+#define CPUID_EAX_0F_ECX_00_EDX_SUPPORTS_L3_CACHE_INTEL_RDT_MONITORING_FLAG 0x02
+#define CPUID_EAX_0F_ECX_00_EDX_SUPPORTS_L3_CACHE_INTEL_RDT_MONITORING_MASK 0x01
+#define CPUID_EAX_0F_ECX_00_EDX_SUPPORTS_L3_CACHE_INTEL_RDT_MONITORING(_) (((_) >> 1) & 0x01)
+#define CPUID_EAX_0F_ECX_00_EDX_SUPPORTS_L3_CACHE_INTEL_RDT_MONITORING_FEATURE 1377
       uint32_t reserved2                                             : 30;
     };
 
     uint32_t flags;
   } edx;
+#define CPUID_EAX_0F_ECX_00_EDX_RESERVED_BITS                        0xFFFFFFFD
 
 } cpuid_eax_0f_ecx_00;
+#define CPUID_EAX_0F_ECX_00_SNAPSHOT_INDEX                           10
+#define CPUID_EAX_0F_ECX_00_EAX_POLICY_AND                           0x00000000
+#define CPUID_EAX_0F_ECX_00_EAX_POLICY_OR                            0x00000000
+#define CPUID_EAX_0F_ECX_00_EBX_POLICY_AND                           0xFFFFFFFF
+#define CPUID_EAX_0F_ECX_00_EBX_POLICY_OR                            0x00000000
+#define CPUID_EAX_0F_ECX_00_ECX_POLICY_AND                           0x00000000
+#define CPUID_EAX_0F_ECX_00_ECX_POLICY_OR                            0x00000000
+#define CPUID_EAX_0F_ECX_00_EDX_POLICY_AND                           0x00000002
+#define CPUID_EAX_0F_ECX_00_EDX_POLICY_OR                            0x00000000
 
 /**
  * @brief L3 Cache Intel RDT Monitoring Capability Enumeration Sub-leaf (EAX = 0FH, ECX = 1)
@@ -4586,14 +4971,15 @@ typedef struct
        * [Bits 31:0] EAX is reserved.
        */
       uint32_t reserved                                              : 32;
-#define CPUID_EAX_RESERVED_BIT                                       0
-#define CPUID_EAX_RESERVED_FLAG                                      0xFFFFFFFF
-#define CPUID_EAX_RESERVED_MASK                                      0xFFFFFFFF
-#define CPUID_EAX_RESERVED(_)                                        (((_) >> 0) & 0xFFFFFFFF)
+#define CPUID_EAX_0F_ECX_01_EAX_RESERVED_BIT                         0
+#define CPUID_EAX_0F_ECX_01_EAX_RESERVED_FLAG                        0xFFFFFFFF
+#define CPUID_EAX_0F_ECX_01_EAX_RESERVED_MASK                        0xFFFFFFFF
+#define CPUID_EAX_0F_ECX_01_EAX_RESERVED(_)                          (((_) >> 0) & 0xFFFFFFFF)
     };
 
     uint32_t flags;
   } eax;
+#define CPUID_EAX_0F_ECX_01_EAX_RESERVED_BITS                        0xFFFFFFFF
 
   union
   {
@@ -4603,14 +4989,15 @@ typedef struct
        * [Bits 31:0] Conversion factor from reported IA32_QM_CTR value to occupancy metric (bytes).
        */
       uint32_t conversion_factor                                     : 32;
-#define CPUID_EBX_CONVERSION_FACTOR_BIT                              0
-#define CPUID_EBX_CONVERSION_FACTOR_FLAG                             0xFFFFFFFF
-#define CPUID_EBX_CONVERSION_FACTOR_MASK                             0xFFFFFFFF
-#define CPUID_EBX_CONVERSION_FACTOR(_)                               (((_) >> 0) & 0xFFFFFFFF)
+#define CPUID_EAX_0F_ECX_01_EBX_CONVERSION_FACTOR_BIT                0
+#define CPUID_EAX_0F_ECX_01_EBX_CONVERSION_FACTOR_FLAG               0xFFFFFFFF
+#define CPUID_EAX_0F_ECX_01_EBX_CONVERSION_FACTOR_MASK               0xFFFFFFFF
+#define CPUID_EAX_0F_ECX_01_EBX_CONVERSION_FACTOR(_)                 (((_) >> 0) & 0xFFFFFFFF)
     };
 
     uint32_t flags;
   } ebx;
+#define CPUID_EAX_0F_ECX_01_EBX_RESERVED_BITS                        0x00
 
   union
   {
@@ -4620,14 +5007,15 @@ typedef struct
        * [Bits 31:0] Maximum range (zero-based) of RMID within this physical processor of all types.
        */
       uint32_t rmid_max_range                                        : 32;
-#define CPUID_ECX_RMID_MAX_RANGE_BIT                                 0
-#define CPUID_ECX_RMID_MAX_RANGE_FLAG                                0xFFFFFFFF
-#define CPUID_ECX_RMID_MAX_RANGE_MASK                                0xFFFFFFFF
-#define CPUID_ECX_RMID_MAX_RANGE(_)                                  (((_) >> 0) & 0xFFFFFFFF)
+#define CPUID_EAX_0F_ECX_01_ECX_RMID_MAX_RANGE_BIT                   0
+#define CPUID_EAX_0F_ECX_01_ECX_RMID_MAX_RANGE_FLAG                  0xFFFFFFFF
+#define CPUID_EAX_0F_ECX_01_ECX_RMID_MAX_RANGE_MASK                  0xFFFFFFFF
+#define CPUID_EAX_0F_ECX_01_ECX_RMID_MAX_RANGE(_)                    (((_) >> 0) & 0xFFFFFFFF)
     };
 
     uint32_t flags;
   } ecx;
+#define CPUID_EAX_0F_ECX_01_ECX_RESERVED_BITS                        0x00
 
   union
   {
@@ -4637,35 +5025,48 @@ typedef struct
        * [Bit 0] Supports L3 occupancy monitoring if 1.
        */
       uint32_t supports_l3_occupancy_monitoring                      : 1;
-#define CPUID_EDX_SUPPORTS_L3_OCCUPANCY_MONITORING_BIT               0
-#define CPUID_EDX_SUPPORTS_L3_OCCUPANCY_MONITORING_FLAG              0x01
-#define CPUID_EDX_SUPPORTS_L3_OCCUPANCY_MONITORING_MASK              0x01
-#define CPUID_EDX_SUPPORTS_L3_OCCUPANCY_MONITORING(_)                (((_) >> 0) & 0x01)
+#define CPUID_EAX_0F_ECX_01_EDX_SUPPORTS_L3_OCCUPANCY_MONITORING_BIT 0
+#define CPUID_EAX_0F_ECX_01_EDX_SUPPORTS_L3_OCCUPANCY_MONITORING_FLAG 0x01
+#define CPUID_EAX_0F_ECX_01_EDX_SUPPORTS_L3_OCCUPANCY_MONITORING_MASK 0x01
+#define CPUID_EAX_0F_ECX_01_EDX_SUPPORTS_L3_OCCUPANCY_MONITORING(_)  (((_) >> 0) & 0x01)
+#define CPUID_EAX_0F_ECX_01_EDX_SUPPORTS_L3_OCCUPANCY_MONITORING_FEATURE 1504
 
       /**
        * [Bit 1] Supports L3 Total Bandwidth monitoring if 1.
        */
       uint32_t supports_l3_total_bandwidth_monitoring                : 1;
-#define CPUID_EDX_SUPPORTS_L3_TOTAL_BANDWIDTH_MONITORING_BIT         1
-#define CPUID_EDX_SUPPORTS_L3_TOTAL_BANDWIDTH_MONITORING_FLAG        0x02
-#define CPUID_EDX_SUPPORTS_L3_TOTAL_BANDWIDTH_MONITORING_MASK        0x01
-#define CPUID_EDX_SUPPORTS_L3_TOTAL_BANDWIDTH_MONITORING(_)          (((_) >> 1) & 0x01)
+#define CPUID_EAX_0F_ECX_01_EDX_SUPPORTS_L3_TOTAL_BANDWIDTH_MONITORING_BIT 1
+#define CPUID_EAX_0F_ECX_01_EDX_SUPPORTS_L3_TOTAL_BANDWIDTH_MONITORING_FLAG 0x02
+#define CPUID_EAX_0F_ECX_01_EDX_SUPPORTS_L3_TOTAL_BANDWIDTH_MONITORING_MASK 0x01
+#define CPUID_EAX_0F_ECX_01_EDX_SUPPORTS_L3_TOTAL_BANDWIDTH_MONITORING(_) (((_) >> 1) & 0x01)
+#define CPUID_EAX_0F_ECX_01_EDX_SUPPORTS_L3_TOTAL_BANDWIDTH_MONITORING_FEATURE 1505
 
       /**
        * [Bit 2] Supports L3 Local Bandwidth monitoring if 1.
        */
       uint32_t supports_l3_local_bandwidth_monitoring                : 1;
-#define CPUID_EDX_SUPPORTS_L3_LOCAL_BANDWIDTH_MONITORING_BIT         2
-#define CPUID_EDX_SUPPORTS_L3_LOCAL_BANDWIDTH_MONITORING_FLAG        0x04
-#define CPUID_EDX_SUPPORTS_L3_LOCAL_BANDWIDTH_MONITORING_MASK        0x01
-#define CPUID_EDX_SUPPORTS_L3_LOCAL_BANDWIDTH_MONITORING(_)          (((_) >> 2) & 0x01)
+#define CPUID_EAX_0F_ECX_01_EDX_SUPPORTS_L3_LOCAL_BANDWIDTH_MONITORING_BIT 2
+#define CPUID_EAX_0F_ECX_01_EDX_SUPPORTS_L3_LOCAL_BANDWIDTH_MONITORING_FLAG 0x04
+#define CPUID_EAX_0F_ECX_01_EDX_SUPPORTS_L3_LOCAL_BANDWIDTH_MONITORING_MASK 0x01
+#define CPUID_EAX_0F_ECX_01_EDX_SUPPORTS_L3_LOCAL_BANDWIDTH_MONITORING(_) (((_) >> 2) & 0x01)
+#define CPUID_EAX_0F_ECX_01_EDX_SUPPORTS_L3_LOCAL_BANDWIDTH_MONITORING_FEATURE 1506
       uint32_t reserved1                                             : 29;
     };
 
     uint32_t flags;
   } edx;
+#define CPUID_EAX_0F_ECX_01_EDX_RESERVED_BITS                        0xFFFFFFF8
 
 } cpuid_eax_0f_ecx_01;
+#define CPUID_EAX_0F_ECX_01_SNAPSHOT_INDEX                           11
+#define CPUID_EAX_0F_ECX_01_EAX_POLICY_AND                           0x00000000
+#define CPUID_EAX_0F_ECX_01_EAX_POLICY_OR                            0x00000000
+#define CPUID_EAX_0F_ECX_01_EBX_POLICY_AND                           0xFFFFFFFF
+#define CPUID_EAX_0F_ECX_01_EBX_POLICY_OR                            0x00000000
+#define CPUID_EAX_0F_ECX_01_ECX_POLICY_AND                           0xFFFFFFFF
+#define CPUID_EAX_0F_ECX_01_ECX_POLICY_OR                            0x00000000
+#define CPUID_EAX_0F_ECX_01_EDX_POLICY_AND                           0x00000007
+#define CPUID_EAX_0F_ECX_01_EDX_POLICY_OR                            0x00000000
 
 /**
  * @}
@@ -4701,14 +5102,15 @@ typedef struct
        * [Bits 31:0] Value of bits [31:0] of IA32_PLATFORM_DCA_CAP MSR (address 1F8H).
        */
       uint32_t ia32_platform_dca_cap                                 : 32;
-#define CPUID_EAX_IA32_PLATFORM_DCA_CAP_BIT                          0
-#define CPUID_EAX_IA32_PLATFORM_DCA_CAP_FLAG                         0xFFFFFFFF
-#define CPUID_EAX_IA32_PLATFORM_DCA_CAP_MASK                         0xFFFFFFFF
-#define CPUID_EAX_IA32_PLATFORM_DCA_CAP(_)                           (((_) >> 0) & 0xFFFFFFFF)
+#define CPUID_EAX_10_ECX_00_EAX_IA32_PLATFORM_DCA_CAP_BIT            0
+#define CPUID_EAX_10_ECX_00_EAX_IA32_PLATFORM_DCA_CAP_FLAG           0xFFFFFFFF
+#define CPUID_EAX_10_ECX_00_EAX_IA32_PLATFORM_DCA_CAP_MASK           0xFFFFFFFF
+#define CPUID_EAX_10_ECX_00_EAX_IA32_PLATFORM_DCA_CAP(_)             (((_) >> 0) & 0xFFFFFFFF)
     };
 
     uint32_t flags;
   } eax;
+#define CPUID_EAX_10_ECX_00_EAX_RESERVED_BITS                        0x00
 
   union
   {
@@ -4720,33 +5122,37 @@ typedef struct
        * [Bit 1] Supports L3 Cache Allocation Technology if 1.
        */
       uint32_t supports_l3_cache_allocation_technology               : 1;
-#define CPUID_EBX_SUPPORTS_L3_CACHE_ALLOCATION_TECHNOLOGY_BIT        1
-#define CPUID_EBX_SUPPORTS_L3_CACHE_ALLOCATION_TECHNOLOGY_FLAG       0x02
-#define CPUID_EBX_SUPPORTS_L3_CACHE_ALLOCATION_TECHNOLOGY_MASK       0x01
-#define CPUID_EBX_SUPPORTS_L3_CACHE_ALLOCATION_TECHNOLOGY(_)         (((_) >> 1) & 0x01)
+#define CPUID_EAX_10_ECX_00_EBX_SUPPORTS_L3_CACHE_ALLOCATION_TECHNOLOGY_BIT 1
+#define CPUID_EAX_10_ECX_00_EBX_SUPPORTS_L3_CACHE_ALLOCATION_TECHNOLOGY_FLAG 0x02
+#define CPUID_EAX_10_ECX_00_EBX_SUPPORTS_L3_CACHE_ALLOCATION_TECHNOLOGY_MASK 0x01
+#define CPUID_EAX_10_ECX_00_EBX_SUPPORTS_L3_CACHE_ALLOCATION_TECHNOLOGY(_) (((_) >> 1) & 0x01)
+#define CPUID_EAX_10_ECX_00_EBX_SUPPORTS_L3_CACHE_ALLOCATION_TECHNOLOGY_FEATURE 1569
 
       /**
        * [Bit 2] Supports L2 Cache Allocation Technology if 1.
        */
       uint32_t supports_l2_cache_allocation_technology               : 1;
-#define CPUID_EBX_SUPPORTS_L2_CACHE_ALLOCATION_TECHNOLOGY_BIT        2
-#define CPUID_EBX_SUPPORTS_L2_CACHE_ALLOCATION_TECHNOLOGY_FLAG       0x04
-#define CPUID_EBX_SUPPORTS_L2_CACHE_ALLOCATION_TECHNOLOGY_MASK       0x01
-#define CPUID_EBX_SUPPORTS_L2_CACHE_ALLOCATION_TECHNOLOGY(_)         (((_) >> 2) & 0x01)
+#define CPUID_EAX_10_ECX_00_EBX_SUPPORTS_L2_CACHE_ALLOCATION_TECHNOLOGY_BIT 2
+#define CPUID_EAX_10_ECX_00_EBX_SUPPORTS_L2_CACHE_ALLOCATION_TECHNOLOGY_FLAG 0x04
+#define CPUID_EAX_10_ECX_00_EBX_SUPPORTS_L2_CACHE_ALLOCATION_TECHNOLOGY_MASK 0x01
+#define CPUID_EAX_10_ECX_00_EBX_SUPPORTS_L2_CACHE_ALLOCATION_TECHNOLOGY(_) (((_) >> 2) & 0x01)
+#define CPUID_EAX_10_ECX_00_EBX_SUPPORTS_L2_CACHE_ALLOCATION_TECHNOLOGY_FEATURE 1570
 
       /**
        * [Bit 3] Supports Memory Bandwidth Allocation if 1.
        */
       uint32_t supports_memory_bandwidth_allocation                  : 1;
-#define CPUID_EBX_SUPPORTS_MEMORY_BANDWIDTH_ALLOCATION_BIT           3
-#define CPUID_EBX_SUPPORTS_MEMORY_BANDWIDTH_ALLOCATION_FLAG          0x08
-#define CPUID_EBX_SUPPORTS_MEMORY_BANDWIDTH_ALLOCATION_MASK          0x01
-#define CPUID_EBX_SUPPORTS_MEMORY_BANDWIDTH_ALLOCATION(_)            (((_) >> 3) & 0x01)
+#define CPUID_EAX_10_ECX_00_EBX_SUPPORTS_MEMORY_BANDWIDTH_ALLOCATION_BIT 3
+#define CPUID_EAX_10_ECX_00_EBX_SUPPORTS_MEMORY_BANDWIDTH_ALLOCATION_FLAG 0x08
+#define CPUID_EAX_10_ECX_00_EBX_SUPPORTS_MEMORY_BANDWIDTH_ALLOCATION_MASK 0x01
+#define CPUID_EAX_10_ECX_00_EBX_SUPPORTS_MEMORY_BANDWIDTH_ALLOCATION(_) (((_) >> 3) & 0x01)
+#define CPUID_EAX_10_ECX_00_EBX_SUPPORTS_MEMORY_BANDWIDTH_ALLOCATION_FEATURE 1571
       uint32_t reserved2                                             : 28;
     };
 
     uint32_t flags;
   } ebx;
+#define CPUID_EAX_10_ECX_00_EBX_RESERVED_BITS                        0xFFFFFFF1
 
   union
   {
@@ -4756,14 +5162,15 @@ typedef struct
        * [Bits 31:0] ECX is reserved.
        */
       uint32_t reserved                                              : 32;
-#define CPUID_ECX_RESERVED_BIT                                       0
-#define CPUID_ECX_RESERVED_FLAG                                      0xFFFFFFFF
-#define CPUID_ECX_RESERVED_MASK                                      0xFFFFFFFF
-#define CPUID_ECX_RESERVED(_)                                        (((_) >> 0) & 0xFFFFFFFF)
+#define CPUID_EAX_10_ECX_00_ECX_RESERVED_BIT                         0
+#define CPUID_EAX_10_ECX_00_ECX_RESERVED_FLAG                        0xFFFFFFFF
+#define CPUID_EAX_10_ECX_00_ECX_RESERVED_MASK                        0xFFFFFFFF
+#define CPUID_EAX_10_ECX_00_ECX_RESERVED(_)                          (((_) >> 0) & 0xFFFFFFFF)
     };
 
     uint32_t flags;
   } ecx;
+#define CPUID_EAX_10_ECX_00_ECX_RESERVED_BITS                        0xFFFFFFFF
 
   union
   {
@@ -4773,16 +5180,26 @@ typedef struct
        * [Bits 31:0] EDX is reserved.
        */
       uint32_t reserved                                              : 32;
-#define CPUID_EDX_RESERVED_BIT                                       0
-#define CPUID_EDX_RESERVED_FLAG                                      0xFFFFFFFF
-#define CPUID_EDX_RESERVED_MASK                                      0xFFFFFFFF
-#define CPUID_EDX_RESERVED(_)                                        (((_) >> 0) & 0xFFFFFFFF)
+#define CPUID_EAX_10_ECX_00_EDX_RESERVED_BIT                         0
+#define CPUID_EAX_10_ECX_00_EDX_RESERVED_FLAG                        0xFFFFFFFF
+#define CPUID_EAX_10_ECX_00_EDX_RESERVED_MASK                        0xFFFFFFFF
+#define CPUID_EAX_10_ECX_00_EDX_RESERVED(_)                          (((_) >> 0) & 0xFFFFFFFF)
     };
 
     uint32_t flags;
   } edx;
+#define CPUID_EAX_10_ECX_00_EDX_RESERVED_BITS                        0xFFFFFFFF
 
 } cpuid_eax_10_ecx_00;
+#define CPUID_EAX_10_ECX_00_SNAPSHOT_INDEX                           12
+#define CPUID_EAX_10_ECX_00_EAX_POLICY_AND                           0xFFFFFFFF
+#define CPUID_EAX_10_ECX_00_EAX_POLICY_OR                            0x00000000
+#define CPUID_EAX_10_ECX_00_EBX_POLICY_AND                           0x0000000E
+#define CPUID_EAX_10_ECX_00_EBX_POLICY_OR                            0x00000000
+#define CPUID_EAX_10_ECX_00_ECX_POLICY_AND                           0x00000000
+#define CPUID_EAX_10_ECX_00_ECX_POLICY_OR                            0x00000000
+#define CPUID_EAX_10_ECX_00_EDX_POLICY_AND                           0x00000000
+#define CPUID_EAX_10_ECX_00_EDX_POLICY_OR                            0x00000000
 
 /**
  * @brief L3 Cache Allocation Technology Enumeration Sub-leaf (EAX = 10H, ECX = ResID = 1)
@@ -4799,15 +5216,16 @@ typedef struct
        * [Bits 4:0] Length of the capacity bit mask for the corresponding ResID using minus-one notation.
        */
       uint32_t length_of_capacity_bit_mask                           : 5;
-#define CPUID_EAX_LENGTH_OF_CAPACITY_BIT_MASK_BIT                    0
-#define CPUID_EAX_LENGTH_OF_CAPACITY_BIT_MASK_FLAG                   0x1F
-#define CPUID_EAX_LENGTH_OF_CAPACITY_BIT_MASK_MASK                   0x1F
-#define CPUID_EAX_LENGTH_OF_CAPACITY_BIT_MASK(_)                     (((_) >> 0) & 0x1F)
+#define CPUID_EAX_10_ECX_01_EAX_LENGTH_OF_CAPACITY_BIT_MASK_BIT      0
+#define CPUID_EAX_10_ECX_01_EAX_LENGTH_OF_CAPACITY_BIT_MASK_FLAG     0x1F
+#define CPUID_EAX_10_ECX_01_EAX_LENGTH_OF_CAPACITY_BIT_MASK_MASK     0x1F
+#define CPUID_EAX_10_ECX_01_EAX_LENGTH_OF_CAPACITY_BIT_MASK(_)       (((_) >> 0) & 0x1F)
       uint32_t reserved1                                             : 27;
     };
 
     uint32_t flags;
   } eax;
+#define CPUID_EAX_10_ECX_01_EAX_RESERVED_BITS                        0xFFFFFFE0
 
   union
   {
@@ -4817,14 +5235,15 @@ typedef struct
        * [Bits 31:0] Bit-granular map of isolation/contention of allocation units.
        */
       uint32_t ebx_0                                                 : 32;
-#define CPUID_EBX_EBX_0_BIT                                          0
-#define CPUID_EBX_EBX_0_FLAG                                         0xFFFFFFFF
-#define CPUID_EBX_EBX_0_MASK                                         0xFFFFFFFF
-#define CPUID_EBX_EBX_0(_)                                           (((_) >> 0) & 0xFFFFFFFF)
+#define CPUID_EAX_10_ECX_01_EBX_EBX_0_BIT                            0
+#define CPUID_EAX_10_ECX_01_EBX_EBX_0_FLAG                           0xFFFFFFFF
+#define CPUID_EAX_10_ECX_01_EBX_EBX_0_MASK                           0xFFFFFFFF
+#define CPUID_EAX_10_ECX_01_EBX_EBX_0(_)                             (((_) >> 0) & 0xFFFFFFFF)
     };
 
     uint32_t flags;
   } ebx;
+#define CPUID_EAX_10_ECX_01_EBX_RESERVED_BITS                        0x00
 
   union
   {
@@ -4836,15 +5255,17 @@ typedef struct
        * [Bit 2] Code and Data Prioritization Technology supported if 1.
        */
       uint32_t code_and_data_priorization_technology_supported       : 1;
-#define CPUID_ECX_CODE_AND_DATA_PRIORIZATION_TECHNOLOGY_SUPPORTED_BIT 2
-#define CPUID_ECX_CODE_AND_DATA_PRIORIZATION_TECHNOLOGY_SUPPORTED_FLAG 0x04
-#define CPUID_ECX_CODE_AND_DATA_PRIORIZATION_TECHNOLOGY_SUPPORTED_MASK 0x01
-#define CPUID_ECX_CODE_AND_DATA_PRIORIZATION_TECHNOLOGY_SUPPORTED(_) (((_) >> 2) & 0x01)
+#define CPUID_EAX_10_ECX_01_ECX_CODE_AND_DATA_PRIORIZATION_TECHNOLOGY_SUPPORTED_BIT 2
+#define CPUID_EAX_10_ECX_01_ECX_CODE_AND_DATA_PRIORIZATION_TECHNOLOGY_SUPPORTED_FLAG 0x04
+#define CPUID_EAX_10_ECX_01_ECX_CODE_AND_DATA_PRIORIZATION_TECHNOLOGY_SUPPORTED_MASK 0x01
+#define CPUID_EAX_10_ECX_01_ECX_CODE_AND_DATA_PRIORIZATION_TECHNOLOGY_SUPPORTED(_) (((_) >> 2) & 0x01)
+#define CPUID_EAX_10_ECX_01_ECX_CODE_AND_DATA_PRIORIZATION_TECHNOLOGY_SUPPORTED_FEATURE 1730
       uint32_t reserved2                                             : 29;
     };
 
     uint32_t flags;
   } ecx;
+#define CPUID_EAX_10_ECX_01_ECX_RESERVED_BITS                        0xFFFFFFFB
 
   union
   {
@@ -4854,17 +5275,27 @@ typedef struct
        * [Bits 15:0] Highest COS number supported for this ResID.
        */
       uint32_t highest_cos_number_supported                          : 16;
-#define CPUID_EDX_HIGHEST_COS_NUMBER_SUPPORTED_BIT                   0
-#define CPUID_EDX_HIGHEST_COS_NUMBER_SUPPORTED_FLAG                  0xFFFF
-#define CPUID_EDX_HIGHEST_COS_NUMBER_SUPPORTED_MASK                  0xFFFF
-#define CPUID_EDX_HIGHEST_COS_NUMBER_SUPPORTED(_)                    (((_) >> 0) & 0xFFFF)
+#define CPUID_EAX_10_ECX_01_EDX_HIGHEST_COS_NUMBER_SUPPORTED_BIT     0
+#define CPUID_EAX_10_ECX_01_EDX_HIGHEST_COS_NUMBER_SUPPORTED_FLAG    0xFFFF
+#define CPUID_EAX_10_ECX_01_EDX_HIGHEST_COS_NUMBER_SUPPORTED_MASK    0xFFFF
+#define CPUID_EAX_10_ECX_01_EDX_HIGHEST_COS_NUMBER_SUPPORTED(_)      (((_) >> 0) & 0xFFFF)
       uint32_t reserved1                                             : 16;
     };
 
     uint32_t flags;
   } edx;
+#define CPUID_EAX_10_ECX_01_EDX_RESERVED_BITS                        0xFFFF0000
 
 } cpuid_eax_10_ecx_01;
+#define CPUID_EAX_10_ECX_01_SNAPSHOT_INDEX                           13
+#define CPUID_EAX_10_ECX_01_EAX_POLICY_AND                           0x0000001F
+#define CPUID_EAX_10_ECX_01_EAX_POLICY_OR                            0x00000000
+#define CPUID_EAX_10_ECX_01_EBX_POLICY_AND                           0xFFFFFFFF
+#define CPUID_EAX_10_ECX_01_EBX_POLICY_OR                            0x00000000
+#define CPUID_EAX_10_ECX_01_ECX_POLICY_AND                           0x00000004
+#define CPUID_EAX_10_ECX_01_ECX_POLICY_OR                            0x00000000
+#define CPUID_EAX_10_ECX_01_EDX_POLICY_AND                           0x0000FFFF
+#define CPUID_EAX_10_ECX_01_EDX_POLICY_OR                            0x00000000
 
 /**
  * @brief L2 Cache Allocation Technology Enumeration Sub-leaf (EAX = 10H, ECX = ResID = 2)
@@ -4881,15 +5312,16 @@ typedef struct
        * [Bits 4:0] Length of the capacity bit mask for the corresponding ResID using minus-one notation.
        */
       uint32_t length_of_capacity_bit_mask                           : 5;
-#define CPUID_EAX_LENGTH_OF_CAPACITY_BIT_MASK_BIT                    0
-#define CPUID_EAX_LENGTH_OF_CAPACITY_BIT_MASK_FLAG                   0x1F
-#define CPUID_EAX_LENGTH_OF_CAPACITY_BIT_MASK_MASK                   0x1F
-#define CPUID_EAX_LENGTH_OF_CAPACITY_BIT_MASK(_)                     (((_) >> 0) & 0x1F)
+#define CPUID_EAX_10_ECX_02_EAX_LENGTH_OF_CAPACITY_BIT_MASK_BIT      0
+#define CPUID_EAX_10_ECX_02_EAX_LENGTH_OF_CAPACITY_BIT_MASK_FLAG     0x1F
+#define CPUID_EAX_10_ECX_02_EAX_LENGTH_OF_CAPACITY_BIT_MASK_MASK     0x1F
+#define CPUID_EAX_10_ECX_02_EAX_LENGTH_OF_CAPACITY_BIT_MASK(_)       (((_) >> 0) & 0x1F)
       uint32_t reserved1                                             : 27;
     };
 
     uint32_t flags;
   } eax;
+#define CPUID_EAX_10_ECX_02_EAX_RESERVED_BITS                        0xFFFFFFE0
 
   union
   {
@@ -4899,14 +5331,15 @@ typedef struct
        * [Bits 31:0] Bit-granular map of isolation/contention of allocation units.
        */
       uint32_t ebx_0                                                 : 32;
-#define CPUID_EBX_EBX_0_BIT                                          0
-#define CPUID_EBX_EBX_0_FLAG                                         0xFFFFFFFF
-#define CPUID_EBX_EBX_0_MASK                                         0xFFFFFFFF
-#define CPUID_EBX_EBX_0(_)                                           (((_) >> 0) & 0xFFFFFFFF)
+#define CPUID_EAX_10_ECX_02_EBX_EBX_0_BIT                            0
+#define CPUID_EAX_10_ECX_02_EBX_EBX_0_FLAG                           0xFFFFFFFF
+#define CPUID_EAX_10_ECX_02_EBX_EBX_0_MASK                           0xFFFFFFFF
+#define CPUID_EAX_10_ECX_02_EBX_EBX_0(_)                             (((_) >> 0) & 0xFFFFFFFF)
     };
 
     uint32_t flags;
   } ebx;
+#define CPUID_EAX_10_ECX_02_EBX_RESERVED_BITS                        0x00
 
   union
   {
@@ -4916,14 +5349,15 @@ typedef struct
        * [Bits 31:0] ECX is reserved.
        */
       uint32_t reserved                                              : 32;
-#define CPUID_ECX_RESERVED_BIT                                       0
-#define CPUID_ECX_RESERVED_FLAG                                      0xFFFFFFFF
-#define CPUID_ECX_RESERVED_MASK                                      0xFFFFFFFF
-#define CPUID_ECX_RESERVED(_)                                        (((_) >> 0) & 0xFFFFFFFF)
+#define CPUID_EAX_10_ECX_02_ECX_RESERVED_BIT                         0
+#define CPUID_EAX_10_ECX_02_ECX_RESERVED_FLAG                        0xFFFFFFFF
+#define CPUID_EAX_10_ECX_02_ECX_RESERVED_MASK                        0xFFFFFFFF
+#define CPUID_EAX_10_ECX_02_ECX_RESERVED(_)                          (((_) >> 0) & 0xFFFFFFFF)
     };
 
     uint32_t flags;
   } ecx;
+#define CPUID_EAX_10_ECX_02_ECX_RESERVED_BITS                        0xFFFFFFFF
 
   union
   {
@@ -4933,17 +5367,27 @@ typedef struct
        * [Bits 15:0] Highest COS number supported for this ResID.
        */
       uint32_t highest_cos_number_supported                          : 16;
-#define CPUID_EDX_HIGHEST_COS_NUMBER_SUPPORTED_BIT                   0
-#define CPUID_EDX_HIGHEST_COS_NUMBER_SUPPORTED_FLAG                  0xFFFF
-#define CPUID_EDX_HIGHEST_COS_NUMBER_SUPPORTED_MASK                  0xFFFF
-#define CPUID_EDX_HIGHEST_COS_NUMBER_SUPPORTED(_)                    (((_) >> 0) & 0xFFFF)
+#define CPUID_EAX_10_ECX_02_EDX_HIGHEST_COS_NUMBER_SUPPORTED_BIT     0
+#define CPUID_EAX_10_ECX_02_EDX_HIGHEST_COS_NUMBER_SUPPORTED_FLAG    0xFFFF
+#define CPUID_EAX_10_ECX_02_EDX_HIGHEST_COS_NUMBER_SUPPORTED_MASK    0xFFFF
+#define CPUID_EAX_10_ECX_02_EDX_HIGHEST_COS_NUMBER_SUPPORTED(_)      (((_) >> 0) & 0xFFFF)
       uint32_t reserved1                                             : 16;
     };
 
     uint32_t flags;
   } edx;
+#define CPUID_EAX_10_ECX_02_EDX_RESERVED_BITS                        0xFFFF0000
 
 } cpuid_eax_10_ecx_02;
+#define CPUID_EAX_10_ECX_02_SNAPSHOT_INDEX                           14
+#define CPUID_EAX_10_ECX_02_EAX_POLICY_AND                           0x0000001F
+#define CPUID_EAX_10_ECX_02_EAX_POLICY_OR                            0x00000000
+#define CPUID_EAX_10_ECX_02_EBX_POLICY_AND                           0xFFFFFFFF
+#define CPUID_EAX_10_ECX_02_EBX_POLICY_OR                            0x00000000
+#define CPUID_EAX_10_ECX_02_ECX_POLICY_AND                           0x00000000
+#define CPUID_EAX_10_ECX_02_ECX_POLICY_OR                            0x00000000
+#define CPUID_EAX_10_ECX_02_EDX_POLICY_AND                           0x0000FFFF
+#define CPUID_EAX_10_ECX_02_EDX_POLICY_OR                            0x00000000
 
 /**
  * @brief Memory Bandwidth Allocation Enumeration Sub-leaf (EAX = 10H, ECX = ResID = 3)
@@ -4960,15 +5404,16 @@ typedef struct
        * [Bits 11:0] Reports the maximum MBA throttling value supported for the corresponding ResID using minus-one notation.
        */
       uint32_t max_mba_throttling_value                              : 12;
-#define CPUID_EAX_MAX_MBA_THROTTLING_VALUE_BIT                       0
-#define CPUID_EAX_MAX_MBA_THROTTLING_VALUE_FLAG                      0xFFF
-#define CPUID_EAX_MAX_MBA_THROTTLING_VALUE_MASK                      0xFFF
-#define CPUID_EAX_MAX_MBA_THROTTLING_VALUE(_)                        (((_) >> 0) & 0xFFF)
+#define CPUID_EAX_10_ECX_03_EAX_MAX_MBA_THROTTLING_VALUE_BIT         0
+#define CPUID_EAX_10_ECX_03_EAX_MAX_MBA_THROTTLING_VALUE_FLAG        0xFFF
+#define CPUID_EAX_10_ECX_03_EAX_MAX_MBA_THROTTLING_VALUE_MASK        0xFFF
+#define CPUID_EAX_10_ECX_03_EAX_MAX_MBA_THROTTLING_VALUE(_)          (((_) >> 0) & 0xFFF)
       uint32_t reserved1                                             : 20;
     };
 
     uint32_t flags;
   } eax;
+#define CPUID_EAX_10_ECX_03_EAX_RESERVED_BITS                        0xFFFFF000
 
   union
   {
@@ -4978,14 +5423,15 @@ typedef struct
        * [Bits 31:0] EBX is reserved.
        */
       uint32_t reserved                                              : 32;
-#define CPUID_EBX_RESERVED_BIT                                       0
-#define CPUID_EBX_RESERVED_FLAG                                      0xFFFFFFFF
-#define CPUID_EBX_RESERVED_MASK                                      0xFFFFFFFF
-#define CPUID_EBX_RESERVED(_)                                        (((_) >> 0) & 0xFFFFFFFF)
+#define CPUID_EAX_10_ECX_03_EBX_RESERVED_BIT                         0
+#define CPUID_EAX_10_ECX_03_EBX_RESERVED_FLAG                        0xFFFFFFFF
+#define CPUID_EAX_10_ECX_03_EBX_RESERVED_MASK                        0xFFFFFFFF
+#define CPUID_EAX_10_ECX_03_EBX_RESERVED(_)                          (((_) >> 0) & 0xFFFFFFFF)
     };
 
     uint32_t flags;
   } ebx;
+#define CPUID_EAX_10_ECX_03_EBX_RESERVED_BITS                        0xFFFFFFFF
 
   union
   {
@@ -4997,15 +5443,17 @@ typedef struct
        * [Bit 2] Reports whether the response of the delay values is linear.
        */
       uint32_t response_of_delay_is_linear                           : 1;
-#define CPUID_ECX_RESPONSE_OF_DELAY_IS_LINEAR_BIT                    2
-#define CPUID_ECX_RESPONSE_OF_DELAY_IS_LINEAR_FLAG                   0x04
-#define CPUID_ECX_RESPONSE_OF_DELAY_IS_LINEAR_MASK                   0x01
-#define CPUID_ECX_RESPONSE_OF_DELAY_IS_LINEAR(_)                     (((_) >> 2) & 0x01)
+#define CPUID_EAX_10_ECX_03_ECX_RESPONSE_OF_DELAY_IS_LINEAR_BIT      2
+#define CPUID_EAX_10_ECX_03_ECX_RESPONSE_OF_DELAY_IS_LINEAR_FLAG     0x04
+#define CPUID_EAX_10_ECX_03_ECX_RESPONSE_OF_DELAY_IS_LINEAR_MASK     0x01
+#define CPUID_EAX_10_ECX_03_ECX_RESPONSE_OF_DELAY_IS_LINEAR(_)       (((_) >> 2) & 0x01)
+#define CPUID_EAX_10_ECX_03_ECX_RESPONSE_OF_DELAY_IS_LINEAR_FEATURE  1986
       uint32_t reserved2                                             : 29;
     };
 
     uint32_t flags;
   } ecx;
+#define CPUID_EAX_10_ECX_03_ECX_RESERVED_BITS                        0xFFFFFFFB
 
   union
   {
@@ -5015,17 +5463,27 @@ typedef struct
        * [Bits 15:0] Highest COS number supported for this ResID.
        */
       uint32_t highest_cos_number_supported                          : 16;
-#define CPUID_EDX_HIGHEST_COS_NUMBER_SUPPORTED_BIT                   0
-#define CPUID_EDX_HIGHEST_COS_NUMBER_SUPPORTED_FLAG                  0xFFFF
-#define CPUID_EDX_HIGHEST_COS_NUMBER_SUPPORTED_MASK                  0xFFFF
-#define CPUID_EDX_HIGHEST_COS_NUMBER_SUPPORTED(_)                    (((_) >> 0) & 0xFFFF)
+#define CPUID_EAX_10_ECX_03_EDX_HIGHEST_COS_NUMBER_SUPPORTED_BIT     0
+#define CPUID_EAX_10_ECX_03_EDX_HIGHEST_COS_NUMBER_SUPPORTED_FLAG    0xFFFF
+#define CPUID_EAX_10_ECX_03_EDX_HIGHEST_COS_NUMBER_SUPPORTED_MASK    0xFFFF
+#define CPUID_EAX_10_ECX_03_EDX_HIGHEST_COS_NUMBER_SUPPORTED(_)      (((_) >> 0) & 0xFFFF)
       uint32_t reserved1                                             : 16;
     };
 
     uint32_t flags;
   } edx;
+#define CPUID_EAX_10_ECX_03_EDX_RESERVED_BITS                        0xFFFF0000
 
 } cpuid_eax_10_ecx_03;
+#define CPUID_EAX_10_ECX_03_SNAPSHOT_INDEX                           15
+#define CPUID_EAX_10_ECX_03_EAX_POLICY_AND                           0x00000FFF
+#define CPUID_EAX_10_ECX_03_EAX_POLICY_OR                            0x00000000
+#define CPUID_EAX_10_ECX_03_EBX_POLICY_AND                           0x00000000
+#define CPUID_EAX_10_ECX_03_EBX_POLICY_OR                            0x00000000
+#define CPUID_EAX_10_ECX_03_ECX_POLICY_AND                           0x00000004
+#define CPUID_EAX_10_ECX_03_ECX_POLICY_OR                            0x00000000
+#define CPUID_EAX_10_ECX_03_EDX_POLICY_AND                           0x0000FFFF
+#define CPUID_EAX_10_ECX_03_EDX_POLICY_OR                            0x00000000
 
 /**
  * @}
@@ -5057,43 +5515,48 @@ typedef struct
        * [Bit 0] If 1, Indicates Intel SGX supports the collection of SGX1 leaf functions.
        */
       uint32_t sgx1                                                  : 1;
-#define CPUID_EAX_SGX1_BIT                                           0
-#define CPUID_EAX_SGX1_FLAG                                          0x01
-#define CPUID_EAX_SGX1_MASK                                          0x01
-#define CPUID_EAX_SGX1(_)                                            (((_) >> 0) & 0x01)
+#define CPUID_EAX_12_ECX_00_EAX_SGX1_BIT                             0
+#define CPUID_EAX_12_ECX_00_EAX_SGX1_FLAG                            0x01
+#define CPUID_EAX_12_ECX_00_EAX_SGX1_MASK                            0x01
+#define CPUID_EAX_12_ECX_00_EAX_SGX1(_)                              (((_) >> 0) & 0x01)
+#define CPUID_EAX_12_ECX_00_EAX_SGX1_FEATURE                         2048
 
       /**
        * [Bit 1] If 1, Indicates Intel SGX supports the collection of SGX2 leaf functions.
        */
       uint32_t sgx2                                                  : 1;
-#define CPUID_EAX_SGX2_BIT                                           1
-#define CPUID_EAX_SGX2_FLAG                                          0x02
-#define CPUID_EAX_SGX2_MASK                                          0x01
-#define CPUID_EAX_SGX2(_)                                            (((_) >> 1) & 0x01)
+#define CPUID_EAX_12_ECX_00_EAX_SGX2_BIT                             1
+#define CPUID_EAX_12_ECX_00_EAX_SGX2_FLAG                            0x02
+#define CPUID_EAX_12_ECX_00_EAX_SGX2_MASK                            0x01
+#define CPUID_EAX_12_ECX_00_EAX_SGX2(_)                              (((_) >> 1) & 0x01)
+#define CPUID_EAX_12_ECX_00_EAX_SGX2_FEATURE                         2049
       uint32_t reserved1                                             : 3;
 
       /**
        * [Bit 5] If 1, indicates Intel SGX supports ENCLV instruction leaves EINCVIRTCHILD, EDECVIRTCHILD, and ESETCONTEXT.
        */
       uint32_t sgx_enclv_advanced                                    : 1;
-#define CPUID_EAX_SGX_ENCLV_ADVANCED_BIT                             5
-#define CPUID_EAX_SGX_ENCLV_ADVANCED_FLAG                            0x20
-#define CPUID_EAX_SGX_ENCLV_ADVANCED_MASK                            0x01
-#define CPUID_EAX_SGX_ENCLV_ADVANCED(_)                              (((_) >> 5) & 0x01)
+#define CPUID_EAX_12_ECX_00_EAX_SGX_ENCLV_ADVANCED_BIT               5
+#define CPUID_EAX_12_ECX_00_EAX_SGX_ENCLV_ADVANCED_FLAG              0x20
+#define CPUID_EAX_12_ECX_00_EAX_SGX_ENCLV_ADVANCED_MASK              0x01
+#define CPUID_EAX_12_ECX_00_EAX_SGX_ENCLV_ADVANCED(_)                (((_) >> 5) & 0x01)
+#define CPUID_EAX_12_ECX_00_EAX_SGX_ENCLV_ADVANCED_FEATURE           2053
 
       /**
        * [Bit 6] If 1, indicates Intel SGX supports ENCLS instruction leaves ETRACKC, ERDINFO, ELDBC, and ELDUC.
        */
       uint32_t sgx_encls_advanced                                    : 1;
-#define CPUID_EAX_SGX_ENCLS_ADVANCED_BIT                             6
-#define CPUID_EAX_SGX_ENCLS_ADVANCED_FLAG                            0x40
-#define CPUID_EAX_SGX_ENCLS_ADVANCED_MASK                            0x01
-#define CPUID_EAX_SGX_ENCLS_ADVANCED(_)                              (((_) >> 6) & 0x01)
+#define CPUID_EAX_12_ECX_00_EAX_SGX_ENCLS_ADVANCED_BIT               6
+#define CPUID_EAX_12_ECX_00_EAX_SGX_ENCLS_ADVANCED_FLAG              0x40
+#define CPUID_EAX_12_ECX_00_EAX_SGX_ENCLS_ADVANCED_MASK              0x01
+#define CPUID_EAX_12_ECX_00_EAX_SGX_ENCLS_ADVANCED(_)                (((_) >> 6) & 0x01)
+#define CPUID_EAX_12_ECX_00_EAX_SGX_ENCLS_ADVANCED_FEATURE           2054
       uint32_t reserved2                                             : 25;
     };
 
     uint32_t flags;
   } eax;
+#define CPUID_EAX_12_ECX_00_EAX_RESERVED_BITS                        0xFFFFFF9C
 
   union
   {
@@ -5103,14 +5566,15 @@ typedef struct
        * [Bits 31:0] Bit vector of supported extended SGX features.
        */
       uint32_t miscselect                                            : 32;
-#define CPUID_EBX_MISCSELECT_BIT                                     0
-#define CPUID_EBX_MISCSELECT_FLAG                                    0xFFFFFFFF
-#define CPUID_EBX_MISCSELECT_MASK                                    0xFFFFFFFF
-#define CPUID_EBX_MISCSELECT(_)                                      (((_) >> 0) & 0xFFFFFFFF)
+#define CPUID_EAX_12_ECX_00_EBX_MISCSELECT_BIT                       0
+#define CPUID_EAX_12_ECX_00_EBX_MISCSELECT_FLAG                      0xFFFFFFFF
+#define CPUID_EAX_12_ECX_00_EBX_MISCSELECT_MASK                      0xFFFFFFFF
+#define CPUID_EAX_12_ECX_00_EBX_MISCSELECT(_)                        (((_) >> 0) & 0xFFFFFFFF)
     };
 
     uint32_t flags;
   } ebx;
+#define CPUID_EAX_12_ECX_00_EBX_RESERVED_BITS                        0x00
 
   union
   {
@@ -5120,14 +5584,15 @@ typedef struct
        * [Bits 31:0] ECX is reserved.
        */
       uint32_t reserved                                              : 32;
-#define CPUID_ECX_RESERVED_BIT                                       0
-#define CPUID_ECX_RESERVED_FLAG                                      0xFFFFFFFF
-#define CPUID_ECX_RESERVED_MASK                                      0xFFFFFFFF
-#define CPUID_ECX_RESERVED(_)                                        (((_) >> 0) & 0xFFFFFFFF)
+#define CPUID_EAX_12_ECX_00_ECX_RESERVED_BIT                         0
+#define CPUID_EAX_12_ECX_00_ECX_RESERVED_FLAG                        0xFFFFFFFF
+#define CPUID_EAX_12_ECX_00_ECX_RESERVED_MASK                        0xFFFFFFFF
+#define CPUID_EAX_12_ECX_00_ECX_RESERVED(_)                          (((_) >> 0) & 0xFFFFFFFF)
     };
 
     uint32_t flags;
   } ecx;
+#define CPUID_EAX_12_ECX_00_ECX_RESERVED_BITS                        0xFFFFFFFF
 
   union
   {
@@ -5137,26 +5602,36 @@ typedef struct
        * [Bits 7:0] The maximum supported enclave size in non-64-bit mode is 2^(EDX[7:0]).
        */
       uint32_t max_enclave_size_not64                                : 8;
-#define CPUID_EDX_MAX_ENCLAVE_SIZE_NOT64_BIT                         0
-#define CPUID_EDX_MAX_ENCLAVE_SIZE_NOT64_FLAG                        0xFF
-#define CPUID_EDX_MAX_ENCLAVE_SIZE_NOT64_MASK                        0xFF
-#define CPUID_EDX_MAX_ENCLAVE_SIZE_NOT64(_)                          (((_) >> 0) & 0xFF)
+#define CPUID_EAX_12_ECX_00_EDX_MAX_ENCLAVE_SIZE_NOT64_BIT           0
+#define CPUID_EAX_12_ECX_00_EDX_MAX_ENCLAVE_SIZE_NOT64_FLAG          0xFF
+#define CPUID_EAX_12_ECX_00_EDX_MAX_ENCLAVE_SIZE_NOT64_MASK          0xFF
+#define CPUID_EAX_12_ECX_00_EDX_MAX_ENCLAVE_SIZE_NOT64(_)            (((_) >> 0) & 0xFF)
 
       /**
        * [Bits 15:8] The maximum supported enclave size in 64-bit mode is 2^(EDX[15:8]).
        */
       uint32_t max_enclave_size_64                                   : 8;
-#define CPUID_EDX_MAX_ENCLAVE_SIZE_64_BIT                            8
-#define CPUID_EDX_MAX_ENCLAVE_SIZE_64_FLAG                           0xFF00
-#define CPUID_EDX_MAX_ENCLAVE_SIZE_64_MASK                           0xFF
-#define CPUID_EDX_MAX_ENCLAVE_SIZE_64(_)                             (((_) >> 8) & 0xFF)
+#define CPUID_EAX_12_ECX_00_EDX_MAX_ENCLAVE_SIZE_64_BIT              8
+#define CPUID_EAX_12_ECX_00_EDX_MAX_ENCLAVE_SIZE_64_FLAG             0xFF00
+#define CPUID_EAX_12_ECX_00_EDX_MAX_ENCLAVE_SIZE_64_MASK             0xFF
+#define CPUID_EAX_12_ECX_00_EDX_MAX_ENCLAVE_SIZE_64(_)               (((_) >> 8) & 0xFF)
       uint32_t reserved1                                             : 16;
     };
 
     uint32_t flags;
   } edx;
+#define CPUID_EAX_12_ECX_00_EDX_RESERVED_BITS                        0xFFFF0000
 
 } cpuid_eax_12_ecx_00;
+#define CPUID_EAX_12_ECX_00_SNAPSHOT_INDEX                           16
+#define CPUID_EAX_12_ECX_00_EAX_POLICY_AND                           0x00000063
+#define CPUID_EAX_12_ECX_00_EAX_POLICY_OR                            0x00000000
+#define CPUID_EAX_12_ECX_00_EBX_POLICY_AND                           0xFFFFFFFF
+#define CPUID_EAX_12_ECX_00_EBX_POLICY_OR                            0x00000000
+#define CPUID_EAX_12_ECX_00_ECX_POLICY_AND                           0x00000000
+#define CPUID_EAX_12_ECX_00_ECX_POLICY_OR                            0x00000000
+#define CPUID_EAX_12_ECX_00_EDX_POLICY_AND                           0x0000FFFF
+#define CPUID_EAX_12_ECX_00_EDX_POLICY_OR                            0x00000000
 
 /**
  * @brief Intel SGX Attributes Enumeration Leaf, sub-leaf 1 (EAX = 12H, ECX = 1)
@@ -5173,14 +5648,15 @@ typedef struct
        * [Bits 31:0] Reports the valid bits of SECS.ATTRIBUTES[31:0] that software can set with ECREATE.
        */
       uint32_t valid_secs_attributes_0                               : 32;
-#define CPUID_EAX_VALID_SECS_ATTRIBUTES_0_BIT                        0
-#define CPUID_EAX_VALID_SECS_ATTRIBUTES_0_FLAG                       0xFFFFFFFF
-#define CPUID_EAX_VALID_SECS_ATTRIBUTES_0_MASK                       0xFFFFFFFF
-#define CPUID_EAX_VALID_SECS_ATTRIBUTES_0(_)                         (((_) >> 0) & 0xFFFFFFFF)
+#define CPUID_EAX_12_ECX_01_EAX_VALID_SECS_ATTRIBUTES_0_BIT          0
+#define CPUID_EAX_12_ECX_01_EAX_VALID_SECS_ATTRIBUTES_0_FLAG         0xFFFFFFFF
+#define CPUID_EAX_12_ECX_01_EAX_VALID_SECS_ATTRIBUTES_0_MASK         0xFFFFFFFF
+#define CPUID_EAX_12_ECX_01_EAX_VALID_SECS_ATTRIBUTES_0(_)           (((_) >> 0) & 0xFFFFFFFF)
     };
 
     uint32_t flags;
   } eax;
+#define CPUID_EAX_12_ECX_01_EAX_RESERVED_BITS                        0x00
 
   union
   {
@@ -5190,14 +5666,15 @@ typedef struct
        * [Bits 31:0] Reports the valid bits of SECS.ATTRIBUTES[63:32] that software can set with ECREATE.
        */
       uint32_t valid_secs_attributes_1                               : 32;
-#define CPUID_EBX_VALID_SECS_ATTRIBUTES_1_BIT                        0
-#define CPUID_EBX_VALID_SECS_ATTRIBUTES_1_FLAG                       0xFFFFFFFF
-#define CPUID_EBX_VALID_SECS_ATTRIBUTES_1_MASK                       0xFFFFFFFF
-#define CPUID_EBX_VALID_SECS_ATTRIBUTES_1(_)                         (((_) >> 0) & 0xFFFFFFFF)
+#define CPUID_EAX_12_ECX_01_EBX_VALID_SECS_ATTRIBUTES_1_BIT          0
+#define CPUID_EAX_12_ECX_01_EBX_VALID_SECS_ATTRIBUTES_1_FLAG         0xFFFFFFFF
+#define CPUID_EAX_12_ECX_01_EBX_VALID_SECS_ATTRIBUTES_1_MASK         0xFFFFFFFF
+#define CPUID_EAX_12_ECX_01_EBX_VALID_SECS_ATTRIBUTES_1(_)           (((_) >> 0) & 0xFFFFFFFF)
     };
 
     uint32_t flags;
   } ebx;
+#define CPUID_EAX_12_ECX_01_EBX_RESERVED_BITS                        0x00
 
   union
   {
@@ -5207,14 +5684,15 @@ typedef struct
        * [Bits 31:0] Reports the valid bits of SECS.ATTRIBUTES[95:64] that software can set with ECREATE.
        */
       uint32_t valid_secs_attributes_2                               : 32;
-#define CPUID_ECX_VALID_SECS_ATTRIBUTES_2_BIT                        0
-#define CPUID_ECX_VALID_SECS_ATTRIBUTES_2_FLAG                       0xFFFFFFFF
-#define CPUID_ECX_VALID_SECS_ATTRIBUTES_2_MASK                       0xFFFFFFFF
-#define CPUID_ECX_VALID_SECS_ATTRIBUTES_2(_)                         (((_) >> 0) & 0xFFFFFFFF)
+#define CPUID_EAX_12_ECX_01_ECX_VALID_SECS_ATTRIBUTES_2_BIT          0
+#define CPUID_EAX_12_ECX_01_ECX_VALID_SECS_ATTRIBUTES_2_FLAG         0xFFFFFFFF
+#define CPUID_EAX_12_ECX_01_ECX_VALID_SECS_ATTRIBUTES_2_MASK         0xFFFFFFFF
+#define CPUID_EAX_12_ECX_01_ECX_VALID_SECS_ATTRIBUTES_2(_)           (((_) >> 0) & 0xFFFFFFFF)
     };
 
     uint32_t flags;
   } ecx;
+#define CPUID_EAX_12_ECX_01_ECX_RESERVED_BITS                        0x00
 
   union
   {
@@ -5224,16 +5702,26 @@ typedef struct
        * [Bits 31:0] Reports the valid bits of SECS.ATTRIBUTES[127:96] that software can set with ECREATE.
        */
       uint32_t valid_secs_attributes_3                               : 32;
-#define CPUID_EDX_VALID_SECS_ATTRIBUTES_3_BIT                        0
-#define CPUID_EDX_VALID_SECS_ATTRIBUTES_3_FLAG                       0xFFFFFFFF
-#define CPUID_EDX_VALID_SECS_ATTRIBUTES_3_MASK                       0xFFFFFFFF
-#define CPUID_EDX_VALID_SECS_ATTRIBUTES_3(_)                         (((_) >> 0) & 0xFFFFFFFF)
+#define CPUID_EAX_12_ECX_01_EDX_VALID_SECS_ATTRIBUTES_3_BIT          0
+#define CPUID_EAX_12_ECX_01_EDX_VALID_SECS_ATTRIBUTES_3_FLAG         0xFFFFFFFF
+#define CPUID_EAX_12_ECX_01_EDX_VALID_SECS_ATTRIBUTES_3_MASK         0xFFFFFFFF
+#define CPUID_EAX_12_ECX_01_EDX_VALID_SECS_ATTRIBUTES_3(_)           (((_) >> 0) & 0xFFFFFFFF)
     };
 
     uint32_t flags;
   } edx;
+#define CPUID_EAX_12_ECX_01_EDX_RESERVED_BITS                        0x00
 
 } cpuid_eax_12_ecx_01;
+#define CPUID_EAX_12_ECX_01_SNAPSHOT_INDEX                           17
+#define CPUID_EAX_12_ECX_01_EAX_POLICY_AND                           0xFFFFFFFF
+#define CPUID_EAX_12_ECX_01_EAX_POLICY_OR                            0x00000000
+#define CPUID_EAX_12_ECX_01_EBX_POLICY_AND                           0xFFFFFFFF
+#define CPUID_EAX_12_ECX_01_EBX_POLICY_OR                            0x00000000
+#define CPUID_EAX_12_ECX_01_ECX_POLICY_AND                           0xFFFFFFFF
+#define CPUID_EAX_12_ECX_01_ECX_POLICY_OR                            0x00000000
+#define CPUID_EAX_12_ECX_01_EDX_POLICY_AND                           0xFFFFFFFF
+#define CPUID_EAX_12_ECX_01_EDX_POLICY_OR                            0x00000000
 
 /**
  * @brief Intel SGX EPC Enumeration Leaf, sub-leaves (EAX = 12H, ECX = 2 or higher)
@@ -5251,15 +5739,16 @@ typedef struct
        * [Bits 3:0] Sub-leaf Type 0. Indicates this sub-leaf is invalid.
        */
       uint32_t sub_leaf_type                                         : 4;
-#define CPUID_EAX_SUB_LEAF_TYPE_BIT                                  0
-#define CPUID_EAX_SUB_LEAF_TYPE_FLAG                                 0x0F
-#define CPUID_EAX_SUB_LEAF_TYPE_MASK                                 0x0F
-#define CPUID_EAX_SUB_LEAF_TYPE(_)                                   (((_) >> 0) & 0x0F)
+#define CPUID_EAX_12_ECX_02P_SLT_0_EAX_SUB_LEAF_TYPE_BIT             0
+#define CPUID_EAX_12_ECX_02P_SLT_0_EAX_SUB_LEAF_TYPE_FLAG            0x0F
+#define CPUID_EAX_12_ECX_02P_SLT_0_EAX_SUB_LEAF_TYPE_MASK            0x0F
+#define CPUID_EAX_12_ECX_02P_SLT_0_EAX_SUB_LEAF_TYPE(_)              (((_) >> 0) & 0x0F)
       uint32_t reserved1                                             : 28;
     };
 
     uint32_t flags;
   } eax;
+#define CPUID_EAX_12_ECX_02P_SLT_0_EAX_RESERVED_BITS                 0xFFFFFFF0
 
   union
   {
@@ -5269,14 +5758,15 @@ typedef struct
        * [Bits 31:0] EBX is zero.
        */
       uint32_t zero                                                  : 32;
-#define CPUID_EBX_ZERO_BIT                                           0
-#define CPUID_EBX_ZERO_FLAG                                          0xFFFFFFFF
-#define CPUID_EBX_ZERO_MASK                                          0xFFFFFFFF
-#define CPUID_EBX_ZERO(_)                                            (((_) >> 0) & 0xFFFFFFFF)
+#define CPUID_EAX_12_ECX_02P_SLT_0_EBX_ZERO_BIT                      0
+#define CPUID_EAX_12_ECX_02P_SLT_0_EBX_ZERO_FLAG                     0xFFFFFFFF
+#define CPUID_EAX_12_ECX_02P_SLT_0_EBX_ZERO_MASK                     0xFFFFFFFF
+#define CPUID_EAX_12_ECX_02P_SLT_0_EBX_ZERO(_)                       (((_) >> 0) & 0xFFFFFFFF)
     };
 
     uint32_t flags;
   } ebx;
+#define CPUID_EAX_12_ECX_02P_SLT_0_EBX_RESERVED_BITS                 0x00
 
   union
   {
@@ -5286,14 +5776,15 @@ typedef struct
        * [Bits 31:0] ECX is zero.
        */
       uint32_t zero                                                  : 32;
-#define CPUID_ECX_ZERO_BIT                                           0
-#define CPUID_ECX_ZERO_FLAG                                          0xFFFFFFFF
-#define CPUID_ECX_ZERO_MASK                                          0xFFFFFFFF
-#define CPUID_ECX_ZERO(_)                                            (((_) >> 0) & 0xFFFFFFFF)
+#define CPUID_EAX_12_ECX_02P_SLT_0_ECX_ZERO_BIT                      0
+#define CPUID_EAX_12_ECX_02P_SLT_0_ECX_ZERO_FLAG                     0xFFFFFFFF
+#define CPUID_EAX_12_ECX_02P_SLT_0_ECX_ZERO_MASK                     0xFFFFFFFF
+#define CPUID_EAX_12_ECX_02P_SLT_0_ECX_ZERO(_)                       (((_) >> 0) & 0xFFFFFFFF)
     };
 
     uint32_t flags;
   } ecx;
+#define CPUID_EAX_12_ECX_02P_SLT_0_ECX_RESERVED_BITS                 0x00
 
   union
   {
@@ -5303,14 +5794,15 @@ typedef struct
        * [Bits 31:0] EDX is zero.
        */
       uint32_t zero                                                  : 32;
-#define CPUID_EDX_ZERO_BIT                                           0
-#define CPUID_EDX_ZERO_FLAG                                          0xFFFFFFFF
-#define CPUID_EDX_ZERO_MASK                                          0xFFFFFFFF
-#define CPUID_EDX_ZERO(_)                                            (((_) >> 0) & 0xFFFFFFFF)
+#define CPUID_EAX_12_ECX_02P_SLT_0_EDX_ZERO_BIT                      0
+#define CPUID_EAX_12_ECX_02P_SLT_0_EDX_ZERO_FLAG                     0xFFFFFFFF
+#define CPUID_EAX_12_ECX_02P_SLT_0_EDX_ZERO_MASK                     0xFFFFFFFF
+#define CPUID_EAX_12_ECX_02P_SLT_0_EDX_ZERO(_)                       (((_) >> 0) & 0xFFFFFFFF)
     };
 
     uint32_t flags;
   } edx;
+#define CPUID_EAX_12_ECX_02P_SLT_0_EDX_RESERVED_BITS                 0x00
 
 } cpuid_eax_12_ecx_02p_slt_0;
 
@@ -5331,24 +5823,25 @@ typedef struct
        * Enclave Page Cache (EPC) section.
        */
       uint32_t sub_leaf_type                                         : 4;
-#define CPUID_EAX_SUB_LEAF_TYPE_BIT                                  0
-#define CPUID_EAX_SUB_LEAF_TYPE_FLAG                                 0x0F
-#define CPUID_EAX_SUB_LEAF_TYPE_MASK                                 0x0F
-#define CPUID_EAX_SUB_LEAF_TYPE(_)                                   (((_) >> 0) & 0x0F)
+#define CPUID_EAX_12_ECX_02P_SLT_1_EAX_SUB_LEAF_TYPE_BIT             0
+#define CPUID_EAX_12_ECX_02P_SLT_1_EAX_SUB_LEAF_TYPE_FLAG            0x0F
+#define CPUID_EAX_12_ECX_02P_SLT_1_EAX_SUB_LEAF_TYPE_MASK            0x0F
+#define CPUID_EAX_12_ECX_02P_SLT_1_EAX_SUB_LEAF_TYPE(_)              (((_) >> 0) & 0x0F)
       uint32_t reserved1                                             : 8;
 
       /**
        * [Bits 31:12] Bits 31:12 of the physical address of the base of the EPC section.
        */
       uint32_t epc_base_physical_address_1                           : 20;
-#define CPUID_EAX_EPC_BASE_PHYSICAL_ADDRESS_1_BIT                    12
-#define CPUID_EAX_EPC_BASE_PHYSICAL_ADDRESS_1_FLAG                   0xFFFFF000
-#define CPUID_EAX_EPC_BASE_PHYSICAL_ADDRESS_1_MASK                   0xFFFFF
-#define CPUID_EAX_EPC_BASE_PHYSICAL_ADDRESS_1(_)                     (((_) >> 12) & 0xFFFFF)
+#define CPUID_EAX_12_ECX_02P_SLT_1_EAX_EPC_BASE_PHYSICAL_ADDRESS_1_BIT 12
+#define CPUID_EAX_12_ECX_02P_SLT_1_EAX_EPC_BASE_PHYSICAL_ADDRESS_1_FLAG 0xFFFFF000
+#define CPUID_EAX_12_ECX_02P_SLT_1_EAX_EPC_BASE_PHYSICAL_ADDRESS_1_MASK 0xFFFFF
+#define CPUID_EAX_12_ECX_02P_SLT_1_EAX_EPC_BASE_PHYSICAL_ADDRESS_1(_) (((_) >> 12) & 0xFFFFF)
     };
 
     uint32_t flags;
   } eax;
+#define CPUID_EAX_12_ECX_02P_SLT_1_EAX_RESERVED_BITS                 0xFF0
 
   union
   {
@@ -5358,15 +5851,16 @@ typedef struct
        * [Bits 19:0] Bits 51:32 of the physical address of the base of the EPC section.
        */
       uint32_t epc_base_physical_address_2                           : 20;
-#define CPUID_EBX_EPC_BASE_PHYSICAL_ADDRESS_2_BIT                    0
-#define CPUID_EBX_EPC_BASE_PHYSICAL_ADDRESS_2_FLAG                   0xFFFFF
-#define CPUID_EBX_EPC_BASE_PHYSICAL_ADDRESS_2_MASK                   0xFFFFF
-#define CPUID_EBX_EPC_BASE_PHYSICAL_ADDRESS_2(_)                     (((_) >> 0) & 0xFFFFF)
+#define CPUID_EAX_12_ECX_02P_SLT_1_EBX_EPC_BASE_PHYSICAL_ADDRESS_2_BIT 0
+#define CPUID_EAX_12_ECX_02P_SLT_1_EBX_EPC_BASE_PHYSICAL_ADDRESS_2_FLAG 0xFFFFF
+#define CPUID_EAX_12_ECX_02P_SLT_1_EBX_EPC_BASE_PHYSICAL_ADDRESS_2_MASK 0xFFFFF
+#define CPUID_EAX_12_ECX_02P_SLT_1_EBX_EPC_BASE_PHYSICAL_ADDRESS_2(_) (((_) >> 0) & 0xFFFFF)
       uint32_t reserved1                                             : 12;
     };
 
     uint32_t flags;
   } ebx;
+#define CPUID_EAX_12_ECX_02P_SLT_1_EBX_RESERVED_BITS                 0xFFF00000
 
   union
   {
@@ -5379,24 +5873,25 @@ typedef struct
        * All other encodings are reserved.
        */
       uint32_t epc_section_property                                  : 4;
-#define CPUID_ECX_EPC_SECTION_PROPERTY_BIT                           0
-#define CPUID_ECX_EPC_SECTION_PROPERTY_FLAG                          0x0F
-#define CPUID_ECX_EPC_SECTION_PROPERTY_MASK                          0x0F
-#define CPUID_ECX_EPC_SECTION_PROPERTY(_)                            (((_) >> 0) & 0x0F)
+#define CPUID_EAX_12_ECX_02P_SLT_1_ECX_EPC_SECTION_PROPERTY_BIT      0
+#define CPUID_EAX_12_ECX_02P_SLT_1_ECX_EPC_SECTION_PROPERTY_FLAG     0x0F
+#define CPUID_EAX_12_ECX_02P_SLT_1_ECX_EPC_SECTION_PROPERTY_MASK     0x0F
+#define CPUID_EAX_12_ECX_02P_SLT_1_ECX_EPC_SECTION_PROPERTY(_)       (((_) >> 0) & 0x0F)
       uint32_t reserved1                                             : 8;
 
       /**
        * [Bits 31:12] Bits 31:12 of the size of the corresponding EPC section within the Processor Reserved Memory.
        */
       uint32_t epc_size_1                                            : 20;
-#define CPUID_ECX_EPC_SIZE_1_BIT                                     12
-#define CPUID_ECX_EPC_SIZE_1_FLAG                                    0xFFFFF000
-#define CPUID_ECX_EPC_SIZE_1_MASK                                    0xFFFFF
-#define CPUID_ECX_EPC_SIZE_1(_)                                      (((_) >> 12) & 0xFFFFF)
+#define CPUID_EAX_12_ECX_02P_SLT_1_ECX_EPC_SIZE_1_BIT                12
+#define CPUID_EAX_12_ECX_02P_SLT_1_ECX_EPC_SIZE_1_FLAG               0xFFFFF000
+#define CPUID_EAX_12_ECX_02P_SLT_1_ECX_EPC_SIZE_1_MASK               0xFFFFF
+#define CPUID_EAX_12_ECX_02P_SLT_1_ECX_EPC_SIZE_1(_)                 (((_) >> 12) & 0xFFFFF)
     };
 
     uint32_t flags;
   } ecx;
+#define CPUID_EAX_12_ECX_02P_SLT_1_ECX_RESERVED_BITS                 0xFF0
 
   union
   {
@@ -5406,15 +5901,16 @@ typedef struct
        * [Bits 19:0] Bits 51:32 of the size of the corresponding EPC section within the Processor Reserved Memory.
        */
       uint32_t epc_size_2                                            : 20;
-#define CPUID_EDX_EPC_SIZE_2_BIT                                     0
-#define CPUID_EDX_EPC_SIZE_2_FLAG                                    0xFFFFF
-#define CPUID_EDX_EPC_SIZE_2_MASK                                    0xFFFFF
-#define CPUID_EDX_EPC_SIZE_2(_)                                      (((_) >> 0) & 0xFFFFF)
+#define CPUID_EAX_12_ECX_02P_SLT_1_EDX_EPC_SIZE_2_BIT                0
+#define CPUID_EAX_12_ECX_02P_SLT_1_EDX_EPC_SIZE_2_FLAG               0xFFFFF
+#define CPUID_EAX_12_ECX_02P_SLT_1_EDX_EPC_SIZE_2_MASK               0xFFFFF
+#define CPUID_EAX_12_ECX_02P_SLT_1_EDX_EPC_SIZE_2(_)                 (((_) >> 0) & 0xFFFFF)
       uint32_t reserved1                                             : 12;
     };
 
     uint32_t flags;
   } edx;
+#define CPUID_EAX_12_ECX_02P_SLT_1_EDX_RESERVED_BITS                 0xFFF00000
 
 } cpuid_eax_12_ecx_02p_slt_1;
 
@@ -5448,14 +5944,15 @@ typedef struct
        * [Bits 31:0] Reports the maximum sub-leaf supported in leaf 14H.
        */
       uint32_t max_sub_leaf                                          : 32;
-#define CPUID_EAX_MAX_SUB_LEAF_BIT                                   0
-#define CPUID_EAX_MAX_SUB_LEAF_FLAG                                  0xFFFFFFFF
-#define CPUID_EAX_MAX_SUB_LEAF_MASK                                  0xFFFFFFFF
-#define CPUID_EAX_MAX_SUB_LEAF(_)                                    (((_) >> 0) & 0xFFFFFFFF)
+#define CPUID_EAX_14_ECX_00_EAX_MAX_SUB_LEAF_BIT                     0
+#define CPUID_EAX_14_ECX_00_EAX_MAX_SUB_LEAF_FLAG                    0xFFFFFFFF
+#define CPUID_EAX_14_ECX_00_EAX_MAX_SUB_LEAF_MASK                    0xFFFFFFFF
+#define CPUID_EAX_14_ECX_00_EAX_MAX_SUB_LEAF(_)                      (((_) >> 0) & 0xFFFFFFFF)
     };
 
     uint32_t flags;
   } eax;
+#define CPUID_EAX_14_ECX_00_EAX_RESERVED_BITS                        0x00
 
   union
   {
@@ -5465,58 +5962,64 @@ typedef struct
        * [Bit 0] If 1, indicates that IA32_RTIT_CTL.CR3Filter can be set to 1, and that IA32_RTIT_CR3_MATCH MSR can be accessed.
        */
       uint32_t flag0                                                 : 1;
-#define CPUID_EBX_FLAG0_BIT                                          0
-#define CPUID_EBX_FLAG0_FLAG                                         0x01
-#define CPUID_EBX_FLAG0_MASK                                         0x01
-#define CPUID_EBX_FLAG0(_)                                           (((_) >> 0) & 0x01)
+#define CPUID_EAX_14_ECX_00_EBX_FLAG0_BIT                            0
+#define CPUID_EAX_14_ECX_00_EBX_FLAG0_FLAG                           0x01
+#define CPUID_EAX_14_ECX_00_EBX_FLAG0_MASK                           0x01
+#define CPUID_EAX_14_ECX_00_EBX_FLAG0(_)                             (((_) >> 0) & 0x01)
+#define CPUID_EAX_14_ECX_00_EBX_FLAG0_FEATURE                        2336
 
       /**
        * [Bit 1] If 1, indicates support of Configurable PSB and Cycle-Accurate Mode.
        */
       uint32_t flag1                                                 : 1;
-#define CPUID_EBX_FLAG1_BIT                                          1
-#define CPUID_EBX_FLAG1_FLAG                                         0x02
-#define CPUID_EBX_FLAG1_MASK                                         0x01
-#define CPUID_EBX_FLAG1(_)                                           (((_) >> 1) & 0x01)
+#define CPUID_EAX_14_ECX_00_EBX_FLAG1_BIT                            1
+#define CPUID_EAX_14_ECX_00_EBX_FLAG1_FLAG                           0x02
+#define CPUID_EAX_14_ECX_00_EBX_FLAG1_MASK                           0x01
+#define CPUID_EAX_14_ECX_00_EBX_FLAG1(_)                             (((_) >> 1) & 0x01)
+#define CPUID_EAX_14_ECX_00_EBX_FLAG1_FEATURE                        2337
 
       /**
        * [Bit 2] If 1, indicates support of IP Filtering, TraceStop filtering, and preservation of Intel PT MSRs across warm
        * reset.
        */
       uint32_t flag2                                                 : 1;
-#define CPUID_EBX_FLAG2_BIT                                          2
-#define CPUID_EBX_FLAG2_FLAG                                         0x04
-#define CPUID_EBX_FLAG2_MASK                                         0x01
-#define CPUID_EBX_FLAG2(_)                                           (((_) >> 2) & 0x01)
+#define CPUID_EAX_14_ECX_00_EBX_FLAG2_BIT                            2
+#define CPUID_EAX_14_ECX_00_EBX_FLAG2_FLAG                           0x04
+#define CPUID_EAX_14_ECX_00_EBX_FLAG2_MASK                           0x01
+#define CPUID_EAX_14_ECX_00_EBX_FLAG2(_)                             (((_) >> 2) & 0x01)
+#define CPUID_EAX_14_ECX_00_EBX_FLAG2_FEATURE                        2338
 
       /**
        * [Bit 3] If 1, indicates support of MTC timing packet and suppression of COFI-based packets.
        */
       uint32_t flag3                                                 : 1;
-#define CPUID_EBX_FLAG3_BIT                                          3
-#define CPUID_EBX_FLAG3_FLAG                                         0x08
-#define CPUID_EBX_FLAG3_MASK                                         0x01
-#define CPUID_EBX_FLAG3(_)                                           (((_) >> 3) & 0x01)
+#define CPUID_EAX_14_ECX_00_EBX_FLAG3_BIT                            3
+#define CPUID_EAX_14_ECX_00_EBX_FLAG3_FLAG                           0x08
+#define CPUID_EAX_14_ECX_00_EBX_FLAG3_MASK                           0x01
+#define CPUID_EAX_14_ECX_00_EBX_FLAG3(_)                             (((_) >> 3) & 0x01)
+#define CPUID_EAX_14_ECX_00_EBX_FLAG3_FEATURE                        2339
 
       /**
        * [Bit 4] If 1, indicates support of PTWRITE. Writes can set IA32_RTIT_CTL[12] (PTWEn) and IA32_RTIT_CTL[5] (FUPonPTW),
        * and PTWRITE can generate packets.
        */
       uint32_t flag4                                                 : 1;
-#define CPUID_EBX_FLAG4_BIT                                          4
-#define CPUID_EBX_FLAG4_FLAG                                         0x10
-#define CPUID_EBX_FLAG4_MASK                                         0x01
-#define CPUID_EBX_FLAG4(_)                                           (((_) >> 4) & 0x01)
+#define CPUID_EAX_14_ECX_00_EBX_FLAG4_BIT                            4
+#define CPUID_EAX_14_ECX_00_EBX_FLAG4_FLAG                           0x10
+#define CPUID_EAX_14_ECX_00_EBX_FLAG4_MASK                           0x01
+#define CPUID_EAX_14_ECX_00_EBX_FLAG4(_)                             (((_) >> 4) & 0x01)
+#define CPUID_EAX_14_ECX_00_EBX_FLAG4_FEATURE                        2340
 
       /**
        * [Bit 5] If 1, indicates support of Power Event Trace. Writes can set IA32_RTIT_CTL[4] (PwrEvtEn), enabling Power Event
        * Trace packet generation.
        */
       uint32_t flag5                                                 : 1;
-#define CPUID_EBX_FLAG5_BIT                                          5
-#define CPUID_EBX_FLAG5_FLAG                                         0x20
-#define CPUID_EBX_FLAG5_MASK                                         0x01
-#define CPUID_EBX_FLAG5(_)                                           (((_) >> 5) & 0x01)
+#define CPUID_EAX_14_ECX_00_EBX_FLAG5_BIT                            5
+#define CPUID_EAX_14_ECX_00_EBX_FLAG5_FLAG                           0x20
+#define CPUID_EAX_14_ECX_00_EBX_FLAG5_MASK                           0x01
+#define CPUID_EAX_14_ECX_00_EBX_FLAG5(_)                             (((_) >> 5) & 0x01)
+#define CPUID_EAX_14_ECX_00_EBX_FLAG5_FEATURE                        2341
 
       /**
        * [Bit 6] If 1, indicates support for PSB and PH preservation. Writes can set IA32_RTIT CTL[56] (InjectPsb-PmiOnEnable),
@@ -5524,33 +6027,37 @@ typedef struct
        * preserve ToPA PMIs and/or PSBs otherwise lost due to Intel PT disable. Writes can also set PendToPAPMI and PendPSB.
        */
       uint32_t flag6                                                 : 1;
-#define CPUID_EBX_FLAG6_BIT                                          6
-#define CPUID_EBX_FLAG6_FLAG                                         0x40
-#define CPUID_EBX_FLAG6_MASK                                         0x01
-#define CPUID_EBX_FLAG6(_)                                           (((_) >> 6) & 0x01)
+#define CPUID_EAX_14_ECX_00_EBX_FLAG6_BIT                            6
+#define CPUID_EAX_14_ECX_00_EBX_FLAG6_FLAG                           0x40
+#define CPUID_EAX_14_ECX_00_EBX_FLAG6_MASK                           0x01
+#define CPUID_EAX_14_ECX_00_EBX_FLAG6(_)                             (((_) >> 6) & 0x01)
+#define CPUID_EAX_14_ECX_00_EBX_FLAG6_FEATURE                        2342
 
       /**
        * [Bit 7] If 1, writes can set IA32_RTIT_CTL[31] (EventEn), enabling Event Trace packet generation.
        */
       uint32_t flag7                                                 : 1;
-#define CPUID_EBX_FLAG7_BIT                                          7
-#define CPUID_EBX_FLAG7_FLAG                                         0x80
-#define CPUID_EBX_FLAG7_MASK                                         0x01
-#define CPUID_EBX_FLAG7(_)                                           (((_) >> 7) & 0x01)
+#define CPUID_EAX_14_ECX_00_EBX_FLAG7_BIT                            7
+#define CPUID_EAX_14_ECX_00_EBX_FLAG7_FLAG                           0x80
+#define CPUID_EAX_14_ECX_00_EBX_FLAG7_MASK                           0x01
+#define CPUID_EAX_14_ECX_00_EBX_FLAG7(_)                             (((_) >> 7) & 0x01)
+#define CPUID_EAX_14_ECX_00_EBX_FLAG7_FEATURE                        2343
 
       /**
        * [Bit 8] If 1, writes can set IA32_RTIT_CTL[55] (DisTNT), disabling TNT packet generation.
        */
       uint32_t flag8                                                 : 1;
-#define CPUID_EBX_FLAG8_BIT                                          8
-#define CPUID_EBX_FLAG8_FLAG                                         0x100
-#define CPUID_EBX_FLAG8_MASK                                         0x01
-#define CPUID_EBX_FLAG8(_)                                           (((_) >> 8) & 0x01)
+#define CPUID_EAX_14_ECX_00_EBX_FLAG8_BIT                            8
+#define CPUID_EAX_14_ECX_00_EBX_FLAG8_FLAG                           0x100
+#define CPUID_EAX_14_ECX_00_EBX_FLAG8_MASK                           0x01
+#define CPUID_EAX_14_ECX_00_EBX_FLAG8(_)                             (((_) >> 8) & 0x01)
+#define CPUID_EAX_14_ECX_00_EBX_FLAG8_FEATURE                        2344
       uint32_t reserved1                                             : 23;
     };
 
     uint32_t flags;
   } ebx;
+#define CPUID_EAX_14_ECX_00_EBX_RESERVED_BITS                        0xFFFFFE00
 
   union
   {
@@ -5561,52 +6068,58 @@ typedef struct
        * IA32_RTIT_OUTPUT_BASE and IA32_RTIT_OUTPUT_MASK_PTRS MSRs can be accessed.
        */
       uint32_t flag0                                                 : 1;
-#define CPUID_ECX_FLAG0_BIT                                          0
-#define CPUID_ECX_FLAG0_FLAG                                         0x01
-#define CPUID_ECX_FLAG0_MASK                                         0x01
-#define CPUID_ECX_FLAG0(_)                                           (((_) >> 0) & 0x01)
+#define CPUID_EAX_14_ECX_00_ECX_FLAG0_BIT                            0
+#define CPUID_EAX_14_ECX_00_ECX_FLAG0_FLAG                           0x01
+#define CPUID_EAX_14_ECX_00_ECX_FLAG0_MASK                           0x01
+#define CPUID_EAX_14_ECX_00_ECX_FLAG0(_)                             (((_) >> 0) & 0x01)
+#define CPUID_EAX_14_ECX_00_ECX_FLAG0_FEATURE                        2368
 
       /**
        * [Bit 1] If 1, ToPA tables can hold any number of output entries, up to the maximum allowed by the MaskOrTableOffset
        * field of IA32_RTIT_OUTPUT_MASK_PTRS.
        */
       uint32_t flag1                                                 : 1;
-#define CPUID_ECX_FLAG1_BIT                                          1
-#define CPUID_ECX_FLAG1_FLAG                                         0x02
-#define CPUID_ECX_FLAG1_MASK                                         0x01
-#define CPUID_ECX_FLAG1(_)                                           (((_) >> 1) & 0x01)
+#define CPUID_EAX_14_ECX_00_ECX_FLAG1_BIT                            1
+#define CPUID_EAX_14_ECX_00_ECX_FLAG1_FLAG                           0x02
+#define CPUID_EAX_14_ECX_00_ECX_FLAG1_MASK                           0x01
+#define CPUID_EAX_14_ECX_00_ECX_FLAG1(_)                             (((_) >> 1) & 0x01)
+#define CPUID_EAX_14_ECX_00_ECX_FLAG1_FEATURE                        2369
 
       /**
        * [Bit 2] If 1, indicates support of Single-Range Output scheme.
        */
       uint32_t flag2                                                 : 1;
-#define CPUID_ECX_FLAG2_BIT                                          2
-#define CPUID_ECX_FLAG2_FLAG                                         0x04
-#define CPUID_ECX_FLAG2_MASK                                         0x01
-#define CPUID_ECX_FLAG2(_)                                           (((_) >> 2) & 0x01)
+#define CPUID_EAX_14_ECX_00_ECX_FLAG2_BIT                            2
+#define CPUID_EAX_14_ECX_00_ECX_FLAG2_FLAG                           0x04
+#define CPUID_EAX_14_ECX_00_ECX_FLAG2_MASK                           0x01
+#define CPUID_EAX_14_ECX_00_ECX_FLAG2(_)                             (((_) >> 2) & 0x01)
+#define CPUID_EAX_14_ECX_00_ECX_FLAG2_FEATURE                        2370
 
       /**
        * [Bit 3] If 1, indicates support of output to Trace Transport subsystem.
        */
       uint32_t flag3                                                 : 1;
-#define CPUID_ECX_FLAG3_BIT                                          3
-#define CPUID_ECX_FLAG3_FLAG                                         0x08
-#define CPUID_ECX_FLAG3_MASK                                         0x01
-#define CPUID_ECX_FLAG3(_)                                           (((_) >> 3) & 0x01)
+#define CPUID_EAX_14_ECX_00_ECX_FLAG3_BIT                            3
+#define CPUID_EAX_14_ECX_00_ECX_FLAG3_FLAG                           0x08
+#define CPUID_EAX_14_ECX_00_ECX_FLAG3_MASK                           0x01
+#define CPUID_EAX_14_ECX_00_ECX_FLAG3(_)                             (((_) >> 3) & 0x01)
+#define CPUID_EAX_14_ECX_00_ECX_FLAG3_FEATURE                        2371
       uint32_t reserved1                                             : 27;
 
       /**
        * [Bit 31] If 1, generated packets which contain IP payloads have LIP values, which include the CS base component.
        */
       uint32_t flag31                                                : 1;
-#define CPUID_ECX_FLAG31_BIT                                         31
-#define CPUID_ECX_FLAG31_FLAG                                        0x80000000
-#define CPUID_ECX_FLAG31_MASK                                        0x01
-#define CPUID_ECX_FLAG31(_)                                          (((_) >> 31) & 0x01)
+#define CPUID_EAX_14_ECX_00_ECX_FLAG31_BIT                           31
+#define CPUID_EAX_14_ECX_00_ECX_FLAG31_FLAG                          0x80000000
+#define CPUID_EAX_14_ECX_00_ECX_FLAG31_MASK                          0x01
+#define CPUID_EAX_14_ECX_00_ECX_FLAG31(_)                            (((_) >> 31) & 0x01)
+#define CPUID_EAX_14_ECX_00_ECX_FLAG31_FEATURE                       2399
     };
 
     uint32_t flags;
   } ecx;
+#define CPUID_EAX_14_ECX_00_ECX_RESERVED_BITS                        0x7FFFFFF0
 
   union
   {
@@ -5616,16 +6129,26 @@ typedef struct
        * [Bits 31:0] EDX is reserved.
        */
       uint32_t reserved                                              : 32;
-#define CPUID_EDX_RESERVED_BIT                                       0
-#define CPUID_EDX_RESERVED_FLAG                                      0xFFFFFFFF
-#define CPUID_EDX_RESERVED_MASK                                      0xFFFFFFFF
-#define CPUID_EDX_RESERVED(_)                                        (((_) >> 0) & 0xFFFFFFFF)
+#define CPUID_EAX_14_ECX_00_EDX_RESERVED_BIT                         0
+#define CPUID_EAX_14_ECX_00_EDX_RESERVED_FLAG                        0xFFFFFFFF
+#define CPUID_EAX_14_ECX_00_EDX_RESERVED_MASK                        0xFFFFFFFF
+#define CPUID_EAX_14_ECX_00_EDX_RESERVED(_)                          (((_) >> 0) & 0xFFFFFFFF)
     };
 
     uint32_t flags;
   } edx;
+#define CPUID_EAX_14_ECX_00_EDX_RESERVED_BITS                        0xFFFFFFFF
 
 } cpuid_eax_14_ecx_00;
+#define CPUID_EAX_14_ECX_00_SNAPSHOT_INDEX                           18
+#define CPUID_EAX_14_ECX_00_EAX_POLICY_AND                           0xFFFFFFFF
+#define CPUID_EAX_14_ECX_00_EAX_POLICY_OR                            0x00000000
+#define CPUID_EAX_14_ECX_00_EBX_POLICY_AND                           0x000001FF
+#define CPUID_EAX_14_ECX_00_EBX_POLICY_OR                            0x00000000
+#define CPUID_EAX_14_ECX_00_ECX_POLICY_AND                           0x8000000F
+#define CPUID_EAX_14_ECX_00_ECX_POLICY_OR                            0x00000000
+#define CPUID_EAX_14_ECX_00_EDX_POLICY_AND                           0x00000000
+#define CPUID_EAX_14_ECX_00_EDX_POLICY_OR                            0x00000000
 
 /**
  * @brief Intel Processor Trace Enumeration Sub-leaf (EAX = 14H, ECX = 1)
@@ -5640,24 +6163,25 @@ typedef struct
        * [Bits 2:0] Number of configurable Address Ranges for filtering.
        */
       uint32_t number_of_configurable_address_ranges_for_filtering   : 3;
-#define CPUID_EAX_NUMBER_OF_CONFIGURABLE_ADDRESS_RANGES_FOR_FILTERING_BIT 0
-#define CPUID_EAX_NUMBER_OF_CONFIGURABLE_ADDRESS_RANGES_FOR_FILTERING_FLAG 0x07
-#define CPUID_EAX_NUMBER_OF_CONFIGURABLE_ADDRESS_RANGES_FOR_FILTERING_MASK 0x07
-#define CPUID_EAX_NUMBER_OF_CONFIGURABLE_ADDRESS_RANGES_FOR_FILTERING(_) (((_) >> 0) & 0x07)
+#define CPUID_EAX_14_ECX_01_EAX_NUMBER_OF_CONFIGURABLE_ADDRESS_RANGES_FOR_FILTERING_BIT 0
+#define CPUID_EAX_14_ECX_01_EAX_NUMBER_OF_CONFIGURABLE_ADDRESS_RANGES_FOR_FILTERING_FLAG 0x07
+#define CPUID_EAX_14_ECX_01_EAX_NUMBER_OF_CONFIGURABLE_ADDRESS_RANGES_FOR_FILTERING_MASK 0x07
+#define CPUID_EAX_14_ECX_01_EAX_NUMBER_OF_CONFIGURABLE_ADDRESS_RANGES_FOR_FILTERING(_) (((_) >> 0) & 0x07)
       uint32_t reserved1                                             : 13;
 
       /**
        * [Bits 31:16] Bitmap of supported MTC period encodings.
        */
       uint32_t bitmap_of_supported_mtc_period_encodings              : 16;
-#define CPUID_EAX_BITMAP_OF_SUPPORTED_MTC_PERIOD_ENCODINGS_BIT       16
-#define CPUID_EAX_BITMAP_OF_SUPPORTED_MTC_PERIOD_ENCODINGS_FLAG      0xFFFF0000
-#define CPUID_EAX_BITMAP_OF_SUPPORTED_MTC_PERIOD_ENCODINGS_MASK      0xFFFF
-#define CPUID_EAX_BITMAP_OF_SUPPORTED_MTC_PERIOD_ENCODINGS(_)        (((_) >> 16) & 0xFFFF)
+#define CPUID_EAX_14_ECX_01_EAX_BITMAP_OF_SUPPORTED_MTC_PERIOD_ENCODINGS_BIT 16
+#define CPUID_EAX_14_ECX_01_EAX_BITMAP_OF_SUPPORTED_MTC_PERIOD_ENCODINGS_FLAG 0xFFFF0000
+#define CPUID_EAX_14_ECX_01_EAX_BITMAP_OF_SUPPORTED_MTC_PERIOD_ENCODINGS_MASK 0xFFFF
+#define CPUID_EAX_14_ECX_01_EAX_BITMAP_OF_SUPPORTED_MTC_PERIOD_ENCODINGS(_) (((_) >> 16) & 0xFFFF)
     };
 
     uint32_t flags;
   } eax;
+#define CPUID_EAX_14_ECX_01_EAX_RESERVED_BITS                        0xFFF8
 
   union
   {
@@ -5667,23 +6191,24 @@ typedef struct
        * [Bits 15:0] Bitmap of supported Cycle Threshold value encodings.
        */
       uint32_t bitmap_of_supported_cycle_threshold_value_encodings   : 16;
-#define CPUID_EBX_BITMAP_OF_SUPPORTED_CYCLE_THRESHOLD_VALUE_ENCODINGS_BIT 0
-#define CPUID_EBX_BITMAP_OF_SUPPORTED_CYCLE_THRESHOLD_VALUE_ENCODINGS_FLAG 0xFFFF
-#define CPUID_EBX_BITMAP_OF_SUPPORTED_CYCLE_THRESHOLD_VALUE_ENCODINGS_MASK 0xFFFF
-#define CPUID_EBX_BITMAP_OF_SUPPORTED_CYCLE_THRESHOLD_VALUE_ENCODINGS(_) (((_) >> 0) & 0xFFFF)
+#define CPUID_EAX_14_ECX_01_EBX_BITMAP_OF_SUPPORTED_CYCLE_THRESHOLD_VALUE_ENCODINGS_BIT 0
+#define CPUID_EAX_14_ECX_01_EBX_BITMAP_OF_SUPPORTED_CYCLE_THRESHOLD_VALUE_ENCODINGS_FLAG 0xFFFF
+#define CPUID_EAX_14_ECX_01_EBX_BITMAP_OF_SUPPORTED_CYCLE_THRESHOLD_VALUE_ENCODINGS_MASK 0xFFFF
+#define CPUID_EAX_14_ECX_01_EBX_BITMAP_OF_SUPPORTED_CYCLE_THRESHOLD_VALUE_ENCODINGS(_) (((_) >> 0) & 0xFFFF)
 
       /**
        * [Bits 31:16] Bitmap of supported Configurable PSB frequency encodings.
        */
       uint32_t bitmap_of_supported_configurable_psb_frequency_encodings: 16;
-#define CPUID_EBX_BITMAP_OF_SUPPORTED_CONFIGURABLE_PSB_FREQUENCY_ENCODINGS_BIT 16
-#define CPUID_EBX_BITMAP_OF_SUPPORTED_CONFIGURABLE_PSB_FREQUENCY_ENCODINGS_FLAG 0xFFFF0000
-#define CPUID_EBX_BITMAP_OF_SUPPORTED_CONFIGURABLE_PSB_FREQUENCY_ENCODINGS_MASK 0xFFFF
-#define CPUID_EBX_BITMAP_OF_SUPPORTED_CONFIGURABLE_PSB_FREQUENCY_ENCODINGS(_) (((_) >> 16) & 0xFFFF)
+#define CPUID_EAX_14_ECX_01_EBX_BITMAP_OF_SUPPORTED_CONFIGURABLE_PSB_FREQUENCY_ENCODINGS_BIT 16
+#define CPUID_EAX_14_ECX_01_EBX_BITMAP_OF_SUPPORTED_CONFIGURABLE_PSB_FREQUENCY_ENCODINGS_FLAG 0xFFFF0000
+#define CPUID_EAX_14_ECX_01_EBX_BITMAP_OF_SUPPORTED_CONFIGURABLE_PSB_FREQUENCY_ENCODINGS_MASK 0xFFFF
+#define CPUID_EAX_14_ECX_01_EBX_BITMAP_OF_SUPPORTED_CONFIGURABLE_PSB_FREQUENCY_ENCODINGS(_) (((_) >> 16) & 0xFFFF)
     };
 
     uint32_t flags;
   } ebx;
+#define CPUID_EAX_14_ECX_01_EBX_RESERVED_BITS                        0x00
 
   union
   {
@@ -5693,14 +6218,15 @@ typedef struct
        * [Bits 31:0] ECX is reserved.
        */
       uint32_t reserved                                              : 32;
-#define CPUID_ECX_RESERVED_BIT                                       0
-#define CPUID_ECX_RESERVED_FLAG                                      0xFFFFFFFF
-#define CPUID_ECX_RESERVED_MASK                                      0xFFFFFFFF
-#define CPUID_ECX_RESERVED(_)                                        (((_) >> 0) & 0xFFFFFFFF)
+#define CPUID_EAX_14_ECX_01_ECX_RESERVED_BIT                         0
+#define CPUID_EAX_14_ECX_01_ECX_RESERVED_FLAG                        0xFFFFFFFF
+#define CPUID_EAX_14_ECX_01_ECX_RESERVED_MASK                        0xFFFFFFFF
+#define CPUID_EAX_14_ECX_01_ECX_RESERVED(_)                          (((_) >> 0) & 0xFFFFFFFF)
     };
 
     uint32_t flags;
   } ecx;
+#define CPUID_EAX_14_ECX_01_ECX_RESERVED_BITS                        0xFFFFFFFF
 
   union
   {
@@ -5710,16 +6236,26 @@ typedef struct
        * [Bits 31:0] EDX is reserved.
        */
       uint32_t reserved                                              : 32;
-#define CPUID_EDX_RESERVED_BIT                                       0
-#define CPUID_EDX_RESERVED_FLAG                                      0xFFFFFFFF
-#define CPUID_EDX_RESERVED_MASK                                      0xFFFFFFFF
-#define CPUID_EDX_RESERVED(_)                                        (((_) >> 0) & 0xFFFFFFFF)
+#define CPUID_EAX_14_ECX_01_EDX_RESERVED_BIT                         0
+#define CPUID_EAX_14_ECX_01_EDX_RESERVED_FLAG                        0xFFFFFFFF
+#define CPUID_EAX_14_ECX_01_EDX_RESERVED_MASK                        0xFFFFFFFF
+#define CPUID_EAX_14_ECX_01_EDX_RESERVED(_)                          (((_) >> 0) & 0xFFFFFFFF)
     };
 
     uint32_t flags;
   } edx;
+#define CPUID_EAX_14_ECX_01_EDX_RESERVED_BITS                        0xFFFFFFFF
 
 } cpuid_eax_14_ecx_01;
+#define CPUID_EAX_14_ECX_01_SNAPSHOT_INDEX                           19
+#define CPUID_EAX_14_ECX_01_EAX_POLICY_AND                           0xFFFF0007
+#define CPUID_EAX_14_ECX_01_EAX_POLICY_OR                            0x00000000
+#define CPUID_EAX_14_ECX_01_EBX_POLICY_AND                           0xFFFFFFFF
+#define CPUID_EAX_14_ECX_01_EBX_POLICY_OR                            0x00000000
+#define CPUID_EAX_14_ECX_01_ECX_POLICY_AND                           0x00000000
+#define CPUID_EAX_14_ECX_01_ECX_POLICY_OR                            0x00000000
+#define CPUID_EAX_14_ECX_01_EDX_POLICY_AND                           0x00000000
+#define CPUID_EAX_14_ECX_01_EDX_POLICY_OR                            0x00000000
 
 /**
  * @}
@@ -5748,14 +6284,15 @@ typedef struct
        * [Bits 31:0] An unsigned integer which is the denominator of the TSC/"core crystal clock" ratio.
        */
       uint32_t denominator                                           : 32;
-#define CPUID_EAX_DENOMINATOR_BIT                                    0
-#define CPUID_EAX_DENOMINATOR_FLAG                                   0xFFFFFFFF
-#define CPUID_EAX_DENOMINATOR_MASK                                   0xFFFFFFFF
-#define CPUID_EAX_DENOMINATOR(_)                                     (((_) >> 0) & 0xFFFFFFFF)
+#define CPUID_EAX_15_EAX_DENOMINATOR_BIT                             0
+#define CPUID_EAX_15_EAX_DENOMINATOR_FLAG                            0xFFFFFFFF
+#define CPUID_EAX_15_EAX_DENOMINATOR_MASK                            0xFFFFFFFF
+#define CPUID_EAX_15_EAX_DENOMINATOR(_)                              (((_) >> 0) & 0xFFFFFFFF)
     };
 
     uint32_t flags;
   } eax;
+#define CPUID_EAX_15_EAX_RESERVED_BITS                               0x00
 
   union
   {
@@ -5765,14 +6302,15 @@ typedef struct
        * [Bits 31:0] An unsigned integer which is the numerator of the TSC/"core crystal clock" ratio.
        */
       uint32_t numerator                                             : 32;
-#define CPUID_EBX_NUMERATOR_BIT                                      0
-#define CPUID_EBX_NUMERATOR_FLAG                                     0xFFFFFFFF
-#define CPUID_EBX_NUMERATOR_MASK                                     0xFFFFFFFF
-#define CPUID_EBX_NUMERATOR(_)                                       (((_) >> 0) & 0xFFFFFFFF)
+#define CPUID_EAX_15_EBX_NUMERATOR_BIT                               0
+#define CPUID_EAX_15_EBX_NUMERATOR_FLAG                              0xFFFFFFFF
+#define CPUID_EAX_15_EBX_NUMERATOR_MASK                              0xFFFFFFFF
+#define CPUID_EAX_15_EBX_NUMERATOR(_)                                (((_) >> 0) & 0xFFFFFFFF)
     };
 
     uint32_t flags;
   } ebx;
+#define CPUID_EAX_15_EBX_RESERVED_BITS                               0x00
 
   union
   {
@@ -5782,14 +6320,15 @@ typedef struct
        * [Bits 31:0] An unsigned integer which is the nominal frequency of the core crystal clock in Hz.
        */
       uint32_t nominal_frequency                                     : 32;
-#define CPUID_ECX_NOMINAL_FREQUENCY_BIT                              0
-#define CPUID_ECX_NOMINAL_FREQUENCY_FLAG                             0xFFFFFFFF
-#define CPUID_ECX_NOMINAL_FREQUENCY_MASK                             0xFFFFFFFF
-#define CPUID_ECX_NOMINAL_FREQUENCY(_)                               (((_) >> 0) & 0xFFFFFFFF)
+#define CPUID_EAX_15_ECX_NOMINAL_FREQUENCY_BIT                       0
+#define CPUID_EAX_15_ECX_NOMINAL_FREQUENCY_FLAG                      0xFFFFFFFF
+#define CPUID_EAX_15_ECX_NOMINAL_FREQUENCY_MASK                      0xFFFFFFFF
+#define CPUID_EAX_15_ECX_NOMINAL_FREQUENCY(_)                        (((_) >> 0) & 0xFFFFFFFF)
     };
 
     uint32_t flags;
   } ecx;
+#define CPUID_EAX_15_ECX_RESERVED_BITS                               0x00
 
   union
   {
@@ -5799,16 +6338,26 @@ typedef struct
        * [Bits 31:0] EDX is reserved.
        */
       uint32_t reserved                                              : 32;
-#define CPUID_EDX_RESERVED_BIT                                       0
-#define CPUID_EDX_RESERVED_FLAG                                      0xFFFFFFFF
-#define CPUID_EDX_RESERVED_MASK                                      0xFFFFFFFF
-#define CPUID_EDX_RESERVED(_)                                        (((_) >> 0) & 0xFFFFFFFF)
+#define CPUID_EAX_15_EDX_RESERVED_BIT                                0
+#define CPUID_EAX_15_EDX_RESERVED_FLAG                               0xFFFFFFFF
+#define CPUID_EAX_15_EDX_RESERVED_MASK                               0xFFFFFFFF
+#define CPUID_EAX_15_EDX_RESERVED(_)                                 (((_) >> 0) & 0xFFFFFFFF)
     };
 
     uint32_t flags;
   } edx;
+#define CPUID_EAX_15_EDX_RESERVED_BITS                               0xFFFFFFFF
 
 } cpuid_eax_15;
+#define CPUID_EAX_15_SNAPSHOT_INDEX                                  20
+#define CPUID_EAX_15_EAX_POLICY_AND                                  0xFFFFFFFF
+#define CPUID_EAX_15_EAX_POLICY_OR                                   0x00000000
+#define CPUID_EAX_15_EBX_POLICY_AND                                  0xFFFFFFFF
+#define CPUID_EAX_15_EBX_POLICY_OR                                   0x00000000
+#define CPUID_EAX_15_ECX_POLICY_AND                                  0xFFFFFFFF
+#define CPUID_EAX_15_ECX_POLICY_OR                                   0x00000000
+#define CPUID_EAX_15_EDX_POLICY_AND                                  0x00000000
+#define CPUID_EAX_15_EDX_POLICY_OR                                   0x00000000
 
 
 /**
@@ -5835,15 +6384,16 @@ typedef struct
        * [Bits 15:0] Processor Base Frequency (in MHz).
        */
       uint32_t procesor_base_frequency_mhz                           : 16;
-#define CPUID_EAX_PROCESOR_BASE_FREQUENCY_MHZ_BIT                    0
-#define CPUID_EAX_PROCESOR_BASE_FREQUENCY_MHZ_FLAG                   0xFFFF
-#define CPUID_EAX_PROCESOR_BASE_FREQUENCY_MHZ_MASK                   0xFFFF
-#define CPUID_EAX_PROCESOR_BASE_FREQUENCY_MHZ(_)                     (((_) >> 0) & 0xFFFF)
+#define CPUID_EAX_16_EAX_PROCESOR_BASE_FREQUENCY_MHZ_BIT             0
+#define CPUID_EAX_16_EAX_PROCESOR_BASE_FREQUENCY_MHZ_FLAG            0xFFFF
+#define CPUID_EAX_16_EAX_PROCESOR_BASE_FREQUENCY_MHZ_MASK            0xFFFF
+#define CPUID_EAX_16_EAX_PROCESOR_BASE_FREQUENCY_MHZ(_)              (((_) >> 0) & 0xFFFF)
       uint32_t reserved1                                             : 16;
     };
 
     uint32_t flags;
   } eax;
+#define CPUID_EAX_16_EAX_RESERVED_BITS                               0xFFFF0000
 
   union
   {
@@ -5853,15 +6403,16 @@ typedef struct
        * [Bits 15:0] Maximum Frequency (in MHz).
        */
       uint32_t processor_maximum_frequency_mhz                       : 16;
-#define CPUID_EBX_PROCESSOR_MAXIMUM_FREQUENCY_MHZ_BIT                0
-#define CPUID_EBX_PROCESSOR_MAXIMUM_FREQUENCY_MHZ_FLAG               0xFFFF
-#define CPUID_EBX_PROCESSOR_MAXIMUM_FREQUENCY_MHZ_MASK               0xFFFF
-#define CPUID_EBX_PROCESSOR_MAXIMUM_FREQUENCY_MHZ(_)                 (((_) >> 0) & 0xFFFF)
+#define CPUID_EAX_16_EBX_PROCESSOR_MAXIMUM_FREQUENCY_MHZ_BIT         0
+#define CPUID_EAX_16_EBX_PROCESSOR_MAXIMUM_FREQUENCY_MHZ_FLAG        0xFFFF
+#define CPUID_EAX_16_EBX_PROCESSOR_MAXIMUM_FREQUENCY_MHZ_MASK        0xFFFF
+#define CPUID_EAX_16_EBX_PROCESSOR_MAXIMUM_FREQUENCY_MHZ(_)          (((_) >> 0) & 0xFFFF)
       uint32_t reserved1                                             : 16;
     };
 
     uint32_t flags;
   } ebx;
+#define CPUID_EAX_16_EBX_RESERVED_BITS                               0xFFFF0000
 
   union
   {
@@ -5871,15 +6422,16 @@ typedef struct
        * [Bits 15:0] Bus (Reference) Frequency (in MHz).
        */
       uint32_t bus_frequency_mhz                                     : 16;
-#define CPUID_ECX_BUS_FREQUENCY_MHZ_BIT                              0
-#define CPUID_ECX_BUS_FREQUENCY_MHZ_FLAG                             0xFFFF
-#define CPUID_ECX_BUS_FREQUENCY_MHZ_MASK                             0xFFFF
-#define CPUID_ECX_BUS_FREQUENCY_MHZ(_)                               (((_) >> 0) & 0xFFFF)
+#define CPUID_EAX_16_ECX_BUS_FREQUENCY_MHZ_BIT                       0
+#define CPUID_EAX_16_ECX_BUS_FREQUENCY_MHZ_FLAG                      0xFFFF
+#define CPUID_EAX_16_ECX_BUS_FREQUENCY_MHZ_MASK                      0xFFFF
+#define CPUID_EAX_16_ECX_BUS_FREQUENCY_MHZ(_)                        (((_) >> 0) & 0xFFFF)
       uint32_t reserved1                                             : 16;
     };
 
     uint32_t flags;
   } ecx;
+#define CPUID_EAX_16_ECX_RESERVED_BITS                               0xFFFF0000
 
   union
   {
@@ -5889,16 +6441,26 @@ typedef struct
        * [Bits 31:0] EDX is reserved.
        */
       uint32_t reserved                                              : 32;
-#define CPUID_EDX_RESERVED_BIT                                       0
-#define CPUID_EDX_RESERVED_FLAG                                      0xFFFFFFFF
-#define CPUID_EDX_RESERVED_MASK                                      0xFFFFFFFF
-#define CPUID_EDX_RESERVED(_)                                        (((_) >> 0) & 0xFFFFFFFF)
+#define CPUID_EAX_16_EDX_RESERVED_BIT                                0
+#define CPUID_EAX_16_EDX_RESERVED_FLAG                               0xFFFFFFFF
+#define CPUID_EAX_16_EDX_RESERVED_MASK                               0xFFFFFFFF
+#define CPUID_EAX_16_EDX_RESERVED(_)                                 (((_) >> 0) & 0xFFFFFFFF)
     };
 
     uint32_t flags;
   } edx;
+#define CPUID_EAX_16_EDX_RESERVED_BITS                               0xFFFFFFFF
 
 } cpuid_eax_16;
+#define CPUID_EAX_16_SNAPSHOT_INDEX                                  21
+#define CPUID_EAX_16_EAX_POLICY_AND                                  0x0000FFFF
+#define CPUID_EAX_16_EAX_POLICY_OR                                   0x00000000
+#define CPUID_EAX_16_EBX_POLICY_AND                                  0x0000FFFF
+#define CPUID_EAX_16_EBX_POLICY_OR                                   0x00000000
+#define CPUID_EAX_16_ECX_POLICY_AND                                  0x0000FFFF
+#define CPUID_EAX_16_ECX_POLICY_OR                                   0x00000000
+#define CPUID_EAX_16_EDX_POLICY_AND                                  0x00000000
+#define CPUID_EAX_16_EDX_POLICY_OR                                   0x00000000
 
 /**
  * @defgroup cpuid_eax_17 \
@@ -5925,14 +6487,15 @@ typedef struct
        * [Bits 31:0] Reports the maximum input value of supported sub-leaf in leaf 17H.
        */
       uint32_t max_soc_id_index                                      : 32;
-#define CPUID_EAX_MAX_SOC_ID_INDEX_BIT                               0
-#define CPUID_EAX_MAX_SOC_ID_INDEX_FLAG                              0xFFFFFFFF
-#define CPUID_EAX_MAX_SOC_ID_INDEX_MASK                              0xFFFFFFFF
-#define CPUID_EAX_MAX_SOC_ID_INDEX(_)                                (((_) >> 0) & 0xFFFFFFFF)
+#define CPUID_EAX_17_ECX_00_EAX_MAX_SOC_ID_INDEX_BIT                 0
+#define CPUID_EAX_17_ECX_00_EAX_MAX_SOC_ID_INDEX_FLAG                0xFFFFFFFF
+#define CPUID_EAX_17_ECX_00_EAX_MAX_SOC_ID_INDEX_MASK                0xFFFFFFFF
+#define CPUID_EAX_17_ECX_00_EAX_MAX_SOC_ID_INDEX(_)                  (((_) >> 0) & 0xFFFFFFFF)
     };
 
     uint32_t flags;
   } eax;
+#define CPUID_EAX_17_ECX_00_EAX_RESERVED_BITS                        0x00
 
   union
   {
@@ -5942,25 +6505,27 @@ typedef struct
        * [Bits 15:0] SOC Vendor ID.
        */
       uint32_t soc_vendor_id                                         : 16;
-#define CPUID_EBX_SOC_VENDOR_ID_BIT                                  0
-#define CPUID_EBX_SOC_VENDOR_ID_FLAG                                 0xFFFF
-#define CPUID_EBX_SOC_VENDOR_ID_MASK                                 0xFFFF
-#define CPUID_EBX_SOC_VENDOR_ID(_)                                   (((_) >> 0) & 0xFFFF)
+#define CPUID_EAX_17_ECX_00_EBX_SOC_VENDOR_ID_BIT                    0
+#define CPUID_EAX_17_ECX_00_EBX_SOC_VENDOR_ID_FLAG                   0xFFFF
+#define CPUID_EAX_17_ECX_00_EBX_SOC_VENDOR_ID_MASK                   0xFFFF
+#define CPUID_EAX_17_ECX_00_EBX_SOC_VENDOR_ID(_)                     (((_) >> 0) & 0xFFFF)
 
       /**
        * [Bit 16] If 1, the SOC Vendor ID field is assigned via an industry standard enumeration scheme. Otherwise, the SOC
        * Vendor ID field is assigned by Intel.
        */
       uint32_t is_vendor_scheme                                      : 1;
-#define CPUID_EBX_IS_VENDOR_SCHEME_BIT                               16
-#define CPUID_EBX_IS_VENDOR_SCHEME_FLAG                              0x10000
-#define CPUID_EBX_IS_VENDOR_SCHEME_MASK                              0x01
-#define CPUID_EBX_IS_VENDOR_SCHEME(_)                                (((_) >> 16) & 0x01)
+#define CPUID_EAX_17_ECX_00_EBX_IS_VENDOR_SCHEME_BIT                 16
+#define CPUID_EAX_17_ECX_00_EBX_IS_VENDOR_SCHEME_FLAG                0x10000
+#define CPUID_EAX_17_ECX_00_EBX_IS_VENDOR_SCHEME_MASK                0x01
+#define CPUID_EAX_17_ECX_00_EBX_IS_VENDOR_SCHEME(_)                  (((_) >> 16) & 0x01)
+#define CPUID_EAX_17_ECX_00_EBX_IS_VENDOR_SCHEME_FEATURE             2864
       uint32_t reserved1                                             : 15;
     };
 
     uint32_t flags;
   } ebx;
+#define CPUID_EAX_17_ECX_00_EBX_RESERVED_BITS                        0xFFFE0000
 
   union
   {
@@ -5970,14 +6535,15 @@ typedef struct
        * [Bits 31:0] A unique number an SOC vendor assigns to its SOC projects.
        */
       uint32_t project_id                                            : 32;
-#define CPUID_ECX_PROJECT_ID_BIT                                     0
-#define CPUID_ECX_PROJECT_ID_FLAG                                    0xFFFFFFFF
-#define CPUID_ECX_PROJECT_ID_MASK                                    0xFFFFFFFF
-#define CPUID_ECX_PROJECT_ID(_)                                      (((_) >> 0) & 0xFFFFFFFF)
+#define CPUID_EAX_17_ECX_00_ECX_PROJECT_ID_BIT                       0
+#define CPUID_EAX_17_ECX_00_ECX_PROJECT_ID_FLAG                      0xFFFFFFFF
+#define CPUID_EAX_17_ECX_00_ECX_PROJECT_ID_MASK                      0xFFFFFFFF
+#define CPUID_EAX_17_ECX_00_ECX_PROJECT_ID(_)                        (((_) >> 0) & 0xFFFFFFFF)
     };
 
     uint32_t flags;
   } ecx;
+#define CPUID_EAX_17_ECX_00_ECX_RESERVED_BITS                        0x00
 
   union
   {
@@ -5987,16 +6553,26 @@ typedef struct
        * [Bits 31:0] A unique number within an SOC project that an SOC vendor assigns.
        */
       uint32_t stepping_id                                           : 32;
-#define CPUID_EDX_STEPPING_ID_BIT                                    0
-#define CPUID_EDX_STEPPING_ID_FLAG                                   0xFFFFFFFF
-#define CPUID_EDX_STEPPING_ID_MASK                                   0xFFFFFFFF
-#define CPUID_EDX_STEPPING_ID(_)                                     (((_) >> 0) & 0xFFFFFFFF)
+#define CPUID_EAX_17_ECX_00_EDX_STEPPING_ID_BIT                      0
+#define CPUID_EAX_17_ECX_00_EDX_STEPPING_ID_FLAG                     0xFFFFFFFF
+#define CPUID_EAX_17_ECX_00_EDX_STEPPING_ID_MASK                     0xFFFFFFFF
+#define CPUID_EAX_17_ECX_00_EDX_STEPPING_ID(_)                       (((_) >> 0) & 0xFFFFFFFF)
     };
 
     uint32_t flags;
   } edx;
+#define CPUID_EAX_17_ECX_00_EDX_RESERVED_BITS                        0x00
 
 } cpuid_eax_17_ecx_00;
+#define CPUID_EAX_17_ECX_00_SNAPSHOT_INDEX                           22
+#define CPUID_EAX_17_ECX_00_EAX_POLICY_AND                           0xFFFFFFFF
+#define CPUID_EAX_17_ECX_00_EAX_POLICY_OR                            0x00000000
+#define CPUID_EAX_17_ECX_00_EBX_POLICY_AND                           0x0001FFFF
+#define CPUID_EAX_17_ECX_00_EBX_POLICY_OR                            0x00000000
+#define CPUID_EAX_17_ECX_00_ECX_POLICY_AND                           0xFFFFFFFF
+#define CPUID_EAX_17_ECX_00_ECX_POLICY_OR                            0x00000000
+#define CPUID_EAX_17_ECX_00_EDX_POLICY_AND                           0xFFFFFFFF
+#define CPUID_EAX_17_ECX_00_EDX_POLICY_OR                            0x00000000
 
 /**
  * @brief System-On-Chip Vendor Attribute Enumeration Sub-leaf (EAX = 17H, ECX = 1..3)
@@ -6015,14 +6591,15 @@ typedef struct
        * [Bits 31:0] SOC Vendor Brand String. UTF-8 encoded string.
        */
       uint32_t soc_vendor_brand_string                               : 32;
-#define CPUID_EAX_SOC_VENDOR_BRAND_STRING_BIT                        0
-#define CPUID_EAX_SOC_VENDOR_BRAND_STRING_FLAG                       0xFFFFFFFF
-#define CPUID_EAX_SOC_VENDOR_BRAND_STRING_MASK                       0xFFFFFFFF
-#define CPUID_EAX_SOC_VENDOR_BRAND_STRING(_)                         (((_) >> 0) & 0xFFFFFFFF)
+#define CPUID_EAX_17_ECX_01_03_EAX_SOC_VENDOR_BRAND_STRING_BIT       0
+#define CPUID_EAX_17_ECX_01_03_EAX_SOC_VENDOR_BRAND_STRING_FLAG      0xFFFFFFFF
+#define CPUID_EAX_17_ECX_01_03_EAX_SOC_VENDOR_BRAND_STRING_MASK      0xFFFFFFFF
+#define CPUID_EAX_17_ECX_01_03_EAX_SOC_VENDOR_BRAND_STRING(_)        (((_) >> 0) & 0xFFFFFFFF)
     };
 
     uint32_t flags;
   } eax;
+#define CPUID_EAX_17_ECX_01_03_EAX_RESERVED_BITS                     0x00
 
   union
   {
@@ -6032,14 +6609,15 @@ typedef struct
        * [Bits 31:0] SOC Vendor Brand String. UTF-8 encoded string.
        */
       uint32_t soc_vendor_brand_string                               : 32;
-#define CPUID_EBX_SOC_VENDOR_BRAND_STRING_BIT                        0
-#define CPUID_EBX_SOC_VENDOR_BRAND_STRING_FLAG                       0xFFFFFFFF
-#define CPUID_EBX_SOC_VENDOR_BRAND_STRING_MASK                       0xFFFFFFFF
-#define CPUID_EBX_SOC_VENDOR_BRAND_STRING(_)                         (((_) >> 0) & 0xFFFFFFFF)
+#define CPUID_EAX_17_ECX_01_03_EBX_SOC_VENDOR_BRAND_STRING_BIT       0
+#define CPUID_EAX_17_ECX_01_03_EBX_SOC_VENDOR_BRAND_STRING_FLAG      0xFFFFFFFF
+#define CPUID_EAX_17_ECX_01_03_EBX_SOC_VENDOR_BRAND_STRING_MASK      0xFFFFFFFF
+#define CPUID_EAX_17_ECX_01_03_EBX_SOC_VENDOR_BRAND_STRING(_)        (((_) >> 0) & 0xFFFFFFFF)
     };
 
     uint32_t flags;
   } ebx;
+#define CPUID_EAX_17_ECX_01_03_EBX_RESERVED_BITS                     0x00
 
   union
   {
@@ -6049,14 +6627,15 @@ typedef struct
        * [Bits 31:0] SOC Vendor Brand String. UTF-8 encoded string.
        */
       uint32_t soc_vendor_brand_string                               : 32;
-#define CPUID_ECX_SOC_VENDOR_BRAND_STRING_BIT                        0
-#define CPUID_ECX_SOC_VENDOR_BRAND_STRING_FLAG                       0xFFFFFFFF
-#define CPUID_ECX_SOC_VENDOR_BRAND_STRING_MASK                       0xFFFFFFFF
-#define CPUID_ECX_SOC_VENDOR_BRAND_STRING(_)                         (((_) >> 0) & 0xFFFFFFFF)
+#define CPUID_EAX_17_ECX_01_03_ECX_SOC_VENDOR_BRAND_STRING_BIT       0
+#define CPUID_EAX_17_ECX_01_03_ECX_SOC_VENDOR_BRAND_STRING_FLAG      0xFFFFFFFF
+#define CPUID_EAX_17_ECX_01_03_ECX_SOC_VENDOR_BRAND_STRING_MASK      0xFFFFFFFF
+#define CPUID_EAX_17_ECX_01_03_ECX_SOC_VENDOR_BRAND_STRING(_)        (((_) >> 0) & 0xFFFFFFFF)
     };
 
     uint32_t flags;
   } ecx;
+#define CPUID_EAX_17_ECX_01_03_ECX_RESERVED_BITS                     0x00
 
   union
   {
@@ -6066,14 +6645,15 @@ typedef struct
        * [Bits 31:0] SOC Vendor Brand String. UTF-8 encoded string.
        */
       uint32_t soc_vendor_brand_string                               : 32;
-#define CPUID_EDX_SOC_VENDOR_BRAND_STRING_BIT                        0
-#define CPUID_EDX_SOC_VENDOR_BRAND_STRING_FLAG                       0xFFFFFFFF
-#define CPUID_EDX_SOC_VENDOR_BRAND_STRING_MASK                       0xFFFFFFFF
-#define CPUID_EDX_SOC_VENDOR_BRAND_STRING(_)                         (((_) >> 0) & 0xFFFFFFFF)
+#define CPUID_EAX_17_ECX_01_03_EDX_SOC_VENDOR_BRAND_STRING_BIT       0
+#define CPUID_EAX_17_ECX_01_03_EDX_SOC_VENDOR_BRAND_STRING_FLAG      0xFFFFFFFF
+#define CPUID_EAX_17_ECX_01_03_EDX_SOC_VENDOR_BRAND_STRING_MASK      0xFFFFFFFF
+#define CPUID_EAX_17_ECX_01_03_EDX_SOC_VENDOR_BRAND_STRING(_)        (((_) >> 0) & 0xFFFFFFFF)
     };
 
     uint32_t flags;
   } edx;
+#define CPUID_EAX_17_ECX_01_03_EDX_RESERVED_BITS                     0x00
 
 } cpuid_eax_17_ecx_01_03;
 
@@ -6092,14 +6672,15 @@ typedef struct
        * [Bits 31:0] Reserved = 0.
        */
       uint32_t reserved                                              : 32;
-#define CPUID_EAX_RESERVED_BIT                                       0
-#define CPUID_EAX_RESERVED_FLAG                                      0xFFFFFFFF
-#define CPUID_EAX_RESERVED_MASK                                      0xFFFFFFFF
-#define CPUID_EAX_RESERVED(_)                                        (((_) >> 0) & 0xFFFFFFFF)
+#define CPUID_EAX_17_ECX_N_EAX_RESERVED_BIT                          0
+#define CPUID_EAX_17_ECX_N_EAX_RESERVED_FLAG                         0xFFFFFFFF
+#define CPUID_EAX_17_ECX_N_EAX_RESERVED_MASK                         0xFFFFFFFF
+#define CPUID_EAX_17_ECX_N_EAX_RESERVED(_)                           (((_) >> 0) & 0xFFFFFFFF)
     };
 
     uint32_t flags;
   } eax;
+#define CPUID_EAX_17_ECX_N_EAX_RESERVED_BITS                         0xFFFFFFFF
 
   union
   {
@@ -6109,14 +6690,15 @@ typedef struct
        * [Bits 31:0] Reserved = 0.
        */
       uint32_t reserved                                              : 32;
-#define CPUID_EBX_RESERVED_BIT                                       0
-#define CPUID_EBX_RESERVED_FLAG                                      0xFFFFFFFF
-#define CPUID_EBX_RESERVED_MASK                                      0xFFFFFFFF
-#define CPUID_EBX_RESERVED(_)                                        (((_) >> 0) & 0xFFFFFFFF)
+#define CPUID_EAX_17_ECX_N_EBX_RESERVED_BIT                          0
+#define CPUID_EAX_17_ECX_N_EBX_RESERVED_FLAG                         0xFFFFFFFF
+#define CPUID_EAX_17_ECX_N_EBX_RESERVED_MASK                         0xFFFFFFFF
+#define CPUID_EAX_17_ECX_N_EBX_RESERVED(_)                           (((_) >> 0) & 0xFFFFFFFF)
     };
 
     uint32_t flags;
   } ebx;
+#define CPUID_EAX_17_ECX_N_EBX_RESERVED_BITS                         0xFFFFFFFF
 
   union
   {
@@ -6126,14 +6708,15 @@ typedef struct
        * [Bits 31:0] Reserved = 0.
        */
       uint32_t reserved                                              : 32;
-#define CPUID_ECX_RESERVED_BIT                                       0
-#define CPUID_ECX_RESERVED_FLAG                                      0xFFFFFFFF
-#define CPUID_ECX_RESERVED_MASK                                      0xFFFFFFFF
-#define CPUID_ECX_RESERVED(_)                                        (((_) >> 0) & 0xFFFFFFFF)
+#define CPUID_EAX_17_ECX_N_ECX_RESERVED_BIT                          0
+#define CPUID_EAX_17_ECX_N_ECX_RESERVED_FLAG                         0xFFFFFFFF
+#define CPUID_EAX_17_ECX_N_ECX_RESERVED_MASK                         0xFFFFFFFF
+#define CPUID_EAX_17_ECX_N_ECX_RESERVED(_)                           (((_) >> 0) & 0xFFFFFFFF)
     };
 
     uint32_t flags;
   } ecx;
+#define CPUID_EAX_17_ECX_N_ECX_RESERVED_BITS                         0xFFFFFFFF
 
   union
   {
@@ -6143,14 +6726,15 @@ typedef struct
        * [Bits 31:0] Reserved = 0.
        */
       uint32_t reserved                                              : 32;
-#define CPUID_EDX_RESERVED_BIT                                       0
-#define CPUID_EDX_RESERVED_FLAG                                      0xFFFFFFFF
-#define CPUID_EDX_RESERVED_MASK                                      0xFFFFFFFF
-#define CPUID_EDX_RESERVED(_)                                        (((_) >> 0) & 0xFFFFFFFF)
+#define CPUID_EAX_17_ECX_N_EDX_RESERVED_BIT                          0
+#define CPUID_EAX_17_ECX_N_EDX_RESERVED_FLAG                         0xFFFFFFFF
+#define CPUID_EAX_17_ECX_N_EDX_RESERVED_MASK                         0xFFFFFFFF
+#define CPUID_EAX_17_ECX_N_EDX_RESERVED(_)                           (((_) >> 0) & 0xFFFFFFFF)
     };
 
     uint32_t flags;
   } edx;
+#define CPUID_EAX_17_ECX_N_EDX_RESERVED_BITS                         0xFFFFFFFF
 
 } cpuid_eax_17_ecx_n;
 
@@ -6186,14 +6770,15 @@ typedef struct
        * [Bits 31:0] Reports the maximum input value of supported sub-leaf in leaf 18H.
        */
       uint32_t max_sub_leaf                                          : 32;
-#define CPUID_EAX_MAX_SUB_LEAF_BIT                                   0
-#define CPUID_EAX_MAX_SUB_LEAF_FLAG                                  0xFFFFFFFF
-#define CPUID_EAX_MAX_SUB_LEAF_MASK                                  0xFFFFFFFF
-#define CPUID_EAX_MAX_SUB_LEAF(_)                                    (((_) >> 0) & 0xFFFFFFFF)
+#define CPUID_EAX_18_ECX_00_EAX_MAX_SUB_LEAF_BIT                     0
+#define CPUID_EAX_18_ECX_00_EAX_MAX_SUB_LEAF_FLAG                    0xFFFFFFFF
+#define CPUID_EAX_18_ECX_00_EAX_MAX_SUB_LEAF_MASK                    0xFFFFFFFF
+#define CPUID_EAX_18_ECX_00_EAX_MAX_SUB_LEAF(_)                      (((_) >> 0) & 0xFFFFFFFF)
     };
 
     uint32_t flags;
   } eax;
+#define CPUID_EAX_18_ECX_00_EAX_RESERVED_BITS                        0x00
 
   union
   {
@@ -6203,61 +6788,66 @@ typedef struct
        * [Bit 0] 4K page size entries supported by this structure.
        */
       uint32_t page_entries_4kb_supported                            : 1;
-#define CPUID_EBX_PAGE_ENTRIES_4KB_SUPPORTED_BIT                     0
-#define CPUID_EBX_PAGE_ENTRIES_4KB_SUPPORTED_FLAG                    0x01
-#define CPUID_EBX_PAGE_ENTRIES_4KB_SUPPORTED_MASK                    0x01
-#define CPUID_EBX_PAGE_ENTRIES_4KB_SUPPORTED(_)                      (((_) >> 0) & 0x01)
+#define CPUID_EAX_18_ECX_00_EBX_PAGE_ENTRIES_4KB_SUPPORTED_BIT       0
+#define CPUID_EAX_18_ECX_00_EBX_PAGE_ENTRIES_4KB_SUPPORTED_FLAG      0x01
+#define CPUID_EAX_18_ECX_00_EBX_PAGE_ENTRIES_4KB_SUPPORTED_MASK      0x01
+#define CPUID_EAX_18_ECX_00_EBX_PAGE_ENTRIES_4KB_SUPPORTED(_)        (((_) >> 0) & 0x01)
+#define CPUID_EAX_18_ECX_00_EBX_PAGE_ENTRIES_4KB_SUPPORTED_FEATURE   2976
 
       /**
        * [Bit 1] 2MB page size entries supported by this structure.
        */
       uint32_t page_entries_2mb_supported                            : 1;
-#define CPUID_EBX_PAGE_ENTRIES_2MB_SUPPORTED_BIT                     1
-#define CPUID_EBX_PAGE_ENTRIES_2MB_SUPPORTED_FLAG                    0x02
-#define CPUID_EBX_PAGE_ENTRIES_2MB_SUPPORTED_MASK                    0x01
-#define CPUID_EBX_PAGE_ENTRIES_2MB_SUPPORTED(_)                      (((_) >> 1) & 0x01)
+#define CPUID_EAX_18_ECX_00_EBX_PAGE_ENTRIES_2MB_SUPPORTED_BIT       1
+#define CPUID_EAX_18_ECX_00_EBX_PAGE_ENTRIES_2MB_SUPPORTED_FLAG      0x02
+#define CPUID_EAX_18_ECX_00_EBX_PAGE_ENTRIES_2MB_SUPPORTED_MASK      0x01
+#define CPUID_EAX_18_ECX_00_EBX_PAGE_ENTRIES_2MB_SUPPORTED(_)        (((_) >> 1) & 0x01)
+#define CPUID_EAX_18_ECX_00_EBX_PAGE_ENTRIES_2MB_SUPPORTED_FEATURE   2977
 
       /**
        * [Bit 2] 4MB page size entries supported by this structure.
        */
       uint32_t page_entries_4mb_supported                            : 1;
-#define CPUID_EBX_PAGE_ENTRIES_4MB_SUPPORTED_BIT                     2
-#define CPUID_EBX_PAGE_ENTRIES_4MB_SUPPORTED_FLAG                    0x04
-#define CPUID_EBX_PAGE_ENTRIES_4MB_SUPPORTED_MASK                    0x01
-#define CPUID_EBX_PAGE_ENTRIES_4MB_SUPPORTED(_)                      (((_) >> 2) & 0x01)
+#define CPUID_EAX_18_ECX_00_EBX_PAGE_ENTRIES_4MB_SUPPORTED_BIT       2
+#define CPUID_EAX_18_ECX_00_EBX_PAGE_ENTRIES_4MB_SUPPORTED_FLAG      0x04
+#define CPUID_EAX_18_ECX_00_EBX_PAGE_ENTRIES_4MB_SUPPORTED_MASK      0x01
+#define CPUID_EAX_18_ECX_00_EBX_PAGE_ENTRIES_4MB_SUPPORTED(_)        (((_) >> 2) & 0x01)
+#define CPUID_EAX_18_ECX_00_EBX_PAGE_ENTRIES_4MB_SUPPORTED_FEATURE   2978
 
       /**
        * [Bit 3] 1 GB page size entries supported by this structure.
        */
       uint32_t page_entries_1gb_supported                            : 1;
-#define CPUID_EBX_PAGE_ENTRIES_1GB_SUPPORTED_BIT                     3
-#define CPUID_EBX_PAGE_ENTRIES_1GB_SUPPORTED_FLAG                    0x08
-#define CPUID_EBX_PAGE_ENTRIES_1GB_SUPPORTED_MASK                    0x01
-#define CPUID_EBX_PAGE_ENTRIES_1GB_SUPPORTED(_)                      (((_) >> 3) & 0x01)
+#define CPUID_EAX_18_ECX_00_EBX_PAGE_ENTRIES_1GB_SUPPORTED_BIT       3
+#define CPUID_EAX_18_ECX_00_EBX_PAGE_ENTRIES_1GB_SUPPORTED_FLAG      0x08
+#define CPUID_EAX_18_ECX_00_EBX_PAGE_ENTRIES_1GB_SUPPORTED_MASK      0x01
+#define CPUID_EAX_18_ECX_00_EBX_PAGE_ENTRIES_1GB_SUPPORTED(_)        (((_) >> 3) & 0x01)
+#define CPUID_EAX_18_ECX_00_EBX_PAGE_ENTRIES_1GB_SUPPORTED_FEATURE   2979
       uint32_t reserved1                                             : 4;
 
       /**
        * [Bits 10:8] Partitioning (0: Soft partitioning between the logical processors sharing this structure).
        */
       uint32_t partitioning                                          : 3;
-#define CPUID_EBX_PARTITIONING_BIT                                   8
-#define CPUID_EBX_PARTITIONING_FLAG                                  0x700
-#define CPUID_EBX_PARTITIONING_MASK                                  0x07
-#define CPUID_EBX_PARTITIONING(_)                                    (((_) >> 8) & 0x07)
+#define CPUID_EAX_18_ECX_00_EBX_PARTITIONING_BIT                     8
+#define CPUID_EAX_18_ECX_00_EBX_PARTITIONING_FLAG                    0x700
+#define CPUID_EAX_18_ECX_00_EBX_PARTITIONING_MASK                    0x07
+#define CPUID_EAX_18_ECX_00_EBX_PARTITIONING(_)                      (((_) >> 8) & 0x07)
       uint32_t reserved2                                             : 5;
 
       /**
        * [Bits 31:16] W = Ways of associativity.
        */
       uint32_t ways_of_associativity_00                              : 16;
-#define CPUID_EBX_WAYS_OF_ASSOCIATIVITY_00_BIT                       16
-#define CPUID_EBX_WAYS_OF_ASSOCIATIVITY_00_FLAG                      0xFFFF0000
-#define CPUID_EBX_WAYS_OF_ASSOCIATIVITY_00_MASK                      0xFFFF
-#define CPUID_EBX_WAYS_OF_ASSOCIATIVITY_00(_)                        (((_) >> 16) & 0xFFFF)
+#define CPUID_EAX_18_ECX_00_EBX_WAYS_OF_ASSOCIATIVITY_00_BIT         16
+#define CPUID_EAX_18_ECX_00_EBX_WAYS_OF_ASSOCIATIVITY_00_FLAG        0xFFFF0000
+#define CPUID_EAX_18_ECX_00_EBX_WAYS_OF_ASSOCIATIVITY_00_MASK        0xFFFF
+#define CPUID_EAX_18_ECX_00_EBX_WAYS_OF_ASSOCIATIVITY_00(_)          (((_) >> 16) & 0xFFFF)
     };
 
     uint32_t flags;
   } ebx;
+#define CPUID_EAX_18_ECX_00_EBX_RESERVED_BITS                        0xF8F0
 
   union
   {
@@ -6267,14 +6857,15 @@ typedef struct
        * [Bits 31:0] Number of Sets.
        */
       uint32_t number_of_sets                                        : 32;
-#define CPUID_ECX_NUMBER_OF_SETS_BIT                                 0
-#define CPUID_ECX_NUMBER_OF_SETS_FLAG                                0xFFFFFFFF
-#define CPUID_ECX_NUMBER_OF_SETS_MASK                                0xFFFFFFFF
-#define CPUID_ECX_NUMBER_OF_SETS(_)                                  (((_) >> 0) & 0xFFFFFFFF)
+#define CPUID_EAX_18_ECX_00_ECX_NUMBER_OF_SETS_BIT                   0
+#define CPUID_EAX_18_ECX_00_ECX_NUMBER_OF_SETS_FLAG                  0xFFFFFFFF
+#define CPUID_EAX_18_ECX_00_ECX_NUMBER_OF_SETS_MASK                  0xFFFFFFFF
+#define CPUID_EAX_18_ECX_00_ECX_NUMBER_OF_SETS(_)                    (((_) >> 0) & 0xFFFFFFFF)
     };
 
     uint32_t flags;
   } ecx;
+#define CPUID_EAX_18_ECX_00_ECX_RESERVED_BITS                        0x00
 
   union
   {
@@ -6293,28 +6884,29 @@ typedef struct
        *       the Intel(R) 64 and IA-32 Architectures Optimization Reference Manual for details of a particular product.
        */
       uint32_t translation_cache_type_field                          : 5;
-#define CPUID_EDX_TRANSLATION_CACHE_TYPE_FIELD_BIT                   0
-#define CPUID_EDX_TRANSLATION_CACHE_TYPE_FIELD_FLAG                  0x1F
-#define CPUID_EDX_TRANSLATION_CACHE_TYPE_FIELD_MASK                  0x1F
-#define CPUID_EDX_TRANSLATION_CACHE_TYPE_FIELD(_)                    (((_) >> 0) & 0x1F)
+#define CPUID_EAX_18_ECX_00_EDX_TRANSLATION_CACHE_TYPE_FIELD_BIT     0
+#define CPUID_EAX_18_ECX_00_EDX_TRANSLATION_CACHE_TYPE_FIELD_FLAG    0x1F
+#define CPUID_EAX_18_ECX_00_EDX_TRANSLATION_CACHE_TYPE_FIELD_MASK    0x1F
+#define CPUID_EAX_18_ECX_00_EDX_TRANSLATION_CACHE_TYPE_FIELD(_)      (((_) >> 0) & 0x1F)
 
       /**
        * [Bits 7:5] Translation cache level (starts at 1).
        */
       uint32_t translation_cache_level                               : 3;
-#define CPUID_EDX_TRANSLATION_CACHE_LEVEL_BIT                        5
-#define CPUID_EDX_TRANSLATION_CACHE_LEVEL_FLAG                       0xE0
-#define CPUID_EDX_TRANSLATION_CACHE_LEVEL_MASK                       0x07
-#define CPUID_EDX_TRANSLATION_CACHE_LEVEL(_)                         (((_) >> 5) & 0x07)
+#define CPUID_EAX_18_ECX_00_EDX_TRANSLATION_CACHE_LEVEL_BIT          5
+#define CPUID_EAX_18_ECX_00_EDX_TRANSLATION_CACHE_LEVEL_FLAG         0xE0
+#define CPUID_EAX_18_ECX_00_EDX_TRANSLATION_CACHE_LEVEL_MASK         0x07
+#define CPUID_EAX_18_ECX_00_EDX_TRANSLATION_CACHE_LEVEL(_)           (((_) >> 5) & 0x07)
 
       /**
        * [Bit 8] Fully associative structure.
        */
       uint32_t fully_associative_structure                           : 1;
-#define CPUID_EDX_FULLY_ASSOCIATIVE_STRUCTURE_BIT                    8
-#define CPUID_EDX_FULLY_ASSOCIATIVE_STRUCTURE_FLAG                   0x100
-#define CPUID_EDX_FULLY_ASSOCIATIVE_STRUCTURE_MASK                   0x01
-#define CPUID_EDX_FULLY_ASSOCIATIVE_STRUCTURE(_)                     (((_) >> 8) & 0x01)
+#define CPUID_EAX_18_ECX_00_EDX_FULLY_ASSOCIATIVE_STRUCTURE_BIT      8
+#define CPUID_EAX_18_ECX_00_EDX_FULLY_ASSOCIATIVE_STRUCTURE_FLAG     0x100
+#define CPUID_EAX_18_ECX_00_EDX_FULLY_ASSOCIATIVE_STRUCTURE_MASK     0x01
+#define CPUID_EAX_18_ECX_00_EDX_FULLY_ASSOCIATIVE_STRUCTURE(_)       (((_) >> 8) & 0x01)
+#define CPUID_EAX_18_ECX_00_EDX_FULLY_ASSOCIATIVE_STRUCTURE_FEATURE  3048
       uint32_t reserved1                                             : 5;
 
       /**
@@ -6323,17 +6915,27 @@ typedef struct
        * @note Add one to the return value to get the result.
        */
       uint32_t max_addressable_ids_for_logical_processors            : 12;
-#define CPUID_EDX_MAX_ADDRESSABLE_IDS_FOR_LOGICAL_PROCESSORS_BIT     14
-#define CPUID_EDX_MAX_ADDRESSABLE_IDS_FOR_LOGICAL_PROCESSORS_FLAG    0x3FFC000
-#define CPUID_EDX_MAX_ADDRESSABLE_IDS_FOR_LOGICAL_PROCESSORS_MASK    0xFFF
-#define CPUID_EDX_MAX_ADDRESSABLE_IDS_FOR_LOGICAL_PROCESSORS(_)      (((_) >> 14) & 0xFFF)
+#define CPUID_EAX_18_ECX_00_EDX_MAX_ADDRESSABLE_IDS_FOR_LOGICAL_PROCESSORS_BIT 14
+#define CPUID_EAX_18_ECX_00_EDX_MAX_ADDRESSABLE_IDS_FOR_LOGICAL_PROCESSORS_FLAG 0x3FFC000
+#define CPUID_EAX_18_ECX_00_EDX_MAX_ADDRESSABLE_IDS_FOR_LOGICAL_PROCESSORS_MASK 0xFFF
+#define CPUID_EAX_18_ECX_00_EDX_MAX_ADDRESSABLE_IDS_FOR_LOGICAL_PROCESSORS(_) (((_) >> 14) & 0xFFF)
       uint32_t reserved2                                             : 6;
     };
 
     uint32_t flags;
   } edx;
+#define CPUID_EAX_18_ECX_00_EDX_RESERVED_BITS                        0xFC003E00
 
 } cpuid_eax_18_ecx_00;
+#define CPUID_EAX_18_ECX_00_SNAPSHOT_INDEX                           23
+#define CPUID_EAX_18_ECX_00_EAX_POLICY_AND                           0xFFFFFFFF
+#define CPUID_EAX_18_ECX_00_EAX_POLICY_OR                            0x00000000
+#define CPUID_EAX_18_ECX_00_EBX_POLICY_AND                           0xFFFF070F
+#define CPUID_EAX_18_ECX_00_EBX_POLICY_OR                            0x00000000
+#define CPUID_EAX_18_ECX_00_ECX_POLICY_AND                           0xFFFFFFFF
+#define CPUID_EAX_18_ECX_00_ECX_POLICY_OR                            0x00000000
+#define CPUID_EAX_18_ECX_00_EDX_POLICY_AND                           0x03FFC1FF
+#define CPUID_EAX_18_ECX_00_EDX_POLICY_OR                            0x00000000
 
 /**
  * @brief Deterministic Address Translation Parameters Sub-leaf (EAX = 18H, ECX >= 1)
@@ -6354,14 +6956,15 @@ typedef struct
        * [Bits 31:0] EAX is reserved.
        */
       uint32_t reserved                                              : 32;
-#define CPUID_EAX_RESERVED_BIT                                       0
-#define CPUID_EAX_RESERVED_FLAG                                      0xFFFFFFFF
-#define CPUID_EAX_RESERVED_MASK                                      0xFFFFFFFF
-#define CPUID_EAX_RESERVED(_)                                        (((_) >> 0) & 0xFFFFFFFF)
+#define CPUID_EAX_18_ECX_01P_EAX_RESERVED_BIT                        0
+#define CPUID_EAX_18_ECX_01P_EAX_RESERVED_FLAG                       0xFFFFFFFF
+#define CPUID_EAX_18_ECX_01P_EAX_RESERVED_MASK                       0xFFFFFFFF
+#define CPUID_EAX_18_ECX_01P_EAX_RESERVED(_)                         (((_) >> 0) & 0xFFFFFFFF)
     };
 
     uint32_t flags;
   } eax;
+#define CPUID_EAX_18_ECX_01P_EAX_RESERVED_BITS                       0xFFFFFFFF
 
   union
   {
@@ -6371,61 +6974,62 @@ typedef struct
        * [Bit 0] 4K page size entries supported by this structure.
        */
       uint32_t page_entries_4kb_supported                            : 1;
-#define CPUID_EBX_PAGE_ENTRIES_4KB_SUPPORTED_BIT                     0
-#define CPUID_EBX_PAGE_ENTRIES_4KB_SUPPORTED_FLAG                    0x01
-#define CPUID_EBX_PAGE_ENTRIES_4KB_SUPPORTED_MASK                    0x01
-#define CPUID_EBX_PAGE_ENTRIES_4KB_SUPPORTED(_)                      (((_) >> 0) & 0x01)
+#define CPUID_EAX_18_ECX_01P_EBX_PAGE_ENTRIES_4KB_SUPPORTED_BIT      0
+#define CPUID_EAX_18_ECX_01P_EBX_PAGE_ENTRIES_4KB_SUPPORTED_FLAG     0x01
+#define CPUID_EAX_18_ECX_01P_EBX_PAGE_ENTRIES_4KB_SUPPORTED_MASK     0x01
+#define CPUID_EAX_18_ECX_01P_EBX_PAGE_ENTRIES_4KB_SUPPORTED(_)       (((_) >> 0) & 0x01)
 
       /**
        * [Bit 1] 2MB page size entries supported by this structure.
        */
       uint32_t page_entries_2mb_supported                            : 1;
-#define CPUID_EBX_PAGE_ENTRIES_2MB_SUPPORTED_BIT                     1
-#define CPUID_EBX_PAGE_ENTRIES_2MB_SUPPORTED_FLAG                    0x02
-#define CPUID_EBX_PAGE_ENTRIES_2MB_SUPPORTED_MASK                    0x01
-#define CPUID_EBX_PAGE_ENTRIES_2MB_SUPPORTED(_)                      (((_) >> 1) & 0x01)
+#define CPUID_EAX_18_ECX_01P_EBX_PAGE_ENTRIES_2MB_SUPPORTED_BIT      1
+#define CPUID_EAX_18_ECX_01P_EBX_PAGE_ENTRIES_2MB_SUPPORTED_FLAG     0x02
+#define CPUID_EAX_18_ECX_01P_EBX_PAGE_ENTRIES_2MB_SUPPORTED_MASK     0x01
+#define CPUID_EAX_18_ECX_01P_EBX_PAGE_ENTRIES_2MB_SUPPORTED(_)       (((_) >> 1) & 0x01)
 
       /**
        * [Bit 2] 4MB page size entries supported by this structure.
        */
       uint32_t page_entries_4mb_supported                            : 1;
-#define CPUID_EBX_PAGE_ENTRIES_4MB_SUPPORTED_BIT                     2
-#define CPUID_EBX_PAGE_ENTRIES_4MB_SUPPORTED_FLAG                    0x04
-#define CPUID_EBX_PAGE_ENTRIES_4MB_SUPPORTED_MASK                    0x01
-#define CPUID_EBX_PAGE_ENTRIES_4MB_SUPPORTED(_)                      (((_) >> 2) & 0x01)
+#define CPUID_EAX_18_ECX_01P_EBX_PAGE_ENTRIES_4MB_SUPPORTED_BIT      2
+#define CPUID_EAX_18_ECX_01P_EBX_PAGE_ENTRIES_4MB_SUPPORTED_FLAG     0x04
+#define CPUID_EAX_18_ECX_01P_EBX_PAGE_ENTRIES_4MB_SUPPORTED_MASK     0x01
+#define CPUID_EAX_18_ECX_01P_EBX_PAGE_ENTRIES_4MB_SUPPORTED(_)       (((_) >> 2) & 0x01)
 
       /**
        * [Bit 3] 1 GB page size entries supported by this structure.
        */
       uint32_t page_entries_1gb_supported                            : 1;
-#define CPUID_EBX_PAGE_ENTRIES_1GB_SUPPORTED_BIT                     3
-#define CPUID_EBX_PAGE_ENTRIES_1GB_SUPPORTED_FLAG                    0x08
-#define CPUID_EBX_PAGE_ENTRIES_1GB_SUPPORTED_MASK                    0x01
-#define CPUID_EBX_PAGE_ENTRIES_1GB_SUPPORTED(_)                      (((_) >> 3) & 0x01)
+#define CPUID_EAX_18_ECX_01P_EBX_PAGE_ENTRIES_1GB_SUPPORTED_BIT      3
+#define CPUID_EAX_18_ECX_01P_EBX_PAGE_ENTRIES_1GB_SUPPORTED_FLAG     0x08
+#define CPUID_EAX_18_ECX_01P_EBX_PAGE_ENTRIES_1GB_SUPPORTED_MASK     0x01
+#define CPUID_EAX_18_ECX_01P_EBX_PAGE_ENTRIES_1GB_SUPPORTED(_)       (((_) >> 3) & 0x01)
       uint32_t reserved1                                             : 4;
 
       /**
        * [Bits 10:8] Partitioning (0: Soft partitioning between the logical processors sharing this structure).
        */
       uint32_t partitioning                                          : 3;
-#define CPUID_EBX_PARTITIONING_BIT                                   8
-#define CPUID_EBX_PARTITIONING_FLAG                                  0x700
-#define CPUID_EBX_PARTITIONING_MASK                                  0x07
-#define CPUID_EBX_PARTITIONING(_)                                    (((_) >> 8) & 0x07)
+#define CPUID_EAX_18_ECX_01P_EBX_PARTITIONING_BIT                    8
+#define CPUID_EAX_18_ECX_01P_EBX_PARTITIONING_FLAG                   0x700
+#define CPUID_EAX_18_ECX_01P_EBX_PARTITIONING_MASK                   0x07
+#define CPUID_EAX_18_ECX_01P_EBX_PARTITIONING(_)                     (((_) >> 8) & 0x07)
       uint32_t reserved2                                             : 5;
 
       /**
        * [Bits 31:16] W = Ways of associativity.
        */
       uint32_t ways_of_associativity_01                              : 16;
-#define CPUID_EBX_WAYS_OF_ASSOCIATIVITY_01_BIT                       16
-#define CPUID_EBX_WAYS_OF_ASSOCIATIVITY_01_FLAG                      0xFFFF0000
-#define CPUID_EBX_WAYS_OF_ASSOCIATIVITY_01_MASK                      0xFFFF
-#define CPUID_EBX_WAYS_OF_ASSOCIATIVITY_01(_)                        (((_) >> 16) & 0xFFFF)
+#define CPUID_EAX_18_ECX_01P_EBX_WAYS_OF_ASSOCIATIVITY_01_BIT        16
+#define CPUID_EAX_18_ECX_01P_EBX_WAYS_OF_ASSOCIATIVITY_01_FLAG       0xFFFF0000
+#define CPUID_EAX_18_ECX_01P_EBX_WAYS_OF_ASSOCIATIVITY_01_MASK       0xFFFF
+#define CPUID_EAX_18_ECX_01P_EBX_WAYS_OF_ASSOCIATIVITY_01(_)         (((_) >> 16) & 0xFFFF)
     };
 
     uint32_t flags;
   } ebx;
+#define CPUID_EAX_18_ECX_01P_EBX_RESERVED_BITS                       0xF8F0
 
   union
   {
@@ -6435,14 +7039,15 @@ typedef struct
        * [Bits 31:0] Number of Sets.
        */
       uint32_t number_of_sets                                        : 32;
-#define CPUID_ECX_NUMBER_OF_SETS_BIT                                 0
-#define CPUID_ECX_NUMBER_OF_SETS_FLAG                                0xFFFFFFFF
-#define CPUID_ECX_NUMBER_OF_SETS_MASK                                0xFFFFFFFF
-#define CPUID_ECX_NUMBER_OF_SETS(_)                                  (((_) >> 0) & 0xFFFFFFFF)
+#define CPUID_EAX_18_ECX_01P_ECX_NUMBER_OF_SETS_BIT                  0
+#define CPUID_EAX_18_ECX_01P_ECX_NUMBER_OF_SETS_FLAG                 0xFFFFFFFF
+#define CPUID_EAX_18_ECX_01P_ECX_NUMBER_OF_SETS_MASK                 0xFFFFFFFF
+#define CPUID_EAX_18_ECX_01P_ECX_NUMBER_OF_SETS(_)                   (((_) >> 0) & 0xFFFFFFFF)
     };
 
     uint32_t flags;
   } ecx;
+#define CPUID_EAX_18_ECX_01P_ECX_RESERVED_BITS                       0x00
 
   union
   {
@@ -6461,28 +7066,28 @@ typedef struct
        *       the Intel(R) 64 and IA-32 Architectures Optimization Reference Manual for details of a particular product.
        */
       uint32_t translation_cache_type_field                          : 5;
-#define CPUID_EDX_TRANSLATION_CACHE_TYPE_FIELD_BIT                   0
-#define CPUID_EDX_TRANSLATION_CACHE_TYPE_FIELD_FLAG                  0x1F
-#define CPUID_EDX_TRANSLATION_CACHE_TYPE_FIELD_MASK                  0x1F
-#define CPUID_EDX_TRANSLATION_CACHE_TYPE_FIELD(_)                    (((_) >> 0) & 0x1F)
+#define CPUID_EAX_18_ECX_01P_EDX_TRANSLATION_CACHE_TYPE_FIELD_BIT    0
+#define CPUID_EAX_18_ECX_01P_EDX_TRANSLATION_CACHE_TYPE_FIELD_FLAG   0x1F
+#define CPUID_EAX_18_ECX_01P_EDX_TRANSLATION_CACHE_TYPE_FIELD_MASK   0x1F
+#define CPUID_EAX_18_ECX_01P_EDX_TRANSLATION_CACHE_TYPE_FIELD(_)     (((_) >> 0) & 0x1F)
 
       /**
        * [Bits 7:5] Translation cache level (starts at 1).
        */
       uint32_t translation_cache_level                               : 3;
-#define CPUID_EDX_TRANSLATION_CACHE_LEVEL_BIT                        5
-#define CPUID_EDX_TRANSLATION_CACHE_LEVEL_FLAG                       0xE0
-#define CPUID_EDX_TRANSLATION_CACHE_LEVEL_MASK                       0x07
-#define CPUID_EDX_TRANSLATION_CACHE_LEVEL(_)                         (((_) >> 5) & 0x07)
+#define CPUID_EAX_18_ECX_01P_EDX_TRANSLATION_CACHE_LEVEL_BIT         5
+#define CPUID_EAX_18_ECX_01P_EDX_TRANSLATION_CACHE_LEVEL_FLAG        0xE0
+#define CPUID_EAX_18_ECX_01P_EDX_TRANSLATION_CACHE_LEVEL_MASK        0x07
+#define CPUID_EAX_18_ECX_01P_EDX_TRANSLATION_CACHE_LEVEL(_)          (((_) >> 5) & 0x07)
 
       /**
        * [Bit 8] Fully associative structure.
        */
       uint32_t fully_associative_structure                           : 1;
-#define CPUID_EDX_FULLY_ASSOCIATIVE_STRUCTURE_BIT                    8
-#define CPUID_EDX_FULLY_ASSOCIATIVE_STRUCTURE_FLAG                   0x100
-#define CPUID_EDX_FULLY_ASSOCIATIVE_STRUCTURE_MASK                   0x01
-#define CPUID_EDX_FULLY_ASSOCIATIVE_STRUCTURE(_)                     (((_) >> 8) & 0x01)
+#define CPUID_EAX_18_ECX_01P_EDX_FULLY_ASSOCIATIVE_STRUCTURE_BIT     8
+#define CPUID_EAX_18_ECX_01P_EDX_FULLY_ASSOCIATIVE_STRUCTURE_FLAG    0x100
+#define CPUID_EAX_18_ECX_01P_EDX_FULLY_ASSOCIATIVE_STRUCTURE_MASK    0x01
+#define CPUID_EAX_18_ECX_01P_EDX_FULLY_ASSOCIATIVE_STRUCTURE(_)      (((_) >> 8) & 0x01)
       uint32_t reserved1                                             : 5;
 
       /**
@@ -6491,15 +7096,16 @@ typedef struct
        * @note Add one to the return value to get the result.
        */
       uint32_t max_addressable_ids_for_logical_processors            : 12;
-#define CPUID_EDX_MAX_ADDRESSABLE_IDS_FOR_LOGICAL_PROCESSORS_BIT     14
-#define CPUID_EDX_MAX_ADDRESSABLE_IDS_FOR_LOGICAL_PROCESSORS_FLAG    0x3FFC000
-#define CPUID_EDX_MAX_ADDRESSABLE_IDS_FOR_LOGICAL_PROCESSORS_MASK    0xFFF
-#define CPUID_EDX_MAX_ADDRESSABLE_IDS_FOR_LOGICAL_PROCESSORS(_)      (((_) >> 14) & 0xFFF)
+#define CPUID_EAX_18_ECX_01P_EDX_MAX_ADDRESSABLE_IDS_FOR_LOGICAL_PROCESSORS_BIT 14
+#define CPUID_EAX_18_ECX_01P_EDX_MAX_ADDRESSABLE_IDS_FOR_LOGICAL_PROCESSORS_FLAG 0x3FFC000
+#define CPUID_EAX_18_ECX_01P_EDX_MAX_ADDRESSABLE_IDS_FOR_LOGICAL_PROCESSORS_MASK 0xFFF
+#define CPUID_EAX_18_ECX_01P_EDX_MAX_ADDRESSABLE_IDS_FOR_LOGICAL_PROCESSORS(_) (((_) >> 14) & 0xFFF)
       uint32_t reserved2                                             : 6;
     };
 
     uint32_t flags;
   } edx;
+#define CPUID_EAX_18_ECX_01P_EDX_RESERVED_BITS                       0xFC003E00
 
 } cpuid_eax_18_ecx_01p;
 
@@ -6525,14 +7131,15 @@ typedef struct
        * [Bits 31:0] Maximum Input Value for Extended Function CPUID Information.
        */
       uint32_t max_extended_functions                                : 32;
-#define CPUID_EAX_MAX_EXTENDED_FUNCTIONS_BIT                         0
-#define CPUID_EAX_MAX_EXTENDED_FUNCTIONS_FLAG                        0xFFFFFFFF
-#define CPUID_EAX_MAX_EXTENDED_FUNCTIONS_MASK                        0xFFFFFFFF
-#define CPUID_EAX_MAX_EXTENDED_FUNCTIONS(_)                          (((_) >> 0) & 0xFFFFFFFF)
+#define CPUID_EAX_80000000_EAX_MAX_EXTENDED_FUNCTIONS_BIT            0
+#define CPUID_EAX_80000000_EAX_MAX_EXTENDED_FUNCTIONS_FLAG           0xFFFFFFFF
+#define CPUID_EAX_80000000_EAX_MAX_EXTENDED_FUNCTIONS_MASK           0xFFFFFFFF
+#define CPUID_EAX_80000000_EAX_MAX_EXTENDED_FUNCTIONS(_)             (((_) >> 0) & 0xFFFFFFFF)
     };
 
     uint32_t flags;
   } eax;
+#define CPUID_EAX_80000000_EAX_RESERVED_BITS                         0x00
 
   union
   {
@@ -6542,14 +7149,15 @@ typedef struct
        * [Bits 31:0] EBX is reserved.
        */
       uint32_t reserved                                              : 32;
-#define CPUID_EBX_RESERVED_BIT                                       0
-#define CPUID_EBX_RESERVED_FLAG                                      0xFFFFFFFF
-#define CPUID_EBX_RESERVED_MASK                                      0xFFFFFFFF
-#define CPUID_EBX_RESERVED(_)                                        (((_) >> 0) & 0xFFFFFFFF)
+#define CPUID_EAX_80000000_EBX_RESERVED_BIT                          0
+#define CPUID_EAX_80000000_EBX_RESERVED_FLAG                         0xFFFFFFFF
+#define CPUID_EAX_80000000_EBX_RESERVED_MASK                         0xFFFFFFFF
+#define CPUID_EAX_80000000_EBX_RESERVED(_)                           (((_) >> 0) & 0xFFFFFFFF)
     };
 
     uint32_t flags;
   } ebx;
+#define CPUID_EAX_80000000_EBX_RESERVED_BITS                         0xFFFFFFFF
 
   union
   {
@@ -6559,14 +7167,15 @@ typedef struct
        * [Bits 31:0] ECX is reserved.
        */
       uint32_t reserved                                              : 32;
-#define CPUID_ECX_RESERVED_BIT                                       0
-#define CPUID_ECX_RESERVED_FLAG                                      0xFFFFFFFF
-#define CPUID_ECX_RESERVED_MASK                                      0xFFFFFFFF
-#define CPUID_ECX_RESERVED(_)                                        (((_) >> 0) & 0xFFFFFFFF)
+#define CPUID_EAX_80000000_ECX_RESERVED_BIT                          0
+#define CPUID_EAX_80000000_ECX_RESERVED_FLAG                         0xFFFFFFFF
+#define CPUID_EAX_80000000_ECX_RESERVED_MASK                         0xFFFFFFFF
+#define CPUID_EAX_80000000_ECX_RESERVED(_)                           (((_) >> 0) & 0xFFFFFFFF)
     };
 
     uint32_t flags;
   } ecx;
+#define CPUID_EAX_80000000_ECX_RESERVED_BITS                         0xFFFFFFFF
 
   union
   {
@@ -6576,16 +7185,26 @@ typedef struct
        * [Bits 31:0] EDX is reserved.
        */
       uint32_t reserved                                              : 32;
-#define CPUID_EDX_RESERVED_BIT                                       0
-#define CPUID_EDX_RESERVED_FLAG                                      0xFFFFFFFF
-#define CPUID_EDX_RESERVED_MASK                                      0xFFFFFFFF
-#define CPUID_EDX_RESERVED(_)                                        (((_) >> 0) & 0xFFFFFFFF)
+#define CPUID_EAX_80000000_EDX_RESERVED_BIT                          0
+#define CPUID_EAX_80000000_EDX_RESERVED_FLAG                         0xFFFFFFFF
+#define CPUID_EAX_80000000_EDX_RESERVED_MASK                         0xFFFFFFFF
+#define CPUID_EAX_80000000_EDX_RESERVED(_)                           (((_) >> 0) & 0xFFFFFFFF)
     };
 
     uint32_t flags;
   } edx;
+#define CPUID_EAX_80000000_EDX_RESERVED_BITS                         0xFFFFFFFF
 
 } cpuid_eax_80000000;
+#define CPUID_EAX_80000000_SNAPSHOT_INDEX                            24
+#define CPUID_EAX_80000000_EAX_POLICY_AND                            0xFFFFFFFF
+#define CPUID_EAX_80000000_EAX_POLICY_OR                             0x00000000
+#define CPUID_EAX_80000000_EBX_POLICY_AND                            0x00000000
+#define CPUID_EAX_80000000_EBX_POLICY_OR                             0x00000000
+#define CPUID_EAX_80000000_ECX_POLICY_AND                            0x00000000
+#define CPUID_EAX_80000000_ECX_POLICY_OR                             0x00000000
+#define CPUID_EAX_80000000_EDX_POLICY_AND                            0x00000000
+#define CPUID_EAX_80000000_EDX_POLICY_OR                             0x00000000
 
 
 /**
@@ -6602,14 +7221,15 @@ typedef struct
        * [Bits 31:0] EAX is reserved.
        */
       uint32_t reserved                                              : 32;
-#define CPUID_EAX_RESERVED_BIT                                       0
-#define CPUID_EAX_RESERVED_FLAG                                      0xFFFFFFFF
-#define CPUID_EAX_RESERVED_MASK                                      0xFFFFFFFF
-#define CPUID_EAX_RESERVED(_)                                        (((_) >> 0) & 0xFFFFFFFF)
+#define CPUID_EAX_80000001_EAX_RESERVED_BIT                          0
+#define CPUID_EAX_80000001_EAX_RESERVED_FLAG                         0xFFFFFFFF
+#define CPUID_EAX_80000001_EAX_RESERVED_MASK                         0xFFFFFFFF
+#define CPUID_EAX_80000001_EAX_RESERVED(_)                           (((_) >> 0) & 0xFFFFFFFF)
     };
 
     uint32_t flags;
   } eax;
+#define CPUID_EAX_80000001_EAX_RESERVED_BITS                         0xFFFFFFFF
 
   union
   {
@@ -6619,14 +7239,15 @@ typedef struct
        * [Bits 31:0] EBX is reserved.
        */
       uint32_t reserved                                              : 32;
-#define CPUID_EBX_RESERVED_BIT                                       0
-#define CPUID_EBX_RESERVED_FLAG                                      0xFFFFFFFF
-#define CPUID_EBX_RESERVED_MASK                                      0xFFFFFFFF
-#define CPUID_EBX_RESERVED(_)                                        (((_) >> 0) & 0xFFFFFFFF)
+#define CPUID_EAX_80000001_EBX_RESERVED_BIT                          0
+#define CPUID_EAX_80000001_EBX_RESERVED_FLAG                         0xFFFFFFFF
+#define CPUID_EAX_80000001_EBX_RESERVED_MASK                         0xFFFFFFFF
+#define CPUID_EAX_80000001_EBX_RESERVED(_)                           (((_) >> 0) & 0xFFFFFFFF)
     };
 
     uint32_t flags;
   } ebx;
+#define CPUID_EAX_80000001_EBX_RESERVED_BITS                         0xFFFFFFFF
 
   union
   {
@@ -6636,35 +7257,39 @@ typedef struct
        * [Bit 0] LAHF/SAHF available in 64-bit mode.
        */
       uint32_t lahf_sahf_available_in_64_bit_mode                    : 1;
-#define CPUID_ECX_LAHF_SAHF_AVAILABLE_IN_64_BIT_MODE_BIT             0
-#define CPUID_ECX_LAHF_SAHF_AVAILABLE_IN_64_BIT_MODE_FLAG            0x01
-#define CPUID_ECX_LAHF_SAHF_AVAILABLE_IN_64_BIT_MODE_MASK            0x01
-#define CPUID_ECX_LAHF_SAHF_AVAILABLE_IN_64_BIT_MODE(_)              (((_) >> 0) & 0x01)
+#define CPUID_EAX_80000001_ECX_LAHF_SAHF_AVAILABLE_IN_64_BIT_MODE_BIT 0
+#define CPUID_EAX_80000001_ECX_LAHF_SAHF_AVAILABLE_IN_64_BIT_MODE_FLAG 0x01
+#define CPUID_EAX_80000001_ECX_LAHF_SAHF_AVAILABLE_IN_64_BIT_MODE_MASK 0x01
+#define CPUID_EAX_80000001_ECX_LAHF_SAHF_AVAILABLE_IN_64_BIT_MODE(_) (((_) >> 0) & 0x01)
+#define CPUID_EAX_80000001_ECX_LAHF_SAHF_AVAILABLE_IN_64_BIT_MODE_FEATURE 3264
       uint32_t reserved1                                             : 4;
 
       /**
        * [Bit 5] LZCNT.
        */
       uint32_t lzcnt                                                 : 1;
-#define CPUID_ECX_LZCNT_BIT                                          5
-#define CPUID_ECX_LZCNT_FLAG                                         0x20
-#define CPUID_ECX_LZCNT_MASK                                         0x01
-#define CPUID_ECX_LZCNT(_)                                           (((_) >> 5) & 0x01)
+#define CPUID_EAX_80000001_ECX_LZCNT_BIT                             5
+#define CPUID_EAX_80000001_ECX_LZCNT_FLAG                            0x20
+#define CPUID_EAX_80000001_ECX_LZCNT_MASK                            0x01
+#define CPUID_EAX_80000001_ECX_LZCNT(_)                              (((_) >> 5) & 0x01)
+#define CPUID_EAX_80000001_ECX_LZCNT_FEATURE                         3269
       uint32_t reserved2                                             : 2;
 
       /**
        * [Bit 8] PREFETCHW.
        */
       uint32_t prefetchw                                             : 1;
-#define CPUID_ECX_PREFETCHW_BIT                                      8
-#define CPUID_ECX_PREFETCHW_FLAG                                     0x100
-#define CPUID_ECX_PREFETCHW_MASK                                     0x01
-#define CPUID_ECX_PREFETCHW(_)                                       (((_) >> 8) & 0x01)
+#define CPUID_EAX_80000001_ECX_PREFETCHW_BIT                         8
+#define CPUID_EAX_80000001_ECX_PREFETCHW_FLAG                        0x100
+#define CPUID_EAX_80000001_ECX_PREFETCHW_MASK                        0x01
+#define CPUID_EAX_80000001_ECX_PREFETCHW(_)                          (((_) >> 8) & 0x01)
+#define CPUID_EAX_80000001_ECX_PREFETCHW_FEATURE                     3272
       uint32_t reserved3                                             : 23;
     };
 
     uint32_t flags;
   } ecx;
+#define CPUID_EAX_80000001_ECX_RESERVED_BITS                         0xFFFFFEDE
 
   union
   {
@@ -6676,56 +7301,71 @@ typedef struct
        * [Bit 11] SYSCALL/SYSRET available in 64-bit mode.
        */
       uint32_t syscall_sysret_available_in_64_bit_mode               : 1;
-#define CPUID_EDX_SYSCALL_SYSRET_AVAILABLE_IN_64_BIT_MODE_BIT        11
-#define CPUID_EDX_SYSCALL_SYSRET_AVAILABLE_IN_64_BIT_MODE_FLAG       0x800
-#define CPUID_EDX_SYSCALL_SYSRET_AVAILABLE_IN_64_BIT_MODE_MASK       0x01
-#define CPUID_EDX_SYSCALL_SYSRET_AVAILABLE_IN_64_BIT_MODE(_)         (((_) >> 11) & 0x01)
+#define CPUID_EAX_80000001_EDX_SYSCALL_SYSRET_AVAILABLE_IN_64_BIT_MODE_BIT 11
+#define CPUID_EAX_80000001_EDX_SYSCALL_SYSRET_AVAILABLE_IN_64_BIT_MODE_FLAG 0x800
+#define CPUID_EAX_80000001_EDX_SYSCALL_SYSRET_AVAILABLE_IN_64_BIT_MODE_MASK 0x01
+#define CPUID_EAX_80000001_EDX_SYSCALL_SYSRET_AVAILABLE_IN_64_BIT_MODE(_) (((_) >> 11) & 0x01)
+#define CPUID_EAX_80000001_EDX_SYSCALL_SYSRET_AVAILABLE_IN_64_BIT_MODE_FEATURE 3307
       uint32_t reserved2                                             : 8;
 
       /**
        * [Bit 20] Execute Disable Bit available.
        */
       uint32_t execute_disable_bit_available                         : 1;
-#define CPUID_EDX_EXECUTE_DISABLE_BIT_AVAILABLE_BIT                  20
-#define CPUID_EDX_EXECUTE_DISABLE_BIT_AVAILABLE_FLAG                 0x100000
-#define CPUID_EDX_EXECUTE_DISABLE_BIT_AVAILABLE_MASK                 0x01
-#define CPUID_EDX_EXECUTE_DISABLE_BIT_AVAILABLE(_)                   (((_) >> 20) & 0x01)
+#define CPUID_EAX_80000001_EDX_EXECUTE_DISABLE_BIT_AVAILABLE_BIT     20
+#define CPUID_EAX_80000001_EDX_EXECUTE_DISABLE_BIT_AVAILABLE_FLAG    0x100000
+#define CPUID_EAX_80000001_EDX_EXECUTE_DISABLE_BIT_AVAILABLE_MASK    0x01
+#define CPUID_EAX_80000001_EDX_EXECUTE_DISABLE_BIT_AVAILABLE(_)      (((_) >> 20) & 0x01)
+#define CPUID_EAX_80000001_EDX_EXECUTE_DISABLE_BIT_AVAILABLE_FEATURE 3316
       uint32_t reserved3                                             : 5;
 
       /**
        * [Bit 26] 1-GByte pages are available if 1.
        */
       uint32_t pages_1gb_available                                   : 1;
-#define CPUID_EDX_PAGES_1GB_AVAILABLE_BIT                            26
-#define CPUID_EDX_PAGES_1GB_AVAILABLE_FLAG                           0x4000000
-#define CPUID_EDX_PAGES_1GB_AVAILABLE_MASK                           0x01
-#define CPUID_EDX_PAGES_1GB_AVAILABLE(_)                             (((_) >> 26) & 0x01)
+#define CPUID_EAX_80000001_EDX_PAGES_1GB_AVAILABLE_BIT               26
+#define CPUID_EAX_80000001_EDX_PAGES_1GB_AVAILABLE_FLAG              0x4000000
+#define CPUID_EAX_80000001_EDX_PAGES_1GB_AVAILABLE_MASK              0x01
+#define CPUID_EAX_80000001_EDX_PAGES_1GB_AVAILABLE(_)                (((_) >> 26) & 0x01)
+#define CPUID_EAX_80000001_EDX_PAGES_1GB_AVAILABLE_FEATURE           3322
 
       /**
        * [Bit 27] RDTSCP and IA32_TSC_AUX are available if 1.
        */
       uint32_t rdtscp_available                                      : 1;
-#define CPUID_EDX_RDTSCP_AVAILABLE_BIT                               27
-#define CPUID_EDX_RDTSCP_AVAILABLE_FLAG                              0x8000000
-#define CPUID_EDX_RDTSCP_AVAILABLE_MASK                              0x01
-#define CPUID_EDX_RDTSCP_AVAILABLE(_)                                (((_) >> 27) & 0x01)
+#define CPUID_EAX_80000001_EDX_RDTSCP_AVAILABLE_BIT                  27
+#define CPUID_EAX_80000001_EDX_RDTSCP_AVAILABLE_FLAG                 0x8000000
+#define CPUID_EAX_80000001_EDX_RDTSCP_AVAILABLE_MASK                 0x01
+#define CPUID_EAX_80000001_EDX_RDTSCP_AVAILABLE(_)                   (((_) >> 27) & 0x01)
+#define CPUID_EAX_80000001_EDX_RDTSCP_AVAILABLE_FEATURE              3323
       uint32_t reserved4                                             : 1;
 
       /**
        * [Bit 29] Intel(R) 64 Architecture available if 1.
        */
       uint32_t ia64_available                                        : 1;
-#define CPUID_EDX_IA64_AVAILABLE_BIT                                 29
-#define CPUID_EDX_IA64_AVAILABLE_FLAG                                0x20000000
-#define CPUID_EDX_IA64_AVAILABLE_MASK                                0x01
-#define CPUID_EDX_IA64_AVAILABLE(_)                                  (((_) >> 29) & 0x01)
+#define CPUID_EAX_80000001_EDX_IA64_AVAILABLE_BIT                    29
+#define CPUID_EAX_80000001_EDX_IA64_AVAILABLE_FLAG                   0x20000000
+#define CPUID_EAX_80000001_EDX_IA64_AVAILABLE_MASK                   0x01
+#define CPUID_EAX_80000001_EDX_IA64_AVAILABLE(_)                     (((_) >> 29) & 0x01)
+#define CPUID_EAX_80000001_EDX_IA64_AVAILABLE_FEATURE                3325
       uint32_t reserved5                                             : 2;
     };
 
     uint32_t flags;
   } edx;
+#define CPUID_EAX_80000001_EDX_RESERVED_BITS                         0xD3EFF7FF
 
 } cpuid_eax_80000001;
+#define CPUID_EAX_80000001_SNAPSHOT_INDEX                            25
+#define CPUID_EAX_80000001_EAX_POLICY_AND                            0x00000000
+#define CPUID_EAX_80000001_EAX_POLICY_OR                             0x00000000
+#define CPUID_EAX_80000001_EBX_POLICY_AND                            0x00000000
+#define CPUID_EAX_80000001_EBX_POLICY_OR                             0x00000000
+#define CPUID_EAX_80000001_ECX_POLICY_AND                            0x00000121
+#define CPUID_EAX_80000001_ECX_POLICY_OR                             0x00000000
+#define CPUID_EAX_80000001_EDX_POLICY_AND                            0x2C100800
+#define CPUID_EAX_80000001_EDX_POLICY_OR                             0x00000000
 
 
 /**
@@ -6752,14 +7392,15 @@ typedef struct
        * [Bits 31:0] Processor Brand String.
        */
       uint32_t processor_brand_string_1                              : 32;
-#define CPUID_EAX_PROCESSOR_BRAND_STRING_1_BIT                       0
-#define CPUID_EAX_PROCESSOR_BRAND_STRING_1_FLAG                      0xFFFFFFFF
-#define CPUID_EAX_PROCESSOR_BRAND_STRING_1_MASK                      0xFFFFFFFF
-#define CPUID_EAX_PROCESSOR_BRAND_STRING_1(_)                        (((_) >> 0) & 0xFFFFFFFF)
+#define CPUID_EAX_80000002_EAX_PROCESSOR_BRAND_STRING_1_BIT          0
+#define CPUID_EAX_80000002_EAX_PROCESSOR_BRAND_STRING_1_FLAG         0xFFFFFFFF
+#define CPUID_EAX_80000002_EAX_PROCESSOR_BRAND_STRING_1_MASK         0xFFFFFFFF
+#define CPUID_EAX_80000002_EAX_PROCESSOR_BRAND_STRING_1(_)           (((_) >> 0) & 0xFFFFFFFF)
     };
 
     uint32_t flags;
   } eax;
+#define CPUID_EAX_80000002_EAX_RESERVED_BITS                         0x00
 
   union
   {
@@ -6769,14 +7410,15 @@ typedef struct
        * [Bits 31:0] Processor Brand String Continued.
        */
       uint32_t processor_brand_string_2                              : 32;
-#define CPUID_EBX_PROCESSOR_BRAND_STRING_2_BIT                       0
-#define CPUID_EBX_PROCESSOR_BRAND_STRING_2_FLAG                      0xFFFFFFFF
-#define CPUID_EBX_PROCESSOR_BRAND_STRING_2_MASK                      0xFFFFFFFF
-#define CPUID_EBX_PROCESSOR_BRAND_STRING_2(_)                        (((_) >> 0) & 0xFFFFFFFF)
+#define CPUID_EAX_80000002_EBX_PROCESSOR_BRAND_STRING_2_BIT          0
+#define CPUID_EAX_80000002_EBX_PROCESSOR_BRAND_STRING_2_FLAG         0xFFFFFFFF
+#define CPUID_EAX_80000002_EBX_PROCESSOR_BRAND_STRING_2_MASK         0xFFFFFFFF
+#define CPUID_EAX_80000002_EBX_PROCESSOR_BRAND_STRING_2(_)           (((_) >> 0) & 0xFFFFFFFF)
     };
 
     uint32_t flags;
   } ebx;
+#define CPUID_EAX_80000002_EBX_RESERVED_BITS                         0x00
 
   union
   {
@@ -6786,14 +7428,15 @@ typedef struct
        * [Bits 31:0] Processor Brand String Continued.
        */
       uint32_t processor_brand_string_3                              : 32;
-#define CPUID_ECX_PROCESSOR_BRAND_STRING_3_BIT                       0
-#define CPUID_ECX_PROCESSOR_BRAND_STRING_3_FLAG                      0xFFFFFFFF
-#define CPUID_ECX_PROCESSOR_BRAND_STRING_3_MASK                      0xFFFFFFFF
-#define CPUID_ECX_PROCESSOR_BRAND_STRING_3(_)                        (((_) >> 0) & 0xFFFFFFFF)
+#define CPUID_EAX_80000002_ECX_PROCESSOR_BRAND_STRING_3_BIT          0
+#define CPUID_EAX_80000002_ECX_PROCESSOR_BRAND_STRING_3_FLAG         0xFFFFFFFF
+#define CPUID_EAX_80000002_ECX_PROCESSOR_BRAND_STRING_3_MASK         0xFFFFFFFF
+#define CPUID_EAX_80000002_ECX_PROCESSOR_BRAND_STRING_3(_)           (((_) >> 0) & 0xFFFFFFFF)
     };
 
     uint32_t flags;
   } ecx;
+#define CPUID_EAX_80000002_ECX_RESERVED_BITS                         0x00
 
   union
   {
@@ -6803,16 +7446,26 @@ typedef struct
        * [Bits 31:0] Processor Brand String Continued.
        */
       uint32_t processor_brand_string_4                              : 32;
-#define CPUID_EDX_PROCESSOR_BRAND_STRING_4_BIT                       0
-#define CPUID_EDX_PROCESSOR_BRAND_STRING_4_FLAG                      0xFFFFFFFF
-#define CPUID_EDX_PROCESSOR_BRAND_STRING_4_MASK                      0xFFFFFFFF
-#define CPUID_EDX_PROCESSOR_BRAND_STRING_4(_)                        (((_) >> 0) & 0xFFFFFFFF)
+#define CPUID_EAX_80000002_EDX_PROCESSOR_BRAND_STRING_4_BIT          0
+#define CPUID_EAX_80000002_EDX_PROCESSOR_BRAND_STRING_4_FLAG         0xFFFFFFFF
+#define CPUID_EAX_80000002_EDX_PROCESSOR_BRAND_STRING_4_MASK         0xFFFFFFFF
+#define CPUID_EAX_80000002_EDX_PROCESSOR_BRAND_STRING_4(_)           (((_) >> 0) & 0xFFFFFFFF)
     };
 
     uint32_t flags;
   } edx;
+#define CPUID_EAX_80000002_EDX_RESERVED_BITS                         0x00
 
 } cpuid_eax_80000002;
+#define CPUID_EAX_80000002_SNAPSHOT_INDEX                            26
+#define CPUID_EAX_80000002_EAX_POLICY_AND                            0xFFFFFFFF
+#define CPUID_EAX_80000002_EAX_POLICY_OR                             0x00000000
+#define CPUID_EAX_80000002_EBX_POLICY_AND                            0xFFFFFFFF
+#define CPUID_EAX_80000002_EBX_POLICY_OR                             0x00000000
+#define CPUID_EAX_80000002_ECX_POLICY_AND                            0xFFFFFFFF
+#define CPUID_EAX_80000002_ECX_POLICY_OR                             0x00000000
+#define CPUID_EAX_80000002_EDX_POLICY_AND                            0xFFFFFFFF
+#define CPUID_EAX_80000002_EDX_POLICY_OR                             0x00000000
 
 /**
  * @brief Extended Function CPUID Information
@@ -6827,14 +7480,15 @@ typedef struct
        * [Bits 31:0] Processor Brand String Continued.
        */
       uint32_t processor_brand_string_5                              : 32;
-#define CPUID_EAX_PROCESSOR_BRAND_STRING_5_BIT                       0
-#define CPUID_EAX_PROCESSOR_BRAND_STRING_5_FLAG                      0xFFFFFFFF
-#define CPUID_EAX_PROCESSOR_BRAND_STRING_5_MASK                      0xFFFFFFFF
-#define CPUID_EAX_PROCESSOR_BRAND_STRING_5(_)                        (((_) >> 0) & 0xFFFFFFFF)
+#define CPUID_EAX_80000003_EAX_PROCESSOR_BRAND_STRING_5_BIT          0
+#define CPUID_EAX_80000003_EAX_PROCESSOR_BRAND_STRING_5_FLAG         0xFFFFFFFF
+#define CPUID_EAX_80000003_EAX_PROCESSOR_BRAND_STRING_5_MASK         0xFFFFFFFF
+#define CPUID_EAX_80000003_EAX_PROCESSOR_BRAND_STRING_5(_)           (((_) >> 0) & 0xFFFFFFFF)
     };
 
     uint32_t flags;
   } eax;
+#define CPUID_EAX_80000003_EAX_RESERVED_BITS                         0x00
 
   union
   {
@@ -6844,14 +7498,15 @@ typedef struct
        * [Bits 31:0] Processor Brand String Continued.
        */
       uint32_t processor_brand_string_6                              : 32;
-#define CPUID_EBX_PROCESSOR_BRAND_STRING_6_BIT                       0
-#define CPUID_EBX_PROCESSOR_BRAND_STRING_6_FLAG                      0xFFFFFFFF
-#define CPUID_EBX_PROCESSOR_BRAND_STRING_6_MASK                      0xFFFFFFFF
-#define CPUID_EBX_PROCESSOR_BRAND_STRING_6(_)                        (((_) >> 0) & 0xFFFFFFFF)
+#define CPUID_EAX_80000003_EBX_PROCESSOR_BRAND_STRING_6_BIT          0
+#define CPUID_EAX_80000003_EBX_PROCESSOR_BRAND_STRING_6_FLAG         0xFFFFFFFF
+#define CPUID_EAX_80000003_EBX_PROCESSOR_BRAND_STRING_6_MASK         0xFFFFFFFF
+#define CPUID_EAX_80000003_EBX_PROCESSOR_BRAND_STRING_6(_)           (((_) >> 0) & 0xFFFFFFFF)
     };
 
     uint32_t flags;
   } ebx;
+#define CPUID_EAX_80000003_EBX_RESERVED_BITS                         0x00
 
   union
   {
@@ -6861,14 +7516,15 @@ typedef struct
        * [Bits 31:0] Processor Brand String Continued.
        */
       uint32_t processor_brand_string_7                              : 32;
-#define CPUID_ECX_PROCESSOR_BRAND_STRING_7_BIT                       0
-#define CPUID_ECX_PROCESSOR_BRAND_STRING_7_FLAG                      0xFFFFFFFF
-#define CPUID_ECX_PROCESSOR_BRAND_STRING_7_MASK                      0xFFFFFFFF
-#define CPUID_ECX_PROCESSOR_BRAND_STRING_7(_)                        (((_) >> 0) & 0xFFFFFFFF)
+#define CPUID_EAX_80000003_ECX_PROCESSOR_BRAND_STRING_7_BIT          0
+#define CPUID_EAX_80000003_ECX_PROCESSOR_BRAND_STRING_7_FLAG         0xFFFFFFFF
+#define CPUID_EAX_80000003_ECX_PROCESSOR_BRAND_STRING_7_MASK         0xFFFFFFFF
+#define CPUID_EAX_80000003_ECX_PROCESSOR_BRAND_STRING_7(_)           (((_) >> 0) & 0xFFFFFFFF)
     };
 
     uint32_t flags;
   } ecx;
+#define CPUID_EAX_80000003_ECX_RESERVED_BITS                         0x00
 
   union
   {
@@ -6878,16 +7534,26 @@ typedef struct
        * [Bits 31:0] Processor Brand String Continued.
        */
       uint32_t processor_brand_string_8                              : 32;
-#define CPUID_EDX_PROCESSOR_BRAND_STRING_8_BIT                       0
-#define CPUID_EDX_PROCESSOR_BRAND_STRING_8_FLAG                      0xFFFFFFFF
-#define CPUID_EDX_PROCESSOR_BRAND_STRING_8_MASK                      0xFFFFFFFF
-#define CPUID_EDX_PROCESSOR_BRAND_STRING_8(_)                        (((_) >> 0) & 0xFFFFFFFF)
+#define CPUID_EAX_80000003_EDX_PROCESSOR_BRAND_STRING_8_BIT          0
+#define CPUID_EAX_80000003_EDX_PROCESSOR_BRAND_STRING_8_FLAG         0xFFFFFFFF
+#define CPUID_EAX_80000003_EDX_PROCESSOR_BRAND_STRING_8_MASK         0xFFFFFFFF
+#define CPUID_EAX_80000003_EDX_PROCESSOR_BRAND_STRING_8(_)           (((_) >> 0) & 0xFFFFFFFF)
     };
 
     uint32_t flags;
   } edx;
+#define CPUID_EAX_80000003_EDX_RESERVED_BITS                         0x00
 
 } cpuid_eax_80000003;
+#define CPUID_EAX_80000003_SNAPSHOT_INDEX                            27
+#define CPUID_EAX_80000003_EAX_POLICY_AND                            0xFFFFFFFF
+#define CPUID_EAX_80000003_EAX_POLICY_OR                             0x00000000
+#define CPUID_EAX_80000003_EBX_POLICY_AND                            0xFFFFFFFF
+#define CPUID_EAX_80000003_EBX_POLICY_OR                             0x00000000
+#define CPUID_EAX_80000003_ECX_POLICY_AND                            0xFFFFFFFF
+#define CPUID_EAX_80000003_ECX_POLICY_OR                             0x00000000
+#define CPUID_EAX_80000003_EDX_POLICY_AND                            0xFFFFFFFF
+#define CPUID_EAX_80000003_EDX_POLICY_OR                             0x00000000
 
 /**
  * @brief Extended Function CPUID Information
@@ -6902,14 +7568,15 @@ typedef struct
        * [Bits 31:0] Processor Brand String Continued.
        */
       uint32_t processor_brand_string_9                              : 32;
-#define CPUID_EAX_PROCESSOR_BRAND_STRING_9_BIT                       0
-#define CPUID_EAX_PROCESSOR_BRAND_STRING_9_FLAG                      0xFFFFFFFF
-#define CPUID_EAX_PROCESSOR_BRAND_STRING_9_MASK                      0xFFFFFFFF
-#define CPUID_EAX_PROCESSOR_BRAND_STRING_9(_)                        (((_) >> 0) & 0xFFFFFFFF)
+#define CPUID_EAX_80000004_EAX_PROCESSOR_BRAND_STRING_9_BIT          0
+#define CPUID_EAX_80000004_EAX_PROCESSOR_BRAND_STRING_9_FLAG         0xFFFFFFFF
+#define CPUID_EAX_80000004_EAX_PROCESSOR_BRAND_STRING_9_MASK         0xFFFFFFFF
+#define CPUID_EAX_80000004_EAX_PROCESSOR_BRAND_STRING_9(_)           (((_) >> 0) & 0xFFFFFFFF)
     };
 
     uint32_t flags;
   } eax;
+#define CPUID_EAX_80000004_EAX_RESERVED_BITS                         0x00
 
   union
   {
@@ -6919,14 +7586,15 @@ typedef struct
        * [Bits 31:0] Processor Brand String Continued.
        */
       uint32_t processor_brand_string_10                             : 32;
-#define CPUID_EBX_PROCESSOR_BRAND_STRING_10_BIT                      0
-#define CPUID_EBX_PROCESSOR_BRAND_STRING_10_FLAG                     0xFFFFFFFF
-#define CPUID_EBX_PROCESSOR_BRAND_STRING_10_MASK                     0xFFFFFFFF
-#define CPUID_EBX_PROCESSOR_BRAND_STRING_10(_)                       (((_) >> 0) & 0xFFFFFFFF)
+#define CPUID_EAX_80000004_EBX_PROCESSOR_BRAND_STRING_10_BIT         0
+#define CPUID_EAX_80000004_EBX_PROCESSOR_BRAND_STRING_10_FLAG        0xFFFFFFFF
+#define CPUID_EAX_80000004_EBX_PROCESSOR_BRAND_STRING_10_MASK        0xFFFFFFFF
+#define CPUID_EAX_80000004_EBX_PROCESSOR_BRAND_STRING_10(_)          (((_) >> 0) & 0xFFFFFFFF)
     };
 
     uint32_t flags;
   } ebx;
+#define CPUID_EAX_80000004_EBX_RESERVED_BITS                         0x00
 
   union
   {
@@ -6936,14 +7604,15 @@ typedef struct
        * [Bits 31:0] Processor Brand String Continued.
        */
       uint32_t processor_brand_string_11                             : 32;
-#define CPUID_ECX_PROCESSOR_BRAND_STRING_11_BIT                      0
-#define CPUID_ECX_PROCESSOR_BRAND_STRING_11_FLAG                     0xFFFFFFFF
-#define CPUID_ECX_PROCESSOR_BRAND_STRING_11_MASK                     0xFFFFFFFF
-#define CPUID_ECX_PROCESSOR_BRAND_STRING_11(_)                       (((_) >> 0) & 0xFFFFFFFF)
+#define CPUID_EAX_80000004_ECX_PROCESSOR_BRAND_STRING_11_BIT         0
+#define CPUID_EAX_80000004_ECX_PROCESSOR_BRAND_STRING_11_FLAG        0xFFFFFFFF
+#define CPUID_EAX_80000004_ECX_PROCESSOR_BRAND_STRING_11_MASK        0xFFFFFFFF
+#define CPUID_EAX_80000004_ECX_PROCESSOR_BRAND_STRING_11(_)          (((_) >> 0) & 0xFFFFFFFF)
     };
 
     uint32_t flags;
   } ecx;
+#define CPUID_EAX_80000004_ECX_RESERVED_BITS                         0x00
 
   union
   {
@@ -6953,16 +7622,26 @@ typedef struct
        * [Bits 31:0] Processor Brand String Continued.
        */
       uint32_t processor_brand_string_12                             : 32;
-#define CPUID_EDX_PROCESSOR_BRAND_STRING_12_BIT                      0
-#define CPUID_EDX_PROCESSOR_BRAND_STRING_12_FLAG                     0xFFFFFFFF
-#define CPUID_EDX_PROCESSOR_BRAND_STRING_12_MASK                     0xFFFFFFFF
-#define CPUID_EDX_PROCESSOR_BRAND_STRING_12(_)                       (((_) >> 0) & 0xFFFFFFFF)
+#define CPUID_EAX_80000004_EDX_PROCESSOR_BRAND_STRING_12_BIT         0
+#define CPUID_EAX_80000004_EDX_PROCESSOR_BRAND_STRING_12_FLAG        0xFFFFFFFF
+#define CPUID_EAX_80000004_EDX_PROCESSOR_BRAND_STRING_12_MASK        0xFFFFFFFF
+#define CPUID_EAX_80000004_EDX_PROCESSOR_BRAND_STRING_12(_)          (((_) >> 0) & 0xFFFFFFFF)
     };
 
     uint32_t flags;
   } edx;
+#define CPUID_EAX_80000004_EDX_RESERVED_BITS                         0x00
 
 } cpuid_eax_80000004;
+#define CPUID_EAX_80000004_SNAPSHOT_INDEX                            28
+#define CPUID_EAX_80000004_EAX_POLICY_AND                            0xFFFFFFFF
+#define CPUID_EAX_80000004_EAX_POLICY_OR                             0x00000000
+#define CPUID_EAX_80000004_EBX_POLICY_AND                            0xFFFFFFFF
+#define CPUID_EAX_80000004_EBX_POLICY_OR                             0x00000000
+#define CPUID_EAX_80000004_ECX_POLICY_AND                            0xFFFFFFFF
+#define CPUID_EAX_80000004_ECX_POLICY_OR                             0x00000000
+#define CPUID_EAX_80000004_EDX_POLICY_AND                            0xFFFFFFFF
+#define CPUID_EAX_80000004_EDX_POLICY_OR                             0x00000000
 
 /**
  * @brief Extended Function CPUID Information
@@ -6977,14 +7656,15 @@ typedef struct
        * [Bits 31:0] EAX is reserved.
        */
       uint32_t reserved                                              : 32;
-#define CPUID_EAX_RESERVED_BIT                                       0
-#define CPUID_EAX_RESERVED_FLAG                                      0xFFFFFFFF
-#define CPUID_EAX_RESERVED_MASK                                      0xFFFFFFFF
-#define CPUID_EAX_RESERVED(_)                                        (((_) >> 0) & 0xFFFFFFFF)
+#define CPUID_EAX_80000005_EAX_RESERVED_BIT                          0
+#define CPUID_EAX_80000005_EAX_RESERVED_FLAG                         0xFFFFFFFF
+#define CPUID_EAX_80000005_EAX_RESERVED_MASK                         0xFFFFFFFF
+#define CPUID_EAX_80000005_EAX_RESERVED(_)                           (((_) >> 0) & 0xFFFFFFFF)
     };
 
     uint32_t flags;
   } eax;
+#define CPUID_EAX_80000005_EAX_RESERVED_BITS                         0xFFFFFFFF
 
   union
   {
@@ -6994,14 +7674,15 @@ typedef struct
        * [Bits 31:0] EBX is reserved.
        */
       uint32_t reserved                                              : 32;
-#define CPUID_EBX_RESERVED_BIT                                       0
-#define CPUID_EBX_RESERVED_FLAG                                      0xFFFFFFFF
-#define CPUID_EBX_RESERVED_MASK                                      0xFFFFFFFF
-#define CPUID_EBX_RESERVED(_)                                        (((_) >> 0) & 0xFFFFFFFF)
+#define CPUID_EAX_80000005_EBX_RESERVED_BIT                          0
+#define CPUID_EAX_80000005_EBX_RESERVED_FLAG                         0xFFFFFFFF
+#define CPUID_EAX_80000005_EBX_RESERVED_MASK                         0xFFFFFFFF
+#define CPUID_EAX_80000005_EBX_RESERVED(_)                           (((_) >> 0) & 0xFFFFFFFF)
     };
 
     uint32_t flags;
   } ebx;
+#define CPUID_EAX_80000005_EBX_RESERVED_BITS                         0xFFFFFFFF
 
   union
   {
@@ -7011,14 +7692,15 @@ typedef struct
        * [Bits 31:0] ECX is reserved.
        */
       uint32_t reserved                                              : 32;
-#define CPUID_ECX_RESERVED_BIT                                       0
-#define CPUID_ECX_RESERVED_FLAG                                      0xFFFFFFFF
-#define CPUID_ECX_RESERVED_MASK                                      0xFFFFFFFF
-#define CPUID_ECX_RESERVED(_)                                        (((_) >> 0) & 0xFFFFFFFF)
+#define CPUID_EAX_80000005_ECX_RESERVED_BIT                          0
+#define CPUID_EAX_80000005_ECX_RESERVED_FLAG                         0xFFFFFFFF
+#define CPUID_EAX_80000005_ECX_RESERVED_MASK                         0xFFFFFFFF
+#define CPUID_EAX_80000005_ECX_RESERVED(_)                           (((_) >> 0) & 0xFFFFFFFF)
     };
 
     uint32_t flags;
   } ecx;
+#define CPUID_EAX_80000005_ECX_RESERVED_BITS                         0xFFFFFFFF
 
   union
   {
@@ -7028,16 +7710,26 @@ typedef struct
        * [Bits 31:0] EDX is reserved.
        */
       uint32_t reserved                                              : 32;
-#define CPUID_EDX_RESERVED_BIT                                       0
-#define CPUID_EDX_RESERVED_FLAG                                      0xFFFFFFFF
-#define CPUID_EDX_RESERVED_MASK                                      0xFFFFFFFF
-#define CPUID_EDX_RESERVED(_)                                        (((_) >> 0) & 0xFFFFFFFF)
+#define CPUID_EAX_80000005_EDX_RESERVED_BIT                          0
+#define CPUID_EAX_80000005_EDX_RESERVED_FLAG                         0xFFFFFFFF
+#define CPUID_EAX_80000005_EDX_RESERVED_MASK                         0xFFFFFFFF
+#define CPUID_EAX_80000005_EDX_RESERVED(_)                           (((_) >> 0) & 0xFFFFFFFF)
     };
 
     uint32_t flags;
   } edx;
+#define CPUID_EAX_80000005_EDX_RESERVED_BITS                         0xFFFFFFFF
 
 } cpuid_eax_80000005;
+#define CPUID_EAX_80000005_SNAPSHOT_INDEX                            29
+#define CPUID_EAX_80000005_EAX_POLICY_AND                            0x00000000
+#define CPUID_EAX_80000005_EAX_POLICY_OR                             0x00000000
+#define CPUID_EAX_80000005_EBX_POLICY_AND                            0x00000000
+#define CPUID_EAX_80000005_EBX_POLICY_OR                             0x00000000
+#define CPUID_EAX_80000005_ECX_POLICY_AND                            0x00000000
+#define CPUID_EAX_80000005_ECX_POLICY_OR                             0x00000000
+#define CPUID_EAX_80000005_EDX_POLICY_AND                            0x00000000
+#define CPUID_EAX_80000005_EDX_POLICY_OR                             0x00000000
 
 
 /**
@@ -7054,14 +7746,15 @@ typedef struct
        * [Bits 31:0] EAX is reserved.
        */
       uint32_t reserved                                              : 32;
-#define CPUID_EAX_RESERVED_BIT                                       0
-#define CPUID_EAX_RESERVED_FLAG                                      0xFFFFFFFF
-#define CPUID_EAX_RESERVED_MASK                                      0xFFFFFFFF
-#define CPUID_EAX_RESERVED(_)                                        (((_) >> 0) & 0xFFFFFFFF)
+#define CPUID_EAX_80000006_EAX_RESERVED_BIT                          0
+#define CPUID_EAX_80000006_EAX_RESERVED_FLAG                         0xFFFFFFFF
+#define CPUID_EAX_80000006_EAX_RESERVED_MASK                         0xFFFFFFFF
+#define CPUID_EAX_80000006_EAX_RESERVED(_)                           (((_) >> 0) & 0xFFFFFFFF)
     };
 
     uint32_t flags;
   } eax;
+#define CPUID_EAX_80000006_EAX_RESERVED_BITS                         0xFFFFFFFF
 
   union
   {
@@ -7071,14 +7764,15 @@ typedef struct
        * [Bits 31:0] EBX is reserved.
        */
       uint32_t reserved                                              : 32;
-#define CPUID_EBX_RESERVED_BIT                                       0
-#define CPUID_EBX_RESERVED_FLAG                                      0xFFFFFFFF
-#define CPUID_EBX_RESERVED_MASK                                      0xFFFFFFFF
-#define CPUID_EBX_RESERVED(_)                                        (((_) >> 0) & 0xFFFFFFFF)
+#define CPUID_EAX_80000006_EBX_RESERVED_BIT                          0
+#define CPUID_EAX_80000006_EBX_RESERVED_FLAG                         0xFFFFFFFF
+#define CPUID_EAX_80000006_EBX_RESERVED_MASK                         0xFFFFFFFF
+#define CPUID_EAX_80000006_EBX_RESERVED(_)                           (((_) >> 0) & 0xFFFFFFFF)
     };
 
     uint32_t flags;
   } ebx;
+#define CPUID_EAX_80000006_EBX_RESERVED_BITS                         0xFFFFFFFF
 
   union
   {
@@ -7088,10 +7782,10 @@ typedef struct
        * [Bits 7:0] Cache Line size in bytes.
        */
       uint32_t cache_line_size_in_bytes                              : 8;
-#define CPUID_ECX_CACHE_LINE_SIZE_IN_BYTES_BIT                       0
-#define CPUID_ECX_CACHE_LINE_SIZE_IN_BYTES_FLAG                      0xFF
-#define CPUID_ECX_CACHE_LINE_SIZE_IN_BYTES_MASK                      0xFF
-#define CPUID_ECX_CACHE_LINE_SIZE_IN_BYTES(_)                        (((_) >> 0) & 0xFF)
+#define CPUID_EAX_80000006_ECX_CACHE_LINE_SIZE_IN_BYTES_BIT          0
+#define CPUID_EAX_80000006_ECX_CACHE_LINE_SIZE_IN_BYTES_FLAG         0xFF
+#define CPUID_EAX_80000006_ECX_CACHE_LINE_SIZE_IN_BYTES_MASK         0xFF
+#define CPUID_EAX_80000006_ECX_CACHE_LINE_SIZE_IN_BYTES(_)           (((_) >> 0) & 0xFF)
       uint32_t reserved1                                             : 4;
 
       /**
@@ -7106,23 +7800,24 @@ typedef struct
        * - 0FH - Fully associative.
        */
       uint32_t l2_associativity_field                                : 4;
-#define CPUID_ECX_L2_ASSOCIATIVITY_FIELD_BIT                         12
-#define CPUID_ECX_L2_ASSOCIATIVITY_FIELD_FLAG                        0xF000
-#define CPUID_ECX_L2_ASSOCIATIVITY_FIELD_MASK                        0x0F
-#define CPUID_ECX_L2_ASSOCIATIVITY_FIELD(_)                          (((_) >> 12) & 0x0F)
+#define CPUID_EAX_80000006_ECX_L2_ASSOCIATIVITY_FIELD_BIT            12
+#define CPUID_EAX_80000006_ECX_L2_ASSOCIATIVITY_FIELD_FLAG           0xF000
+#define CPUID_EAX_80000006_ECX_L2_ASSOCIATIVITY_FIELD_MASK           0x0F
+#define CPUID_EAX_80000006_ECX_L2_ASSOCIATIVITY_FIELD(_)             (((_) >> 12) & 0x0F)
 
       /**
        * [Bits 31:16] Cache size in 1K units.
        */
       uint32_t cache_size_in_1k_units                                : 16;
-#define CPUID_ECX_CACHE_SIZE_IN_1K_UNITS_BIT                         16
-#define CPUID_ECX_CACHE_SIZE_IN_1K_UNITS_FLAG                        0xFFFF0000
-#define CPUID_ECX_CACHE_SIZE_IN_1K_UNITS_MASK                        0xFFFF
-#define CPUID_ECX_CACHE_SIZE_IN_1K_UNITS(_)                          (((_) >> 16) & 0xFFFF)
+#define CPUID_EAX_80000006_ECX_CACHE_SIZE_IN_1K_UNITS_BIT            16
+#define CPUID_EAX_80000006_ECX_CACHE_SIZE_IN_1K_UNITS_FLAG           0xFFFF0000
+#define CPUID_EAX_80000006_ECX_CACHE_SIZE_IN_1K_UNITS_MASK           0xFFFF
+#define CPUID_EAX_80000006_ECX_CACHE_SIZE_IN_1K_UNITS(_)             (((_) >> 16) & 0xFFFF)
     };
 
     uint32_t flags;
   } ecx;
+#define CPUID_EAX_80000006_ECX_RESERVED_BITS                         0xF00
 
   union
   {
@@ -7132,16 +7827,26 @@ typedef struct
        * [Bits 31:0] EDX is reserved.
        */
       uint32_t reserved                                              : 32;
-#define CPUID_EDX_RESERVED_BIT                                       0
-#define CPUID_EDX_RESERVED_FLAG                                      0xFFFFFFFF
-#define CPUID_EDX_RESERVED_MASK                                      0xFFFFFFFF
-#define CPUID_EDX_RESERVED(_)                                        (((_) >> 0) & 0xFFFFFFFF)
+#define CPUID_EAX_80000006_EDX_RESERVED_BIT                          0
+#define CPUID_EAX_80000006_EDX_RESERVED_FLAG                         0xFFFFFFFF
+#define CPUID_EAX_80000006_EDX_RESERVED_MASK                         0xFFFFFFFF
+#define CPUID_EAX_80000006_EDX_RESERVED(_)                           (((_) >> 0) & 0xFFFFFFFF)
     };
 
     uint32_t flags;
   } edx;
+#define CPUID_EAX_80000006_EDX_RESERVED_BITS                         0xFFFFFFFF
 
 } cpuid_eax_80000006;
+#define CPUID_EAX_80000006_SNAPSHOT_INDEX                            30
+#define CPUID_EAX_80000006_EAX_POLICY_AND                            0x00000000
+#define CPUID_EAX_80000006_EAX_POLICY_OR                             0x00000000
+#define CPUID_EAX_80000006_EBX_POLICY_AND                            0x00000000
+#define CPUID_EAX_80000006_EBX_POLICY_OR                             0x00000000
+#define CPUID_EAX_80000006_ECX_POLICY_AND                            0xFFFFF0FF
+#define CPUID_EAX_80000006_ECX_POLICY_OR                             0x00000000
+#define CPUID_EAX_80000006_EDX_POLICY_AND                            0x00000000
+#define CPUID_EAX_80000006_EDX_POLICY_OR                             0x00000000
 
 
 /**
@@ -7158,14 +7863,15 @@ typedef struct
        * [Bits 31:0] EAX is reserved.
        */
       uint32_t reserved                                              : 32;
-#define CPUID_EAX_RESERVED_BIT                                       0
-#define CPUID_EAX_RESERVED_FLAG                                      0xFFFFFFFF
-#define CPUID_EAX_RESERVED_MASK                                      0xFFFFFFFF
-#define CPUID_EAX_RESERVED(_)                                        (((_) >> 0) & 0xFFFFFFFF)
+#define CPUID_EAX_80000007_EAX_RESERVED_BIT                          0
+#define CPUID_EAX_80000007_EAX_RESERVED_FLAG                         0xFFFFFFFF
+#define CPUID_EAX_80000007_EAX_RESERVED_MASK                         0xFFFFFFFF
+#define CPUID_EAX_80000007_EAX_RESERVED(_)                           (((_) >> 0) & 0xFFFFFFFF)
     };
 
     uint32_t flags;
   } eax;
+#define CPUID_EAX_80000007_EAX_RESERVED_BITS                         0xFFFFFFFF
 
   union
   {
@@ -7175,14 +7881,15 @@ typedef struct
        * [Bits 31:0] EBX is reserved.
        */
       uint32_t reserved                                              : 32;
-#define CPUID_EBX_RESERVED_BIT                                       0
-#define CPUID_EBX_RESERVED_FLAG                                      0xFFFFFFFF
-#define CPUID_EBX_RESERVED_MASK                                      0xFFFFFFFF
-#define CPUID_EBX_RESERVED(_)                                        (((_) >> 0) & 0xFFFFFFFF)
+#define CPUID_EAX_80000007_EBX_RESERVED_BIT                          0
+#define CPUID_EAX_80000007_EBX_RESERVED_FLAG                         0xFFFFFFFF
+#define CPUID_EAX_80000007_EBX_RESERVED_MASK                         0xFFFFFFFF
+#define CPUID_EAX_80000007_EBX_RESERVED(_)                           (((_) >> 0) & 0xFFFFFFFF)
     };
 
     uint32_t flags;
   } ebx;
+#define CPUID_EAX_80000007_EBX_RESERVED_BITS                         0xFFFFFFFF
 
   union
   {
@@ -7192,14 +7899,15 @@ typedef struct
        * [Bits 31:0] ECX is reserved.
        */
       uint32_t reserved                                              : 32;
-#define CPUID_ECX_RESERVED_BIT                                       0
-#define CPUID_ECX_RESERVED_FLAG                                      0xFFFFFFFF
-#define CPUID_ECX_RESERVED_MASK                                      0xFFFFFFFF
-#define CPUID_ECX_RESERVED(_)                                        (((_) >> 0) & 0xFFFFFFFF)
+#define CPUID_EAX_80000007_ECX_RESERVED_BIT                          0
+#define CPUID_EAX_80000007_ECX_RESERVED_FLAG                         0xFFFFFFFF
+#define CPUID_EAX_80000007_ECX_RESERVED_MASK                         0xFFFFFFFF
+#define CPUID_EAX_80000007_ECX_RESERVED(_)                           (((_) >> 0) & 0xFFFFFFFF)
     };
 
     uint32_t flags;
   } ecx;
+#define CPUID_EAX_80000007_ECX_RESERVED_BITS                         0xFFFFFFFF
 
   union
   {
@@ -7211,17 +7919,28 @@ typedef struct
        * [Bit 8] Invariant TSC available if 1.
        */
       uint32_t invariant_tsc_available                               : 1;
-#define CPUID_EDX_INVARIANT_TSC_AVAILABLE_BIT                        8
-#define CPUID_EDX_INVARIANT_TSC_AVAILABLE_FLAG                       0x100
-#define CPUID_EDX_INVARIANT_TSC_AVAILABLE_MASK                       0x01
-#define CPUID_EDX_INVARIANT_TSC_AVAILABLE(_)                         (((_) >> 8) & 0x01)
+#define CPUID_EAX_80000007_EDX_INVARIANT_TSC_AVAILABLE_BIT           8
+#define CPUID_EAX_80000007_EDX_INVARIANT_TSC_AVAILABLE_FLAG          0x100
+#define CPUID_EAX_80000007_EDX_INVARIANT_TSC_AVAILABLE_MASK          0x01
+#define CPUID_EAX_80000007_EDX_INVARIANT_TSC_AVAILABLE(_)            (((_) >> 8) & 0x01)
+#define CPUID_EAX_80000007_EDX_INVARIANT_TSC_AVAILABLE_FEATURE       4072
       uint32_t reserved2                                             : 23;
     };
 
     uint32_t flags;
   } edx;
+#define CPUID_EAX_80000007_EDX_RESERVED_BITS                         0xFFFFFEFF
 
 } cpuid_eax_80000007;
+#define CPUID_EAX_80000007_SNAPSHOT_INDEX                            31
+#define CPUID_EAX_80000007_EAX_POLICY_AND                            0x00000000
+#define CPUID_EAX_80000007_EAX_POLICY_OR                             0x00000000
+#define CPUID_EAX_80000007_EBX_POLICY_AND                            0x00000000
+#define CPUID_EAX_80000007_EBX_POLICY_OR                             0x00000000
+#define CPUID_EAX_80000007_ECX_POLICY_AND                            0x00000000
+#define CPUID_EAX_80000007_ECX_POLICY_OR                             0x00000000
+#define CPUID_EAX_80000007_EDX_POLICY_AND                            0x00000100
+#define CPUID_EAX_80000007_EDX_POLICY_OR                             0x00000000
 
 
 /**
@@ -7241,24 +7960,25 @@ typedef struct
        * [Bits 7:0] Number of Physical Address Bits.
        */
       uint32_t number_of_physical_address_bits                       : 8;
-#define CPUID_EAX_NUMBER_OF_PHYSICAL_ADDRESS_BITS_BIT                0
-#define CPUID_EAX_NUMBER_OF_PHYSICAL_ADDRESS_BITS_FLAG               0xFF
-#define CPUID_EAX_NUMBER_OF_PHYSICAL_ADDRESS_BITS_MASK               0xFF
-#define CPUID_EAX_NUMBER_OF_PHYSICAL_ADDRESS_BITS(_)                 (((_) >> 0) & 0xFF)
+#define CPUID_EAX_80000008_EAX_NUMBER_OF_PHYSICAL_ADDRESS_BITS_BIT   0
+#define CPUID_EAX_80000008_EAX_NUMBER_OF_PHYSICAL_ADDRESS_BITS_FLAG  0xFF
+#define CPUID_EAX_80000008_EAX_NUMBER_OF_PHYSICAL_ADDRESS_BITS_MASK  0xFF
+#define CPUID_EAX_80000008_EAX_NUMBER_OF_PHYSICAL_ADDRESS_BITS(_)    (((_) >> 0) & 0xFF)
 
       /**
        * [Bits 15:8] Number of Linear Address Bits.
        */
       uint32_t number_of_linear_address_bits                         : 8;
-#define CPUID_EAX_NUMBER_OF_LINEAR_ADDRESS_BITS_BIT                  8
-#define CPUID_EAX_NUMBER_OF_LINEAR_ADDRESS_BITS_FLAG                 0xFF00
-#define CPUID_EAX_NUMBER_OF_LINEAR_ADDRESS_BITS_MASK                 0xFF
-#define CPUID_EAX_NUMBER_OF_LINEAR_ADDRESS_BITS(_)                   (((_) >> 8) & 0xFF)
+#define CPUID_EAX_80000008_EAX_NUMBER_OF_LINEAR_ADDRESS_BITS_BIT     8
+#define CPUID_EAX_80000008_EAX_NUMBER_OF_LINEAR_ADDRESS_BITS_FLAG    0xFF00
+#define CPUID_EAX_80000008_EAX_NUMBER_OF_LINEAR_ADDRESS_BITS_MASK    0xFF
+#define CPUID_EAX_80000008_EAX_NUMBER_OF_LINEAR_ADDRESS_BITS(_)      (((_) >> 8) & 0xFF)
       uint32_t reserved1                                             : 16;
     };
 
     uint32_t flags;
   } eax;
+#define CPUID_EAX_80000008_EAX_RESERVED_BITS                         0xFFFF0000
 
   union
   {
@@ -7268,14 +7988,15 @@ typedef struct
        * [Bits 31:0] EBX is reserved.
        */
       uint32_t reserved                                              : 32;
-#define CPUID_EBX_RESERVED_BIT                                       0
-#define CPUID_EBX_RESERVED_FLAG                                      0xFFFFFFFF
-#define CPUID_EBX_RESERVED_MASK                                      0xFFFFFFFF
-#define CPUID_EBX_RESERVED(_)                                        (((_) >> 0) & 0xFFFFFFFF)
+#define CPUID_EAX_80000008_EBX_RESERVED_BIT                          0
+#define CPUID_EAX_80000008_EBX_RESERVED_FLAG                         0xFFFFFFFF
+#define CPUID_EAX_80000008_EBX_RESERVED_MASK                         0xFFFFFFFF
+#define CPUID_EAX_80000008_EBX_RESERVED(_)                           (((_) >> 0) & 0xFFFFFFFF)
     };
 
     uint32_t flags;
   } ebx;
+#define CPUID_EAX_80000008_EBX_RESERVED_BITS                         0xFFFFFFFF
 
   union
   {
@@ -7285,14 +8006,15 @@ typedef struct
        * [Bits 31:0] ECX is reserved.
        */
       uint32_t reserved                                              : 32;
-#define CPUID_ECX_RESERVED_BIT                                       0
-#define CPUID_ECX_RESERVED_FLAG                                      0xFFFFFFFF
-#define CPUID_ECX_RESERVED_MASK                                      0xFFFFFFFF
-#define CPUID_ECX_RESERVED(_)                                        (((_) >> 0) & 0xFFFFFFFF)
+#define CPUID_EAX_80000008_ECX_RESERVED_BIT                          0
+#define CPUID_EAX_80000008_ECX_RESERVED_FLAG                         0xFFFFFFFF
+#define CPUID_EAX_80000008_ECX_RESERVED_MASK                         0xFFFFFFFF
+#define CPUID_EAX_80000008_ECX_RESERVED(_)                           (((_) >> 0) & 0xFFFFFFFF)
     };
 
     uint32_t flags;
   } ecx;
+#define CPUID_EAX_80000008_ECX_RESERVED_BITS                         0xFFFFFFFF
 
   union
   {
@@ -7302,17 +8024,126 @@ typedef struct
        * [Bits 31:0] EDX is reserved.
        */
       uint32_t reserved                                              : 32;
-#define CPUID_EDX_RESERVED_BIT                                       0
-#define CPUID_EDX_RESERVED_FLAG                                      0xFFFFFFFF
-#define CPUID_EDX_RESERVED_MASK                                      0xFFFFFFFF
-#define CPUID_EDX_RESERVED(_)                                        (((_) >> 0) & 0xFFFFFFFF)
+#define CPUID_EAX_80000008_EDX_RESERVED_BIT                          0
+#define CPUID_EAX_80000008_EDX_RESERVED_FLAG                         0xFFFFFFFF
+#define CPUID_EAX_80000008_EDX_RESERVED_MASK                         0xFFFFFFFF
+#define CPUID_EAX_80000008_EDX_RESERVED(_)                           (((_) >> 0) & 0xFFFFFFFF)
     };
 
     uint32_t flags;
   } edx;
+#define CPUID_EAX_80000008_EDX_RESERVED_BITS                         0xFFFFFFFF
 
 } cpuid_eax_80000008;
-
+#define CPUID_EAX_80000008_SNAPSHOT_INDEX                            32
+#define CPUID_EAX_80000008_EAX_POLICY_AND                            0x0000FFFF
+#define CPUID_EAX_80000008_EAX_POLICY_OR                             0x00000000
+#define CPUID_EAX_80000008_EBX_POLICY_AND                            0x00000000
+#define CPUID_EAX_80000008_EBX_POLICY_OR                             0x00000000
+#define CPUID_EAX_80000008_ECX_POLICY_AND                            0x00000000
+#define CPUID_EAX_80000008_ECX_POLICY_OR                             0x00000000
+#define CPUID_EAX_80000008_EDX_POLICY_AND                            0x00000000
+#define CPUID_EAX_80000008_EDX_POLICY_OR                             0x00000000
+
+/**
+ * @brief Number of entries in the CPUID_SNAPSHOT table
+ */
+#define CPUID_SNAPSHOT_COUNT                                         33
+
+/**
+ * @brief Initializer of { leaf, sub-leaf } pairs enumerated by the CPUID_SNAPSHOT table
+ *
+ * Entry n of the table holds EAX, EBX, ECX and EDX (in this order) returned by CPUID executed
+ * with the leaf and sub-leaf of entry n of this initializer.
+ */
+#define CPUID_SNAPSHOT_INITIALIZER                                   \
+{                                                                    \
+  { 0x00000000, 0x00000000 },                                        \
+  { 0x00000001, 0x00000000 },                                        \
+  { 0x00000005, 0x00000000 },                                        \
+  { 0x00000006, 0x00000000 },                                        \
+  { 0x00000007, 0x00000000 },                                        \
+  { 0x00000007, 0x00000001 },                                        \
+  { 0x00000009, 0x00000000 },                                        \
+  { 0x0000000A, 0x00000000 },                                        \
+  { 0x0000000D, 0x00000000 },                                        \
+  { 0x0000000D, 0x00000001 },                                        \
+  { 0x0000000F, 0x00000000 },                                        \
+  { 0x0000000F, 0x00000001 },                                        \
+  { 0x00000010, 0x00000000 },                                        \
+  { 0x00000010, 0x00000001 },                                        \
+  { 0x00000010, 0x00000002 },                                        \
+  { 0x00000010, 0x00000003 },                                        \
+  { 0x00000012, 0x00000000 },                                        \
+  { 0x00000012, 0x00000001 },                                        \
+  { 0x00000014, 0x00000000 },                                        \
+  { 0x00000014, 0x00000001 },                                        \
+  { 0x00000015, 0x00000000 },                                        \
+  { 0x00000016, 0x00000000 },                                        \
+  { 0x00000017, 0x00000000 },                                        \
+  { 0x00000018, 0x00000000 },                                        \
+  { 0x80000000, 0x00000000 },                                        \
+  { 0x80000001, 0x00000000 },                                        \
+  { 0x80000002, 0x00000000 },                                        \
+  { 0x80000003, 0x00000000 },                                        \
+  { 0x80000004, 0x00000000 },                                        \
+  { 0x80000005, 0x00000000 },                                        \
+  { 0x80000006, 0x00000000 },                                        \
+  { 0x80000007, 0x00000000 },                                        \
+  { 0x80000008, 0x00000000 },                                        \
+}
+
+/**
+ * @brief Tests *_FEATURE bit in the CPUID_SNAPSHOT table
+ *
+ * The table is an array of (CPUID_SNAPSHOT_COUNT * 4) 32-bit values.
+ */
+#define CPUID_SNAPSHOT_HAS_FEATURE(_, _feature)                      (((((const uint32_t *)(_))[(_feature) >> 5]) >> ((_feature) & 0x1F)) & 0x01)
+
+/**
+ * @brief Initializer of { AND, OR } policy masks of the CPUID_SNAPSHOT table
+ *
+ * Value of register r of entry n returned to the guest is:
+ * (table[n][r] & policy[n][0][r]) | policy[n][1][r]
+ * where table holds either values of CPUID executed on behalf of the guest or cached host
+ * values (in which case CPUID does not need to be executed at all).
+ */
+#define CPUID_SNAPSHOT_POLICY_INITIALIZER                            \
+{                                                                    \
+  { { 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF }, { 0x00000000, 0x00000000, 0x00000000, 0x00000000 } }, \
+  { { 0x0FFF3FFF, 0xFFFFFFFF, 0x7FFE760B, 0x1F8BFBFF }, { 0x00000000, 0x00000000, 0x00000000, 0x00000000 } }, \
+  { { 0x0000FFFF, 0x0000FFFF, 0x00000003, 0xFFFFFFFF }, { 0x00000000, 0x00000000, 0x00000000, 0x00000000 } }, \
+  { { 0x0097EFF7, 0x0000000F, 0x0000FF09, 0x00000000 }, { 0x00000000, 0x00000000, 0x00000000, 0x00000000 } }, \
+  { { 0xFFFFFFFF, 0xFFBFFFFB, 0x9AFF7FFF, 0xFC14C51C }, { 0x00000000, 0x00000000, 0x00000000, 0x00000000 } }, \
+  { { 0x4CEE1DF7, 0x0000000B, 0x00000003, 0x01CE4530 }, { 0x00000000, 0x00000000, 0x00000000, 0x00000000 } }, \
+  { { 0xFFFFFFFF, 0x00000000, 0x00000000, 0x00000000 }, { 0x00000000, 0x00000000, 0x00000000, 0x00000000 } }, \
+  { { 0xFFFFFFFF, 0x0000007F, 0x00000000, 0x00009FFF }, { 0x00000000, 0x00000000, 0x00000000, 0x00000000 } }, \
+  { { 0x000023FF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF }, { 0x00000000, 0x00000000, 0x00000000, 0x00000000 } }, \
+  { { 0x0000000E, 0xFFFFFFFF, 0x0001BBFF, 0xFFFFFFFF }, { 0x00000000, 0x00000000, 0x00000000, 0x00000000 } }, \
+  { { 0x00000000, 0xFFFFFFFF, 0x00000000, 0x00000002 }, { 0x00000000, 0x00000000, 0x00000000, 0x00000000 } }, \
+  { { 0x00000000, 0xFFFFFFFF, 0xFFFFFFFF, 0x00000007 }, { 0x00000000, 0x00000000, 0x00000000, 0x00000000 } }, \
+  { { 0xFFFFFFFF, 0x0000000E, 0x00000000, 0x00000000 }, { 0x00000000, 0x00000000, 0x00000000, 0x00000000 } }, \
+  { { 0x0000001F, 0xFFFFFFFF, 0x00000004, 0x0000FFFF }, { 0x00000000, 0x00000000, 0x00000000, 0x00000000 } }, \
+  { { 0x0000001F, 0xFFFFFFFF, 0x00000000, 0x0000FFFF }, { 0x00000000, 0x00000000, 0x00000000, 0x00000000 } }, \
+  { { 0x00000FFF, 0x00000000, 0x00000004, 0x0000FFFF }, { 0x00000000, 0x00000000, 0x00000000, 0x00000000 } }, \
+  { { 0x00000063, 0xFFFFFFFF, 0x00000000, 0x0000FFFF }, { 0x00000000, 0x00000000, 0x00000000, 0x00000000 } }, \
+  { { 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF }, { 0x00000000, 0x00000000, 0x00000000, 0x00000000 } }, \
+  { { 0xFFFFFFFF, 0x000001FF, 0x8000000F, 0x00000000 }, { 0x00000000, 0x00000000, 0x00000000, 0x00000000 } }, \
+  { { 0xFFFF0007, 0xFFFFFFFF, 0x00000000, 0x00000000 }, { 0x00000000, 0x00000000, 0x00000000, 0x00000000 } }, \
+  { { 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x00000000 }, { 0x00000000, 0x00000000, 0x00000000, 0x00000000 } }, \
+  { { 0x0000FFFF, 0x0000FFFF, 0x0000FFFF, 0x00000000 }, { 0x00000000, 0x00000000, 0x00000000, 0x00000000 } }, \
+  { { 0xFFFFFFFF, 0x0001FFFF, 0xFFFFFFFF, 0xFFFFFFFF }, { 0x00000000, 0x00000000, 0x00000000, 0x00000000 } }, \
+  { { 0xFFFFFFFF, 0xFFFF070F, 0xFFFFFFFF, 0x03FFC1FF }, { 0x00000000, 0x00000000, 0x00000000, 0x00000000 } }, \
+  { { 0xFFFFFFFF, 0x00000000, 0x00000000, 0x00000000 }, { 0x00000000, 0x00000000, 0x00000000, 0x00000000 } }, \
+  { { 0x00000000, 0x00000000, 0x00000121, 0x2C100800 }, { 0x00000000, 0x00000000, 0x00000000, 0x00000000 } }, \
+  { { 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF }, { 0x00000000, 0x00000000, 0x00000000, 0x00000000 } }, \
+  { { 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF }, { 0x00000000, 0x00000000, 0x00000000, 0x00000000 } }, \
+  { { 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF }, { 0x00000000, 0x00000000, 0x00000000, 0x00000000 } }, \
+  { { 0x00000000, 0x00000000, 0x00000000, 0x00000000 }, { 0x00000000, 0x00000000, 0x00000000, 0x00000000 } }, \
+  { { 0x00000000, 0x00000000, 0xFFFFF0FF, 0x00000000 }, { 0x00000000, 0x00000000, 0x00000000, 0x00000000 } }, \
+  { { 0x00000000, 0x00000000, 0x00000000, 0x00000100 }, { 0x00000000, 0x00000000, 0x00000000, 0x00000000 } }, \
+  { { 0x0000FFFF, 0x00000000, 0x00000000, 0x00000000 }, { 0x00000000, 0x00000000, 0x00000000, 0x00000000 } }, \
+}
 /**
  * @}
  */
@@ -7343,6 +8174,7 @@ typedef struct
  * @see Vol4[2.22(MSRS IN PENTIUM PROCESSORS)]
  */
 #define IA32_P5_MC_ADDR                                              0x00000000
+#define IA32_P5_MC_ADDR_SLOT                                         0
 
 /**
  * Machine-check exception type.
@@ -7351,6 +8183,7 @@ typedef struct
  * @see Vol4[2.22(MSRS IN PENTIUM PROCESSORS)]
  */
 #define IA32_P5_MC_TYPE                                              0x00000001
+#define IA32_P5_MC_TYPE_SLOT                                         271
 /**
  * @}
  */
@@ -7363,6 +8196,7 @@ typedef struct
  * @see Vol3A[8.10.5(Monitor/Mwait Address Range Determination)] (reference)
  */
 #define IA32_MONITOR_FILTER_LINE_SIZE                                0x00000006
+#define IA32_MONITOR_FILTER_LINE_SIZE_SLOT                           95
 
 /**
  * Value as returned by instruction RDTSC.
@@ -7371,6 +8205,7 @@ typedef struct
  * @see Vol3B[17.17(TIME-STAMP COUNTER)]
  */
 #define IA32_TIME_STAMP_COUNTER                                      0x00000010
+#define IA32_TIME_STAMP_COUNTER_SLOT                                 250
 
 /**
  * The operating system can use this MSR to determine "slot" information for the processor and the proper microcode update
@@ -7379,6 +8214,7 @@ typedef struct
  * @remarks 06_01H
  */
 #define IA32_PLATFORM_ID                                             0x00000017
+#define IA32_PLATFORM_ID_SLOT                                        109
 typedef union
 {
   struct
@@ -7412,6 +8248,7 @@ typedef union
 
   uint64_t flags;
 } ia32_platform_id_register;
+#define IA32_PLATFORM_ID_RESERVED_BITS                               0xFFE3FFFFFFFFFFFF
 
 
 /**
@@ -7422,6 +8259,7 @@ typedef union
  * @see Vol3A[10.4.5(Relocating the Local APIC Registers)]
  */
 #define IA32_APIC_BASE                                               0x0000001B
+#define IA32_APIC_BASE_SLOT                                          163
 typedef union
 {
   struct
@@ -7469,6 +8307,8 @@ typedef union
 
   uint64_t flags;
 } ia32_apic_base_register;
+#define IA32_APIC_BASE_RESERVED_BITS                                 0xFFF00000000002FF
+#define IA32_APIC_BASE_ADDRESS_BITS                                  0xFFFFFFFFFF000
 
 
 /**
@@ -7477,6 +8317,7 @@ typedef union
  * @remarks If any one enumeration condition for defined bit field holds.
  */
 #define IA32_FEATURE_CONTROL                                         0x0000003A
+#define IA32_FEATURE_CONTROL_SLOT                                    405
 typedef union
 {
   struct
@@ -7601,6 +8442,7 @@ typedef union
 
   uint64_t flags;
 } ia32_feature_control_register;
+#define IA32_FEATURE_CONTROL_RESERVED_BITS                           0xFFFFFFFFFFE900F8
 
 
 /**
@@ -7609,6 +8451,7 @@ typedef union
  * @remarks If CPUID.(EAX=07H, ECX=0H): EBX[1] = 1
  */
 #define IA32_TSC_ADJUST                                              0x0000003B
+#define IA32_TSC_ADJUST_SLOT                                         166
 typedef struct
 {
   /**
@@ -7627,6 +8470,7 @@ typedef struct
  * @remarks If any one of the enumeration conditions for defined bit field positions holds.
  */
 #define IA32_SPEC_CTRL                                               0x00000048
+#define IA32_SPEC_CTRL_SLOT                                          103
 typedef union
 {
   struct
@@ -7670,6 +8514,7 @@ typedef union
 
   uint64_t flags;
 } ia32_spec_ctrl_register;
+#define IA32_SPEC_CTRL_RESERVED_BITS                                 0xFFFFFFFFFFFFFFF8
 
 
 /**
@@ -7678,6 +8523,7 @@ typedef union
  * @remarks If any one of the enumeration conditions for defined bit field positions holds.
  */
 #define IA32_PRED_CMD                                                0x00000049
+#define IA32_PRED_CMD_SLOT                                           389
 typedef union
 {
   struct
@@ -7697,6 +8543,7 @@ typedef union
 
   uint64_t flags;
 } ia32_pred_cmd_register;
+#define IA32_PRED_CMD_RESERVED_BITS                                  0xFFFFFFFFFFFFFFFE
 
 
 /**
@@ -7709,6 +8556,7 @@ typedef union
  * @see Vol3A[9.11.6(Microcode Update Loader)]
  */
 #define IA32_BIOS_UPDATE_TRIGGER                                     0x00000079
+#define IA32_BIOS_UPDATE_TRIGGER_SLOT                                126
 
 /**
  * @brief BIOS Update Signature <b>(RO)</b>
@@ -7719,6 +8567,7 @@ typedef union
  * @remarks 06_01H
  */
 #define IA32_BIOS_UPDATE_SIGNATURE                                   0x0000008B
+#define IA32_BIOS_UPDATE_SIGNATURE_SLOT                              410
 typedef union
 {
   struct
@@ -7751,6 +8600,7 @@ typedef union
 
   uint64_t flags;
 } ia32_bios_update_signature_register;
+#define IA32_BIOS_UPDATE_SIGNATURE_RESERVED_BITS                     0x00
 
 /**
  * @defgroup ia32_sgxlepubkeyhash \
@@ -7764,9 +8614,13 @@ typedef union
  * @{
  */
 #define IA32_SGXLEPUBKEYHASH0                                        0x0000008C
+#define IA32_SGXLEPUBKEYHASH0_SLOT                                   170
 #define IA32_SGXLEPUBKEYHASH1                                        0x0000008D
+#define IA32_SGXLEPUBKEYHASH1_SLOT                                   435
 #define IA32_SGXLEPUBKEYHASH2                                        0x0000008E
+#define IA32_SGXLEPUBKEYHASH2_SLOT                                   200
 #define IA32_SGXLEPUBKEYHASH3                                        0x0000008F
+#define IA32_SGXLEPUBKEYHASH3_SLOT                                   472
 /**
  * @}
  */
@@ -7778,6 +8632,7 @@ typedef union
  * @remarks If CPUID.01H: ECX[5]=1 || CPUID.01H: ECX[6] = 1
  */
 #define IA32_SMM_MONITOR_CTL                                         0x0000009B
+#define IA32_SMM_MONITOR_CTL_SLOT                                    148
 typedef union
 {
   struct
@@ -7833,6 +8688,7 @@ typedef union
 
   uint64_t flags;
 } ia32_smm_monitor_ctl_register;
+#define IA32_SMM_MONITOR_CTL_RESERVED_BITS                           0xFFFFFFFF00000FFA
 
 typedef struct
 {
@@ -7883,6 +8739,7 @@ typedef struct
  * @remarks If IA32_VMX_MISC[15]
  */
 #define IA32_SMBASE                                                  0x0000009E
+#define IA32_SMBASE_SLOT                                             455
 /**
  * @defgroup ia32_pmc \
  *           IA32_PMC(n)
@@ -7893,13 +8750,58 @@ typedef struct
  * @{
  */
 #define IA32_PMC0                                                    0x000000C1
+#define IA32_PMC0_SLOT                                               241
 #define IA32_PMC1                                                    0x000000C2
+#define IA32_PMC1_SLOT                                               8
 #define IA32_PMC2                                                    0x000000C3
+#define IA32_PMC2_SLOT                                               256
 #define IA32_PMC3                                                    0x000000C4
+#define IA32_PMC3_SLOT                                               34
 #define IA32_PMC4                                                    0x000000C5
+#define IA32_PMC4_SLOT                                               309
 #define IA32_PMC5                                                    0x000000C6
+#define IA32_PMC5_SLOT                                               64
 #define IA32_PMC6                                                    0x000000C7
+#define IA32_PMC6_SLOT                                               336
 #define IA32_PMC7                                                    0x000000C8
+#define IA32_PMC7_SLOT                                               96
+/**
+ * @defgroup ia32_pmc_encoding \
+ *           General-purpose performance counter helpers
+ *
+ * General-purpose performance counter helpers.
+ * @{
+ */
+/**
+ * Mask of the bits implemented by general-purpose performance counters (CPUID.0AH:EAX[23:16] bits wide). _cpuid_eax is
+ * CPUID.0AH:EAX.
+ */
+#define IA32_PMC_WIDTH_MASK(_cpuid_eax)                              ((1ULL << (((_cpuid_eax) >> 16) & 0xFF)) - 1)
+
+/**
+ * 1 if a counter advanced from _previous to _ (by less than its range) has overflowed; 0 otherwise. _width_mask is
+ * IA32_PMC_WIDTH_MASK.
+ */
+#define IA32_PMC_OVERFLOWED(_, _previous, _width_mask)               (((_) & (_width_mask)) < ((_previous) & (_width_mask)))
+
+/**
+ * Address of IA32_PMC(_).
+ */
+#define IA32_PMC_MSR(_)                                              (0xC1 + (_))
+
+/**
+ * Index n of general-purpose performance counter with MSR address _msr.
+ */
+#define IA32_PMC_INDEX(_msr)                                         ((_msr) - 0xC1)
+
+/**
+ * 1 if _msr is the address of one of the first _count general-purpose performance counters; 0 otherwise.
+ */
+#define IA32_PMC_IN_RANGE(_msr, _count)                              (((_msr) >= 0xC1) & ((_msr) < 0xC1 + (_count)))
+/**
+ * @}
+ */
+
 /**
  * @}
  */
@@ -7911,6 +8813,7 @@ typedef struct
  * @remarks If CPUID.06H: ECX[0] = 1
  */
 #define IA32_MPERF                                                   0x000000E7
+#define IA32_MPERF_SLOT                                              342
 typedef struct
 {
   /**
@@ -7929,6 +8832,7 @@ typedef struct
  * @remarks If CPUID.06H: ECX[0] = 1
  */
 #define IA32_APERF                                                   0x000000E8
+#define IA32_APERF_SLOT                                              82
 typedef struct
 {
   /**
@@ -7948,6 +8852,7 @@ typedef struct
  * @see Vol3A[11.11.1(MTRR Feature Identification)] (reference)
  */
 #define IA32_MTRR_CAPABILITIES                                       0x000000FE
+#define IA32_MTRR_CAPABILITIES_SLOT                                  442
 typedef union
 {
   struct
@@ -8003,6 +8908,7 @@ typedef union
 
   uint64_t flags;
 } ia32_mtrr_capabilities_register;
+#define IA32_MTRR_CAPABILITIES_RESERVED_BITS                         0xFFFFFFFFFFFFF200
 
 
 /**
@@ -8011,6 +8917,7 @@ typedef union
  * @remarks If CPUID.(EAX=07H,ECX=0):EDX[29]=1
  */
 #define IA32_ARCH_CAPABILITIES                                       0x0000010A
+#define IA32_ARCH_CAPABILITIES_SLOT                                  118
 typedef union
 {
   struct
@@ -8102,6 +9009,7 @@ typedef union
 
   uint64_t flags;
 } ia32_arch_capabilities_register;
+#define IA32_ARCH_CAPABILITIES_RESERVED_BITS                         0xFFFFFFFFFFFFFE00
 
 
 /**
@@ -8110,6 +9018,7 @@ typedef union
  * @remarks If any one of the enumeration conditions for defined bit field positions holds.
  */
 #define IA32_FLUSH_CMD                                               0x0000010B
+#define IA32_FLUSH_CMD_SLOT                                          391
 typedef union
 {
   struct
@@ -8129,6 +9038,7 @@ typedef union
 
   uint64_t flags;
 } ia32_flush_cmd_register;
+#define IA32_FLUSH_CMD_RESERVED_BITS                                 0xFFFFFFFFFFFFFFFE
 
 
 /**
@@ -8138,6 +9048,7 @@ typedef union
  *          Available when CPUID.ARCH_CAP(EAX=7H,ECX = 0):EDX[29] = 1 and IA32_ARCH_CAPABILITIES.bit 7 = 1.
  */
 #define IA32_TSX_CTRL                                                0x00000122
+#define IA32_TSX_CTRL_SLOT                                           499
 typedef union
 {
   struct
@@ -8165,6 +9076,7 @@ typedef union
 
   uint64_t flags;
 } ia32_tsx_ctrl_register;
+#define IA32_TSX_CTRL_RESERVED_BITS                                  0xFFFFFFFFFFFFFFFC
 
 
 /**
@@ -8177,6 +9089,7 @@ typedef union
  * @see Vol2B[4.3(Instructions (M-U) | SYSCALL - Fast System Call)] (reference)
  */
 #define IA32_SYSENTER_CS                                             0x00000174
+#define IA32_SYSENTER_CS_SLOT                                        257
 typedef union
 {
   struct
@@ -8215,6 +9128,7 @@ typedef union
 
   uint64_t flags;
 } ia32_sysenter_cs_register;
+#define IA32_SYSENTER_CS_RESERVED_BITS                               0x00
 
 
 /**
@@ -8227,6 +9141,7 @@ typedef union
  * @see Vol2B[4.3(Instructions (M-U) | SYSCALL - Fast System Call)] (reference)
  */
 #define IA32_SYSENTER_ESP                                            0x00000175
+#define IA32_SYSENTER_ESP_SLOT                                       21
 
 /**
  * @brief SYSENTER_EIP_MSR <b>(R/W)</b>
@@ -8238,6 +9153,7 @@ typedef union
  * @see Vol2B[4.3(Instructions (M-U) | SYSCALL - Fast System Call)] (reference)
  */
 #define IA32_SYSENTER_EIP                                            0x00000176
+#define IA32_SYSENTER_EIP_SLOT                                       293
 
 /**
  * Global Machine Check Capability.
@@ -8245,6 +9161,7 @@ typedef union
  * @remarks 06_01H
  */
 #define IA32_MCG_CAP                                                 0x00000179
+#define IA32_MCG_CAP_SLOT                                            85
 typedef union
 {
   struct
@@ -8345,6 +9262,7 @@ typedef union
 
   uint64_t flags;
 } ia32_mcg_cap_register;
+#define IA32_MCG_CAP_RESERVED_BITS                                   0xFFFFFFFFF200F000
 
 
 /**
@@ -8353,6 +9271,7 @@ typedef union
  * @remarks 06_01H
  */
 #define IA32_MCG_STATUS                                              0x0000017A
+#define IA32_MCG_STATUS_SLOT                                         367
 typedef union
 {
   struct
@@ -8403,6 +9322,7 @@ typedef union
 
   uint64_t flags;
 } ia32_mcg_status_register;
+#define IA32_MCG_STATUS_RESERVED_BITS                                0xFFFFFFFFFFFFFFF0
 
 
 /**
@@ -8411,6 +9331,7 @@ typedef union
  * @remarks If IA32_MCG_CAP.CTL_P[8] = 1
  */
 #define IA32_MCG_CTL                                                 0x0000017B
+#define IA32_MCG_CTL_SLOT                                            117
 /**
  * @defgroup ia32_perfevtsel \
  *           IA32_PERFEVTSEL(n)
@@ -8421,9 +9342,13 @@ typedef union
  * @{
  */
 #define IA32_PERFEVTSEL0                                             0x00000186
+#define IA32_PERFEVTSEL0_SLOT                                        35
 #define IA32_PERFEVTSEL1                                             0x00000187
+#define IA32_PERFEVTSEL1_SLOT                                        307
 #define IA32_PERFEVTSEL2                                             0x00000188
+#define IA32_PERFEVTSEL2_SLOT                                        67
 #define IA32_PERFEVTSEL3                                             0x00000189
+#define IA32_PERFEVTSEL3_SLOT                                        338
 typedef union
 {
   struct
@@ -8534,6 +9459,88 @@ typedef union
 
   uint64_t flags;
 } ia32_perfevtsel_register;
+#define IA32_PERFEVTSEL_RESERVED_BITS                                0xFFFFFFFF00000000
+
+/**
+ * @defgroup ia32_perfevtsel_encoding \
+ *           Performance event select encoding
+ *
+ * Performance event select encoding.
+ *
+ * @remarks Architectural performance events are given as event select and unit mask (bits 15:0), ready to be combined with
+ *          IA32_PERFEVTSEL_ENCODE. Availability of architectural event n is enumerated by CPUID.0AH:EBX[n] = 0 (see
+ *          IA32_PERFEVTSEL_ARCHITECTURAL_EVENT_AVAILABLE).
+ * @see Vol3B[20.2.1.2(Pre-defined Architectural Performance Events)] (reference)
+ * @{
+ */
+/**
+ * UnHalted Core Cycles (architectural event 0).
+ */
+#define IA32_PERFEVTSEL_UNHALTED_CORE_CYCLES                         0x0000003C
+
+/**
+ * Instructions Retired (architectural event 1).
+ */
+#define IA32_PERFEVTSEL_INSTRUCTIONS_RETIRED                         0x000000C0
+
+/**
+ * UnHalted Reference Cycles (architectural event 2).
+ */
+#define IA32_PERFEVTSEL_UNHALTED_REFERENCE_CYCLES                    0x0000013C
+
+/**
+ * Last Level Cache References (architectural event 3).
+ */
+#define IA32_PERFEVTSEL_LLC_REFERENCE                                0x00004F2E
+
+/**
+ * Last Level Cache Misses (architectural event 4).
+ */
+#define IA32_PERFEVTSEL_LLC_MISSES                                   0x0000412E
+
+/**
+ * Branch Instructions Retired (architectural event 5).
+ */
+#define IA32_PERFEVTSEL_BRANCH_INSTRUCTIONS_RETIRED                  0x000000C4
+
+/**
+ * Branch Misses Retired (architectural event 6).
+ */
+#define IA32_PERFEVTSEL_BRANCH_MISSES_RETIRED                        0x000000C5
+
+/**
+ * Topdown Slots (architectural event 7).
+ */
+#define IA32_PERFEVTSEL_TOPDOWN_SLOTS                                0x000001A4
+
+/**
+ * 1 if architectural event _index is available; 0 otherwise. _ is CPUID.0AH:EBX, _cpuid_eax is CPUID.0AH:EAX.
+ */
+#define IA32_PERFEVTSEL_ARCHITECTURAL_EVENT_AVAILABLE(_, _cpuid_eax, _index) (((((_) >> (_index)) & 0x01) ^ 0x01) & ((((_cpuid_eax) >> 24) & 0xFF) > (_index)))
+
+/**
+ * Enabled performance event select value counting event _event (event select and unit mask) with counter mask _cmask.
+ * _flags holds the IA32_PERFEVTSEL_*_FLAG bits (USR, OS, EDGE, PC, INTR, ANY_THREAD, INV).
+ */
+#define IA32_PERFEVTSEL_ENCODE(_event, _cmask, _flags)               (((_event) & 0xFFFFULL) | (((_cmask) & 0xFFULL) << 24) | ((_flags) & 0xBF0000ULL) | 0x400000ULL)
+
+/**
+ * Address of IA32_PERFEVTSEL(_).
+ */
+#define IA32_PERFEVTSEL_MSR(_)                                       (0x186 + (_))
+
+/**
+ * Index n of performance event select register with MSR address _msr.
+ */
+#define IA32_PERFEVTSEL_INDEX(_msr)                                  ((_msr) - 0x186)
+
+/**
+ * 1 if _msr is the address of one of the first _count performance event select registers; 0 otherwise.
+ */
+#define IA32_PERFEVTSEL_IN_RANGE(_msr, _count)                       (((_msr) >= 0x186) & ((_msr) < 0x186 + (_count)))
+/**
+ * @}
+ */
 
 /**
  * @}
@@ -8547,6 +9554,7 @@ typedef union
  * @see Vol3B[14.1.1(Software Interface For Initiating Performance State Transitions)]
  */
 #define IA32_PERF_STATUS                                             0x00000198
+#define IA32_PERF_STATUS_SLOT                                        321
 typedef union
 {
   struct
@@ -8564,6 +9572,7 @@ typedef union
 
   uint64_t flags;
 } ia32_perf_status_register;
+#define IA32_PERF_STATUS_RESERVED_BITS                               0xFFFFFFFFFFFF0000
 
 
 /**
@@ -8575,6 +9584,7 @@ typedef union
  * @see Vol3B[14.1.1(Software Interface For Initiating Performance State Transitions)]
  */
 #define IA32_PERF_CTL                                                0x00000199
+#define IA32_PERF_CTL_SLOT                                           83
 typedef union
 {
   struct
@@ -8604,6 +9614,7 @@ typedef union
 
   uint64_t flags;
 } ia32_perf_ctl_register;
+#define IA32_PERF_CTL_RESERVED_BITS                                  0xFFFFFFFEFFFF0000
 
 
 /**
@@ -8613,6 +9624,7 @@ typedef union
  * @see Vol3B[14.7.3(Software Controlled Clock Modulation)]
  */
 #define IA32_CLOCK_MODULATION                                        0x0000019A
+#define IA32_CLOCK_MODULATION_SLOT                                   355
 typedef union
 {
   struct
@@ -8658,6 +9670,7 @@ typedef union
 
   uint64_t flags;
 } ia32_clock_modulation_register;
+#define IA32_CLOCK_MODULATION_RESERVED_BITS                          0xFFFFFFFFFFFFFFE0
 
 
 /**
@@ -8670,6 +9683,7 @@ typedef union
  * @see Vol3B[14.7.2(Thermal Monitor)]
  */
 #define IA32_THERM_INTERRUPT                                         0x0000019B
+#define IA32_THERM_INTERRUPT_SLOT                                    123
 typedef union
 {
   struct
@@ -8789,6 +9803,7 @@ typedef union
 
   uint64_t flags;
 } ia32_therm_interrupt_register;
+#define IA32_THERM_INTERRUPT_RESERVED_BITS                           0xFFFFFFFFFE0000E0
 
 
 /**
@@ -8801,6 +9816,7 @@ typedef union
  * @see Vol3B[14.7.2(Thermal Monitor)]
  */
 #define IA32_THERM_STATUS                                            0x0000019C
+#define IA32_THERM_STATUS_SLOT                                       383
 typedef union
 {
   struct
@@ -9019,6 +10035,7 @@ typedef union
 
   uint64_t flags;
 } ia32_therm_status_register;
+#define IA32_THERM_STATUS_RESERVED_BITS                              0xFFFFFFFF07800000
 
 
 /**
@@ -9027,6 +10044,7 @@ typedef union
  * Allows a variety of processor functions to be enabled and disabled.
  */
 #define IA32_MISC_ENABLE                                             0x000001A0
+#define IA32_MISC_ENABLE_SLOT                                        444
 typedef union
 {
   struct
@@ -9197,6 +10215,7 @@ typedef union
 
   uint64_t flags;
 } ia32_misc_enable_register;
+#define IA32_MISC_ENABLE_RESERVED_BITS                               0xFFFFFFFBFF3AE776
 
 
 /**
@@ -9205,6 +10224,7 @@ typedef union
  * @remarks If CPUID.6H:ECX[3] = 1
  */
 #define IA32_ENERGY_PERF_BIAS                                        0x000001B0
+#define IA32_ENERGY_PERF_BIAS_SLOT                                   190
 typedef union
 {
   struct
@@ -9225,6 +10245,7 @@ typedef union
 
   uint64_t flags;
 } ia32_energy_perf_bias_register;
+#define IA32_ENERGY_PERF_BIAS_RESERVED_BITS                          0xFFFFFFFFFFFFFFF0
 
 
 /**
@@ -9236,6 +10257,7 @@ typedef union
  * @see Vol3B[14.8(PACKAGE LEVEL THERMAL MANAGEMENT)]
  */
 #define IA32_PACKAGE_THERM_STATUS                                    0x000001B1
+#define IA32_PACKAGE_THERM_STATUS_SLOT                               463
 typedef union
 {
   struct
@@ -9362,6 +10384,7 @@ typedef union
 
   uint64_t flags;
 } ia32_package_therm_status_register;
+#define IA32_PACKAGE_THERM_STATUS_RESERVED_BITS                      0xFFFFFFFFFF80F000
 
 
 /**
@@ -9374,6 +10397,7 @@ typedef union
  * @see Vol3B[14.8(PACKAGE LEVEL THERMAL MANAGEMENT)]
  */
 #define IA32_PACKAGE_THERM_INTERRUPT                                 0x000001B2
+#define IA32_PACKAGE_THERM_INTERRUPT_SLOT                            218
 typedef union
 {
   struct
@@ -9465,6 +10489,7 @@ typedef union
 
   uint64_t flags;
 } ia32_package_therm_interrupt_register;
+#define IA32_PACKAGE_THERM_INTERRUPT_RESERVED_BITS                   0xFFFFFFFFFE0000E8
 
 
 /**
@@ -9473,6 +10498,7 @@ typedef union
  * @remarks 06_0EH
  */
 #define IA32_DEBUGCTL                                                0x000001D9
+#define IA32_DEBUGCTL_SLOT                                           70
 typedef union
 {
   struct
@@ -9617,6 +10643,7 @@ typedef union
 
   uint64_t flags;
 } ia32_debugctl_register;
+#define IA32_DEBUGCTL_RESERVED_BITS                                  0xFFFFFFFFFFFF003C
 
 
 /**
@@ -9627,6 +10654,7 @@ typedef union
  * @remarks If IA32_MTRRCAP.SMRR[11] = 1
  */
 #define IA32_SMRR_PHYSBASE                                           0x000001F2
+#define IA32_SMRR_PHYSBASE_SLOT                                      208
 typedef union
 {
   struct
@@ -9656,6 +10684,7 @@ typedef union
 
   uint64_t flags;
 } ia32_smrr_physbase_register;
+#define IA32_SMRR_PHYSBASE_RESERVED_BITS                             0xFFFFFFFF00000F00
 
 
 /**
@@ -9666,6 +10695,7 @@ typedef union
  * @remarks If IA32_MTRRCAP[SMRR] = 1
  */
 #define IA32_SMRR_PHYSMASK                                           0x000001F3
+#define IA32_SMRR_PHYSMASK_SLOT                                      482
 typedef union
 {
   struct
@@ -9694,6 +10724,7 @@ typedef union
 
   uint64_t flags;
 } ia32_smrr_physmask_register;
+#define IA32_SMRR_PHYSMASK_RESERVED_BITS                             0xFFFFFFFF000007FF
 
 
 /**
@@ -9702,6 +10733,7 @@ typedef union
  * @remarks If CPUID.01H: ECX[18] = 1
  */
 #define IA32_PLATFORM_DCA_CAP                                        0x000001F8
+#define IA32_PLATFORM_DCA_CAP_SLOT                                   305
 
 /**
  * If set, CPU supports Prefetch-Hint type.
@@ -9709,6 +10741,7 @@ typedef union
  * @remarks If CPUID.01H: ECX[18] = 1
  */
 #define IA32_CPU_DCA_CAP                                             0x000001F9
+#define IA32_CPU_DCA_CAP_SLOT                                        66
 
 /**
  * DCA type 0 Status and Control register.
@@ -9716,6 +10749,7 @@ typedef union
  * @remarks If CPUID.01H: ECX[18] = 1
  */
 #define IA32_DCA_0_CAP                                               0x000001FA
+#define IA32_DCA_0_CAP_SLOT                                          337
 typedef union
 {
   struct
@@ -9790,6 +10824,7 @@ typedef union
 
   uint64_t flags;
 } ia32_dca_0_cap_register;
+#define IA32_DCA_0_CAP_RESERVED_BITS                                 0xFFFFFFFFFAFE1800
 
 /**
  * @defgroup ia32_mtrr_physbase \
@@ -9830,17 +10865,29 @@ typedef union
 
   uint64_t flags;
 } ia32_mtrr_physbase_register;
+#define IA32_MTRR_PHYSBASE_RESERVED_BITS                             0xFFF0000000000F00
+#define IA32_MTRR_PHYSBASE_ADDRESS_BITS                              0xFFFFFFFFFF000
 
 #define IA32_MTRR_PHYSBASE0                                          0x00000200
+#define IA32_MTRR_PHYSBASE0_SLOT                                     437
 #define IA32_MTRR_PHYSBASE1                                          0x00000202
+#define IA32_MTRR_PHYSBASE1_SLOT                                     466
 #define IA32_MTRR_PHYSBASE2                                          0x00000204
+#define IA32_MTRR_PHYSBASE2_SLOT                                     494
 #define IA32_MTRR_PHYSBASE3                                          0x00000206
+#define IA32_MTRR_PHYSBASE3_SLOT                                     15
 #define IA32_MTRR_PHYSBASE4                                          0x00000208
+#define IA32_MTRR_PHYSBASE4_SLOT                                     47
 #define IA32_MTRR_PHYSBASE5                                          0x0000020A
+#define IA32_MTRR_PHYSBASE5_SLOT                                     78
 #define IA32_MTRR_PHYSBASE6                                          0x0000020C
+#define IA32_MTRR_PHYSBASE6_SLOT                                     111
 #define IA32_MTRR_PHYSBASE7                                          0x0000020E
+#define IA32_MTRR_PHYSBASE7_SLOT                                     142
 #define IA32_MTRR_PHYSBASE8                                          0x00000210
+#define IA32_MTRR_PHYSBASE8_SLOT                                     174
 #define IA32_MTRR_PHYSBASE9                                          0x00000212
+#define IA32_MTRR_PHYSBASE9_SLOT                                     205
 /**
  * @}
  */
@@ -9892,17 +10939,29 @@ typedef union
 
   uint64_t flags;
 } ia32_mtrr_physmask_register;
+#define IA32_MTRR_PHYSMASK_RESERVED_BITS                             0xFFF00000000007FF
+#define IA32_MTRR_PHYSMASK_ADDRESS_BITS                              0xFFFFFFFFFF000
 
 #define IA32_MTRR_PHYSMASK0                                          0x00000201
+#define IA32_MTRR_PHYSMASK0_SLOT                                     201
 #define IA32_MTRR_PHYSMASK1                                          0x00000203
+#define IA32_MTRR_PHYSMASK1_SLOT                                     221
 #define IA32_MTRR_PHYSMASK2                                          0x00000205
+#define IA32_MTRR_PHYSMASK2_SLOT                                     255
 #define IA32_MTRR_PHYSMASK3                                          0x00000207
+#define IA32_MTRR_PHYSMASK3_SLOT                                     285
 #define IA32_MTRR_PHYSMASK4                                          0x00000209
+#define IA32_MTRR_PHYSMASK4_SLOT                                     318
 #define IA32_MTRR_PHYSMASK5                                          0x0000020B
+#define IA32_MTRR_PHYSMASK5_SLOT                                     350
 #define IA32_MTRR_PHYSMASK6                                          0x0000020D
+#define IA32_MTRR_PHYSMASK6_SLOT                                     380
 #define IA32_MTRR_PHYSMASK7                                          0x0000020F
+#define IA32_MTRR_PHYSMASK7_SLOT                                     415
 #define IA32_MTRR_PHYSMASK8                                          0x00000211
+#define IA32_MTRR_PHYSMASK8_SLOT                                     445
 #define IA32_MTRR_PHYSMASK9                                          0x00000213
+#define IA32_MTRR_PHYSMASK9_SLOT                                     468
 /**
  * @}
  */
@@ -9927,6 +10986,7 @@ typedef union
 #define IA32_MTRR_FIX64K_BASE                                        0x00000000
 #define IA32_MTRR_FIX64K_SIZE                                        0x00010000
 #define IA32_MTRR_FIX64K_00000                                       0x00000250
+#define IA32_MTRR_FIX64K_00000_SLOT                                  162
 /**
  * @}
  */
@@ -9941,7 +11001,9 @@ typedef union
 #define IA32_MTRR_FIX16K_BASE                                        0x00080000
 #define IA32_MTRR_FIX16K_SIZE                                        0x00004000
 #define IA32_MTRR_FIX16K_80000                                       0x00000258
+#define IA32_MTRR_FIX16K_80000_SLOT                                  296
 #define IA32_MTRR_FIX16K_A0000                                       0x00000259
+#define IA32_MTRR_FIX16K_A0000_SLOT                                  50
 /**
  * @}
  */
@@ -9956,13 +11018,21 @@ typedef union
 #define IA32_MTRR_FIX4K_BASE                                         0x000C0000
 #define IA32_MTRR_FIX4K_SIZE                                         0x00001000
 #define IA32_MTRR_FIX4K_C0000                                        0x00000268
+#define IA32_MTRR_FIX4K_C0000_SLOT                                   38
 #define IA32_MTRR_FIX4K_C8000                                        0x00000269
+#define IA32_MTRR_FIX4K_C8000_SLOT                                   288
 #define IA32_MTRR_FIX4K_D0000                                        0x0000026A
+#define IA32_MTRR_FIX4K_D0000_SLOT                                   63
 #define IA32_MTRR_FIX4K_D8000                                        0x0000026B
+#define IA32_MTRR_FIX4K_D8000_SLOT                                   326
 #define IA32_MTRR_FIX4K_E0000                                        0x0000026C
+#define IA32_MTRR_FIX4K_E0000_SLOT                                   89
 #define IA32_MTRR_FIX4K_E8000                                        0x0000026D
+#define IA32_MTRR_FIX4K_E8000_SLOT                                   358
 #define IA32_MTRR_FIX4K_F0000                                        0x0000026E
+#define IA32_MTRR_FIX4K_F0000_SLOT                                   101
 #define IA32_MTRR_FIX4K_F8000                                        0x0000026F
+#define IA32_MTRR_FIX4K_F8000_SLOT                                   390
 /**
  * @}
  */
@@ -9994,6 +11064,7 @@ typedef union
  * @remarks If CPUID.01H: EDX.MTRR[16] = 1
  */
 #define IA32_PAT                                                     0x00000277
+#define IA32_PAT_SLOT                                                14
 typedef union
 {
   struct
@@ -10081,6 +11152,7 @@ typedef union
 
   uint64_t flags;
 } ia32_pat_register;
+#define IA32_PAT_RESERVED_BITS                                       0xF8F8F8F8F8F8F8F8
 
 /**
  * @defgroup ia32_mc_ctl2 \
@@ -10093,37 +11165,69 @@ typedef union
  * @{
  */
 #define IA32_MC0_CTL2                                                0x00000280
+#define IA32_MC0_CTL2_SLOT                                           404
 #define IA32_MC1_CTL2                                                0x00000281
+#define IA32_MC1_CTL2_SLOT                                           175
 #define IA32_MC2_CTL2                                                0x00000282
+#define IA32_MC2_CTL2_SLOT                                           441
 #define IA32_MC3_CTL2                                                0x00000283
+#define IA32_MC3_CTL2_SLOT                                           197
 #define IA32_MC4_CTL2                                                0x00000284
+#define IA32_MC4_CTL2_SLOT                                           473
 #define IA32_MC5_CTL2                                                0x00000285
+#define IA32_MC5_CTL2_SLOT                                           233
 #define IA32_MC6_CTL2                                                0x00000286
+#define IA32_MC6_CTL2_SLOT                                           506
 #define IA32_MC7_CTL2                                                0x00000287
+#define IA32_MC7_CTL2_SLOT                                           267
 #define IA32_MC8_CTL2                                                0x00000288
+#define IA32_MC8_CTL2_SLOT                                           27
 #define IA32_MC9_CTL2                                                0x00000289
+#define IA32_MC9_CTL2_SLOT                                           297
 #define IA32_MC10_CTL2                                               0x0000028A
+#define IA32_MC10_CTL2_SLOT                                          58
 #define IA32_MC11_CTL2                                               0x0000028B
+#define IA32_MC11_CTL2_SLOT                                          330
 #define IA32_MC12_CTL2                                               0x0000028C
+#define IA32_MC12_CTL2_SLOT                                          90
 #define IA32_MC13_CTL2                                               0x0000028D
+#define IA32_MC13_CTL2_SLOT                                          362
 #define IA32_MC14_CTL2                                               0x0000028E
+#define IA32_MC14_CTL2_SLOT                                          122
 #define IA32_MC15_CTL2                                               0x0000028F
+#define IA32_MC15_CTL2_SLOT                                          395
 #define IA32_MC16_CTL2                                               0x00000290
+#define IA32_MC16_CTL2_SLOT                                          155
 #define IA32_MC17_CTL2                                               0x00000291
+#define IA32_MC17_CTL2_SLOT                                          425
 #define IA32_MC18_CTL2                                               0x00000292
+#define IA32_MC18_CTL2_SLOT                                          184
 #define IA32_MC19_CTL2                                               0x00000293
+#define IA32_MC19_CTL2_SLOT                                          458
 #define IA32_MC20_CTL2                                               0x00000294
+#define IA32_MC20_CTL2_SLOT                                          217
 #define IA32_MC21_CTL2                                               0x00000295
+#define IA32_MC21_CTL2_SLOT                                          489
 #define IA32_MC22_CTL2                                               0x00000296
+#define IA32_MC22_CTL2_SLOT                                          240
 #define IA32_MC23_CTL2                                               0x00000297
+#define IA32_MC23_CTL2_SLOT                                          9
 #define IA32_MC24_CTL2                                               0x00000298
+#define IA32_MC24_CTL2_SLOT                                          281
 #define IA32_MC25_CTL2                                               0x00000299
+#define IA32_MC25_CTL2_SLOT                                          43
 #define IA32_MC26_CTL2                                               0x0000029A
+#define IA32_MC26_CTL2_SLOT                                          316
 #define IA32_MC27_CTL2                                               0x0000029B
+#define IA32_MC27_CTL2_SLOT                                          79
 #define IA32_MC28_CTL2                                               0x0000029C
+#define IA32_MC28_CTL2_SLOT                                          344
 #define IA32_MC29_CTL2                                               0x0000029D
+#define IA32_MC29_CTL2_SLOT                                          102
 #define IA32_MC30_CTL2                                               0x0000029E
+#define IA32_MC30_CTL2_SLOT                                          372
 #define IA32_MC31_CTL2                                               0x0000029F
+#define IA32_MC31_CTL2_SLOT                                          132
 typedef union
 {
   struct
@@ -10151,6 +11255,7 @@ typedef union
 
   uint64_t flags;
 } ia32_mc_ctl2_register;
+#define IA32_MC_CTL2_RESERVED_BITS                                   0xFFFFFFFFBFFF8000
 
 /**
  * @}
@@ -10163,6 +11268,7 @@ typedef union
  * @remarks If CPUID.01H: EDX.MTRR[12] = 1
  */
 #define IA32_MTRR_DEF_TYPE                                           0x000002FF
+#define IA32_MTRR_DEF_TYPE_SLOT                                      120
 typedef union
 {
   struct
@@ -10199,6 +11305,7 @@ typedef union
 
   uint64_t flags;
 } ia32_mtrr_def_type_register;
+#define IA32_MTRR_DEF_TYPE_RESERVED_BITS                             0xFFFFFFFFFFFFF3F8
 
 /**
  * @defgroup ia32_fixed_ctr \
@@ -10213,16 +11320,44 @@ typedef union
  * Counts Instr_Retired.Any.
  */
 #define IA32_FIXED_CTR0                                              0x00000309
+#define IA32_FIXED_CTR0_SLOT                                         278
 
 /**
  * Counts CPU_CLK_Unhalted.Core
  */
 #define IA32_FIXED_CTR1                                              0x0000030A
+#define IA32_FIXED_CTR1_SLOT                                         39
 
 /**
  * Counts CPU_CLK_Unhalted.Ref
  */
 #define IA32_FIXED_CTR2                                              0x0000030B
+#define IA32_FIXED_CTR2_SLOT                                         310
+/**
+ * @defgroup ia32_fixed_ctr_encoding \
+ *           Fixed-function performance counter helpers
+ *
+ * Fixed-function performance counter helpers.
+ * @{
+ */
+/**
+ * Address of IA32_FIXED_CTR(_).
+ */
+#define IA32_FIXED_CTR_MSR(_)                                        (0x309 + (_))
+
+/**
+ * Index n of fixed-function performance counter with MSR address _msr.
+ */
+#define IA32_FIXED_CTR_INDEX(_msr)                                   ((_msr) - 0x309)
+
+/**
+ * 1 if _msr is the address of one of the first _count fixed-function performance counters; 0 otherwise.
+ */
+#define IA32_FIXED_CTR_IN_RANGE(_msr, _count)                        (((_msr) >= 0x309) & ((_msr) < 0x309 + (_count)))
+/**
+ * @}
+ */
+
 /**
  * @}
  */
@@ -10234,6 +11369,7 @@ typedef union
  * @remarks If CPUID.01H: ECX[15] = 1
  */
 #define IA32_PERF_CAPABILITIES                                       0x00000345
+#define IA32_PERF_CAPABILITIES_SLOT                                  204
 typedef union
 {
   struct
@@ -10296,6 +11432,7 @@ typedef union
 
   uint64_t flags;
 } ia32_perf_capabilities_register;
+#define IA32_PERF_CAPABILITIES_RESERVED_BITS                         0xFFFFFFFFFFFFC000
 
 
 /**
@@ -10307,6 +11444,7 @@ typedef union
  * @remarks If CPUID.0AH: EAX[7:0] > 1
  */
 #define IA32_FIXED_CTR_CTRL                                          0x0000038D
+#define IA32_FIXED_CTR_CTRL_SLOT                                     322
 typedef union
 {
   struct
@@ -10433,7 +11571,38 @@ typedef union
 
   uint64_t flags;
 } ia32_fixed_ctr_ctrl_register;
+#define IA32_FIXED_CTR_CTRL_RESERVED_BITS                            0xFFFFFFFFFFFFF000
+
+/**
+ * Count while CPL = 0 (control field of a fixed counter).
+ */
+#define IA32_FIXED_CTR_CTRL_OS                                       0x00000001
+
+/**
+ * Count while CPL > 0 (control field of a fixed counter).
+ */
+#define IA32_FIXED_CTR_CTRL_USR                                      0x00000002
+
+/**
+ * Count events of all logical processors sharing the core (control field of a fixed counter).
+ */
+#define IA32_FIXED_CTR_CTRL_ANY_THREAD                               0x00000004
+
+/**
+ * Generate PMI on overflow (control field of a fixed counter).
+ */
+#define IA32_FIXED_CTR_CTRL_PMI                                      0x00000008
+
+/**
+ * Control field _ (combination of IA32_FIXED_CTR_CTRL_OS, _USR, _ANY_THREAD and _PMI) of fixed counter _n, positioned for
+ * ORing into IA32_FIXED_CTR_CTRL.
+ */
+#define IA32_FIXED_CTR_CTRL_ENCODE(_n, _)                            (((_) & 0x0FULL) << ((_n) * 4))
 
+/**
+ * Mask of the control field of fixed counter _n.
+ */
+#define IA32_FIXED_CTR_CTRL_FIELD_MASK(_n)                           (0x0FULL << ((_n) * 4))
 
 /**
  * Global Performance Counter Status.
@@ -10441,6 +11610,7 @@ typedef union
  * @remarks If CPUID.0AH: EAX[7:0] > 0
  */
 #define IA32_PERF_GLOBAL_STATUS                                      0x0000038E
+#define IA32_PERF_GLOBAL_STATUS_SLOT                                 80
 typedef union
 {
   struct
@@ -10610,6 +11780,7 @@ typedef union
 
   uint64_t flags;
 } ia32_perf_global_status_register;
+#define IA32_PERF_GLOBAL_STATUS_RESERVED_BITS                        0x37FFFF8FFFFFFF0
 
 
 /**
@@ -10621,6 +11792,7 @@ typedef union
  * @remarks If CPUID.0AH: EAX[7:0] > 0
  */
 #define IA32_PERF_GLOBAL_CTRL                                        0x0000038F
+#define IA32_PERF_GLOBAL_CTRL_SLOT                                   354
 typedef union
 {
   struct
@@ -10650,7 +11822,23 @@ typedef union
 
   uint64_t flags;
 } ia32_perf_global_ctrl_register;
+#define IA32_PERF_GLOBAL_CTRL_RESERVED_BITS                          0x00
+
+/**
+ * Enable bit of general-purpose performance counter IA32_PMC(_).
+ */
+#define IA32_PERF_GLOBAL_CTRL_PMC_FLAG(_)                            (1ULL << (_))
+
+/**
+ * Enable bit of fixed-function performance counter IA32_FIXED_CTR(_).
+ */
+#define IA32_PERF_GLOBAL_CTRL_FIXED_CTR_FLAG(_)                      (1ULL << (32 + (_)))
 
+/**
+ * Enable bits of all counters reported by CPUID.0AH (_cpuid_eax is CPUID.0AH:EAX, _cpuid_edx is CPUID.0AH:EDX). A value
+ * written to IA32_PERF_GLOBAL_CTRL is valid if it has no bits set outside of this mask.
+ */
+#define IA32_PERF_GLOBAL_CTRL_SUPPORTED(_cpuid_eax, _cpuid_edx)      (((1ULL << (((_cpuid_eax) >> 8) & 0xFF)) - 1) | (((1ULL << ((_cpuid_edx) & 0x1F)) - 1) << 32))
 
 /**
  * Global Performance Counter Overflow Reset Control.
@@ -10658,6 +11846,7 @@ typedef union
  * @remarks If CPUID.0AH: EAX[7:0] > 3
  */
 #define IA32_PERF_GLOBAL_STATUS_RESET                                0x00000390
+#define IA32_PERF_GLOBAL_STATUS_RESET_SLOT                           114
 typedef union
 {
   struct
@@ -10767,7 +11956,12 @@ typedef union
 
   uint64_t flags;
 } ia32_perf_global_status_reset_register;
+#define IA32_PERF_GLOBAL_STATUS_RESET_RESERVED_BITS                  0x37FFFF800000000
 
+/**
+ * IA32_PERF_GLOBAL_STATUS value _status after writing _ to IA32_PERF_GLOBAL_STATUS_RESET.
+ */
+#define IA32_PERF_GLOBAL_STATUS_RESET_APPLY(_status, _)              ((_status) & ~(_))
 
 /**
  * Global Performance Counter Overflow Set Control.
@@ -10775,6 +11969,7 @@ typedef union
  * @remarks If CPUID.0AH: EAX[7:0] > 3
  */
 #define IA32_PERF_GLOBAL_STATUS_SET                                  0x00000391
+#define IA32_PERF_GLOBAL_STATUS_SET_SLOT                             386
 typedef union
 {
   struct
@@ -10874,7 +12069,12 @@ typedef union
 
   uint64_t flags;
 } ia32_perf_global_status_set_register;
+#define IA32_PERF_GLOBAL_STATUS_SET_RESERVED_BITS                    0x837FFFF800000000
 
+/**
+ * IA32_PERF_GLOBAL_STATUS value _status after writing _ to IA32_PERF_GLOBAL_STATUS_SET.
+ */
+#define IA32_PERF_GLOBAL_STATUS_SET_APPLY(_status, _)                ((_status) | (_))
 
 /**
  * Indicator that core perfmon interface is in use.
@@ -10882,6 +12082,7 @@ typedef union
  * @remarks If CPUID.0AH: EAX[7:0] > 3
  */
 #define IA32_PERF_GLOBAL_INUSE                                       0x00000392
+#define IA32_PERF_GLOBAL_INUSE_SLOT                                  145
 typedef union
 {
   struct
@@ -10919,6 +12120,7 @@ typedef union
 
   uint64_t flags;
 } ia32_perf_global_inuse_register;
+#define IA32_PERF_GLOBAL_INUSE_RESERVED_BITS                         0x7FFFFFF800000000
 
 
 /**
@@ -10927,6 +12129,7 @@ typedef union
  * @remarks If CPUID.0AH: EAX[7:0] > 3
  */
 #define IA32_PEBS_ENABLE                                             0x000003F1
+#define IA32_PEBS_ENABLE_SLOT                                        371
 typedef union
 {
   struct
@@ -10965,6 +12168,7 @@ typedef union
 
   uint64_t flags;
 } ia32_pebs_enable_register;
+#define IA32_PEBS_ENABLE_RESERVED_BITS                               0xFFFFFFF0FFFFFFF0
 
 /**
  * @defgroup ia32_mc_ctl \
@@ -10976,34 +12180,63 @@ typedef union
  * @{
  */
 #define IA32_MC0_CTL                                                 0x00000400
+#define IA32_MC0_CTL_SLOT                                            352
 #define IA32_MC1_CTL                                                 0x00000404
+#define IA32_MC1_CTL_SLOT                                            416
 #define IA32_MC2_CTL                                                 0x00000408
+#define IA32_MC2_CTL_SLOT                                            476
 #define IA32_MC3_CTL                                                 0x0000040C
+#define IA32_MC3_CTL_SLOT                                            28
 #define IA32_MC4_CTL                                                 0x00000410
+#define IA32_MC4_CTL_SLOT                                            92
 #define IA32_MC5_CTL                                                 0x00000414
+#define IA32_MC5_CTL_SLOT                                            157
 #define IA32_MC6_CTL                                                 0x00000418
+#define IA32_MC6_CTL_SLOT                                            220
 #define IA32_MC7_CTL                                                 0x0000041C
+#define IA32_MC7_CTL_SLOT                                            277
 #define IA32_MC8_CTL                                                 0x00000420
+#define IA32_MC8_CTL_SLOT                                            351
 #define IA32_MC9_CTL                                                 0x00000424
+#define IA32_MC9_CTL_SLOT                                            408
 #define IA32_MC10_CTL                                                0x00000428
+#define IA32_MC10_CTL_SLOT                                           475
 #define IA32_MC11_CTL                                                0x0000042C
+#define IA32_MC11_CTL_SLOT                                           25
 #define IA32_MC12_CTL                                                0x00000430
+#define IA32_MC12_CTL_SLOT                                           88
 #define IA32_MC13_CTL                                                0x00000434
+#define IA32_MC13_CTL_SLOT                                           152
 #define IA32_MC14_CTL                                                0x00000438
+#define IA32_MC14_CTL_SLOT                                           216
 #define IA32_MC15_CTL                                                0x0000043C
+#define IA32_MC15_CTL_SLOT                                           276
 #define IA32_MC16_CTL                                                0x00000440
+#define IA32_MC16_CTL_SLOT                                           341
 #define IA32_MC17_CTL                                                0x00000444
+#define IA32_MC17_CTL_SLOT                                           406
 #define IA32_MC18_CTL                                                0x00000448
+#define IA32_MC18_CTL_SLOT                                           469
 #define IA32_MC19_CTL                                                0x0000044C
+#define IA32_MC19_CTL_SLOT                                           23
 #define IA32_MC20_CTL                                                0x00000450
+#define IA32_MC20_CTL_SLOT                                           84
 #define IA32_MC21_CTL                                                0x00000454
+#define IA32_MC21_CTL_SLOT                                           151
 #define IA32_MC22_CTL                                                0x00000458
+#define IA32_MC22_CTL_SLOT                                           210
 #define IA32_MC23_CTL                                                0x0000045C
+#define IA32_MC23_CTL_SLOT                                           282
 #define IA32_MC24_CTL                                                0x00000460
+#define IA32_MC24_CTL_SLOT                                           347
 #define IA32_MC25_CTL                                                0x00000464
+#define IA32_MC25_CTL_SLOT                                           401
 #define IA32_MC26_CTL                                                0x00000468
+#define IA32_MC26_CTL_SLOT                                           464
 #define IA32_MC27_CTL                                                0x0000046C
+#define IA32_MC27_CTL_SLOT                                           1
 #define IA32_MC28_CTL                                                0x00000470
+#define IA32_MC28_CTL_SLOT                                           86
 /**
  * @}
  */
@@ -11018,34 +12251,63 @@ typedef union
  * @{
  */
 #define IA32_MC0_STATUS                                              0x00000401
+#define IA32_MC0_STATUS_SLOT                                         112
 #define IA32_MC1_STATUS                                              0x00000405
+#define IA32_MC1_STATUS_SLOT                                         165
 #define IA32_MC2_STATUS                                              0x00000409
+#define IA32_MC2_STATUS_SLOT                                         234
 #define IA32_MC3_STATUS                                              0x0000040D
+#define IA32_MC3_STATUS_SLOT                                         303
 #define IA32_MC4_STATUS                                              0x00000411
+#define IA32_MC4_STATUS_SLOT                                         366
 #define IA32_MC5_STATUS                                              0x00000415
+#define IA32_MC5_STATUS_SLOT                                         428
 #define IA32_MC6_STATUS                                              0x00000419
+#define IA32_MC6_STATUS_SLOT                                         495
 #define IA32_MC7_STATUS                                              0x0000041D
+#define IA32_MC7_STATUS_SLOT                                         45
 #define IA32_MC8_STATUS                                              0x00000421
+#define IA32_MC8_STATUS_SLOT                                         108
 #define IA32_MC9_STATUS                                              0x00000425
+#define IA32_MC9_STATUS_SLOT                                         169
 #define IA32_MC10_STATUS                                             0x00000429
+#define IA32_MC10_STATUS_SLOT                                        235
 #define IA32_MC11_STATUS                                             0x0000042D
+#define IA32_MC11_STATUS_SLOT                                        289
 #define IA32_MC12_STATUS                                             0x00000431
+#define IA32_MC12_STATUS_SLOT                                        361
 #define IA32_MC13_STATUS                                             0x00000435
+#define IA32_MC13_STATUS_SLOT                                        424
 #define IA32_MC14_STATUS                                             0x00000439
+#define IA32_MC14_STATUS_SLOT                                        487
 #define IA32_MC15_STATUS                                             0x0000043D
+#define IA32_MC15_STATUS_SLOT                                        33
 #define IA32_MC16_STATUS                                             0x00000441
+#define IA32_MC16_STATUS_SLOT                                        99
 #define IA32_MC17_STATUS                                             0x00000445
+#define IA32_MC17_STATUS_SLOT                                        167
 #define IA32_MC18_STATUS                                             0x00000449
+#define IA32_MC18_STATUS_SLOT                                        228
 #define IA32_MC19_STATUS                                             0x0000044D
+#define IA32_MC19_STATUS_SLOT                                        292
 #define IA32_MC20_STATUS                                             0x00000451
+#define IA32_MC20_STATUS_SLOT                                        365
 #define IA32_MC21_STATUS                                             0x00000455
+#define IA32_MC21_STATUS_SLOT                                        418
 #define IA32_MC22_STATUS                                             0x00000459
+#define IA32_MC22_STATUS_SLOT                                        497
 #define IA32_MC23_STATUS                                             0x0000045D
+#define IA32_MC23_STATUS_SLOT                                        32
 #define IA32_MC24_STATUS                                             0x00000461
+#define IA32_MC24_STATUS_SLOT                                        97
 #define IA32_MC25_STATUS                                             0x00000465
+#define IA32_MC25_STATUS_SLOT                                        161
 #define IA32_MC26_STATUS                                             0x00000469
+#define IA32_MC26_STATUS_SLOT                                        226
 #define IA32_MC27_STATUS                                             0x0000046D
+#define IA32_MC27_STATUS_SLOT                                        287
 #define IA32_MC28_STATUS                                             0x00000471
+#define IA32_MC28_STATUS_SLOT                                        345
 /**
  * @}
  */
@@ -11060,34 +12322,63 @@ typedef union
  * @{
  */
 #define IA32_MC0_ADDR                                                0x00000402
+#define IA32_MC0_ADDR_SLOT                                           387
 #define IA32_MC1_ADDR                                                0x00000406
+#define IA32_MC1_ADDR_SLOT                                           447
 #define IA32_MC2_ADDR                                                0x0000040A
+#define IA32_MC2_ADDR_SLOT                                           502
 #define IA32_MC3_ADDR                                                0x0000040E
+#define IA32_MC3_ADDR_SLOT                                           62
 #define IA32_MC4_ADDR                                                0x00000412
+#define IA32_MC4_ADDR_SLOT                                           125
 #define IA32_MC5_ADDR                                                0x00000416
+#define IA32_MC5_ADDR_SLOT                                           191
 #define IA32_MC6_ADDR                                                0x0000041A
+#define IA32_MC6_ADDR_SLOT                                           252
 #define IA32_MC7_ADDR                                                0x0000041E
+#define IA32_MC7_ADDR_SLOT                                           317
 #define IA32_MC8_ADDR                                                0x00000422
+#define IA32_MC8_ADDR_SLOT                                           379
 #define IA32_MC9_ADDR                                                0x00000426
+#define IA32_MC9_ADDR_SLOT                                           433
 #define IA32_MC10_ADDR                                               0x0000042A
+#define IA32_MC10_ADDR_SLOT                                          511
 #define IA32_MC11_ADDR                                               0x0000042E
+#define IA32_MC11_ADDR_SLOT                                          57
 #define IA32_MC12_ADDR                                               0x00000432
+#define IA32_MC12_ADDR_SLOT                                          121
 #define IA32_MC13_ADDR                                               0x00000436
+#define IA32_MC13_ADDR_SLOT                                          185
 #define IA32_MC14_ADDR                                               0x0000043A
+#define IA32_MC14_ADDR_SLOT                                          247
 #define IA32_MC15_ADDR                                               0x0000043E
+#define IA32_MC15_ADDR_SLOT                                          304
 #define IA32_MC16_ADDR                                               0x00000442
+#define IA32_MC16_ADDR_SLOT                                          373
 #define IA32_MC17_ADDR                                               0x00000446
+#define IA32_MC17_ADDR_SLOT                                          436
 #define IA32_MC18_ADDR                                               0x0000044A
+#define IA32_MC18_ADDR_SLOT                                          501
 #define IA32_MC19_ADDR                                               0x0000044E
+#define IA32_MC19_ADDR_SLOT                                          53
 #define IA32_MC20_ADDR                                               0x00000452
+#define IA32_MC20_ADDR_SLOT                                          98
 #define IA32_MC21_ADDR                                               0x00000456
+#define IA32_MC21_ADDR_SLOT                                          178
 #define IA32_MC22_ADDR                                               0x0000045A
+#define IA32_MC22_ADDR_SLOT                                          243
 #define IA32_MC23_ADDR                                               0x0000045E
+#define IA32_MC23_ADDR_SLOT                                          306
 #define IA32_MC24_ADDR                                               0x00000462
+#define IA32_MC24_ADDR_SLOT                                          368
 #define IA32_MC25_ADDR                                               0x00000466
+#define IA32_MC25_ADDR_SLOT                                          432
 #define IA32_MC26_ADDR                                               0x0000046A
+#define IA32_MC26_ADDR_SLOT                                          507
 #define IA32_MC27_ADDR                                               0x0000046E
+#define IA32_MC27_ADDR_SLOT                                          44
 #define IA32_MC28_ADDR                                               0x00000472
+#define IA32_MC28_ADDR_SLOT                                          127
 /**
  * @}
  */
@@ -11102,34 +12393,63 @@ typedef union
  * @{
  */
 #define IA32_MC0_MISC                                                0x00000403
+#define IA32_MC0_MISC_SLOT                                           144
 #define IA32_MC1_MISC                                                0x00000407
+#define IA32_MC1_MISC_SLOT                                           199
 #define IA32_MC2_MISC                                                0x0000040B
+#define IA32_MC2_MISC_SLOT                                           269
 #define IA32_MC3_MISC                                                0x0000040F
+#define IA32_MC3_MISC_SLOT                                           334
 #define IA32_MC4_MISC                                                0x00000413
+#define IA32_MC4_MISC_SLOT                                           397
 #define IA32_MC5_MISC                                                0x00000417
+#define IA32_MC5_MISC_SLOT                                           461
 #define IA32_MC6_MISC                                                0x0000041B
+#define IA32_MC6_MISC_SLOT                                           12
 #define IA32_MC7_MISC                                                0x0000041F
+#define IA32_MC7_MISC_SLOT                                           72
 #define IA32_MC8_MISC                                                0x00000423
+#define IA32_MC8_MISC_SLOT                                           138
 #define IA32_MC9_MISC                                                0x00000427
+#define IA32_MC9_MISC_SLOT                                           202
 #define IA32_MC10_MISC                                               0x0000042B
+#define IA32_MC10_MISC_SLOT                                          265
 #define IA32_MC11_MISC                                               0x0000042F
+#define IA32_MC11_MISC_SLOT                                          329
 #define IA32_MC12_MISC                                               0x00000433
+#define IA32_MC12_MISC_SLOT                                          392
 #define IA32_MC13_MISC                                               0x00000437
+#define IA32_MC13_MISC_SLOT                                          456
 #define IA32_MC14_MISC                                               0x0000043B
+#define IA32_MC14_MISC_SLOT                                          5
 #define IA32_MC15_MISC                                               0x0000043F
+#define IA32_MC15_MISC_SLOT                                          69
 #define IA32_MC16_MISC                                               0x00000443
+#define IA32_MC16_MISC_SLOT                                          134
 #define IA32_MC17_MISC                                               0x00000447
+#define IA32_MC17_MISC_SLOT                                          196
 #define IA32_MC18_MISC                                               0x0000044B
+#define IA32_MC18_MISC_SLOT                                          261
 #define IA32_MC19_MISC                                               0x0000044F
+#define IA32_MC19_MISC_SLOT                                          327
 #define IA32_MC20_MISC                                               0x00000453
+#define IA32_MC20_MISC_SLOT                                          384
 #define IA32_MC21_MISC                                               0x00000457
+#define IA32_MC21_MISC_SLOT                                          451
 #define IA32_MC22_MISC                                               0x0000045B
+#define IA32_MC22_MISC_SLOT                                          2
 #define IA32_MC23_MISC                                               0x0000045F
+#define IA32_MC23_MISC_SLOT                                          73
 #define IA32_MC24_MISC                                               0x00000463
+#define IA32_MC24_MISC_SLOT                                          129
 #define IA32_MC25_MISC                                               0x00000467
+#define IA32_MC25_MISC_SLOT                                          193
 #define IA32_MC26_MISC                                               0x0000046B
+#define IA32_MC26_MISC_SLOT                                          260
 #define IA32_MC27_MISC                                               0x0000046F
+#define IA32_MC27_MISC_SLOT                                          314
 #define IA32_MC28_MISC                                               0x00000473
+#define IA32_MC28_MISC_SLOT                                          382
 /**
  * @}
  */
@@ -11143,6 +12463,7 @@ typedef union
  * @see Vol3D[A.1(Basic VMX Information)] (reference)
  */
 #define IA32_VMX_BASIC                                               0x00000480
+#define IA32_VMX_BASIC_SLOT                                          335
 typedef union
 {
   struct
@@ -11266,6 +12587,7 @@ typedef union
 
   uint64_t flags;
 } ia32_vmx_basic_register;
+#define IA32_VMX_BASIC_RESERVED_BITS                                 0xFF00E00080000000
 
 
 /**
@@ -11276,6 +12598,7 @@ typedef union
  * @see Vol3C[24.6.1(Pin-Based VM-Execution Controls)] (reference)
  */
 #define IA32_VMX_PINBASED_CTLS                                       0x00000481
+#define IA32_VMX_PINBASED_CTLS_SLOT                                  91
 typedef union
 {
   struct
@@ -11356,6 +12679,7 @@ typedef union
 
   uint64_t flags;
 } ia32_vmx_pinbased_ctls_register;
+#define IA32_VMX_PINBASED_CTLS_RESERVED_BITS                         0xFFFFFFFFFFFFFF16
 
 
 /**
@@ -11366,6 +12690,7 @@ typedef union
  * @see Vol3C[24.6.2(Processor-Based VM-Execution Controls)] (reference)
  */
 #define IA32_VMX_PROCBASED_CTLS                                      0x00000482
+#define IA32_VMX_PROCBASED_CTLS_SLOT                                 364
 typedef union
 {
   struct
@@ -11656,6 +12981,7 @@ typedef union
 
   uint64_t flags;
 } ia32_vmx_procbased_ctls_register;
+#define IA32_VMX_PROCBASED_CTLS_RESERVED_BITS                        0xFFFFFFFF04046173
 
 
 /**
@@ -11666,6 +12992,7 @@ typedef union
  * @see Vol3C[24.7.1(VM-Exit Controls)] (reference)
  */
 #define IA32_VMX_EXIT_CTLS                                           0x00000483
+#define IA32_VMX_EXIT_CTLS_SLOT                                      124
 typedef union
 {
   struct
@@ -11876,6 +13203,7 @@ typedef union
 
   uint64_t flags;
 } ia32_vmx_exit_ctls_register;
+#define IA32_VMX_EXIT_CTLS_RESERVED_BITS                             0xFFFFFFFF00036DFB
 
 
 /**
@@ -11886,6 +13214,7 @@ typedef union
  * @see Vol3D[24.8.1(VM-Entry Controls)] (reference)
  */
 #define IA32_VMX_ENTRY_CTLS                                          0x00000484
+#define IA32_VMX_ENTRY_CTLS_SLOT                                     399
 typedef union
 {
   struct
@@ -12049,6 +13378,7 @@ typedef union
 
   uint64_t flags;
 } ia32_vmx_entry_ctls_register;
+#define IA32_VMX_ENTRY_CTLS_RESERVED_BITS                            0xFFFFFFFFFF8011FB
 
 
 /**
@@ -12059,6 +13389,7 @@ typedef union
  * @see Vol3D[A.6(Miscellaneous Data)] (reference)
  */
 #define IA32_VMX_MISC                                                0x00000485
+#define IA32_VMX_MISC_SLOT                                           156
 typedef union
 {
   struct
@@ -12213,6 +13544,7 @@ typedef union
 
   uint64_t flags;
 } ia32_vmx_misc_register;
+#define IA32_VMX_MISC_RESERVED_BITS                                  0x80003E00
 
 
 /**
@@ -12223,6 +13555,7 @@ typedef union
  * @see Vol3D[A.7(VMX-Fixed Bits in CR0)] (reference)
  */
 #define IA32_VMX_CR0_FIXED0                                          0x00000486
+#define IA32_VMX_CR0_FIXED0_SLOT                                     427
 
 /**
  * Capability Reporting Register of CR0 Bits Fixed to 1.
@@ -12232,6 +13565,7 @@ typedef union
  * @see Vol3D[A.7(VMX-Fixed Bits in CR0)] (reference)
  */
 #define IA32_VMX_CR0_FIXED1                                          0x00000487
+#define IA32_VMX_CR0_FIXED1_SLOT                                     177
 
 /**
  * Capability Reporting Register of CR4 Bits Fixed to 0.
@@ -12241,6 +13575,7 @@ typedef union
  * @see Vol3D[A.8(VMX-Fixed Bits in CR4)] (reference)
  */
 #define IA32_VMX_CR4_FIXED0                                          0x00000488
+#define IA32_VMX_CR4_FIXED0_SLOT                                     459
 
 /**
  * Capability Reporting Register of CR4 Bits Fixed to 1.
@@ -12250,6 +13585,7 @@ typedef union
  * @see Vol3D[A.8(VMX-Fixed Bits in CR4)] (reference)
  */
 #define IA32_VMX_CR4_FIXED1                                          0x00000489
+#define IA32_VMX_CR4_FIXED1_SLOT                                     211
 
 /**
  * Capability Reporting Register of VMCS Field Enumeration.
@@ -12259,6 +13595,7 @@ typedef union
  * @see Vol3D[A.9(VMCS Enumeration)] (reference)
  */
 #define IA32_VMX_VMCS_ENUM                                           0x0000048A
+#define IA32_VMX_VMCS_ENUM_SLOT                                      488
 typedef union
 {
   struct
@@ -12304,6 +13641,7 @@ typedef union
 
   uint64_t flags;
 } ia32_vmx_vmcs_enum_register;
+#define IA32_VMX_VMCS_ENUM_RESERVED_BITS                             0xFFFFFFFFFFFF9000
 
 
 /**
@@ -12314,6 +13652,7 @@ typedef union
  * @see Vol3D[24.6.2(Processor-Based VM-Execution Controls)] (reference)
  */
 #define IA32_VMX_PROCBASED_CTLS2                                     0x0000048B
+#define IA32_VMX_PROCBASED_CTLS2_SLOT                                254
 typedef union
 {
   struct
@@ -12715,6 +14054,7 @@ typedef union
 
   uint64_t flags;
 } ia32_vmx_procbased_ctls2_register;
+#define IA32_VMX_PROCBASED_CTLS2_RESERVED_BITS                       0xFFFFFFFF20000000
 
 
 /**
@@ -12726,6 +14066,7 @@ typedef union
  * @see Vol3D[A.10(VPID and EPT Capabilities)] (reference)
  */
 #define IA32_VMX_EPT_VPID_CAP                                        0x0000048C
+#define IA32_VMX_EPT_VPID_CAP_SLOT                                   3
 typedef union
 {
   struct
@@ -12932,6 +14273,7 @@ typedef union
 
   uint64_t flags;
 } ia32_vmx_ept_vpid_cap_register;
+#define IA32_VMX_EPT_VPID_CAP_RESERVED_BITS                          0xFFC0F0FEF90CBEBE
 
 /**
  * @defgroup ia32_vmx_true_ctls \
@@ -12952,9 +14294,64 @@ typedef union
  * @{
  */
 #define IA32_VMX_TRUE_PINBASED_CTLS                                  0x0000048D
+#define IA32_VMX_TRUE_PINBASED_CTLS_SLOT                             280
 #define IA32_VMX_TRUE_PROCBASED_CTLS                                 0x0000048E
+#define IA32_VMX_TRUE_PROCBASED_CTLS_SLOT                            40
 #define IA32_VMX_TRUE_EXIT_CTLS                                      0x0000048F
+#define IA32_VMX_TRUE_EXIT_CTLS_SLOT                                 315
 #define IA32_VMX_TRUE_ENTRY_CTLS                                     0x00000490
+#define IA32_VMX_TRUE_ENTRY_CTLS_SLOT                                74
+
+/**
+ * Offset of IA32_VMX_TRUE_(x)_CTLS from the corresponding IA32_VMX_(x)_CTLS capability MSR (pin-based, primary
+ * processor-based, VM-exit and VM-entry controls).
+ */
+#define IA32_VMX_TRUE_CTLS_OFFSET                                    0x0000000C
+
+/**
+ * Select capability MSR of controls _msr (IA32_VMX_PINBASED_CTLS, IA32_VMX_PROCBASED_CTLS, IA32_VMX_EXIT_CTLS or
+ * IA32_VMX_ENTRY_CTLS) - its IA32_VMX_TRUE_(x)_CTLS counterpart is selected if IA32_VMX_BASIC (passed as _) reports
+ * support of the "true" capability MSRs.
+ */
+#define IA32_VMX_CTLS_SELECT(_, _msr)                                ((_msr) + (((_) >> 55) & 0x01) * IA32_VMX_TRUE_CTLS_OFFSET)
+
+/**
+ * Adjust desired controls to the value of capability MSR _: controls which must be 1 (allowed 0-settings) are set and
+ * controls which must be 0 (allowed 1-settings) are cleared.
+ */
+#define IA32_VMX_ADJUST_CTLS(_, _desired)                            (((_desired) | (_)) & ((_) >> 32))
+
+/**
+ * Pin-based VM-execution controls of the default1 class (bits 1, 2 and 4). They are reported as allowed 0-settings only by
+ * IA32_VMX_TRUE_PINBASED_CTLS.
+ *
+ * @see Vol3D[A.3.1(Pin-Based VM-Execution Controls)]
+ */
+#define IA32_VMX_PINBASED_CTLS_DEFAULT1                              0x00000016
+
+/**
+ * Primary processor-based VM-execution controls of the default1 class (bits 1, 4-6, 8, 13-16 and 26). They are reported as
+ * allowed 0-settings only by IA32_VMX_TRUE_PROCBASED_CTLS.
+ *
+ * @see Vol3D[A.3.2(Primary Processor-Based VM-Execution Controls)]
+ */
+#define IA32_VMX_PROCBASED_CTLS_DEFAULT1                             0x0401E172
+
+/**
+ * VM-exit controls of the default1 class (bits 0-8, 10, 11, 13, 14, 16 and 17). They are reported as allowed 0-settings
+ * only by IA32_VMX_TRUE_EXIT_CTLS.
+ *
+ * @see Vol3D[A.4(VM-EXIT CONTROLS)]
+ */
+#define IA32_VMX_EXIT_CTLS_DEFAULT1                                  0x00036DFF
+
+/**
+ * VM-entry controls of the default1 class (bits 0-8 and 12). They are reported as allowed 0-settings only by
+ * IA32_VMX_TRUE_ENTRY_CTLS.
+ *
+ * @see Vol3D[A.5(VM-ENTRY CONTROLS)]
+ */
+#define IA32_VMX_ENTRY_CTLS_DEFAULT1                                 0x000011FF
 typedef union
 {
   struct
@@ -12982,6 +14379,7 @@ typedef union
 
   uint64_t flags;
 } ia32_vmx_true_ctls_register;
+#define IA32_VMX_TRUE_CTLS_RESERVED_BITS                             0x00
 
 /**
  * @}
@@ -12996,6 +14394,7 @@ typedef union
  * @see Vol3D[24.6.14(VM-Function Controls)] (reference)
  */
 #define IA32_VMX_VMFUNC                                              0x00000491
+#define IA32_VMX_VMFUNC_SLOT                                         346
 typedef union
 {
   struct
@@ -13015,6 +14414,7 @@ typedef union
 
   uint64_t flags;
 } ia32_vmx_vmfunc_register;
+#define IA32_VMX_VMFUNC_RESERVED_BITS                                0xFFFFFFFFFFFFFFFE
 
 
 /**
@@ -13025,6 +14425,7 @@ typedef union
  * @see Vol3D[24.6.2(Processor-Based VM-Execution Controls)] (reference)
  */
 #define IA32_VMX_PROCBASED_CTLS3                                     0x00000492
+#define IA32_VMX_PROCBASED_CTLS3_SLOT                                104
 typedef union
 {
   struct
@@ -13122,6 +14523,7 @@ typedef union
 
   uint64_t flags;
 } ia32_vmx_procbased_ctls3_register;
+#define IA32_VMX_PROCBASED_CTLS3_RESERVED_BITS                       0xFFFFFFFFFFFFFF20
 
 
 /**
@@ -13132,6 +14534,7 @@ typedef union
  * @see Vol3C[24.7.1(VM-Exit Controls)] (reference)
  */
 #define IA32_VMX_EXIT_CTLS2                                          0x00000493
+#define IA32_VMX_EXIT_CTLS2_SLOT                                     377
 typedef union
 {
   struct
@@ -13156,6 +14559,7 @@ typedef union
 
   uint64_t flags;
 } ia32_vmx_exit_ctls2_register;
+#define IA32_VMX_EXIT_CTLS2_RESERVED_BITS                            0xFFFFFFFFFFFFFFF7
 
 /**
  * @defgroup ia32_a_pmc \
@@ -13167,13 +14571,46 @@ typedef union
  * @{
  */
 #define IA32_A_PMC0                                                  0x000004C1
+#define IA32_A_PMC0_SLOT                                             81
 #define IA32_A_PMC1                                                  0x000004C2
+#define IA32_A_PMC1_SLOT                                             353
 #define IA32_A_PMC2                                                  0x000004C3
+#define IA32_A_PMC2_SLOT                                             119
 #define IA32_A_PMC3                                                  0x000004C4
+#define IA32_A_PMC3_SLOT                                             385
 #define IA32_A_PMC4                                                  0x000004C5
+#define IA32_A_PMC4_SLOT                                             146
 #define IA32_A_PMC5                                                  0x000004C6
+#define IA32_A_PMC5_SLOT                                             417
 #define IA32_A_PMC6                                                  0x000004C7
+#define IA32_A_PMC6_SLOT                                             176
 #define IA32_A_PMC7                                                  0x000004C8
+#define IA32_A_PMC7_SLOT                                             448
+/**
+ * @defgroup ia32_a_pmc_encoding \
+ *           Full-width performance counter alias helpers
+ *
+ * Full-width performance counter alias helpers.
+ * @{
+ */
+/**
+ * Address of IA32_A_PMC(_).
+ */
+#define IA32_A_PMC_MSR(_)                                            (0x4C1 + (_))
+
+/**
+ * Index n of full-width performance counter alias with MSR address _msr.
+ */
+#define IA32_A_PMC_INDEX(_msr)                                       ((_msr) - 0x4C1)
+
+/**
+ * 1 if _msr is the address of one of the first _count full-width performance counter aliases; 0 otherwise.
+ */
+#define IA32_A_PMC_IN_RANGE(_msr, _count)                            (((_msr) >= 0x4C1) & ((_msr) < 0x4C1 + (_count)))
+/**
+ * @}
+ */
+
 /**
  * @}
  */
@@ -13186,6 +14623,7 @@ typedef union
  * @see Vol3B[15.3.1.4(IA32_MCG_EXT_CTL MSR)]
  */
 #define IA32_MCG_EXT_CTL                                             0x000004D0
+#define IA32_MCG_EXT_CTL_SLOT                                        65
 typedef union
 {
   struct
@@ -13200,6 +14638,7 @@ typedef union
 
   uint64_t flags;
 } ia32_mcg_ext_ctl_register;
+#define IA32_MCG_EXT_CTL_RESERVED_BITS                               0xFFFFFFFFFFFFFFFE
 
 
 /**
@@ -13215,6 +14654,7 @@ typedef union
  * @see Vol3D[41.11.3(Interactions with Authenticated Code Modules (ACMs))] (reference)
  */
 #define IA32_SGX_SVN_STATUS                                          0x00000500
+#define IA32_SGX_SVN_STATUS_SLOT                                     312
 typedef union
 {
   struct
@@ -13253,6 +14693,7 @@ typedef union
 
   uint64_t flags;
 } ia32_sgx_svn_status_register;
+#define IA32_SGX_SVN_STATUS_RESERVED_BITS                            0xFFFFFFFFFF00FFFE
 
 
 /**
@@ -13263,6 +14704,7 @@ typedef union
  * @see Vol3C[35.2.7.7(IA32_RTIT_OUTPUT_BASE MSR)] (reference)
  */
 #define IA32_RTIT_OUTPUT_BASE                                        0x00000560
+#define IA32_RTIT_OUTPUT_BASE_SLOT                                   298
 typedef union
 {
   struct
@@ -13293,6 +14735,8 @@ typedef union
 
   uint64_t flags;
 } ia32_rtit_output_base_register;
+#define IA32_RTIT_OUTPUT_BASE_RESERVED_BITS                          0xFFF000000000007F
+#define IA32_RTIT_OUTPUT_BASE_ADDRESS_BITS                           0xFFFFFFFFFFF80
 
 
 /**
@@ -13303,6 +14747,7 @@ typedef union
  * @see Vol3C[35.2.7.8(IA32_RTIT_OUTPUT_MASK_PTRS MSR)] (reference)
  */
 #define IA32_RTIT_OUTPUT_MASK_PTRS                                   0x00000561
+#define IA32_RTIT_OUTPUT_MASK_PTRS_SLOT                              49
 typedef union
 {
   struct
@@ -13362,6 +14807,7 @@ typedef union
 
   uint64_t flags;
 } ia32_rtit_output_mask_ptrs_register;
+#define IA32_RTIT_OUTPUT_MASK_PTRS_RESERVED_BITS                     0x00
 
 
 /**
@@ -13371,6 +14817,7 @@ typedef union
  * @see Vol3C[35.2.7.2(IA32_RTIT_CTL MSR)] (reference)
  */
 #define IA32_RTIT_CTL                                                0x00000570
+#define IA32_RTIT_CTL_SLOT                                           41
 typedef union
 {
   struct
@@ -13628,7 +15075,22 @@ typedef union
 #define IA32_RTIT_CTL_PSB_FREQUENCY_FLAG                             0xF000000
 #define IA32_RTIT_CTL_PSB_FREQUENCY_MASK                             0x0F
 #define IA32_RTIT_CTL_PSB_FREQUENCY(_)                               (((_) >> 24) & 0x0F)
-    uint64_t reserved3                                               : 4;
+    uint64_t reserved3                                               : 3;
+
+    /**
+     * @brief EventEn
+     *
+     * [Bit 31] - 0: Event Trace packets are disabled.
+     * - 1: Enables Event Trace packets.
+     *
+     * @remarks Reserved if CPUID.(EAX=14H, ECX=0):EBX[bit 7] = 0
+     * @see Vol3C[35.2.7.2(IA32_RTIT_CTL MSR)]
+     */
+    uint64_t event_trace_enabled                                     : 1;
+#define IA32_RTIT_CTL_EVENT_TRACE_ENABLED_BIT                        31
+#define IA32_RTIT_CTL_EVENT_TRACE_ENABLED_FLAG                       0x80000000
+#define IA32_RTIT_CTL_EVENT_TRACE_ENABLED_MASK                       0x01
+#define IA32_RTIT_CTL_EVENT_TRACE_ENABLED(_)                         (((_) >> 31) & 0x01)
 
     /**
      * @brief ADDR0_CFG
@@ -13713,7 +15175,22 @@ typedef union
 #define IA32_RTIT_CTL_ADDR3_CFG_FLAG                                 0xF00000000000
 #define IA32_RTIT_CTL_ADDR3_CFG_MASK                                 0x0F
 #define IA32_RTIT_CTL_ADDR3_CFG(_)                                   (((_) >> 44) & 0x0F)
-    uint64_t reserved4                                               : 8;
+    uint64_t reserved4                                               : 7;
+
+    /**
+     * @brief DisTNT
+     *
+     * [Bit 55] - 0: TNT packets are enabled.
+     * - 1: Disables TNT packets.
+     *
+     * @remarks Reserved if CPUID.(EAX=14H, ECX=0):EBX[bit 8] = 0
+     * @see Vol3C[35.2.7.2(IA32_RTIT_CTL MSR)]
+     */
+    uint64_t tnt_disabled                                            : 1;
+#define IA32_RTIT_CTL_TNT_DISABLED_BIT                               55
+#define IA32_RTIT_CTL_TNT_DISABLED_FLAG                              0x80000000000000
+#define IA32_RTIT_CTL_TNT_DISABLED_MASK                              0x01
+#define IA32_RTIT_CTL_TNT_DISABLED(_)                                (((_) >> 55) & 0x01)
 
     /**
      * @brief InjectPsbPmiOnEnable
@@ -13734,7 +15211,13 @@ typedef union
 
   uint64_t flags;
 } ia32_rtit_ctl_register;
+#define IA32_RTIT_CTL_RESERVED_BITS                                  0xFE7F000070840000
 
+/**
+ * Bits of IA32_RTIT_CTL that may be set according to CPUID.(EAX=14H, ECX=0) (_cpuid_ebx is EBX, _cpuid_ecx is ECX). The
+ * number of usable ADDRn_CFG fields is further limited by CPUID.(EAX=14H, ECX=1):EAX[2:0].
+ */
+#define IA32_RTIT_CTL_SUPPORTED(_cpuid_ebx, _cpuid_ecx)              (0x2C0DULL | (((_cpuid_ebx) & 0x01) * 0x80ULL) | ((((_cpuid_ebx) >> 1) & 0x01) * 0xF780002ULL) | ((((_cpuid_ebx) >> 2) & 0x01) * 0xFFFF00000000ULL) | ((((_cpuid_ebx) >> 3) & 0x01) * 0x3C200ULL) | ((((_cpuid_ebx) >> 4) & 0x01) * 0x1020ULL) | ((((_cpuid_ebx) >> 5) & 0x01) * 0x10ULL) | ((((_cpuid_ebx) >> 6) & 0x01) * 0x100000000000000ULL) | ((((_cpuid_ebx) >> 7) & 0x01) * 0x80000000ULL) | ((((_cpuid_ebx) >> 8) & 0x01) * 0x80000000000000ULL) | (((_cpuid_ecx) & 0x01) * 0x100ULL) | ((((_cpuid_ecx) >> 3) & 0x01) * 0x40ULL))
 
 /**
  * Tracing Status Register.
@@ -13742,6 +15225,7 @@ typedef union
  * @remarks If (CPUID.(EAX=07H, ECX=0):EBX[25] = 1)
  */
 #define IA32_RTIT_STATUS                                             0x00000571
+#define IA32_RTIT_STATUS_SLOT                                        311
 typedef union
 {
   struct
@@ -13874,6 +15358,7 @@ typedef union
 
   uint64_t flags;
 } ia32_rtit_status_register;
+#define IA32_RTIT_STATUS_RESERVED_BITS                               0xFFFE0000FFFFFF08
 
 
 /**
@@ -13887,6 +15372,7 @@ typedef union
  * @see Vol3C[35.2.7.6(IA32_RTIT_CR3_MATCH MSR)] (reference)
  */
 #define IA32_RTIT_CR3_MATCH                                          0x00000572
+#define IA32_RTIT_CR3_MATCH_SLOT                                     68
 typedef union
 {
   struct
@@ -13905,6 +15391,7 @@ typedef union
 
   uint64_t flags;
 } ia32_rtit_cr3_match_register;
+#define IA32_RTIT_CR3_MATCH_RESERVED_BITS                            0x1F
 
 /**
  * @defgroup ia32_rtit_addr \
@@ -13928,9 +15415,13 @@ typedef union
  * @{
  */
 #define IA32_RTIT_ADDR0_A                                            0x00000580
+#define IA32_RTIT_ADDR0_A_SLOT                                       291
 #define IA32_RTIT_ADDR1_A                                            0x00000582
+#define IA32_RTIT_ADDR1_A_SLOT                                       324
 #define IA32_RTIT_ADDR2_A                                            0x00000584
+#define IA32_RTIT_ADDR2_A_SLOT                                       359
 #define IA32_RTIT_ADDR3_A                                            0x00000586
+#define IA32_RTIT_ADDR3_A_SLOT                                       388
 /**
  * @}
  */
@@ -13945,9 +15436,13 @@ typedef union
  * @{
  */
 #define IA32_RTIT_ADDR0_B                                            0x00000581
+#define IA32_RTIT_ADDR0_B_SLOT                                       54
 #define IA32_RTIT_ADDR1_B                                            0x00000583
+#define IA32_RTIT_ADDR1_B_SLOT                                       87
 #define IA32_RTIT_ADDR2_B                                            0x00000585
+#define IA32_RTIT_ADDR2_B_SLOT                                       115
 #define IA32_RTIT_ADDR3_B                                            0x00000587
+#define IA32_RTIT_ADDR3_B_SLOT                                       147
 /**
  * @}
  */
@@ -13977,6 +15472,7 @@ typedef union
 
   uint64_t flags;
 } ia32_rtit_addr_register;
+#define IA32_RTIT_ADDR_RESERVED_BITS                                 0x00
 
 /**
  * @}
@@ -13995,6 +15491,7 @@ typedef union
  * @see Vol3B[18.6.3.4(Debug Store (DS) Mechanism)]
  */
 #define IA32_DS_AREA                                                 0x00000600
+#define IA32_DS_AREA_SLOT                                            273
 
 /**
  * Configure User Mode CET
@@ -14003,6 +15500,7 @@ typedef union
  *          CPUID.(EAX=07H,ECX=0H):EDX.CET_IBT[20] = 1.
  */
 #define IA32_U_CET                                                   0x000006A0
+#define IA32_U_CET_SLOT                                              249
 typedef union
 {
   struct
@@ -14115,6 +15613,7 @@ typedef union
 
   uint64_t flags;
 } ia32_u_cet_register;
+#define IA32_U_CET_RESERVED_BITS                                     0x3C0
 
 
 /**
@@ -14124,6 +15623,7 @@ typedef union
  *          CPUID.(EAX=07H,ECX=0H):EDX.CET_IBT[20] = 1.
  */
 #define IA32_S_CET                                                   0x000006A2
+#define IA32_S_CET_SLOT                                              279
 typedef union
 {
   struct
@@ -14236,6 +15736,7 @@ typedef union
 
   uint64_t flags;
 } ia32_s_cet_register;
+#define IA32_S_CET_RESERVED_BITS                                     0x3C0
 
 
 /**
@@ -14248,6 +15749,7 @@ typedef union
  * @remarks If CPUID.(EAX=07H, ECX=0H):ECX.CET_SS[07] = 1
  */
 #define IA32_PL0_SSP                                                 0x000006A4
+#define IA32_PL0_SSP_SLOT                                            308
 
 /**
  * Linear address to be loaded into SSP on transition to privilege level 1.
@@ -14259,6 +15761,7 @@ typedef union
  * @remarks If CPUID.(EAX=07H, ECX=0H):ECX.CET_SS[07] = 1
  */
 #define IA32_PL1_SSP                                                 0x000006A5
+#define IA32_PL1_SSP_SLOT                                            71
 
 /**
  * Linear address to be loaded into SSP on transition to privilege level 2.
@@ -14270,6 +15773,7 @@ typedef union
  * @remarks If CPUID.(EAX=07H, ECX=0H):ECX.CET_SS[07] = 1
  */
 #define IA32_PL2_SSP                                                 0x000006A6
+#define IA32_PL2_SSP_SLOT                                            343
 
 /**
  * Linear address to be loaded into SSP on transition to privilege level 3.
@@ -14281,6 +15785,7 @@ typedef union
  * @remarks If CPUID.(EAX=07H, ECX=0H):ECX.CET_SS[07] = 1
  */
 #define IA32_PL3_SSP                                                 0x000006A7
+#define IA32_PL3_SSP_SLOT                                            110
 
 /**
  * Linear address of a table of seven shadow stack pointers that are selected in IA-32e mode using the IST index (when not
@@ -14291,6 +15796,7 @@ typedef union
  * @remarks If CPUID.(EAX=07H, ECX=0H):ECX.CET_SS[07] = 1
  */
 #define IA32_INTERRUPT_SSP_TABLE_ADDR                                0x000006A8
+#define IA32_INTERRUPT_SSP_TABLE_ADDR_SLOT                           375
 
 /**
  * TSC Target of Local APIC's TSC Deadline Mode.
@@ -14298,6 +15804,7 @@ typedef union
  * @remarks If CPUID.01H:ECX.[24] = 1
  */
 #define IA32_TSC_DEADLINE                                            0x000006E0
+#define IA32_TSC_DEADLINE_SLOT                                       239
 
 /**
  * Enable/disable HWP.
@@ -14305,6 +15812,7 @@ typedef union
  * @remarks If CPUID.06H:EAX.[7] = 1
  */
 #define IA32_PM_ENABLE                                               0x00000770
+#define IA32_PM_ENABLE_SLOT                                          470
 typedef union
 {
   struct
@@ -14325,6 +15833,7 @@ typedef union
 
   uint64_t flags;
 } ia32_pm_enable_register;
+#define IA32_PM_ENABLE_RESERVED_BITS                                 0xFFFFFFFFFFFFFFFE
 
 
 /**
@@ -14333,6 +15842,7 @@ typedef union
  * @remarks If CPUID.06H:EAX.[7] = 1
  */
 #define IA32_HWP_CAPABILITIES                                        0x00000771
+#define IA32_HWP_CAPABILITIES_SLOT                                   231
 typedef union
 {
   struct
@@ -14389,6 +15899,7 @@ typedef union
 
   uint64_t flags;
 } ia32_hwp_capabilities_register;
+#define IA32_HWP_CAPABILITIES_RESERVED_BITS                          0xFFFFFFFF00000000
 
 
 /**
@@ -14397,6 +15908,7 @@ typedef union
  * @remarks If CPUID.06H:EAX.[11] = 1
  */
 #define IA32_HWP_REQUEST_PKG                                         0x00000772
+#define IA32_HWP_REQUEST_PKG_SLOT                                    503
 typedef union
 {
   struct
@@ -14465,6 +15977,7 @@ typedef union
 
   uint64_t flags;
 } ia32_hwp_request_pkg_register;
+#define IA32_HWP_REQUEST_PKG_RESERVED_BITS                           0xFFFFFC0000000000
 
 
 /**
@@ -14473,6 +15986,7 @@ typedef union
  * @remarks If CPUID.06H:EAX.[8] = 1
  */
 #define IA32_HWP_INTERRUPT                                           0x00000773
+#define IA32_HWP_INTERRUPT_SLOT                                      263
 typedef union
 {
   struct
@@ -14505,6 +16019,7 @@ typedef union
 
   uint64_t flags;
 } ia32_hwp_interrupt_register;
+#define IA32_HWP_INTERRUPT_RESERVED_BITS                             0xFFFFFFFFFFFFFFFC
 
 
 /**
@@ -14513,6 +16028,7 @@ typedef union
  * @remarks If CPUID.06H:EAX.[7] = 1
  */
 #define IA32_HWP_REQUEST                                             0x00000774
+#define IA32_HWP_REQUEST_SLOT                                        22
 typedef union
 {
   struct
@@ -14593,6 +16109,7 @@ typedef union
 
   uint64_t flags;
 } ia32_hwp_request_register;
+#define IA32_HWP_REQUEST_RESERVED_BITS                               0xFFFFF80000000000
 
 
 /**
@@ -14601,6 +16118,7 @@ typedef union
  * @remarks If CPUID.06H:EAX.[7] = 1
  */
 #define IA32_HWP_STATUS                                              0x00000777
+#define IA32_HWP_STATUS_SLOT                                         333
 typedef union
 {
   struct
@@ -14634,6 +16152,7 @@ typedef union
 
   uint64_t flags;
 } ia32_hwp_status_register;
+#define IA32_HWP_STATUS_RESERVED_BITS                                0xFFFFFFFFFFFFFFFA
 
 
 /**
@@ -14643,6 +16162,7 @@ typedef union
  * @see Vol3A[10.12(EXTENDED XAPIC (X2APIC))]
  */
 #define IA32_X2APIC_APICID                                           0x00000802
+#define IA32_X2APIC_APICID_SLOT                                      225
 
 /**
  * x2APIC Version Register.
@@ -14650,6 +16170,7 @@ typedef union
  * @remarks If CPUID.01H:ECX.[21] = 1 && IA32_APIC_BASE.[10] = 1
  */
 #define IA32_X2APIC_VERSION                                          0x00000803
+#define IA32_X2APIC_VERSION_SLOT                                     504
 
 /**
  * x2APIC Task Priority Register.
@@ -14657,6 +16178,7 @@ typedef union
  * @remarks If CPUID.01H:ECX.[21] = 1 && IA32_APIC_BASE.[10] = 1
  */
 #define IA32_X2APIC_TPR                                              0x00000808
+#define IA32_X2APIC_TPR_SLOT                                         320
 
 /**
  * x2APIC Processor Priority Register.
@@ -14664,6 +16186,7 @@ typedef union
  * @remarks If CPUID.01H:ECX.[21] = 1 && IA32_APIC_BASE.[10] = 1
  */
 #define IA32_X2APIC_PPR                                              0x0000080A
+#define IA32_X2APIC_PPR_SLOT                                         349
 
 /**
  * x2APIC EOI Register.
@@ -14671,13 +16194,62 @@ typedef union
  * @remarks If CPUID.01H:ECX.[21] = 1 && IA32_APIC_BASE.[10] = 1
  */
 #define IA32_X2APIC_EOI                                              0x0000080B
+#define IA32_X2APIC_EOI_SLOT                                         105
 
 /**
  * x2APIC Logical Destination Register.
  *
  * @remarks If CPUID.01H:ECX.[21] = 1 && IA32_APIC_BASE.[10] = 1
+ * @see Vol3A[11.12.10.2(Deriving Logical x2APIC ID from the Local x2APIC ID)]
  */
 #define IA32_X2APIC_LDR                                              0x0000080D
+#define IA32_X2APIC_LDR_SLOT                                         143
+typedef union
+{
+  struct
+  {
+    /**
+     * [Bits 15:0] Bit (x2APIC ID & 0FH) identifying the logical processor within its cluster. Logical destinations of one
+     * cluster can be ORed together to address up to 16 processors with a single IPI.
+     */
+    uint64_t logical_id                                              : 16;
+#define IA32_X2APIC_LDR_LOGICAL_ID_BIT                               0
+#define IA32_X2APIC_LDR_LOGICAL_ID_FLAG                              0xFFFF
+#define IA32_X2APIC_LDR_LOGICAL_ID_MASK                              0xFFFF
+#define IA32_X2APIC_LDR_LOGICAL_ID(_)                                (((_) >> 0) & 0xFFFF)
+    /**
+     * Logical ID of the processor with x2APIC ID _.
+     */
+#define IA32_X2APIC_LDR_LOGICAL_ID_FROM_APIC_ID(_)                   (1U << ((_) & 0x0F))
+
+    /**
+     * [Bits 31:16] Cluster ID (x2APIC ID >> 4).
+     */
+    uint64_t cluster_id                                              : 16;
+#define IA32_X2APIC_LDR_CLUSTER_ID_BIT                               16
+#define IA32_X2APIC_LDR_CLUSTER_ID_FLAG                              0xFFFF0000
+#define IA32_X2APIC_LDR_CLUSTER_ID_MASK                              0xFFFF
+#define IA32_X2APIC_LDR_CLUSTER_ID(_)                                (((_) >> 16) & 0xFFFF)
+    /**
+     * Cluster ID of the processor with x2APIC ID _.
+     */
+#define IA32_X2APIC_LDR_CLUSTER_ID_FROM_APIC_ID(_)                   ((_) >> 4)
+
+    /**
+     * Maximum number of processors of a cluster.
+     */
+#define IA32_X2APIC_LDR_CLUSTER_ID_SIZE                              0x00000010
+    uint64_t reserved1                                               : 32;
+  };
+
+  uint64_t flags;
+} ia32_x2apic_ldr_register;
+#define IA32_X2APIC_LDR_RESERVED_BITS                                0xFFFFFFFF00000000
+
+/**
+ * Logical x2APIC ID of the processor with x2APIC ID _.
+ */
+#define IA32_X2APIC_LDR_FROM_APIC_ID(_)                              (((((_) >> 4) & 0xFFFFU) << 16) | (1U << ((_) & 0x0F)))
 
 /**
  * x2APIC Spurious Interrupt Vector Register.
@@ -14685,6 +16257,7 @@ typedef union
  * @remarks If CPUID.01H:ECX.[21] = 1 && IA32_APIC_BASE.[10] = 1
  */
 #define IA32_X2APIC_SIVR                                             0x0000080F
+#define IA32_X2APIC_SIVR_SLOT                                        172
 /**
  * @defgroup ia32_x2apic_isr \
  *           IA32_X2APIC_ISR(n)
@@ -14695,13 +16268,21 @@ typedef union
  * @{
  */
 #define IA32_X2APIC_ISR0                                             0x00000810
+#define IA32_X2APIC_ISR0_SLOT                                        440
 #define IA32_X2APIC_ISR1                                             0x00000811
+#define IA32_X2APIC_ISR1_SLOT                                        206
 #define IA32_X2APIC_ISR2                                             0x00000812
+#define IA32_X2APIC_ISR2_SLOT                                        478
 #define IA32_X2APIC_ISR3                                             0x00000813
+#define IA32_X2APIC_ISR3_SLOT                                        237
 #define IA32_X2APIC_ISR4                                             0x00000814
+#define IA32_X2APIC_ISR4_SLOT                                        510
 #define IA32_X2APIC_ISR5                                             0x00000815
+#define IA32_X2APIC_ISR5_SLOT                                        270
 #define IA32_X2APIC_ISR6                                             0x00000816
+#define IA32_X2APIC_ISR6_SLOT                                        30
 #define IA32_X2APIC_ISR7                                             0x00000817
+#define IA32_X2APIC_ISR7_SLOT                                        295
 /**
  * @}
  */
@@ -14716,13 +16297,21 @@ typedef union
  * @{
  */
 #define IA32_X2APIC_TMR0                                             0x00000818
+#define IA32_X2APIC_TMR0_SLOT                                        61
 #define IA32_X2APIC_TMR1                                             0x00000819
+#define IA32_X2APIC_TMR1_SLOT                                        325
 #define IA32_X2APIC_TMR2                                             0x0000081A
+#define IA32_X2APIC_TMR2_SLOT                                        94
 #define IA32_X2APIC_TMR3                                             0x0000081B
+#define IA32_X2APIC_TMR3_SLOT                                        360
 #define IA32_X2APIC_TMR4                                             0x0000081C
+#define IA32_X2APIC_TMR4_SLOT                                        116
 #define IA32_X2APIC_TMR5                                             0x0000081D
+#define IA32_X2APIC_TMR5_SLOT                                        398
 #define IA32_X2APIC_TMR6                                             0x0000081E
+#define IA32_X2APIC_TMR6_SLOT                                        158
 #define IA32_X2APIC_TMR7                                             0x0000081F
+#define IA32_X2APIC_TMR7_SLOT                                        429
 /**
  * @}
  */
@@ -14737,13 +16326,21 @@ typedef union
  * @{
  */
 #define IA32_X2APIC_IRR0                                             0x00000820
+#define IA32_X2APIC_IRR0_SLOT                                        188
 #define IA32_X2APIC_IRR1                                             0x00000821
+#define IA32_X2APIC_IRR1_SLOT                                        460
 #define IA32_X2APIC_IRR2                                             0x00000822
+#define IA32_X2APIC_IRR2_SLOT                                        222
 #define IA32_X2APIC_IRR3                                             0x00000823
+#define IA32_X2APIC_IRR3_SLOT                                        492
 #define IA32_X2APIC_IRR4                                             0x00000824
+#define IA32_X2APIC_IRR4_SLOT                                        251
 #define IA32_X2APIC_IRR5                                             0x00000825
+#define IA32_X2APIC_IRR5_SLOT                                        11
 #define IA32_X2APIC_IRR6                                             0x00000826
+#define IA32_X2APIC_IRR6_SLOT                                        283
 #define IA32_X2APIC_IRR7                                             0x00000827
+#define IA32_X2APIC_IRR7_SLOT                                        42
 /**
  * @}
  */
@@ -14755,6 +16352,7 @@ typedef union
  * @remarks If CPUID.01H:ECX.[21] = 1 && IA32_APIC_BASE.[10] = 1
  */
 #define IA32_X2APIC_ESR                                              0x00000828
+#define IA32_X2APIC_ESR_SLOT                                         313
 
 /**
  * x2APIC LVT Corrected Machine Check Interrupt Register.
@@ -14762,13 +16360,114 @@ typedef union
  * @remarks If CPUID.01H:ECX.[21] = 1 && IA32_APIC_BASE.[10] = 1
  */
 #define IA32_X2APIC_LVT_CMCI                                         0x0000082F
+#define IA32_X2APIC_LVT_CMCI_SLOT                                    171
 
 /**
  * x2APIC Interrupt Command Register.
  *
  * @remarks If CPUID.01H:ECX.[21] = 1 && IA32_APIC_BASE.[10] = 1
+ * @see Vol3A[11.12.9(ICR Operation in x2APIC Mode)]
  */
 #define IA32_X2APIC_ICR                                              0x00000830
+#define IA32_X2APIC_ICR_SLOT                                         443
+typedef union
+{
+  struct
+  {
+    /**
+     * [Bits 7:0] Vector number of the interrupt being sent.
+     */
+    uint64_t vector                                                  : 8;
+#define IA32_X2APIC_ICR_VECTOR_BIT                                   0
+#define IA32_X2APIC_ICR_VECTOR_FLAG                                  0xFF
+#define IA32_X2APIC_ICR_VECTOR_MASK                                  0xFF
+#define IA32_X2APIC_ICR_VECTOR(_)                                    (((_) >> 0) & 0xFF)
+
+    /**
+     * [Bits 10:8] Type of IPI to be sent.
+     */
+    uint64_t delivery_mode                                           : 3;
+#define IA32_X2APIC_ICR_DELIVERY_MODE_BIT                            8
+#define IA32_X2APIC_ICR_DELIVERY_MODE_FLAG                           0x700
+#define IA32_X2APIC_ICR_DELIVERY_MODE_MASK                           0x07
+#define IA32_X2APIC_ICR_DELIVERY_MODE(_)                             (((_) >> 8) & 0x07)
+#define IA32_X2APIC_ICR_DELIVERY_MODE_FIXED                          0x00000000
+#define IA32_X2APIC_ICR_DELIVERY_MODE_LOWEST_PRIORITY                0x00000001
+#define IA32_X2APIC_ICR_DELIVERY_MODE_SMI                            0x00000002
+#define IA32_X2APIC_ICR_DELIVERY_MODE_NMI                            0x00000004
+#define IA32_X2APIC_ICR_DELIVERY_MODE_INIT                           0x00000005
+#define IA32_X2APIC_ICR_DELIVERY_MODE_STARTUP                        0x00000006
+
+    /**
+     * [Bit 11] Selects physical (0) or logical (1) destination mode.
+     */
+    uint64_t destination_mode                                        : 1;
+#define IA32_X2APIC_ICR_DESTINATION_MODE_BIT                         11
+#define IA32_X2APIC_ICR_DESTINATION_MODE_FLAG                        0x800
+#define IA32_X2APIC_ICR_DESTINATION_MODE_MASK                        0x01
+#define IA32_X2APIC_ICR_DESTINATION_MODE(_)                          (((_) >> 11) & 0x01)
+#define IA32_X2APIC_ICR_DESTINATION_MODE_PHYSICAL                    0x00000000
+#define IA32_X2APIC_ICR_DESTINATION_MODE_LOGICAL                     0x00000001
+    uint64_t reserved1                                               : 2;
+
+    /**
+     * [Bit 14] For the INIT level de-assert delivery mode this flag must be set to 0; for all other delivery modes it must be
+     * set to 1.
+     */
+    uint64_t level                                                   : 1;
+#define IA32_X2APIC_ICR_LEVEL_BIT                                    14
+#define IA32_X2APIC_ICR_LEVEL_FLAG                                   0x4000
+#define IA32_X2APIC_ICR_LEVEL_MASK                                   0x01
+#define IA32_X2APIC_ICR_LEVEL(_)                                     (((_) >> 14) & 0x01)
+
+    /**
+     * [Bit 15] Selects the trigger mode when using the INIT level de-assert delivery mode, edge (0) or level (1).
+     */
+    uint64_t trigger_mode                                            : 1;
+#define IA32_X2APIC_ICR_TRIGGER_MODE_BIT                             15
+#define IA32_X2APIC_ICR_TRIGGER_MODE_FLAG                            0x8000
+#define IA32_X2APIC_ICR_TRIGGER_MODE_MASK                            0x01
+#define IA32_X2APIC_ICR_TRIGGER_MODE(_)                              (((_) >> 15) & 0x01)
+    uint64_t reserved2                                               : 2;
+
+    /**
+     * [Bits 19:18] Indicates whether a shorthand notation is used to specify the destination of the interrupt.
+     */
+    uint64_t destination_shorthand                                   : 2;
+#define IA32_X2APIC_ICR_DESTINATION_SHORTHAND_BIT                    18
+#define IA32_X2APIC_ICR_DESTINATION_SHORTHAND_FLAG                   0xC0000
+#define IA32_X2APIC_ICR_DESTINATION_SHORTHAND_MASK                   0x03
+#define IA32_X2APIC_ICR_DESTINATION_SHORTHAND(_)                     (((_) >> 18) & 0x03)
+#define IA32_X2APIC_ICR_DESTINATION_SHORTHAND_NONE                   0x00000000
+#define IA32_X2APIC_ICR_DESTINATION_SHORTHAND_SELF                   0x00000001
+#define IA32_X2APIC_ICR_DESTINATION_SHORTHAND_ALL_INCLUDING_SELF     0x00000002
+#define IA32_X2APIC_ICR_DESTINATION_SHORTHAND_ALL_EXCLUDING_SELF     0x00000003
+    uint64_t reserved3                                               : 12;
+
+    /**
+     * [Bits 63:32] x2APIC ID of the target processor in physical destination mode, or logical x2APIC ID (cluster ID in bits
+     * 31:16, ORed logical IDs of the target processors of the cluster in bits 15:0) in logical destination mode.
+     */
+    uint64_t destination                                             : 32;
+#define IA32_X2APIC_ICR_DESTINATION_BIT                              32
+#define IA32_X2APIC_ICR_DESTINATION_FLAG                             0xFFFFFFFF00000000
+#define IA32_X2APIC_ICR_DESTINATION_MASK                             0xFFFFFFFF
+#define IA32_X2APIC_ICR_DESTINATION(_)                               (((_) >> 32) & 0xFFFFFFFF)
+    /**
+     * Logical destination addressing processors _logical_ids (ORed logical IDs) of cluster _cluster.
+     */
+#define IA32_X2APIC_ICR_DESTINATION_LOGICAL(_cluster, _logical_ids)  (((_cluster) << 16) | (_logical_ids))
+  };
+
+  uint64_t flags;
+} ia32_x2apic_icr_register;
+#define IA32_X2APIC_ICR_RESERVED_BITS                                0xFFF33000
+
+/**
+ * ICR value of an edge-triggered IPI with vector _vector and delivery mode _delivery_mode to destination _destination in
+ * destination mode _destination_mode (0 - physical, 1 - logical).
+ */
+#define IA32_X2APIC_ICR_VALUE(_destination, _vector, _delivery_mode, _destination_mode) (((_destination) * 0x100000000ULL) | ((_delivery_mode) << 8) | ((_destination_mode) << 11) | 0x4000 | (_vector))
 
 /**
  * x2APIC LVT Timer Interrupt Register.
@@ -14776,6 +16475,7 @@ typedef union
  * @remarks If CPUID.01H:ECX.[21] = 1 && IA32_APIC_BASE.[10] = 1
  */
 #define IA32_X2APIC_LVT_TIMER                                        0x00000832
+#define IA32_X2APIC_LVT_TIMER_SLOT                                   477
 
 /**
  * x2APIC LVT Thermal Sensor Interrupt Register.
@@ -14783,6 +16483,7 @@ typedef union
  * @remarks If CPUID.01H:ECX.[21] = 1 && IA32_APIC_BASE.[10] = 1
  */
 #define IA32_X2APIC_LVT_THERMAL                                      0x00000833
+#define IA32_X2APIC_LVT_THERMAL_SLOT                                 238
 
 /**
  * x2APIC LVT Performance Monitor Interrupt Register.
@@ -14790,6 +16491,7 @@ typedef union
  * @remarks If CPUID.01H:ECX.[21] = 1 && IA32_APIC_BASE.[10] = 1
  */
 #define IA32_X2APIC_LVT_PMI                                          0x00000834
+#define IA32_X2APIC_LVT_PMI_SLOT                                     505
 
 /**
  * x2APIC LVT LINT0 Register.
@@ -14797,6 +16499,7 @@ typedef union
  * @remarks If CPUID.01H:ECX.[21] = 1 && IA32_APIC_BASE.[10] = 1
  */
 #define IA32_X2APIC_LVT_LINT0                                        0x00000835
+#define IA32_X2APIC_LVT_LINT0_SLOT                                   264
 
 /**
  * x2APIC LVT LINT1 Register.
@@ -14804,6 +16507,7 @@ typedef union
  * @remarks If CPUID.01H:ECX.[21] = 1 && IA32_APIC_BASE.[10] = 1
  */
 #define IA32_X2APIC_LVT_LINT1                                        0x00000836
+#define IA32_X2APIC_LVT_LINT1_SLOT                                   26
 
 /**
  * x2APIC LVT Error Register.
@@ -14811,6 +16515,7 @@ typedef union
  * @remarks If CPUID.01H:ECX.[21] = 1 && IA32_APIC_BASE.[10] = 1
  */
 #define IA32_X2APIC_LVT_ERROR                                        0x00000837
+#define IA32_X2APIC_LVT_ERROR_SLOT                                   299
 
 /**
  * x2APIC Initial Count Register.
@@ -14818,6 +16523,7 @@ typedef union
  * @remarks If CPUID.01H:ECX.[21] = 1 && IA32_APIC_BASE.[10] = 1
  */
 #define IA32_X2APIC_INIT_COUNT                                       0x00000838
+#define IA32_X2APIC_INIT_COUNT_SLOT                                  51
 
 /**
  * x2APIC Current Count Register.
@@ -14825,6 +16531,7 @@ typedef union
  * @remarks If CPUID.01H:ECX.[21] = 1 && IA32_APIC_BASE.[10] = 1
  */
 #define IA32_X2APIC_CUR_COUNT                                        0x00000839
+#define IA32_X2APIC_CUR_COUNT_SLOT                                   328
 
 /**
  * x2APIC Divide Configuration Register.
@@ -14832,6 +16539,7 @@ typedef union
  * @remarks If CPUID.01H:ECX.[21] = 1 && IA32_APIC_BASE.[10] = 1
  */
 #define IA32_X2APIC_DIV_CONF                                         0x0000083E
+#define IA32_X2APIC_DIV_CONF_SLOT                                    159
 
 /**
  * x2APIC Self IPI Register.
@@ -14839,6 +16547,7 @@ typedef union
  * @remarks If CPUID.01H:ECX.[21] = 1 && IA32_APIC_BASE.[10] = 1
  */
 #define IA32_X2APIC_SELF_IPI                                         0x0000083F
+#define IA32_X2APIC_SELF_IPI_SLOT                                    423
 
 /**
  * Silicon Debug Feature Control.
@@ -14846,6 +16555,7 @@ typedef union
  * @remarks If CPUID.01H:ECX.[11] = 1
  */
 #define IA32_DEBUG_INTERFACE                                         0x00000C80
+#define IA32_DEBUG_INTERFACE_SLOT                                    6
 typedef union
 {
   struct
@@ -14895,6 +16605,7 @@ typedef union
 
   uint64_t flags;
 } ia32_debug_interface_register;
+#define IA32_DEBUG_INTERFACE_RESERVED_BITS                           0xFFFFFFFF3FFFFFFE
 
 
 /**
@@ -14903,6 +16614,7 @@ typedef union
  * @remarks If ( CPUID.(EAX=10H, ECX=1):ECX.[2] = 1 )
  */
 #define IA32_L3_QOS_CFG                                              0x00000C81
+#define IA32_L3_QOS_CFG_SLOT                                         284
 typedef union
 {
   struct
@@ -14922,6 +16634,7 @@ typedef union
 
   uint64_t flags;
 } ia32_l3_qos_cfg_register;
+#define IA32_L3_QOS_CFG_RESERVED_BITS                                0xFFFFFFFFFFFFFFFE
 
 
 /**
@@ -14930,6 +16643,7 @@ typedef union
  * @remarks If ( CPUID.(EAX=10H, ECX=2):ECX.[2] = 1 )
  */
 #define IA32_L2_QOS_CFG                                              0x00000C82
+#define IA32_L2_QOS_CFG_SLOT                                         46
 typedef union
 {
   struct
@@ -14949,6 +16663,7 @@ typedef union
 
   uint64_t flags;
 } ia32_l2_qos_cfg_register;
+#define IA32_L2_QOS_CFG_RESERVED_BITS                                0xFFFFFFFFFFFFFFFE
 
 
 /**
@@ -14957,6 +16672,7 @@ typedef union
  * @remarks If ( CPUID.(EAX=07H, ECX=0):EBX.[12] = 1 )
  */
 #define IA32_QM_EVTSEL                                               0x00000C8D
+#define IA32_QM_EVTSEL_SLOT                                          471
 typedef union
 {
   struct
@@ -14989,6 +16705,7 @@ typedef union
 
   uint64_t flags;
 } ia32_qm_evtsel_register;
+#define IA32_QM_EVTSEL_RESERVED_BITS                                 0xFFFFFF00
 
 
 /**
@@ -14997,6 +16714,7 @@ typedef union
  * @remarks If ( CPUID.(EAX=07H, ECX=0):EBX.[12] = 1 )
  */
 #define IA32_QM_CTR                                                  0x00000C8E
+#define IA32_QM_CTR_SLOT                                             232
 typedef union
 {
   struct
@@ -15035,6 +16753,7 @@ typedef union
 
   uint64_t flags;
 } ia32_qm_ctr_register;
+#define IA32_QM_CTR_RESERVED_BITS                                    0x00
 
 
 /**
@@ -15043,6 +16762,7 @@ typedef union
  * @remarks If ( (CPUID.(EAX=07H, ECX=0):EBX[12] = 1) or (CPUID.(EAX=07H, ECX=0):EBX[15] = 1 ) )
  */
 #define IA32_PQR_ASSOC                                               0x00000C8F
+#define IA32_PQR_ASSOC_SLOT                                          498
 typedef union
 {
   struct
@@ -15076,6 +16796,7 @@ typedef union
 
   uint64_t flags;
 } ia32_pqr_assoc_register;
+#define IA32_PQR_ASSOC_RESERVED_BITS                                 0x00
 
 
 /**
@@ -15084,6 +16805,7 @@ typedef union
  * @remarks If (CPUID.(EAX=07H, ECX=0H):EBX[14] = 1)
  */
 #define IA32_BNDCFGS                                                 0x00000D90
+#define IA32_BNDCFGS_SLOT                                            230
 typedef union
 {
   struct
@@ -15119,6 +16841,7 @@ typedef union
 
   uint64_t flags;
 } ia32_bndcfgs_register;
+#define IA32_BNDCFGS_RESERVED_BITS                                   0xFFC
 
 
 /**
@@ -15127,6 +16850,7 @@ typedef union
  * @remarks If ( CPUID.(0DH, 1):EAX.[3] = 1
  */
 #define IA32_XSS                                                     0x00000DA0
+#define IA32_XSS_SLOT                                                481
 typedef union
 {
   struct
@@ -15141,19 +16865,85 @@ typedef union
 #define IA32_XSS_TRACE_PACKET_CONFIGURATION_STATE_FLAG               0x100
 #define IA32_XSS_TRACE_PACKET_CONFIGURATION_STATE_MASK               0x01
 #define IA32_XSS_TRACE_PACKET_CONFIGURATION_STATE(_)                 (((_) >> 8) & 0x01)
-    uint64_t reserved2                                               : 55;
-  };
+    uint64_t reserved2                                               : 1;
 
-  uint64_t flags;
-} ia32_xss_register;
+    /**
+     * [Bit 10] PASID State.
+     */
+    uint64_t pasid_state                                             : 1;
+#define IA32_XSS_PASID_STATE_BIT                                     10
+#define IA32_XSS_PASID_STATE_FLAG                                    0x400
+#define IA32_XSS_PASID_STATE_MASK                                    0x01
+#define IA32_XSS_PASID_STATE(_)                                      (((_) >> 10) & 0x01)
 
+    /**
+     * [Bit 11] CET User State.
+     */
+    uint64_t cet_user_state                                          : 1;
+#define IA32_XSS_CET_USER_STATE_BIT                                  11
+#define IA32_XSS_CET_USER_STATE_FLAG                                 0x800
+#define IA32_XSS_CET_USER_STATE_MASK                                 0x01
+#define IA32_XSS_CET_USER_STATE(_)                                   (((_) >> 11) & 0x01)
 
-/**
- * Package Level Enable/disable HDC.
- *
- * @remarks If CPUID.06H:EAX.[13] = 1
- */
+    /**
+     * [Bit 12] CET Supervisor State.
+     */
+    uint64_t cet_supervisor_state                                    : 1;
+#define IA32_XSS_CET_SUPERVISOR_STATE_BIT                            12
+#define IA32_XSS_CET_SUPERVISOR_STATE_FLAG                           0x1000
+#define IA32_XSS_CET_SUPERVISOR_STATE_MASK                           0x01
+#define IA32_XSS_CET_SUPERVISOR_STATE(_)                             (((_) >> 12) & 0x01)
+
+    /**
+     * [Bit 13] HDC State.
+     */
+    uint64_t hdc_state                                               : 1;
+#define IA32_XSS_HDC_STATE_BIT                                       13
+#define IA32_XSS_HDC_STATE_FLAG                                      0x2000
+#define IA32_XSS_HDC_STATE_MASK                                      0x01
+#define IA32_XSS_HDC_STATE(_)                                        (((_) >> 13) & 0x01)
+
+    /**
+     * [Bit 14] User Interrupt State.
+     */
+    uint64_t uintr_state                                             : 1;
+#define IA32_XSS_UINTR_STATE_BIT                                     14
+#define IA32_XSS_UINTR_STATE_FLAG                                    0x4000
+#define IA32_XSS_UINTR_STATE_MASK                                    0x01
+#define IA32_XSS_UINTR_STATE(_)                                      (((_) >> 14) & 0x01)
+
+    /**
+     * [Bit 15] Architectural LBR State.
+     */
+    uint64_t lbr_state                                               : 1;
+#define IA32_XSS_LBR_STATE_BIT                                       15
+#define IA32_XSS_LBR_STATE_FLAG                                      0x8000
+#define IA32_XSS_LBR_STATE_MASK                                      0x01
+#define IA32_XSS_LBR_STATE(_)                                        (((_) >> 15) & 0x01)
+
+    /**
+     * [Bit 16] HWP State.
+     */
+    uint64_t hwp_state                                               : 1;
+#define IA32_XSS_HWP_STATE_BIT                                       16
+#define IA32_XSS_HWP_STATE_FLAG                                      0x10000
+#define IA32_XSS_HWP_STATE_MASK                                      0x01
+#define IA32_XSS_HWP_STATE(_)                                        (((_) >> 16) & 0x01)
+    uint64_t reserved3                                               : 47;
+  };
+
+  uint64_t flags;
+} ia32_xss_register;
+#define IA32_XSS_RESERVED_BITS                                       0xFFFFFFFFFFFE02FF
+
+
+/**
+ * Package Level Enable/disable HDC.
+ *
+ * @remarks If CPUID.06H:EAX.[13] = 1
+ */
 #define IA32_PKG_HDC_CTL                                             0x00000DB0
+#define IA32_PKG_HDC_CTL_SLOT                                        223
 typedef union
 {
   struct
@@ -15176,6 +16966,7 @@ typedef union
 
   uint64_t flags;
 } ia32_pkg_hdc_ctl_register;
+#define IA32_PKG_HDC_CTL_RESERVED_BITS                               0xFFFFFFFFFFFFFFFE
 
 
 /**
@@ -15184,6 +16975,7 @@ typedef union
  * @remarks If CPUID.06H:EAX.[13] = 1
  */
 #define IA32_PM_CTL1                                                 0x00000DB1
+#define IA32_PM_CTL1_SLOT                                            486
 typedef union
 {
   struct
@@ -15206,6 +16998,7 @@ typedef union
 
   uint64_t flags;
 } ia32_pm_ctl1_register;
+#define IA32_PM_CTL1_RESERVED_BITS                                   0xFFFFFFFFFFFFFFFE
 
 
 /**
@@ -15214,6 +17007,7 @@ typedef union
  * @remarks If CPUID.06H:EAX.[13] = 1
  */
 #define IA32_THREAD_STALL                                            0x00000DB2
+#define IA32_THREAD_STALL_SLOT                                       253
 typedef struct
 {
   /**
@@ -15234,6 +17028,7 @@ typedef struct
  * @remarks If CPUID.06H:EAX.[13] = 1
  */
 #define IA32_EFER                                                    0xC0000080
+#define IA32_EFER_SLOT                                               106
 typedef union
 {
   struct
@@ -15286,6 +17081,7 @@ typedef union
 
   uint64_t flags;
 } ia32_efer_register;
+#define IA32_EFER_RESERVED_BITS                                      0xFFFFFFFFFFFFF2FE
 
 
 /**
@@ -15294,6 +17090,7 @@ typedef union
  * @remarks If CPUID.80000001:EDX.[29] = 1
  */
 #define IA32_STAR                                                    0xC0000081
+#define IA32_STAR_SLOT                                               363
 
 /**
  * @brief IA-32e Mode System Call Target Address <b>(R/W)</b>
@@ -15303,6 +17100,7 @@ typedef union
  * @remarks If CPUID.80000001:EDX.[29] = 1
  */
 #define IA32_LSTAR                                                   0xC0000082
+#define IA32_LSTAR_SLOT                                              139
 
 /**
  * @brief IA-32e Mode System Call Target Address <b>(R/W)</b>
@@ -15312,6 +17110,7 @@ typedef union
  * @remarks If CPUID.80000001:EDX.[29] = 1
  */
 #define IA32_CSTAR                                                   0xC0000083
+#define IA32_CSTAR_SLOT                                              402
 
 /**
  * System Call Flag Mask.
@@ -15319,6 +17118,7 @@ typedef union
  * @remarks If CPUID.80000001:EDX.[29] = 1
  */
 #define IA32_FMASK                                                   0xC0000084
+#define IA32_FMASK_SLOT                                              173
 
 /**
  * Map of BASE Address of FS.
@@ -15326,6 +17126,7 @@ typedef union
  * @remarks If CPUID.80000001:EDX.[29] = 1
  */
 #define IA32_FS_BASE                                                 0xC0000100
+#define IA32_FS_BASE_SLOT                                            93
 
 /**
  * Map of BASE Address of GS.
@@ -15333,6 +17134,7 @@ typedef union
  * @remarks If CPUID.80000001:EDX.[29] = 1
  */
 #define IA32_GS_BASE                                                 0xC0000101
+#define IA32_GS_BASE_SLOT                                            369
 
 /**
  * Swap Target of BASE Address of GS.
@@ -15340,6 +17142,7 @@ typedef union
  * @remarks If CPUID.80000001:EDX.[29] = 1
  */
 #define IA32_KERNEL_GS_BASE                                          0xC0000102
+#define IA32_KERNEL_GS_BASE_SLOT                                     113
 
 /**
  * Auxiliary TSC.
@@ -15347,6 +17150,7 @@ typedef union
  * @remarks If CPUID.80000001H: EDX[27] = 1 or CPUID.(EAX=7,ECX=0):ECX[bit 22] = 1
  */
 #define IA32_TSC_AUX                                                 0xC0000103
+#define IA32_TSC_AUX_SLOT                                            407
 typedef union
 {
   struct
@@ -15364,7 +17168,318 @@ typedef union
 
   uint64_t flags;
 } ia32_tsc_aux_register;
-
+#define IA32_TSC_AUX_RESERVED_BITS                                   0xFFFFFFFF00000000
+
+/**
+ * @brief Number of slots in the IA32_MSR_SLOT table
+ */
+#define IA32_MSR_SLOT_COUNT                                          512
+
+/**
+ * @brief Index into the IA32_MSR_SLOT_DISPLACEMENT table
+ */
+#define IA32_MSR_SLOT_BUCKET(_)                                      ((((uint32_t)(_)) * 0x01F7577D) >> 25)
+
+/**
+ * @brief Slot of the address in the IA32_MSR_SLOT table
+ *
+ * Every address defined in this group maps to its own slot (see *_SLOT definitions).
+ * Other addresses map to arbitrary slot, therefore the address held by the slot must be compared
+ * with the looked up address. _displacement is an array initialized with IA32_MSR_SLOT_DISPLACEMENT_INITIALIZER.
+ */
+#define IA32_MSR_SLOT(_, _displacement)                              (((((uint32_t)(_)) * 0x87EC17FB) >> 23) ^ ((_displacement)[IA32_MSR_SLOT_BUCKET(_)]))
+
+/**
+ * @brief Initializer of IA32_MSR_SLOT_DISPLACEMENT table
+ */
+#define IA32_MSR_SLOT_DISPLACEMENT_INITIALIZER                       \
+{                                                                    \
+  0x0000, 0x0000, 0x0000, 0x0001, 0x0002, 0x0000, 0x0001, 0x0003,    \
+  0x0000, 0x0000, 0x0009, 0x0001, 0x0001, 0x0003, 0x0004, 0x0007,    \
+  0x0000, 0x0001, 0x0003, 0x0003, 0x000B, 0x0000, 0x0001, 0x0005,    \
+  0x0003, 0x0000, 0x0008, 0x0000, 0x0000, 0x0001, 0x0000, 0x0001,    \
+  0x0000, 0x0000, 0x0000, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000,    \
+  0x0002, 0x0003, 0x0006, 0x0007, 0x0003, 0x0003, 0x0005, 0x0003,    \
+  0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0000, 0x0001, 0x0000,    \
+  0x0000, 0x0003, 0x0000, 0x0001, 0x0003, 0x0000, 0x0009, 0x0011,    \
+  0x0003, 0x0004, 0x0001, 0x0001, 0x0000, 0x0001, 0x0013, 0x0001,    \
+  0x0000, 0x0008, 0x0002, 0x0000, 0x0008, 0x000A, 0x0000, 0x0001,    \
+  0x0000, 0x0000, 0x0000, 0x0001, 0x0000, 0x0002, 0x000B, 0x0004,    \
+  0x000E, 0x0000, 0x0003, 0x0005, 0x0019, 0x0006, 0x0010, 0x0000,    \
+  0x0009, 0x0006, 0x0009, 0x001A, 0x0009, 0x0000, 0x0000, 0x0002,    \
+  0x0006, 0x0002, 0x0000, 0x0003, 0x0003, 0x0007, 0x0000, 0x0000,    \
+  0x0003, 0x0000, 0x0000, 0x000A, 0x0000, 0x0008, 0x0003, 0x0005,    \
+  0x0009, 0x0002, 0x0002, 0x0001, 0x0000, 0x0000, 0x0002, 0x0000,    \
+}
+
+/**
+ * @brief Initializer of { address, reserved bits, address bits } entries of the IA32_MSR_SLOT table
+ *
+ * Value written to the address held by the slot is valid only if
+ * (value & (reserved bits | (address bits & ~((1ULL << MAXPHYADDR) - 1)))) == 0, where address bits
+ * are bits of physical-address fields (up to bit 51) and MAXPHYADDR is the physical-address
+ * width of the processor. Addresses without bitfield hold no reserved bits, so any value passes.
+ * Unused slots hold address 0xFFFFFFFF and all bits reserved.
+ */
+#define IA32_MSR_SLOT_INITIALIZER                                                                                 \
+{                                                                                                                 \
+  { 0x00000000, 0x0000000000000000, 0x0000000000000000 }, { 0x0000046C, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x0000045B, 0x0000000000000000, 0x0000000000000000 }, { 0x0000048C, 0xFFC0F0FEF90CBEBE, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0x0000043B, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x00000C80, 0xFFFFFFFF3FFFFFFE, 0x0000000000000000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0x000000C2, 0x0000000000000000, 0x0000000000000000 }, { 0x00000297, 0xFFFFFFFFBFFF8000, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0x00000825, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x0000041B, 0x0000000000000000, 0x0000000000000000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0x00000277, 0xF8F8F8F8F8F8F8F8, 0x0000000000000000 }, { 0x00000206, 0xFFF0000000000F00, 0x000FFFFFFFFFF000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0x00000175, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x00000774, 0xFFFFF80000000000, 0x0000000000000000 }, { 0x0000044C, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0x0000042C, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x00000836, 0x0000000000000000, 0x0000000000000000 }, { 0x00000288, 0xFFFFFFFFBFFF8000, 0x0000000000000000 }, \
+  { 0x0000040C, 0x0000000000000000, 0x0000000000000000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0x00000816, 0x0000000000000000, 0x0000000000000000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0x0000045D, 0x0000000000000000, 0x0000000000000000 }, { 0x0000043D, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x000000C4, 0x0000000000000000, 0x0000000000000000 }, { 0x00000186, 0xFFFFFFFF00000000, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0x00000268, 0x0000000000000000, 0x0000000000000000 }, { 0x0000030A, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x0000048E, 0x0000000000000000, 0x0000000000000000 }, { 0x00000570, 0xFE7F000070840000, 0x0000000000000000 }, \
+  { 0x00000827, 0x0000000000000000, 0x0000000000000000 }, { 0x00000299, 0xFFFFFFFFBFFF8000, 0x0000000000000000 }, \
+  { 0x0000046E, 0x0000000000000000, 0x0000000000000000 }, { 0x0000041D, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x00000C82, 0xFFFFFFFFFFFFFFFE, 0x0000000000000000 }, { 0x00000208, 0xFFF0000000000F00, 0x000FFFFFFFFFF000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0x00000561, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x00000259, 0x0000000000000000, 0x0000000000000000 }, { 0x00000838, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0x0000044E, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x00000581, 0x0000000000000000, 0x0000000000000000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0x0000042E, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x0000028A, 0xFFFFFFFFBFFF8000, 0x0000000000000000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0x00000818, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x0000040E, 0x0000000000000000, 0x0000000000000000 }, { 0x0000026A, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x000000C6, 0x0000000000000000, 0x0000000000000000 }, { 0x000004D0, 0xFFFFFFFFFFFFFFFE, 0x0000000000000000 }, \
+  { 0x000001F9, 0x0000000000000000, 0x0000000000000000 }, { 0x00000188, 0xFFFFFFFF00000000, 0x0000000000000000 }, \
+  { 0x00000572, 0x000000000000001F, 0x0000000000000000 }, { 0x0000043F, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x000001D9, 0xFFFFFFFFFFFF003C, 0x0000000000000000 }, { 0x000006A5, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x0000041F, 0x0000000000000000, 0x0000000000000000 }, { 0x0000045F, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x00000490, 0x0000000000000000, 0x0000000000000000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0x0000020A, 0xFFF0000000000F00, 0x000FFFFFFFFFF000 }, { 0x0000029B, 0xFFFFFFFFBFFF8000, 0x0000000000000000 }, \
+  { 0x0000038E, 0x037FFFF8FFFFFFF0, 0x0000000000000000 }, { 0x000004C1, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x000000E8, 0x0000000000000000, 0x0000000000000000 }, { 0x00000199, 0xFFFFFFFEFFFF0000, 0x0000000000000000 }, \
+  { 0x00000450, 0x0000000000000000, 0x0000000000000000 }, { 0x00000179, 0xFFFFFFFFF200F000, 0x0000000000000000 }, \
+  { 0x00000470, 0x0000000000000000, 0x0000000000000000 }, { 0x00000583, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x00000430, 0x0000000000000000, 0x0000000000000000 }, { 0x0000026C, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x0000028C, 0xFFFFFFFFBFFF8000, 0x0000000000000000 }, { 0x00000481, 0xFFFFFFFFFFFFFF16, 0x0000000000000000 }, \
+  { 0x00000410, 0x0000000000000000, 0x0000000000000000 }, { 0xC0000100, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x0000081A, 0x0000000000000000, 0x0000000000000000 }, { 0x00000006, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x000000C8, 0x0000000000000000, 0x0000000000000000 }, { 0x00000461, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x00000452, 0x0000000000000000, 0x0000000000000000 }, { 0x00000441, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0x0000026E, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x0000029D, 0xFFFFFFFFBFFF8000, 0x0000000000000000 }, { 0x00000048, 0xFFFFFFFFFFFFFFF8, 0x0000000000000000 }, \
+  { 0x00000492, 0xFFFFFFFFFFFFFF20, 0x0000000000000000 }, { 0x0000080B, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0xC0000080, 0xFFFFFFFFFFFFF2FE, 0x0000000000000000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0x00000421, 0x0000000000000000, 0x0000000000000000 }, { 0x00000017, 0xFFE3FFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0x000006A7, 0x0000000000000000, 0x0000000000000000 }, { 0x0000020C, 0xFFF0000000000F00, 0x000FFFFFFFFFF000 }, \
+  { 0x00000401, 0x0000000000000000, 0x0000000000000000 }, { 0xC0000102, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x00000390, 0x037FFFF800000000, 0x0000000000000000 }, { 0x00000585, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x0000081C, 0x0000000000000000, 0x0000000000000000 }, { 0x0000017B, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x0000010A, 0xFFFFFFFFFFFFFE00, 0x0000000000000000 }, { 0x000004C3, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x000002FF, 0xFFFFFFFFFFFFF3F8, 0x0000000000000000 }, { 0x00000432, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x0000028E, 0xFFFFFFFFBFFF8000, 0x0000000000000000 }, { 0x0000019B, 0xFFFFFFFFFE0000E0, 0x0000000000000000 }, \
+  { 0x00000483, 0xFFFFFFFF00036DFB, 0x0000000000000000 }, { 0x00000412, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x00000079, 0x0000000000000000, 0x0000000000000000 }, { 0x00000472, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0x00000463, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0x0000029F, 0xFFFFFFFFBFFF8000, 0x0000000000000000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0x00000443, 0x0000000000000000, 0x0000000000000000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0x00000423, 0x0000000000000000, 0x0000000000000000 }, { 0xC0000082, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0x0000020E, 0xFFF0000000000F00, 0x000FFFFFFFFFF000 }, { 0x0000080D, 0xFFFFFFFF00000000, 0x0000000000000000 }, \
+  { 0x00000403, 0x0000000000000000, 0x0000000000000000 }, { 0x00000392, 0x7FFFFFF800000000, 0x0000000000000000 }, \
+  { 0x000004C5, 0x0000000000000000, 0x0000000000000000 }, { 0x00000587, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x0000009B, 0xFFFFFFFF00000FFA, 0x0000000000000000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0x00000454, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x00000434, 0x0000000000000000, 0x0000000000000000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0x00000290, 0xFFFFFFFFBFFF8000, 0x0000000000000000 }, \
+  { 0x00000485, 0x0000000080003E00, 0x0000000000000000 }, { 0x00000414, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x0000081E, 0x0000000000000000, 0x0000000000000000 }, { 0x0000083E, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0x00000465, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x00000250, 0x0000000000000000, 0x0000000000000000 }, { 0x0000001B, 0xFFF00000000002FF, 0x000FFFFFFFFFF000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0x00000405, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x0000003B, 0x0000000000000000, 0x0000000000000000 }, { 0x00000445, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0x00000425, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x0000008C, 0x0000000000000000, 0x0000000000000000 }, { 0x0000082F, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x0000080F, 0x0000000000000000, 0x0000000000000000 }, { 0xC0000084, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x00000210, 0xFFF0000000000F00, 0x000FFFFFFFFFF000 }, { 0x00000281, 0xFFFFFFFFBFFF8000, 0x0000000000000000 }, \
+  { 0x000004C7, 0x0000000000000000, 0x0000000000000000 }, { 0x00000487, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x00000456, 0x0000000000000000, 0x0000000000000000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0x00000292, 0xFFFFFFFFBFFF8000, 0x0000000000000000 }, { 0x00000436, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0x00000820, 0x0000000000000000, 0x0000000000000000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0x000001B0, 0xFFFFFFFFFFFFFFF0, 0x0000000000000000 }, { 0x00000416, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0x00000467, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0x00000447, 0x0000000000000000, 0x0000000000000000 }, { 0x00000283, 0xFFFFFFFFBFFF8000, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0x00000407, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x0000008E, 0x0000000000000000, 0x0000000000000000 }, { 0x00000201, 0xFFF00000000007FF, 0x000FFFFFFFFFF000 }, \
+  { 0x00000427, 0x0000000000000000, 0x0000000000000000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0x00000345, 0xFFFFFFFFFFFFC000, 0x0000000000000000 }, { 0x00000212, 0xFFF0000000000F00, 0x000FFFFFFFFFF000 }, \
+  { 0x00000811, 0x0000000000000000, 0x0000000000000000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0x000001F2, 0xFFFFFFFF00000F00, 0x0000000000000000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0x00000458, 0x0000000000000000, 0x0000000000000000 }, { 0x00000489, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0x00000438, 0x0000000000000000, 0x0000000000000000 }, { 0x00000294, 0xFFFFFFFFBFFF8000, 0x0000000000000000 }, \
+  { 0x000001B2, 0xFFFFFFFFFE0000E8, 0x0000000000000000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0x00000418, 0x0000000000000000, 0x0000000000000000 }, { 0x00000203, 0xFFF00000000007FF, 0x000FFFFFFFFFF000 }, \
+  { 0x00000822, 0x0000000000000000, 0x0000000000000000 }, { 0x00000DB0, 0xFFFFFFFFFFFFFFFE, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0x00000802, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x00000469, 0x0000000000000000, 0x0000000000000000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0x00000449, 0x0000000000000000, 0x0000000000000000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0x00000D90, 0x0000000000000FFC, 0x0000000000000000 }, { 0x00000771, 0xFFFFFFFF00000000, 0x0000000000000000 }, \
+  { 0x00000C8E, 0x0000000000000000, 0x0000000000000000 }, { 0x00000285, 0xFFFFFFFFBFFF8000, 0x0000000000000000 }, \
+  { 0x00000409, 0x0000000000000000, 0x0000000000000000 }, { 0x00000429, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0x00000813, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x00000833, 0x0000000000000000, 0x0000000000000000 }, { 0x000006E0, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x00000296, 0xFFFFFFFFBFFF8000, 0x0000000000000000 }, { 0x000000C1, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0x0000045A, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0x0000043A, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0x000006A0, 0x00000000000003C0, 0x0000000000000000 }, \
+  { 0x00000010, 0x0000000000000000, 0x0000000000000000 }, { 0x00000824, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x0000041A, 0x0000000000000000, 0x0000000000000000 }, { 0x00000DB2, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x0000048B, 0xFFFFFFFF20000000, 0x0000000000000000 }, { 0x00000205, 0xFFF00000000007FF, 0x000FFFFFFFFFF000 }, \
+  { 0x000000C3, 0x0000000000000000, 0x0000000000000000 }, { 0x00000174, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0x0000046B, 0x0000000000000000, 0x0000000000000000 }, { 0x0000044B, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0x00000773, 0xFFFFFFFFFFFFFFFC, 0x0000000000000000 }, \
+  { 0x00000835, 0x0000000000000000, 0x0000000000000000 }, { 0x0000042B, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0x00000287, 0xFFFFFFFFBFFF8000, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0x0000040B, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x00000815, 0x0000000000000000, 0x0000000000000000 }, { 0x00000001, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0x00000600, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0x0000043C, 0x0000000000000000, 0x0000000000000000 }, { 0x0000041C, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x00000309, 0x0000000000000000, 0x0000000000000000 }, { 0x000006A2, 0x00000000000003C0, 0x0000000000000000 }, \
+  { 0x0000048D, 0x0000000000000000, 0x0000000000000000 }, { 0x00000298, 0xFFFFFFFFBFFF8000, 0x0000000000000000 }, \
+  { 0x0000045C, 0x0000000000000000, 0x0000000000000000 }, { 0x00000826, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x00000C81, 0xFFFFFFFFFFFFFFFE, 0x0000000000000000 }, { 0x00000207, 0xFFF00000000007FF, 0x000FFFFFFFFFF000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0x0000046D, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x00000269, 0x0000000000000000, 0x0000000000000000 }, { 0x0000042D, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0x00000580, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x0000044D, 0x0000000000000000, 0x0000000000000000 }, { 0x00000176, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0x00000817, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x00000258, 0x0000000000000000, 0x0000000000000000 }, { 0x00000289, 0xFFFFFFFFBFFF8000, 0x0000000000000000 }, \
+  { 0x00000560, 0xFFF000000000007F, 0x000FFFFFFFFFFF80 }, { 0x00000837, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0x0000040D, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x0000043E, 0x0000000000000000, 0x0000000000000000 }, { 0x000001F8, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x0000045E, 0x0000000000000000, 0x0000000000000000 }, { 0x00000187, 0xFFFFFFFF00000000, 0x0000000000000000 }, \
+  { 0x000006A4, 0x0000000000000000, 0x0000000000000000 }, { 0x000000C5, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x0000030B, 0x0000000000000000, 0x0000000000000000 }, { 0x00000571, 0xFFFE0000FFFFFF08, 0x0000000000000000 }, \
+  { 0x00000500, 0xFFFFFFFFFF00FFFE, 0x0000000000000000 }, { 0x00000828, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x0000046F, 0x0000000000000000, 0x0000000000000000 }, { 0x0000048F, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x0000029A, 0xFFFFFFFFBFFF8000, 0x0000000000000000 }, { 0x0000041E, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x00000209, 0xFFF00000000007FF, 0x000FFFFFFFFFF000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0x00000808, 0x0000000000000000, 0x0000000000000000 }, { 0x00000198, 0xFFFFFFFFFFFF0000, 0x0000000000000000 }, \
+  { 0x0000038D, 0xFFFFFFFFFFFFF000, 0x0000000000000000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0x00000582, 0x0000000000000000, 0x0000000000000000 }, { 0x00000819, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x0000026B, 0x0000000000000000, 0x0000000000000000 }, { 0x0000044F, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x00000839, 0x0000000000000000, 0x0000000000000000 }, { 0x0000042F, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x0000028B, 0xFFFFFFFFBFFF8000, 0x0000000000000000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0x00000777, 0xFFFFFFFFFFFFFFFA, 0x0000000000000000 }, \
+  { 0x0000040F, 0x0000000000000000, 0x0000000000000000 }, { 0x00000480, 0xFF00E00080000000, 0x0000000000000000 }, \
+  { 0x000000C7, 0x0000000000000000, 0x0000000000000000 }, { 0x000001FA, 0xFFFFFFFFFAFE1800, 0x0000000000000000 }, \
+  { 0x00000189, 0xFFFFFFFF00000000, 0x0000000000000000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0x00000440, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x000000E7, 0x0000000000000000, 0x0000000000000000 }, { 0x000006A6, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x0000029C, 0xFFFFFFFFBFFF8000, 0x0000000000000000 }, { 0x00000471, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x00000491, 0xFFFFFFFFFFFFFFFE, 0x0000000000000000 }, { 0x00000460, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0x0000080A, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x0000020B, 0xFFF00000000007FF, 0x000FFFFFFFFFF000 }, { 0x00000420, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x00000400, 0x0000000000000000, 0x0000000000000000 }, { 0x000004C2, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x0000038F, 0x0000000000000000, 0x0000000000000000 }, { 0x0000019A, 0xFFFFFFFFFFFFFFE0, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0x0000026D, 0x0000000000000000, 0x0000000000000000 }, { 0x00000584, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x0000081B, 0x0000000000000000, 0x0000000000000000 }, { 0x00000431, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x0000028D, 0xFFFFFFFFBFFF8000, 0x0000000000000000 }, { 0xC0000081, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x00000482, 0xFFFFFFFF04046173, 0x0000000000000000 }, { 0x00000451, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x00000411, 0x0000000000000000, 0x0000000000000000 }, { 0x0000017A, 0xFFFFFFFFFFFFFFF0, 0x0000000000000000 }, \
+  { 0x00000462, 0x0000000000000000, 0x0000000000000000 }, { 0xC0000101, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0x000003F1, 0xFFFFFFF0FFFFFFF0, 0x0000000000000000 }, \
+  { 0x0000029E, 0xFFFFFFFFBFFF8000, 0x0000000000000000 }, { 0x00000442, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0x000006A8, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0x00000493, 0xFFFFFFFFFFFFFFF7, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0x00000422, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x0000020D, 0xFFF00000000007FF, 0x000FFFFFFFFFF000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0x00000473, 0x0000000000000000, 0x0000000000000000 }, { 0x0000019C, 0xFFFFFFFF07800000, 0x0000000000000000 }, \
+  { 0x00000453, 0x0000000000000000, 0x0000000000000000 }, { 0x000004C4, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x00000391, 0x837FFFF800000000, 0x0000000000000000 }, { 0x00000402, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x00000586, 0x0000000000000000, 0x0000000000000000 }, { 0x00000049, 0xFFFFFFFFFFFFFFFE, 0x0000000000000000 }, \
+  { 0x0000026F, 0x0000000000000000, 0x0000000000000000 }, { 0x0000010B, 0xFFFFFFFFFFFFFFFE, 0x0000000000000000 }, \
+  { 0x00000433, 0x0000000000000000, 0x0000000000000000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0x0000028F, 0xFFFFFFFFBFFF8000, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0x00000413, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x0000081D, 0x0000000000000000, 0x0000000000000000 }, { 0x00000484, 0xFFFFFFFFFF8011FB, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0x00000464, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0xC0000083, 0x0000000000000000, 0x0000000000000000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0x00000280, 0xFFFFFFFFBFFF8000, 0x0000000000000000 }, { 0x0000003A, 0xFFFFFFFFFFE900F8, 0x0000000000000000 }, \
+  { 0x00000444, 0x0000000000000000, 0x0000000000000000 }, { 0xC0000103, 0xFFFFFFFF00000000, 0x0000000000000000 }, \
+  { 0x00000424, 0x0000000000000000, 0x0000000000000000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0x0000008B, 0x0000000000000000, 0x0000000000000000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0x0000020F, 0xFFF00000000007FF, 0x000FFFFFFFFFF000 }, \
+  { 0x00000404, 0x0000000000000000, 0x0000000000000000 }, { 0x000004C6, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x00000455, 0x0000000000000000, 0x0000000000000000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0x0000083F, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x00000435, 0x0000000000000000, 0x0000000000000000 }, { 0x00000291, 0xFFFFFFFFBFFF8000, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0x00000486, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x00000415, 0x0000000000000000, 0x0000000000000000 }, { 0x0000081F, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0x00000466, 0x0000000000000000, 0x0000000000000000 }, { 0x00000426, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0x0000008D, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x00000446, 0x0000000000000000, 0x0000000000000000 }, { 0x00000200, 0xFFF0000000000F00, 0x000FFFFFFFFFF000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0x00000810, 0x0000000000000000, 0x0000000000000000 }, { 0x00000282, 0xFFFFFFFFBFFF8000, 0x0000000000000000 }, \
+  { 0x000000FE, 0xFFFFFFFFFFFFF200, 0x0000000000000000 }, { 0x00000830, 0x00000000FFF33000, 0x0000000000000000 }, \
+  { 0x000001A0, 0xFFFFFFFBFF3AE776, 0x0000000000000000 }, { 0x00000211, 0xFFF00000000007FF, 0x000FFFFFFFFFF000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0x00000406, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x000004C8, 0x0000000000000000, 0x0000000000000000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0x00000457, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0x0000009E, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x00000437, 0x0000000000000000, 0x0000000000000000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0x00000293, 0xFFFFFFFFBFFF8000, 0x0000000000000000 }, { 0x00000488, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x00000821, 0x0000000000000000, 0x0000000000000000 }, { 0x00000417, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0x000001B1, 0xFFFFFFFFFF80F000, 0x0000000000000000 }, \
+  { 0x00000468, 0x0000000000000000, 0x0000000000000000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0x00000202, 0xFFF0000000000F00, 0x000FFFFFFFFFF000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0x00000213, 0xFFF00000000007FF, 0x000FFFFFFFFFF000 }, { 0x00000448, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x00000770, 0xFFFFFFFFFFFFFFFE, 0x0000000000000000 }, { 0x00000C8D, 0x00000000FFFFFF00, 0x0000000000000000 }, \
+  { 0x0000008F, 0x0000000000000000, 0x0000000000000000 }, { 0x00000284, 0xFFFFFFFFBFFF8000, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0x00000428, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x00000408, 0x0000000000000000, 0x0000000000000000 }, { 0x00000832, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x00000812, 0x0000000000000000, 0x0000000000000000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0x00000DA0, 0xFFFFFFFFFFFE02FF, 0x0000000000000000 }, \
+  { 0x000001F3, 0xFFFFFFFF000007FF, 0x0000000000000000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0x00000DB1, 0xFFFFFFFFFFFFFFFE, 0x0000000000000000 }, { 0x00000439, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x0000048A, 0xFFFFFFFFFFFF9000, 0x0000000000000000 }, { 0x00000295, 0xFFFFFFFFBFFF8000, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0x00000823, 0x0000000000000000, 0x0000000000000000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0x00000204, 0xFFF0000000000F00, 0x000FFFFFFFFFF000 }, { 0x00000419, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0x00000459, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x00000C8F, 0x0000000000000000, 0x0000000000000000 }, { 0x00000122, 0xFFFFFFFFFFFFFFFC, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0x0000044A, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x0000040A, 0x0000000000000000, 0x0000000000000000 }, { 0x00000772, 0xFFFFFC0000000000, 0x0000000000000000 }, \
+  { 0x00000803, 0x0000000000000000, 0x0000000000000000 }, { 0x00000834, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x00000286, 0xFFFFFFFFBFFF8000, 0x0000000000000000 }, { 0x0000046A, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0x00000814, 0x0000000000000000, 0x0000000000000000 }, { 0x0000042A, 0x0000000000000000, 0x0000000000000000 }, \
+}
 /**
  * @}
  */
@@ -15534,6 +17649,7 @@ typedef union
 
   uint32_t flags;
 } pde_4mb_32;
+#define PDE_4MB_32_RESERVED_BITS                                     0x200000
 
 /**
  * @brief Format of a 32-Bit Page-Directory Entry that References a Page Table
@@ -15647,6 +17763,7 @@ typedef union
 
   uint32_t flags;
 } pde_32;
+#define PDE_32_RESERVED_BITS                                         0x00
 
 /**
  * @brief Format of a 32-Bit Page-Table Entry that Maps a 4-KByte Page
@@ -15775,6 +17892,7 @@ typedef union
 
   uint32_t flags;
 } pte_32;
+#define PTE_32_RESERVED_BITS                                         0x00
 
 /**
  * @brief Format of a common Page-Table Entry
@@ -15850,6 +17968,7 @@ typedef union
 
   uint32_t flags;
 } pt_entry_32;
+#define PT_ENTRY_32_RESERVED_BITS                                    0x00
 
 /**
  * @defgroup paging_structures_entry_count_32 \
@@ -15955,7 +18074,15 @@ typedef union
 #define PML4E_64_ACCESSED_FLAG                                       0x20
 #define PML4E_64_ACCESSED_MASK                                       0x01
 #define PML4E_64_ACCESSED(_)                                         (((_) >> 5) & 0x01)
-    uint64_t reserved1                                               : 1;
+
+    /**
+     * [Bit 6] Ignored.
+     */
+    uint64_t ignored_0                                               : 1;
+#define PML4E_64_IGNORED_0_BIT                                       6
+#define PML4E_64_IGNORED_0_FLAG                                      0x40
+#define PML4E_64_IGNORED_0_MASK                                      0x01
+#define PML4E_64_IGNORED_0(_)                                        (((_) >> 6) & 0x01)
 
     /**
      * [Bit 7] Reserved (must be 0).
@@ -15995,7 +18122,7 @@ typedef union
 #define PML4E_64_PAGE_FRAME_NUMBER_FLAG                              0xFFFFFFFFF000
 #define PML4E_64_PAGE_FRAME_NUMBER_MASK                              0xFFFFFFFFF
 #define PML4E_64_PAGE_FRAME_NUMBER(_)                                (((_) >> 12) & 0xFFFFFFFFF)
-    uint64_t reserved2                                               : 4;
+    uint64_t reserved1                                               : 4;
 
     /**
      * [Bits 62:52] Ignored.
@@ -16021,6 +18148,8 @@ typedef union
 
   uint64_t flags;
 } pml4e_64;
+#define PML4E_64_RESERVED_BITS                                       0x80
+#define PML4E_64_ADDRESS_BITS                                        0xFFFFFFFFFF000
 
 /**
  * @brief Format of a 4-Level Page-Directory-Pointer-Table Entry (PDPTE) that Maps a 1-GByte Page
@@ -16205,6 +18334,8 @@ typedef union
 
   uint64_t flags;
 } pdpte_1gb_64;
+#define PDPTE_1GB_64_RESERVED_BITS                                   0x3FFFE000
+#define PDPTE_1GB_64_ADDRESS_BITS                                    0xFFFFFC0000000
 
 /**
  * @brief Format of a 4-Level Page-Directory-Pointer-Table Entry (PDPTE) that References a Page Directory
@@ -16278,7 +18409,15 @@ typedef union
 #define PDPTE_64_ACCESSED_FLAG                                       0x20
 #define PDPTE_64_ACCESSED_MASK                                       0x01
 #define PDPTE_64_ACCESSED(_)                                         (((_) >> 5) & 0x01)
-    uint64_t reserved1                                               : 1;
+
+    /**
+     * [Bit 6] Ignored.
+     */
+    uint64_t ignored_0                                               : 1;
+#define PDPTE_64_IGNORED_0_BIT                                       6
+#define PDPTE_64_IGNORED_0_FLAG                                      0x40
+#define PDPTE_64_IGNORED_0_MASK                                      0x01
+#define PDPTE_64_IGNORED_0(_)                                        (((_) >> 6) & 0x01)
 
     /**
      * [Bit 7] Page size; must be 0 (otherwise, this entry maps a 1-GByte page).
@@ -16318,7 +18457,7 @@ typedef union
 #define PDPTE_64_PAGE_FRAME_NUMBER_FLAG                              0xFFFFFFFFF000
 #define PDPTE_64_PAGE_FRAME_NUMBER_MASK                              0xFFFFFFFFF
 #define PDPTE_64_PAGE_FRAME_NUMBER(_)                                (((_) >> 12) & 0xFFFFFFFFF)
-    uint64_t reserved2                                               : 4;
+    uint64_t reserved1                                               : 4;
 
     /**
      * [Bits 62:52] Ignored.
@@ -16344,6 +18483,8 @@ typedef union
 
   uint64_t flags;
 } pdpte_64;
+#define PDPTE_64_RESERVED_BITS                                       0x00
+#define PDPTE_64_ADDRESS_BITS                                        0xFFFFFFFFFF000
 
 /**
  * @brief Format of a 4-Level Page-Directory Entry that Maps a 2-MByte Page
@@ -16528,6 +18669,8 @@ typedef union
 
   uint64_t flags;
 } pde_2mb_64;
+#define PDE_2MB_64_RESERVED_BITS                                     0x1FE000
+#define PDE_2MB_64_ADDRESS_BITS                                      0xFFFFFFFE00000
 
 /**
  * @brief Format of a 4-Level Page-Directory Entry that References a Page Table
@@ -16601,7 +18744,15 @@ typedef union
 #define PDE_64_ACCESSED_FLAG                                         0x20
 #define PDE_64_ACCESSED_MASK                                         0x01
 #define PDE_64_ACCESSED(_)                                           (((_) >> 5) & 0x01)
-    uint64_t reserved1                                               : 1;
+
+    /**
+     * [Bit 6] Ignored.
+     */
+    uint64_t ignored_0                                               : 1;
+#define PDE_64_IGNORED_0_BIT                                         6
+#define PDE_64_IGNORED_0_FLAG                                        0x40
+#define PDE_64_IGNORED_0_MASK                                        0x01
+#define PDE_64_IGNORED_0(_)                                          (((_) >> 6) & 0x01)
 
     /**
      * [Bit 7] Page size; must be 0 (otherwise, this entry maps a 2-MByte page).
@@ -16641,7 +18792,7 @@ typedef union
 #define PDE_64_PAGE_FRAME_NUMBER_FLAG                                0xFFFFFFFFF000
 #define PDE_64_PAGE_FRAME_NUMBER_MASK                                0xFFFFFFFFF
 #define PDE_64_PAGE_FRAME_NUMBER(_)                                  (((_) >> 12) & 0xFFFFFFFFF)
-    uint64_t reserved2                                               : 4;
+    uint64_t reserved1                                               : 4;
 
     /**
      * [Bits 62:52] Ignored.
@@ -16667,6 +18818,8 @@ typedef union
 
   uint64_t flags;
 } pde_64;
+#define PDE_64_RESERVED_BITS                                         0x00
+#define PDE_64_ADDRESS_BITS                                          0xFFFFFFFFFF000
 
 /**
  * @brief Format of a 4-Level Page-Table Entry that Maps a 4-KByte Page
@@ -16840,6 +18993,8 @@ typedef union
 
   uint64_t flags;
 } pte_64;
+#define PTE_64_RESERVED_BITS                                         0x00
+#define PTE_64_ADDRESS_BITS                                          0xFFFFFFFFFF000
 
 /**
  * @brief Format of a common Page-Table Entry
@@ -16940,6 +19095,8 @@ typedef union
 
   uint64_t flags;
 } pt_entry_64;
+#define PT_ENTRY_64_RESERVED_BITS                                    0x00
+#define PT_ENTRY_64_ADDRESS_BITS                                     0xFFFFFFFFFF000
 
 /**
  * @defgroup paging_structures_entry_count_64 \
@@ -17021,6 +19178,30 @@ typedef union
 
   uint64_t flags;
 } invpcid_descriptor;
+#define INVPCID_DESCRIPTOR_RESERVED_BITS                             0xFFFFFFFFFFFFF000
+
+/**
+ * @defgroup pcid \
+ *           Process-context identifier limits
+ *
+ * Process-context identifier limits.
+ *
+ * @see Vol3A[4.10.1(Process-Context Identifiers (PCIDs))] (reference)
+ * @{
+ */
+/**
+ * Highest PCID (CR3 bits 11:0 if CR4.PCIDE = 1).
+ */
+#define PCID_MAX                                                     0x00000FFF
+
+/**
+ * Bit 63 of the source operand of MOV to CR3. If CR4.PCIDE = 1 and the bit is set, the instruction is not required to
+ * invalidate TLB entries and paging-structure caches of the new PCID.
+ */
+#define PCID_NO_FLUSH                                                0x8000000000000000
+/**
+ * @}
+ */
 
 /**
  * @defgroup segment_descriptors \
@@ -17204,6 +19385,7 @@ typedef union
 
   uint32_t flags;
 } segment_access_rights;
+#define SEGMENT_ACCESS_RIGHTS_RESERVED_BITS                          0xFF0F00FF
 
 /**
  * @brief General Segment Descriptor (32-bit)
@@ -17265,10 +19447,10 @@ typedef struct
        * [Bits 7:0] Base address field (23:16); see description of $BASE_LOW for more details.
        */
       uint32_t base_address_middle                                   : 8;
-#define SEGMENT__BASE_ADDRESS_MIDDLE_BIT                             0
-#define SEGMENT__BASE_ADDRESS_MIDDLE_FLAG                            0xFF
-#define SEGMENT__BASE_ADDRESS_MIDDLE_MASK                            0xFF
-#define SEGMENT__BASE_ADDRESS_MIDDLE(_)                              (((_) >> 0) & 0xFF)
+#define SEGMENT_DESCRIPTOR_32_BASE_ADDRESS_MIDDLE_BIT                0
+#define SEGMENT_DESCRIPTOR_32_BASE_ADDRESS_MIDDLE_FLAG               0xFF
+#define SEGMENT_DESCRIPTOR_32_BASE_ADDRESS_MIDDLE_MASK               0xFF
+#define SEGMENT_DESCRIPTOR_32_BASE_ADDRESS_MIDDLE(_)                 (((_) >> 0) & 0xFF)
 
       /**
        * @brief Type field
@@ -17281,10 +19463,10 @@ typedef struct
        * @see Vol3A[3.4.5.1(Code- and Data-Segment Descriptor Types)]
        */
       uint32_t type                                                  : 4;
-#define SEGMENT__TYPE_BIT                                            8
-#define SEGMENT__TYPE_FLAG                                           0xF00
-#define SEGMENT__TYPE_MASK                                           0x0F
-#define SEGMENT__TYPE(_)                                             (((_) >> 8) & 0x0F)
+#define SEGMENT_DESCRIPTOR_32_TYPE_BIT                               8
+#define SEGMENT_DESCRIPTOR_32_TYPE_FLAG                              0xF00
+#define SEGMENT_DESCRIPTOR_32_TYPE_MASK                              0x0F
+#define SEGMENT_DESCRIPTOR_32_TYPE(_)                                (((_) >> 8) & 0x0F)
 
       /**
        * @brief S (descriptor type) flag
@@ -17293,10 +19475,10 @@ typedef struct
        * flag is set).
        */
       uint32_t descriptor_type                                       : 1;
-#define SEGMENT__DESCRIPTOR_TYPE_BIT                                 12
-#define SEGMENT__DESCRIPTOR_TYPE_FLAG                                0x1000
-#define SEGMENT__DESCRIPTOR_TYPE_MASK                                0x01
-#define SEGMENT__DESCRIPTOR_TYPE(_)                                  (((_) >> 12) & 0x01)
+#define SEGMENT_DESCRIPTOR_32_DESCRIPTOR_TYPE_BIT                    12
+#define SEGMENT_DESCRIPTOR_32_DESCRIPTOR_TYPE_FLAG                   0x1000
+#define SEGMENT_DESCRIPTOR_32_DESCRIPTOR_TYPE_MASK                   0x01
+#define SEGMENT_DESCRIPTOR_32_DESCRIPTOR_TYPE(_)                     (((_) >> 12) & 0x01)
 
       /**
        * @brief DPL (descriptor privilege level) field
@@ -17306,10 +19488,10 @@ typedef struct
        * description of the relationship of the DPL to the CPL of the executing code segment and the RPL of a segment selector.
        */
       uint32_t descriptor_privilege_level                            : 2;
-#define SEGMENT__DESCRIPTOR_PRIVILEGE_LEVEL_BIT                      13
-#define SEGMENT__DESCRIPTOR_PRIVILEGE_LEVEL_FLAG                     0x6000
-#define SEGMENT__DESCRIPTOR_PRIVILEGE_LEVEL_MASK                     0x03
-#define SEGMENT__DESCRIPTOR_PRIVILEGE_LEVEL(_)                       (((_) >> 13) & 0x03)
+#define SEGMENT_DESCRIPTOR_32_DESCRIPTOR_PRIVILEGE_LEVEL_BIT         13
+#define SEGMENT_DESCRIPTOR_32_DESCRIPTOR_PRIVILEGE_LEVEL_FLAG        0x6000
+#define SEGMENT_DESCRIPTOR_32_DESCRIPTOR_PRIVILEGE_LEVEL_MASK        0x03
+#define SEGMENT_DESCRIPTOR_32_DESCRIPTOR_PRIVILEGE_LEVEL(_)          (((_) >> 13) & 0x03)
 
       /**
        * @brief P (segment-present) flag
@@ -17320,19 +19502,19 @@ typedef struct
        * loaded into physical memory at a given time. It offers a control in addition to paging for managing virtual memory.
        */
       uint32_t present                                               : 1;
-#define SEGMENT__PRESENT_BIT                                         15
-#define SEGMENT__PRESENT_FLAG                                        0x8000
-#define SEGMENT__PRESENT_MASK                                        0x01
-#define SEGMENT__PRESENT(_)                                          (((_) >> 15) & 0x01)
+#define SEGMENT_DESCRIPTOR_32_PRESENT_BIT                            15
+#define SEGMENT_DESCRIPTOR_32_PRESENT_FLAG                           0x8000
+#define SEGMENT_DESCRIPTOR_32_PRESENT_MASK                           0x01
+#define SEGMENT_DESCRIPTOR_32_PRESENT(_)                             (((_) >> 15) & 0x01)
 
       /**
        * [Bits 19:16] Segment limit field (19:16); see description of $LIMIT_LOW for more details.
        */
       uint32_t segment_limit_high                                    : 4;
-#define SEGMENT__SEGMENT_LIMIT_HIGH_BIT                              16
-#define SEGMENT__SEGMENT_LIMIT_HIGH_FLAG                             0xF0000
-#define SEGMENT__SEGMENT_LIMIT_HIGH_MASK                             0x0F
-#define SEGMENT__SEGMENT_LIMIT_HIGH(_)                               (((_) >> 16) & 0x0F)
+#define SEGMENT_DESCRIPTOR_32_SEGMENT_LIMIT_HIGH_BIT                 16
+#define SEGMENT_DESCRIPTOR_32_SEGMENT_LIMIT_HIGH_FLAG                0xF0000
+#define SEGMENT_DESCRIPTOR_32_SEGMENT_LIMIT_HIGH_MASK                0x0F
+#define SEGMENT_DESCRIPTOR_32_SEGMENT_LIMIT_HIGH(_)                  (((_) >> 16) & 0x0F)
 
       /**
        * @brief Available bit
@@ -17340,10 +19522,10 @@ typedef struct
        * [Bit 20] Bit 20 of the second doubleword of the segment descriptor is available for use by system software.
        */
       uint32_t system                                                : 1;
-#define SEGMENT__SYSTEM_BIT                                          20
-#define SEGMENT__SYSTEM_FLAG                                         0x100000
-#define SEGMENT__SYSTEM_MASK                                         0x01
-#define SEGMENT__SYSTEM(_)                                           (((_) >> 20) & 0x01)
+#define SEGMENT_DESCRIPTOR_32_SYSTEM_BIT                             20
+#define SEGMENT_DESCRIPTOR_32_SYSTEM_FLAG                            0x100000
+#define SEGMENT_DESCRIPTOR_32_SYSTEM_MASK                            0x01
+#define SEGMENT_DESCRIPTOR_32_SYSTEM(_)                              (((_) >> 20) & 0x01)
 
       /**
        * @brief L (64-bit code segment) flag
@@ -17355,10 +19537,10 @@ typedef struct
        * 0.
        */
       uint32_t long_mode                                             : 1;
-#define SEGMENT__LONG_MODE_BIT                                       21
-#define SEGMENT__LONG_MODE_FLAG                                      0x200000
-#define SEGMENT__LONG_MODE_MASK                                      0x01
-#define SEGMENT__LONG_MODE(_)                                        (((_) >> 21) & 0x01)
+#define SEGMENT_DESCRIPTOR_32_LONG_MODE_BIT                          21
+#define SEGMENT_DESCRIPTOR_32_LONG_MODE_FLAG                         0x200000
+#define SEGMENT_DESCRIPTOR_32_LONG_MODE_MASK                         0x01
+#define SEGMENT_DESCRIPTOR_32_LONG_MODE(_)                           (((_) >> 21) & 0x01)
 
       /**
        * @brief D/B (default operation size/default stack pointer size and/or upper bound) flag
@@ -17380,10 +19562,10 @@ typedef struct
        * is set, the upper bound is FFFFFFFFH (4 GBytes); if the flag is clear, the upper bound is FFFFH (64 KBytes).
        */
       uint32_t default_big                                           : 1;
-#define SEGMENT__DEFAULT_BIG_BIT                                     22
-#define SEGMENT__DEFAULT_BIG_FLAG                                    0x400000
-#define SEGMENT__DEFAULT_BIG_MASK                                    0x01
-#define SEGMENT__DEFAULT_BIG(_)                                      (((_) >> 22) & 0x01)
+#define SEGMENT_DESCRIPTOR_32_DEFAULT_BIG_BIT                        22
+#define SEGMENT_DESCRIPTOR_32_DEFAULT_BIG_FLAG                       0x400000
+#define SEGMENT_DESCRIPTOR_32_DEFAULT_BIG_MASK                       0x01
+#define SEGMENT_DESCRIPTOR_32_DEFAULT_BIG(_)                         (((_) >> 22) & 0x01)
 
       /**
        * @brief G (granularity) flag
@@ -17395,23 +19577,24 @@ typedef struct
        * the granularity flag is set, a limit of 0 results in valid offsets from 0 to 4095.
        */
       uint32_t granularity                                           : 1;
-#define SEGMENT__GRANULARITY_BIT                                     23
-#define SEGMENT__GRANULARITY_FLAG                                    0x800000
-#define SEGMENT__GRANULARITY_MASK                                    0x01
-#define SEGMENT__GRANULARITY(_)                                      (((_) >> 23) & 0x01)
+#define SEGMENT_DESCRIPTOR_32_GRANULARITY_BIT                        23
+#define SEGMENT_DESCRIPTOR_32_GRANULARITY_FLAG                       0x800000
+#define SEGMENT_DESCRIPTOR_32_GRANULARITY_MASK                       0x01
+#define SEGMENT_DESCRIPTOR_32_GRANULARITY(_)                         (((_) >> 23) & 0x01)
 
       /**
        * [Bits 31:24] Base address field (31:24); see description of $BASE_LOW for more details.
        */
       uint32_t base_address_high                                     : 8;
-#define SEGMENT__BASE_ADDRESS_HIGH_BIT                               24
-#define SEGMENT__BASE_ADDRESS_HIGH_FLAG                              0xFF000000
-#define SEGMENT__BASE_ADDRESS_HIGH_MASK                              0xFF
-#define SEGMENT__BASE_ADDRESS_HIGH(_)                                (((_) >> 24) & 0xFF)
+#define SEGMENT_DESCRIPTOR_32_BASE_ADDRESS_HIGH_BIT                  24
+#define SEGMENT_DESCRIPTOR_32_BASE_ADDRESS_HIGH_FLAG                 0xFF000000
+#define SEGMENT_DESCRIPTOR_32_BASE_ADDRESS_HIGH_MASK                 0xFF
+#define SEGMENT_DESCRIPTOR_32_BASE_ADDRESS_HIGH(_)                   (((_) >> 24) & 0xFF)
     };
 
     uint32_t flags;
   } ;
+#define SEGMENT_DESCRIPTOR_32_RESERVED_BITS                          0x00
 
 } segment_descriptor_32;
 
@@ -17467,10 +19650,10 @@ typedef struct
        * [Bits 7:0] Base address field (23:16); see description of $BASE_LOW for more details.
        */
       uint32_t base_address_middle                                   : 8;
-#define SEGMENT__BASE_ADDRESS_MIDDLE_BIT                             0
-#define SEGMENT__BASE_ADDRESS_MIDDLE_FLAG                            0xFF
-#define SEGMENT__BASE_ADDRESS_MIDDLE_MASK                            0xFF
-#define SEGMENT__BASE_ADDRESS_MIDDLE(_)                              (((_) >> 0) & 0xFF)
+#define SEGMENT_DESCRIPTOR_64_BASE_ADDRESS_MIDDLE_BIT                0
+#define SEGMENT_DESCRIPTOR_64_BASE_ADDRESS_MIDDLE_FLAG               0xFF
+#define SEGMENT_DESCRIPTOR_64_BASE_ADDRESS_MIDDLE_MASK               0xFF
+#define SEGMENT_DESCRIPTOR_64_BASE_ADDRESS_MIDDLE(_)                 (((_) >> 0) & 0xFF)
 
       /**
        * @brief Type field
@@ -17483,10 +19666,10 @@ typedef struct
        * @see Vol3A[3.4.5.1(Code- and Data-Segment Descriptor Types)]
        */
       uint32_t type                                                  : 4;
-#define SEGMENT__TYPE_BIT                                            8
-#define SEGMENT__TYPE_FLAG                                           0xF00
-#define SEGMENT__TYPE_MASK                                           0x0F
-#define SEGMENT__TYPE(_)                                             (((_) >> 8) & 0x0F)
+#define SEGMENT_DESCRIPTOR_64_TYPE_BIT                               8
+#define SEGMENT_DESCRIPTOR_64_TYPE_FLAG                              0xF00
+#define SEGMENT_DESCRIPTOR_64_TYPE_MASK                              0x0F
+#define SEGMENT_DESCRIPTOR_64_TYPE(_)                                (((_) >> 8) & 0x0F)
 
       /**
        * @brief S (descriptor type) flag
@@ -17495,10 +19678,10 @@ typedef struct
        * flag is set).
        */
       uint32_t descriptor_type                                       : 1;
-#define SEGMENT__DESCRIPTOR_TYPE_BIT                                 12
-#define SEGMENT__DESCRIPTOR_TYPE_FLAG                                0x1000
-#define SEGMENT__DESCRIPTOR_TYPE_MASK                                0x01
-#define SEGMENT__DESCRIPTOR_TYPE(_)                                  (((_) >> 12) & 0x01)
+#define SEGMENT_DESCRIPTOR_64_DESCRIPTOR_TYPE_BIT                    12
+#define SEGMENT_DESCRIPTOR_64_DESCRIPTOR_TYPE_FLAG                   0x1000
+#define SEGMENT_DESCRIPTOR_64_DESCRIPTOR_TYPE_MASK                   0x01
+#define SEGMENT_DESCRIPTOR_64_DESCRIPTOR_TYPE(_)                     (((_) >> 12) & 0x01)
 
       /**
        * @brief DPL (descriptor privilege level) field
@@ -17508,10 +19691,10 @@ typedef struct
        * description of the relationship of the DPL to the CPL of the executing code segment and the RPL of a segment selector.
        */
       uint32_t descriptor_privilege_level                            : 2;
-#define SEGMENT__DESCRIPTOR_PRIVILEGE_LEVEL_BIT                      13
-#define SEGMENT__DESCRIPTOR_PRIVILEGE_LEVEL_FLAG                     0x6000
-#define SEGMENT__DESCRIPTOR_PRIVILEGE_LEVEL_MASK                     0x03
-#define SEGMENT__DESCRIPTOR_PRIVILEGE_LEVEL(_)                       (((_) >> 13) & 0x03)
+#define SEGMENT_DESCRIPTOR_64_DESCRIPTOR_PRIVILEGE_LEVEL_BIT         13
+#define SEGMENT_DESCRIPTOR_64_DESCRIPTOR_PRIVILEGE_LEVEL_FLAG        0x6000
+#define SEGMENT_DESCRIPTOR_64_DESCRIPTOR_PRIVILEGE_LEVEL_MASK        0x03
+#define SEGMENT_DESCRIPTOR_64_DESCRIPTOR_PRIVILEGE_LEVEL(_)          (((_) >> 13) & 0x03)
 
       /**
        * @brief P (segment-present) flag
@@ -17522,19 +19705,19 @@ typedef struct
        * loaded into physical memory at a given time. It offers a control in addition to paging for managing virtual memory.
        */
       uint32_t present                                               : 1;
-#define SEGMENT__PRESENT_BIT                                         15
-#define SEGMENT__PRESENT_FLAG                                        0x8000
-#define SEGMENT__PRESENT_MASK                                        0x01
-#define SEGMENT__PRESENT(_)                                          (((_) >> 15) & 0x01)
+#define SEGMENT_DESCRIPTOR_64_PRESENT_BIT                            15
+#define SEGMENT_DESCRIPTOR_64_PRESENT_FLAG                           0x8000
+#define SEGMENT_DESCRIPTOR_64_PRESENT_MASK                           0x01
+#define SEGMENT_DESCRIPTOR_64_PRESENT(_)                             (((_) >> 15) & 0x01)
 
       /**
        * [Bits 19:16] Segment limit field (19:16); see description of $LIMIT_LOW for more details.
        */
       uint32_t segment_limit_high                                    : 4;
-#define SEGMENT__SEGMENT_LIMIT_HIGH_BIT                              16
-#define SEGMENT__SEGMENT_LIMIT_HIGH_FLAG                             0xF0000
-#define SEGMENT__SEGMENT_LIMIT_HIGH_MASK                             0x0F
-#define SEGMENT__SEGMENT_LIMIT_HIGH(_)                               (((_) >> 16) & 0x0F)
+#define SEGMENT_DESCRIPTOR_64_SEGMENT_LIMIT_HIGH_BIT                 16
+#define SEGMENT_DESCRIPTOR_64_SEGMENT_LIMIT_HIGH_FLAG                0xF0000
+#define SEGMENT_DESCRIPTOR_64_SEGMENT_LIMIT_HIGH_MASK                0x0F
+#define SEGMENT_DESCRIPTOR_64_SEGMENT_LIMIT_HIGH(_)                  (((_) >> 16) & 0x0F)
 
       /**
        * @brief Available bit
@@ -17542,10 +19725,10 @@ typedef struct
        * [Bit 20] Bit 20 of the second doubleword of the segment descriptor is available for use by system software.
        */
       uint32_t system                                                : 1;
-#define SEGMENT__SYSTEM_BIT                                          20
-#define SEGMENT__SYSTEM_FLAG                                         0x100000
-#define SEGMENT__SYSTEM_MASK                                         0x01
-#define SEGMENT__SYSTEM(_)                                           (((_) >> 20) & 0x01)
+#define SEGMENT_DESCRIPTOR_64_SYSTEM_BIT                             20
+#define SEGMENT_DESCRIPTOR_64_SYSTEM_FLAG                            0x100000
+#define SEGMENT_DESCRIPTOR_64_SYSTEM_MASK                            0x01
+#define SEGMENT_DESCRIPTOR_64_SYSTEM(_)                              (((_) >> 20) & 0x01)
 
       /**
        * @brief L (64-bit code segment) flag
@@ -17557,10 +19740,10 @@ typedef struct
        * 0.
        */
       uint32_t long_mode                                             : 1;
-#define SEGMENT__LONG_MODE_BIT                                       21
-#define SEGMENT__LONG_MODE_FLAG                                      0x200000
-#define SEGMENT__LONG_MODE_MASK                                      0x01
-#define SEGMENT__LONG_MODE(_)                                        (((_) >> 21) & 0x01)
+#define SEGMENT_DESCRIPTOR_64_LONG_MODE_BIT                          21
+#define SEGMENT_DESCRIPTOR_64_LONG_MODE_FLAG                         0x200000
+#define SEGMENT_DESCRIPTOR_64_LONG_MODE_MASK                         0x01
+#define SEGMENT_DESCRIPTOR_64_LONG_MODE(_)                           (((_) >> 21) & 0x01)
 
       /**
        * @brief D/B (default operation size/default stack pointer size and/or upper bound) flag
@@ -17582,10 +19765,10 @@ typedef struct
        * is set, the upper bound is FFFFFFFFH (4 GBytes); if the flag is clear, the upper bound is FFFFH (64 KBytes).
        */
       uint32_t default_big                                           : 1;
-#define SEGMENT__DEFAULT_BIG_BIT                                     22
-#define SEGMENT__DEFAULT_BIG_FLAG                                    0x400000
-#define SEGMENT__DEFAULT_BIG_MASK                                    0x01
-#define SEGMENT__DEFAULT_BIG(_)                                      (((_) >> 22) & 0x01)
+#define SEGMENT_DESCRIPTOR_64_DEFAULT_BIG_BIT                        22
+#define SEGMENT_DESCRIPTOR_64_DEFAULT_BIG_FLAG                       0x400000
+#define SEGMENT_DESCRIPTOR_64_DEFAULT_BIG_MASK                       0x01
+#define SEGMENT_DESCRIPTOR_64_DEFAULT_BIG(_)                         (((_) >> 22) & 0x01)
 
       /**
        * @brief G (granularity) flag
@@ -17597,23 +19780,24 @@ typedef struct
        * the granularity flag is set, a limit of 0 results in valid offsets from 0 to 4095.
        */
       uint32_t granularity                                           : 1;
-#define SEGMENT__GRANULARITY_BIT                                     23
-#define SEGMENT__GRANULARITY_FLAG                                    0x800000
-#define SEGMENT__GRANULARITY_MASK                                    0x01
-#define SEGMENT__GRANULARITY(_)                                      (((_) >> 23) & 0x01)
+#define SEGMENT_DESCRIPTOR_64_GRANULARITY_BIT                        23
+#define SEGMENT_DESCRIPTOR_64_GRANULARITY_FLAG                       0x800000
+#define SEGMENT_DESCRIPTOR_64_GRANULARITY_MASK                       0x01
+#define SEGMENT_DESCRIPTOR_64_GRANULARITY(_)                         (((_) >> 23) & 0x01)
 
       /**
        * [Bits 31:24] Base address field (31:24); see description of $BASE_LOW for more details.
        */
       uint32_t base_address_high                                     : 8;
-#define SEGMENT__BASE_ADDRESS_HIGH_BIT                               24
-#define SEGMENT__BASE_ADDRESS_HIGH_FLAG                              0xFF000000
-#define SEGMENT__BASE_ADDRESS_HIGH_MASK                              0xFF
-#define SEGMENT__BASE_ADDRESS_HIGH(_)                                (((_) >> 24) & 0xFF)
+#define SEGMENT_DESCRIPTOR_64_BASE_ADDRESS_HIGH_BIT                  24
+#define SEGMENT_DESCRIPTOR_64_BASE_ADDRESS_HIGH_FLAG                 0xFF000000
+#define SEGMENT_DESCRIPTOR_64_BASE_ADDRESS_HIGH_MASK                 0xFF
+#define SEGMENT_DESCRIPTOR_64_BASE_ADDRESS_HIGH(_)                   (((_) >> 24) & 0xFF)
     };
 
     uint32_t flags;
   } ;
+#define SEGMENT_DESCRIPTOR_64_RESERVED_BITS                          0x00
 
 
   /**
@@ -17651,68 +19835,69 @@ typedef struct
        * [Bits 2:0] Index into the TSS Interrupt Stack Table.
        */
       uint32_t interrupt_stack_table                                 : 3;
-#define SEGMENT__INTERRUPT_STACK_TABLE_BIT                           0
-#define SEGMENT__INTERRUPT_STACK_TABLE_FLAG                          0x07
-#define SEGMENT__INTERRUPT_STACK_TABLE_MASK                          0x07
-#define SEGMENT__INTERRUPT_STACK_TABLE(_)                            (((_) >> 0) & 0x07)
+#define SEGMENT_DESCRIPTOR_INTERRUPT_GATE_64_INTERRUPT_STACK_TABLE_BIT 0
+#define SEGMENT_DESCRIPTOR_INTERRUPT_GATE_64_INTERRUPT_STACK_TABLE_FLAG 0x07
+#define SEGMENT_DESCRIPTOR_INTERRUPT_GATE_64_INTERRUPT_STACK_TABLE_MASK 0x07
+#define SEGMENT_DESCRIPTOR_INTERRUPT_GATE_64_INTERRUPT_STACK_TABLE(_) (((_) >> 0) & 0x07)
 
       /**
        * [Bits 7:3] This field must be set to zero.
        */
       uint32_t must_be_zero_0                                        : 5;
-#define SEGMENT__MUST_BE_ZERO_0_BIT                                  3
-#define SEGMENT__MUST_BE_ZERO_0_FLAG                                 0xF8
-#define SEGMENT__MUST_BE_ZERO_0_MASK                                 0x1F
-#define SEGMENT__MUST_BE_ZERO_0(_)                                   (((_) >> 3) & 0x1F)
+#define SEGMENT_DESCRIPTOR_INTERRUPT_GATE_64_MUST_BE_ZERO_0_BIT      3
+#define SEGMENT_DESCRIPTOR_INTERRUPT_GATE_64_MUST_BE_ZERO_0_FLAG     0xF8
+#define SEGMENT_DESCRIPTOR_INTERRUPT_GATE_64_MUST_BE_ZERO_0_MASK     0x1F
+#define SEGMENT_DESCRIPTOR_INTERRUPT_GATE_64_MUST_BE_ZERO_0(_)       (((_) >> 3) & 0x1F)
 
       /**
        * [Bits 11:8] Indicates the segment or gate type.
        */
       uint32_t type                                                  : 4;
-#define SEGMENT__TYPE_BIT                                            8
-#define SEGMENT__TYPE_FLAG                                           0xF00
-#define SEGMENT__TYPE_MASK                                           0x0F
-#define SEGMENT__TYPE(_)                                             (((_) >> 8) & 0x0F)
+#define SEGMENT_DESCRIPTOR_INTERRUPT_GATE_64_TYPE_BIT                8
+#define SEGMENT_DESCRIPTOR_INTERRUPT_GATE_64_TYPE_FLAG               0xF00
+#define SEGMENT_DESCRIPTOR_INTERRUPT_GATE_64_TYPE_MASK               0x0F
+#define SEGMENT_DESCRIPTOR_INTERRUPT_GATE_64_TYPE(_)                 (((_) >> 8) & 0x0F)
 
       /**
        * [Bit 12] This field must be set to zero.
        */
       uint32_t must_be_zero_1                                        : 1;
-#define SEGMENT__MUST_BE_ZERO_1_BIT                                  12
-#define SEGMENT__MUST_BE_ZERO_1_FLAG                                 0x1000
-#define SEGMENT__MUST_BE_ZERO_1_MASK                                 0x01
-#define SEGMENT__MUST_BE_ZERO_1(_)                                   (((_) >> 12) & 0x01)
+#define SEGMENT_DESCRIPTOR_INTERRUPT_GATE_64_MUST_BE_ZERO_1_BIT      12
+#define SEGMENT_DESCRIPTOR_INTERRUPT_GATE_64_MUST_BE_ZERO_1_FLAG     0x1000
+#define SEGMENT_DESCRIPTOR_INTERRUPT_GATE_64_MUST_BE_ZERO_1_MASK     0x01
+#define SEGMENT_DESCRIPTOR_INTERRUPT_GATE_64_MUST_BE_ZERO_1(_)       (((_) >> 12) & 0x01)
 
       /**
        * [Bits 14:13] Specifies the segment privilege level.
        */
       uint32_t descriptor_privilege_level                            : 2;
-#define SEGMENT__DESCRIPTOR_PRIVILEGE_LEVEL_BIT                      13
-#define SEGMENT__DESCRIPTOR_PRIVILEGE_LEVEL_FLAG                     0x6000
-#define SEGMENT__DESCRIPTOR_PRIVILEGE_LEVEL_MASK                     0x03
-#define SEGMENT__DESCRIPTOR_PRIVILEGE_LEVEL(_)                       (((_) >> 13) & 0x03)
+#define SEGMENT_DESCRIPTOR_INTERRUPT_GATE_64_DESCRIPTOR_PRIVILEGE_LEVEL_BIT 13
+#define SEGMENT_DESCRIPTOR_INTERRUPT_GATE_64_DESCRIPTOR_PRIVILEGE_LEVEL_FLAG 0x6000
+#define SEGMENT_DESCRIPTOR_INTERRUPT_GATE_64_DESCRIPTOR_PRIVILEGE_LEVEL_MASK 0x03
+#define SEGMENT_DESCRIPTOR_INTERRUPT_GATE_64_DESCRIPTOR_PRIVILEGE_LEVEL(_) (((_) >> 13) & 0x03)
 
       /**
        * [Bit 15] Indicates whether the segment is present in memory (set) or not present (clear).
        */
       uint32_t present                                               : 1;
-#define SEGMENT__PRESENT_BIT                                         15
-#define SEGMENT__PRESENT_FLAG                                        0x8000
-#define SEGMENT__PRESENT_MASK                                        0x01
-#define SEGMENT__PRESENT(_)                                          (((_) >> 15) & 0x01)
+#define SEGMENT_DESCRIPTOR_INTERRUPT_GATE_64_PRESENT_BIT             15
+#define SEGMENT_DESCRIPTOR_INTERRUPT_GATE_64_PRESENT_FLAG            0x8000
+#define SEGMENT_DESCRIPTOR_INTERRUPT_GATE_64_PRESENT_MASK            0x01
+#define SEGMENT_DESCRIPTOR_INTERRUPT_GATE_64_PRESENT(_)              (((_) >> 15) & 0x01)
 
       /**
        * [Bits 31:16] Offset to procedure entry point (31:16).
        */
       uint32_t offset_middle                                         : 16;
-#define SEGMENT__OFFSET_MIDDLE_BIT                                   16
-#define SEGMENT__OFFSET_MIDDLE_FLAG                                  0xFFFF0000
-#define SEGMENT__OFFSET_MIDDLE_MASK                                  0xFFFF
-#define SEGMENT__OFFSET_MIDDLE(_)                                    (((_) >> 16) & 0xFFFF)
+#define SEGMENT_DESCRIPTOR_INTERRUPT_GATE_64_OFFSET_MIDDLE_BIT       16
+#define SEGMENT_DESCRIPTOR_INTERRUPT_GATE_64_OFFSET_MIDDLE_FLAG      0xFFFF0000
+#define SEGMENT_DESCRIPTOR_INTERRUPT_GATE_64_OFFSET_MIDDLE_MASK      0xFFFF
+#define SEGMENT_DESCRIPTOR_INTERRUPT_GATE_64_OFFSET_MIDDLE(_)        (((_) >> 16) & 0xFFFF)
     };
 
     uint32_t flags;
   } ;
+#define SEGMENT_DESCRIPTOR_INTERRUPT_GATE_64_RESERVED_BITS           0x10F8
 
 
   /**
@@ -17724,6 +19909,74 @@ typedef struct
 
 #define SEGMENT_DESCRIPTOR_TYPE_SYSTEM                               0x00000000
 #define SEGMENT_DESCRIPTOR_TYPE_CODE_OR_DATA                         0x00000001
+/**
+ * @defgroup segment_descriptor_encoding \
+ *           Segment descriptor encoding and decoding
+ *
+ * Segment descriptor encoding and decoding.
+ *
+ * @remarks Descriptors are handled as 64-bit values (first 8 bytes of the descriptor), so that whole GDTs and IDTs can be
+ *          built by static initializers.
+ * @{
+ */
+/**
+ * Segment descriptor with base address _base (31:0), segment limit _limit (19:0) and access rights _access_rights (in
+ * layout of SEGMENT_ACCESS_RIGHTS, i.e. bits 23:8).
+ */
+#define SEGMENT_DESCRIPTOR_ENCODE(_base, _limit, _access_rights)     (((_limit) & 0xFFFFULL) | (((_base) & 0xFFFFFFULL) << 16) | (((_access_rights) & 0xF0FF00ULL) << 32) | (((_limit) & 0xF0000ULL) << 32) | (((_base) & 0xFF000000ULL) << 32))
+
+/**
+ * Base address (31:0) of segment descriptor _. Bits 63:32 of base address of 64-bit system segment descriptors (LDT, TSS)
+ * are held by the following 8 bytes of the descriptor.
+ */
+#define SEGMENT_DESCRIPTOR_DECODE_BASE(_)                            ((((_) >> 16) & 0xFFFFFF) | (((_) >> 32) & 0xFF000000))
+
+/**
+ * Segment limit (19:0) of segment descriptor _ (in units given by the G flag).
+ */
+#define SEGMENT_DESCRIPTOR_DECODE_LIMIT(_)                           (((_) & 0xFFFF) | (((_) >> 32) & 0xF0000))
+
+/**
+ * Segment limit of segment descriptor _ in bytes (scaled by the G flag).
+ */
+#define SEGMENT_DESCRIPTOR_DECODE_LIMIT_BYTES(_)                     (((((_) & 0xFFFF) | (((_) >> 32) & 0xF0000)) << ((((_) >> 55) & 0x01) * 12)) | ((((_) >> 55) & 0x01) * 0xFFF))
+
+/**
+ * Access rights of segment descriptor _ in layout of SEGMENT_ACCESS_RIGHTS (as returned by LAR).
+ */
+#define SEGMENT_DESCRIPTOR_DECODE_ACCESS_RIGHTS(_)                   (((_) >> 32) & 0xF0FF00)
+
+/**
+ * Access rights of segment descriptor _ in layout of guest-state area segment access rights (VMX). The "segment unusable"
+ * bit (16) is not set.
+ */
+#define SEGMENT_DESCRIPTOR_DECODE_VMX_ACCESS_RIGHTS(_)               (((_) >> 40) & 0xF0FF)
+
+/**
+ * Lower 8 bytes of present 64-bit gate descriptor with procedure entry point _offset, segment selector _selector, IST
+ * index _ist, gate type _type and privilege level _dpl. The upper 8 bytes hold
+ * SEGMENT_INTERRUPT_GATE_ENCODE_UPPER(_offset).
+ */
+#define SEGMENT_INTERRUPT_GATE_ENCODE(_offset, _selector, _ist, _type, _dpl) (((_offset) & 0xFFFFULL) | (((_selector) & 0xFFFFULL) << 16) | (((_ist) & 0x07ULL) << 32) | (((_type) & 0x0FULL) << 40) | (((_dpl) & 0x03ULL) << 45) | 0x800000000000ULL | (((_offset) & 0xFFFF0000ULL) << 32))
+
+/**
+ * Upper 8 bytes of 64-bit gate descriptor with procedure entry point _offset.
+ */
+#define SEGMENT_INTERRUPT_GATE_ENCODE_UPPER(_offset)                 ((_offset) >> 32)
+
+/**
+ * Procedure entry point of 64-bit gate descriptor with lower 8 bytes _ and upper 8 bytes _upper.
+ */
+#define SEGMENT_INTERRUPT_GATE_DECODE_OFFSET(_, _upper)              (((_) & 0xFFFF) | (((_) >> 32) & 0xFFFF0000) | ((_upper) << 32))
+
+/**
+ * Offset of the descriptor selected by segment selector _ in the GDT or LDT.
+ */
+#define SEGMENT_SELECTOR_DESCRIPTOR_OFFSET(_)                        ((_) & 0xFFF8)
+/**
+ * @}
+ */
+
 /**
  * @defgroup segment_descriptor_code_and_data_type \
  *           Code- and Data-Segment Descriptor Types
@@ -17986,6 +20239,7 @@ typedef union
 
   uint16_t flags;
 } segment_selector;
+#define SEGMENT_SELECTOR_RESERVED_BITS                               0x00
 
 /**
  * @}
@@ -18962,6 +21216,7 @@ typedef union
 
   uint64_t flags;
 } vmx_exit_qualification_debug_exception;
+#define VMX_EXIT_QUALIFICATION_DEBUG_EXCEPTION_RESERVED_BITS         0xFFFFFFFFFFFF9FF0
 
 /**
  * @brief Exit Qualification for Task Switch
@@ -18997,6 +21252,7 @@ typedef union
 
   uint64_t flags;
 } vmx_exit_qualification_task_switch;
+#define VMX_EXIT_QUALIFICATION_TASK_SWITCH_RESERVED_BITS             0xFFFFFFFF3FFF0000
 
 /**
  * @brief Exit Qualification for Control-Register Accesses
@@ -19069,6 +21325,12 @@ typedef union
 #define VMX_EXIT_QUALIFICATION_GENREG_R13                            0x0000000D
 #define VMX_EXIT_QUALIFICATION_GENREG_R14                            0x0000000E
 #define VMX_EXIT_QUALIFICATION_GENREG_R15                            0x0000000F
+
+    /**
+     * Offset of the general-purpose register in array of 64-bit registers ordered by their encoding (RAX first). Also applies
+     * to exit qualification for MOV DR.
+     */
+#define VMX_EXIT_QUALIFICATION_GENREG_OFFSET(_)                      ((((_) >> 8) & 0x0F) << 3)
     uint64_t reserved2                                               : 4;
 
     /**
@@ -19084,6 +21346,7 @@ typedef union
 
   uint64_t flags;
 } vmx_exit_qualification_mov_cr;
+#define VMX_EXIT_QUALIFICATION_MOV_CR_RESERVED_BITS                  0xFFFFFFFF0000F080
 
 /**
  * @brief Exit Qualification for MOV DR
@@ -19133,6 +21396,7 @@ typedef union
 
   uint64_t flags;
 } vmx_exit_qualification_mov_dr;
+#define VMX_EXIT_QUALIFICATION_MOV_DR_RESERVED_BITS                  0xFFFFFFFFFFFFF0E8
 
 /**
  * @brief Exit Qualification for I/O Instructions
@@ -19153,6 +21417,11 @@ typedef union
 #define VMX_EXIT_QUALIFICATION_WIDTH_2_BYTE                          0x00000001
 #define VMX_EXIT_QUALIFICATION_WIDTH_4_BYTE                          0x00000003
 
+    /**
+     * Size of access in bytes (1, 2 or 4).
+     */
+#define VMX_EXIT_QUALIFICATION_WIDTH_BYTES(_)                        (((_) & 0x07) + 1)
+
     /**
      * [Bit 3] Direction of the attempted access (0 = OUT, 1 = IN).
      */
@@ -19211,6 +21480,7 @@ typedef union
 
   uint64_t flags;
 } vmx_exit_qualification_io_instruction;
+#define VMX_EXIT_QUALIFICATION_IO_INSTRUCTION_RESERVED_BITS          0xFFFFFFFF0000FF80
 
 /**
  * @brief Exit Qualification for APIC-Access VM Exits from Linear Accesses and Guest-Physical Accesses
@@ -19271,6 +21541,7 @@ typedef union
 
   uint64_t flags;
 } vmx_exit_qualification_apic_access;
+#define VMX_EXIT_QUALIFICATION_APIC_ACCESS_RESERVED_BITS             0xFFFFFFFFFFFF0000
 
 /**
  * @brief Exit Qualification for EPT Violations
@@ -19467,6 +21738,61 @@ typedef union
 
   uint64_t flags;
 } vmx_exit_qualification_ept_violation;
+#define VMX_EXIT_QUALIFICATION_EPT_VIOLATION_RESERVED_BITS           0xFFFFFFFFFFFE0000
+
+/**
+ * Number of distinct values of VMX_EXIT_QUALIFICATION_EPT_VIOLATION_INDEX.
+ */
+#define VMX_EXIT_QUALIFICATION_EPT_VIOLATION_INDEX_COUNT             0x00000100
+
+/**
+ * Index combining the access bits (read, write, execute), the permission bits of the EPT entry (readable, writeable,
+ * executable), the guest linear-address valid bit and the linear-address translation bit of the EPT violation exit
+ * qualification. Bits 5:0 of the index are bits 5:0 of the exit qualification, bits 7:6 are bits 8:7 (bit 6 is skipped, it
+ * is undefined unless "mode-based execute control for EPT" is 1). Suitable for indexing table of
+ * VMX_EXIT_QUALIFICATION_EPT_VIOLATION_INDEX_COUNT handlers/actions.
+ */
+#define VMX_EXIT_QUALIFICATION_EPT_VIOLATION_INDEX(_)                (((_) & (VMX_EXIT_QUALIFICATION_EPT_VIOLATION_READ_ACCESS_FLAG | VMX_EXIT_QUALIFICATION_EPT_VIOLATION_WRITE_ACCESS_FLAG | VMX_EXIT_QUALIFICATION_EPT_VIOLATION_EXECUTE_ACCESS_FLAG | VMX_EXIT_QUALIFICATION_EPT_VIOLATION_EPT_READABLE_FLAG | VMX_EXIT_QUALIFICATION_EPT_VIOLATION_EPT_WRITEABLE_FLAG | VMX_EXIT_QUALIFICATION_EPT_VIOLATION_EPT_EXECUTABLE_FLAG)) | (((_) & (VMX_EXIT_QUALIFICATION_EPT_VIOLATION_VALID_GUEST_LINEAR_ADDRESS_FLAG | VMX_EXIT_QUALIFICATION_EPT_VIOLATION_CAUSED_BY_TRANSLATION_FLAG)) >> 1))
+
+/**
+ * Accesses denied by the EPT entry (bit 0 - read, bit 1 - write, bit 2 - execute). If "mode-based execute control for EPT"
+ * is 1, execute permission is reported by bits 5 (supervisor) and 6 (user) instead.
+ */
+#define VMX_EXIT_QUALIFICATION_EPT_VIOLATION_DENIED(_)               ((_) & ~((_) >> 3) & (VMX_EXIT_QUALIFICATION_EPT_VIOLATION_READ_ACCESS_FLAG | VMX_EXIT_QUALIFICATION_EPT_VIOLATION_WRITE_ACCESS_FLAG | VMX_EXIT_QUALIFICATION_EPT_VIOLATION_EXECUTE_ACCESS_FLAG))
+/**
+ * @defgroup vmx_exit_qualification_entry_failure \
+ *           Exit Qualification for VM-Entry Failures During or After Loading Guest State
+ *
+ * Exit Qualification for VM-Entry Failures During or After Loading Guest State.
+ *
+ * @remarks For VM-entry failures due to MSR loading, exit qualification holds index (starting with 1) of the failing entry
+ *          of the VM-entry MSR-load area instead.
+ * @see Vol3C[26.8(VM-ENTRY FAILURES DURING OR AFTER LOADING GUEST STATE)] (reference)
+ * @{
+ */
+/**
+ * Not used.
+ */
+#define VMX_EXIT_QUALIFICATION_ENTRY_FAILURE_NOT_USED                0x00000000
+
+/**
+ * Failure was due to a problem loading the PDPTEs.
+ */
+#define VMX_EXIT_QUALIFICATION_ENTRY_FAILURE_PDPTE_LOAD              0x00000002
+
+/**
+ * Failure was due to an attempt to inject a non-maskable interrupt (NMI) into a guest that is blocking events through the
+ * STI blocking bit.
+ */
+#define VMX_EXIT_QUALIFICATION_ENTRY_FAILURE_NMI_INJECTION           0x00000003
+
+/**
+ * Failure was due to an invalid VMCS link pointer.
+ */
+#define VMX_EXIT_QUALIFICATION_ENTRY_FAILURE_INVALID_VMCS_LINK_POINTER 0x00000004
+/**
+ * @}
+ */
 
 /**
  * @}
@@ -19526,6 +21852,7 @@ typedef union
 
   uint64_t flags;
 } vmx_vmexit_instruction_info_ins_outs;
+#define VMX_VMEXIT_INSTRUCTION_INFO_INS_OUTS_RESERVED_BITS           0xFFFFFFFFFFFC7C7F
 
 /**
  * @brief VM-Exit Instruction-Information Field as Used for INVEPT, INVPCID, and INVVPID
@@ -19632,6 +21959,7 @@ typedef union
 
   uint64_t flags;
 } vmx_vmexit_instruction_info_invalidate;
+#define VMX_VMEXIT_INSTRUCTION_INFO_INVALIDATE_RESERVED_BITS         0xFFFFFFFF00007C7C
 
 /**
  * @brief VM-Exit Instruction-Information Field as Used for LIDT, LGDT, SIDT, or SGDT
@@ -19757,6 +22085,7 @@ typedef union
 
   uint64_t flags;
 } vmx_vmexit_instruction_info_gdtr_idtr_access;
+#define VMX_VMEXIT_INSTRUCTION_INFO_GDTR_IDTR_ACCESS_RESERVED_BITS   0xFFFFFFFFC000747C
 
 /**
  * @brief VM-Exit Instruction-Information Field as Used for LLDT, LTR, SLDT, and STR
@@ -19887,6 +22216,7 @@ typedef union
 
   uint64_t flags;
 } vmx_vmexit_instruction_info_ldtr_tr_access;
+#define VMX_VMEXIT_INSTRUCTION_INFO_LDTR_TR_ACCESS_RESERVED_BITS     0xFFFFFFFFC0007804
 
 /**
  * @brief VM-Exit Instruction-Information Field as Used for RDRAND and RDSEED
@@ -19925,6 +22255,7 @@ typedef union
 
   uint64_t flags;
 } vmx_vmexit_instruction_info_rdrand_rdseed;
+#define VMX_VMEXIT_INSTRUCTION_INFO_RDRAND_RDSEED_RESERVED_BITS      0xFFFFFFFFFFFFE787
 
 /**
  * @brief VM-Exit Instruction-Information Field as Used for VMCLEAR, VMPTRLD, VMPTRST, VMXON, XRSTORS, and XSAVES
@@ -20022,6 +22353,7 @@ typedef union
 
   uint64_t flags;
 } vmx_vmexit_instruction_info_vmx_and_xsaves;
+#define VMX_VMEXIT_INSTRUCTION_INFO_VMX_AND_XSAVES_RESERVED_BITS     0xFFFFFFFFF0007C7C
 
 /**
  * @brief VM-Exit Instruction-Information Field as Used for VMREAD and VMWRITE
@@ -20148,7 +22480,46 @@ typedef union
 
   uint64_t flags;
 } vmx_vmexit_instruction_info_vmread_vmwrite;
+#define VMX_VMEXIT_INSTRUCTION_INFO_VMREAD_VMWRITE_RESERVED_BITS     0xFFFFFFFF00007804
+
+/**
+ * Scale factor of the index register (1, 2, 4 or 8). Undefined if there is no index register.
+ */
+#define VMX_VMEXIT_INSTRUCTION_INFO_SCALE(_)                         (1 << ((_) & 0x03))
+
+/**
+ * Address size in bytes (2, 4 or 8).
+ */
+#define VMX_VMEXIT_INSTRUCTION_INFO_ADDRESS_SIZE_BYTES(_)            (2 << (((_) >> 7) & 0x07))
+
+/**
+ * Mask of the address size (16, 32 or 64 bits).
+ */
+#define VMX_VMEXIT_INSTRUCTION_INFO_ADDRESS_MASK(_)                  (0xFFFFFFFFFFFFFFFF >> (64 - (16 << (((_) >> 7) & 0x07))))
+
+/**
+ * Value of the index register, or 0 if there is no index register. _gpr is array of 64-bit general-purpose registers
+ * ordered by their encoding (RAX, RCX, RDX, RBX, RSP, RBP, RSI, RDI, R8 - R15).
+ */
+#define VMX_VMEXIT_INSTRUCTION_INFO_INDEX_VALUE(_, _gpr)             ((_gpr)[((_) >> 18) & 0x0F] * ((((_) >> 22) & 0x01) ^ 0x01))
+
+/**
+ * Value of the base register, or 0 if there is no base register. _gpr is array of 64-bit general-purpose registers ordered
+ * by their encoding.
+ */
+#define VMX_VMEXIT_INSTRUCTION_INFO_BASE_VALUE(_, _gpr)              ((_gpr)[((_) >> 23) & 0x0F] * ((((_) >> 27) & 0x01) ^ 0x01))
 
+/**
+ * Effective address of the memory operand (base + index * scale + displacement, truncated to the address size).
+ * _displacement is the exit qualification. Undefined for register operands (bit 10 is set).
+ */
+#define VMX_VMEXIT_INSTRUCTION_INFO_EFFECTIVE_ADDRESS(_, _displacement, _gpr) ((VMX_VMEXIT_INSTRUCTION_INFO_BASE_VALUE(_, _gpr) + (VMX_VMEXIT_INSTRUCTION_INFO_INDEX_VALUE(_, _gpr) << ((_) & 0x03)) + (_displacement)) & VMX_VMEXIT_INSTRUCTION_INFO_ADDRESS_MASK(_))
+
+/**
+ * Linear address of the memory operand. _segment_base is array of segment bases ordered by their encoding (ES, CS, SS, DS,
+ * FS, GS), holding 0 for ES, CS, SS and DS in 64-bit mode. Outside of 64-bit mode the result must be truncated to 32 bits.
+ */
+#define VMX_VMEXIT_INSTRUCTION_INFO_LINEAR_ADDRESS(_, _displacement, _gpr, _segment_base) ((_segment_base)[((_) >> 15) & 0x07] + VMX_VMEXIT_INSTRUCTION_INFO_EFFECTIVE_ADDRESS(_, _displacement, _gpr))
 /**
  * @}
  */
@@ -20259,6 +22630,36 @@ typedef union
 
   uint32_t flags;
 } vmx_segment_access_rights;
+#define VMX_SEGMENT_ACCESS_RIGHTS_RESERVED_BITS                      0xFFFE0F00
+
+/**
+ * @defgroup vmx_segment_state \
+ *           Decoding of guest segment state held in the guest-state area
+ *
+ * Decoding of guest segment state held in the guest-state area.
+ *
+ * @see SEGMENT_ACCESS_RIGHTS
+ * @see Vol3C[24.4.1(Guest Register State)] (reference)
+ * @{
+ */
+/**
+ * Default operand size (16, 32 or 64) of the code segment with access rights _ (guest CS access rights). The L flag may be
+ * set only if the guest is in IA-32e mode. Computed as 16 shifted by 2 if L is set, otherwise by D/B.
+ */
+#define VMX_SEGMENT_CODE_SIZE(_)                                     (16 << (((((_) >> 13) & 0x01) << 1) | (((_) >> 14) & ~((_) >> 13) & 0x01)))
+
+/**
+ * Current privilege level of the guest. _ is guest SS access rights (SS.DPL is always equal to CPL).
+ */
+#define VMX_SEGMENT_CPL(_)                                           (((_) >> 5) & 0x03)
+
+/**
+ * 1 if the segment with access rights _ is usable; 0 otherwise.
+ */
+#define VMX_SEGMENT_USABLE(_)                                        ((((_) >> 16) & 0x01) ^ 0x01)
+/**
+ * @}
+ */
 
 /**
  * @brief The IA-32 architecture includes features that permit certain events to be blocked for a period of time. This
@@ -20338,6 +22739,7 @@ typedef union
 
   uint32_t flags;
 } vmx_interruptibility_state;
+#define VMX_INTERRUPTIBILITY_STATE_RESERVED_BITS                     0xFFFFFFE0
 
 typedef enum
 {
@@ -20447,6 +22849,55 @@ typedef union
 
   uint64_t flags;
 } vmx_pending_debug_exceptions;
+#define VMX_PENDING_DEBUG_EXCEPTIONS_RESERVED_BITS                   0xFFFFFFFFFFFEAFF0
+
+/**
+ * @defgroup vmx_guest_state_checks \
+ *           Checks of the guest-state area performed by VM entry. Each check evaluates to 1 if the field passes it, so
+ *                     that results of all checks can be combined into a bitmap without branches
+ *
+ * Checks of the guest-state area performed by VM entry. Each check evaluates to 1 if the field passes it, so that results
+ * of all checks can be combined into a bitmap without branches.
+ *
+ * @see Vol3C[26.3.1(Checks on the Guest State Area)] (reference)
+ * @{
+ */
+/**
+ * CR0 or CR4 respects its fixed bits (IA32_VMX_CR0_FIXED0/1 or IA32_VMX_CR4_FIXED0/1). If the "unrestricted guest"
+ * VM-execution control is 1, PE and PG must be removed from _fixed0 of CR0.
+ *
+ * @see Vol3D[A.7(VMX-FIXED BITS IN CR0)]
+ */
+#define VMX_GUEST_STATE_CR_VALID(_, _fixed0, _fixed1)                ((((_) | (_fixed0)) & (_fixed1)) == (_))
+
+/**
+ * Reserved bits 63:22, 15, 5 and 3 of RFLAGS are 0 and reserved bit 1 is 1.
+ */
+#define VMX_GUEST_STATE_RFLAGS_VALID(_)                              ((((_) & RFLAGS_RESERVED_BITS) == 0) & (((_) & RFLAGS_READ_AS_1_FLAG) != 0))
+
+/**
+ * Reserved bits 11:8 and 31:17 of the access rights of usable segment are 0. Access rights of unusable segments are not
+ * checked.
+ */
+#define VMX_GUEST_STATE_SEGMENT_ACCESS_RIGHTS_VALID(_)               ((((_) & VMX_SEGMENT_ACCESS_RIGHTS_UNUSABLE_FLAG) != 0) | (((_) & VMX_SEGMENT_ACCESS_RIGHTS_RESERVED_BITS) == 0))
+
+/**
+ * Reserved bits 31:5 of interruptibility state are 0 and blocking by STI and blocking by MOV SS are not both set.
+ */
+#define VMX_GUEST_STATE_INTERRUPTIBILITY_STATE_VALID(_)              ((((_) & VMX_INTERRUPTIBILITY_STATE_RESERVED_BITS) == 0) & (((_) & (VMX_INTERRUPTIBILITY_STATE_BLOCKING_BY_STI_FLAG | VMX_INTERRUPTIBILITY_STATE_BLOCKING_BY_MOV_SS_FLAG)) != (VMX_INTERRUPTIBILITY_STATE_BLOCKING_BY_STI_FLAG | VMX_INTERRUPTIBILITY_STATE_BLOCKING_BY_MOV_SS_FLAG)))
+
+/**
+ * Activity state is one of the values of VMX_GUEST_ACTIVITY_STATE.
+ */
+#define VMX_GUEST_STATE_ACTIVITY_STATE_VALID(_)                      ((_) <= 3)
+
+/**
+ * Reserved bits 11:4, 13, 15 and 63:17 of pending debug exceptions are 0.
+ */
+#define VMX_GUEST_STATE_PENDING_DEBUG_EXCEPTIONS_VALID(_)            (((_) & VMX_PENDING_DEBUG_EXCEPTIONS_RESERVED_BITS) == 0)
+/**
+ * @}
+ */
 
 /**
  * @}
@@ -20533,6 +22984,7 @@ typedef union
 
   uint32_t flags;
 } vmx_vmexit_reason;
+#define VMX_VMEXIT_REASON_RESERVED_BITS                              0x47FE0000
 
 typedef struct
 {
@@ -20643,6 +23095,8 @@ typedef union
 
   uint64_t flags;
 } ept_pointer;
+#define EPT_POINTER_RESERVED_BITS                                    0xFFF0000000000F00
+#define EPT_POINTER_ADDRESS_BITS                                     0xFFFFFFFFFF000
 
 /**
  * @brief Format of an EPT PML4 Entry (PML4E) that References an EPT Page-Directory-Pointer Table
@@ -20705,7 +23159,15 @@ typedef union
 #define EPT_PML4E_ACCESSED_FLAG                                      0x100
 #define EPT_PML4E_ACCESSED_MASK                                      0x01
 #define EPT_PML4E_ACCESSED(_)                                        (((_) >> 8) & 0x01)
-    uint64_t reserved2                                               : 1;
+
+    /**
+     * [Bit 9] Ignored.
+     */
+    uint64_t ignored_1                                               : 1;
+#define EPT_PML4E_IGNORED_1_BIT                                      9
+#define EPT_PML4E_IGNORED_1_FLAG                                     0x200
+#define EPT_PML4E_IGNORED_1_MASK                                     0x01
+#define EPT_PML4E_IGNORED_1(_)                                       (((_) >> 9) & 0x01)
 
     /**
      * [Bit 10] Execute access for user-mode linear addresses. If the "mode-based execute control for EPT" VM-execution control
@@ -20717,7 +23179,15 @@ typedef union
 #define EPT_PML4E_USER_MODE_EXECUTE_FLAG                             0x400
 #define EPT_PML4E_USER_MODE_EXECUTE_MASK                             0x01
 #define EPT_PML4E_USER_MODE_EXECUTE(_)                               (((_) >> 10) & 0x01)
-    uint64_t reserved3                                               : 1;
+
+    /**
+     * [Bit 11] Ignored.
+     */
+    uint64_t ignored_2                                               : 1;
+#define EPT_PML4E_IGNORED_2_BIT                                      11
+#define EPT_PML4E_IGNORED_2_FLAG                                     0x800
+#define EPT_PML4E_IGNORED_2_MASK                                     0x01
+#define EPT_PML4E_IGNORED_2(_)                                       (((_) >> 11) & 0x01)
 
     /**
      * [Bits 47:12] Physical address of 4-KByte aligned EPT page-directory-pointer table referenced by this entry.
@@ -20727,11 +23197,22 @@ typedef union
 #define EPT_PML4E_PAGE_FRAME_NUMBER_FLAG                             0xFFFFFFFFF000
 #define EPT_PML4E_PAGE_FRAME_NUMBER_MASK                             0xFFFFFFFFF
 #define EPT_PML4E_PAGE_FRAME_NUMBER(_)                               (((_) >> 12) & 0xFFFFFFFFF)
-    uint64_t reserved4                                               : 16;
+    uint64_t reserved2                                               : 4;
+
+    /**
+     * [Bits 63:52] Ignored.
+     */
+    uint64_t ignored_3                                               : 12;
+#define EPT_PML4E_IGNORED_3_BIT                                      52
+#define EPT_PML4E_IGNORED_3_FLAG                                     0xFFF0000000000000
+#define EPT_PML4E_IGNORED_3_MASK                                     0xFFF
+#define EPT_PML4E_IGNORED_3(_)                                       (((_) >> 52) & 0xFFF)
   };
 
   uint64_t flags;
 } ept_pml4e;
+#define EPT_PML4E_RESERVED_BITS                                      0xF8
+#define EPT_PML4E_ADDRESS_BITS                                       0xFFFFFFFFFF000
 
 /**
  * @brief Format of an EPT Page-Directory-Pointer-Table Entry (PDPTE) that Maps a 1-GByte Page
@@ -20835,7 +23316,16 @@ typedef union
 #define EPT_PDPTE_1GB_USER_MODE_EXECUTE_FLAG                         0x400
 #define EPT_PDPTE_1GB_USER_MODE_EXECUTE_MASK                         0x01
 #define EPT_PDPTE_1GB_USER_MODE_EXECUTE(_)                           (((_) >> 10) & 0x01)
-    uint64_t reserved1                                               : 19;
+
+    /**
+     * [Bit 11] Ignored.
+     */
+    uint64_t ignored_1                                               : 1;
+#define EPT_PDPTE_1GB_IGNORED_1_BIT                                  11
+#define EPT_PDPTE_1GB_IGNORED_1_FLAG                                 0x800
+#define EPT_PDPTE_1GB_IGNORED_1_MASK                                 0x01
+#define EPT_PDPTE_1GB_IGNORED_1(_)                                   (((_) >> 11) & 0x01)
+    uint64_t reserved1                                               : 18;
 
     /**
      * [Bits 47:30] Physical address of 4-KByte aligned EPT page-directory-pointer table referenced by this entry.
@@ -20845,7 +23335,16 @@ typedef union
 #define EPT_PDPTE_1GB_PAGE_FRAME_NUMBER_FLAG                         0xFFFFC0000000
 #define EPT_PDPTE_1GB_PAGE_FRAME_NUMBER_MASK                         0x3FFFF
 #define EPT_PDPTE_1GB_PAGE_FRAME_NUMBER(_)                           (((_) >> 30) & 0x3FFFF)
-    uint64_t reserved2                                               : 9;
+    uint64_t reserved2                                               : 4;
+
+    /**
+     * [Bits 56:52] Ignored.
+     */
+    uint64_t ignored_2                                               : 5;
+#define EPT_PDPTE_1GB_IGNORED_2_BIT                                  52
+#define EPT_PDPTE_1GB_IGNORED_2_FLAG                                 0x1F0000000000000
+#define EPT_PDPTE_1GB_IGNORED_2_MASK                                 0x1F
+#define EPT_PDPTE_1GB_IGNORED_2(_)                                   (((_) >> 52) & 0x1F)
 
     /**
      * [Bit 57] Verify guest paging. If the "guest-paging verification" VM-execution control is 1, indicates limits on the
@@ -20871,7 +23370,15 @@ typedef union
 #define EPT_PDPTE_1GB_PAGING_WRITE_ACCESS_FLAG                       0x400000000000000
 #define EPT_PDPTE_1GB_PAGING_WRITE_ACCESS_MASK                       0x01
 #define EPT_PDPTE_1GB_PAGING_WRITE_ACCESS(_)                         (((_) >> 58) & 0x01)
-    uint64_t reserved3                                               : 1;
+
+    /**
+     * [Bit 59] Ignored.
+     */
+    uint64_t ignored_3                                               : 1;
+#define EPT_PDPTE_1GB_IGNORED_3_BIT                                  59
+#define EPT_PDPTE_1GB_IGNORED_3_FLAG                                 0x800000000000000
+#define EPT_PDPTE_1GB_IGNORED_3_MASK                                 0x01
+#define EPT_PDPTE_1GB_IGNORED_3(_)                                   (((_) >> 59) & 0x01)
 
     /**
      * [Bit 60] Supervisor shadow stack. If bit 7 of EPTP is 1, indicates whether supervisor shadow stack accesses are allowed
@@ -20884,7 +23391,15 @@ typedef union
 #define EPT_PDPTE_1GB_SUPERVISOR_SHADOW_STACK_FLAG                   0x1000000000000000
 #define EPT_PDPTE_1GB_SUPERVISOR_SHADOW_STACK_MASK                   0x01
 #define EPT_PDPTE_1GB_SUPERVISOR_SHADOW_STACK(_)                     (((_) >> 60) & 0x01)
-    uint64_t reserved4                                               : 2;
+
+    /**
+     * [Bits 62:61] Ignored.
+     */
+    uint64_t ignored_4                                               : 2;
+#define EPT_PDPTE_1GB_IGNORED_4_BIT                                  61
+#define EPT_PDPTE_1GB_IGNORED_4_FLAG                                 0x6000000000000000
+#define EPT_PDPTE_1GB_IGNORED_4_MASK                                 0x03
+#define EPT_PDPTE_1GB_IGNORED_4(_)                                   (((_) >> 61) & 0x03)
 
     /**
      * [Bit 63] Suppress \#VE. If the "EPT-violation \#VE" VM-execution control is 1, EPT violations caused by accesses to this
@@ -20902,6 +23417,8 @@ typedef union
 
   uint64_t flags;
 } ept_pdpte_1gb;
+#define EPT_PDPTE_1GB_RESERVED_BITS                                  0x3FFFF000
+#define EPT_PDPTE_1GB_ADDRESS_BITS                                   0xFFFFFC0000000
 
 /**
  * @brief Format of an EPT Page-Directory-Pointer-Table Entry (PDPTE) that References an EPT Page Directory
@@ -20952,7 +23469,15 @@ typedef union
 #define EPT_PDPTE_ACCESSED_FLAG                                      0x100
 #define EPT_PDPTE_ACCESSED_MASK                                      0x01
 #define EPT_PDPTE_ACCESSED(_)                                        (((_) >> 8) & 0x01)
-    uint64_t reserved2                                               : 1;
+
+    /**
+     * [Bit 9] Ignored.
+     */
+    uint64_t ignored_1                                               : 1;
+#define EPT_PDPTE_IGNORED_1_BIT                                      9
+#define EPT_PDPTE_IGNORED_1_FLAG                                     0x200
+#define EPT_PDPTE_IGNORED_1_MASK                                     0x01
+#define EPT_PDPTE_IGNORED_1(_)                                       (((_) >> 9) & 0x01)
 
     /**
      * [Bit 10] Execute access for user-mode linear addresses. If the "mode-based execute control for EPT" VM-execution control
@@ -20964,7 +23489,15 @@ typedef union
 #define EPT_PDPTE_USER_MODE_EXECUTE_FLAG                             0x400
 #define EPT_PDPTE_USER_MODE_EXECUTE_MASK                             0x01
 #define EPT_PDPTE_USER_MODE_EXECUTE(_)                               (((_) >> 10) & 0x01)
-    uint64_t reserved3                                               : 1;
+
+    /**
+     * [Bit 11] Ignored.
+     */
+    uint64_t ignored_2                                               : 1;
+#define EPT_PDPTE_IGNORED_2_BIT                                      11
+#define EPT_PDPTE_IGNORED_2_FLAG                                     0x800
+#define EPT_PDPTE_IGNORED_2_MASK                                     0x01
+#define EPT_PDPTE_IGNORED_2(_)                                       (((_) >> 11) & 0x01)
 
     /**
      * [Bits 47:12] Physical address of 4-KByte aligned EPT page-directory-pointer table referenced by this entry.
@@ -20974,11 +23507,22 @@ typedef union
 #define EPT_PDPTE_PAGE_FRAME_NUMBER_FLAG                             0xFFFFFFFFF000
 #define EPT_PDPTE_PAGE_FRAME_NUMBER_MASK                             0xFFFFFFFFF
 #define EPT_PDPTE_PAGE_FRAME_NUMBER(_)                               (((_) >> 12) & 0xFFFFFFFFF)
-    uint64_t reserved4                                               : 16;
+    uint64_t reserved2                                               : 4;
+
+    /**
+     * [Bits 63:52] Ignored.
+     */
+    uint64_t ignored_3                                               : 12;
+#define EPT_PDPTE_IGNORED_3_BIT                                      52
+#define EPT_PDPTE_IGNORED_3_FLAG                                     0xFFF0000000000000
+#define EPT_PDPTE_IGNORED_3_MASK                                     0xFFF
+#define EPT_PDPTE_IGNORED_3(_)                                       (((_) >> 52) & 0xFFF)
   };
 
   uint64_t flags;
 } ept_pdpte;
+#define EPT_PDPTE_RESERVED_BITS                                      0xF8
+#define EPT_PDPTE_ADDRESS_BITS                                       0xFFFFFFFFFF000
 
 /**
  * @brief Format of an EPT Page-Directory Entry (PDE) that Maps a 2-MByte Page
@@ -21082,7 +23626,16 @@ typedef union
 #define EPT_PDE_2MB_USER_MODE_EXECUTE_FLAG                           0x400
 #define EPT_PDE_2MB_USER_MODE_EXECUTE_MASK                           0x01
 #define EPT_PDE_2MB_USER_MODE_EXECUTE(_)                             (((_) >> 10) & 0x01)
-    uint64_t reserved1                                               : 10;
+
+    /**
+     * [Bit 11] Ignored.
+     */
+    uint64_t ignored_1                                               : 1;
+#define EPT_PDE_2MB_IGNORED_1_BIT                                    11
+#define EPT_PDE_2MB_IGNORED_1_FLAG                                   0x800
+#define EPT_PDE_2MB_IGNORED_1_MASK                                   0x01
+#define EPT_PDE_2MB_IGNORED_1(_)                                     (((_) >> 11) & 0x01)
+    uint64_t reserved1                                               : 9;
 
     /**
      * [Bits 47:21] Physical address of 4-KByte aligned EPT page-directory-pointer table referenced by this entry.
@@ -21092,7 +23645,16 @@ typedef union
 #define EPT_PDE_2MB_PAGE_FRAME_NUMBER_FLAG                           0xFFFFFFE00000
 #define EPT_PDE_2MB_PAGE_FRAME_NUMBER_MASK                           0x7FFFFFF
 #define EPT_PDE_2MB_PAGE_FRAME_NUMBER(_)                             (((_) >> 21) & 0x7FFFFFF)
-    uint64_t reserved2                                               : 9;
+    uint64_t reserved2                                               : 4;
+
+    /**
+     * [Bits 56:52] Ignored.
+     */
+    uint64_t ignored_2                                               : 5;
+#define EPT_PDE_2MB_IGNORED_2_BIT                                    52
+#define EPT_PDE_2MB_IGNORED_2_FLAG                                   0x1F0000000000000
+#define EPT_PDE_2MB_IGNORED_2_MASK                                   0x1F
+#define EPT_PDE_2MB_IGNORED_2(_)                                     (((_) >> 52) & 0x1F)
 
     /**
      * [Bit 57] Verify guest paging. If the "guest-paging verification" VM-execution control is 1, indicates limits on the
@@ -21118,7 +23680,15 @@ typedef union
 #define EPT_PDE_2MB_PAGING_WRITE_ACCESS_FLAG                         0x400000000000000
 #define EPT_PDE_2MB_PAGING_WRITE_ACCESS_MASK                         0x01
 #define EPT_PDE_2MB_PAGING_WRITE_ACCESS(_)                           (((_) >> 58) & 0x01)
-    uint64_t reserved3                                               : 1;
+
+    /**
+     * [Bit 59] Ignored.
+     */
+    uint64_t ignored_3                                               : 1;
+#define EPT_PDE_2MB_IGNORED_3_BIT                                    59
+#define EPT_PDE_2MB_IGNORED_3_FLAG                                   0x800000000000000
+#define EPT_PDE_2MB_IGNORED_3_MASK                                   0x01
+#define EPT_PDE_2MB_IGNORED_3(_)                                     (((_) >> 59) & 0x01)
 
     /**
      * [Bit 60] Supervisor shadow stack. If bit 7 of EPTP is 1, indicates whether supervisor shadow stack accesses are allowed
@@ -21131,7 +23701,15 @@ typedef union
 #define EPT_PDE_2MB_SUPERVISOR_SHADOW_STACK_FLAG                     0x1000000000000000
 #define EPT_PDE_2MB_SUPERVISOR_SHADOW_STACK_MASK                     0x01
 #define EPT_PDE_2MB_SUPERVISOR_SHADOW_STACK(_)                       (((_) >> 60) & 0x01)
-    uint64_t reserved4                                               : 2;
+
+    /**
+     * [Bits 62:61] Ignored.
+     */
+    uint64_t ignored_4                                               : 2;
+#define EPT_PDE_2MB_IGNORED_4_BIT                                    61
+#define EPT_PDE_2MB_IGNORED_4_FLAG                                   0x6000000000000000
+#define EPT_PDE_2MB_IGNORED_4_MASK                                   0x03
+#define EPT_PDE_2MB_IGNORED_4(_)                                     (((_) >> 61) & 0x03)
 
     /**
      * [Bit 63] Suppress \#VE. If the "EPT-violation \#VE" VM-execution control is 1, EPT violations caused by accesses to this
@@ -21149,6 +23727,8 @@ typedef union
 
   uint64_t flags;
 } ept_pde_2mb;
+#define EPT_PDE_2MB_RESERVED_BITS                                    0x1FF000
+#define EPT_PDE_2MB_ADDRESS_BITS                                     0xFFFFFFFE00000
 
 /**
  * @brief Format of an EPT Page-Directory Entry (PDE) that References an EPT Page Table
@@ -21199,7 +23779,15 @@ typedef union
 #define EPT_PDE_ACCESSED_FLAG                                        0x100
 #define EPT_PDE_ACCESSED_MASK                                        0x01
 #define EPT_PDE_ACCESSED(_)                                          (((_) >> 8) & 0x01)
-    uint64_t reserved2                                               : 1;
+
+    /**
+     * [Bit 9] Ignored.
+     */
+    uint64_t ignored_1                                               : 1;
+#define EPT_PDE_IGNORED_1_BIT                                        9
+#define EPT_PDE_IGNORED_1_FLAG                                       0x200
+#define EPT_PDE_IGNORED_1_MASK                                       0x01
+#define EPT_PDE_IGNORED_1(_)                                         (((_) >> 9) & 0x01)
 
     /**
      * [Bit 10] Execute access for user-mode linear addresses. If the "mode-based execute control for EPT" VM-execution control
@@ -21211,7 +23799,15 @@ typedef union
 #define EPT_PDE_USER_MODE_EXECUTE_FLAG                               0x400
 #define EPT_PDE_USER_MODE_EXECUTE_MASK                               0x01
 #define EPT_PDE_USER_MODE_EXECUTE(_)                                 (((_) >> 10) & 0x01)
-    uint64_t reserved3                                               : 1;
+
+    /**
+     * [Bit 11] Ignored.
+     */
+    uint64_t ignored_2                                               : 1;
+#define EPT_PDE_IGNORED_2_BIT                                        11
+#define EPT_PDE_IGNORED_2_FLAG                                       0x800
+#define EPT_PDE_IGNORED_2_MASK                                       0x01
+#define EPT_PDE_IGNORED_2(_)                                         (((_) >> 11) & 0x01)
 
     /**
      * [Bits 47:12] Physical address of 4-KByte aligned EPT page table referenced by this entry.
@@ -21221,11 +23817,22 @@ typedef union
 #define EPT_PDE_PAGE_FRAME_NUMBER_FLAG                               0xFFFFFFFFF000
 #define EPT_PDE_PAGE_FRAME_NUMBER_MASK                               0xFFFFFFFFF
 #define EPT_PDE_PAGE_FRAME_NUMBER(_)                                 (((_) >> 12) & 0xFFFFFFFFF)
-    uint64_t reserved4                                               : 16;
+    uint64_t reserved2                                               : 4;
+
+    /**
+     * [Bits 63:52] Ignored.
+     */
+    uint64_t ignored_3                                               : 12;
+#define EPT_PDE_IGNORED_3_BIT                                        52
+#define EPT_PDE_IGNORED_3_FLAG                                       0xFFF0000000000000
+#define EPT_PDE_IGNORED_3_MASK                                       0xFFF
+#define EPT_PDE_IGNORED_3(_)                                         (((_) >> 52) & 0xFFF)
   };
 
   uint64_t flags;
 } ept_pde;
+#define EPT_PDE_RESERVED_BITS                                        0xF8
+#define EPT_PDE_ADDRESS_BITS                                         0xFFFFFFFFFF000
 
 /**
  * @brief Format of an EPT Page-Table Entry that Maps a 4-KByte Page
@@ -21285,7 +23892,15 @@ typedef union
 #define EPT_PTE_IGNORE_PAT_FLAG                                      0x40
 #define EPT_PTE_IGNORE_PAT_MASK                                      0x01
 #define EPT_PTE_IGNORE_PAT(_)                                        (((_) >> 6) & 0x01)
-    uint64_t reserved1                                               : 1;
+
+    /**
+     * [Bit 7] Ignored.
+     */
+    uint64_t ignored_1                                               : 1;
+#define EPT_PTE_IGNORED_1_BIT                                        7
+#define EPT_PTE_IGNORED_1_FLAG                                       0x80
+#define EPT_PTE_IGNORED_1_MASK                                       0x01
+#define EPT_PTE_IGNORED_1(_)                                         (((_) >> 7) & 0x01)
 
     /**
      * [Bit 8] If bit 6 of EPTP is 1, accessed flag for EPT; indicates whether software has accessed the 4-KByte page
@@ -21321,7 +23936,15 @@ typedef union
 #define EPT_PTE_USER_MODE_EXECUTE_FLAG                               0x400
 #define EPT_PTE_USER_MODE_EXECUTE_MASK                               0x01
 #define EPT_PTE_USER_MODE_EXECUTE(_)                                 (((_) >> 10) & 0x01)
-    uint64_t reserved2                                               : 1;
+
+    /**
+     * [Bit 11] Ignored.
+     */
+    uint64_t ignored_2                                               : 1;
+#define EPT_PTE_IGNORED_2_BIT                                        11
+#define EPT_PTE_IGNORED_2_FLAG                                       0x800
+#define EPT_PTE_IGNORED_2_MASK                                       0x01
+#define EPT_PTE_IGNORED_2(_)                                         (((_) >> 11) & 0x01)
 
     /**
      * [Bits 47:12] Physical address of the 4-KByte page referenced by this entry.
@@ -21331,7 +23954,16 @@ typedef union
 #define EPT_PTE_PAGE_FRAME_NUMBER_FLAG                               0xFFFFFFFFF000
 #define EPT_PTE_PAGE_FRAME_NUMBER_MASK                               0xFFFFFFFFF
 #define EPT_PTE_PAGE_FRAME_NUMBER(_)                                 (((_) >> 12) & 0xFFFFFFFFF)
-    uint64_t reserved3                                               : 9;
+    uint64_t reserved1                                               : 4;
+
+    /**
+     * [Bits 56:52] Ignored.
+     */
+    uint64_t ignored_3                                               : 5;
+#define EPT_PTE_IGNORED_3_BIT                                        52
+#define EPT_PTE_IGNORED_3_FLAG                                       0x1F0000000000000
+#define EPT_PTE_IGNORED_3_MASK                                       0x1F
+#define EPT_PTE_IGNORED_3(_)                                         (((_) >> 52) & 0x1F)
 
     /**
      * [Bit 57] Verify guest paging. If the "guest-paging verification" VM-execution control is 1, indicates limits on the
@@ -21357,7 +23989,15 @@ typedef union
 #define EPT_PTE_PAGING_WRITE_ACCESS_FLAG                             0x400000000000000
 #define EPT_PTE_PAGING_WRITE_ACCESS_MASK                             0x01
 #define EPT_PTE_PAGING_WRITE_ACCESS(_)                               (((_) >> 58) & 0x01)
-    uint64_t reserved4                                               : 1;
+
+    /**
+     * [Bit 59] Ignored.
+     */
+    uint64_t ignored_4                                               : 1;
+#define EPT_PTE_IGNORED_4_BIT                                        59
+#define EPT_PTE_IGNORED_4_FLAG                                       0x800000000000000
+#define EPT_PTE_IGNORED_4_MASK                                       0x01
+#define EPT_PTE_IGNORED_4(_)                                         (((_) >> 59) & 0x01)
 
     /**
      * [Bit 60] Supervisor shadow stack. If bit 7 of EPTP is 1, indicates whether supervisor shadow stack accesses are allowed
@@ -21384,7 +24024,15 @@ typedef union
 #define EPT_PTE_SUB_PAGE_WRITE_PERMISSIONS_FLAG                      0x2000000000000000
 #define EPT_PTE_SUB_PAGE_WRITE_PERMISSIONS_MASK                      0x01
 #define EPT_PTE_SUB_PAGE_WRITE_PERMISSIONS(_)                        (((_) >> 61) & 0x01)
-    uint64_t reserved5                                               : 1;
+
+    /**
+     * [Bit 62] Ignored.
+     */
+    uint64_t ignored_5                                               : 1;
+#define EPT_PTE_IGNORED_5_BIT                                        62
+#define EPT_PTE_IGNORED_5_FLAG                                       0x4000000000000000
+#define EPT_PTE_IGNORED_5_MASK                                       0x01
+#define EPT_PTE_IGNORED_5(_)                                         (((_) >> 62) & 0x01)
 
     /**
      * [Bit 63] Suppress \#VE. If the "EPT-violation \#VE" VM-execution control is 1, EPT violations caused by accesses to this
@@ -21402,6 +24050,8 @@ typedef union
 
   uint64_t flags;
 } ept_pte;
+#define EPT_PTE_RESERVED_BITS                                        0x00
+#define EPT_PTE_ADDRESS_BITS                                         0xFFFFFFFFFF000
 
 /**
  * @brief Format of a common EPT Entry
@@ -21455,13 +24105,30 @@ typedef union
 #define EPT_ENTRY_USER_MODE_EXECUTE_FLAG                             0x400
 #define EPT_ENTRY_USER_MODE_EXECUTE_MASK                             0x01
 #define EPT_ENTRY_USER_MODE_EXECUTE(_)                               (((_) >> 10) & 0x01)
-    uint64_t reserved1                                               : 1;
+
+    /**
+     * [Bit 11] Ignored.
+     */
+    uint64_t ignored_1                                               : 1;
+#define EPT_ENTRY_IGNORED_1_BIT                                      11
+#define EPT_ENTRY_IGNORED_1_FLAG                                     0x800
+#define EPT_ENTRY_IGNORED_1_MASK                                     0x01
+#define EPT_ENTRY_IGNORED_1(_)                                       (((_) >> 11) & 0x01)
     uint64_t page_frame_number                                       : 36;
 #define EPT_ENTRY_PAGE_FRAME_NUMBER_BIT                              12
 #define EPT_ENTRY_PAGE_FRAME_NUMBER_FLAG                             0xFFFFFFFFF000
 #define EPT_ENTRY_PAGE_FRAME_NUMBER_MASK                             0xFFFFFFFFF
 #define EPT_ENTRY_PAGE_FRAME_NUMBER(_)                               (((_) >> 12) & 0xFFFFFFFFF)
-    uint64_t reserved2                                               : 15;
+    uint64_t reserved1                                               : 4;
+
+    /**
+     * [Bits 62:52] Ignored (bits 62:57 have entry-specific meaning in entries that map a page).
+     */
+    uint64_t ignored_2                                               : 11;
+#define EPT_ENTRY_IGNORED_2_BIT                                      52
+#define EPT_ENTRY_IGNORED_2_FLAG                                     0x7FF0000000000000
+#define EPT_ENTRY_IGNORED_2_MASK                                     0x7FF
+#define EPT_ENTRY_IGNORED_2(_)                                       (((_) >> 52) & 0x7FF)
     uint64_t suppress_ve                                             : 1;
 #define EPT_ENTRY_SUPPRESS_VE_BIT                                    63
 #define EPT_ENTRY_SUPPRESS_VE_FLAG                                   0x8000000000000000
@@ -21471,6 +24138,8 @@ typedef union
 
   uint64_t flags;
 } ept_entry;
+#define EPT_ENTRY_RESERVED_BITS                                      0x00
+#define EPT_ENTRY_ADDRESS_BITS                                       0xFFFFFFFFFF000
 
 /**
  * @defgroup ept_table_level \
@@ -21502,6 +24171,120 @@ typedef union
  * @}
  */
 
+/**
+ * @defgroup ept_permission \
+ *           EPT permission masks
+ *
+ * EPT permission masks.
+ *
+ * @remarks Used to update permissions of EPT entries in bulk (e.g., write-protecting a whole EPT_PTE table for dirty
+ *          tracking).
+ * @{
+ */
+/**
+ * Read access (bit 0).
+ */
+#define EPT_PERMISSION_READ                                          0x00000001
+
+/**
+ * Write access (bit 1).
+ */
+#define EPT_PERMISSION_WRITE                                         0x00000002
+
+/**
+ * Execute access, supervisor-mode execute access if "mode-based execute control for EPT" is 1 (bit 2).
+ */
+#define EPT_PERMISSION_EXECUTE                                       0x00000004
+
+/**
+ * User-mode execute access if "mode-based execute control for EPT" is 1 (bit 10).
+ */
+#define EPT_PERMISSION_USER_MODE_EXECUTE                             0x00000400
+
+/**
+ * Read, write and execute access.
+ */
+#define EPT_PERMISSION_READ_WRITE_EXECUTE                            0x00000007
+
+/**
+ * All permission bits, including user-mode execute access.
+ */
+#define EPT_PERMISSION_ALL                                           0x00000407
+
+/**
+ * New value of EPT entry _ with bits not in _and cleared and bits in _or set. Applying this to every entry of a table
+ * (e.g., _and = ~EPT_PERMISSION_WRITE, _or = 0) is a plain loop the compiler can vectorize.
+ */
+#define EPT_PERMISSION_UPDATE(_, _and, _or)                          (((_) & (_and)) | (_or))
+
+/**
+ * Bits of EPT entry _ changed by EPT_PERMISSION_UPDATE(_, _and, _or). Nonzero if the entry changed and its cached
+ * translations must be invalidated (INVEPT can then be issued once for all changed entries).
+ */
+#define EPT_PERMISSION_CHANGED(_, _and, _or)                         ((((_) & (_and)) | (_or)) ^ (_))
+/**
+ * @}
+ */
+
+/**
+ * @defgroup page_modification_log \
+ *           Page-Modification Logging
+ *
+ * Page-Modification Logging.
+ *
+ * @remarks The PML index counts down from 511. Entries PML_FIRST_ENTRY(index) through 511 of the 4-KByte log hold the
+ *          4-KByte aligned guest-physical addresses of pages whose EPT dirty flag was set. Draining the log is cheaper than
+ *          scanning all EPT leaves for dirty flags.
+ * @see Vol3C[28.2.6(Page-Modification Logging)] (reference)
+ * @{
+ */
+/**
+ * Number of 64-bit entries in the page-modification log.
+ */
+#define PML_ENTRY_COUNT                                              0x00000200
+
+/**
+ * Value of the PML index for an empty page-modification log.
+ */
+#define PML_INDEX_INITIAL                                            0x000001FF
+
+/**
+ * Guest-physical address bits of a page-modification log entry (bits 11:0 are cleared).
+ */
+#define PML_ENTRY_ADDRESS_MASK                                       0xFFFFFFFFFFFFF000
+
+/**
+ * First valid entry of the page-modification log for PML index _.
+ */
+#define PML_FIRST_ENTRY(_)                                           (((_) + 1) & 0xFFFF)
+
+/**
+ * Number of valid entries of the page-modification log for PML index _ (512 if the index wrapped to FFFFH after the log
+ * became full).
+ */
+#define PML_ENTRY_USED_COUNT(_)                                      ((0x01FF - (_)) & 0xFFFF)
+
+/**
+ * Index of the 64-bit word of a dirty-page bitmap (one bit per 4-KByte page) for guest-physical address _.
+ */
+#define PML_BITMAP_INDEX(_)                                          ((_) >> 18)
+
+/**
+ * Bit of the 64-bit word of a dirty-page bitmap for guest-physical address _.
+ */
+#define PML_BITMAP_BIT(_)                                            (1ULL << (((_) >> 12) & 0x3F))
+
+/**
+ * Accessed (bit 8) and dirty (bit 9) flags of an EPT entry mapping a page. Scanning EPT tables for dirty flags is the
+ * fallback if PML is not supported; only the accessed flag is defined for non-leaf entries.
+ *
+ * @see Vol3C[28.2.4(Accessed and Dirty Flags for EPT)]
+ */
+#define PML_ACCESSED_DIRTY_MASK                                      0x00000300
+/**
+ * @}
+ */
+
 /**
  * @}
  */
@@ -21586,6 +24369,57 @@ typedef struct
   uint64_t linear_address;
 } invvpid_descriptor;
 
+/**
+ * @defgroup vpid \
+ *           Virtual-processor identifier limits
+ *
+ * Virtual-processor identifier limits.
+ *
+ * @see Vol3C[28.1(VIRTUAL PROCESSOR IDENTIFIERS (VPIDS))] (reference)
+ * @{
+ */
+/**
+ * VPID of VMX root operation (and of VM entries with "enable VPID" 0). Not valid for "enable VPID" 1.
+ */
+#define VPID_HOST                                                    0x00000000
+
+/**
+ * Lowest VPID usable by a guest.
+ */
+#define VPID_MIN                                                     0x00000001
+
+/**
+ * Highest VPID usable by a guest.
+ */
+#define VPID_MAX                                                     0x0000FFFF
+/**
+ * @}
+ */
+
+/**
+ * @defgroup invalidation_type_support \
+ *           Supported invalidation types
+ *
+ * Supported invalidation types.
+ *
+ * @remarks Used to choose the type an invalidation can be promoted to (e.g., several individual-address INVVPIDs to a
+ *          single-context one) from the value _ of IA32_VMX_EPT_VPID_CAP.
+ * @see IA32_VMX_EPT_VPID_CAP
+ * @{
+ */
+/**
+ * Nonzero if INVEPT type _type is supported.
+ */
+#define INVEPT_TYPE_SUPPORTED(_, _type)                              (((_) >> (24 + (_type))) & 0x01)
+
+/**
+ * Nonzero if INVVPID type _type is supported.
+ */
+#define INVVPID_TYPE_SUPPORTED(_, _type)                             (((_) >> (40 + (_type))) & 0x01)
+/**
+ * @}
+ */
+
 /**
  * @brief Hypervisor-Managed linear-Address Translation Pointer (HLATP)
  *
@@ -21634,6 +24468,8 @@ typedef union
 
   uint64_t flags;
 } hlat_pointer;
+#define HLAT_POINTER_RESERVED_BITS                                   0xFFF0000000000FE7
+#define HLAT_POINTER_ADDRESS_BITS                                    0xFFFFFFFFFF000
 
 /**
  * @brief Format of the VMCS Region
@@ -21824,6 +24660,7 @@ typedef union
 
   uint16_t flags;
 } vmcs_component_encoding;
+#define VMCS_COMPONENT_ENCODING_RESERVED_BITS                        0x9000
 
 /**
  * @defgroup vmcs_16_bit \
@@ -22948,6 +25785,98 @@ typedef union
  * @}
  */
 
+/**
+ * @defgroup vmcs_guest_segment \
+ *           Encodings of guest segment register fields indexed by segment register
+ *
+ * Encodings of guest segment register fields indexed by segment register.
+ *
+ * @remarks The selector, limit, access rights and base fields of guest segment registers are encoded in the order ES, CS,
+ *          SS, DS, FS, GS, LDTR, TR with a stride of 2 (the index field of the encoding is incremented by 1), which matches the
+ *          segment register encoding used by VM-exit instruction information. This allows segment state to be read, cached and
+ *          written back by loops over the segment register index.
+ * @see 16_BIT_GUEST_STATE_FIELDS
+ * @{
+ */
+/**
+ * Index of guest ES.
+ */
+#define VMCS_GUEST_SEGMENT_ES                                        0x00000000
+
+/**
+ * Index of guest CS.
+ */
+#define VMCS_GUEST_SEGMENT_CS                                        0x00000001
+
+/**
+ * Index of guest SS.
+ */
+#define VMCS_GUEST_SEGMENT_SS                                        0x00000002
+
+/**
+ * Index of guest DS.
+ */
+#define VMCS_GUEST_SEGMENT_DS                                        0x00000003
+
+/**
+ * Index of guest FS.
+ */
+#define VMCS_GUEST_SEGMENT_FS                                        0x00000004
+
+/**
+ * Index of guest GS.
+ */
+#define VMCS_GUEST_SEGMENT_GS                                        0x00000005
+
+/**
+ * Index of guest LDTR.
+ */
+#define VMCS_GUEST_SEGMENT_LDTR                                      0x00000006
+
+/**
+ * Index of guest TR.
+ */
+#define VMCS_GUEST_SEGMENT_TR                                        0x00000007
+
+/**
+ * Number of guest segment registers.
+ */
+#define VMCS_GUEST_SEGMENT_COUNT                                     0x00000008
+
+/**
+ * Encoding of the selector field of guest segment register with index _.
+ */
+#define VMCS_GUEST_SEGMENT_SELECTOR(_)                               (0x0800 + ((_) << 1))
+
+/**
+ * Encoding of the limit field of guest segment register with index _.
+ */
+#define VMCS_GUEST_SEGMENT_LIMIT(_)                                  (0x4800 + ((_) << 1))
+
+/**
+ * Encoding of the access rights field of guest segment register with index _.
+ */
+#define VMCS_GUEST_SEGMENT_ACCESS_RIGHTS(_)                          (0x4814 + ((_) << 1))
+
+/**
+ * Encoding of the base field of guest segment register with index _.
+ */
+#define VMCS_GUEST_SEGMENT_BASE(_)                                   (0x6806 + ((_) << 1))
+
+/**
+ * Flag of guest segment register with index _ in a bitmap of segment registers (e.g. to track which cached segment
+ * registers are valid or have been modified).
+ */
+#define VMCS_GUEST_SEGMENT_FLAG(_)                                   (1 << (_))
+
+/**
+ * Bitmap of all guest segment registers.
+ */
+#define VMCS_GUEST_SEGMENT_ALL_FLAGS                                 0x000000FF
+/**
+ * @}
+ */
+
 /**
  * @}
  */
@@ -23052,6 +25981,31 @@ typedef union
 
   uint32_t flags;
 } vmentry_interrupt_information;
+#define VMENTRY_INTERRUPT_INFORMATION_RESERVED_BITS                  0x7FFFF000
+
+/**
+ * @defgroup vmentry_interrupt_information_encoding \
+ *           Encoding of the VM-entry interruption-information field
+ *
+ * Encoding of the VM-entry interruption-information field.
+ *
+ * @see VMENTRY_INTERRUPT_INFORMATION
+ * @see EXCEPTION_VECTOR_PROPERTIES
+ * @{
+ */
+/**
+ * Valid VM-entry interruption information injecting vector _vector with interruption type _type.
+ */
+#define VMENTRY_INTERRUPT_INFORMATION_ENCODE(_vector, _type, _deliver_error_code) (((_vector) & 0xFF) | (((_type) & 0x07) << 8) | (((_deliver_error_code) & 0x01) << 11) | 0x80000000)
+
+/**
+ * Valid VM-entry interruption information injecting vector _ with its default interruption type, delivering an error code
+ * if the vector requires one. The error code itself is written to the VM-entry exception error code field.
+ */
+#define VMENTRY_INTERRUPT_INFORMATION_FROM_VECTOR(_)                 VMENTRY_INTERRUPT_INFORMATION_ENCODE(_, EXCEPTION_VECTOR_INTERRUPTION_TYPE(_), EXCEPTION_VECTOR_HAS_ERROR_CODE(_))
+/**
+ * @}
+ */
 
 /**
  * @brief VM entry can be configured to conclude by delivering an event through the IDT (after all guest state and MSRs
@@ -23112,6 +26066,35 @@ typedef union
 
   uint32_t flags;
 } vmexit_interrupt_information;
+#define VMEXIT_INTERRUPT_INFORMATION_RESERVED_BITS                   0x7FFFE000
+
+/**
+ * @defgroup vmexit_interrupt_information_merging \
+ *           Merging of events whose delivery caused a VM exit with a new exception
+ *
+ * Merging of events whose delivery caused a VM exit with a new exception.
+ *
+ * @remarks _ is the IDT-vectoring information field (which has the layout of VMEXIT_INTERRUPT_INFORMATION). Only hardware
+ *          exceptions take part in double fault generation; other events are handled serially.
+ * @see EXCEPTION_VECTOR_PROPERTIES
+ * @see VMENTRY_INTERRUPT_INFORMATION_ENCODING
+ * @see Vol3A[6.15(Interrupt 8-Double Fault Exception (#DF))] (reference)
+ * @{
+ */
+/**
+ * Vector of the hardware exception being delivered, or 0x100 if no hardware exception was being delivered.
+ */
+#define VMEXIT_INTERRUPT_INFORMATION_EXCEPTION_VECTOR(_)             ((((_) & 0x80000700) == 0x80000300) ? ((_) & 0xFF) : 0x100)
+
+/**
+ * VM-entry interruption information for exception with vector _vector occurring during delivery of event _: a double fault
+ * (with error code 0) or _vector itself. Evaluates to 0 (not valid) on a triple fault, which must be handled as shutdown
+ * of the guest.
+ */
+#define VMEXIT_INTERRUPT_INFORMATION_MERGE(_, _vector)               (EXCEPTION_VECTOR_MERGE(VMEXIT_INTERRUPT_INFORMATION_EXCEPTION_VECTOR(_), _vector) == EXCEPTION_VECTOR_MERGE_DOUBLE_FAULT ? VMENTRY_INTERRUPT_INFORMATION_ENCODE(8, 3, 1) : EXCEPTION_VECTOR_MERGE(VMEXIT_INTERRUPT_INFORMATION_EXCEPTION_VECTOR(_), _vector) == EXCEPTION_VECTOR_MERGE_TRIPLE_FAULT ? 0 : VMENTRY_INTERRUPT_INFORMATION_FROM_VECTOR(_vector))
+/**
+ * @}
+ */
 
 /**
  * @}
@@ -23380,6 +26363,47 @@ typedef union
  * Divide Configuration Register (for Timer).
  */
 #define APIC_DIVIDE_CONFIGURATION                                    0x000003E0
+
+/**
+ * Distance between offsets of consecutive 32-bit registers. 256-bit registers (ISR, TMR and IRR) consist of 8 such
+ * registers.
+ */
+#define APIC_REGISTER_STRIDE                                         0x00000010
+
+/**
+ * Offset of the 32-bit register holding bit of vector _vector of the 256-bit register at offset _.
+ */
+#define APIC_VECTOR_REGISTER_OFFSET(_, _vector)                      ((_) + (((_vector) >> 5) << 4))
+
+/**
+ * Bit of vector _vector in its 32-bit register.
+ */
+#define APIC_VECTOR_BIT(_vector)                                     (1U << ((_vector) & 0x1F))
+
+/**
+ * Vector of bit _bit of 32-bit register _register (0-7) of a 256-bit register.
+ */
+#define APIC_VECTOR(_register, _bit)                                 (((_register) << 5) | (_bit))
+
+/**
+ * Priority class of vector or priority _.
+ */
+#define APIC_PRIORITY_CLASS(_)                                       (((_) >> 4) & 0x0F)
+
+/**
+ * Processor priority (PPR) for task priority _tpr and highest vector in service _isrv (0 if none): _tpr if its priority
+ * class is not below the class of _isrv, otherwise the class of _isrv.
+ *
+ * @see Vol3A[10.8.3.1(Task and Processor Priorities)]
+ */
+#define APIC_PPR_VALUE(_tpr, _isrv)                                  ((((_tpr) & 0xFF) * (((_tpr) & 0xF0) >= ((_isrv) & 0xF0))) | (((_isrv) & 0xF0) * (((_tpr) & 0xF0) < ((_isrv) & 0xF0))))
+
+/**
+ * Nonzero if the priority class of vector _vector is above the processor priority _ppr.
+ *
+ * @see Vol3A[10.8.3.1(Task and Processor Priorities)]
+ */
+#define APIC_INTERRUPT_ACCEPTED(_vector, _ppr)                       (((_vector) & 0xF0) > ((_ppr) & 0xF0))
 /**
  * @}
  */
@@ -23617,6 +26641,7 @@ typedef union
 
   uint32_t flags;
 } eflags;
+#define EFLAGS_RESERVED_BITS                                         0xFFC08028
 
 /**
  * The 64-bit RFLAGS register contains a group of status flags, a control flag, and a group of system flags in 64-bit mode.
@@ -23834,6 +26859,7 @@ typedef union
 
   uint64_t flags;
 } rflags;
+#define RFLAGS_RESERVED_BITS                                         0xFFFFFFFFFFC08028
 
 /**
  * @defgroup exceptions \
@@ -23876,6 +26902,7 @@ typedef union
 
   uint32_t flags;
 } control_protection_exception;
+#define CONTROL_PROTECTION_EXCEPTION_RESERVED_BITS                   0xFFFF0000
 
 /**
  * @brief Exceptions that can occur when the instruction is executed in protected mode.
@@ -24039,21 +27066,115 @@ typedef enum
 } exception_vector;
 
 /**
- * @brief When an exception condition is related to a specific segment selector or IDT vector, the processor pushes an
- *        error code onto the stack of the exception handler (whether it is a procedure or task). The error code resembles a
- *        segment selector; however, instead of a TI flag and RPL field, the error code contains 3 different flags
+ * @defgroup exception_vector_properties \
+ *           Properties of exception vectors needed for event delivery and injection
  *
- * @see Vol3A[6.13(ERROR CODE)] (reference)
+ * Properties of exception vectors needed for event delivery and injection.
+ *
+ * @remarks Properties are held in bitmaps indexed by vector, so that they can be looked up without branches. Vectors
+ *          32-255 are not exceptions; their error code flag and class are 0.
+ * @see Vol3A[6.15(Exception and Interrupt Reference)] (reference)
+ * @see Vol3A[6.15(Interrupt 8-Double Fault Exception (#DF))] (reference)
+ * @{
  */
-typedef union
-{
-  struct
-  {
-    /**
-     * [Bit 0] When set, indicates that the exception occurred during delivery of an event external to the program, such as an
-     * interrupt or an earlier exception. The bit is cleared if the exception occurred during delivery of a software interrupt
-     * (INT n, INT3, or INTO).
-     */
+/**
+ * Bitmap of exceptions delivering an error code (\#DF,
+ */
+#define EXCEPTION_VECTOR_ERROR_CODE_MASK                             0x00227D00
+
+/**
+ * Bitmap of contributory exceptions (\#DE,
+ */
+#define EXCEPTION_VECTOR_CONTRIBUTORY_MASK                           0x00203C01
+
+/**
+ * Bitmap of page fault class exceptions (\#PF,
+ */
+#define EXCEPTION_VECTOR_PAGE_FAULT_MASK                             0x00104000
+
+/**
+ * Bitmap of exceptions injected as software exceptions (\#BP,
+ */
+#define EXCEPTION_VECTOR_SOFTWARE_EXCEPTION_MASK                     0x00000018
+
+/**
+ * Benign exception or interrupt.
+ */
+#define EXCEPTION_VECTOR_CLASS_BENIGN                                0x00000000
+
+/**
+ * Contributory exception.
+ */
+#define EXCEPTION_VECTOR_CLASS_CONTRIBUTORY                          0x00000001
+
+/**
+ * Page fault class exception.
+ */
+#define EXCEPTION_VECTOR_CLASS_PAGE_FAULT                            0x00000002
+
+/**
+ * 1 if exception with vector _ delivers an error code; 0 otherwise.
+ */
+#define EXCEPTION_VECTOR_HAS_ERROR_CODE(_)                           (((EXCEPTION_VECTOR_ERROR_CODE_MASK >> ((_) & 0x1F)) & 0x01) & ((_) < 32))
+
+/**
+ * Class of vector _ (EXCEPTION_VECTOR_CLASS_*), used to determine whether a double fault is generated.
+ */
+#define EXCEPTION_VECTOR_CLASS(_)                                    (((((EXCEPTION_VECTOR_CONTRIBUTORY_MASK >> ((_) & 0x1F)) & 0x01) | (((EXCEPTION_VECTOR_PAGE_FAULT_MASK >> ((_) & 0x1F)) & 0x01) << 1))) * ((_) < 32))
+
+/**
+ * Default interruption type (INTERRUPTION_TYPE) used to inject vector _: external interrupt for vectors 32-255, NMI for
+ * vector 2, software exception for \#BP and \#OF (raised by INT3 and INTO), hardware exception otherwise. Hardware
+ * exception type (3) is turned into NMI (2) or software exception (6) by XOR with 1 or 5.
+ */
+#define EXCEPTION_VECTOR_INTERRUPTION_TYPE(_)                        ((3 ^ ((_) == 2) ^ (((EXCEPTION_VECTOR_SOFTWARE_EXCEPTION_MASK >> ((_) & 0x1F)) & 0x01) * 5)) * ((_) < 32))
+
+/**
+ * Conditions for generating a double fault (Table 6-5), as 3x3 bitmap indexed by (first class * 3 + second class). A bit
+ * is set if the second exception generates a double fault; otherwise both exceptions are handled serially.
+ */
+#define EXCEPTION_VECTOR_MERGE_TABLE                                 0x00000190
+
+/**
+ * The second exception is handled serially.
+ */
+#define EXCEPTION_VECTOR_MERGE_SERIAL                                0x00000000
+
+/**
+ * A double fault (\#DF) is generated.
+ */
+#define EXCEPTION_VECTOR_MERGE_DOUBLE_FAULT                          0x00000001
+
+/**
+ * The processor enters shutdown mode (triple fault).
+ */
+#define EXCEPTION_VECTOR_MERGE_TRIPLE_FAULT                          0x00000002
+
+/**
+ * Result (EXCEPTION_VECTOR_MERGE_*) of exception with vector _second occurring while delivering exception with vector
+ * _first. A contributory or page fault class exception occurring during delivery of a double fault causes a triple fault.
+ */
+#define EXCEPTION_VECTOR_MERGE(_first, _second)                      (((EXCEPTION_VECTOR_MERGE_TABLE >> (EXCEPTION_VECTOR_CLASS(_first) * 3 + EXCEPTION_VECTOR_CLASS(_second))) & 0x01) | ((((_first) == 8) & (EXCEPTION_VECTOR_CLASS(_second) != 0)) << 1))
+/**
+ * @}
+ */
+
+/**
+ * @brief When an exception condition is related to a specific segment selector or IDT vector, the processor pushes an
+ *        error code onto the stack of the exception handler (whether it is a procedure or task). The error code resembles a
+ *        segment selector; however, instead of a TI flag and RPL field, the error code contains 3 different flags
+ *
+ * @see Vol3A[6.13(ERROR CODE)] (reference)
+ */
+typedef union
+{
+  struct
+  {
+    /**
+     * [Bit 0] When set, indicates that the exception occurred during delivery of an event external to the program, such as an
+     * interrupt or an earlier exception. The bit is cleared if the exception occurred during delivery of a software interrupt
+     * (INT n, INT3, or INTO).
+     */
     uint32_t external_event                                          : 1;
 #define EXCEPTION_ERROR_CODE_EXTERNAL_EVENT_BIT                      0
 #define EXCEPTION_ERROR_CODE_EXTERNAL_EVENT_FLAG                     0x01
@@ -24099,6 +27220,7 @@ typedef union
 
   uint32_t flags;
 } exception_error_code;
+#define EXCEPTION_ERROR_CODE_RESERVED_BITS                           0xFFFF0000
 
 /**
  * @brief Page fault exception
@@ -24225,6 +27347,7 @@ typedef union
 
   uint32_t flags;
 } page_fault_exception;
+#define PAGE_FAULT_EXCEPTION_RESERVED_BITS                           0xFFFF7F00
 
 /**
  * @}
@@ -24319,6 +27442,210 @@ typedef union
  * @}
  */
 
+/**
+ * @defgroup intel_pt \
+ *           Intel Processor Trace
+ *
+ * @see Vol3C[35.2.6.2(Table of Physical Addresses (ToPA))] (reference)
+ * @{
+ */
+/**
+ * @brief Table of Physical Addresses (ToPA) entry. Each entry describes an output region, or points to the next ToPA table
+ *        (END = 1). Tables are 4-KByte aligned and hold an END entry as their last entry
+ *
+ * @see IA32_RTIT_OUTPUT_BASE
+ * @see IA32_RTIT_OUTPUT_MASK_PTRS
+ */
+typedef union
+{
+  struct
+  {
+    /**
+     * [Bit 0] If set, this is an End entry: the Output Region Base field points to the next ToPA table (which may be the first
+     * table, forming a ring), and Size is ignored.
+     */
+    uint64_t end                                                     : 1;
+#define TOPA_ENTRY_END_BIT                                           0
+#define TOPA_ENTRY_END_FLAG                                          0x01
+#define TOPA_ENTRY_END_MASK                                          0x01
+#define TOPA_ENTRY_END(_)                                            (((_) >> 0) & 0x01)
+    uint64_t reserved1                                               : 1;
+
+    /**
+     * [Bit 2] When the output region indicated by this entry is filled, signal a PMI (Perfmon Interrupt).
+     *
+     * @remarks If CPUID.(EAX=14H, ECX=0):ECX.TOPAOUT[0] = 1
+     */
+    uint64_t interrupt                                               : 1;
+#define TOPA_ENTRY_INTERRUPT_BIT                                     2
+#define TOPA_ENTRY_INTERRUPT_FLAG                                    0x04
+#define TOPA_ENTRY_INTERRUPT_MASK                                    0x01
+#define TOPA_ENTRY_INTERRUPT(_)                                      (((_) >> 2) & 0x01)
+    uint64_t reserved2                                               : 1;
+
+    /**
+     * [Bit 4] When the output region indicated by this entry is filled, software should disable packet generation (TraceEn is
+     * cleared and IA32_RTIT_STATUS.Stopped is set).
+     */
+    uint64_t stop                                                    : 1;
+#define TOPA_ENTRY_STOP_BIT                                          4
+#define TOPA_ENTRY_STOP_FLAG                                         0x10
+#define TOPA_ENTRY_STOP_MASK                                         0x01
+#define TOPA_ENTRY_STOP(_)                                           (((_) >> 4) & 0x01)
+    uint64_t reserved3                                               : 1;
+
+    /**
+     * [Bits 9:6] Size of the output region (4K * 2^SIZE bytes). Ignored if END = 1.
+     */
+    uint64_t size                                                    : 4;
+#define TOPA_ENTRY_SIZE_BIT                                          6
+#define TOPA_ENTRY_SIZE_FLAG                                         0x3C0
+#define TOPA_ENTRY_SIZE_MASK                                         0x0F
+#define TOPA_ENTRY_SIZE(_)                                           (((_) >> 6) & 0x0F)
+    /**
+     * 4 KBytes.
+     */
+#define TOPA_ENTRY_SIZE_4K                                           0x00000000
+
+    /**
+     * 8 KBytes.
+     */
+#define TOPA_ENTRY_SIZE_8K                                           0x00000001
+
+    /**
+     * 16 KBytes.
+     */
+#define TOPA_ENTRY_SIZE_16K                                          0x00000002
+
+    /**
+     * 32 KBytes.
+     */
+#define TOPA_ENTRY_SIZE_32K                                          0x00000003
+
+    /**
+     * 64 KBytes.
+     */
+#define TOPA_ENTRY_SIZE_64K                                          0x00000004
+
+    /**
+     * 128 KBytes.
+     */
+#define TOPA_ENTRY_SIZE_128K                                         0x00000005
+
+    /**
+     * 256 KBytes.
+     */
+#define TOPA_ENTRY_SIZE_256K                                         0x00000006
+
+    /**
+     * 512 KBytes.
+     */
+#define TOPA_ENTRY_SIZE_512K                                         0x00000007
+
+    /**
+     * 1 MByte.
+     */
+#define TOPA_ENTRY_SIZE_1M                                           0x00000008
+
+    /**
+     * 2 MBytes.
+     */
+#define TOPA_ENTRY_SIZE_2M                                           0x00000009
+
+    /**
+     * 4 MBytes.
+     */
+#define TOPA_ENTRY_SIZE_4M                                           0x0000000A
+
+    /**
+     * 8 MBytes.
+     */
+#define TOPA_ENTRY_SIZE_8M                                           0x0000000B
+
+    /**
+     * 16 MBytes.
+     */
+#define TOPA_ENTRY_SIZE_16M                                          0x0000000C
+
+    /**
+     * 32 MBytes.
+     */
+#define TOPA_ENTRY_SIZE_32M                                          0x0000000D
+
+    /**
+     * 64 MBytes.
+     */
+#define TOPA_ENTRY_SIZE_64M                                          0x0000000E
+
+    /**
+     * 128 MBytes.
+     */
+#define TOPA_ENTRY_SIZE_128M                                         0x0000000F
+
+    /**
+     * Size in bytes of an output region with size encoding _.
+     */
+#define TOPA_ENTRY_SIZE_BYTES(_)                                     (4096ULL << (_))
+    uint64_t reserved4                                               : 2;
+
+    /**
+     * [Bits 47:12] Physical address (bits 12 and above) of the output region, which must be aligned to its size. If END = 1,
+     * physical address of the next ToPA table.
+     */
+    uint64_t base                                                    : 36;
+#define TOPA_ENTRY_BASE_BIT                                          12
+#define TOPA_ENTRY_BASE_FLAG                                         0xFFFFFFFFF000
+#define TOPA_ENTRY_BASE_MASK                                         0xFFFFFFFFF
+#define TOPA_ENTRY_BASE(_)                                           (((_) >> 12) & 0xFFFFFFFFF)
+    uint64_t reserved5                                               : 16;
+  };
+
+  uint64_t flags;
+} topa_entry;
+#define TOPA_ENTRY_RESERVED_BITS                                     0xFFF0000000000C2A
+#define TOPA_ENTRY_ADDRESS_BITS                                      0xFFFFFFFFFF000
+
+/**
+ * @defgroup topa_encoding \
+ *           ToPA table construction
+ *
+ * ToPA table construction.
+ *
+ * @remarks Switching to another trace buffer requires TraceEn to be cleared in IA32_RTIT_CTL, IA32_RTIT_OUTPUT_BASE to be
+ *          written with the physical address of the first ToPA table of the buffer and IA32_RTIT_OUTPUT_MASK_PTRS with
+ *          TOPA_OUTPUT_MASK_PTRS(0, 0), after which TraceEn can be set again.
+ * @see Vol3C[35.2.7.8(IA32_RTIT_OUTPUT_MASK_PTRS MSR)]
+ * @{
+ */
+/**
+ * Number of ToPA entries in a 4-KByte table (including the END entry).
+ */
+#define TOPA_ENTRY_COUNT                                             0x00000200
+
+/**
+ * ToPA entry describing an output region at physical address _address with size encoding _size (TOPA_ENTRY_SIZE_*). _flags
+ * holds TOPA_ENTRY_INTERRUPT_FLAG and TOPA_ENTRY_STOP_FLAG.
+ */
+#define TOPA_ENTRY_ENCODE(_address, _size, _flags)                   (((_address) & 0xFFFFFFFFFF000ULL) | (((_size) & 0x0FULL) << 6) | (_flags))
+
+/**
+ * END entry pointing to the ToPA table at physical address _.
+ */
+#define TOPA_ENTRY_ENCODE_END(_)                                     (((_) & 0xFFFFFFFFFF000ULL) | 0x01)
+
+/**
+ * IA32_RTIT_OUTPUT_MASK_PTRS value selecting entry _entry_index of the current ToPA table and offset _output_offset into
+ * its output region.
+ */
+#define TOPA_OUTPUT_MASK_PTRS(_entry_index, _output_offset)          ((((_entry_index) & 0x1FFFFFFULL) << 7) | 0x7F | (((_output_offset) & 0xFFFFFFFFULL) << 32))
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
 /**
  * @defgroup vtd \
  *           VTD
@@ -24342,10 +27669,10 @@ typedef struct
        * * 1: Indicates the root-entry is present.
        */
       uint64_t present                                               : 1;
-#define VTD_Lower64_PRESENT_BIT                                      0
-#define VTD_Lower64_PRESENT_FLAG                                     0x01
-#define VTD_Lower64_PRESENT_MASK                                     0x01
-#define VTD_Lower64_PRESENT(_)                                       (((_) >> 0) & 0x01)
+#define VTD_ROOT_ENTRY_LOWER64_PRESENT_BIT                           0
+#define VTD_ROOT_ENTRY_LOWER64_PRESENT_FLAG                          0x01
+#define VTD_ROOT_ENTRY_LOWER64_PRESENT_MASK                          0x01
+#define VTD_ROOT_ENTRY_LOWER64_PRESENT(_)                            (((_) >> 0) & 0x01)
       uint64_t reserved1                                             : 11;
 
       /**
@@ -24353,14 +27680,15 @@ typedef struct
        * bits 63:HAW as reserved (0), where HAW is the host address width of the platform.
        */
       uint64_t context_table_pointer                                 : 52;
-#define VTD_Lower64_CONTEXT_TABLE_POINTER_BIT                        12
-#define VTD_Lower64_CONTEXT_TABLE_POINTER_FLAG                       0xFFFFFFFFFFFFF000
-#define VTD_Lower64_CONTEXT_TABLE_POINTER_MASK                       0xFFFFFFFFFFFFF
-#define VTD_Lower64_CONTEXT_TABLE_POINTER(_)                         (((_) >> 12) & 0xFFFFFFFFFFFFF)
+#define VTD_ROOT_ENTRY_LOWER64_CONTEXT_TABLE_POINTER_BIT             12
+#define VTD_ROOT_ENTRY_LOWER64_CONTEXT_TABLE_POINTER_FLAG            0xFFFFFFFFFFFFF000
+#define VTD_ROOT_ENTRY_LOWER64_CONTEXT_TABLE_POINTER_MASK            0xFFFFFFFFFFFFF
+#define VTD_ROOT_ENTRY_LOWER64_CONTEXT_TABLE_POINTER(_)              (((_) >> 12) & 0xFFFFFFFFFFFFF)
     };
 
     uint64_t flags;
   } lower64;
+#define VTD_ROOT_ENTRY_LOWER64_RESERVED_BITS                         0xFFE
 
   union
   {
@@ -24370,14 +27698,15 @@ typedef struct
        * [Bits 63:0] Reserved. Must be 0.
        */
       uint64_t reserved                                              : 64;
-#define VTD_Upper64_RESERVED_BIT                                     0
-#define VTD_Upper64_RESERVED_FLAG                                    0xFFFFFFFFFFFFFFFF
-#define VTD_Upper64_RESERVED_MASK                                    0xFFFFFFFFFFFFFFFF
-#define VTD_Upper64_RESERVED(_)                                      (((_) >> 0) & 0xFFFFFFFFFFFFFFFF)
+#define VTD_ROOT_ENTRY_UPPER64_RESERVED_BIT                          0
+#define VTD_ROOT_ENTRY_UPPER64_RESERVED_FLAG                         0xFFFFFFFFFFFFFFFF
+#define VTD_ROOT_ENTRY_UPPER64_RESERVED_MASK                         0xFFFFFFFFFFFFFFFF
+#define VTD_ROOT_ENTRY_UPPER64_RESERVED(_)                           (((_) >> 0) & 0xFFFFFFFFFFFFFFFF)
     };
 
     uint64_t flags;
   } upper64;
+#define VTD_ROOT_ENTRY_UPPER64_RESERVED_BITS                         0xFFFFFFFFFFFFFFFF
 
 } vtd_root_entry;
 
@@ -24400,10 +27729,10 @@ typedef struct
        * * 1: Indicates the context-entry is present.
        */
       uint64_t present                                               : 1;
-#define VTD_Lower64_PRESENT_BIT                                      0
-#define VTD_Lower64_PRESENT_FLAG                                     0x01
-#define VTD_Lower64_PRESENT_MASK                                     0x01
-#define VTD_Lower64_PRESENT(_)                                       (((_) >> 0) & 0x01)
+#define VTD_CONTEXT_ENTRY_LOWER64_PRESENT_BIT                        0
+#define VTD_CONTEXT_ENTRY_LOWER64_PRESENT_FLAG                       0x01
+#define VTD_CONTEXT_ENTRY_LOWER64_PRESENT_MASK                       0x01
+#define VTD_CONTEXT_ENTRY_LOWER64_PRESENT(_)                         (((_) >> 0) & 0x01)
 
       /**
        * [Bit 1] Enables or disables recording/reporting of qualified non-recoverable faults.
@@ -24412,10 +27741,10 @@ typedef struct
        * This field is evaluated by hardware irrespective of the setting of the present (P) field.
        */
       uint64_t fault_processing_disable                              : 1;
-#define VTD_Lower64_FAULT_PROCESSING_DISABLE_BIT                     1
-#define VTD_Lower64_FAULT_PROCESSING_DISABLE_FLAG                    0x02
-#define VTD_Lower64_FAULT_PROCESSING_DISABLE_MASK                    0x01
-#define VTD_Lower64_FAULT_PROCESSING_DISABLE(_)                      (((_) >> 1) & 0x01)
+#define VTD_CONTEXT_ENTRY_LOWER64_FAULT_PROCESSING_DISABLE_BIT       1
+#define VTD_CONTEXT_ENTRY_LOWER64_FAULT_PROCESSING_DISABLE_FLAG      0x02
+#define VTD_CONTEXT_ENTRY_LOWER64_FAULT_PROCESSING_DISABLE_MASK      0x01
+#define VTD_CONTEXT_ENTRY_LOWER64_FAULT_PROCESSING_DISABLE(_)        (((_) >> 1) & 0x01)
 
       /**
        * [Bits 3:2] This field is applicable only for requests-without-PASID, as hardware blocks all requests-with- PASID in
@@ -24430,10 +27759,10 @@ typedef struct
        * * 11b: Reserved.
        */
       uint64_t translation_type                                      : 2;
-#define VTD_Lower64_TRANSLATION_TYPE_BIT                             2
-#define VTD_Lower64_TRANSLATION_TYPE_FLAG                            0x0C
-#define VTD_Lower64_TRANSLATION_TYPE_MASK                            0x03
-#define VTD_Lower64_TRANSLATION_TYPE(_)                              (((_) >> 2) & 0x03)
+#define VTD_CONTEXT_ENTRY_LOWER64_TRANSLATION_TYPE_BIT               2
+#define VTD_CONTEXT_ENTRY_LOWER64_TRANSLATION_TYPE_FLAG              0x0C
+#define VTD_CONTEXT_ENTRY_LOWER64_TRANSLATION_TYPE_MASK              0x03
+#define VTD_CONTEXT_ENTRY_LOWER64_TRANSLATION_TYPE(_)                (((_) >> 2) & 0x03)
       uint64_t reserved1                                             : 8;
 
       /**
@@ -24443,14 +27772,15 @@ typedef struct
        * This field is ignored by hardware when Translation-Type (TT) field is 10b (pass-through).
        */
       uint64_t second_level_page_translation_pointer                 : 52;
-#define VTD_Lower64_SECOND_LEVEL_PAGE_TRANSLATION_POINTER_BIT        12
-#define VTD_Lower64_SECOND_LEVEL_PAGE_TRANSLATION_POINTER_FLAG       0xFFFFFFFFFFFFF000
-#define VTD_Lower64_SECOND_LEVEL_PAGE_TRANSLATION_POINTER_MASK       0xFFFFFFFFFFFFF
-#define VTD_Lower64_SECOND_LEVEL_PAGE_TRANSLATION_POINTER(_)         (((_) >> 12) & 0xFFFFFFFFFFFFF)
+#define VTD_CONTEXT_ENTRY_LOWER64_SECOND_LEVEL_PAGE_TRANSLATION_POINTER_BIT 12
+#define VTD_CONTEXT_ENTRY_LOWER64_SECOND_LEVEL_PAGE_TRANSLATION_POINTER_FLAG 0xFFFFFFFFFFFFF000
+#define VTD_CONTEXT_ENTRY_LOWER64_SECOND_LEVEL_PAGE_TRANSLATION_POINTER_MASK 0xFFFFFFFFFFFFF
+#define VTD_CONTEXT_ENTRY_LOWER64_SECOND_LEVEL_PAGE_TRANSLATION_POINTER(_) (((_) >> 12) & 0xFFFFFFFFFFFFF)
     };
 
     uint64_t flags;
   } lower64;
+#define VTD_CONTEXT_ENTRY_LOWER64_RESERVED_BITS                      0xFF0
 
   union
   {
@@ -24472,19 +27802,19 @@ typedef struct
        * the AGAW value indicated by this field) are blocked and treated as translation faults.
        */
       uint64_t address_width                                         : 3;
-#define VTD_Upper64_ADDRESS_WIDTH_BIT                                0
-#define VTD_Upper64_ADDRESS_WIDTH_FLAG                               0x07
-#define VTD_Upper64_ADDRESS_WIDTH_MASK                               0x07
-#define VTD_Upper64_ADDRESS_WIDTH(_)                                 (((_) >> 0) & 0x07)
+#define VTD_CONTEXT_ENTRY_UPPER64_ADDRESS_WIDTH_BIT                  0
+#define VTD_CONTEXT_ENTRY_UPPER64_ADDRESS_WIDTH_FLAG                 0x07
+#define VTD_CONTEXT_ENTRY_UPPER64_ADDRESS_WIDTH_MASK                 0x07
+#define VTD_CONTEXT_ENTRY_UPPER64_ADDRESS_WIDTH(_)                   (((_) >> 0) & 0x07)
 
       /**
        * [Bits 6:3] Hardware ignores the programming of this field.
        */
       uint64_t ignored                                               : 4;
-#define VTD_Upper64_IGNORED_BIT                                      3
-#define VTD_Upper64_IGNORED_FLAG                                     0x78
-#define VTD_Upper64_IGNORED_MASK                                     0x0F
-#define VTD_Upper64_IGNORED(_)                                       (((_) >> 3) & 0x0F)
+#define VTD_CONTEXT_ENTRY_UPPER64_IGNORED_BIT                        3
+#define VTD_CONTEXT_ENTRY_UPPER64_IGNORED_FLAG                       0x78
+#define VTD_CONTEXT_ENTRY_UPPER64_IGNORED_MASK                       0x0F
+#define VTD_CONTEXT_ENTRY_UPPER64_IGNORED(_)                         (((_) >> 3) & 0x0F)
       uint64_t reserved1                                             : 1;
 
       /**
@@ -24500,15 +27830,16 @@ typedef struct
        * reserved. Software must not use domain-id value of zero when CM is Set.
        */
       uint64_t domain_identifier                                     : 10;
-#define VTD_Upper64_DOMAIN_IDENTIFIER_BIT                            8
-#define VTD_Upper64_DOMAIN_IDENTIFIER_FLAG                           0x3FF00
-#define VTD_Upper64_DOMAIN_IDENTIFIER_MASK                           0x3FF
-#define VTD_Upper64_DOMAIN_IDENTIFIER(_)                             (((_) >> 8) & 0x3FF)
+#define VTD_CONTEXT_ENTRY_UPPER64_DOMAIN_IDENTIFIER_BIT              8
+#define VTD_CONTEXT_ENTRY_UPPER64_DOMAIN_IDENTIFIER_FLAG             0x3FF00
+#define VTD_CONTEXT_ENTRY_UPPER64_DOMAIN_IDENTIFIER_MASK             0x3FF
+#define VTD_CONTEXT_ENTRY_UPPER64_DOMAIN_IDENTIFIER(_)               (((_) >> 8) & 0x3FF)
       uint64_t reserved2                                             : 46;
     };
 
     uint64_t flags;
   } upper64;
+#define VTD_CONTEXT_ENTRY_UPPER64_RESERVED_BITS                      0xFFFFFFFFFFFC0080
 
 } vtd_context_entry;
 
@@ -24521,6 +27852,175 @@ typedef struct
  */
 #define VTD_ROOT_ENTRY_COUNT                                         0x00000100
 #define VTD_CONTEXT_ENTRY_COUNT                                      0x00000100
+#define VTD_SECOND_LEVEL_ENTRY_COUNT                                 0x00000200
+/**
+ * @}
+ */
+
+/**
+ * @brief Second-level paging entry (SL-PML5E, SL-PML4E, SL-PDPE, SL-PDE or SL-PTE). Entries with bit 7 (PS) set in SL-PDPE
+ *        or SL-PDE map a 1-GByte or 2-MByte page; such entries and SL-PTEs are leaf entries
+ *
+ * @see VTd[9.8(Second-Level Paging Entries)]
+ */
+typedef union
+{
+  struct
+  {
+    /**
+     * [Bit 0] Read permission. If 0, read accesses to the region controlled by this entry are blocked.
+     */
+    uint64_t read                                                    : 1;
+#define VTD_SECOND_LEVEL_PAGING_ENTRY_READ_BIT                       0
+#define VTD_SECOND_LEVEL_PAGING_ENTRY_READ_FLAG                      0x01
+#define VTD_SECOND_LEVEL_PAGING_ENTRY_READ_MASK                      0x01
+#define VTD_SECOND_LEVEL_PAGING_ENTRY_READ(_)                        (((_) >> 0) & 0x01)
+
+    /**
+     * [Bit 1] Write permission. If 0, write accesses to the region controlled by this entry are blocked.
+     */
+    uint64_t write                                                   : 1;
+#define VTD_SECOND_LEVEL_PAGING_ENTRY_WRITE_BIT                      1
+#define VTD_SECOND_LEVEL_PAGING_ENTRY_WRITE_FLAG                     0x02
+#define VTD_SECOND_LEVEL_PAGING_ENTRY_WRITE_MASK                     0x01
+#define VTD_SECOND_LEVEL_PAGING_ENTRY_WRITE(_)                       (((_) >> 1) & 0x01)
+
+    /**
+     * [Bit 2] Execute permission. Ignored by hardware if Execute Request Support (ERS) is reported as Clear.
+     */
+    uint64_t execute                                                 : 1;
+#define VTD_SECOND_LEVEL_PAGING_ENTRY_EXECUTE_BIT                    2
+#define VTD_SECOND_LEVEL_PAGING_ENTRY_EXECUTE_FLAG                   0x04
+#define VTD_SECOND_LEVEL_PAGING_ENTRY_EXECUTE_MASK                   0x01
+#define VTD_SECOND_LEVEL_PAGING_ENTRY_EXECUTE(_)                     (((_) >> 2) & 0x01)
+
+    /**
+     * [Bits 5:3] Memory type of the page (leaf entries only). Ignored by hardware when the Extended Memory Type Enable (EMTE)
+     * field of the governing PASID-table entry is Clear.
+     */
+    uint64_t extended_memory_type                                    : 3;
+#define VTD_SECOND_LEVEL_PAGING_ENTRY_EXTENDED_MEMORY_TYPE_BIT       3
+#define VTD_SECOND_LEVEL_PAGING_ENTRY_EXTENDED_MEMORY_TYPE_FLAG      0x38
+#define VTD_SECOND_LEVEL_PAGING_ENTRY_EXTENDED_MEMORY_TYPE_MASK      0x07
+#define VTD_SECOND_LEVEL_PAGING_ENTRY_EXTENDED_MEMORY_TYPE(_)        (((_) >> 3) & 0x07)
+
+    /**
+     * [Bit 6] If 1, the PAT memory type is ignored for the page (leaf entries only).
+     */
+    uint64_t ignore_pat                                              : 1;
+#define VTD_SECOND_LEVEL_PAGING_ENTRY_IGNORE_PAT_BIT                 6
+#define VTD_SECOND_LEVEL_PAGING_ENTRY_IGNORE_PAT_FLAG                0x40
+#define VTD_SECOND_LEVEL_PAGING_ENTRY_IGNORE_PAT_MASK                0x01
+#define VTD_SECOND_LEVEL_PAGING_ENTRY_IGNORE_PAT(_)                  (((_) >> 6) & 0x01)
+
+    /**
+     * [Bit 7] If 1 in SL-PDPE or SL-PDE, the entry maps a 1-GByte or 2-MByte page. Must be 0 unless the page size is reported
+     * in the Second Level Large Page Support (SLLPS) field of the Capability Register.
+     */
+    uint64_t page_size                                               : 1;
+#define VTD_SECOND_LEVEL_PAGING_ENTRY_PAGE_SIZE_BIT                  7
+#define VTD_SECOND_LEVEL_PAGING_ENTRY_PAGE_SIZE_FLAG                 0x80
+#define VTD_SECOND_LEVEL_PAGING_ENTRY_PAGE_SIZE_MASK                 0x01
+#define VTD_SECOND_LEVEL_PAGING_ENTRY_PAGE_SIZE(_)                   (((_) >> 7) & 0x01)
+
+    /**
+     * [Bit 8] Set by hardware on access if second-level accessed/dirty flags are enabled.
+     */
+    uint64_t accessed                                                : 1;
+#define VTD_SECOND_LEVEL_PAGING_ENTRY_ACCESSED_BIT                   8
+#define VTD_SECOND_LEVEL_PAGING_ENTRY_ACCESSED_FLAG                  0x100
+#define VTD_SECOND_LEVEL_PAGING_ENTRY_ACCESSED_MASK                  0x01
+#define VTD_SECOND_LEVEL_PAGING_ENTRY_ACCESSED(_)                    (((_) >> 8) & 0x01)
+
+    /**
+     * [Bit 9] Set by hardware on write to the page if second-level accessed/dirty flags are enabled (leaf entries only).
+     */
+    uint64_t dirty                                                   : 1;
+#define VTD_SECOND_LEVEL_PAGING_ENTRY_DIRTY_BIT                      9
+#define VTD_SECOND_LEVEL_PAGING_ENTRY_DIRTY_FLAG                     0x200
+#define VTD_SECOND_LEVEL_PAGING_ENTRY_DIRTY_MASK                     0x01
+#define VTD_SECOND_LEVEL_PAGING_ENTRY_DIRTY(_)                       (((_) >> 9) & 0x01)
+
+    /**
+     * [Bit 10] Ignored by hardware.
+     */
+    uint64_t ignored_1                                               : 1;
+#define VTD_SECOND_LEVEL_PAGING_ENTRY_IGNORED_1_BIT                  10
+#define VTD_SECOND_LEVEL_PAGING_ENTRY_IGNORED_1_FLAG                 0x400
+#define VTD_SECOND_LEVEL_PAGING_ENTRY_IGNORED_1_MASK                 0x01
+#define VTD_SECOND_LEVEL_PAGING_ENTRY_IGNORED_1(_)                   (((_) >> 10) & 0x01)
+
+    /**
+     * [Bit 11] If 1, requests to the page are snooped (leaf entries only). Ignored by hardware if Snoop Control (SC) is
+     * reported as Clear.
+     */
+    uint64_t snoop                                                   : 1;
+#define VTD_SECOND_LEVEL_PAGING_ENTRY_SNOOP_BIT                      11
+#define VTD_SECOND_LEVEL_PAGING_ENTRY_SNOOP_FLAG                     0x800
+#define VTD_SECOND_LEVEL_PAGING_ENTRY_SNOOP_MASK                     0x01
+#define VTD_SECOND_LEVEL_PAGING_ENTRY_SNOOP(_)                       (((_) >> 11) & 0x01)
+
+    /**
+     * [Bits 51:12] Host physical address of the next-level paging structure, or of the page for leaf entries (bits below the
+     * page size are reserved). Hardware treats bits 63:HAW as reserved (0).
+     */
+    uint64_t address                                                 : 40;
+#define VTD_SECOND_LEVEL_PAGING_ENTRY_ADDRESS_BIT                    12
+#define VTD_SECOND_LEVEL_PAGING_ENTRY_ADDRESS_FLAG                   0xFFFFFFFFFF000
+#define VTD_SECOND_LEVEL_PAGING_ENTRY_ADDRESS_MASK                   0xFFFFFFFFFF
+#define VTD_SECOND_LEVEL_PAGING_ENTRY_ADDRESS(_)                     (((_) >> 12) & 0xFFFFFFFFFF)
+
+    /**
+     * [Bits 62:52] Ignored by hardware.
+     */
+    uint64_t ignored_2                                               : 11;
+#define VTD_SECOND_LEVEL_PAGING_ENTRY_IGNORED_2_BIT                  52
+#define VTD_SECOND_LEVEL_PAGING_ENTRY_IGNORED_2_FLAG                 0x7FF0000000000000
+#define VTD_SECOND_LEVEL_PAGING_ENTRY_IGNORED_2_MASK                 0x7FF
+#define VTD_SECOND_LEVEL_PAGING_ENTRY_IGNORED_2(_)                   (((_) >> 52) & 0x7FF)
+
+    /**
+     * [Bit 63] Ignored by hardware.
+     */
+    uint64_t ignored_3                                               : 1;
+#define VTD_SECOND_LEVEL_PAGING_ENTRY_IGNORED_3_BIT                  63
+#define VTD_SECOND_LEVEL_PAGING_ENTRY_IGNORED_3_FLAG                 0x8000000000000000
+#define VTD_SECOND_LEVEL_PAGING_ENTRY_IGNORED_3_MASK                 0x01
+#define VTD_SECOND_LEVEL_PAGING_ENTRY_IGNORED_3(_)                   (((_) >> 63) & 0x01)
+  };
+
+  uint64_t flags;
+} vtd_second_level_paging_entry;
+#define VTD_SECOND_LEVEL_PAGING_ENTRY_RESERVED_BITS                  0x00
+
+/**
+ * @defgroup vtd_second_level_paging \
+ *           Second-level paging helpers
+ *
+ * Second-level paging helpers.
+ * @{
+ */
+/**
+ * Number of paging levels for Address Width (AW) encoding _ of a context-entry (1 - 39-bit AGAW, 2 - 48-bit AGAW, 3 -
+ * 57-bit AGAW).
+ */
+#define VTD_SECOND_LEVEL_LEVELS(_)                                   ((_) + 2)
+
+/**
+ * Adjusted guest address width in bits for Address Width (AW) encoding _ of a context-entry.
+ */
+#define VTD_SECOND_LEVEL_ADDRESS_WIDTH(_)                            (30 + 9 * (_))
+
+/**
+ * Index of the entry translating address _iova in the paging structure of level _level (1 - SL-PT).
+ */
+#define VTD_SECOND_LEVEL_INDEX(_iova, _level)                        (((_iova) >> (3 + 9 * (_level))) & 0x1FF)
+
+/**
+ * Nonzero if Capability Register value _ reports support of leaf SL-PDEs (_level = 2, 2-MByte pages) or SL-PDPEs (_level =
+ * 3, 1-GByte pages).
+ */
+#define VTD_SECOND_LEVEL_LARGE_PAGE_SUPPORTED(_, _level)             (((_) >> (32 + (_level))) & 0x01)
 /**
  * @}
  */
@@ -24563,6 +28063,7 @@ typedef union
 
   uint32_t flags;
 } vtd_version_register;
+#define VTD_VERSION_RESERVED_BITS                                    0xFFFFFF00
 
 
 /**
@@ -24920,6 +28421,7 @@ typedef union
 
   uint64_t flags;
 } vtd_capability_register;
+#define VTD_CAPABILITY_RESERVED_BITS                                 0x260000400000E000
 
 
 /**
@@ -25386,6 +28888,7 @@ typedef union
 
   uint64_t flags;
 } vtd_extended_capability_register;
+#define VTD_EXTENDED_CAPABILITY_RESERVED_BITS                        0xFFCC0001880C0000
 
 
 /**
@@ -25577,6 +29080,7 @@ typedef union
 
   uint32_t flags;
 } vtd_global_command_register;
+#define VTD_GLOBAL_COMMAND_RESERVED_BITS                             0x7FFFFF
 
 
 /**
@@ -25719,6 +29223,7 @@ typedef union
 
   uint32_t flags;
 } vtd_global_status_register;
+#define VTD_GLOBAL_STATUS_RESERVED_BITS                              0x7FFFFF
 
 
 /**
@@ -25771,6 +29276,7 @@ typedef union
 
   uint64_t flags;
 } vtd_root_table_address_register;
+#define VTD_ROOT_TABLE_ADDRESS_RESERVED_BITS                         0x3FF
 
 
 /**
@@ -25907,26 +29413,180 @@ typedef union
 
   uint64_t flags;
 } vtd_context_command_register;
+#define VTD_CONTEXT_COMMAND_RESERVED_BITS                            0x7FFFFFC00000000
 
 
 /**
- * Register to provide the DMA address whose corresponding IOTLB entry needs to be invalidated through the corresponding
- * IOTLB Invalidate register. This register is a write-only register. A value returned on a read of this register is
- * undefined.
+ * Register indicating the invalidation queue head. This register is treated as RsvdZ by implementations reporting Queued
+ * Invalidation (QI) as not supported in the Extended Capability register.
  *
- * @remarks IVA_REG
- * @see VTd[10.4.8.2(Invalidate Address Register)]
+ * @remarks IQH_REG
+ * @see VTd[10.4.22(Invalidation Queue Head Register)]
  */
-#define VTD_INVALIDATE_ADDRESS                                       0x00000000
+#define VTD_INVALIDATION_QUEUE_HEAD                                  0x00000080
 typedef union
 {
   struct
   {
+    uint64_t reserved1                                               : 4;
+
     /**
-     * @brief Address Mask <b>(WO)</b>
+     * @brief Queue Head <b>(RO)</b>
      *
-     * [Bits 5:0] The value in this field specifies the number of low order bits of the ADDR field that must be masked for the
-     * invalidation operation. This field enables software to request invalidation of contiguous mappings for size-aligned
+     * [Bits 18:4] Specifies the offset (128-bit aligned) to the invalidation queue for the command that will be fetched next
+     * by hardware.
+     * Hardware resets this field to 0 whenever the Queued Invalidation Enable (QIE) field is Clear in the Global Status
+     * Register.
+     */
+    uint64_t queue_head                                              : 15;
+#define VTD_INVALIDATION_QUEUE_HEAD_QUEUE_HEAD_BIT                   4
+#define VTD_INVALIDATION_QUEUE_HEAD_QUEUE_HEAD_FLAG                  0x7FFF0
+#define VTD_INVALIDATION_QUEUE_HEAD_QUEUE_HEAD_MASK                  0x7FFF
+#define VTD_INVALIDATION_QUEUE_HEAD_QUEUE_HEAD(_)                    (((_) >> 4) & 0x7FFF)
+    uint64_t reserved2                                               : 45;
+  };
+
+  uint64_t flags;
+} vtd_invalidation_queue_head_register;
+#define VTD_INVALIDATION_QUEUE_HEAD_RESERVED_BITS                    0xFFFFFFFFFFF8000F
+
+
+/**
+ * Register indicating the invalidation queue tail. This register is treated as RsvdZ by implementations reporting Queued
+ * Invalidation (QI) as not supported in the Extended Capability register.
+ *
+ * @remarks IQT_REG
+ * @see VTd[10.4.23(Invalidation Queue Tail Register)]
+ */
+#define VTD_INVALIDATION_QUEUE_TAIL                                  0x00000088
+typedef union
+{
+  struct
+  {
+    uint64_t reserved1                                               : 4;
+
+    /**
+     * @brief Queue Tail <b>(RW)</b>
+     *
+     * [Bits 18:4] Specifies the offset (128-bit aligned) to the invalidation queue for the command that will be written next
+     * by software. Writing several descriptors before updating this field submits them in a single batch.
+     */
+    uint64_t queue_tail                                              : 15;
+#define VTD_INVALIDATION_QUEUE_TAIL_QUEUE_TAIL_BIT                   4
+#define VTD_INVALIDATION_QUEUE_TAIL_QUEUE_TAIL_FLAG                  0x7FFF0
+#define VTD_INVALIDATION_QUEUE_TAIL_QUEUE_TAIL_MASK                  0x7FFF
+#define VTD_INVALIDATION_QUEUE_TAIL_QUEUE_TAIL(_)                    (((_) >> 4) & 0x7FFF)
+    uint64_t reserved2                                               : 45;
+  };
+
+  uint64_t flags;
+} vtd_invalidation_queue_tail_register;
+#define VTD_INVALIDATION_QUEUE_TAIL_RESERVED_BITS                    0xFFFFFFFFFFF8000F
+
+
+/**
+ * Register to configure the base address and size of the invalidation queue. This register is treated as RsvdZ by
+ * implementations reporting Queued Invalidation (QI) as not supported in the Extended Capability register.
+ *
+ * @remarks IQA_REG
+ * @see VTd[10.4.24(Invalidation Queue Address Register)]
+ */
+#define VTD_INVALIDATION_QUEUE_ADDRESS                               0x00000090
+typedef union
+{
+  struct
+  {
+    /**
+     * @brief Queue Size <b>(RW)</b>
+     *
+     * [Bits 2:0] This field specifies the size of the invalidation request queue. A value of X in this field indicates an
+     * invalidation request queue of (2^X) 4KB pages. The number of entries in the invalidation queue is 2^(X + 8).
+     */
+    uint64_t queue_size                                              : 3;
+#define VTD_INVALIDATION_QUEUE_ADDRESS_QUEUE_SIZE_BIT                0
+#define VTD_INVALIDATION_QUEUE_ADDRESS_QUEUE_SIZE_FLAG               0x07
+#define VTD_INVALIDATION_QUEUE_ADDRESS_QUEUE_SIZE_MASK               0x07
+#define VTD_INVALIDATION_QUEUE_ADDRESS_QUEUE_SIZE(_)                 (((_) >> 0) & 0x07)
+    uint64_t reserved1                                               : 8;
+
+    /**
+     * @brief Descriptor Width <b>(RW)</b>
+     *
+     * [Bit 11] * 0: 128-bit descriptors.
+     * * 1: 256-bit descriptors. Only supported by implementations reporting Scalable Mode Translation Support (SMTS) as Set.
+     */
+    uint64_t descriptor_width                                        : 1;
+#define VTD_INVALIDATION_QUEUE_ADDRESS_DESCRIPTOR_WIDTH_BIT          11
+#define VTD_INVALIDATION_QUEUE_ADDRESS_DESCRIPTOR_WIDTH_FLAG         0x800
+#define VTD_INVALIDATION_QUEUE_ADDRESS_DESCRIPTOR_WIDTH_MASK         0x01
+#define VTD_INVALIDATION_QUEUE_ADDRESS_DESCRIPTOR_WIDTH(_)           (((_) >> 11) & 0x01)
+
+    /**
+     * @brief Invalidation Queue Base Address <b>(RW)</b>
+     *
+     * [Bits 63:12] This field points to the base of 4KB aligned invalidation request queue. Hardware ignores and does not
+     * implement bits 63:HAW, where HAW is the host address width.
+     */
+    uint64_t invalidation_queue_base_address                         : 52;
+#define VTD_INVALIDATION_QUEUE_ADDRESS_INVALIDATION_QUEUE_BASE_ADDRESS_BIT 12
+#define VTD_INVALIDATION_QUEUE_ADDRESS_INVALIDATION_QUEUE_BASE_ADDRESS_FLAG 0xFFFFFFFFFFFFF000
+#define VTD_INVALIDATION_QUEUE_ADDRESS_INVALIDATION_QUEUE_BASE_ADDRESS_MASK 0xFFFFFFFFFFFFF
+#define VTD_INVALIDATION_QUEUE_ADDRESS_INVALIDATION_QUEUE_BASE_ADDRESS(_) (((_) >> 12) & 0xFFFFFFFFFFFFF)
+  };
+
+  uint64_t flags;
+} vtd_invalidation_queue_address_register;
+#define VTD_INVALIDATION_QUEUE_ADDRESS_RESERVED_BITS                 0x7F8
+
+
+/**
+ * Register to report completion status of invalidation wait descriptor with Interrupt Flag (IF) Set.
+ *
+ * @remarks ICS_REG
+ * @see VTd[10.4.25(Invalidation Completion Status Register)]
+ */
+#define VTD_INVALIDATION_COMPLETION_STATUS                           0x0000009C
+typedef union
+{
+  struct
+  {
+    /**
+     * @brief Invalidation Wait Descriptor Complete <b>(RW1CS)</b>
+     *
+     * [Bit 0] Indicates completion of Invalidation Wait Descriptor with Interrupt Flag (IF) field Set. Hardware
+     * implementations not supporting queued invalidations implement this field as RsvdZ.
+     */
+    uint32_t invalidation_wait_descriptor_complete                   : 1;
+#define VTD_INVALIDATION_COMPLETION_STATUS_INVALIDATION_WAIT_DESCRIPTOR_COMPLETE_BIT 0
+#define VTD_INVALIDATION_COMPLETION_STATUS_INVALIDATION_WAIT_DESCRIPTOR_COMPLETE_FLAG 0x01
+#define VTD_INVALIDATION_COMPLETION_STATUS_INVALIDATION_WAIT_DESCRIPTOR_COMPLETE_MASK 0x01
+#define VTD_INVALIDATION_COMPLETION_STATUS_INVALIDATION_WAIT_DESCRIPTOR_COMPLETE(_) (((_) >> 0) & 0x01)
+    uint32_t reserved1                                               : 31;
+  };
+
+  uint32_t flags;
+} vtd_invalidation_completion_status_register;
+#define VTD_INVALIDATION_COMPLETION_STATUS_RESERVED_BITS             0xFFFFFFFE
+
+
+/**
+ * Register to provide the DMA address whose corresponding IOTLB entry needs to be invalidated through the corresponding
+ * IOTLB Invalidate register. This register is a write-only register. A value returned on a read of this register is
+ * undefined.
+ *
+ * @remarks IVA_REG
+ * @see VTd[10.4.8.2(Invalidate Address Register)]
+ */
+#define VTD_INVALIDATE_ADDRESS                                       0x00000000
+typedef union
+{
+  struct
+  {
+    /**
+     * @brief Address Mask <b>(WO)</b>
+     *
+     * [Bits 5:0] The value in this field specifies the number of low order bits of the ADDR field that must be masked for the
+     * invalidation operation. This field enables software to request invalidation of contiguous mappings for size-aligned
      * regions.
      * When invalidating mappings for large-pages, software must specify the appropriate mask value. For example, when
      * invalidating mapping for a 2MB page, software must specify an address mask value of at least 9. Hardware implementations
@@ -25978,6 +29638,7 @@ typedef union
 
   uint64_t flags;
 } vtd_invalidate_address_register;
+#define VTD_INVALIDATE_ADDRESS_RESERVED_BITS                         0xF80
 
 
 /**
@@ -26113,6 +29774,351 @@ typedef union
 
   uint64_t flags;
 } vtd_iotlb_invalidate_register;
+#define VTD_IOTLB_INVALIDATE_RESERVED_BITS                           0x49FC0000FFFFFFFF
+
+/**
+ * @defgroup vtd_invalidation_descriptor_type \
+ *           Invalidation descriptor types
+ *
+ * Invalidation descriptor types.
+ *
+ * @see VTd[6.5.2(Queued Invalidation Interface)]
+ * @{
+ */
+#define VTD_INVALIDATION_DESCRIPTOR_CONTEXT_CACHE                    0x00000001
+#define VTD_INVALIDATION_DESCRIPTOR_IOTLB                            0x00000002
+#define VTD_INVALIDATION_DESCRIPTOR_DEVICE_TLB                       0x00000003
+#define VTD_INVALIDATION_DESCRIPTOR_WAIT                             0x00000005
+
+/**
+ * Size of a 128-bit descriptor in bytes.
+ */
+#define VTD_INVALIDATION_DESCRIPTOR_SIZE                             0x00000010
+
+/**
+ * Number of 128-bit descriptors in the invalidation queue of Queue Size (QS) _.
+ */
+#define VTD_INVALIDATION_DESCRIPTOR_COUNT(_)                         (0x100 << (_))
+
+/**
+ * Queue offset following queue offset _ (e.g., the Queue Tail) in the invalidation queue of Queue Size (QS) _qs.
+ */
+#define VTD_INVALIDATION_DESCRIPTOR_NEXT(_, _qs)                     (((_) + 0x10) & ((0x1000 << (_qs)) - 1))
+/**
+ * @}
+ */
+
+/**
+ * @brief Context-cache Invalidate Descriptor
+ *
+ * @see VTd[6.5.2.1(Context-cache Invalidate Descriptor)]
+ */
+typedef struct
+{
+  union
+  {
+    struct
+    {
+      /**
+       * [Bits 3:0] Descriptor type (01h).
+       */
+      uint64_t type                                                  : 4;
+#define VTD_CONTEXT_CACHE_INVALIDATE_DESCRIPTOR_LOWER64_TYPE_BIT     0
+#define VTD_CONTEXT_CACHE_INVALIDATE_DESCRIPTOR_LOWER64_TYPE_FLAG    0x0F
+#define VTD_CONTEXT_CACHE_INVALIDATE_DESCRIPTOR_LOWER64_TYPE_MASK    0x0F
+#define VTD_CONTEXT_CACHE_INVALIDATE_DESCRIPTOR_LOWER64_TYPE(_)      (((_) >> 0) & 0x0F)
+
+      /**
+       * [Bits 5:4] * 01b: Global invalidation.
+       * * 10b: Domain-selective invalidation of the domain specified by DID.
+       * * 11b: Device-selective invalidation of the device specified by SID and FM within the domain DID.
+       */
+      uint64_t granularity                                           : 2;
+#define VTD_CONTEXT_CACHE_INVALIDATE_DESCRIPTOR_LOWER64_GRANULARITY_BIT 4
+#define VTD_CONTEXT_CACHE_INVALIDATE_DESCRIPTOR_LOWER64_GRANULARITY_FLAG 0x30
+#define VTD_CONTEXT_CACHE_INVALIDATE_DESCRIPTOR_LOWER64_GRANULARITY_MASK 0x03
+#define VTD_CONTEXT_CACHE_INVALIDATE_DESCRIPTOR_LOWER64_GRANULARITY(_) (((_) >> 4) & 0x03)
+      uint64_t reserved1                                             : 10;
+      uint64_t domain_id                                             : 16;
+#define VTD_CONTEXT_CACHE_INVALIDATE_DESCRIPTOR_LOWER64_DOMAIN_ID_BIT 16
+#define VTD_CONTEXT_CACHE_INVALIDATE_DESCRIPTOR_LOWER64_DOMAIN_ID_FLAG 0xFFFF0000
+#define VTD_CONTEXT_CACHE_INVALIDATE_DESCRIPTOR_LOWER64_DOMAIN_ID_MASK 0xFFFF
+#define VTD_CONTEXT_CACHE_INVALIDATE_DESCRIPTOR_LOWER64_DOMAIN_ID(_) (((_) >> 16) & 0xFFFF)
+      uint64_t source_id                                             : 16;
+#define VTD_CONTEXT_CACHE_INVALIDATE_DESCRIPTOR_LOWER64_SOURCE_ID_BIT 32
+#define VTD_CONTEXT_CACHE_INVALIDATE_DESCRIPTOR_LOWER64_SOURCE_ID_FLAG 0xFFFF00000000
+#define VTD_CONTEXT_CACHE_INVALIDATE_DESCRIPTOR_LOWER64_SOURCE_ID_MASK 0xFFFF
+#define VTD_CONTEXT_CACHE_INVALIDATE_DESCRIPTOR_LOWER64_SOURCE_ID(_) (((_) >> 32) & 0xFFFF)
+      uint64_t function_mask                                         : 2;
+#define VTD_CONTEXT_CACHE_INVALIDATE_DESCRIPTOR_LOWER64_FUNCTION_MASK_BIT 48
+#define VTD_CONTEXT_CACHE_INVALIDATE_DESCRIPTOR_LOWER64_FUNCTION_MASK_FLAG 0x3000000000000
+#define VTD_CONTEXT_CACHE_INVALIDATE_DESCRIPTOR_LOWER64_FUNCTION_MASK_MASK 0x03
+#define VTD_CONTEXT_CACHE_INVALIDATE_DESCRIPTOR_LOWER64_FUNCTION_MASK(_) (((_) >> 48) & 0x03)
+      uint64_t reserved2                                             : 14;
+    };
+
+    uint64_t flags;
+  } lower64;
+#define VTD_CONTEXT_CACHE_INVALIDATE_DESCRIPTOR_LOWER64_RESERVED_BITS 0xFFFC00000000FFC0
+
+
+  /**
+   * Must be zero.
+   */
+  uint64_t reserved;
+} vtd_context_cache_invalidate_descriptor;
+
+/**
+ * @brief IOTLB Invalidate Descriptor
+ *
+ * @see VTd[6.5.2.3(IOTLB Invalidate Descriptor)]
+ */
+typedef struct
+{
+  union
+  {
+    struct
+    {
+      /**
+       * [Bits 3:0] Descriptor type (02h).
+       */
+      uint64_t type                                                  : 4;
+#define VTD_IOTLB_INVALIDATE_DESCRIPTOR_LOWER64_TYPE_BIT             0
+#define VTD_IOTLB_INVALIDATE_DESCRIPTOR_LOWER64_TYPE_FLAG            0x0F
+#define VTD_IOTLB_INVALIDATE_DESCRIPTOR_LOWER64_TYPE_MASK            0x0F
+#define VTD_IOTLB_INVALIDATE_DESCRIPTOR_LOWER64_TYPE(_)              (((_) >> 0) & 0x0F)
+
+      /**
+       * [Bits 5:4] * 01b: Global invalidation.
+       * * 10b: Domain-selective invalidation of the domain specified by DID.
+       * * 11b: Page-selective-within-domain invalidation of the pages specified by ADDR and AM within the domain DID.
+       */
+      uint64_t granularity                                           : 2;
+#define VTD_IOTLB_INVALIDATE_DESCRIPTOR_LOWER64_GRANULARITY_BIT      4
+#define VTD_IOTLB_INVALIDATE_DESCRIPTOR_LOWER64_GRANULARITY_FLAG     0x30
+#define VTD_IOTLB_INVALIDATE_DESCRIPTOR_LOWER64_GRANULARITY_MASK     0x03
+#define VTD_IOTLB_INVALIDATE_DESCRIPTOR_LOWER64_GRANULARITY(_)       (((_) >> 4) & 0x03)
+      uint64_t drain_writes                                          : 1;
+#define VTD_IOTLB_INVALIDATE_DESCRIPTOR_LOWER64_DRAIN_WRITES_BIT     6
+#define VTD_IOTLB_INVALIDATE_DESCRIPTOR_LOWER64_DRAIN_WRITES_FLAG    0x40
+#define VTD_IOTLB_INVALIDATE_DESCRIPTOR_LOWER64_DRAIN_WRITES_MASK    0x01
+#define VTD_IOTLB_INVALIDATE_DESCRIPTOR_LOWER64_DRAIN_WRITES(_)      (((_) >> 6) & 0x01)
+      uint64_t drain_reads                                           : 1;
+#define VTD_IOTLB_INVALIDATE_DESCRIPTOR_LOWER64_DRAIN_READS_BIT      7
+#define VTD_IOTLB_INVALIDATE_DESCRIPTOR_LOWER64_DRAIN_READS_FLAG     0x80
+#define VTD_IOTLB_INVALIDATE_DESCRIPTOR_LOWER64_DRAIN_READS_MASK     0x01
+#define VTD_IOTLB_INVALIDATE_DESCRIPTOR_LOWER64_DRAIN_READS(_)       (((_) >> 7) & 0x01)
+      uint64_t reserved1                                             : 8;
+      uint64_t domain_id                                             : 16;
+#define VTD_IOTLB_INVALIDATE_DESCRIPTOR_LOWER64_DOMAIN_ID_BIT        16
+#define VTD_IOTLB_INVALIDATE_DESCRIPTOR_LOWER64_DOMAIN_ID_FLAG       0xFFFF0000
+#define VTD_IOTLB_INVALIDATE_DESCRIPTOR_LOWER64_DOMAIN_ID_MASK       0xFFFF
+#define VTD_IOTLB_INVALIDATE_DESCRIPTOR_LOWER64_DOMAIN_ID(_)         (((_) >> 16) & 0xFFFF)
+      uint64_t reserved2                                             : 32;
+    };
+
+    uint64_t flags;
+  } lower64;
+#define VTD_IOTLB_INVALIDATE_DESCRIPTOR_LOWER64_RESERVED_BITS        0xFFFFFFFF0000FF00
+
+  union
+  {
+    struct
+    {
+      /**
+       * [Bits 5:0] Number of low order bits of ADDR masked for the invalidation, i.e. 2^AM contiguous size-aligned pages are
+       * invalidated by a single descriptor.
+       */
+      uint64_t address_mask                                          : 6;
+#define VTD_IOTLB_INVALIDATE_DESCRIPTOR_UPPER64_ADDRESS_MASK_BIT     0
+#define VTD_IOTLB_INVALIDATE_DESCRIPTOR_UPPER64_ADDRESS_MASK_FLAG    0x3F
+#define VTD_IOTLB_INVALIDATE_DESCRIPTOR_UPPER64_ADDRESS_MASK_MASK    0x3F
+#define VTD_IOTLB_INVALIDATE_DESCRIPTOR_UPPER64_ADDRESS_MASK(_)      (((_) >> 0) & 0x3F)
+      uint64_t invalidation_hint                                     : 1;
+#define VTD_IOTLB_INVALIDATE_DESCRIPTOR_UPPER64_INVALIDATION_HINT_BIT 6
+#define VTD_IOTLB_INVALIDATE_DESCRIPTOR_UPPER64_INVALIDATION_HINT_FLAG 0x40
+#define VTD_IOTLB_INVALIDATE_DESCRIPTOR_UPPER64_INVALIDATION_HINT_MASK 0x01
+#define VTD_IOTLB_INVALIDATE_DESCRIPTOR_UPPER64_INVALIDATION_HINT(_) (((_) >> 6) & 0x01)
+      uint64_t reserved1                                             : 5;
+      uint64_t page_address                                          : 52;
+#define VTD_IOTLB_INVALIDATE_DESCRIPTOR_UPPER64_PAGE_ADDRESS_BIT     12
+#define VTD_IOTLB_INVALIDATE_DESCRIPTOR_UPPER64_PAGE_ADDRESS_FLAG    0xFFFFFFFFFFFFF000
+#define VTD_IOTLB_INVALIDATE_DESCRIPTOR_UPPER64_PAGE_ADDRESS_MASK    0xFFFFFFFFFFFFF
+#define VTD_IOTLB_INVALIDATE_DESCRIPTOR_UPPER64_PAGE_ADDRESS(_)      (((_) >> 12) & 0xFFFFFFFFFFFFF)
+    };
+
+    uint64_t flags;
+  } upper64;
+#define VTD_IOTLB_INVALIDATE_DESCRIPTOR_UPPER64_RESERVED_BITS        0xF80
+
+} vtd_iotlb_invalidate_descriptor;
+
+/**
+ * @brief Device-TLB Invalidate Descriptor
+ *
+ * @see VTd[6.5.2.5(Device-TLB Invalidate Descriptor)]
+ */
+typedef struct
+{
+  union
+  {
+    struct
+    {
+      /**
+       * [Bits 3:0] Descriptor type (03h).
+       */
+      uint64_t type                                                  : 4;
+#define VTD_DEVICE_TLB_INVALIDATE_DESCRIPTOR_LOWER64_TYPE_BIT        0
+#define VTD_DEVICE_TLB_INVALIDATE_DESCRIPTOR_LOWER64_TYPE_FLAG       0x0F
+#define VTD_DEVICE_TLB_INVALIDATE_DESCRIPTOR_LOWER64_TYPE_MASK       0x0F
+#define VTD_DEVICE_TLB_INVALIDATE_DESCRIPTOR_LOWER64_TYPE(_)         (((_) >> 0) & 0x0F)
+      uint64_t reserved1                                             : 8;
+
+      /**
+       * [Bits 15:12] Bits 3:0 of the source-id of the physical function of a virtual function device.
+       */
+      uint64_t physical_function_source_id_low                       : 4;
+#define VTD_DEVICE_TLB_INVALIDATE_DESCRIPTOR_LOWER64_PHYSICAL_FUNCTION_SOURCE_ID_LOW_BIT 12
+#define VTD_DEVICE_TLB_INVALIDATE_DESCRIPTOR_LOWER64_PHYSICAL_FUNCTION_SOURCE_ID_LOW_FLAG 0xF000
+#define VTD_DEVICE_TLB_INVALIDATE_DESCRIPTOR_LOWER64_PHYSICAL_FUNCTION_SOURCE_ID_LOW_MASK 0x0F
+#define VTD_DEVICE_TLB_INVALIDATE_DESCRIPTOR_LOWER64_PHYSICAL_FUNCTION_SOURCE_ID_LOW(_) (((_) >> 12) & 0x0F)
+      uint64_t max_invalidations_pending                             : 5;
+#define VTD_DEVICE_TLB_INVALIDATE_DESCRIPTOR_LOWER64_MAX_INVALIDATIONS_PENDING_BIT 16
+#define VTD_DEVICE_TLB_INVALIDATE_DESCRIPTOR_LOWER64_MAX_INVALIDATIONS_PENDING_FLAG 0x1F0000
+#define VTD_DEVICE_TLB_INVALIDATE_DESCRIPTOR_LOWER64_MAX_INVALIDATIONS_PENDING_MASK 0x1F
+#define VTD_DEVICE_TLB_INVALIDATE_DESCRIPTOR_LOWER64_MAX_INVALIDATIONS_PENDING(_) (((_) >> 16) & 0x1F)
+      uint64_t reserved2                                             : 11;
+      uint64_t source_id                                             : 16;
+#define VTD_DEVICE_TLB_INVALIDATE_DESCRIPTOR_LOWER64_SOURCE_ID_BIT   32
+#define VTD_DEVICE_TLB_INVALIDATE_DESCRIPTOR_LOWER64_SOURCE_ID_FLAG  0xFFFF00000000
+#define VTD_DEVICE_TLB_INVALIDATE_DESCRIPTOR_LOWER64_SOURCE_ID_MASK  0xFFFF
+#define VTD_DEVICE_TLB_INVALIDATE_DESCRIPTOR_LOWER64_SOURCE_ID(_)    (((_) >> 32) & 0xFFFF)
+      uint64_t reserved3                                             : 4;
+
+      /**
+       * [Bits 63:52] Bits 15:4 of the source-id of the physical function of a virtual function device.
+       */
+      uint64_t physical_function_source_id_high                      : 12;
+#define VTD_DEVICE_TLB_INVALIDATE_DESCRIPTOR_LOWER64_PHYSICAL_FUNCTION_SOURCE_ID_HIGH_BIT 52
+#define VTD_DEVICE_TLB_INVALIDATE_DESCRIPTOR_LOWER64_PHYSICAL_FUNCTION_SOURCE_ID_HIGH_FLAG 0xFFF0000000000000
+#define VTD_DEVICE_TLB_INVALIDATE_DESCRIPTOR_LOWER64_PHYSICAL_FUNCTION_SOURCE_ID_HIGH_MASK 0xFFF
+#define VTD_DEVICE_TLB_INVALIDATE_DESCRIPTOR_LOWER64_PHYSICAL_FUNCTION_SOURCE_ID_HIGH(_) (((_) >> 52) & 0xFFF)
+    };
+
+    uint64_t flags;
+  } lower64;
+#define VTD_DEVICE_TLB_INVALIDATE_DESCRIPTOR_LOWER64_RESERVED_BITS   0xF0000FFE00FF0
+
+  union
+  {
+    struct
+    {
+      /**
+       * [Bit 0] If 1, the invalidation range is encoded in the low order bits of ADDR.
+       */
+      uint64_t size                                                  : 1;
+#define VTD_DEVICE_TLB_INVALIDATE_DESCRIPTOR_UPPER64_SIZE_BIT        0
+#define VTD_DEVICE_TLB_INVALIDATE_DESCRIPTOR_UPPER64_SIZE_FLAG       0x01
+#define VTD_DEVICE_TLB_INVALIDATE_DESCRIPTOR_UPPER64_SIZE_MASK       0x01
+#define VTD_DEVICE_TLB_INVALIDATE_DESCRIPTOR_UPPER64_SIZE(_)         (((_) >> 0) & 0x01)
+      uint64_t reserved1                                             : 11;
+      uint64_t page_address                                          : 52;
+#define VTD_DEVICE_TLB_INVALIDATE_DESCRIPTOR_UPPER64_PAGE_ADDRESS_BIT 12
+#define VTD_DEVICE_TLB_INVALIDATE_DESCRIPTOR_UPPER64_PAGE_ADDRESS_FLAG 0xFFFFFFFFFFFFF000
+#define VTD_DEVICE_TLB_INVALIDATE_DESCRIPTOR_UPPER64_PAGE_ADDRESS_MASK 0xFFFFFFFFFFFFF
+#define VTD_DEVICE_TLB_INVALIDATE_DESCRIPTOR_UPPER64_PAGE_ADDRESS(_) (((_) >> 12) & 0xFFFFFFFFFFFFF)
+    };
+
+    uint64_t flags;
+  } upper64;
+#define VTD_DEVICE_TLB_INVALIDATE_DESCRIPTOR_UPPER64_RESERVED_BITS   0xFFE
+
+} vtd_device_tlb_invalidate_descriptor;
+
+/**
+ * @brief Invalidation Wait Descriptor
+ *
+ * @see VTd[6.5.2.8(Invalidation Wait Descriptor)]
+ */
+typedef struct
+{
+  union
+  {
+    struct
+    {
+      /**
+       * [Bits 3:0] Descriptor type (05h).
+       */
+      uint64_t type                                                  : 4;
+#define VTD_INVALIDATION_WAIT_DESCRIPTOR_LOWER64_TYPE_BIT            0
+#define VTD_INVALIDATION_WAIT_DESCRIPTOR_LOWER64_TYPE_FLAG           0x0F
+#define VTD_INVALIDATION_WAIT_DESCRIPTOR_LOWER64_TYPE_MASK           0x0F
+#define VTD_INVALIDATION_WAIT_DESCRIPTOR_LOWER64_TYPE(_)             (((_) >> 0) & 0x0F)
+
+      /**
+       * [Bit 4] If 1, an invalidation completion event is generated on completion of the descriptor.
+       */
+      uint64_t interrupt_flag                                        : 1;
+#define VTD_INVALIDATION_WAIT_DESCRIPTOR_LOWER64_INTERRUPT_FLAG_BIT  4
+#define VTD_INVALIDATION_WAIT_DESCRIPTOR_LOWER64_INTERRUPT_FLAG_FLAG 0x10
+#define VTD_INVALIDATION_WAIT_DESCRIPTOR_LOWER64_INTERRUPT_FLAG_MASK 0x01
+#define VTD_INVALIDATION_WAIT_DESCRIPTOR_LOWER64_INTERRUPT_FLAG(_)   (((_) >> 4) & 0x01)
+
+      /**
+       * [Bit 5] If 1, STATUS_DATA is written to STATUS_ADDRESS on completion of the descriptor.
+       */
+      uint64_t status_write                                          : 1;
+#define VTD_INVALIDATION_WAIT_DESCRIPTOR_LOWER64_STATUS_WRITE_BIT    5
+#define VTD_INVALIDATION_WAIT_DESCRIPTOR_LOWER64_STATUS_WRITE_FLAG   0x20
+#define VTD_INVALIDATION_WAIT_DESCRIPTOR_LOWER64_STATUS_WRITE_MASK   0x01
+#define VTD_INVALIDATION_WAIT_DESCRIPTOR_LOWER64_STATUS_WRITE(_)     (((_) >> 5) & 0x01)
+
+      /**
+       * [Bit 6] If 1, descriptors following this descriptor are processed after it completes.
+       */
+      uint64_t fence                                                 : 1;
+#define VTD_INVALIDATION_WAIT_DESCRIPTOR_LOWER64_FENCE_BIT           6
+#define VTD_INVALIDATION_WAIT_DESCRIPTOR_LOWER64_FENCE_FLAG          0x40
+#define VTD_INVALIDATION_WAIT_DESCRIPTOR_LOWER64_FENCE_MASK          0x01
+#define VTD_INVALIDATION_WAIT_DESCRIPTOR_LOWER64_FENCE(_)            (((_) >> 6) & 0x01)
+      uint64_t page_request_drain                                    : 1;
+#define VTD_INVALIDATION_WAIT_DESCRIPTOR_LOWER64_PAGE_REQUEST_DRAIN_BIT 7
+#define VTD_INVALIDATION_WAIT_DESCRIPTOR_LOWER64_PAGE_REQUEST_DRAIN_FLAG 0x80
+#define VTD_INVALIDATION_WAIT_DESCRIPTOR_LOWER64_PAGE_REQUEST_DRAIN_MASK 0x01
+#define VTD_INVALIDATION_WAIT_DESCRIPTOR_LOWER64_PAGE_REQUEST_DRAIN(_) (((_) >> 7) & 0x01)
+      uint64_t reserved1                                             : 24;
+      uint64_t status_data                                           : 32;
+#define VTD_INVALIDATION_WAIT_DESCRIPTOR_LOWER64_STATUS_DATA_BIT     32
+#define VTD_INVALIDATION_WAIT_DESCRIPTOR_LOWER64_STATUS_DATA_FLAG    0xFFFFFFFF00000000
+#define VTD_INVALIDATION_WAIT_DESCRIPTOR_LOWER64_STATUS_DATA_MASK    0xFFFFFFFF
+#define VTD_INVALIDATION_WAIT_DESCRIPTOR_LOWER64_STATUS_DATA(_)      (((_) >> 32) & 0xFFFFFFFF)
+    };
+
+    uint64_t flags;
+  } lower64;
+#define VTD_INVALIDATION_WAIT_DESCRIPTOR_LOWER64_RESERVED_BITS       0xFFFFFF00
+
+  union
+  {
+    struct
+    {
+      uint64_t reserved1                                             : 2;
+
+      /**
+       * [Bits 63:2] Bits 63:2 of the 32-bit aligned address STATUS_DATA is written to.
+       */
+      uint64_t status_address                                        : 62;
+#define VTD_INVALIDATION_WAIT_DESCRIPTOR_UPPER64_STATUS_ADDRESS_BIT  2
+#define VTD_INVALIDATION_WAIT_DESCRIPTOR_UPPER64_STATUS_ADDRESS_FLAG 0xFFFFFFFFFFFFFFFC
+#define VTD_INVALIDATION_WAIT_DESCRIPTOR_UPPER64_STATUS_ADDRESS_MASK 0x3FFFFFFFFFFFFFFF
+#define VTD_INVALIDATION_WAIT_DESCRIPTOR_UPPER64_STATUS_ADDRESS(_)   (((_) >> 2) & 0x3FFFFFFFFFFFFFFF)
+    };
+
+    uint64_t flags;
+  } upper64;
+#define VTD_INVALIDATION_WAIT_DESCRIPTOR_UPPER64_RESERVED_BITS       0x03
+
+} vtd_invalidation_wait_descriptor;
 
 /**
  * @}
@@ -26210,11 +30216,276 @@ typedef union
 #define XCR0_PKRU_FLAG                                               0x200
 #define XCR0_PKRU_MASK                                               0x01
 #define XCR0_PKRU(_)                                                 (((_) >> 9) & 0x01)
-    uint64_t reserved2                                               : 54;
+    uint64_t reserved2                                               : 7;
+
+    /**
+     * [Bit 17] If 1, AMX instructions can be executed and the XSAVE feature set can be used to manage TILECFG.
+     */
+    uint64_t tilecfg                                                 : 1;
+#define XCR0_TILECFG_BIT                                             17
+#define XCR0_TILECFG_FLAG                                            0x20000
+#define XCR0_TILECFG_MASK                                            0x01
+#define XCR0_TILECFG(_)                                              (((_) >> 17) & 0x01)
+
+    /**
+     * [Bit 18] If 1, AMX instructions can be executed and the XSAVE feature set can be used to manage TILEDATA.
+     */
+    uint64_t tiledata                                                : 1;
+#define XCR0_TILEDATA_BIT                                            18
+#define XCR0_TILEDATA_FLAG                                           0x40000
+#define XCR0_TILEDATA_MASK                                           0x01
+#define XCR0_TILEDATA(_)                                             (((_) >> 18) & 0x01)
+    uint64_t reserved3                                               : 45;
   };
 
   uint64_t flags;
 } xcr0;
+#define XCR0_RESERVED_BITS                                           0xFFFFFFFFFFF9FD00
+
+/**
+ * @defgroup xsave \
+ *           XSAVE area
+ *
+ * The XSAVE feature set supports the saving and restoring of state components, each of which is a discrete set of
+ * processor registers (or parts of registers). Each state component corresponds to a bit position in XCR0 (user state
+ * components) or in the IA32_XSS MSR (supervisor state components).
+ * The XSAVE area comprises the legacy region (first 512 bytes, used for state components 0 and 1), the XSAVE header (next
+ * 64 bytes) and the extended region (starting at byte offset 576, used for state components 2 and above).
+ * In the standard format, size and offset of each state component i (i >= 2) are reported by CPUID.(EAX=0DH, ECX=i):EAX
+ * and EBX respectively. In the compacted format (used by XSAVEC and XSAVES), the location of each state component depends
+ * on the XCOMP_BV field of the XSAVE header (see XSAVE_COMPACTED_OFFSET):
+ * <pre> Offset = 576 For i = 2 to 62 IF (XCOMP_BV[i] = 1) IF (CPUID.(EAX=0DH, ECX=i):ECX[1] = 1) // Aligned Offset =
+ * (Offset + 63) & ~63; FI; Location[i] = Offset; Offset = Offset + CPUID.(EAX=0DH, ECX=i):EAX; FI; </pre>
+ *
+ * @see Vol1[13.4(XSAVE AREA)] (reference)
+ * @{
+ */
+/**
+ * The XSAVE area must be aligned on 64-byte boundary.
+ */
+#define XSAVE_ALIGNMENT                                              0x00000040
+
+/**
+ * Offset of the legacy region of the XSAVE area.
+ */
+#define XSAVE_LEGACY_REGION_OFFSET                                   0x00000000
+
+/**
+ * Size of the legacy region of the XSAVE area (used for state components 0 and 1).
+ */
+#define XSAVE_LEGACY_REGION_SIZE                                     0x00000200
+
+/**
+ * Offset of the XSAVE header.
+ */
+#define XSAVE_HEADER_OFFSET                                          0x00000200
+
+/**
+ * Size of the XSAVE header.
+ */
+#define XSAVE_HEADER_SIZE                                            0x00000040
+
+/**
+ * Offset of the extended region of the XSAVE area (first state component in the compacted format).
+ */
+#define XSAVE_EXTENDED_REGION_OFFSET                                 0x00000240
+/**
+ * @defgroup xsave_component \
+ *           XSAVE-supported state components
+ *
+ * Each state component is identified by its index, which is also the bit position in XCR0, IA32_XSS, XSTATE_BV and
+ * XCOMP_BV, and the sub-leaf of CPUID leaf 0DH which enumerates its size and offset.
+ *
+ * @see Vol1[13.1(XSAVE-SUPPORTED FEATURES AND STATE-COMPONENT BITMAPS)] (reference)
+ * @{
+ */
+/**
+ * x87 state.
+ */
+#define XSAVE_COMPONENT_X87                                          0x00000000
+
+/**
+ * SSE state (MXCSR and XMM registers).
+ */
+#define XSAVE_COMPONENT_SSE                                          0x00000001
+
+/**
+ * AVX state (upper halves of the YMM registers).
+ */
+#define XSAVE_COMPONENT_AVX                                          0x00000002
+
+/**
+ * MPX state - BND0-BND3.
+ */
+#define XSAVE_COMPONENT_BNDREGS                                      0x00000003
+
+/**
+ * MPX state - BNDCFGU and BNDSTATUS.
+ */
+#define XSAVE_COMPONENT_BNDCSR                                       0x00000004
+
+/**
+ * AVX-512 state - opmask registers k0-k7.
+ */
+#define XSAVE_COMPONENT_OPMASK                                       0x00000005
+
+/**
+ * AVX-512 state - upper halves of the lower ZMM registers.
+ */
+#define XSAVE_COMPONENT_ZMM_HI256                                    0x00000006
+
+/**
+ * AVX-512 state - upper ZMM registers (ZMM16-ZMM31).
+ */
+#define XSAVE_COMPONENT_HI16_ZMM                                     0x00000007
+
+/**
+ * Processor Trace state (supervisor state component).
+ */
+#define XSAVE_COMPONENT_PT                                           0x00000008
+
+/**
+ * PKRU state.
+ */
+#define XSAVE_COMPONENT_PKRU                                         0x00000009
+
+/**
+ * PASID state (supervisor state component).
+ */
+#define XSAVE_COMPONENT_PASID                                        0x0000000A
+
+/**
+ * CET user state (supervisor state component).
+ */
+#define XSAVE_COMPONENT_CET_U                                        0x0000000B
+
+/**
+ * CET supervisor state (supervisor state component).
+ */
+#define XSAVE_COMPONENT_CET_S                                        0x0000000C
+
+/**
+ * HDC state (supervisor state component).
+ */
+#define XSAVE_COMPONENT_HDC                                          0x0000000D
+
+/**
+ * User interrupt state (supervisor state component).
+ */
+#define XSAVE_COMPONENT_UINTR                                        0x0000000E
+
+/**
+ * Architectural LBR state (supervisor state component).
+ */
+#define XSAVE_COMPONENT_LBR                                          0x0000000F
+
+/**
+ * HWP state (supervisor state component).
+ */
+#define XSAVE_COMPONENT_HWP                                          0x00000010
+
+/**
+ * AMX state - TILECFG register.
+ */
+#define XSAVE_COMPONENT_TILECFG                                      0x00000011
+
+/**
+ * AMX state - TILEDATA registers.
+ */
+#define XSAVE_COMPONENT_TILEDATA                                     0x00000012
+
+/**
+ * Number of state components (highest state component + 1).
+ */
+#define XSAVE_COMPONENT_COUNT                                        0x00000013
+/**
+ * @}
+ */
+
+
+/**
+ * State components managed by the IA32_XSS MSR (PT, PASID, CET_U, CET_S, HDC, UINTR, LBR and HWP). Other state components
+ * are managed by XCR0.
+ */
+#define XSAVE_SUPERVISOR_COMPONENTS                                  0x0001FD00
+
+/**
+ * Offset of state component _i in the standard format of the XSAVE area, _cpuid_ebx is CPUID.(EAX=0DH, ECX=_i):EBX. State
+ * components 0 and 1 are located in the legacy region (offset 0).
+ */
+#define XSAVE_STANDARD_OFFSET(_i, _cpuid_ebx)                        ((_cpuid_ebx) * ((_i) >= 2))
+
+/**
+ * Offset of state component in the compacted format of the XSAVE area, if the preceding state components present in
+ * XCOMP_BV end at offset _end (XSAVE_EXTENDED_REGION_OFFSET for the first one). _cpuid_ecx is CPUID.(EAX=0DH, ECX=i):ECX
+ * of the state component, which tells whether it is 64-byte aligned. The component ends at this offset plus
+ * CPUID.(EAX=0DH, ECX=i):EAX.
+ */
+#define XSAVE_COMPACTED_OFFSET(_end, _cpuid_ecx)                     (((_end) + (((_cpuid_ecx) >> 1) & 0x01) * 63) & ~((((_cpuid_ecx) >> 1) & 0x01) * 63))
+/**
+ * @brief XSAVE header
+ *
+ * @see Vol1[13.4.2(XSAVE Header)] (reference)
+ */
+typedef struct
+{
+  union
+  {
+    struct
+    {
+      /**
+       * [Bits 62:0] State-component bitmap identifying the state components in the XSAVE area. Bit i is set if state component i
+       * is not in its initial configuration.
+       */
+      uint64_t state_components                                      : 63;
+#define XSAVE_HEADER_XSTATE_BV_STATE_COMPONENTS_BIT                  0
+#define XSAVE_HEADER_XSTATE_BV_STATE_COMPONENTS_FLAG                 0x7FFFFFFFFFFFFFFF
+#define XSAVE_HEADER_XSTATE_BV_STATE_COMPONENTS_MASK                 0x7FFFFFFFFFFFFFFF
+#define XSAVE_HEADER_XSTATE_BV_STATE_COMPONENTS(_)                   (((_) >> 0) & 0x7FFFFFFFFFFFFFFF)
+      uint64_t reserved1                                             : 1;
+    };
+
+    uint64_t flags;
+  } xstate_bv;
+#define XSAVE_HEADER_XSTATE_BV_RESERVED_BITS                         0x8000000000000000
+
+  union
+  {
+    struct
+    {
+      /**
+       * [Bits 62:0] State-component bitmap identifying the state components present in the compacted format of the XSAVE area.
+       */
+      uint64_t state_components                                      : 63;
+#define XSAVE_HEADER_XCOMP_BV_STATE_COMPONENTS_BIT                   0
+#define XSAVE_HEADER_XCOMP_BV_STATE_COMPONENTS_FLAG                  0x7FFFFFFFFFFFFFFF
+#define XSAVE_HEADER_XCOMP_BV_STATE_COMPONENTS_MASK                  0x7FFFFFFFFFFFFFFF
+#define XSAVE_HEADER_XCOMP_BV_STATE_COMPONENTS(_)                    (((_) >> 0) & 0x7FFFFFFFFFFFFFFF)
+
+      /**
+       * [Bit 63] If set, the XSAVE area uses the compacted format.
+       */
+      uint64_t compacted_format                                      : 1;
+#define XSAVE_HEADER_XCOMP_BV_COMPACTED_FORMAT_BIT                   63
+#define XSAVE_HEADER_XCOMP_BV_COMPACTED_FORMAT_FLAG                  0x8000000000000000
+#define XSAVE_HEADER_XCOMP_BV_COMPACTED_FORMAT_MASK                  0x01
+#define XSAVE_HEADER_XCOMP_BV_COMPACTED_FORMAT(_)                    (((_) >> 63) & 0x01)
+    };
+
+    uint64_t flags;
+  } xcomp_bv;
+#define XSAVE_HEADER_XCOMP_BV_RESERVED_BITS                          0x00
+
+
+  /**
+   * Reserved. Must be 0.
+   */
+  uint8_t reserved[48];
+} xsave_header;
+
+/**
+ * @}
+ */
 
 /**
  * @}
@@ -39,10 +39,10 @@ typedef union {
 
 typedef union {
   struct {
-    uint64_t reserved_1                                              : 3;
+    uint64_t ignored_1                                               : 3;
     uint64_t page_level_write_through                                : 1;
     uint64_t page_level_cache_disable                                : 1;
-    uint64_t reserved_2                                              : 7;
+    uint64_t ignored_2                                               : 7;
     uint64_t address_of_page_directory                               : 36;
   };
 
@@ -847,7 +847,7 @@ typedef struct {
 typedef struct {
   union {
     struct {
-      uint32_t ia32_platform_dca_cap                                 : 32;
+      uint32_t size                                                  : 32;
     };
 
     uint32_t flags;
@@ -855,7 +855,7 @@ typedef struct {
 
   union {
     struct {
-      uint32_t reserved                                              : 32;
+      uint32_t offset                                                : 32;
     };
 
     uint32_t flags;
@@ -863,8 +863,8 @@ typedef struct {
 
   union {
     struct {
-      uint32_t ecx_2                                                 : 1;
-      uint32_t ecx_1                                                 : 1;
+      uint32_t supported_in_ia32_xss                                 : 1;
+      uint32_t aligned_64_bytes                                      : 1;
     };
 
     uint32_t flags;
@@ -2161,6 +2161,20 @@ typedef struct {
 #define IA32_PMC5                                                    0x000000C6
 #define IA32_PMC6                                                    0x000000C7
 #define IA32_PMC7                                                    0x000000C8
+/**
+ * @defgroup ia32_pmc_encoding \
+ *           General-purpose performance counter helpers
+ * @{
+ */
+#define IA32_PMC_WIDTH_MASK(_cpuid_eax)                              ((1ULL << (((_cpuid_eax) >> 16) & 0xFF)) - 1)
+#define IA32_PMC_OVERFLOWED(_, _previous, _width_mask)               (((_) & (_width_mask)) < ((_previous) & (_width_mask)))
+#define IA32_PMC_MSR(_)                                              (0xC1 + (_))
+#define IA32_PMC_INDEX(_msr)                                         ((_msr) - 0xC1)
+#define IA32_PMC_IN_RANGE(_msr, _count)                              (((_msr) >= 0xC1) & ((_msr) < 0xC1 + (_count)))
+/**
+ * @}
+ */
+
 /**
  * @}
  */
@@ -2296,6 +2310,28 @@ typedef union {
   uint64_t flags;
 } ia32_perfevtsel_register;
 
+/**
+ * @defgroup ia32_perfevtsel_encoding \
+ *           Performance event select encoding
+ * @{
+ */
+#define IA32_PERFEVTSEL_UNHALTED_CORE_CYCLES                         0x0000003C
+#define IA32_PERFEVTSEL_INSTRUCTIONS_RETIRED                         0x000000C0
+#define IA32_PERFEVTSEL_UNHALTED_REFERENCE_CYCLES                    0x0000013C
+#define IA32_PERFEVTSEL_LLC_REFERENCE                                0x00004F2E
+#define IA32_PERFEVTSEL_LLC_MISSES                                   0x0000412E
+#define IA32_PERFEVTSEL_BRANCH_INSTRUCTIONS_RETIRED                  0x000000C4
+#define IA32_PERFEVTSEL_BRANCH_MISSES_RETIRED                        0x000000C5
+#define IA32_PERFEVTSEL_TOPDOWN_SLOTS                                0x000001A4
+#define IA32_PERFEVTSEL_ARCHITECTURAL_EVENT_AVAILABLE(_, _cpuid_eax, _index) (((((_) >> (_index)) & 0x01) ^ 0x01) & ((((_cpuid_eax) >> 24) & 0xFF) > (_index)))
+#define IA32_PERFEVTSEL_ENCODE(_event, _cmask, _flags)               (((_event) & 0xFFFFULL) | (((_cmask) & 0xFFULL) << 24) | ((_flags) & 0xBF0000ULL) | 0x400000ULL)
+#define IA32_PERFEVTSEL_MSR(_)                                       (0x186 + (_))
+#define IA32_PERFEVTSEL_INDEX(_msr)                                  ((_msr) - 0x186)
+#define IA32_PERFEVTSEL_IN_RANGE(_msr, _count)                       (((_msr) >= 0x186) & ((_msr) < 0x186 + (_count)))
+/**
+ * @}
+ */
+
 /**
  * @}
  */
@@ -2724,6 +2760,18 @@ typedef union {
 #define IA32_FIXED_CTR0                                              0x00000309
 #define IA32_FIXED_CTR1                                              0x0000030A
 #define IA32_FIXED_CTR2                                              0x0000030B
+/**
+ * @defgroup ia32_fixed_ctr_encoding \
+ *           Fixed-function performance counter helpers
+ * @{
+ */
+#define IA32_FIXED_CTR_MSR(_)                                        (0x309 + (_))
+#define IA32_FIXED_CTR_INDEX(_msr)                                   ((_msr) - 0x309)
+#define IA32_FIXED_CTR_IN_RANGE(_msr, _count)                        (((_msr) >= 0x309) & ((_msr) < 0x309 + (_count)))
+/**
+ * @}
+ */
+
 /**
  * @}
  */
@@ -2762,6 +2810,12 @@ typedef union {
   uint64_t flags;
 } ia32_fixed_ctr_ctrl_register;
 
+#define IA32_FIXED_CTR_CTRL_OS                                       0x00000001
+#define IA32_FIXED_CTR_CTRL_USR                                      0x00000002
+#define IA32_FIXED_CTR_CTRL_ANY_THREAD                               0x00000004
+#define IA32_FIXED_CTR_CTRL_PMI                                      0x00000008
+#define IA32_FIXED_CTR_CTRL_ENCODE(_n, _)                            (((_) & 0x0FULL) << ((_n) * 4))
+#define IA32_FIXED_CTR_CTRL_FIELD_MASK(_n)                           (0x0FULL << ((_n) * 4))
 #define IA32_PERF_GLOBAL_STATUS                                      0x0000038E
 typedef union {
   struct {
@@ -2797,6 +2851,9 @@ typedef union {
   uint64_t flags;
 } ia32_perf_global_ctrl_register;
 
+#define IA32_PERF_GLOBAL_CTRL_PMC_FLAG(_)                            (1ULL << (_))
+#define IA32_PERF_GLOBAL_CTRL_FIXED_CTR_FLAG(_)                      (1ULL << (32 + (_)))
+#define IA32_PERF_GLOBAL_CTRL_SUPPORTED(_cpuid_eax, _cpuid_edx)      (((1ULL << (((_cpuid_eax) >> 8) & 0xFF)) - 1) | (((1ULL << ((_cpuid_edx) & 0x1F)) - 1) << 32))
 #define IA32_PERF_GLOBAL_STATUS_RESET                                0x00000390
 typedef union {
   struct {
@@ -2816,6 +2873,7 @@ typedef union {
   uint64_t flags;
 } ia32_perf_global_status_reset_register;
 
+#define IA32_PERF_GLOBAL_STATUS_RESET_APPLY(_status, _)              ((_status) & ~(_))
 #define IA32_PERF_GLOBAL_STATUS_SET                                  0x00000391
 typedef union {
   struct {
@@ -2834,6 +2892,7 @@ typedef union {
   uint64_t flags;
 } ia32_perf_global_status_set_register;
 
+#define IA32_PERF_GLOBAL_STATUS_SET_APPLY(_status, _)                ((_status) | (_))
 #define IA32_PERF_GLOBAL_INUSE                                       0x00000392
 typedef union {
   struct {
@@ -3256,6 +3315,13 @@ typedef union {
 #define IA32_VMX_TRUE_PROCBASED_CTLS                                 0x0000048E
 #define IA32_VMX_TRUE_EXIT_CTLS                                      0x0000048F
 #define IA32_VMX_TRUE_ENTRY_CTLS                                     0x00000490
+#define IA32_VMX_TRUE_CTLS_OFFSET                                    0x0000000C
+#define IA32_VMX_CTLS_SELECT(_, _msr)                                ((_msr) + (((_) >> 55) & 0x01) * IA32_VMX_TRUE_CTLS_OFFSET)
+#define IA32_VMX_ADJUST_CTLS(_, _desired)                            (((_desired) | (_)) & ((_) >> 32))
+#define IA32_VMX_PINBASED_CTLS_DEFAULT1                              0x00000016
+#define IA32_VMX_PROCBASED_CTLS_DEFAULT1                             0x0401E172
+#define IA32_VMX_EXIT_CTLS_DEFAULT1                                  0x00036DFF
+#define IA32_VMX_ENTRY_CTLS_DEFAULT1                                 0x000011FF
 typedef union {
   struct {
     uint64_t allowed_0_settings                                      : 32;
@@ -3317,6 +3383,18 @@ typedef union {
 #define IA32_A_PMC5                                                  0x000004C6
 #define IA32_A_PMC6                                                  0x000004C7
 #define IA32_A_PMC7                                                  0x000004C8
+/**
+ * @defgroup ia32_a_pmc_encoding \
+ *           Full-width performance counter alias helpers
+ * @{
+ */
+#define IA32_A_PMC_MSR(_)                                            (0x4C1 + (_))
+#define IA32_A_PMC_INDEX(_msr)                                       ((_msr) - 0x4C1)
+#define IA32_A_PMC_IN_RANGE(_msr, _count)                            (((_msr) >= 0x4C1) & ((_msr) < 0x4C1 + (_count)))
+/**
+ * @}
+ */
+
 /**
  * @}
  */
@@ -3384,18 +3462,21 @@ typedef union {
     uint64_t cyc_thresh                                              : 4;
     uint64_t reserved_2                                              : 1;
     uint64_t psb_freq                                                : 4;
-    uint64_t reserved_3                                              : 4;
+    uint64_t reserved_3                                              : 3;
+    uint64_t event_en                                                : 1;
     uint64_t addr0_cfg                                               : 4;
     uint64_t addr1_cfg                                               : 4;
     uint64_t addr2_cfg                                               : 4;
     uint64_t addr3_cfg                                               : 4;
-    uint64_t reserved_4                                              : 8;
+    uint64_t reserved_4                                              : 7;
+    uint64_t dis_tnt                                                 : 1;
     uint64_t inject_psb_pmi_on_enable                                : 1;
   };
 
   uint64_t flags;
 } ia32_rtit_ctl_register;
 
+#define IA32_RTIT_CTL_SUPPORTED(_cpuid_ebx, _cpuid_ecx)              (0x2C0DULL | (((_cpuid_ebx) & 0x01) * 0x80ULL) | ((((_cpuid_ebx) >> 1) & 0x01) * 0xF780002ULL) | ((((_cpuid_ebx) >> 2) & 0x01) * 0xFFFF00000000ULL) | ((((_cpuid_ebx) >> 3) & 0x01) * 0x3C200ULL) | ((((_cpuid_ebx) >> 4) & 0x01) * 0x1020ULL) | ((((_cpuid_ebx) >> 5) & 0x01) * 0x10ULL) | ((((_cpuid_ebx) >> 6) & 0x01) * 0x100000000000000ULL) | ((((_cpuid_ebx) >> 7) & 0x01) * 0x80000000ULL) | ((((_cpuid_ebx) >> 8) & 0x01) * 0x80000000000000ULL) | (((_cpuid_ecx) & 0x01) * 0x100ULL) | ((((_cpuid_ecx) >> 3) & 0x01) * 0x40ULL))
 #define IA32_RTIT_STATUS                                             0x00000571
 typedef union {
   struct {
@@ -3586,6 +3667,19 @@ typedef union {
 #define IA32_X2APIC_PPR                                              0x0000080A
 #define IA32_X2APIC_EOI                                              0x0000080B
 #define IA32_X2APIC_LDR                                              0x0000080D
+typedef union {
+  struct {
+    uint64_t logical_id                                              : 16;
+#define IA32_X2APIC_LDR_LOGICAL_ID_FROM_APIC_ID(_)                   (1U << ((_) & 0x0F))
+    uint64_t cluster_id                                              : 16;
+#define IA32_X2APIC_LDR_CLUSTER_ID_FROM_APIC_ID(_)                   ((_) >> 4)
+#define IA32_X2APIC_LDR_CLUSTER_ID_SIZE                              0x00000010
+  };
+
+  uint64_t flags;
+} ia32_x2apic_ldr_register;
+
+#define IA32_X2APIC_LDR_FROM_APIC_ID(_)                              (((((_) >> 4) & 0xFFFFU) << 16) | (1U << ((_) & 0x0F)))
 #define IA32_X2APIC_SIVR                                             0x0000080F
 /**
  * @defgroup ia32_x2apic_isr \
@@ -3641,6 +3735,37 @@ typedef union {
 #define IA32_X2APIC_ESR                                              0x00000828
 #define IA32_X2APIC_LVT_CMCI                                         0x0000082F
 #define IA32_X2APIC_ICR                                              0x00000830
+typedef union {
+  struct {
+    uint64_t vector                                                  : 8;
+    uint64_t delivery_mode                                           : 3;
+#define IA32_X2APIC_ICR_DELIVERY_MODE_FIXED                          0x00000000
+#define IA32_X2APIC_ICR_DELIVERY_MODE_LOWEST_PRIORITY                0x00000001
+#define IA32_X2APIC_ICR_DELIVERY_MODE_SMI                            0x00000002
+#define IA32_X2APIC_ICR_DELIVERY_MODE_NMI                            0x00000004
+#define IA32_X2APIC_ICR_DELIVERY_MODE_INIT                           0x00000005
+#define IA32_X2APIC_ICR_DELIVERY_MODE_STARTUP                        0x00000006
+    uint64_t destination_mode                                        : 1;
+#define IA32_X2APIC_ICR_DESTINATION_MODE_PHYSICAL                    0x00000000
+#define IA32_X2APIC_ICR_DESTINATION_MODE_LOGICAL                     0x00000001
+    uint64_t reserved_1                                              : 2;
+    uint64_t level                                                   : 1;
+    uint64_t trigger_mode                                            : 1;
+    uint64_t reserved_2                                              : 2;
+    uint64_t destination_shorthand                                   : 2;
+#define IA32_X2APIC_ICR_DESTINATION_SHORTHAND_NONE                   0x00000000
+#define IA32_X2APIC_ICR_DESTINATION_SHORTHAND_SELF                   0x00000001
+#define IA32_X2APIC_ICR_DESTINATION_SHORTHAND_ALL_INCLUDING_SELF     0x00000002
+#define IA32_X2APIC_ICR_DESTINATION_SHORTHAND_ALL_EXCLUDING_SELF     0x00000003
+    uint64_t reserved_3                                              : 12;
+    uint64_t destination                                             : 32;
+#define IA32_X2APIC_ICR_DESTINATION_LOGICAL(_cluster, _logical_ids)  (((_cluster) << 16) | (_logical_ids))
+  };
+
+  uint64_t flags;
+} ia32_x2apic_icr_register;
+
+#define IA32_X2APIC_ICR_VALUE(_destination, _vector, _delivery_mode, _destination_mode) (((_destination) * 0x100000000ULL) | ((_delivery_mode) << 8) | ((_destination_mode) << 11) | 0x4000 | (_vector))
 #define IA32_X2APIC_LVT_TIMER                                        0x00000832
 #define IA32_X2APIC_LVT_THERMAL                                      0x00000833
 #define IA32_X2APIC_LVT_PMI                                          0x00000834
@@ -3730,6 +3855,14 @@ typedef union {
   struct {
     uint64_t reserved_1                                              : 8;
     uint64_t trace_packet_configuration_state                        : 1;
+    uint64_t reserved_2                                              : 1;
+    uint64_t pasid_state                                             : 1;
+    uint64_t cet_user_state                                          : 1;
+    uint64_t cet_supervisor_state                                    : 1;
+    uint64_t hdc_state                                               : 1;
+    uint64_t uintr_state                                             : 1;
+    uint64_t lbr_state                                               : 1;
+    uint64_t hwp_state                                               : 1;
   };
 
   uint64_t flags;
@@ -3904,12 +4037,12 @@ typedef union {
     uint64_t page_level_write_through                                : 1;
     uint64_t page_level_cache_disable                                : 1;
     uint64_t accessed                                                : 1;
-    uint64_t reserved_1                                              : 1;
+    uint64_t ignored_0                                               : 1;
     uint64_t must_be_zero                                            : 1;
     uint64_t ignored_1                                               : 3;
     uint64_t restart                                                 : 1;
     uint64_t page_frame_number                                       : 36;
-    uint64_t reserved_2                                              : 4;
+    uint64_t reserved_1                                              : 4;
     uint64_t ignored_2                                               : 11;
     uint64_t execute_disable                                         : 1;
   };
@@ -3950,12 +4083,12 @@ typedef union {
     uint64_t page_level_write_through                                : 1;
     uint64_t page_level_cache_disable                                : 1;
     uint64_t accessed                                                : 1;
-    uint64_t reserved_1                                              : 1;
+    uint64_t ignored_0                                               : 1;
     uint64_t large_page                                              : 1;
     uint64_t ignored_1                                               : 3;
     uint64_t restart                                                 : 1;
     uint64_t page_frame_number                                       : 36;
-    uint64_t reserved_2                                              : 4;
+    uint64_t reserved_1                                              : 4;
     uint64_t ignored_2                                               : 11;
     uint64_t execute_disable                                         : 1;
   };
@@ -3996,12 +4129,12 @@ typedef union {
     uint64_t page_level_write_through                                : 1;
     uint64_t page_level_cache_disable                                : 1;
     uint64_t accessed                                                : 1;
-    uint64_t reserved_1                                              : 1;
+    uint64_t ignored_0                                               : 1;
     uint64_t large_page                                              : 1;
     uint64_t ignored_1                                               : 3;
     uint64_t restart                                                 : 1;
     uint64_t page_frame_number                                       : 36;
-    uint64_t reserved_2                                              : 4;
+    uint64_t reserved_1                                              : 4;
     uint64_t ignored_2                                               : 11;
     uint64_t execute_disable                                         : 1;
   };
@@ -4093,6 +4226,17 @@ typedef union {
   uint64_t flags;
 } invpcid_descriptor;
 
+/**
+ * @defgroup pcid \
+ *           Process-context identifier limits
+ * @{
+ */
+#define PCID_MAX                                                     0x00000FFF
+#define PCID_NO_FLUSH                                                0x8000000000000000
+/**
+ * @}
+ */
+
 /**
  * @defgroup segment_descriptors \
  *           Segment descriptors
@@ -4200,6 +4344,25 @@ typedef struct {
 
 #define SEGMENT_DESCRIPTOR_TYPE_SYSTEM                               0x00000000
 #define SEGMENT_DESCRIPTOR_TYPE_CODE_OR_DATA                         0x00000001
+/**
+ * @defgroup segment_descriptor_encoding \
+ *           Segment descriptor encoding and decoding
+ * @{
+ */
+#define SEGMENT_DESCRIPTOR_ENCODE(_base, _limit, _access_rights)     (((_limit) & 0xFFFFULL) | (((_base) & 0xFFFFFFULL) << 16) | (((_access_rights) & 0xF0FF00ULL) << 32) | (((_limit) & 0xF0000ULL) << 32) | (((_base) & 0xFF000000ULL) << 32))
+#define SEGMENT_DESCRIPTOR_DECODE_BASE(_)                            ((((_) >> 16) & 0xFFFFFF) | (((_) >> 32) & 0xFF000000))
+#define SEGMENT_DESCRIPTOR_DECODE_LIMIT(_)                           (((_) & 0xFFFF) | (((_) >> 32) & 0xF0000))
+#define SEGMENT_DESCRIPTOR_DECODE_LIMIT_BYTES(_)                     (((((_) & 0xFFFF) | (((_) >> 32) & 0xF0000)) << ((((_) >> 55) & 0x01) * 12)) | ((((_) >> 55) & 0x01) * 0xFFF))
+#define SEGMENT_DESCRIPTOR_DECODE_ACCESS_RIGHTS(_)                   (((_) >> 32) & 0xF0FF00)
+#define SEGMENT_DESCRIPTOR_DECODE_VMX_ACCESS_RIGHTS(_)               (((_) >> 40) & 0xF0FF)
+#define SEGMENT_INTERRUPT_GATE_ENCODE(_offset, _selector, _ist, _type, _dpl) (((_offset) & 0xFFFFULL) | (((_selector) & 0xFFFFULL) << 16) | (((_ist) & 0x07ULL) << 32) | (((_type) & 0x0FULL) << 40) | (((_dpl) & 0x03ULL) << 45) | 0x800000000000ULL | (((_offset) & 0xFFFF0000ULL) << 32))
+#define SEGMENT_INTERRUPT_GATE_ENCODE_UPPER(_offset)                 ((_offset) >> 32)
+#define SEGMENT_INTERRUPT_GATE_DECODE_OFFSET(_, _upper)              (((_) & 0xFFFF) | (((_) >> 32) & 0xFFFF0000) | ((_upper) << 32))
+#define SEGMENT_SELECTOR_DESCRIPTOR_OFFSET(_)                        ((_) & 0xFFF8)
+/**
+ * @}
+ */
+
 /**
  * @defgroup segment_descriptor_code_and_data_type \
  *           Code- and Data-Segment Descriptor Types
@@ -4493,6 +4656,7 @@ typedef union {
 #define VMX_EXIT_QUALIFICATION_GENREG_R13                            0x0000000D
 #define VMX_EXIT_QUALIFICATION_GENREG_R14                            0x0000000E
 #define VMX_EXIT_QUALIFICATION_GENREG_R15                            0x0000000F
+#define VMX_EXIT_QUALIFICATION_GENREG_OFFSET(_)                      ((((_) >> 8) & 0x0F) << 3)
     uint64_t reserved_2                                              : 4;
     uint64_t lmsw_source_data                                        : 16;
   };
@@ -4526,6 +4690,7 @@ typedef union {
 #define VMX_EXIT_QUALIFICATION_WIDTH_1B                              0x00000000
 #define VMX_EXIT_QUALIFICATION_WIDTH_2B                              0x00000001
 #define VMX_EXIT_QUALIFICATION_WIDTH_4B                              0x00000003
+#define VMX_EXIT_QUALIFICATION_WIDTH_BYTES(_)                        (((_) & 0x07) + 1)
     uint64_t direction_of_access                                     : 1;
 #define VMX_EXIT_QUALIFICATION_DIRECTION_OUT                         0x00000000
 #define VMX_EXIT_QUALIFICATION_DIRECTION_IN                          0x00000001
@@ -4584,6 +4749,22 @@ typedef union {
   uint64_t flags;
 } vmx_exit_qualification_ept_violation;
 
+#define VMX_EXIT_QUALIFICATION_EPT_VIOLATION_INDEX_COUNT             0x00000100
+#define VMX_EXIT_QUALIFICATION_EPT_VIOLATION_INDEX(_)                (((_) & (0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20)) | (((_) & (0x80 | 0x100)) >> 1))
+#define VMX_EXIT_QUALIFICATION_EPT_VIOLATION_DENIED(_)               ((_) & ~((_) >> 3) & (0x01 | 0x02 | 0x04))
+/**
+ * @defgroup vmx_exit_qualification_entry_failure \
+ *           Exit Qualification for VM-Entry Failures During or After Loading Guest State
+ * @{
+ */
+#define VMX_EXIT_QUALIFICATION_ENTRY_FAILURE_NOT_USED                0x00000000
+#define VMX_EXIT_QUALIFICATION_ENTRY_FAILURE_PDPTE_LOAD              0x00000002
+#define VMX_EXIT_QUALIFICATION_ENTRY_FAILURE_NMI_INJECTION           0x00000003
+#define VMX_EXIT_QUALIFICATION_ENTRY_FAILURE_INVALID_VMCS_LINK_POINTER 0x00000004
+/**
+ * @}
+ */
+
 /**
  * @}
  */
@@ -4705,6 +4886,13 @@ typedef union {
   uint64_t flags;
 } vmx_vmexit_instruction_info_vmread_vmwrite;
 
+#define VMX_VMEXIT_INSTRUCTION_INFO_SCALE(_)                         (1 << ((_) & 0x03))
+#define VMX_VMEXIT_INSTRUCTION_INFO_ADDRESS_SIZE_BYTES(_)            (2 << (((_) >> 7) & 0x07))
+#define VMX_VMEXIT_INSTRUCTION_INFO_ADDRESS_MASK(_)                  (0xFFFFFFFFFFFFFFFF >> (64 - (16 << (((_) >> 7) & 0x07))))
+#define VMX_VMEXIT_INSTRUCTION_INFO_INDEX_VALUE(_, _gpr)             ((_gpr)[((_) >> 18) & 0x0F] * ((((_) >> 22) & 0x01) ^ 0x01))
+#define VMX_VMEXIT_INSTRUCTION_INFO_BASE_VALUE(_, _gpr)              ((_gpr)[((_) >> 23) & 0x0F] * ((((_) >> 27) & 0x01) ^ 0x01))
+#define VMX_VMEXIT_INSTRUCTION_INFO_EFFECTIVE_ADDRESS(_, _displacement, _gpr) ((VMX_VMEXIT_INSTRUCTION_INFO_BASE_VALUE(_, _gpr) + (VMX_VMEXIT_INSTRUCTION_INFO_INDEX_VALUE(_, _gpr) << ((_) & 0x03)) + (_displacement)) & VMX_VMEXIT_INSTRUCTION_INFO_ADDRESS_MASK(_))
+#define VMX_VMEXIT_INSTRUCTION_INFO_LINEAR_ADDRESS(_, _displacement, _gpr, _segment_base) ((_segment_base)[((_) >> 15) & 0x07] + VMX_VMEXIT_INSTRUCTION_INFO_EFFECTIVE_ADDRESS(_, _displacement, _gpr))
 /**
  * @}
  */
@@ -4726,6 +4914,18 @@ typedef union {
   uint32_t flags;
 } vmx_segment_access_rights;
 
+/**
+ * @defgroup vmx_segment_state \
+ *           Decoding of guest segment state held in the guest-state area
+ * @{
+ */
+#define VMX_SEGMENT_CODE_SIZE(_)                                     (16 << (((((_) >> 13) & 0x01) << 1) | (((_) >> 14) & ~((_) >> 13) & 0x01)))
+#define VMX_SEGMENT_CPL(_)                                           (((_) >> 5) & 0x03)
+#define VMX_SEGMENT_USABLE(_)                                        ((((_) >> 16) & 0x01) ^ 0x01)
+/**
+ * @}
+ */
+
 typedef union {
   struct {
     uint32_t blocking_by_sti                                         : 1;
@@ -4762,6 +4962,22 @@ typedef union {
   uint64_t flags;
 } vmx_pending_debug_exceptions;
 
+/**
+ * @defgroup vmx_guest_state_checks \
+ *           Checks of the guest-state area performed by VM entry. Each check evaluates to 1 if the field passes it, so
+ *                     that results of all checks can be combined into a bitmap without branches
+ * @{
+ */
+#define VMX_GUEST_STATE_CR_VALID(_, _fixed0, _fixed1)                ((((_) | (_fixed0)) & (_fixed1)) == (_))
+#define VMX_GUEST_STATE_RFLAGS_VALID(_)                              ((((_) & 0xFFFFFFFFFFC08028) == 0) & (((_) & 0x02) != 0))
+#define VMX_GUEST_STATE_SEGMENT_ACCESS_RIGHTS_VALID(_)               ((((_) & 0x10000) != 0) | (((_) & 0xFFFE0F00) == 0))
+#define VMX_GUEST_STATE_INTERRUPTIBILITY_STATE_VALID(_)              ((((_) & 0xFFFFFFE0) == 0) & (((_) & (0x01 | 0x02)) != (0x01 | 0x02)))
+#define VMX_GUEST_STATE_ACTIVITY_STATE_VALID(_)                      ((_) <= 3)
+#define VMX_GUEST_STATE_PENDING_DEBUG_EXCEPTIONS_VALID(_)            (((_) & 0xFFFFFFFFFFFEAFF0) == 0)
+/**
+ * @}
+ */
+
 /**
  * @}
  */
@@ -4827,10 +5043,12 @@ typedef union {
     uint64_t execute_access                                          : 1;
     uint64_t reserved_1                                              : 5;
     uint64_t accessed                                                : 1;
-    uint64_t reserved_2                                              : 1;
+    uint64_t ignored_1                                               : 1;
     uint64_t user_mode_execute                                       : 1;
-    uint64_t reserved_3                                              : 1;
+    uint64_t ignored_2                                               : 1;
     uint64_t page_frame_number                                       : 36;
+    uint64_t reserved_2                                              : 4;
+    uint64_t ignored_3                                               : 12;
   };
 
   uint64_t flags;
@@ -4847,14 +5065,16 @@ typedef union {
     uint64_t accessed                                                : 1;
     uint64_t dirty                                                   : 1;
     uint64_t user_mode_execute                                       : 1;
-    uint64_t reserved_1                                              : 19;
+    uint64_t ignored_1                                               : 1;
+    uint64_t reserved_1                                              : 18;
     uint64_t page_frame_number                                       : 18;
-    uint64_t reserved_2                                              : 9;
+    uint64_t reserved_2                                              : 4;
+    uint64_t ignored_2                                               : 5;
     uint64_t verify_guest_paging                                     : 1;
     uint64_t paging_write_access                                     : 1;
-    uint64_t reserved_3                                              : 1;
+    uint64_t ignored_3                                               : 1;
     uint64_t supervisor_shadow_stack                                 : 1;
-    uint64_t reserved_4                                              : 2;
+    uint64_t ignored_4                                               : 2;
     uint64_t suppress_ve                                             : 1;
   };
 
@@ -4868,10 +5088,12 @@ typedef union {
     uint64_t execute_access                                          : 1;
     uint64_t reserved_1                                              : 5;
     uint64_t accessed                                                : 1;
-    uint64_t reserved_2                                              : 1;
+    uint64_t ignored_1                                               : 1;
     uint64_t user_mode_execute                                       : 1;
-    uint64_t reserved_3                                              : 1;
+    uint64_t ignored_2                                               : 1;
     uint64_t page_frame_number                                       : 36;
+    uint64_t reserved_2                                              : 4;
+    uint64_t ignored_3                                               : 12;
   };
 
   uint64_t flags;
@@ -4888,14 +5110,16 @@ typedef union {
     uint64_t accessed                                                : 1;
     uint64_t dirty                                                   : 1;
     uint64_t user_mode_execute                                       : 1;
-    uint64_t reserved_1                                              : 10;
+    uint64_t ignored_1                                               : 1;
+    uint64_t reserved_1                                              : 9;
     uint64_t page_frame_number                                       : 27;
-    uint64_t reserved_2                                              : 9;
+    uint64_t reserved_2                                              : 4;
+    uint64_t ignored_2                                               : 5;
     uint64_t verify_guest_paging                                     : 1;
     uint64_t paging_write_access                                     : 1;
-    uint64_t reserved_3                                              : 1;
+    uint64_t ignored_3                                               : 1;
     uint64_t supervisor_shadow_stack                                 : 1;
-    uint64_t reserved_4                                              : 2;
+    uint64_t ignored_4                                               : 2;
     uint64_t suppress_ve                                             : 1;
   };
 
@@ -4909,10 +5133,12 @@ typedef union {
     uint64_t execute_access                                          : 1;
     uint64_t reserved_1                                              : 5;
     uint64_t accessed                                                : 1;
-    uint64_t reserved_2                                              : 1;
+    uint64_t ignored_1                                               : 1;
     uint64_t user_mode_execute                                       : 1;
-    uint64_t reserved_3                                              : 1;
+    uint64_t ignored_2                                               : 1;
     uint64_t page_frame_number                                       : 36;
+    uint64_t reserved_2                                              : 4;
+    uint64_t ignored_3                                               : 12;
   };
 
   uint64_t flags;
@@ -4925,19 +5151,20 @@ typedef union {
     uint64_t execute_access                                          : 1;
     uint64_t memory_type                                             : 3;
     uint64_t ignore_pat                                              : 1;
-    uint64_t reserved_1                                              : 1;
+    uint64_t ignored_1                                               : 1;
     uint64_t accessed                                                : 1;
     uint64_t dirty                                                   : 1;
     uint64_t user_mode_execute                                       : 1;
-    uint64_t reserved_2                                              : 1;
+    uint64_t ignored_2                                               : 1;
     uint64_t page_frame_number                                       : 36;
-    uint64_t reserved_3                                              : 9;
+    uint64_t reserved_1                                              : 4;
+    uint64_t ignored_3                                               : 5;
     uint64_t verify_guest_paging                                     : 1;
     uint64_t paging_write_access                                     : 1;
-    uint64_t reserved_4                                              : 1;
+    uint64_t ignored_4                                               : 1;
     uint64_t supervisor_shadow_stack                                 : 1;
     uint64_t sub_page_write_permissions                              : 1;
-    uint64_t reserved_5                                              : 1;
+    uint64_t ignored_5                                               : 1;
     uint64_t suppress_ve                                             : 1;
   };
 
@@ -4955,9 +5182,10 @@ typedef union {
     uint64_t accessed                                                : 1;
     uint64_t dirty                                                   : 1;
     uint64_t user_mode_execute                                       : 1;
-    uint64_t reserved_1                                              : 1;
+    uint64_t ignored_1                                               : 1;
     uint64_t page_frame_number                                       : 36;
-    uint64_t reserved_2                                              : 15;
+    uint64_t reserved_1                                              : 4;
+    uint64_t ignored_2                                               : 11;
     uint64_t suppress_ve                                             : 1;
   };
 
@@ -4990,6 +5218,40 @@ typedef union {
  * @}
  */
 
+/**
+ * @defgroup ept_permission \
+ *           EPT permission masks
+ * @{
+ */
+#define EPT_PERMISSION_READ                                          0x00000001
+#define EPT_PERMISSION_WRITE                                         0x00000002
+#define EPT_PERMISSION_EXECUTE                                       0x00000004
+#define EPT_PERMISSION_USER_MODE_EXECUTE                             0x00000400
+#define EPT_PERMISSION_READ_WRITE_EXECUTE                            0x00000007
+#define EPT_PERMISSION_ALL                                           0x00000407
+#define EPT_PERMISSION_UPDATE(_, _and, _or)                          (((_) & (_and)) | (_or))
+#define EPT_PERMISSION_CHANGED(_, _and, _or)                         ((((_) & (_and)) | (_or)) ^ (_))
+/**
+ * @}
+ */
+
+/**
+ * @defgroup page_modification_log \
+ *           Page-Modification Logging
+ * @{
+ */
+#define PML_ENTRY_COUNT                                              0x00000200
+#define PML_INDEX_INITIAL                                            0x000001FF
+#define PML_ENTRY_ADDRESS_MASK                                       0xFFFFFFFFFFFFF000
+#define PML_FIRST_ENTRY(_)                                           (((_) + 1) & 0xFFFF)
+#define PML_ENTRY_USED_COUNT(_)                                      ((0x01FF - (_)) & 0xFFFF)
+#define PML_BITMAP_INDEX(_)                                          ((_) >> 18)
+#define PML_BITMAP_BIT(_)                                            (1ULL << (((_) >> 12) & 0x3F))
+#define PML_ACCESSED_DIRTY_MASK                                      0x00000300
+/**
+ * @}
+ */
+
 /**
  * @}
  */
@@ -5018,6 +5280,29 @@ typedef struct {
   uint64_t linear_address;
 } invvpid_descriptor;
 
+/**
+ * @defgroup vpid \
+ *           Virtual-processor identifier limits
+ * @{
+ */
+#define VPID_HOST                                                    0x00000000
+#define VPID_MIN                                                     0x00000001
+#define VPID_MAX                                                     0x0000FFFF
+/**
+ * @}
+ */
+
+/**
+ * @defgroup invalidation_type_support \
+ *           Supported invalidation types
+ * @{
+ */
+#define INVEPT_TYPE_SUPPORTED(_, _type)                              (((_) >> (24 + (_type))) & 0x01)
+#define INVVPID_TYPE_SUPPORTED(_, _type)                             (((_) >> (40 + (_type))) & 0x01)
+/**
+ * @}
+ */
+
 typedef union {
   struct {
     uint64_t reserved_1                                              : 3;
@@ -5417,6 +5702,30 @@ typedef union {
  * @}
  */
 
+/**
+ * @defgroup vmcs_guest_segment \
+ *           Encodings of guest segment register fields indexed by segment register
+ * @{
+ */
+#define VMCS_GUEST_SEGMENT_ES                                        0x00000000
+#define VMCS_GUEST_SEGMENT_CS                                        0x00000001
+#define VMCS_GUEST_SEGMENT_SS                                        0x00000002
+#define VMCS_GUEST_SEGMENT_DS                                        0x00000003
+#define VMCS_GUEST_SEGMENT_FS                                        0x00000004
+#define VMCS_GUEST_SEGMENT_GS                                        0x00000005
+#define VMCS_GUEST_SEGMENT_LDTR                                      0x00000006
+#define VMCS_GUEST_SEGMENT_TR                                        0x00000007
+#define VMCS_GUEST_SEGMENT_COUNT                                     0x00000008
+#define VMCS_GUEST_SEGMENT_SELECTOR(_)                               (0x0800 + ((_) << 1))
+#define VMCS_GUEST_SEGMENT_LIMIT(_)                                  (0x4800 + ((_) << 1))
+#define VMCS_GUEST_SEGMENT_ACCESS_RIGHTS(_)                          (0x4814 + ((_) << 1))
+#define VMCS_GUEST_SEGMENT_BASE(_)                                   (0x6806 + ((_) << 1))
+#define VMCS_GUEST_SEGMENT_FLAG(_)                                   (1 << (_))
+#define VMCS_GUEST_SEGMENT_ALL_FLAGS                                 0x000000FF
+/**
+ * @}
+ */
+
 /**
  * @}
  */
@@ -5443,6 +5752,17 @@ typedef union {
   uint32_t flags;
 } vmentry_interrupt_info;
 
+/**
+ * @defgroup vmentry_interrupt_information_encoding \
+ *           Encoding of the VM-entry interruption-information field
+ * @{
+ */
+#define VMENTRY_INTERRUPT_INFORMATION_ENCODE(_vector, _type, _deliver_error_code) (((_vector) & 0xFF) | (((_type) & 0x07) << 8) | (((_deliver_error_code) & 0x01) << 11) | 0x80000000)
+#define VMENTRY_INTERRUPT_INFORMATION_FROM_VECTOR(_)                 VMENTRY_INTERRUPT_INFORMATION_ENCODE(_, EXCEPTION_VECTOR_INTERRUPTION_TYPE(_), EXCEPTION_VECTOR_HAS_ERROR_CODE(_))
+/**
+ * @}
+ */
+
 typedef union {
   struct {
     uint32_t vector                                                  : 8;
@@ -5456,6 +5776,17 @@ typedef union {
   uint32_t flags;
 } vmexit_interrupt_info;
 
+/**
+ * @defgroup vmexit_interrupt_information_merging \
+ *           Merging of events whose delivery caused a VM exit with a new exception
+ * @{
+ */
+#define VMEXIT_INTERRUPT_INFORMATION_EXCEPTION_VECTOR(_)             ((((_) & 0x80000700) == 0x80000300) ? ((_) & 0xFF) : 0x100)
+#define VMEXIT_INTERRUPT_INFORMATION_MERGE(_, _vector)               (EXCEPTION_VECTOR_MERGE(VMEXIT_INTERRUPT_INFORMATION_EXCEPTION_VECTOR(_), _vector) == EXCEPTION_VECTOR_MERGE_DOUBLE_FAULT ? VMENTRY_INTERRUPT_INFORMATION_ENCODE(8, 3, 1) : EXCEPTION_VECTOR_MERGE(VMEXIT_INTERRUPT_INFORMATION_EXCEPTION_VECTOR(_), _vector) == EXCEPTION_VECTOR_MERGE_TRIPLE_FAULT ? 0 : VMENTRY_INTERRUPT_INFORMATION_FROM_VECTOR(_vector))
+/**
+ * @}
+ */
+
 /**
  * @}
  */
@@ -5513,6 +5844,13 @@ typedef union {
 #define APIC_INITIAL_COUNT                                           0x00000380
 #define APIC_CURRENT_COUNT                                           0x00000390
 #define APIC_DIVIDE_CONFIGURATION                                    0x000003E0
+#define APIC_REGISTER_STRIDE                                         0x00000010
+#define APIC_VECTOR_REGISTER_OFFSET(_, _vector)                      ((_) + (((_vector) >> 5) << 4))
+#define APIC_VECTOR_BIT(_vector)                                     (1U << ((_vector) & 0x1F))
+#define APIC_VECTOR(_register, _bit)                                 (((_register) << 5) | (_bit))
+#define APIC_PRIORITY_CLASS(_)                                       (((_) >> 4) & 0x0F)
+#define APIC_PPR_VALUE(_tpr, _isrv)                                  ((((_tpr) & 0xFF) * (((_tpr) & 0xF0) >= ((_isrv) & 0xF0))) | (((_isrv) & 0xF0) * (((_tpr) & 0xF0) < ((_isrv) & 0xF0))))
+#define APIC_INTERRUPT_ACCEPTED(_vector, _ppr)                       (((_vector) & 0xF0) > ((_ppr) & 0xF0))
 /**
  * @}
  */
@@ -5611,6 +5949,30 @@ typedef enum {
   control_protection                                           = 0x00000015,
 } exception_vector;
 
+/**
+ * @defgroup exception_vector_properties \
+ *           Properties of exception vectors needed for event delivery and injection
+ * @{
+ */
+#define EXCEPTION_VECTOR_ERROR_CODE_MASK                             0x00227D00
+#define EXCEPTION_VECTOR_CONTRIBUTORY_MASK                           0x00203C01
+#define EXCEPTION_VECTOR_PAGE_FAULT_MASK                             0x00104000
+#define EXCEPTION_VECTOR_SOFTWARE_EXCEPTION_MASK                     0x00000018
+#define EXCEPTION_VECTOR_CLASS_BENIGN                                0x00000000
+#define EXCEPTION_VECTOR_CLASS_CONTRIBUTORY                          0x00000001
+#define EXCEPTION_VECTOR_CLASS_PAGE_FAULT                            0x00000002
+#define EXCEPTION_VECTOR_HAS_ERROR_CODE(_)                           (((EXCEPTION_VECTOR_ERROR_CODE_MASK >> ((_) & 0x1F)) & 0x01) & ((_) < 32))
+#define EXCEPTION_VECTOR_CLASS(_)                                    (((((EXCEPTION_VECTOR_CONTRIBUTORY_MASK >> ((_) & 0x1F)) & 0x01) | (((EXCEPTION_VECTOR_PAGE_FAULT_MASK >> ((_) & 0x1F)) & 0x01) << 1))) * ((_) < 32))
+#define EXCEPTION_VECTOR_INTERRUPTION_TYPE(_)                        ((3 ^ ((_) == 2) ^ (((EXCEPTION_VECTOR_SOFTWARE_EXCEPTION_MASK >> ((_) & 0x1F)) & 0x01) * 5)) * ((_) < 32))
+#define EXCEPTION_VECTOR_MERGE_TABLE                                 0x00000190
+#define EXCEPTION_VECTOR_MERGE_SERIAL                                0x00000000
+#define EXCEPTION_VECTOR_MERGE_DOUBLE_FAULT                          0x00000001
+#define EXCEPTION_VECTOR_MERGE_TRIPLE_FAULT                          0x00000002
+#define EXCEPTION_VECTOR_MERGE(_first, _second)                      (((EXCEPTION_VECTOR_MERGE_TABLE >> (EXCEPTION_VECTOR_CLASS(_first) * 3 + EXCEPTION_VECTOR_CLASS(_second))) & 0x01) | ((((_first) == 8) & (EXCEPTION_VECTOR_CLASS(_second) != 0)) << 1))
+/**
+ * @}
+ */
+
 typedef union {
   struct {
     uint32_t external_event                                          : 1;
@@ -5659,6 +6021,61 @@ typedef union {
  * @}
  */
 
+/**
+ * @defgroup intel_pt \
+ *           Intel Processor Trace
+ * @{
+ */
+typedef union {
+  struct {
+    uint64_t end                                                     : 1;
+    uint64_t reserved_1                                              : 1;
+    uint64_t interrupt                                               : 1;
+    uint64_t reserved_2                                              : 1;
+    uint64_t stop                                                    : 1;
+    uint64_t reserved_3                                              : 1;
+    uint64_t size                                                    : 4;
+#define TOPA_ENTRY_SIZE_4K                                           0x00000000
+#define TOPA_ENTRY_SIZE_8K                                           0x00000001
+#define TOPA_ENTRY_SIZE_16K                                          0x00000002
+#define TOPA_ENTRY_SIZE_32K                                          0x00000003
+#define TOPA_ENTRY_SIZE_64K                                          0x00000004
+#define TOPA_ENTRY_SIZE_128K                                         0x00000005
+#define TOPA_ENTRY_SIZE_256K                                         0x00000006
+#define TOPA_ENTRY_SIZE_512K                                         0x00000007
+#define TOPA_ENTRY_SIZE_1M                                           0x00000008
+#define TOPA_ENTRY_SIZE_2M                                           0x00000009
+#define TOPA_ENTRY_SIZE_4M                                           0x0000000A
+#define TOPA_ENTRY_SIZE_8M                                           0x0000000B
+#define TOPA_ENTRY_SIZE_16M                                          0x0000000C
+#define TOPA_ENTRY_SIZE_32M                                          0x0000000D
+#define TOPA_ENTRY_SIZE_64M                                          0x0000000E
+#define TOPA_ENTRY_SIZE_128M                                         0x0000000F
+#define TOPA_ENTRY_SIZE_BYTES(_)                                     (4096ULL << (_))
+    uint64_t reserved_4                                              : 2;
+    uint64_t output_region_base_physical_address                     : 36;
+  };
+
+  uint64_t flags;
+} topa_entry;
+
+/**
+ * @defgroup topa_encoding \
+ *           ToPA table construction
+ * @{
+ */
+#define TOPA_ENTRY_COUNT                                             0x00000200
+#define TOPA_ENTRY_ENCODE(_address, _size, _flags)                   (((_address) & 0xFFFFFFFFFF000ULL) | (((_size) & 0x0FULL) << 6) | (_flags))
+#define TOPA_ENTRY_ENCODE_END(_)                                     (((_) & 0xFFFFFFFFFF000ULL) | 0x01)
+#define TOPA_OUTPUT_MASK_PTRS(_entry_index, _output_offset)          ((((_entry_index) & 0x1FFFFFFULL) << 7) | 0x7F | (((_output_offset) & 0xFFFFFFFFULL) << 32))
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
 /**
  * @defgroup vtd \
  *           VTD
@@ -5718,6 +6135,40 @@ typedef struct {
  */
 #define VTD_ROOT_ENTRY_COUNT                                         0x00000100
 #define VTD_CONTEXT_ENTRY_COUNT                                      0x00000100
+#define VTD_SECOND_LEVEL_ENTRY_COUNT                                 0x00000200
+/**
+ * @}
+ */
+
+typedef union {
+  struct {
+    uint64_t read                                                    : 1;
+    uint64_t write                                                   : 1;
+    uint64_t execute                                                 : 1;
+    uint64_t extended_memory_type                                    : 3;
+    uint64_t ignore_pat                                              : 1;
+    uint64_t page_size                                               : 1;
+    uint64_t accessed                                                : 1;
+    uint64_t dirty                                                   : 1;
+    uint64_t ignored_1                                               : 1;
+    uint64_t snoop                                                   : 1;
+    uint64_t address                                                 : 40;
+    uint64_t ignored_2                                               : 11;
+    uint64_t ignored_3                                               : 1;
+  };
+
+  uint64_t flags;
+} vtd_second_level_paging_entry;
+
+/**
+ * @defgroup vtd_second_level_paging \
+ *           Second-level paging helpers
+ * @{
+ */
+#define VTD_SECOND_LEVEL_LEVELS(_)                                   ((_) + 2)
+#define VTD_SECOND_LEVEL_ADDRESS_WIDTH(_)                            (30 + 9 * (_))
+#define VTD_SECOND_LEVEL_INDEX(_iova, _level)                        (((_iova) >> (3 + 9 * (_level))) & 0x1FF)
+#define VTD_SECOND_LEVEL_LARGE_PAGE_SUPPORTED(_, _level)             (((_) >> (32 + (_level))) & 0x01)
 /**
  * @}
  */
@@ -5871,6 +6322,47 @@ typedef union {
   uint64_t flags;
 } vtd_context_command_register;
 
+#define VTD_INVALIDATION_QUEUE_HEAD                                  0x00000080
+typedef union {
+  struct {
+    uint64_t reserved_1                                              : 4;
+    uint64_t queue_head                                              : 15;
+  };
+
+  uint64_t flags;
+} vtd_invalidation_queue_head_register;
+
+#define VTD_INVALIDATION_QUEUE_TAIL                                  0x00000088
+typedef union {
+  struct {
+    uint64_t reserved_1                                              : 4;
+    uint64_t queue_tail                                              : 15;
+  };
+
+  uint64_t flags;
+} vtd_invalidation_queue_tail_register;
+
+#define VTD_INVALIDATION_QUEUE_ADDRESS                               0x00000090
+typedef union {
+  struct {
+    uint64_t queue_size                                              : 3;
+    uint64_t reserved_1                                              : 8;
+    uint64_t descriptor_width                                        : 1;
+    uint64_t invalidation_queue_base_address                         : 52;
+  };
+
+  uint64_t flags;
+} vtd_invalidation_queue_address_register;
+
+#define VTD_INVALIDATION_COMPLETION_STATUS                           0x0000009C
+typedef union {
+  struct {
+    uint32_t invalidation_wait_descriptor_complete                   : 1;
+  };
+
+  uint32_t flags;
+} vtd_invalidation_completion_status_register;
+
 #define VTD_INVALIDATE_ADDRESS                                       0x00000000
 typedef union {
   struct {
@@ -5901,6 +6393,120 @@ typedef union {
   uint64_t flags;
 } vtd_iotlb_invalidate_register;
 
+/**
+ * @defgroup vtd_invalidation_descriptor_type \
+ *           Invalidation descriptor types
+ * @{
+ */
+#define VTD_INVALIDATION_DESCRIPTOR_CONTEXT_CACHE                    0x00000001
+#define VTD_INVALIDATION_DESCRIPTOR_IOTLB                            0x00000002
+#define VTD_INVALIDATION_DESCRIPTOR_DEVICE_TLB                       0x00000003
+#define VTD_INVALIDATION_DESCRIPTOR_WAIT                             0x00000005
+#define VTD_INVALIDATION_DESCRIPTOR_SIZE                             0x00000010
+#define VTD_INVALIDATION_DESCRIPTOR_COUNT(_)                         (0x100 << (_))
+#define VTD_INVALIDATION_DESCRIPTOR_NEXT(_, _qs)                     (((_) + 0x10) & ((0x1000 << (_qs)) - 1))
+/**
+ * @}
+ */
+
+typedef struct {
+  union {
+    struct {
+      uint64_t type                                                  : 4;
+      uint64_t granularity                                           : 2;
+      uint64_t reserved_1                                            : 10;
+      uint64_t domain_id                                             : 16;
+      uint64_t source_id                                             : 16;
+      uint64_t function_mask                                         : 2;
+    };
+
+    uint64_t flags;
+  } lower64;
+
+  uint64_t reserved;
+} vtd_context_cache_invalidate_descriptor;
+
+typedef struct {
+  union {
+    struct {
+      uint64_t type                                                  : 4;
+      uint64_t granularity                                           : 2;
+      uint64_t drain_writes                                          : 1;
+      uint64_t drain_reads                                           : 1;
+      uint64_t reserved_1                                            : 8;
+      uint64_t domain_id                                             : 16;
+    };
+
+    uint64_t flags;
+  } lower64;
+
+  union {
+    struct {
+      uint64_t address_mask                                          : 6;
+      uint64_t invalidation_hint                                     : 1;
+      uint64_t reserved_1                                            : 5;
+      uint64_t page_address                                          : 52;
+    };
+
+    uint64_t flags;
+  } upper64;
+
+} vtd_iotlb_invalidate_descriptor;
+
+typedef struct {
+  union {
+    struct {
+      uint64_t type                                                  : 4;
+      uint64_t reserved_1                                            : 8;
+      uint64_t physical_function_source_id_low                       : 4;
+      uint64_t max_invalidations_pending                             : 5;
+      uint64_t reserved_2                                            : 11;
+      uint64_t source_id                                             : 16;
+      uint64_t reserved_3                                            : 4;
+      uint64_t physical_function_source_id_high                      : 12;
+    };
+
+    uint64_t flags;
+  } lower64;
+
+  union {
+    struct {
+      uint64_t size                                                  : 1;
+      uint64_t reserved_1                                            : 11;
+      uint64_t page_address                                          : 52;
+    };
+
+    uint64_t flags;
+  } upper64;
+
+} vtd_device_tlb_invalidate_descriptor;
+
+typedef struct {
+  union {
+    struct {
+      uint64_t type                                                  : 4;
+      uint64_t interrupt_flag                                        : 1;
+      uint64_t status_write                                          : 1;
+      uint64_t fence                                                 : 1;
+      uint64_t page_request_drain                                    : 1;
+      uint64_t reserved_1                                            : 24;
+      uint64_t status_data                                           : 32;
+    };
+
+    uint64_t flags;
+  } lower64;
+
+  union {
+    struct {
+      uint64_t reserved_1                                            : 2;
+      uint64_t status_address                                        : 62;
+    };
+
+    uint64_t flags;
+  } upper64;
+
+} vtd_invalidation_wait_descriptor;
+
 /**
  * @}
  */
@@ -5917,11 +6523,82 @@ typedef union {
     uint64_t zmm_hi16                                                : 1;
     uint64_t reserved_1                                              : 1;
     uint64_t pkru                                                    : 1;
+    uint64_t reserved_2                                              : 7;
+    uint64_t tilecfg                                                 : 1;
+    uint64_t tiledata                                                : 1;
   };
 
   uint64_t flags;
 } xcr0;
 
+/**
+ * @defgroup xsave \
+ *           XSAVE area
+ * @{
+ */
+#define XSAVE_ALIGNMENT                                              0x00000040
+#define XSAVE_LEGACY_REGION_OFFSET                                   0x00000000
+#define XSAVE_LEGACY_REGION_SIZE                                     0x00000200
+#define XSAVE_HEADER_OFFSET                                          0x00000200
+#define XSAVE_HEADER_SIZE                                            0x00000040
+#define XSAVE_EXTENDED_REGION_OFFSET                                 0x00000240
+/**
+ * @defgroup xsave_component \
+ *           XSAVE-supported state components
+ * @{
+ */
+#define XSAVE_COMPONENT_X87                                          0x00000000
+#define XSAVE_COMPONENT_SSE                                          0x00000001
+#define XSAVE_COMPONENT_AVX                                          0x00000002
+#define XSAVE_COMPONENT_BNDREGS                                      0x00000003
+#define XSAVE_COMPONENT_BNDCSR                                       0x00000004
+#define XSAVE_COMPONENT_OPMASK                                       0x00000005
+#define XSAVE_COMPONENT_ZMM_HI256                                    0x00000006
+#define XSAVE_COMPONENT_HI16_ZMM                                     0x00000007
+#define XSAVE_COMPONENT_PT                                           0x00000008
+#define XSAVE_COMPONENT_PKRU                                         0x00000009
+#define XSAVE_COMPONENT_PASID                                        0x0000000A
+#define XSAVE_COMPONENT_CET_U                                        0x0000000B
+#define XSAVE_COMPONENT_CET_S                                        0x0000000C
+#define XSAVE_COMPONENT_HDC                                          0x0000000D
+#define XSAVE_COMPONENT_UINTR                                        0x0000000E
+#define XSAVE_COMPONENT_LBR                                          0x0000000F
+#define XSAVE_COMPONENT_HWP                                          0x00000010
+#define XSAVE_COMPONENT_TILECFG                                      0x00000011
+#define XSAVE_COMPONENT_TILEDATA                                     0x00000012
+#define XSAVE_COMPONENT_COUNT                                        0x00000013
+/**
+ * @}
+ */
+
+#define XSAVE_SUPERVISOR_COMPONENTS                                  0x0001FD00
+#define XSAVE_STANDARD_OFFSET(_i, _cpuid_ebx)                        ((_cpuid_ebx) * ((_i) >= 2))
+#define XSAVE_COMPACTED_OFFSET(_end, _cpuid_ecx)                     (((_end) + (((_cpuid_ecx) >> 1) & 0x01) * 63) & ~((((_cpuid_ecx) >> 1) & 0x01) * 63))
+typedef struct {
+  union {
+    struct {
+      uint64_t state_components                                      : 63;
+    };
+
+    uint64_t flags;
+  } xstate_bv;
+
+  union {
+    struct {
+      uint64_t state_components                                      : 63;
+      uint64_t compacted_format                                      : 1;
+    };
+
+    uint64_t flags;
+  } xcomp_bv;
+
+  uint8_t reserved[48];
+} xsave_header;
+
+/**
+ * @}
+ */
+
 /**
  * @}
  */
@@ -48,22 +48,27 @@ typedef union {
 
   uint64_t Flags;
 } cr0;
+#define CR0_RESERVED_BITS                                            0xFFFFFFFF1FFAFFC0
 
 typedef union {
   struct {
-    uint64_t reserved_1                                              : 3;
+    uint64_t ignored_1                                               : 3;
+#define CR3_IGNORED_1                                                0x07
     uint64_t page_level_write_through                                : 1;
 #define CR3_PAGE_LEVEL_WRITE_THROUGH                                 0x08
     uint64_t page_level_cache_disable                                : 1;
 #define CR3_PAGE_LEVEL_CACHE_DISABLE                                 0x10
-    uint64_t reserved_2                                              : 7;
+    uint64_t ignored_2                                               : 7;
+#define CR3_IGNORED_2                                                0xFE0
     uint64_t address_of_page_directory                               : 36;
 #define CR3_ADDRESS_OF_PAGE_DIRECTORY                                0xFFFFFFFFF000
-    uint64_t reserved_3                                              : 16;
+    uint64_t reserved_1                                              : 16;
   };
 
   uint64_t Flags;
 } cr3;
+#define CR3_RESERVED_BITS                                            0xFFF0000000000000
+#define CR3_ADDRESS_BITS                                             0xFFFFFFFFFF000
 
 typedef union {
   struct {
@@ -131,6 +136,7 @@ typedef union {
 
   uint64_t Flags;
 } cr4;
+#define CR4_RESERVED_BITS                                            0xFFFFFFFEE4008000
 
 typedef union {
   struct {
@@ -142,6 +148,7 @@ typedef union {
 
   uint64_t Flags;
 } cr8;
+#define CR8_RESERVED_BITS                                            0xFFFFFFFFFFFFFFF0
 
 /**
  * @}
@@ -170,6 +177,7 @@ typedef union {
 
   uint64_t Flags;
 } dr6;
+#define DR6_RESERVED_BITS                                            0xFFFFFFFFFFFE1FF0
 
 typedef union {
   struct {
@@ -221,6 +229,7 @@ typedef union {
 
   uint64_t Flags;
 } dr7;
+#define DR7_RESERVED_BITS                                            0xFFFFFFFF0000D400
 
 /**
  * @}
@@ -238,6 +247,15 @@ typedef struct {
   uint32_t ecx_value_ntel;
   uint32_t edx_value_inei;
 } cpuid_eax_00;
+#define CPUID_EAX_00_SNAPSHOT_INDEX                                  0
+#define CPUID_EAX_00_EAX_POLICY_AND                                  0xFFFFFFFF
+#define CPUID_EAX_00_EAX_POLICY_OR                                   0x00000000
+#define CPUID_EAX_00_EBX_POLICY_AND                                  0xFFFFFFFF
+#define CPUID_EAX_00_EBX_POLICY_OR                                   0x00000000
+#define CPUID_EAX_00_ECX_POLICY_AND                                  0xFFFFFFFF
+#define CPUID_EAX_00_ECX_POLICY_OR                                   0x00000000
+#define CPUID_EAX_00_EDX_POLICY_AND                                  0xFFFFFFFF
+#define CPUID_EAX_00_EDX_POLICY_OR                                   0x00000000
 
 #define CPUID_VERSION_INFO                                           0x00000001
 typedef struct {
@@ -261,6 +279,7 @@ typedef struct {
 
     uint32_t Flags;
   } eax;
+#define CPUID_EAX_01_EAX_RESERVED_BITS                               0xF000C000
 
   union {
     struct {
@@ -276,203 +295,278 @@ typedef struct {
 
     uint32_t Flags;
   } ebx;
+#define CPUID_EAX_01_EBX_RESERVED_BITS                               0x00
 
   union {
     struct {
       uint32_t streaming_simd_extensions_3                           : 1;
 #define CPUID_ECX_STREAMING_SIMD_EXTENSIONS_3                        0x01
+#define CPUID_EAX_01_ECX_STREAMING_SIMD_EXTENSIONS_3_FEATURE         192
       uint32_t pclmulqdq_instruction                                 : 1;
 #define CPUID_ECX_PCLMULQDQ_INSTRUCTION                              0x02
+#define CPUID_EAX_01_ECX_PCLMULQDQ_INSTRUCTION_FEATURE               193
       uint32_t ds_area_64bit_layout                                  : 1;
 #define CPUID_ECX_DS_AREA_64BIT_LAYOUT                               0x04
+#define CPUID_EAX_01_ECX_DS_AREA_64BIT_LAYOUT_FEATURE                194
       uint32_t monitor_mwait_instruction                             : 1;
 #define CPUID_ECX_MONITOR_MWAIT_INSTRUCTION                          0x08
+#define CPUID_EAX_01_ECX_MONITOR_MWAIT_INSTRUCTION_FEATURE           195
       uint32_t cpl_qualified_debug_store                             : 1;
 #define CPUID_ECX_CPL_QUALIFIED_DEBUG_STORE                          0x10
+#define CPUID_EAX_01_ECX_CPL_QUALIFIED_DEBUG_STORE_FEATURE           196
       uint32_t virtual_machine_extensions                            : 1;
 #define CPUID_ECX_VIRTUAL_MACHINE_EXTENSIONS                         0x20
+#define CPUID_EAX_01_ECX_VIRTUAL_MACHINE_EXTENSIONS_FEATURE          197
       uint32_t safer_mode_extensions                                 : 1;
 #define CPUID_ECX_SAFER_MODE_EXTENSIONS                              0x40
+#define CPUID_EAX_01_ECX_SAFER_MODE_EXTENSIONS_FEATURE               198
       uint32_t enhanced_intel_speedstep_technology                   : 1;
 #define CPUID_ECX_ENHANCED_INTEL_SPEEDSTEP_TECHNOLOGY                0x80
+#define CPUID_EAX_01_ECX_ENHANCED_INTEL_SPEEDSTEP_TECHNOLOGY_FEATURE 199
       uint32_t thermal_monitor_2                                     : 1;
 #define CPUID_ECX_THERMAL_MONITOR_2                                  0x100
+#define CPUID_EAX_01_ECX_THERMAL_MONITOR_2_FEATURE                   200
       uint32_t supplemental_streaming_simd_extensions_3              : 1;
 #define CPUID_ECX_SUPPLEMENTAL_STREAMING_SIMD_EXTENSIONS_3           0x200
+#define CPUID_EAX_01_ECX_SUPPLEMENTAL_STREAMING_SIMD_EXTENSIONS_3_FEATURE 201
       uint32_t l1_context_id                                         : 1;
 #define CPUID_ECX_L1_CONTEXT_ID                                      0x400
+#define CPUID_EAX_01_ECX_L1_CONTEXT_ID_FEATURE                       202
       uint32_t silicon_debug                                         : 1;
 #define CPUID_ECX_SILICON_DEBUG                                      0x800
+#define CPUID_EAX_01_ECX_SILICON_DEBUG_FEATURE                       203
       uint32_t fma_extensions                                        : 1;
 #define CPUID_ECX_FMA_EXTENSIONS                                     0x1000
+#define CPUID_EAX_01_ECX_FMA_EXTENSIONS_FEATURE                      204
       uint32_t cmpxchg16b_instruction                                : 1;
 #define CPUID_ECX_CMPXCHG16B_INSTRUCTION                             0x2000
+#define CPUID_EAX_01_ECX_CMPXCHG16B_INSTRUCTION_FEATURE              205
       uint32_t xtpr_update_control                                   : 1;
 #define CPUID_ECX_XTPR_UPDATE_CONTROL                                0x4000
+#define CPUID_EAX_01_ECX_XTPR_UPDATE_CONTROL_FEATURE                 206
       uint32_t perfmon_and_debug_capability                          : 1;
 #define CPUID_ECX_PERFMON_AND_DEBUG_CAPABILITY                       0x8000
+#define CPUID_EAX_01_ECX_PERFMON_AND_DEBUG_CAPABILITY_FEATURE        207
       uint32_t reserved_1                                            : 1;
       uint32_t process_context_identifiers                           : 1;
 #define CPUID_ECX_PROCESS_CONTEXT_IDENTIFIERS                        0x20000
+#define CPUID_EAX_01_ECX_PROCESS_CONTEXT_IDENTIFIERS_FEATURE         209
       uint32_t direct_cache_access                                   : 1;
 #define CPUID_ECX_DIRECT_CACHE_ACCESS                                0x40000
+#define CPUID_EAX_01_ECX_DIRECT_CACHE_ACCESS_FEATURE                 210
       uint32_t sse41_support                                         : 1;
 #define CPUID_ECX_SSE41_SUPPORT                                      0x80000
+#define CPUID_EAX_01_ECX_SSE41_SUPPORT_FEATURE                       211
       uint32_t sse42_support                                         : 1;
 #define CPUID_ECX_SSE42_SUPPORT                                      0x100000
+#define CPUID_EAX_01_ECX_SSE42_SUPPORT_FEATURE                       212
       uint32_t x2apic_support                                        : 1;
 #define CPUID_ECX_X2APIC_SUPPORT                                     0x200000
+#define CPUID_EAX_01_ECX_X2APIC_SUPPORT_FEATURE                      213
       uint32_t movbe_instruction                                     : 1;
 #define CPUID_ECX_MOVBE_INSTRUCTION                                  0x400000
+#define CPUID_EAX_01_ECX_MOVBE_INSTRUCTION_FEATURE                   214
       uint32_t popcnt_instruction                                    : 1;
 #define CPUID_ECX_POPCNT_INSTRUCTION                                 0x800000
+#define CPUID_EAX_01_ECX_POPCNT_INSTRUCTION_FEATURE                  215
       uint32_t tsc_deadline                                          : 1;
 #define CPUID_ECX_TSC_DEADLINE                                       0x1000000
+#define CPUID_EAX_01_ECX_TSC_DEADLINE_FEATURE                        216
       uint32_t aesni_instruction_extensions                          : 1;
 #define CPUID_ECX_AESNI_INSTRUCTION_EXTENSIONS                       0x2000000
+#define CPUID_EAX_01_ECX_AESNI_INSTRUCTION_EXTENSIONS_FEATURE        217
       uint32_t xsave_xrstor_instruction                              : 1;
 #define CPUID_ECX_XSAVE_XRSTOR_INSTRUCTION                           0x4000000
+#define CPUID_EAX_01_ECX_XSAVE_XRSTOR_INSTRUCTION_FEATURE            218
       uint32_t osx_save                                              : 1;
 #define CPUID_ECX_OSX_SAVE                                           0x8000000
+#define CPUID_EAX_01_ECX_OSX_SAVE_FEATURE                            219
       uint32_t avx_support                                           : 1;
 #define CPUID_ECX_AVX_SUPPORT                                        0x10000000
+#define CPUID_EAX_01_ECX_AVX_SUPPORT_FEATURE                         220
       uint32_t half_precision_conversion_instructions                : 1;
 #define CPUID_ECX_HALF_PRECISION_CONVERSION_INSTRUCTIONS             0x20000000
+#define CPUID_EAX_01_ECX_HALF_PRECISION_CONVERSION_INSTRUCTIONS_FEATURE 221
       uint32_t rdrand_instruction                                    : 1;
 #define CPUID_ECX_RDRAND_INSTRUCTION                                 0x40000000
+#define CPUID_EAX_01_ECX_RDRAND_INSTRUCTION_FEATURE                  222
       uint32_t reserved_2                                            : 1;
     };
 
     uint32_t Flags;
   } ecx;
+#define CPUID_EAX_01_ECX_RESERVED_BITS                               0x80010000
 
   union {
     struct {
       uint32_t floating_point_unit_on_chip                           : 1;
 #define CPUID_EDX_FLOATING_POINT_UNIT_ON_CHIP                        0x01
+#define CPUID_EAX_01_EDX_FLOATING_POINT_UNIT_ON_CHIP_FEATURE         224
       uint32_t virtual_8086_mode_enhancements                        : 1;
 #define CPUID_EDX_VIRTUAL_8086_MODE_ENHANCEMENTS                     0x02
+#define CPUID_EAX_01_EDX_VIRTUAL_8086_MODE_ENHANCEMENTS_FEATURE      225
       uint32_t debugging_extensions                                  : 1;
 #define CPUID_EDX_DEBUGGING_EXTENSIONS                               0x04
+#define CPUID_EAX_01_EDX_DEBUGGING_EXTENSIONS_FEATURE                226
       uint32_t page_size_extension                                   : 1;
 #define CPUID_EDX_PAGE_SIZE_EXTENSION                                0x08
+#define CPUID_EAX_01_EDX_PAGE_SIZE_EXTENSION_FEATURE                 227
       uint32_t timestamp_counter                                     : 1;
 #define CPUID_EDX_TIMESTAMP_COUNTER                                  0x10
+#define CPUID_EAX_01_EDX_TIMESTAMP_COUNTER_FEATURE                   228
       uint32_t rdmsr_wrmsr_instructions                              : 1;
 #define CPUID_EDX_RDMSR_WRMSR_INSTRUCTIONS                           0x20
+#define CPUID_EAX_01_EDX_RDMSR_WRMSR_INSTRUCTIONS_FEATURE            229
       uint32_t physical_address_extension                            : 1;
 #define CPUID_EDX_PHYSICAL_ADDRESS_EXTENSION                         0x40
+#define CPUID_EAX_01_EDX_PHYSICAL_ADDRESS_EXTENSION_FEATURE          230
       uint32_t machine_check_exception                               : 1;
 #define CPUID_EDX_MACHINE_CHECK_EXCEPTION                            0x80
+#define CPUID_EAX_01_EDX_MACHINE_CHECK_EXCEPTION_FEATURE             231
       uint32_t cmpxchg8b_instruction                                 : 1;
 #define CPUID_EDX_CMPXCHG8B_INSTRUCTION                              0x100
+#define CPUID_EAX_01_EDX_CMPXCHG8B_INSTRUCTION_FEATURE               232
       uint32_t apic_on_chip                                          : 1;
 #define CPUID_EDX_APIC_ON_CHIP                                       0x200
+#define CPUID_EAX_01_EDX_APIC_ON_CHIP_FEATURE                        233
       uint32_t reserved_1                                            : 1;
       uint32_t sysenter_sysexit_instructions                         : 1;
 #define CPUID_EDX_SYSENTER_SYSEXIT_INSTRUCTIONS                      0x800
+#define CPUID_EAX_01_EDX_SYSENTER_SYSEXIT_INSTRUCTIONS_FEATURE       235
       uint32_t memory_type_range_registers                           : 1;
 #define CPUID_EDX_MEMORY_TYPE_RANGE_REGISTERS                        0x1000
+#define CPUID_EAX_01_EDX_MEMORY_TYPE_RANGE_REGISTERS_FEATURE         236
       uint32_t page_global_bit                                       : 1;
 #define CPUID_EDX_PAGE_GLOBAL_BIT                                    0x2000
+#define CPUID_EAX_01_EDX_PAGE_GLOBAL_BIT_FEATURE                     237
       uint32_t machine_check_architecture                            : 1;
 #define CPUID_EDX_MACHINE_CHECK_ARCHITECTURE                         0x4000
+#define CPUID_EAX_01_EDX_MACHINE_CHECK_ARCHITECTURE_FEATURE          238
       uint32_t conditional_move_instructions                         : 1;
 #define CPUID_EDX_CONDITIONAL_MOVE_INSTRUCTIONS                      0x8000
+#define CPUID_EAX_01_EDX_CONDITIONAL_MOVE_INSTRUCTIONS_FEATURE       239
       uint32_t page_attribute_table                                  : 1;
 #define CPUID_EDX_PAGE_ATTRIBUTE_TABLE                               0x10000
+#define CPUID_EAX_01_EDX_PAGE_ATTRIBUTE_TABLE_FEATURE                240
       uint32_t page_size_extension_36bit                             : 1;
 #define CPUID_EDX_PAGE_SIZE_EXTENSION_36BIT                          0x20000
+#define CPUID_EAX_01_EDX_PAGE_SIZE_EXTENSION_36BIT_FEATURE           241
       uint32_t processor_serial_number                               : 1;
 #define CPUID_EDX_PROCESSOR_SERIAL_NUMBER                            0x40000
+#define CPUID_EAX_01_EDX_PROCESSOR_SERIAL_NUMBER_FEATURE             242
       uint32_t clflush_instruction                                   : 1;
 #define CPUID_EDX_CLFLUSH_INSTRUCTION                                0x80000
+#define CPUID_EAX_01_EDX_CLFLUSH_INSTRUCTION_FEATURE                 243
       uint32_t reserved_2                                            : 1;
       uint32_t debug_store                                           : 1;
 #define CPUID_EDX_DEBUG_STORE                                        0x200000
+#define CPUID_EAX_01_EDX_DEBUG_STORE_FEATURE                         245
       uint32_t thermal_control_msrs_for_acpi                         : 1;
 #define CPUID_EDX_THERMAL_CONTROL_MSRS_FOR_ACPI                      0x400000
+#define CPUID_EAX_01_EDX_THERMAL_CONTROL_MSRS_FOR_ACPI_FEATURE       246
       uint32_t mmx_support                                           : 1;
 #define CPUID_EDX_MMX_SUPPORT                                        0x800000
+#define CPUID_EAX_01_EDX_MMX_SUPPORT_FEATURE                         247
       uint32_t fxsave_fxrstor_instructions                           : 1;
 #define CPUID_EDX_FXSAVE_FXRSTOR_INSTRUCTIONS                        0x1000000
+#define CPUID_EAX_01_EDX_FXSAVE_FXRSTOR_INSTRUCTIONS_FEATURE         248
       uint32_t sse_support                                           : 1;
 #define CPUID_EDX_SSE_SUPPORT                                        0x2000000
+#define CPUID_EAX_01_EDX_SSE_SUPPORT_FEATURE                         249
       uint32_t sse2_support                                          : 1;
 #define CPUID_EDX_SSE2_SUPPORT                                       0x4000000
+#define CPUID_EAX_01_EDX_SSE2_SUPPORT_FEATURE                        250
       uint32_t self_snoop                                            : 1;
 #define CPUID_EDX_SELF_SNOOP                                         0x8000000
+#define CPUID_EAX_01_EDX_SELF_SNOOP_FEATURE                          251
       uint32_t hyper_threading_technology                            : 1;
 #define CPUID_EDX_HYPER_THREADING_TECHNOLOGY                         0x10000000
+#define CPUID_EAX_01_EDX_HYPER_THREADING_TECHNOLOGY_FEATURE          252
       uint32_t thermal_monitor                                       : 1;
 #define CPUID_EDX_THERMAL_MONITOR                                    0x20000000
+#define CPUID_EAX_01_EDX_THERMAL_MONITOR_FEATURE                     253
       uint32_t reserved_3                                            : 1;
       uint32_t pending_break_enable                                  : 1;
 #define CPUID_EDX_PENDING_BREAK_ENABLE                               0x80000000
+#define CPUID_EAX_01_EDX_PENDING_BREAK_ENABLE_FEATURE                255
     };
 
     uint32_t Flags;
   } edx;
+#define CPUID_EAX_01_EDX_RESERVED_BITS                               0x40100400
 
 } cpuid_eax_01;
+#define CPUID_EAX_01_SNAPSHOT_INDEX                                  1
+#define CPUID_EAX_01_EAX_POLICY_AND                                  0x0FFF3FFF
+#define CPUID_EAX_01_EAX_POLICY_OR                                   0x00000000
+#define CPUID_EAX_01_EBX_POLICY_AND                                  0xFFFFFFFF
+#define CPUID_EAX_01_EBX_POLICY_OR                                   0x00000000
+#define CPUID_EAX_01_ECX_POLICY_AND                                  0x7FFE760B
+#define CPUID_EAX_01_ECX_POLICY_OR                                   0x00000000
+#define CPUID_EAX_01_EDX_POLICY_AND                                  0x1F8BFBFF
+#define CPUID_EAX_01_EDX_POLICY_OR                                   0x00000000
 
 #define CPUID_CACHE_PARAMS                                           0x00000004
 typedef struct {
   union {
     struct {
       uint32_t cache_type_field                                      : 5;
-#define CPUID_EAX_CACHE_TYPE_FIELD                                   0x1F
+#define CPUID_EAX_04_EAX_CACHE_TYPE_FIELD                            0x1F
       uint32_t cache_level                                           : 3;
-#define CPUID_EAX_CACHE_LEVEL                                        0xE0
+#define CPUID_EAX_04_EAX_CACHE_LEVEL                                 0xE0
       uint32_t self_initializing_cache_level                         : 1;
-#define CPUID_EAX_SELF_INITIALIZING_CACHE_LEVEL                      0x100
+#define CPUID_EAX_04_EAX_SELF_INITIALIZING_CACHE_LEVEL               0x100
       uint32_t fully_associative_cache                               : 1;
-#define CPUID_EAX_FULLY_ASSOCIATIVE_CACHE                            0x200
+#define CPUID_EAX_04_EAX_FULLY_ASSOCIATIVE_CACHE                     0x200
       uint32_t reserved_1                                            : 4;
       uint32_t max_addressable_ids_for_logical_processors_sharing_this_cache: 12;
-#define CPUID_EAX_MAX_ADDRESSABLE_IDS_FOR_LOGICAL_PROCESSORS_SHARING_THIS_CACHE 0x3FFC000
+#define CPUID_EAX_04_EAX_MAX_ADDRESSABLE_IDS_FOR_LOGICAL_PROCESSORS_SHARING_THIS_CACHE 0x3FFC000
       uint32_t max_addressable_ids_for_processor_cores_in_physical_package: 6;
-#define CPUID_EAX_MAX_ADDRESSABLE_IDS_FOR_PROCESSOR_CORES_IN_PHYSICAL_PACKAGE 0xFC000000
+#define CPUID_EAX_04_EAX_MAX_ADDRESSABLE_IDS_FOR_PROCESSOR_CORES_IN_PHYSICAL_PACKAGE 0xFC000000
     };
 
     uint32_t Flags;
   } eax;
+#define CPUID_EAX_04_EAX_RESERVED_BITS                               0x3C00
 
   union {
     struct {
       uint32_t system_coherency_line_size                            : 12;
-#define CPUID_EBX_SYSTEM_COHERENCY_LINE_SIZE                         0xFFF
+#define CPUID_EAX_04_EBX_SYSTEM_COHERENCY_LINE_SIZE                  0xFFF
       uint32_t physical_line_partitions                              : 10;
-#define CPUID_EBX_PHYSICAL_LINE_PARTITIONS                           0x3FF000
+#define CPUID_EAX_04_EBX_PHYSICAL_LINE_PARTITIONS                    0x3FF000
       uint32_t ways_of_associativity                                 : 10;
-#define CPUID_EBX_WAYS_OF_ASSOCIATIVITY                              0xFFC00000
+#define CPUID_EAX_04_EBX_WAYS_OF_ASSOCIATIVITY                       0xFFC00000
     };
 
     uint32_t Flags;
   } ebx;
+#define CPUID_EAX_04_EBX_RESERVED_BITS                               0x00
 
   union {
     struct {
       uint32_t number_of_sets                                        : 32;
-#define CPUID_ECX_NUMBER_OF_SETS                                     0xFFFFFFFF
+#define CPUID_EAX_04_ECX_NUMBER_OF_SETS                              0xFFFFFFFF
     };
 
     uint32_t Flags;
   } ecx;
+#define CPUID_EAX_04_ECX_RESERVED_BITS                               0x00
 
   union {
     struct {
       uint32_t write_back_invalidate                                 : 1;
-#define CPUID_EDX_WRITE_BACK_INVALIDATE                              0x01
+#define CPUID_EAX_04_EDX_WRITE_BACK_INVALIDATE                       0x01
       uint32_t cache_inclusiveness                                   : 1;
-#define CPUID_EDX_CACHE_INCLUSIVENESS                                0x02
+#define CPUID_EAX_04_EDX_CACHE_INCLUSIVENESS                         0x02
       uint32_t complex_cache_indexing                                : 1;
-#define CPUID_EDX_COMPLEX_CACHE_INDEXING                             0x04
+#define CPUID_EAX_04_EDX_COMPLEX_CACHE_INDEXING                      0x04
       uint32_t reserved_1                                            : 29;
     };
 
     uint32_t Flags;
   } edx;
+#define CPUID_EAX_04_EDX_RESERVED_BITS                               0xFFFFFFF8
 
 } cpuid_eax_04;
 
@@ -481,148 +575,197 @@ typedef struct {
   union {
     struct {
       uint32_t smallest_monitor_line_size                            : 16;
-#define CPUID_EAX_SMALLEST_MONITOR_LINE_SIZE                         0xFFFF
+#define CPUID_EAX_05_EAX_SMALLEST_MONITOR_LINE_SIZE                  0xFFFF
       uint32_t reserved_1                                            : 16;
     };
 
     uint32_t Flags;
   } eax;
+#define CPUID_EAX_05_EAX_RESERVED_BITS                               0xFFFF0000
 
   union {
     struct {
       uint32_t largest_monitor_line_size                             : 16;
-#define CPUID_EBX_LARGEST_MONITOR_LINE_SIZE                          0xFFFF
+#define CPUID_EAX_05_EBX_LARGEST_MONITOR_LINE_SIZE                   0xFFFF
       uint32_t reserved_1                                            : 16;
     };
 
     uint32_t Flags;
   } ebx;
+#define CPUID_EAX_05_EBX_RESERVED_BITS                               0xFFFF0000
 
   union {
     struct {
       uint32_t enumeration_of_monitor_mwait_extensions               : 1;
-#define CPUID_ECX_ENUMERATION_OF_MONITOR_MWAIT_EXTENSIONS            0x01
+#define CPUID_EAX_05_ECX_ENUMERATION_OF_MONITOR_MWAIT_EXTENSIONS     0x01
+#define CPUID_EAX_05_ECX_ENUMERATION_OF_MONITOR_MWAIT_EXTENSIONS_FEATURE 320
       uint32_t supports_treating_interrupts_as_break_event_for_mwait : 1;
-#define CPUID_ECX_SUPPORTS_TREATING_INTERRUPTS_AS_BREAK_EVENT_FOR_MWAIT 0x02
+#define CPUID_EAX_05_ECX_SUPPORTS_TREATING_INTERRUPTS_AS_BREAK_EVENT_FOR_MWAIT 0x02
+#define CPUID_EAX_05_ECX_SUPPORTS_TREATING_INTERRUPTS_AS_BREAK_EVENT_FOR_MWAIT_FEATURE 321
       uint32_t reserved_1                                            : 30;
     };
 
     uint32_t Flags;
   } ecx;
+#define CPUID_EAX_05_ECX_RESERVED_BITS                               0xFFFFFFFC
 
   union {
     struct {
       uint32_t number_of_c0_sub_c_states                             : 4;
-#define CPUID_EDX_NUMBER_OF_C0_SUB_C_STATES                          0x0F
+#define CPUID_EAX_05_EDX_NUMBER_OF_C0_SUB_C_STATES                   0x0F
       uint32_t number_of_c1_sub_c_states                             : 4;
-#define CPUID_EDX_NUMBER_OF_C1_SUB_C_STATES                          0xF0
+#define CPUID_EAX_05_EDX_NUMBER_OF_C1_SUB_C_STATES                   0xF0
       uint32_t number_of_c2_sub_c_states                             : 4;
-#define CPUID_EDX_NUMBER_OF_C2_SUB_C_STATES                          0xF00
+#define CPUID_EAX_05_EDX_NUMBER_OF_C2_SUB_C_STATES                   0xF00
       uint32_t number_of_c3_sub_c_states                             : 4;
-#define CPUID_EDX_NUMBER_OF_C3_SUB_C_STATES                          0xF000
+#define CPUID_EAX_05_EDX_NUMBER_OF_C3_SUB_C_STATES                   0xF000
       uint32_t number_of_c4_sub_c_states                             : 4;
-#define CPUID_EDX_NUMBER_OF_C4_SUB_C_STATES                          0xF0000
+#define CPUID_EAX_05_EDX_NUMBER_OF_C4_SUB_C_STATES                   0xF0000
       uint32_t number_of_c5_sub_c_states                             : 4;
-#define CPUID_EDX_NUMBER_OF_C5_SUB_C_STATES                          0xF00000
+#define CPUID_EAX_05_EDX_NUMBER_OF_C5_SUB_C_STATES                   0xF00000
       uint32_t number_of_c6_sub_c_states                             : 4;
-#define CPUID_EDX_NUMBER_OF_C6_SUB_C_STATES                          0xF000000
+#define CPUID_EAX_05_EDX_NUMBER_OF_C6_SUB_C_STATES                   0xF000000
       uint32_t number_of_c7_sub_c_states                             : 4;
-#define CPUID_EDX_NUMBER_OF_C7_SUB_C_STATES                          0xF0000000
+#define CPUID_EAX_05_EDX_NUMBER_OF_C7_SUB_C_STATES                   0xF0000000
     };
 
     uint32_t Flags;
   } edx;
+#define CPUID_EAX_05_EDX_RESERVED_BITS                               0x00
 
 } cpuid_eax_05;
+#define CPUID_EAX_05_SNAPSHOT_INDEX                                  2
+#define CPUID_EAX_05_EAX_POLICY_AND                                  0x0000FFFF
+#define CPUID_EAX_05_EAX_POLICY_OR                                   0x00000000
+#define CPUID_EAX_05_EBX_POLICY_AND                                  0x0000FFFF
+#define CPUID_EAX_05_EBX_POLICY_OR                                   0x00000000
+#define CPUID_EAX_05_ECX_POLICY_AND                                  0x00000003
+#define CPUID_EAX_05_ECX_POLICY_OR                                   0x00000000
+#define CPUID_EAX_05_EDX_POLICY_AND                                  0xFFFFFFFF
+#define CPUID_EAX_05_EDX_POLICY_OR                                   0x00000000
 
 #define CPUID_THERMAL_POWER_MANAGEMENT                               0x00000006
 typedef struct {
   union {
     struct {
       uint32_t temperature_sensor_supported                          : 1;
-#define CPUID_EAX_TEMPERATURE_SENSOR_SUPPORTED                       0x01
+#define CPUID_EAX_06_EAX_TEMPERATURE_SENSOR_SUPPORTED                0x01
+#define CPUID_EAX_06_EAX_TEMPERATURE_SENSOR_SUPPORTED_FEATURE        384
       uint32_t intel_turbo_boost_technology_available                : 1;
-#define CPUID_EAX_INTEL_TURBO_BOOST_TECHNOLOGY_AVAILABLE             0x02
+#define CPUID_EAX_06_EAX_INTEL_TURBO_BOOST_TECHNOLOGY_AVAILABLE      0x02
+#define CPUID_EAX_06_EAX_INTEL_TURBO_BOOST_TECHNOLOGY_AVAILABLE_FEATURE 385
       uint32_t apic_timer_always_running                             : 1;
-#define CPUID_EAX_APIC_TIMER_ALWAYS_RUNNING                          0x04
+#define CPUID_EAX_06_EAX_APIC_TIMER_ALWAYS_RUNNING                   0x04
+#define CPUID_EAX_06_EAX_APIC_TIMER_ALWAYS_RUNNING_FEATURE           386
       uint32_t reserved_1                                            : 1;
       uint32_t power_limit_notification                              : 1;
-#define CPUID_EAX_POWER_LIMIT_NOTIFICATION                           0x10
+#define CPUID_EAX_06_EAX_POWER_LIMIT_NOTIFICATION                    0x10
+#define CPUID_EAX_06_EAX_POWER_LIMIT_NOTIFICATION_FEATURE            388
       uint32_t clock_modulation_duty                                 : 1;
-#define CPUID_EAX_CLOCK_MODULATION_DUTY                              0x20
+#define CPUID_EAX_06_EAX_CLOCK_MODULATION_DUTY                       0x20
+#define CPUID_EAX_06_EAX_CLOCK_MODULATION_DUTY_FEATURE               389
       uint32_t package_thermal_management                            : 1;
-#define CPUID_EAX_PACKAGE_THERMAL_MANAGEMENT                         0x40
+#define CPUID_EAX_06_EAX_PACKAGE_THERMAL_MANAGEMENT                  0x40
+#define CPUID_EAX_06_EAX_PACKAGE_THERMAL_MANAGEMENT_FEATURE          390
       uint32_t hwp_base_registers                                    : 1;
-#define CPUID_EAX_HWP_BASE_REGISTERS                                 0x80
+#define CPUID_EAX_06_EAX_HWP_BASE_REGISTERS                          0x80
+#define CPUID_EAX_06_EAX_HWP_BASE_REGISTERS_FEATURE                  391
       uint32_t hwp_notification                                      : 1;
-#define CPUID_EAX_HWP_NOTIFICATION                                   0x100
+#define CPUID_EAX_06_EAX_HWP_NOTIFICATION                            0x100
+#define CPUID_EAX_06_EAX_HWP_NOTIFICATION_FEATURE                    392
       uint32_t hwp_activity_window                                   : 1;
-#define CPUID_EAX_HWP_ACTIVITY_WINDOW                                0x200
+#define CPUID_EAX_06_EAX_HWP_ACTIVITY_WINDOW                         0x200
+#define CPUID_EAX_06_EAX_HWP_ACTIVITY_WINDOW_FEATURE                 393
       uint32_t hwp_energy_performance_preference                     : 1;
-#define CPUID_EAX_HWP_ENERGY_PERFORMANCE_PREFERENCE                  0x400
+#define CPUID_EAX_06_EAX_HWP_ENERGY_PERFORMANCE_PREFERENCE           0x400
+#define CPUID_EAX_06_EAX_HWP_ENERGY_PERFORMANCE_PREFERENCE_FEATURE   394
       uint32_t hwp_package_level_request                             : 1;
-#define CPUID_EAX_HWP_PACKAGE_LEVEL_REQUEST                          0x800
+#define CPUID_EAX_06_EAX_HWP_PACKAGE_LEVEL_REQUEST                   0x800
+#define CPUID_EAX_06_EAX_HWP_PACKAGE_LEVEL_REQUEST_FEATURE           395
       uint32_t reserved_2                                            : 1;
       uint32_t hdc                                                   : 1;
-#define CPUID_EAX_HDC                                                0x2000
+#define CPUID_EAX_06_EAX_HDC                                         0x2000
+#define CPUID_EAX_06_EAX_HDC_FEATURE                                 397
       uint32_t intel_turbo_boost_max_technology_3_available          : 1;
-#define CPUID_EAX_INTEL_TURBO_BOOST_MAX_TECHNOLOGY_3_AVAILABLE       0x4000
+#define CPUID_EAX_06_EAX_INTEL_TURBO_BOOST_MAX_TECHNOLOGY_3_AVAILABLE 0x4000
+#define CPUID_EAX_06_EAX_INTEL_TURBO_BOOST_MAX_TECHNOLOGY_3_AVAILABLE_FEATURE 398
       uint32_t hwp_capabilities                                      : 1;
-#define CPUID_EAX_HWP_CAPABILITIES                                   0x8000
+#define CPUID_EAX_06_EAX_HWP_CAPABILITIES                            0x8000
+#define CPUID_EAX_06_EAX_HWP_CAPABILITIES_FEATURE                    399
       uint32_t hwp_peci_override                                     : 1;
-#define CPUID_EAX_HWP_PECI_OVERRIDE                                  0x10000
+#define CPUID_EAX_06_EAX_HWP_PECI_OVERRIDE                           0x10000
+#define CPUID_EAX_06_EAX_HWP_PECI_OVERRIDE_FEATURE                   400
       uint32_t flexible_hwp                                          : 1;
-#define CPUID_EAX_FLEXIBLE_HWP                                       0x20000
+#define CPUID_EAX_06_EAX_FLEXIBLE_HWP                                0x20000
+#define CPUID_EAX_06_EAX_FLEXIBLE_HWP_FEATURE                        401
       uint32_t fast_access_mode_for_hwp_request_msr                  : 1;
-#define CPUID_EAX_FAST_ACCESS_MODE_FOR_HWP_REQUEST_MSR               0x40000
+#define CPUID_EAX_06_EAX_FAST_ACCESS_MODE_FOR_HWP_REQUEST_MSR        0x40000
+#define CPUID_EAX_06_EAX_FAST_ACCESS_MODE_FOR_HWP_REQUEST_MSR_FEATURE 402
       uint32_t reserved_3                                            : 1;
       uint32_t ignoring_idle_logical_processor_hwp_request           : 1;
-#define CPUID_EAX_IGNORING_IDLE_LOGICAL_PROCESSOR_HWP_REQUEST        0x100000
+#define CPUID_EAX_06_EAX_IGNORING_IDLE_LOGICAL_PROCESSOR_HWP_REQUEST 0x100000
+#define CPUID_EAX_06_EAX_IGNORING_IDLE_LOGICAL_PROCESSOR_HWP_REQUEST_FEATURE 404
       uint32_t reserved_4                                            : 2;
       uint32_t intel_thread_director                                 : 1;
-#define CPUID_EAX_INTEL_THREAD_DIRECTOR                              0x800000
+#define CPUID_EAX_06_EAX_INTEL_THREAD_DIRECTOR                       0x800000
+#define CPUID_EAX_06_EAX_INTEL_THREAD_DIRECTOR_FEATURE               407
       uint32_t reserved_5                                            : 8;
     };
 
     uint32_t Flags;
   } eax;
+#define CPUID_EAX_06_EAX_RESERVED_BITS                               0xFF681008
 
   union {
     struct {
       uint32_t number_of_interrupt_thresholds_in_thermal_sensor      : 4;
-#define CPUID_EBX_NUMBER_OF_INTERRUPT_THRESHOLDS_IN_THERMAL_SENSOR   0x0F
+#define CPUID_EAX_06_EBX_NUMBER_OF_INTERRUPT_THRESHOLDS_IN_THERMAL_SENSOR 0x0F
       uint32_t reserved_1                                            : 28;
     };
 
     uint32_t Flags;
   } ebx;
+#define CPUID_EAX_06_EBX_RESERVED_BITS                               0xFFFFFFF0
 
   union {
     struct {
       uint32_t hardware_coordination_feedback_capability             : 1;
-#define CPUID_ECX_HARDWARE_COORDINATION_FEEDBACK_CAPABILITY          0x01
+#define CPUID_EAX_06_ECX_HARDWARE_COORDINATION_FEEDBACK_CAPABILITY   0x01
+#define CPUID_EAX_06_ECX_HARDWARE_COORDINATION_FEEDBACK_CAPABILITY_FEATURE 448
       uint32_t reserved_1                                            : 2;
       uint32_t number_of_intel_thread_director_classes               : 1;
-#define CPUID_ECX_NUMBER_OF_INTEL_THREAD_DIRECTOR_CLASSES            0x08
+#define CPUID_EAX_06_ECX_NUMBER_OF_INTEL_THREAD_DIRECTOR_CLASSES     0x08
+#define CPUID_EAX_06_ECX_NUMBER_OF_INTEL_THREAD_DIRECTOR_CLASSES_FEATURE 451
       uint32_t reserved_2                                            : 4;
       uint32_t performance_energy_bias_preference                    : 8;
-#define CPUID_ECX_PERFORMANCE_ENERGY_BIAS_PREFERENCE                 0xFF00
+#define CPUID_EAX_06_ECX_PERFORMANCE_ENERGY_BIAS_PREFERENCE          0xFF00
       uint32_t reserved_3                                            : 16;
     };
 
     uint32_t Flags;
   } ecx;
+#define CPUID_EAX_06_ECX_RESERVED_BITS                               0xFFFF00F6
 
   union {
     struct {
       uint32_t reserved                                              : 32;
-#define CPUID_EDX_RESERVED                                           0xFFFFFFFF
+#define CPUID_EAX_06_EDX_RESERVED                                    0xFFFFFFFF
     };
 
     uint32_t Flags;
   } edx;
+#define CPUID_EAX_06_EDX_RESERVED_BITS                               0xFFFFFFFF
 
 } cpuid_eax_06;
+#define CPUID_EAX_06_SNAPSHOT_INDEX                                  3
+#define CPUID_EAX_06_EAX_POLICY_AND                                  0x0097EFF7
+#define CPUID_EAX_06_EAX_POLICY_OR                                   0x00000000
+#define CPUID_EAX_06_EBX_POLICY_AND                                  0x0000000F
+#define CPUID_EAX_06_EBX_POLICY_OR                                   0x00000000
+#define CPUID_EAX_06_ECX_POLICY_AND                                  0x0000FF09
+#define CPUID_EAX_06_ECX_POLICY_OR                                   0x00000000
+#define CPUID_EAX_06_EDX_POLICY_AND                                  0x00000000
+#define CPUID_EAX_06_EDX_POLICY_OR                                   0x00000000
 
 /**
  * @defgroup cpuid_eax_07 \
@@ -634,306 +777,437 @@ typedef struct {
   union {
     struct {
       uint32_t number_of_sub_leaves                                  : 32;
-#define CPUID_EAX_NUMBER_OF_SUB_LEAVES                               0xFFFFFFFF
+#define CPUID_EAX_07_EAX_NUMBER_OF_SUB_LEAVES                        0xFFFFFFFF
     };
 
     uint32_t Flags;
   } eax;
+#define CPUID_EAX_07_EAX_RESERVED_BITS                               0x00
 
   union {
     struct {
       uint32_t fsgsbase                                              : 1;
-#define CPUID_EBX_FSGSBASE                                           0x01
+#define CPUID_EAX_07_EBX_FSGSBASE                                    0x01
+#define CPUID_EAX_07_EBX_FSGSBASE_FEATURE                            544
       uint32_t ia32_tsc_adjust_msr                                   : 1;
-#define CPUID_EBX_IA32_TSC_ADJUST_MSR                                0x02
+#define CPUID_EAX_07_EBX_IA32_TSC_ADJUST_MSR                         0x02
+#define CPUID_EAX_07_EBX_IA32_TSC_ADJUST_MSR_FEATURE                 545
       uint32_t sgx                                                   : 1;
-#define CPUID_EBX_SGX                                                0x04
+#define CPUID_EAX_07_EBX_SGX                                         0x04
+#define CPUID_EAX_07_EBX_SGX_FEATURE                                 546
       uint32_t bmi1                                                  : 1;
-#define CPUID_EBX_BMI1                                               0x08
+#define CPUID_EAX_07_EBX_BMI1                                        0x08
+#define CPUID_EAX_07_EBX_BMI1_FEATURE                                547
       uint32_t hle                                                   : 1;
-#define CPUID_EBX_HLE                                                0x10
+#define CPUID_EAX_07_EBX_HLE                                         0x10
+#define CPUID_EAX_07_EBX_HLE_FEATURE                                 548
       uint32_t avx2                                                  : 1;
-#define CPUID_EBX_AVX2                                               0x20
+#define CPUID_EAX_07_EBX_AVX2                                        0x20
+#define CPUID_EAX_07_EBX_AVX2_FEATURE                                549
       uint32_t fdp_excptn_only                                       : 1;
-#define CPUID_EBX_FDP_EXCPTN_ONLY                                    0x40
+#define CPUID_EAX_07_EBX_FDP_EXCPTN_ONLY                             0x40
+#define CPUID_EAX_07_EBX_FDP_EXCPTN_ONLY_FEATURE                     550
       uint32_t smep                                                  : 1;
-#define CPUID_EBX_SMEP                                               0x80
+#define CPUID_EAX_07_EBX_SMEP                                        0x80
+#define CPUID_EAX_07_EBX_SMEP_FEATURE                                551
       uint32_t bmi2                                                  : 1;
-#define CPUID_EBX_BMI2                                               0x100
+#define CPUID_EAX_07_EBX_BMI2                                        0x100
+#define CPUID_EAX_07_EBX_BMI2_FEATURE                                552
       uint32_t enhanced_rep_movsb_stosb                              : 1;
-#define CPUID_EBX_ENHANCED_REP_MOVSB_STOSB                           0x200
+#define CPUID_EAX_07_EBX_ENHANCED_REP_MOVSB_STOSB                    0x200
+#define CPUID_EAX_07_EBX_ENHANCED_REP_MOVSB_STOSB_FEATURE            553
       uint32_t invpcid                                               : 1;
-#define CPUID_EBX_INVPCID                                            0x400
+#define CPUID_EAX_07_EBX_INVPCID                                     0x400
+#define CPUID_EAX_07_EBX_INVPCID_FEATURE                             554
       uint32_t rtm                                                   : 1;
-#define CPUID_EBX_RTM                                                0x800
+#define CPUID_EAX_07_EBX_RTM                                         0x800
+#define CPUID_EAX_07_EBX_RTM_FEATURE                                 555
       uint32_t rdt_m                                                 : 1;
-#define CPUID_EBX_RDT_M                                              0x1000
+#define CPUID_EAX_07_EBX_RDT_M                                       0x1000
+#define CPUID_EAX_07_EBX_RDT_M_FEATURE                               556
       uint32_t deprecates                                            : 1;
-#define CPUID_EBX_DEPRECATES                                         0x2000
+#define CPUID_EAX_07_EBX_DEPRECATES                                  0x2000
+#define CPUID_EAX_07_EBX_DEPRECATES_FEATURE                          557
       uint32_t mpx                                                   : 1;
-#define CPUID_EBX_MPX                                                0x4000
+#define CPUID_EAX_07_EBX_MPX                                         0x4000
+#define CPUID_EAX_07_EBX_MPX_FEATURE                                 558
       uint32_t rdt                                                   : 1;
-#define CPUID_EBX_RDT                                                0x8000
+#define CPUID_EAX_07_EBX_RDT                                         0x8000
+#define CPUID_EAX_07_EBX_RDT_FEATURE                                 559
       uint32_t avx512f                                               : 1;
-#define CPUID_EBX_AVX512F                                            0x10000
+#define CPUID_EAX_07_EBX_AVX512F                                     0x10000
+#define CPUID_EAX_07_EBX_AVX512F_FEATURE                             560
       uint32_t avx512dq                                              : 1;
-#define CPUID_EBX_AVX512DQ                                           0x20000
+#define CPUID_EAX_07_EBX_AVX512DQ                                    0x20000
+#define CPUID_EAX_07_EBX_AVX512DQ_FEATURE                            561
       uint32_t rdseed                                                : 1;
-#define CPUID_EBX_RDSEED                                             0x40000
+#define CPUID_EAX_07_EBX_RDSEED                                      0x40000
+#define CPUID_EAX_07_EBX_RDSEED_FEATURE                              562
       uint32_t adx                                                   : 1;
-#define CPUID_EBX_ADX                                                0x80000
+#define CPUID_EAX_07_EBX_ADX                                         0x80000
+#define CPUID_EAX_07_EBX_ADX_FEATURE                                 563
       uint32_t smap                                                  : 1;
-#define CPUID_EBX_SMAP                                               0x100000
+#define CPUID_EAX_07_EBX_SMAP                                        0x100000
+#define CPUID_EAX_07_EBX_SMAP_FEATURE                                564
       uint32_t avx512_ifma                                           : 1;
-#define CPUID_EBX_AVX512_IFMA                                        0x200000
+#define CPUID_EAX_07_EBX_AVX512_IFMA                                 0x200000
+#define CPUID_EAX_07_EBX_AVX512_IFMA_FEATURE                         565
       uint32_t reserved_1                                            : 1;
       uint32_t clflushopt                                            : 1;
-#define CPUID_EBX_CLFLUSHOPT                                         0x800000
+#define CPUID_EAX_07_EBX_CLFLUSHOPT                                  0x800000
+#define CPUID_EAX_07_EBX_CLFLUSHOPT_FEATURE                          567
       uint32_t clwb                                                  : 1;
-#define CPUID_EBX_CLWB                                               0x1000000
+#define CPUID_EAX_07_EBX_CLWB                                        0x1000000
+#define CPUID_EAX_07_EBX_CLWB_FEATURE                                568
       uint32_t intel                                                 : 1;
-#define CPUID_EBX_INTEL                                              0x2000000
+#define CPUID_EAX_07_EBX_INTEL                                       0x2000000
+#define CPUID_EAX_07_EBX_INTEL_FEATURE                               569
       uint32_t avx512pf                                              : 1;
-#define CPUID_EBX_AVX512PF                                           0x4000000
+#define CPUID_EAX_07_EBX_AVX512PF                                    0x4000000
+#define CPUID_EAX_07_EBX_AVX512PF_FEATURE                            570
       uint32_t avx512er                                              : 1;
-#define CPUID_EBX_AVX512ER                                           0x8000000
+#define CPUID_EAX_07_EBX_AVX512ER                                    0x8000000
+#define CPUID_EAX_07_EBX_AVX512ER_FEATURE                            571
       uint32_t avx512cd                                              : 1;
-#define CPUID_EBX_AVX512CD                                           0x10000000
+#define CPUID_EAX_07_EBX_AVX512CD                                    0x10000000
+#define CPUID_EAX_07_EBX_AVX512CD_FEATURE                            572
       uint32_t sha                                                   : 1;
-#define CPUID_EBX_SHA                                                0x20000000
+#define CPUID_EAX_07_EBX_SHA                                         0x20000000
+#define CPUID_EAX_07_EBX_SHA_FEATURE                                 573
       uint32_t avx512bw                                              : 1;
-#define CPUID_EBX_AVX512BW                                           0x40000000
+#define CPUID_EAX_07_EBX_AVX512BW                                    0x40000000
+#define CPUID_EAX_07_EBX_AVX512BW_FEATURE                            574
       uint32_t avx512vl                                              : 1;
-#define CPUID_EBX_AVX512VL                                           0x80000000
+#define CPUID_EAX_07_EBX_AVX512VL                                    0x80000000
+#define CPUID_EAX_07_EBX_AVX512VL_FEATURE                            575
     };
 
     uint32_t Flags;
   } ebx;
+#define CPUID_EAX_07_EBX_RESERVED_BITS                               0x400000
 
   union {
     struct {
       uint32_t prefetchwt1                                           : 1;
-#define CPUID_ECX_PREFETCHWT1                                        0x01
+#define CPUID_EAX_07_ECX_PREFETCHWT1                                 0x01
+#define CPUID_EAX_07_ECX_PREFETCHWT1_FEATURE                         576
       uint32_t avx512_vbmi                                           : 1;
-#define CPUID_ECX_AVX512_VBMI                                        0x02
+#define CPUID_EAX_07_ECX_AVX512_VBMI                                 0x02
+#define CPUID_EAX_07_ECX_AVX512_VBMI_FEATURE                         577
       uint32_t umip                                                  : 1;
-#define CPUID_ECX_UMIP                                               0x04
+#define CPUID_EAX_07_ECX_UMIP                                        0x04
+#define CPUID_EAX_07_ECX_UMIP_FEATURE                                578
       uint32_t pku                                                   : 1;
-#define CPUID_ECX_PKU                                                0x08
+#define CPUID_EAX_07_ECX_PKU                                         0x08
+#define CPUID_EAX_07_ECX_PKU_FEATURE                                 579
       uint32_t ospke                                                 : 1;
-#define CPUID_ECX_OSPKE                                              0x10
+#define CPUID_EAX_07_ECX_OSPKE                                       0x10
+#define CPUID_EAX_07_ECX_OSPKE_FEATURE                               580
       uint32_t waitpkg                                               : 1;
-#define CPUID_ECX_WAITPKG                                            0x20
+#define CPUID_EAX_07_ECX_WAITPKG                                     0x20
+#define CPUID_EAX_07_ECX_WAITPKG_FEATURE                             581
       uint32_t avx512_vbmi2                                          : 1;
-#define CPUID_ECX_AVX512_VBMI2                                       0x40
+#define CPUID_EAX_07_ECX_AVX512_VBMI2                                0x40
+#define CPUID_EAX_07_ECX_AVX512_VBMI2_FEATURE                        582
       uint32_t cet_ss                                                : 1;
-#define CPUID_ECX_CET_SS                                             0x80
+#define CPUID_EAX_07_ECX_CET_SS                                      0x80
+#define CPUID_EAX_07_ECX_CET_SS_FEATURE                              583
       uint32_t gfni                                                  : 1;
-#define CPUID_ECX_GFNI                                               0x100
+#define CPUID_EAX_07_ECX_GFNI                                        0x100
+#define CPUID_EAX_07_ECX_GFNI_FEATURE                                584
       uint32_t vaes                                                  : 1;
-#define CPUID_ECX_VAES                                               0x200
+#define CPUID_EAX_07_ECX_VAES                                        0x200
+#define CPUID_EAX_07_ECX_VAES_FEATURE                                585
       uint32_t vpclmulqdq                                            : 1;
-#define CPUID_ECX_VPCLMULQDQ                                         0x400
+#define CPUID_EAX_07_ECX_VPCLMULQDQ                                  0x400
+#define CPUID_EAX_07_ECX_VPCLMULQDQ_FEATURE                          586
       uint32_t avx512_vnni                                           : 1;
-#define CPUID_ECX_AVX512_VNNI                                        0x800
+#define CPUID_EAX_07_ECX_AVX512_VNNI                                 0x800
+#define CPUID_EAX_07_ECX_AVX512_VNNI_FEATURE                         587
       uint32_t avx512_bitalg                                         : 1;
-#define CPUID_ECX_AVX512_BITALG                                      0x1000
+#define CPUID_EAX_07_ECX_AVX512_BITALG                               0x1000
+#define CPUID_EAX_07_ECX_AVX512_BITALG_FEATURE                       588
       uint32_t tme_en                                                : 1;
-#define CPUID_ECX_TME_EN                                             0x2000
+#define CPUID_EAX_07_ECX_TME_EN                                      0x2000
+#define CPUID_EAX_07_ECX_TME_EN_FEATURE                              589
       uint32_t avx512_vpopcntdq                                      : 1;
-#define CPUID_ECX_AVX512_VPOPCNTDQ                                   0x4000
+#define CPUID_EAX_07_ECX_AVX512_VPOPCNTDQ                            0x4000
+#define CPUID_EAX_07_ECX_AVX512_VPOPCNTDQ_FEATURE                    590
       uint32_t reserved_1                                            : 1;
       uint32_t la57                                                  : 1;
-#define CPUID_ECX_LA57                                               0x10000
+#define CPUID_EAX_07_ECX_LA57                                        0x10000
+#define CPUID_EAX_07_ECX_LA57_FEATURE                                592
       uint32_t mawau                                                 : 5;
-#define CPUID_ECX_MAWAU                                              0x3E0000
+#define CPUID_EAX_07_ECX_MAWAU                                       0x3E0000
       uint32_t rdpid                                                 : 1;
-#define CPUID_ECX_RDPID                                              0x400000
+#define CPUID_EAX_07_ECX_RDPID                                       0x400000
+#define CPUID_EAX_07_ECX_RDPID_FEATURE                               598
       uint32_t kl                                                    : 1;
-#define CPUID_ECX_KL                                                 0x800000
+#define CPUID_EAX_07_ECX_KL                                          0x800000
+#define CPUID_EAX_07_ECX_KL_FEATURE                                  599
       uint32_t reserved_2                                            : 1;
       uint32_t cldemote                                              : 1;
-#define CPUID_ECX_CLDEMOTE                                           0x2000000
+#define CPUID_EAX_07_ECX_CLDEMOTE                                    0x2000000
+#define CPUID_EAX_07_ECX_CLDEMOTE_FEATURE                            601
       uint32_t reserved_3                                            : 1;
       uint32_t movdiri                                               : 1;
-#define CPUID_ECX_MOVDIRI                                            0x8000000
+#define CPUID_EAX_07_ECX_MOVDIRI                                     0x8000000
+#define CPUID_EAX_07_ECX_MOVDIRI_FEATURE                             603
       uint32_t movdir64b                                             : 1;
-#define CPUID_ECX_MOVDIR64B                                          0x10000000
+#define CPUID_EAX_07_ECX_MOVDIR64B                                   0x10000000
+#define CPUID_EAX_07_ECX_MOVDIR64B_FEATURE                           604
       uint32_t reserved_4                                            : 1;
       uint32_t sgx_lc                                                : 1;
-#define CPUID_ECX_SGX_LC                                             0x40000000
+#define CPUID_EAX_07_ECX_SGX_LC                                      0x40000000
+#define CPUID_EAX_07_ECX_SGX_LC_FEATURE                              606
       uint32_t pks                                                   : 1;
-#define CPUID_ECX_PKS                                                0x80000000
+#define CPUID_EAX_07_ECX_PKS                                         0x80000000
+#define CPUID_EAX_07_ECX_PKS_FEATURE                                 607
     };
 
     uint32_t Flags;
   } ecx;
+#define CPUID_EAX_07_ECX_RESERVED_BITS                               0x25008000
 
   union {
     struct {
       uint32_t reserved_1                                            : 2;
       uint32_t avx512_4vnniw                                         : 1;
-#define CPUID_EDX_AVX512_4VNNIW                                      0x04
+#define CPUID_EAX_07_EDX_AVX512_4VNNIW                               0x04
+#define CPUID_EAX_07_EDX_AVX512_4VNNIW_FEATURE                       610
       uint32_t avx512_4fmaps                                         : 1;
-#define CPUID_EDX_AVX512_4FMAPS                                      0x08
+#define CPUID_EAX_07_EDX_AVX512_4FMAPS                               0x08
+#define CPUID_EAX_07_EDX_AVX512_4FMAPS_FEATURE                       611
       uint32_t fast_short_rep_mov                                    : 1;
-#define CPUID_EDX_FAST_SHORT_REP_MOV                                 0x10
+#define CPUID_EAX_07_EDX_FAST_SHORT_REP_MOV                          0x10
+#define CPUID_EAX_07_EDX_FAST_SHORT_REP_MOV_FEATURE                  612
       uint32_t reserved_2                                            : 3;
       uint32_t avx512_vp2intersect                                   : 1;
-#define CPUID_EDX_AVX512_VP2INTERSECT                                0x100
+#define CPUID_EAX_07_EDX_AVX512_VP2INTERSECT                         0x100
+#define CPUID_EAX_07_EDX_AVX512_VP2INTERSECT_FEATURE                 616
       uint32_t reserved_3                                            : 1;
       uint32_t md_clear                                              : 1;
-#define CPUID_EDX_MD_CLEAR                                           0x400
+#define CPUID_EAX_07_EDX_MD_CLEAR                                    0x400
+#define CPUID_EAX_07_EDX_MD_CLEAR_FEATURE                            618
       uint32_t reserved_4                                            : 3;
       uint32_t serialize                                             : 1;
-#define CPUID_EDX_SERIALIZE                                          0x4000
+#define CPUID_EAX_07_EDX_SERIALIZE                                   0x4000
+#define CPUID_EAX_07_EDX_SERIALIZE_FEATURE                           622
       uint32_t hybrid                                                : 1;
-#define CPUID_EDX_HYBRID                                             0x8000
+#define CPUID_EAX_07_EDX_HYBRID                                      0x8000
+#define CPUID_EAX_07_EDX_HYBRID_FEATURE                              623
       uint32_t reserved_5                                            : 2;
       uint32_t pconfig                                               : 1;
-#define CPUID_EDX_PCONFIG                                            0x40000
+#define CPUID_EAX_07_EDX_PCONFIG                                     0x40000
+#define CPUID_EAX_07_EDX_PCONFIG_FEATURE                             626
       uint32_t reserved_6                                            : 1;
       uint32_t cet_ibt                                               : 1;
-#define CPUID_EDX_CET_IBT                                            0x100000
+#define CPUID_EAX_07_EDX_CET_IBT                                     0x100000
+#define CPUID_EAX_07_EDX_CET_IBT_FEATURE                             628
       uint32_t reserved_7                                            : 5;
       uint32_t ibrs_ibpb                                             : 1;
-#define CPUID_EDX_IBRS_IBPB                                          0x4000000
+#define CPUID_EAX_07_EDX_IBRS_IBPB                                   0x4000000
+#define CPUID_EAX_07_EDX_IBRS_IBPB_FEATURE                           634
       uint32_t stibp                                                 : 1;
-#define CPUID_EDX_STIBP                                              0x8000000
+#define CPUID_EAX_07_EDX_STIBP                                       0x8000000
+#define CPUID_EAX_07_EDX_STIBP_FEATURE                               635
       uint32_t l1d_flush                                             : 1;
-#define CPUID_EDX_L1D_FLUSH                                          0x10000000
+#define CPUID_EAX_07_EDX_L1D_FLUSH                                   0x10000000
+#define CPUID_EAX_07_EDX_L1D_FLUSH_FEATURE                           636
       uint32_t ia32_arch_capabilities                                : 1;
-#define CPUID_EDX_IA32_ARCH_CAPABILITIES                             0x20000000
+#define CPUID_EAX_07_EDX_IA32_ARCH_CAPABILITIES                      0x20000000
+#define CPUID_EAX_07_EDX_IA32_ARCH_CAPABILITIES_FEATURE              637
       uint32_t ia32_core_capabilities                                : 1;
-#define CPUID_EDX_IA32_CORE_CAPABILITIES                             0x40000000
+#define CPUID_EAX_07_EDX_IA32_CORE_CAPABILITIES                      0x40000000
+#define CPUID_EAX_07_EDX_IA32_CORE_CAPABILITIES_FEATURE              638
       uint32_t ssbd                                                  : 1;
-#define CPUID_EDX_SSBD                                               0x80000000
+#define CPUID_EAX_07_EDX_SSBD                                        0x80000000
+#define CPUID_EAX_07_EDX_SSBD_FEATURE                                639
     };
 
     uint32_t Flags;
   } edx;
+#define CPUID_EAX_07_EDX_RESERVED_BITS                               0x3EB3AE3
 
 } cpuid_eax_07;
+#define CPUID_EAX_07_SNAPSHOT_INDEX                                  4
+#define CPUID_EAX_07_EAX_POLICY_AND                                  0xFFFFFFFF
+#define CPUID_EAX_07_EAX_POLICY_OR                                   0x00000000
+#define CPUID_EAX_07_EBX_POLICY_AND                                  0xFFBFFFFB
+#define CPUID_EAX_07_EBX_POLICY_OR                                   0x00000000
+#define CPUID_EAX_07_ECX_POLICY_AND                                  0x9AFF7FFF
+#define CPUID_EAX_07_ECX_POLICY_OR                                   0x00000000
+#define CPUID_EAX_07_EDX_POLICY_AND                                  0xFC14C51C
+#define CPUID_EAX_07_EDX_POLICY_OR                                   0x00000000
 
 typedef struct {
   union {
     struct {
       uint32_t sha512                                                : 1;
-#define CPUID_EAX_SHA512                                             0x01
+#define CPUID_EAX_07_ECX_01_EAX_SHA512                               0x01
+#define CPUID_EAX_07_ECX_01_EAX_SHA512_FEATURE                       640
       uint32_t sm3                                                   : 1;
-#define CPUID_EAX_SM3                                                0x02
+#define CPUID_EAX_07_ECX_01_EAX_SM3                                  0x02
+#define CPUID_EAX_07_ECX_01_EAX_SM3_FEATURE                          641
       uint32_t sm4                                                   : 1;
-#define CPUID_EAX_SM4                                                0x04
+#define CPUID_EAX_07_ECX_01_EAX_SM4                                  0x04
+#define CPUID_EAX_07_ECX_01_EAX_SM4_FEATURE                          642
       uint32_t reserved_1                                            : 1;
       uint32_t avx_vnni                                              : 1;
-#define CPUID_EAX_AVX_VNNI                                           0x10
+#define CPUID_EAX_07_ECX_01_EAX_AVX_VNNI                             0x10
+#define CPUID_EAX_07_ECX_01_EAX_AVX_VNNI_FEATURE                     644
       uint32_t avx512_bf16                                           : 1;
-#define CPUID_EAX_AVX512_BF16                                        0x20
+#define CPUID_EAX_07_ECX_01_EAX_AVX512_BF16                          0x20
+#define CPUID_EAX_07_ECX_01_EAX_AVX512_BF16_FEATURE                  645
       uint32_t lass                                                  : 1;
-#define CPUID_EAX_LASS                                               0x40
+#define CPUID_EAX_07_ECX_01_EAX_LASS                                 0x40
+#define CPUID_EAX_07_ECX_01_EAX_LASS_FEATURE                         646
       uint32_t cmpccxadd                                             : 1;
-#define CPUID_EAX_CMPCCXADD                                          0x80
+#define CPUID_EAX_07_ECX_01_EAX_CMPCCXADD                            0x80
+#define CPUID_EAX_07_ECX_01_EAX_CMPCCXADD_FEATURE                    647
       uint32_t arch_perfmon_ext                                      : 1;
-#define CPUID_EAX_ARCH_PERFMON_EXT                                   0x100
+#define CPUID_EAX_07_ECX_01_EAX_ARCH_PERFMON_EXT                     0x100
+#define CPUID_EAX_07_ECX_01_EAX_ARCH_PERFMON_EXT_FEATURE             648
       uint32_t reserved_2                                            : 1;
       uint32_t fast_rep_movsb                                        : 1;
-#define CPUID_EAX_FAST_REP_MOVSB                                     0x400
+#define CPUID_EAX_07_ECX_01_EAX_FAST_REP_MOVSB                       0x400
+#define CPUID_EAX_07_ECX_01_EAX_FAST_REP_MOVSB_FEATURE               650
       uint32_t fast_rep_stosb                                        : 1;
-#define CPUID_EAX_FAST_REP_STOSB                                     0x800
+#define CPUID_EAX_07_ECX_01_EAX_FAST_REP_STOSB                       0x800
+#define CPUID_EAX_07_ECX_01_EAX_FAST_REP_STOSB_FEATURE               651
       uint32_t fast_rep_cmpsb_scasb                                  : 1;
-#define CPUID_EAX_FAST_REP_CMPSB_SCASB                               0x1000
+#define CPUID_EAX_07_ECX_01_EAX_FAST_REP_CMPSB_SCASB                 0x1000
+#define CPUID_EAX_07_ECX_01_EAX_FAST_REP_CMPSB_SCASB_FEATURE         652
       uint32_t reserved_3                                            : 4;
       uint32_t fred                                                  : 1;
-#define CPUID_EAX_FRED                                               0x20000
+#define CPUID_EAX_07_ECX_01_EAX_FRED                                 0x20000
+#define CPUID_EAX_07_ECX_01_EAX_FRED_FEATURE                         657
       uint32_t lkgs                                                  : 1;
-#define CPUID_EAX_LKGS                                               0x40000
+#define CPUID_EAX_07_ECX_01_EAX_LKGS                                 0x40000
+#define CPUID_EAX_07_ECX_01_EAX_LKGS_FEATURE                         658
       uint32_t wrmsrns                                               : 1;
-#define CPUID_EAX_WRMSRNS                                            0x80000
+#define CPUID_EAX_07_ECX_01_EAX_WRMSRNS                              0x80000
+#define CPUID_EAX_07_ECX_01_EAX_WRMSRNS_FEATURE                      659
       uint32_t reserved_4                                            : 1;
       uint32_t amx_fp16                                              : 1;
-#define CPUID_EAX_AMX_FP16                                           0x200000
+#define CPUID_EAX_07_ECX_01_EAX_AMX_FP16                             0x200000
+#define CPUID_EAX_07_ECX_01_EAX_AMX_FP16_FEATURE                     661
       uint32_t hreset                                                : 1;
-#define CPUID_EAX_HRESET                                             0x400000
+#define CPUID_EAX_07_ECX_01_EAX_HRESET                               0x400000
+#define CPUID_EAX_07_ECX_01_EAX_HRESET_FEATURE                       662
       uint32_t avx_ifma                                              : 1;
-#define CPUID_EAX_AVX_IFMA                                           0x800000
+#define CPUID_EAX_07_ECX_01_EAX_AVX_IFMA                             0x800000
+#define CPUID_EAX_07_ECX_01_EAX_AVX_IFMA_FEATURE                     663
       uint32_t reserved_5                                            : 2;
       uint32_t lam                                                   : 1;
-#define CPUID_EAX_LAM                                                0x4000000
+#define CPUID_EAX_07_ECX_01_EAX_LAM                                  0x4000000
+#define CPUID_EAX_07_ECX_01_EAX_LAM_FEATURE                          666
       uint32_t msrlist                                               : 1;
-#define CPUID_EAX_MSRLIST                                            0x8000000
+#define CPUID_EAX_07_ECX_01_EAX_MSRLIST                              0x8000000
+#define CPUID_EAX_07_ECX_01_EAX_MSRLIST_FEATURE                      667
       uint32_t reserved_6                                            : 2;
       uint32_t invd_disable_post_bios_done                           : 1;
-#define CPUID_EAX_INVD_DISABLE_POST_BIOS_DONE                        0x40000000
+#define CPUID_EAX_07_ECX_01_EAX_INVD_DISABLE_POST_BIOS_DONE          0x40000000
+#define CPUID_EAX_07_ECX_01_EAX_INVD_DISABLE_POST_BIOS_DONE_FEATURE  670
       uint32_t reserved_7                                            : 1;
     };
 
     uint32_t Flags;
   } eax;
+#define CPUID_EAX_07_ECX_01_EAX_RESERVED_BITS                        0xB311E208
 
   union {
     struct {
       uint32_t ppin                                                  : 1;
-#define CPUID_EBX_PPIN                                               0x01
+#define CPUID_EAX_07_ECX_01_EBX_PPIN                                 0x01
+#define CPUID_EAX_07_ECX_01_EBX_PPIN_FEATURE                         672
       uint32_t pbndkb                                                : 1;
-#define CPUID_EBX_PBNDKB                                             0x02
+#define CPUID_EAX_07_ECX_01_EBX_PBNDKB                               0x02
+#define CPUID_EAX_07_ECX_01_EBX_PBNDKB_FEATURE                       673
       uint32_t reserved_1                                            : 1;
       uint32_t cpuidmaxval_lim_rmv                                   : 1;
-#define CPUID_EBX_CPUIDMAXVAL_LIM_RMV                                0x08
+#define CPUID_EAX_07_ECX_01_EBX_CPUIDMAXVAL_LIM_RMV                  0x08
+#define CPUID_EAX_07_ECX_01_EBX_CPUIDMAXVAL_LIM_RMV_FEATURE          675
       uint32_t reserved_2                                            : 28;
     };
 
     uint32_t Flags;
   } ebx;
+#define CPUID_EAX_07_ECX_01_EBX_RESERVED_BITS                        0xFFFFFFF4
 
   union {
     struct {
       uint32_t rdt_m_asym                                            : 1;
-#define CPUID_ECX_RDT_M_ASYM                                         0x01
+#define CPUID_EAX_07_ECX_01_ECX_RDT_M_ASYM                           0x01
+#define CPUID_EAX_07_ECX_01_ECX_RDT_M_ASYM_FEATURE                   704
       uint32_t rdt_a_asym                                            : 1;
-#define CPUID_ECX_RDT_A_ASYM                                         0x02
+#define CPUID_EAX_07_ECX_01_ECX_RDT_A_ASYM                           0x02
+#define CPUID_EAX_07_ECX_01_ECX_RDT_A_ASYM_FEATURE                   705
       uint32_t reserved_1                                            : 30;
     };
 
     uint32_t Flags;
   } ecx;
+#define CPUID_EAX_07_ECX_01_ECX_RESERVED_BITS                        0xFFFFFFFC
 
   union {
     struct {
       uint32_t reserved_1                                            : 4;
       uint32_t avx_vnni_int8                                         : 1;
-#define CPUID_EDX_AVX_VNNI_INT8                                      0x10
+#define CPUID_EAX_07_ECX_01_EDX_AVX_VNNI_INT8                        0x10
+#define CPUID_EAX_07_ECX_01_EDX_AVX_VNNI_INT8_FEATURE                740
       uint32_t avx_ne_convert                                        : 1;
-#define CPUID_EDX_AVX_NE_CONVERT                                     0x20
+#define CPUID_EAX_07_ECX_01_EDX_AVX_NE_CONVERT                       0x20
+#define CPUID_EAX_07_ECX_01_EDX_AVX_NE_CONVERT_FEATURE               741
       uint32_t reserved_2                                            : 2;
       uint32_t amx_complex                                           : 1;
-#define CPUID_EDX_AMX_COMPLEX                                        0x100
+#define CPUID_EAX_07_ECX_01_EDX_AMX_COMPLEX                          0x100
+#define CPUID_EAX_07_ECX_01_EDX_AMX_COMPLEX_FEATURE                  744
       uint32_t reserved_3                                            : 1;
       uint32_t avx_vnni_int16                                        : 1;
-#define CPUID_EDX_AVX_VNNI_INT16                                     0x400
+#define CPUID_EAX_07_ECX_01_EDX_AVX_VNNI_INT16                       0x400
+#define CPUID_EAX_07_ECX_01_EDX_AVX_VNNI_INT16_FEATURE               746
       uint32_t reserved_4                                            : 3;
       uint32_t prefetchi                                             : 1;
-#define CPUID_EDX_PREFETCHI                                          0x4000
+#define CPUID_EAX_07_ECX_01_EDX_PREFETCHI                            0x4000
+#define CPUID_EAX_07_ECX_01_EDX_PREFETCHI_FEATURE                    750
       uint32_t reserved_5                                            : 2;
       uint32_t uiret_uif                                             : 1;
-#define CPUID_EDX_UIRET_UIF                                          0x20000
+#define CPUID_EAX_07_ECX_01_EDX_UIRET_UIF                            0x20000
+#define CPUID_EAX_07_ECX_01_EDX_UIRET_UIF_FEATURE                    753
       uint32_t cet_sss                                               : 1;
-#define CPUID_EDX_CET_SSS                                            0x40000
+#define CPUID_EAX_07_ECX_01_EDX_CET_SSS                              0x40000
+#define CPUID_EAX_07_ECX_01_EDX_CET_SSS_FEATURE                      754
       uint32_t avx10                                                 : 1;
-#define CPUID_EDX_AVX10                                              0x80000
+#define CPUID_EAX_07_ECX_01_EDX_AVX10                                0x80000
+#define CPUID_EAX_07_ECX_01_EDX_AVX10_FEATURE                        755
       uint32_t reserved_6                                            : 2;
       uint32_t sec_tee_attestation                                   : 1;
-#define CPUID_EDX_SEC_TEE_ATTESTATION                                0x400000
+#define CPUID_EAX_07_ECX_01_EDX_SEC_TEE_ATTESTATION                  0x400000
+#define CPUID_EAX_07_ECX_01_EDX_SEC_TEE_ATTESTATION_FEATURE          758
       uint32_t mwait                                                 : 1;
-#define CPUID_EDX_MWAIT                                              0x800000
+#define CPUID_EAX_07_ECX_01_EDX_MWAIT                                0x800000
+#define CPUID_EAX_07_ECX_01_EDX_MWAIT_FEATURE                        759
       uint32_t slsm                                                  : 1;
-#define CPUID_EDX_SLSM                                               0x1000000
+#define CPUID_EAX_07_ECX_01_EDX_SLSM                                 0x1000000
+#define CPUID_EAX_07_ECX_01_EDX_SLSM_FEATURE                         760
       uint32_t reserved_7                                            : 7;
     };
 
     uint32_t Flags;
   } edx;
+#define CPUID_EAX_07_ECX_01_EDX_RESERVED_BITS                        0xFE31BACF
 
 } cpuid_eax_07_ecx_01;
+#define CPUID_EAX_07_ECX_01_SNAPSHOT_INDEX                           5
+#define CPUID_EAX_07_ECX_01_EAX_POLICY_AND                           0x4CEE1DF7
+#define CPUID_EAX_07_ECX_01_EAX_POLICY_OR                            0x00000000
+#define CPUID_EAX_07_ECX_01_EBX_POLICY_AND                           0x0000000B
+#define CPUID_EAX_07_ECX_01_EBX_POLICY_OR                            0x00000000
+#define CPUID_EAX_07_ECX_01_ECX_POLICY_AND                           0x00000003
+#define CPUID_EAX_07_ECX_01_ECX_POLICY_OR                            0x00000000
+#define CPUID_EAX_07_ECX_01_EDX_POLICY_AND                           0x01CE4530
+#define CPUID_EAX_07_ECX_01_EDX_POLICY_OR                            0x00000000
 
 /**
  * @}
@@ -944,148 +1218,186 @@ typedef struct {
   union {
     struct {
       uint32_t ia32_platform_dca_cap                                 : 32;
-#define CPUID_EAX_IA32_PLATFORM_DCA_CAP                              0xFFFFFFFF
+#define CPUID_EAX_09_EAX_IA32_PLATFORM_DCA_CAP                       0xFFFFFFFF
     };
 
     uint32_t Flags;
   } eax;
+#define CPUID_EAX_09_EAX_RESERVED_BITS                               0x00
 
   union {
     struct {
       uint32_t reserved                                              : 32;
-#define CPUID_EBX_RESERVED                                           0xFFFFFFFF
+#define CPUID_EAX_09_EBX_RESERVED                                    0xFFFFFFFF
     };
 
     uint32_t Flags;
   } ebx;
+#define CPUID_EAX_09_EBX_RESERVED_BITS                               0xFFFFFFFF
 
   union {
     struct {
       uint32_t reserved                                              : 32;
-#define CPUID_ECX_RESERVED                                           0xFFFFFFFF
+#define CPUID_EAX_09_ECX_RESERVED                                    0xFFFFFFFF
     };
 
     uint32_t Flags;
   } ecx;
+#define CPUID_EAX_09_ECX_RESERVED_BITS                               0xFFFFFFFF
 
   union {
     struct {
       uint32_t reserved                                              : 32;
-#define CPUID_EDX_RESERVED                                           0xFFFFFFFF
+#define CPUID_EAX_09_EDX_RESERVED                                    0xFFFFFFFF
     };
 
     uint32_t Flags;
   } edx;
+#define CPUID_EAX_09_EDX_RESERVED_BITS                               0xFFFFFFFF
 
 } cpuid_eax_09;
+#define CPUID_EAX_09_SNAPSHOT_INDEX                                  6
+#define CPUID_EAX_09_EAX_POLICY_AND                                  0xFFFFFFFF
+#define CPUID_EAX_09_EAX_POLICY_OR                                   0x00000000
+#define CPUID_EAX_09_EBX_POLICY_AND                                  0x00000000
+#define CPUID_EAX_09_EBX_POLICY_OR                                   0x00000000
+#define CPUID_EAX_09_ECX_POLICY_AND                                  0x00000000
+#define CPUID_EAX_09_ECX_POLICY_OR                                   0x00000000
+#define CPUID_EAX_09_EDX_POLICY_AND                                  0x00000000
+#define CPUID_EAX_09_EDX_POLICY_OR                                   0x00000000
 
 #define CPUID_ARCHITECTURAL_PERFORMANCE_MONITORING                   0x0000000A
 typedef struct {
   union {
     struct {
       uint32_t version_id_of_architectural_performance_monitoring    : 8;
-#define CPUID_EAX_VERSION_ID_OF_ARCHITECTURAL_PERFORMANCE_MONITORING 0xFF
+#define CPUID_EAX_0A_EAX_VERSION_ID_OF_ARCHITECTURAL_PERFORMANCE_MONITORING 0xFF
       uint32_t number_of_performance_monitoring_counter_per_logical_processor: 8;
-#define CPUID_EAX_NUMBER_OF_PERFORMANCE_MONITORING_COUNTER_PER_LOGICAL_PROCESSOR 0xFF00
+#define CPUID_EAX_0A_EAX_NUMBER_OF_PERFORMANCE_MONITORING_COUNTER_PER_LOGICAL_PROCESSOR 0xFF00
       uint32_t bit_width_of_performance_monitoring_counter           : 8;
-#define CPUID_EAX_BIT_WIDTH_OF_PERFORMANCE_MONITORING_COUNTER        0xFF0000
+#define CPUID_EAX_0A_EAX_BIT_WIDTH_OF_PERFORMANCE_MONITORING_COUNTER 0xFF0000
       uint32_t ebx_bit_vector_length                                 : 8;
-#define CPUID_EAX_EBX_BIT_VECTOR_LENGTH                              0xFF000000
+#define CPUID_EAX_0A_EAX_EBX_BIT_VECTOR_LENGTH                       0xFF000000
     };
 
     uint32_t Flags;
   } eax;
+#define CPUID_EAX_0A_EAX_RESERVED_BITS                               0x00
 
   union {
     struct {
       uint32_t core_cycle_event_not_available                        : 1;
-#define CPUID_EBX_CORE_CYCLE_EVENT_NOT_AVAILABLE                     0x01
+#define CPUID_EAX_0A_EBX_CORE_CYCLE_EVENT_NOT_AVAILABLE              0x01
+#define CPUID_EAX_0A_EBX_CORE_CYCLE_EVENT_NOT_AVAILABLE_FEATURE      928
       uint32_t instruction_retired_event_not_available               : 1;
-#define CPUID_EBX_INSTRUCTION_RETIRED_EVENT_NOT_AVAILABLE            0x02
+#define CPUID_EAX_0A_EBX_INSTRUCTION_RETIRED_EVENT_NOT_AVAILABLE     0x02
+#define CPUID_EAX_0A_EBX_INSTRUCTION_RETIRED_EVENT_NOT_AVAILABLE_FEATURE 929
       uint32_t reference_cycles_event_not_available                  : 1;
-#define CPUID_EBX_REFERENCE_CYCLES_EVENT_NOT_AVAILABLE               0x04
+#define CPUID_EAX_0A_EBX_REFERENCE_CYCLES_EVENT_NOT_AVAILABLE        0x04
+#define CPUID_EAX_0A_EBX_REFERENCE_CYCLES_EVENT_NOT_AVAILABLE_FEATURE 930
       uint32_t last_level_cache_reference_event_not_available        : 1;
-#define CPUID_EBX_LAST_LEVEL_CACHE_REFERENCE_EVENT_NOT_AVAILABLE     0x08
+#define CPUID_EAX_0A_EBX_LAST_LEVEL_CACHE_REFERENCE_EVENT_NOT_AVAILABLE 0x08
+#define CPUID_EAX_0A_EBX_LAST_LEVEL_CACHE_REFERENCE_EVENT_NOT_AVAILABLE_FEATURE 931
       uint32_t last_level_cache_misses_event_not_available           : 1;
-#define CPUID_EBX_LAST_LEVEL_CACHE_MISSES_EVENT_NOT_AVAILABLE        0x10
+#define CPUID_EAX_0A_EBX_LAST_LEVEL_CACHE_MISSES_EVENT_NOT_AVAILABLE 0x10
+#define CPUID_EAX_0A_EBX_LAST_LEVEL_CACHE_MISSES_EVENT_NOT_AVAILABLE_FEATURE 932
       uint32_t branch_instruction_retired_event_not_available        : 1;
-#define CPUID_EBX_BRANCH_INSTRUCTION_RETIRED_EVENT_NOT_AVAILABLE     0x20
+#define CPUID_EAX_0A_EBX_BRANCH_INSTRUCTION_RETIRED_EVENT_NOT_AVAILABLE 0x20
+#define CPUID_EAX_0A_EBX_BRANCH_INSTRUCTION_RETIRED_EVENT_NOT_AVAILABLE_FEATURE 933
       uint32_t branch_mispredict_retired_event_not_available         : 1;
-#define CPUID_EBX_BRANCH_MISPREDICT_RETIRED_EVENT_NOT_AVAILABLE      0x40
+#define CPUID_EAX_0A_EBX_BRANCH_MISPREDICT_RETIRED_EVENT_NOT_AVAILABLE 0x40
+#define CPUID_EAX_0A_EBX_BRANCH_MISPREDICT_RETIRED_EVENT_NOT_AVAILABLE_FEATURE 934
       uint32_t reserved_1                                            : 25;
     };
 
     uint32_t Flags;
   } ebx;
+#define CPUID_EAX_0A_EBX_RESERVED_BITS                               0xFFFFFF80
 
   union {
     struct {
       uint32_t reserved                                              : 32;
-#define CPUID_ECX_RESERVED                                           0xFFFFFFFF
+#define CPUID_EAX_0A_ECX_RESERVED                                    0xFFFFFFFF
     };
 
     uint32_t Flags;
   } ecx;
+#define CPUID_EAX_0A_ECX_RESERVED_BITS                               0xFFFFFFFF
 
   union {
     struct {
       uint32_t number_of_fixed_function_performance_counters         : 5;
-#define CPUID_EDX_NUMBER_OF_FIXED_FUNCTION_PERFORMANCE_COUNTERS      0x1F
+#define CPUID_EAX_0A_EDX_NUMBER_OF_FIXED_FUNCTION_PERFORMANCE_COUNTERS 0x1F
       uint32_t bit_width_of_fixed_function_performance_counters      : 8;
-#define CPUID_EDX_BIT_WIDTH_OF_FIXED_FUNCTION_PERFORMANCE_COUNTERS   0x1FE0
+#define CPUID_EAX_0A_EDX_BIT_WIDTH_OF_FIXED_FUNCTION_PERFORMANCE_COUNTERS 0x1FE0
       uint32_t reserved_1                                            : 2;
       uint32_t any_thread_deprecation                                : 1;
-#define CPUID_EDX_ANY_THREAD_DEPRECATION                             0x8000
+#define CPUID_EAX_0A_EDX_ANY_THREAD_DEPRECATION                      0x8000
+#define CPUID_EAX_0A_EDX_ANY_THREAD_DEPRECATION_FEATURE              1007
       uint32_t reserved_2                                            : 16;
     };
 
     uint32_t Flags;
   } edx;
+#define CPUID_EAX_0A_EDX_RESERVED_BITS                               0xFFFF6000
 
 } cpuid_eax_0a;
+#define CPUID_EAX_0A_SNAPSHOT_INDEX                                  7
+#define CPUID_EAX_0A_EAX_POLICY_AND                                  0xFFFFFFFF
+#define CPUID_EAX_0A_EAX_POLICY_OR                                   0x00000000
+#define CPUID_EAX_0A_EBX_POLICY_AND                                  0x0000007F
+#define CPUID_EAX_0A_EBX_POLICY_OR                                   0x00000000
+#define CPUID_EAX_0A_ECX_POLICY_AND                                  0x00000000
+#define CPUID_EAX_0A_ECX_POLICY_OR                                   0x00000000
+#define CPUID_EAX_0A_EDX_POLICY_AND                                  0x00009FFF
+#define CPUID_EAX_0A_EDX_POLICY_OR                                   0x00000000
 
 #define CPUID_EXTENDED_TOPOLOGY                                      0x0000000B
 typedef struct {
   union {
     struct {
       uint32_t x2apic_id_to_unique_topology_id_shift                 : 5;
-#define CPUID_EAX_X2APIC_ID_TO_UNIQUE_TOPOLOGY_ID_SHIFT              0x1F
+#define CPUID_EAX_0B_EAX_X2APIC_ID_TO_UNIQUE_TOPOLOGY_ID_SHIFT       0x1F
       uint32_t reserved_1                                            : 27;
     };
 
     uint32_t Flags;
   } eax;
+#define CPUID_EAX_0B_EAX_RESERVED_BITS                               0xFFFFFFE0
 
   union {
     struct {
       uint32_t number_of_logical_processors_at_this_level_type       : 16;
-#define CPUID_EBX_NUMBER_OF_LOGICAL_PROCESSORS_AT_THIS_LEVEL_TYPE    0xFFFF
+#define CPUID_EAX_0B_EBX_NUMBER_OF_LOGICAL_PROCESSORS_AT_THIS_LEVEL_TYPE 0xFFFF
       uint32_t reserved_1                                            : 16;
     };
 
     uint32_t Flags;
   } ebx;
+#define CPUID_EAX_0B_EBX_RESERVED_BITS                               0xFFFF0000
 
   union {
     struct {
       uint32_t level_number                                          : 8;
-#define CPUID_ECX_LEVEL_NUMBER                                       0xFF
+#define CPUID_EAX_0B_ECX_LEVEL_NUMBER                                0xFF
       uint32_t level_type                                            : 8;
-#define CPUID_ECX_LEVEL_TYPE                                         0xFF00
+#define CPUID_EAX_0B_ECX_LEVEL_TYPE                                  0xFF00
       uint32_t reserved_1                                            : 16;
     };
 
     uint32_t Flags;
   } ecx;
+#define CPUID_EAX_0B_ECX_RESERVED_BITS                               0xFFFF0000
 
   union {
     struct {
       uint32_t x2apic_id                                             : 32;
-#define CPUID_EDX_X2APIC_ID                                          0xFFFFFFFF
+#define CPUID_EAX_0B_EDX_X2APIC_ID                                   0xFFFFFFFF
     };
 
     uint32_t Flags;
   } edx;
+#define CPUID_EAX_0B_EDX_RESERVED_BITS                               0x00
 
 } cpuid_eax_0b;
 
@@ -1099,158 +1411,204 @@ typedef struct {
   union {
     struct {
       uint32_t x87_state                                             : 1;
-#define CPUID_EAX_X87_STATE                                          0x01
+#define CPUID_EAX_0D_ECX_00_EAX_X87_STATE                            0x01
+#define CPUID_EAX_0D_ECX_00_EAX_X87_STATE_FEATURE                    1024
       uint32_t sse_state                                             : 1;
-#define CPUID_EAX_SSE_STATE                                          0x02
+#define CPUID_EAX_0D_ECX_00_EAX_SSE_STATE                            0x02
+#define CPUID_EAX_0D_ECX_00_EAX_SSE_STATE_FEATURE                    1025
       uint32_t avx_state                                             : 1;
-#define CPUID_EAX_AVX_STATE                                          0x04
+#define CPUID_EAX_0D_ECX_00_EAX_AVX_STATE                            0x04
+#define CPUID_EAX_0D_ECX_00_EAX_AVX_STATE_FEATURE                    1026
       uint32_t mpx_state                                             : 2;
-#define CPUID_EAX_MPX_STATE                                          0x18
+#define CPUID_EAX_0D_ECX_00_EAX_MPX_STATE                            0x18
       uint32_t avx_512_state                                         : 3;
-#define CPUID_EAX_AVX_512_STATE                                      0xE0
+#define CPUID_EAX_0D_ECX_00_EAX_AVX_512_STATE                        0xE0
       uint32_t used_for_ia32_xss_1                                   : 1;
-#define CPUID_EAX_USED_FOR_IA32_XSS_1                                0x100
+#define CPUID_EAX_0D_ECX_00_EAX_USED_FOR_IA32_XSS_1                  0x100
+#define CPUID_EAX_0D_ECX_00_EAX_USED_FOR_IA32_XSS_1_FEATURE          1032
       uint32_t pkru_state                                            : 1;
-#define CPUID_EAX_PKRU_STATE                                         0x200
+#define CPUID_EAX_0D_ECX_00_EAX_PKRU_STATE                           0x200
+#define CPUID_EAX_0D_ECX_00_EAX_PKRU_STATE_FEATURE                   1033
       uint32_t reserved_1                                            : 3;
       uint32_t used_for_ia32_xss_2                                   : 1;
-#define CPUID_EAX_USED_FOR_IA32_XSS_2                                0x2000
+#define CPUID_EAX_0D_ECX_00_EAX_USED_FOR_IA32_XSS_2                  0x2000
+#define CPUID_EAX_0D_ECX_00_EAX_USED_FOR_IA32_XSS_2_FEATURE          1037
       uint32_t reserved_2                                            : 18;
     };
 
     uint32_t Flags;
   } eax;
+#define CPUID_EAX_0D_ECX_00_EAX_RESERVED_BITS                        0xFFFFDC00
 
   union {
     struct {
       uint32_t max_size_required_by_enabled_features_in_xcr0         : 32;
-#define CPUID_EBX_MAX_SIZE_REQUIRED_BY_ENABLED_FEATURES_IN_XCR0      0xFFFFFFFF
+#define CPUID_EAX_0D_ECX_00_EBX_MAX_SIZE_REQUIRED_BY_ENABLED_FEATURES_IN_XCR0 0xFFFFFFFF
     };
 
     uint32_t Flags;
   } ebx;
+#define CPUID_EAX_0D_ECX_00_EBX_RESERVED_BITS                        0x00
 
   union {
     struct {
       uint32_t max_size_of_xsave_xrstor_save_area                    : 32;
-#define CPUID_ECX_MAX_SIZE_OF_XSAVE_XRSTOR_SAVE_AREA                 0xFFFFFFFF
+#define CPUID_EAX_0D_ECX_00_ECX_MAX_SIZE_OF_XSAVE_XRSTOR_SAVE_AREA   0xFFFFFFFF
     };
 
     uint32_t Flags;
   } ecx;
+#define CPUID_EAX_0D_ECX_00_ECX_RESERVED_BITS                        0x00
 
   union {
     struct {
       uint32_t xcr0_supported_bits                                   : 32;
-#define CPUID_EDX_XCR0_SUPPORTED_BITS                                0xFFFFFFFF
+#define CPUID_EAX_0D_ECX_00_EDX_XCR0_SUPPORTED_BITS                  0xFFFFFFFF
     };
 
     uint32_t Flags;
   } edx;
+#define CPUID_EAX_0D_ECX_00_EDX_RESERVED_BITS                        0x00
 
 } cpuid_eax_0d_ecx_00;
+#define CPUID_EAX_0D_ECX_00_SNAPSHOT_INDEX                           8
+#define CPUID_EAX_0D_ECX_00_EAX_POLICY_AND                           0x000023FF
+#define CPUID_EAX_0D_ECX_00_EAX_POLICY_OR                            0x00000000
+#define CPUID_EAX_0D_ECX_00_EBX_POLICY_AND                           0xFFFFFFFF
+#define CPUID_EAX_0D_ECX_00_EBX_POLICY_OR                            0x00000000
+#define CPUID_EAX_0D_ECX_00_ECX_POLICY_AND                           0xFFFFFFFF
+#define CPUID_EAX_0D_ECX_00_ECX_POLICY_OR                            0x00000000
+#define CPUID_EAX_0D_ECX_00_EDX_POLICY_AND                           0xFFFFFFFF
+#define CPUID_EAX_0D_ECX_00_EDX_POLICY_OR                            0x00000000
 
 typedef struct {
   union {
     struct {
       uint32_t reserved_1                                            : 1;
       uint32_t supports_xsavec_and_compacted_xrstor                  : 1;
-#define CPUID_EAX_SUPPORTS_XSAVEC_AND_COMPACTED_XRSTOR               0x02
+#define CPUID_EAX_0D_ECX_01_EAX_SUPPORTS_XSAVEC_AND_COMPACTED_XRSTOR 0x02
+#define CPUID_EAX_0D_ECX_01_EAX_SUPPORTS_XSAVEC_AND_COMPACTED_XRSTOR_FEATURE 1153
       uint32_t supports_xgetbv_with_ecx_1                            : 1;
-#define CPUID_EAX_SUPPORTS_XGETBV_WITH_ECX_1                         0x04
+#define CPUID_EAX_0D_ECX_01_EAX_SUPPORTS_XGETBV_WITH_ECX_1           0x04
+#define CPUID_EAX_0D_ECX_01_EAX_SUPPORTS_XGETBV_WITH_ECX_1_FEATURE   1154
       uint32_t supports_xsave_xrstor_and_ia32_xss                    : 1;
-#define CPUID_EAX_SUPPORTS_XSAVE_XRSTOR_AND_IA32_XSS                 0x08
+#define CPUID_EAX_0D_ECX_01_EAX_SUPPORTS_XSAVE_XRSTOR_AND_IA32_XSS   0x08
+#define CPUID_EAX_0D_ECX_01_EAX_SUPPORTS_XSAVE_XRSTOR_AND_IA32_XSS_FEATURE 1155
       uint32_t reserved_2                                            : 28;
     };
 
     uint32_t Flags;
   } eax;
+#define CPUID_EAX_0D_ECX_01_EAX_RESERVED_BITS                        0xFFFFFFF1
 
   union {
     struct {
       uint32_t size_of_xsave_aread                                   : 32;
-#define CPUID_EBX_SIZE_OF_XSAVE_AREAD                                0xFFFFFFFF
+#define CPUID_EAX_0D_ECX_01_EBX_SIZE_OF_XSAVE_AREAD                  0xFFFFFFFF
     };
 
     uint32_t Flags;
   } ebx;
+#define CPUID_EAX_0D_ECX_01_EBX_RESERVED_BITS                        0x00
 
   union {
     struct {
       uint32_t used_for_xcr0_1                                       : 8;
-#define CPUID_ECX_USED_FOR_XCR0_1                                    0xFF
+#define CPUID_EAX_0D_ECX_01_ECX_USED_FOR_XCR0_1                      0xFF
       uint32_t pt_state                                              : 1;
-#define CPUID_ECX_PT_STATE                                           0x100
+#define CPUID_EAX_0D_ECX_01_ECX_PT_STATE                             0x100
+#define CPUID_EAX_0D_ECX_01_ECX_PT_STATE_FEATURE                     1224
       uint32_t used_for_xcr0_2                                       : 1;
-#define CPUID_ECX_USED_FOR_XCR0_2                                    0x200
+#define CPUID_EAX_0D_ECX_01_ECX_USED_FOR_XCR0_2                      0x200
+#define CPUID_EAX_0D_ECX_01_ECX_USED_FOR_XCR0_2_FEATURE              1225
       uint32_t reserved_1                                            : 1;
       uint32_t cet_user_state                                        : 1;
-#define CPUID_ECX_CET_USER_STATE                                     0x800
+#define CPUID_EAX_0D_ECX_01_ECX_CET_USER_STATE                       0x800
+#define CPUID_EAX_0D_ECX_01_ECX_CET_USER_STATE_FEATURE               1227
       uint32_t cet_supervisor_state                                  : 1;
-#define CPUID_ECX_CET_SUPERVISOR_STATE                               0x1000
+#define CPUID_EAX_0D_ECX_01_ECX_CET_SUPERVISOR_STATE                 0x1000
+#define CPUID_EAX_0D_ECX_01_ECX_CET_SUPERVISOR_STATE_FEATURE         1228
       uint32_t hdc_state                                             : 1;
-#define CPUID_ECX_HDC_STATE                                          0x2000
+#define CPUID_EAX_0D_ECX_01_ECX_HDC_STATE                            0x2000
+#define CPUID_EAX_0D_ECX_01_ECX_HDC_STATE_FEATURE                    1229
       uint32_t reserved_2                                            : 1;
       uint32_t lbr_state                                             : 1;
-#define CPUID_ECX_LBR_STATE                                          0x8000
+#define CPUID_EAX_0D_ECX_01_ECX_LBR_STATE                            0x8000
+#define CPUID_EAX_0D_ECX_01_ECX_LBR_STATE_FEATURE                    1231
       uint32_t hwp_state                                             : 1;
-#define CPUID_ECX_HWP_STATE                                          0x10000
+#define CPUID_EAX_0D_ECX_01_ECX_HWP_STATE                            0x10000
+#define CPUID_EAX_0D_ECX_01_ECX_HWP_STATE_FEATURE                    1232
       uint32_t reserved_3                                            : 15;
     };
 
     uint32_t Flags;
   } ecx;
+#define CPUID_EAX_0D_ECX_01_ECX_RESERVED_BITS                        0xFFFE4400
 
   union {
     struct {
       uint32_t supported_upper_ia32_xss_bits                         : 32;
-#define CPUID_EDX_SUPPORTED_UPPER_IA32_XSS_BITS                      0xFFFFFFFF
+#define CPUID_EAX_0D_ECX_01_EDX_SUPPORTED_UPPER_IA32_XSS_BITS        0xFFFFFFFF
     };
 
     uint32_t Flags;
   } edx;
+#define CPUID_EAX_0D_ECX_01_EDX_RESERVED_BITS                        0x00
 
 } cpuid_eax_0d_ecx_01;
+#define CPUID_EAX_0D_ECX_01_SNAPSHOT_INDEX                           9
+#define CPUID_EAX_0D_ECX_01_EAX_POLICY_AND                           0x0000000E
+#define CPUID_EAX_0D_ECX_01_EAX_POLICY_OR                            0x00000000
+#define CPUID_EAX_0D_ECX_01_EBX_POLICY_AND                           0xFFFFFFFF
+#define CPUID_EAX_0D_ECX_01_EBX_POLICY_OR                            0x00000000
+#define CPUID_EAX_0D_ECX_01_ECX_POLICY_AND                           0x0001BBFF
+#define CPUID_EAX_0D_ECX_01_ECX_POLICY_OR                            0x00000000
+#define CPUID_EAX_0D_ECX_01_EDX_POLICY_AND                           0xFFFFFFFF
+#define CPUID_EAX_0D_ECX_01_EDX_POLICY_OR                            0x00000000
 
 typedef struct {
   union {
     struct {
-      uint32_t ia32_platform_dca_cap                                 : 32;
-#define CPUID_EAX_IA32_PLATFORM_DCA_CAP                              0xFFFFFFFF
+      uint32_t size                                                  : 32;
+#define CPUID_EAX_0D_ECX_N_EAX_SIZE                                  0xFFFFFFFF
     };
 
     uint32_t Flags;
   } eax;
+#define CPUID_EAX_0D_ECX_N_EAX_RESERVED_BITS                         0x00
 
   union {
     struct {
-      uint32_t reserved                                              : 32;
-#define CPUID_EBX_RESERVED                                           0xFFFFFFFF
+      uint32_t offset                                                : 32;
+#define CPUID_EAX_0D_ECX_N_EBX_OFFSET                                0xFFFFFFFF
     };
 
     uint32_t Flags;
   } ebx;
+#define CPUID_EAX_0D_ECX_N_EBX_RESERVED_BITS                         0x00
 
   union {
     struct {
-      uint32_t ecx_2                                                 : 1;
-#define CPUID_ECX_ECX_2                                              0x01
-      uint32_t ecx_1                                                 : 1;
-#define CPUID_ECX_ECX_1                                              0x02
+      uint32_t supported_in_ia32_xss                                 : 1;
+#define CPUID_EAX_0D_ECX_N_ECX_SUPPORTED_IN_IA32_XSS                 0x01
+      uint32_t aligned_64_bytes                                      : 1;
+#define CPUID_EAX_0D_ECX_N_ECX_ALIGNED_64_BYTES                      0x02
       uint32_t reserved_1                                            : 30;
     };
 
     uint32_t Flags;
   } ecx;
+#define CPUID_EAX_0D_ECX_N_ECX_RESERVED_BITS                         0xFFFFFFFC
 
   union {
     struct {
       uint32_t reserved                                              : 32;
-#define CPUID_EDX_RESERVED                                           0xFFFFFFFF
+#define CPUID_EAX_0D_ECX_N_EDX_RESERVED                              0xFFFFFFFF
     };
 
     uint32_t Flags;
   } edx;
+#define CPUID_EAX_0D_ECX_N_EDX_RESERVED_BITS                         0xFFFFFFFF
 
 } cpuid_eax_0d_ecx_n;
 
@@ -1268,86 +1626,116 @@ typedef struct {
   union {
     struct {
       uint32_t reserved                                              : 32;
-#define CPUID_EAX_RESERVED                                           0xFFFFFFFF
+#define CPUID_EAX_0F_ECX_00_EAX_RESERVED                             0xFFFFFFFF
     };
 
     uint32_t Flags;
   } eax;
+#define CPUID_EAX_0F_ECX_00_EAX_RESERVED_BITS                        0xFFFFFFFF
 
   union {
     struct {
       uint32_t rmid_max_range                                        : 32;
-#define CPUID_EBX_RMID_MAX_RANGE                                     0xFFFFFFFF
+#define CPUID_EAX_0F_ECX_00_EBX_RMID_MAX_RANGE                       0xFFFFFFFF
     };
 
     uint32_t Flags;
   } ebx;
+#define CPUID_EAX_0F_ECX_00_EBX_RESERVED_BITS                        0x00
 
   union {
     struct {
       uint32_t reserved                                              : 32;
-#define CPUID_ECX_RESERVED                                           0xFFFFFFFF
+#define CPUID_EAX_0F_ECX_00_ECX_RESERVED                             0xFFFFFFFF
     };
 
     uint32_t Flags;
   } ecx;
+#define CPUID_EAX_0F_ECX_00_ECX_RESERVED_BITS                        0xFFFFFFFF
 
   union {
     struct {
       uint32_t reserved_1                                            : 1;
       uint32_t supports_l3_cache_intel_rdt_monitoring                : 1;
-#define CPUID_EDX_SUPPORTS_L3_CACHE_INTEL_RDT_MONITORING             0x02
+#define CPUID_EAX_0F_ECX_00_EDX_SUPPORTS_L3_CACHE_INTEL_RDT_MONITORING 0x02
+#define CPUID_EAX_0F_ECX_00_EDX_SUPPORTS_L3_CACHE_INTEL_RDT_MONITORING_FEATURE 1377
       uint32_t reserved_2                                            : 30;
     };
 
     uint32_t Flags;
   } edx;
+#define CPUID_EAX_0F_ECX_00_EDX_RESERVED_BITS                        0xFFFFFFFD
 
 } cpuid_eax_0f_ecx_00;
+#define CPUID_EAX_0F_ECX_00_SNAPSHOT_INDEX                           10
+#define CPUID_EAX_0F_ECX_00_EAX_POLICY_AND                           0x00000000
+#define CPUID_EAX_0F_ECX_00_EAX_POLICY_OR                            0x00000000
+#define CPUID_EAX_0F_ECX_00_EBX_POLICY_AND                           0xFFFFFFFF
+#define CPUID_EAX_0F_ECX_00_EBX_POLICY_OR                            0x00000000
+#define CPUID_EAX_0F_ECX_00_ECX_POLICY_AND                           0x00000000
+#define CPUID_EAX_0F_ECX_00_ECX_POLICY_OR                            0x00000000
+#define CPUID_EAX_0F_ECX_00_EDX_POLICY_AND                           0x00000002
+#define CPUID_EAX_0F_ECX_00_EDX_POLICY_OR                            0x00000000
 
 typedef struct {
   union {
     struct {
       uint32_t reserved                                              : 32;
-#define CPUID_EAX_RESERVED                                           0xFFFFFFFF
+#define CPUID_EAX_0F_ECX_01_EAX_RESERVED                             0xFFFFFFFF
     };
 
     uint32_t Flags;
   } eax;
+#define CPUID_EAX_0F_ECX_01_EAX_RESERVED_BITS                        0xFFFFFFFF
 
   union {
     struct {
       uint32_t conversion_factor                                     : 32;
-#define CPUID_EBX_CONVERSION_FACTOR                                  0xFFFFFFFF
+#define CPUID_EAX_0F_ECX_01_EBX_CONVERSION_FACTOR                    0xFFFFFFFF
     };
 
     uint32_t Flags;
   } ebx;
+#define CPUID_EAX_0F_ECX_01_EBX_RESERVED_BITS                        0x00
 
   union {
     struct {
       uint32_t rmid_max_range                                        : 32;
-#define CPUID_ECX_RMID_MAX_RANGE                                     0xFFFFFFFF
+#define CPUID_EAX_0F_ECX_01_ECX_RMID_MAX_RANGE                       0xFFFFFFFF
     };
 
     uint32_t Flags;
   } ecx;
+#define CPUID_EAX_0F_ECX_01_ECX_RESERVED_BITS                        0x00
 
   union {
     struct {
       uint32_t supports_l3_occupancy_monitoring                      : 1;
-#define CPUID_EDX_SUPPORTS_L3_OCCUPANCY_MONITORING                   0x01
+#define CPUID_EAX_0F_ECX_01_EDX_SUPPORTS_L3_OCCUPANCY_MONITORING     0x01
+#define CPUID_EAX_0F_ECX_01_EDX_SUPPORTS_L3_OCCUPANCY_MONITORING_FEATURE 1504
       uint32_t supports_l3_total_bandwidth_monitoring                : 1;
-#define CPUID_EDX_SUPPORTS_L3_TOTAL_BANDWIDTH_MONITORING             0x02
+#define CPUID_EAX_0F_ECX_01_EDX_SUPPORTS_L3_TOTAL_BANDWIDTH_MONITORING 0x02
+#define CPUID_EAX_0F_ECX_01_EDX_SUPPORTS_L3_TOTAL_BANDWIDTH_MONITORING_FEATURE 1505
       uint32_t supports_l3_local_bandwidth_monitoring                : 1;
-#define CPUID_EDX_SUPPORTS_L3_LOCAL_BANDWIDTH_MONITORING             0x04
+#define CPUID_EAX_0F_ECX_01_EDX_SUPPORTS_L3_LOCAL_BANDWIDTH_MONITORING 0x04
+#define CPUID_EAX_0F_ECX_01_EDX_SUPPORTS_L3_LOCAL_BANDWIDTH_MONITORING_FEATURE 1506
       uint32_t reserved_1                                            : 29;
     };
 
     uint32_t Flags;
   } edx;
+#define CPUID_EAX_0F_ECX_01_EDX_RESERVED_BITS                        0xFFFFFFF8
 
 } cpuid_eax_0f_ecx_01;
+#define CPUID_EAX_0F_ECX_01_SNAPSHOT_INDEX                           11
+#define CPUID_EAX_0F_ECX_01_EAX_POLICY_AND                           0x00000000
+#define CPUID_EAX_0F_ECX_01_EAX_POLICY_OR                            0x00000000
+#define CPUID_EAX_0F_ECX_01_EBX_POLICY_AND                           0xFFFFFFFF
+#define CPUID_EAX_0F_ECX_01_EBX_POLICY_OR                            0x00000000
+#define CPUID_EAX_0F_ECX_01_ECX_POLICY_AND                           0xFFFFFFFF
+#define CPUID_EAX_0F_ECX_01_ECX_POLICY_OR                            0x00000000
+#define CPUID_EAX_0F_ECX_01_EDX_POLICY_AND                           0x00000007
+#define CPUID_EAX_0F_ECX_01_EDX_POLICY_OR                            0x00000000
 
 /**
  * @}
@@ -1363,173 +1751,230 @@ typedef struct {
   union {
     struct {
       uint32_t ia32_platform_dca_cap                                 : 32;
-#define CPUID_EAX_IA32_PLATFORM_DCA_CAP                              0xFFFFFFFF
+#define CPUID_EAX_10_ECX_00_EAX_IA32_PLATFORM_DCA_CAP                0xFFFFFFFF
     };
 
     uint32_t Flags;
   } eax;
+#define CPUID_EAX_10_ECX_00_EAX_RESERVED_BITS                        0x00
 
   union {
     struct {
       uint32_t reserved_1                                            : 1;
       uint32_t supports_l3_cache_allocation_technology               : 1;
-#define CPUID_EBX_SUPPORTS_L3_CACHE_ALLOCATION_TECHNOLOGY            0x02
+#define CPUID_EAX_10_ECX_00_EBX_SUPPORTS_L3_CACHE_ALLOCATION_TECHNOLOGY 0x02
+#define CPUID_EAX_10_ECX_00_EBX_SUPPORTS_L3_CACHE_ALLOCATION_TECHNOLOGY_FEATURE 1569
       uint32_t supports_l2_cache_allocation_technology               : 1;
-#define CPUID_EBX_SUPPORTS_L2_CACHE_ALLOCATION_TECHNOLOGY            0x04
+#define CPUID_EAX_10_ECX_00_EBX_SUPPORTS_L2_CACHE_ALLOCATION_TECHNOLOGY 0x04
+#define CPUID_EAX_10_ECX_00_EBX_SUPPORTS_L2_CACHE_ALLOCATION_TECHNOLOGY_FEATURE 1570
       uint32_t supports_memory_bandwidth_allocation                  : 1;
-#define CPUID_EBX_SUPPORTS_MEMORY_BANDWIDTH_ALLOCATION               0x08
+#define CPUID_EAX_10_ECX_00_EBX_SUPPORTS_MEMORY_BANDWIDTH_ALLOCATION 0x08
+#define CPUID_EAX_10_ECX_00_EBX_SUPPORTS_MEMORY_BANDWIDTH_ALLOCATION_FEATURE 1571
       uint32_t reserved_2                                            : 28;
     };
 
     uint32_t Flags;
   } ebx;
+#define CPUID_EAX_10_ECX_00_EBX_RESERVED_BITS                        0xFFFFFFF1
 
   union {
     struct {
       uint32_t reserved                                              : 32;
-#define CPUID_ECX_RESERVED                                           0xFFFFFFFF
+#define CPUID_EAX_10_ECX_00_ECX_RESERVED                             0xFFFFFFFF
     };
 
     uint32_t Flags;
   } ecx;
+#define CPUID_EAX_10_ECX_00_ECX_RESERVED_BITS                        0xFFFFFFFF
 
   union {
     struct {
       uint32_t reserved                                              : 32;
-#define CPUID_EDX_RESERVED                                           0xFFFFFFFF
+#define CPUID_EAX_10_ECX_00_EDX_RESERVED                             0xFFFFFFFF
     };
 
     uint32_t Flags;
   } edx;
+#define CPUID_EAX_10_ECX_00_EDX_RESERVED_BITS                        0xFFFFFFFF
 
 } cpuid_eax_10_ecx_00;
+#define CPUID_EAX_10_ECX_00_SNAPSHOT_INDEX                           12
+#define CPUID_EAX_10_ECX_00_EAX_POLICY_AND                           0xFFFFFFFF
+#define CPUID_EAX_10_ECX_00_EAX_POLICY_OR                            0x00000000
+#define CPUID_EAX_10_ECX_00_EBX_POLICY_AND                           0x0000000E
+#define CPUID_EAX_10_ECX_00_EBX_POLICY_OR                            0x00000000
+#define CPUID_EAX_10_ECX_00_ECX_POLICY_AND                           0x00000000
+#define CPUID_EAX_10_ECX_00_ECX_POLICY_OR                            0x00000000
+#define CPUID_EAX_10_ECX_00_EDX_POLICY_AND                           0x00000000
+#define CPUID_EAX_10_ECX_00_EDX_POLICY_OR                            0x00000000
 
 typedef struct {
   union {
     struct {
       uint32_t length_of_capacity_bit_mask                           : 5;
-#define CPUID_EAX_LENGTH_OF_CAPACITY_BIT_MASK                        0x1F
+#define CPUID_EAX_10_ECX_01_EAX_LENGTH_OF_CAPACITY_BIT_MASK          0x1F
       uint32_t reserved_1                                            : 27;
     };
 
     uint32_t Flags;
   } eax;
+#define CPUID_EAX_10_ECX_01_EAX_RESERVED_BITS                        0xFFFFFFE0
 
   union {
     struct {
       uint32_t ebx_0                                                 : 32;
-#define CPUID_EBX_EBX_0                                              0xFFFFFFFF
+#define CPUID_EAX_10_ECX_01_EBX_EBX_0                                0xFFFFFFFF
     };
 
     uint32_t Flags;
   } ebx;
+#define CPUID_EAX_10_ECX_01_EBX_RESERVED_BITS                        0x00
 
   union {
     struct {
       uint32_t reserved_1                                            : 2;
       uint32_t code_and_data_priorization_technology_supported       : 1;
-#define CPUID_ECX_CODE_AND_DATA_PRIORIZATION_TECHNOLOGY_SUPPORTED    0x04
+#define CPUID_EAX_10_ECX_01_ECX_CODE_AND_DATA_PRIORIZATION_TECHNOLOGY_SUPPORTED 0x04
+#define CPUID_EAX_10_ECX_01_ECX_CODE_AND_DATA_PRIORIZATION_TECHNOLOGY_SUPPORTED_FEATURE 1730
       uint32_t reserved_2                                            : 29;
     };
 
     uint32_t Flags;
   } ecx;
+#define CPUID_EAX_10_ECX_01_ECX_RESERVED_BITS                        0xFFFFFFFB
 
   union {
     struct {
       uint32_t highest_cos_number_supported                          : 16;
-#define CPUID_EDX_HIGHEST_COS_NUMBER_SUPPORTED                       0xFFFF
+#define CPUID_EAX_10_ECX_01_EDX_HIGHEST_COS_NUMBER_SUPPORTED         0xFFFF
       uint32_t reserved_1                                            : 16;
     };
 
     uint32_t Flags;
   } edx;
+#define CPUID_EAX_10_ECX_01_EDX_RESERVED_BITS                        0xFFFF0000
 
 } cpuid_eax_10_ecx_01;
+#define CPUID_EAX_10_ECX_01_SNAPSHOT_INDEX                           13
+#define CPUID_EAX_10_ECX_01_EAX_POLICY_AND                           0x0000001F
+#define CPUID_EAX_10_ECX_01_EAX_POLICY_OR                            0x00000000
+#define CPUID_EAX_10_ECX_01_EBX_POLICY_AND                           0xFFFFFFFF
+#define CPUID_EAX_10_ECX_01_EBX_POLICY_OR                            0x00000000
+#define CPUID_EAX_10_ECX_01_ECX_POLICY_AND                           0x00000004
+#define CPUID_EAX_10_ECX_01_ECX_POLICY_OR                            0x00000000
+#define CPUID_EAX_10_ECX_01_EDX_POLICY_AND                           0x0000FFFF
+#define CPUID_EAX_10_ECX_01_EDX_POLICY_OR                            0x00000000
 
 typedef struct {
   union {
     struct {
       uint32_t length_of_capacity_bit_mask                           : 5;
-#define CPUID_EAX_LENGTH_OF_CAPACITY_BIT_MASK                        0x1F
+#define CPUID_EAX_10_ECX_02_EAX_LENGTH_OF_CAPACITY_BIT_MASK          0x1F
       uint32_t reserved_1                                            : 27;
     };
 
     uint32_t Flags;
   } eax;
+#define CPUID_EAX_10_ECX_02_EAX_RESERVED_BITS                        0xFFFFFFE0
 
   union {
     struct {
       uint32_t ebx_0                                                 : 32;
-#define CPUID_EBX_EBX_0                                              0xFFFFFFFF
+#define CPUID_EAX_10_ECX_02_EBX_EBX_0                                0xFFFFFFFF
     };
 
     uint32_t Flags;
   } ebx;
+#define CPUID_EAX_10_ECX_02_EBX_RESERVED_BITS                        0x00
 
   union {
     struct {
       uint32_t reserved                                              : 32;
-#define CPUID_ECX_RESERVED                                           0xFFFFFFFF
+#define CPUID_EAX_10_ECX_02_ECX_RESERVED                             0xFFFFFFFF
     };
 
     uint32_t Flags;
   } ecx;
+#define CPUID_EAX_10_ECX_02_ECX_RESERVED_BITS                        0xFFFFFFFF
 
   union {
     struct {
       uint32_t highest_cos_number_supported                          : 16;
-#define CPUID_EDX_HIGHEST_COS_NUMBER_SUPPORTED                       0xFFFF
+#define CPUID_EAX_10_ECX_02_EDX_HIGHEST_COS_NUMBER_SUPPORTED         0xFFFF
       uint32_t reserved_1                                            : 16;
     };
 
     uint32_t Flags;
   } edx;
+#define CPUID_EAX_10_ECX_02_EDX_RESERVED_BITS                        0xFFFF0000
 
 } cpuid_eax_10_ecx_02;
+#define CPUID_EAX_10_ECX_02_SNAPSHOT_INDEX                           14
+#define CPUID_EAX_10_ECX_02_EAX_POLICY_AND                           0x0000001F
+#define CPUID_EAX_10_ECX_02_EAX_POLICY_OR                            0x00000000
+#define CPUID_EAX_10_ECX_02_EBX_POLICY_AND                           0xFFFFFFFF
+#define CPUID_EAX_10_ECX_02_EBX_POLICY_OR                            0x00000000
+#define CPUID_EAX_10_ECX_02_ECX_POLICY_AND                           0x00000000
+#define CPUID_EAX_10_ECX_02_ECX_POLICY_OR                            0x00000000
+#define CPUID_EAX_10_ECX_02_EDX_POLICY_AND                           0x0000FFFF
+#define CPUID_EAX_10_ECX_02_EDX_POLICY_OR                            0x00000000
 
 typedef struct {
   union {
     struct {
       uint32_t max_mba_throttling_value                              : 12;
-#define CPUID_EAX_MAX_MBA_THROTTLING_VALUE                           0xFFF
+#define CPUID_EAX_10_ECX_03_EAX_MAX_MBA_THROTTLING_VALUE             0xFFF
       uint32_t reserved_1                                            : 20;
     };
 
     uint32_t Flags;
   } eax;
+#define CPUID_EAX_10_ECX_03_EAX_RESERVED_BITS                        0xFFFFF000
 
   union {
     struct {
       uint32_t reserved                                              : 32;
-#define CPUID_EBX_RESERVED                                           0xFFFFFFFF
+#define CPUID_EAX_10_ECX_03_EBX_RESERVED                             0xFFFFFFFF
     };
 
     uint32_t Flags;
   } ebx;
+#define CPUID_EAX_10_ECX_03_EBX_RESERVED_BITS                        0xFFFFFFFF
 
   union {
     struct {
       uint32_t reserved_1                                            : 2;
       uint32_t response_of_delay_is_linear                           : 1;
-#define CPUID_ECX_RESPONSE_OF_DELAY_IS_LINEAR                        0x04
+#define CPUID_EAX_10_ECX_03_ECX_RESPONSE_OF_DELAY_IS_LINEAR          0x04
+#define CPUID_EAX_10_ECX_03_ECX_RESPONSE_OF_DELAY_IS_LINEAR_FEATURE  1986
       uint32_t reserved_2                                            : 29;
     };
 
     uint32_t Flags;
   } ecx;
+#define CPUID_EAX_10_ECX_03_ECX_RESERVED_BITS                        0xFFFFFFFB
 
   union {
     struct {
       uint32_t highest_cos_number_supported                          : 16;
-#define CPUID_EDX_HIGHEST_COS_NUMBER_SUPPORTED                       0xFFFF
+#define CPUID_EAX_10_ECX_03_EDX_HIGHEST_COS_NUMBER_SUPPORTED         0xFFFF
       uint32_t reserved_1                                            : 16;
     };
 
     uint32_t Flags;
   } edx;
+#define CPUID_EAX_10_ECX_03_EDX_RESERVED_BITS                        0xFFFF0000
 
 } cpuid_eax_10_ecx_03;
+#define CPUID_EAX_10_ECX_03_SNAPSHOT_INDEX                           15
+#define CPUID_EAX_10_ECX_03_EAX_POLICY_AND                           0x00000FFF
+#define CPUID_EAX_10_ECX_03_EAX_POLICY_OR                            0x00000000
+#define CPUID_EAX_10_ECX_03_EBX_POLICY_AND                           0x00000000
+#define CPUID_EAX_10_ECX_03_EBX_POLICY_OR                            0x00000000
+#define CPUID_EAX_10_ECX_03_ECX_POLICY_AND                           0x00000004
+#define CPUID_EAX_10_ECX_03_ECX_POLICY_OR                            0x00000000
+#define CPUID_EAX_10_ECX_03_EDX_POLICY_AND                           0x0000FFFF
+#define CPUID_EAX_10_ECX_03_EDX_POLICY_OR                            0x00000000
 
 /**
  * @}
@@ -1545,128 +1990,162 @@ typedef struct {
   union {
     struct {
       uint32_t sgx1                                                  : 1;
-#define CPUID_EAX_SGX1                                               0x01
+#define CPUID_EAX_12_ECX_00_EAX_SGX1                                 0x01
+#define CPUID_EAX_12_ECX_00_EAX_SGX1_FEATURE                         2048
       uint32_t sgx2                                                  : 1;
-#define CPUID_EAX_SGX2                                               0x02
+#define CPUID_EAX_12_ECX_00_EAX_SGX2                                 0x02
+#define CPUID_EAX_12_ECX_00_EAX_SGX2_FEATURE                         2049
       uint32_t reserved_1                                            : 3;
       uint32_t sgx_enclv_advanced                                    : 1;
-#define CPUID_EAX_SGX_ENCLV_ADVANCED                                 0x20
+#define CPUID_EAX_12_ECX_00_EAX_SGX_ENCLV_ADVANCED                   0x20
+#define CPUID_EAX_12_ECX_00_EAX_SGX_ENCLV_ADVANCED_FEATURE           2053
       uint32_t sgx_encls_advanced                                    : 1;
-#define CPUID_EAX_SGX_ENCLS_ADVANCED                                 0x40
+#define CPUID_EAX_12_ECX_00_EAX_SGX_ENCLS_ADVANCED                   0x40
+#define CPUID_EAX_12_ECX_00_EAX_SGX_ENCLS_ADVANCED_FEATURE           2054
       uint32_t reserved_2                                            : 25;
     };
 
     uint32_t Flags;
   } eax;
+#define CPUID_EAX_12_ECX_00_EAX_RESERVED_BITS                        0xFFFFFF9C
 
   union {
     struct {
       uint32_t miscselect                                            : 32;
-#define CPUID_EBX_MISCSELECT                                         0xFFFFFFFF
+#define CPUID_EAX_12_ECX_00_EBX_MISCSELECT                           0xFFFFFFFF
     };
 
     uint32_t Flags;
   } ebx;
+#define CPUID_EAX_12_ECX_00_EBX_RESERVED_BITS                        0x00
 
   union {
     struct {
       uint32_t reserved                                              : 32;
-#define CPUID_ECX_RESERVED                                           0xFFFFFFFF
+#define CPUID_EAX_12_ECX_00_ECX_RESERVED                             0xFFFFFFFF
     };
 
     uint32_t Flags;
   } ecx;
+#define CPUID_EAX_12_ECX_00_ECX_RESERVED_BITS                        0xFFFFFFFF
 
   union {
     struct {
       uint32_t max_enclave_size_not64                                : 8;
-#define CPUID_EDX_MAX_ENCLAVE_SIZE_NOT64                             0xFF
+#define CPUID_EAX_12_ECX_00_EDX_MAX_ENCLAVE_SIZE_NOT64               0xFF
       uint32_t max_enclave_size_64                                   : 8;
-#define CPUID_EDX_MAX_ENCLAVE_SIZE_64                                0xFF00
+#define CPUID_EAX_12_ECX_00_EDX_MAX_ENCLAVE_SIZE_64                  0xFF00
       uint32_t reserved_1                                            : 16;
     };
 
     uint32_t Flags;
   } edx;
+#define CPUID_EAX_12_ECX_00_EDX_RESERVED_BITS                        0xFFFF0000
 
 } cpuid_eax_12_ecx_00;
+#define CPUID_EAX_12_ECX_00_SNAPSHOT_INDEX                           16
+#define CPUID_EAX_12_ECX_00_EAX_POLICY_AND                           0x00000063
+#define CPUID_EAX_12_ECX_00_EAX_POLICY_OR                            0x00000000
+#define CPUID_EAX_12_ECX_00_EBX_POLICY_AND                           0xFFFFFFFF
+#define CPUID_EAX_12_ECX_00_EBX_POLICY_OR                            0x00000000
+#define CPUID_EAX_12_ECX_00_ECX_POLICY_AND                           0x00000000
+#define CPUID_EAX_12_ECX_00_ECX_POLICY_OR                            0x00000000
+#define CPUID_EAX_12_ECX_00_EDX_POLICY_AND                           0x0000FFFF
+#define CPUID_EAX_12_ECX_00_EDX_POLICY_OR                            0x00000000
 
 typedef struct {
   union {
     struct {
       uint32_t valid_secs_attributes_0                               : 32;
-#define CPUID_EAX_VALID_SECS_ATTRIBUTES_0                            0xFFFFFFFF
+#define CPUID_EAX_12_ECX_01_EAX_VALID_SECS_ATTRIBUTES_0              0xFFFFFFFF
     };
 
     uint32_t Flags;
   } eax;
+#define CPUID_EAX_12_ECX_01_EAX_RESERVED_BITS                        0x00
 
   union {
     struct {
       uint32_t valid_secs_attributes_1                               : 32;
-#define CPUID_EBX_VALID_SECS_ATTRIBUTES_1                            0xFFFFFFFF
+#define CPUID_EAX_12_ECX_01_EBX_VALID_SECS_ATTRIBUTES_1              0xFFFFFFFF
     };
 
     uint32_t Flags;
   } ebx;
+#define CPUID_EAX_12_ECX_01_EBX_RESERVED_BITS                        0x00
 
   union {
     struct {
       uint32_t valid_secs_attributes_2                               : 32;
-#define CPUID_ECX_VALID_SECS_ATTRIBUTES_2                            0xFFFFFFFF
+#define CPUID_EAX_12_ECX_01_ECX_VALID_SECS_ATTRIBUTES_2              0xFFFFFFFF
     };
 
     uint32_t Flags;
   } ecx;
+#define CPUID_EAX_12_ECX_01_ECX_RESERVED_BITS                        0x00
 
   union {
     struct {
       uint32_t valid_secs_attributes_3                               : 32;
-#define CPUID_EDX_VALID_SECS_ATTRIBUTES_3                            0xFFFFFFFF
+#define CPUID_EAX_12_ECX_01_EDX_VALID_SECS_ATTRIBUTES_3              0xFFFFFFFF
     };
 
     uint32_t Flags;
   } edx;
+#define CPUID_EAX_12_ECX_01_EDX_RESERVED_BITS                        0x00
 
 } cpuid_eax_12_ecx_01;
+#define CPUID_EAX_12_ECX_01_SNAPSHOT_INDEX                           17
+#define CPUID_EAX_12_ECX_01_EAX_POLICY_AND                           0xFFFFFFFF
+#define CPUID_EAX_12_ECX_01_EAX_POLICY_OR                            0x00000000
+#define CPUID_EAX_12_ECX_01_EBX_POLICY_AND                           0xFFFFFFFF
+#define CPUID_EAX_12_ECX_01_EBX_POLICY_OR                            0x00000000
+#define CPUID_EAX_12_ECX_01_ECX_POLICY_AND                           0xFFFFFFFF
+#define CPUID_EAX_12_ECX_01_ECX_POLICY_OR                            0x00000000
+#define CPUID_EAX_12_ECX_01_EDX_POLICY_AND                           0xFFFFFFFF
+#define CPUID_EAX_12_ECX_01_EDX_POLICY_OR                            0x00000000
 
 typedef struct {
   union {
     struct {
       uint32_t sub_leaf_type                                         : 4;
-#define CPUID_EAX_SUB_LEAF_TYPE                                      0x0F
+#define CPUID_EAX_12_ECX_02P_SLT_0_EAX_SUB_LEAF_TYPE                 0x0F
       uint32_t reserved_1                                            : 28;
     };
 
     uint32_t Flags;
   } eax;
+#define CPUID_EAX_12_ECX_02P_SLT_0_EAX_RESERVED_BITS                 0xFFFFFFF0
 
   union {
     struct {
       uint32_t zero                                                  : 32;
-#define CPUID_EBX_ZERO                                               0xFFFFFFFF
+#define CPUID_EAX_12_ECX_02P_SLT_0_EBX_ZERO                          0xFFFFFFFF
     };
 
     uint32_t Flags;
   } ebx;
+#define CPUID_EAX_12_ECX_02P_SLT_0_EBX_RESERVED_BITS                 0x00
 
   union {
     struct {
       uint32_t zero                                                  : 32;
-#define CPUID_ECX_ZERO                                               0xFFFFFFFF
+#define CPUID_EAX_12_ECX_02P_SLT_0_ECX_ZERO                          0xFFFFFFFF
     };
 
     uint32_t Flags;
   } ecx;
+#define CPUID_EAX_12_ECX_02P_SLT_0_ECX_RESERVED_BITS                 0x00
 
   union {
     struct {
       uint32_t zero                                                  : 32;
-#define CPUID_EDX_ZERO                                               0xFFFFFFFF
+#define CPUID_EAX_12_ECX_02P_SLT_0_EDX_ZERO                          0xFFFFFFFF
     };
 
     uint32_t Flags;
   } edx;
+#define CPUID_EAX_12_ECX_02P_SLT_0_EDX_RESERVED_BITS                 0x00
 
 } cpuid_eax_12_ecx_02p_slt_0;
 
@@ -1674,46 +2153,50 @@ typedef struct {
   union {
     struct {
       uint32_t sub_leaf_type                                         : 4;
-#define CPUID_EAX_SUB_LEAF_TYPE                                      0x0F
+#define CPUID_EAX_12_ECX_02P_SLT_1_EAX_SUB_LEAF_TYPE                 0x0F
       uint32_t reserved_1                                            : 8;
       uint32_t epc_base_physical_address_1                           : 20;
-#define CPUID_EAX_EPC_BASE_PHYSICAL_ADDRESS_1                        0xFFFFF000
+#define CPUID_EAX_12_ECX_02P_SLT_1_EAX_EPC_BASE_PHYSICAL_ADDRESS_1   0xFFFFF000
     };
 
     uint32_t Flags;
   } eax;
+#define CPUID_EAX_12_ECX_02P_SLT_1_EAX_RESERVED_BITS                 0xFF0
 
   union {
     struct {
       uint32_t epc_base_physical_address_2                           : 20;
-#define CPUID_EBX_EPC_BASE_PHYSICAL_ADDRESS_2                        0xFFFFF
+#define CPUID_EAX_12_ECX_02P_SLT_1_EBX_EPC_BASE_PHYSICAL_ADDRESS_2   0xFFFFF
       uint32_t reserved_1                                            : 12;
     };
 
     uint32_t Flags;
   } ebx;
+#define CPUID_EAX_12_ECX_02P_SLT_1_EBX_RESERVED_BITS                 0xFFF00000
 
   union {
     struct {
       uint32_t epc_section_property                                  : 4;
-#define CPUID_ECX_EPC_SECTION_PROPERTY                               0x0F
+#define CPUID_EAX_12_ECX_02P_SLT_1_ECX_EPC_SECTION_PROPERTY          0x0F
       uint32_t reserved_1                                            : 8;
       uint32_t epc_size_1                                            : 20;
-#define CPUID_ECX_EPC_SIZE_1                                         0xFFFFF000
+#define CPUID_EAX_12_ECX_02P_SLT_1_ECX_EPC_SIZE_1                    0xFFFFF000
     };
 
     uint32_t Flags;
   } ecx;
+#define CPUID_EAX_12_ECX_02P_SLT_1_ECX_RESERVED_BITS                 0xFF0
 
   union {
     struct {
       uint32_t epc_size_2                                            : 20;
-#define CPUID_EDX_EPC_SIZE_2                                         0xFFFFF
+#define CPUID_EAX_12_ECX_02P_SLT_1_EDX_EPC_SIZE_2                    0xFFFFF
       uint32_t reserved_1                                            : 12;
     };
 
     uint32_t Flags;
   } edx;
+#define CPUID_EAX_12_ECX_02P_SLT_1_EDX_RESERVED_BITS                 0xFFF00000
 
 } cpuid_eax_12_ecx_02p_slt_1;
 
@@ -1731,110 +2214,150 @@ typedef struct {
   union {
     struct {
       uint32_t max_sub_leaf                                          : 32;
-#define CPUID_EAX_MAX_SUB_LEAF                                       0xFFFFFFFF
+#define CPUID_EAX_14_ECX_00_EAX_MAX_SUB_LEAF                         0xFFFFFFFF
     };
 
     uint32_t Flags;
   } eax;
+#define CPUID_EAX_14_ECX_00_EAX_RESERVED_BITS                        0x00
 
   union {
     struct {
       uint32_t flag0                                                 : 1;
-#define CPUID_EBX_FLAG0                                              0x01
+#define CPUID_EAX_14_ECX_00_EBX_FLAG0                                0x01
+#define CPUID_EAX_14_ECX_00_EBX_FLAG0_FEATURE                        2336
       uint32_t flag1                                                 : 1;
-#define CPUID_EBX_FLAG1                                              0x02
+#define CPUID_EAX_14_ECX_00_EBX_FLAG1                                0x02
+#define CPUID_EAX_14_ECX_00_EBX_FLAG1_FEATURE                        2337
       uint32_t flag2                                                 : 1;
-#define CPUID_EBX_FLAG2                                              0x04
+#define CPUID_EAX_14_ECX_00_EBX_FLAG2                                0x04
+#define CPUID_EAX_14_ECX_00_EBX_FLAG2_FEATURE                        2338
       uint32_t flag3                                                 : 1;
-#define CPUID_EBX_FLAG3                                              0x08
+#define CPUID_EAX_14_ECX_00_EBX_FLAG3                                0x08
+#define CPUID_EAX_14_ECX_00_EBX_FLAG3_FEATURE                        2339
       uint32_t flag4                                                 : 1;
-#define CPUID_EBX_FLAG4                                              0x10
+#define CPUID_EAX_14_ECX_00_EBX_FLAG4                                0x10
+#define CPUID_EAX_14_ECX_00_EBX_FLAG4_FEATURE                        2340
       uint32_t flag5                                                 : 1;
-#define CPUID_EBX_FLAG5                                              0x20
+#define CPUID_EAX_14_ECX_00_EBX_FLAG5                                0x20
+#define CPUID_EAX_14_ECX_00_EBX_FLAG5_FEATURE                        2341
       uint32_t flag6                                                 : 1;
-#define CPUID_EBX_FLAG6                                              0x40
+#define CPUID_EAX_14_ECX_00_EBX_FLAG6                                0x40
+#define CPUID_EAX_14_ECX_00_EBX_FLAG6_FEATURE                        2342
       uint32_t flag7                                                 : 1;
-#define CPUID_EBX_FLAG7                                              0x80
+#define CPUID_EAX_14_ECX_00_EBX_FLAG7                                0x80
+#define CPUID_EAX_14_ECX_00_EBX_FLAG7_FEATURE                        2343
       uint32_t flag8                                                 : 1;
-#define CPUID_EBX_FLAG8                                              0x100
+#define CPUID_EAX_14_ECX_00_EBX_FLAG8                                0x100
+#define CPUID_EAX_14_ECX_00_EBX_FLAG8_FEATURE                        2344
       uint32_t reserved_1                                            : 23;
     };
 
     uint32_t Flags;
   } ebx;
+#define CPUID_EAX_14_ECX_00_EBX_RESERVED_BITS                        0xFFFFFE00
 
   union {
     struct {
       uint32_t flag0                                                 : 1;
-#define CPUID_ECX_FLAG0                                              0x01
+#define CPUID_EAX_14_ECX_00_ECX_FLAG0                                0x01
+#define CPUID_EAX_14_ECX_00_ECX_FLAG0_FEATURE                        2368
       uint32_t flag1                                                 : 1;
-#define CPUID_ECX_FLAG1                                              0x02
+#define CPUID_EAX_14_ECX_00_ECX_FLAG1                                0x02
+#define CPUID_EAX_14_ECX_00_ECX_FLAG1_FEATURE                        2369
       uint32_t flag2                                                 : 1;
-#define CPUID_ECX_FLAG2                                              0x04
+#define CPUID_EAX_14_ECX_00_ECX_FLAG2                                0x04
+#define CPUID_EAX_14_ECX_00_ECX_FLAG2_FEATURE                        2370
       uint32_t flag3                                                 : 1;
-#define CPUID_ECX_FLAG3                                              0x08
+#define CPUID_EAX_14_ECX_00_ECX_FLAG3                                0x08
+#define CPUID_EAX_14_ECX_00_ECX_FLAG3_FEATURE                        2371
       uint32_t reserved_1                                            : 27;
       uint32_t flag31                                                : 1;
-#define CPUID_ECX_FLAG31                                             0x80000000
+#define CPUID_EAX_14_ECX_00_ECX_FLAG31                               0x80000000
+#define CPUID_EAX_14_ECX_00_ECX_FLAG31_FEATURE                       2399
     };
 
     uint32_t Flags;
   } ecx;
+#define CPUID_EAX_14_ECX_00_ECX_RESERVED_BITS                        0x7FFFFFF0
 
   union {
     struct {
       uint32_t reserved                                              : 32;
-#define CPUID_EDX_RESERVED                                           0xFFFFFFFF
+#define CPUID_EAX_14_ECX_00_EDX_RESERVED                             0xFFFFFFFF
     };
 
     uint32_t Flags;
   } edx;
+#define CPUID_EAX_14_ECX_00_EDX_RESERVED_BITS                        0xFFFFFFFF
 
 } cpuid_eax_14_ecx_00;
+#define CPUID_EAX_14_ECX_00_SNAPSHOT_INDEX                           18
+#define CPUID_EAX_14_ECX_00_EAX_POLICY_AND                           0xFFFFFFFF
+#define CPUID_EAX_14_ECX_00_EAX_POLICY_OR                            0x00000000
+#define CPUID_EAX_14_ECX_00_EBX_POLICY_AND                           0x000001FF
+#define CPUID_EAX_14_ECX_00_EBX_POLICY_OR                            0x00000000
+#define CPUID_EAX_14_ECX_00_ECX_POLICY_AND                           0x8000000F
+#define CPUID_EAX_14_ECX_00_ECX_POLICY_OR                            0x00000000
+#define CPUID_EAX_14_ECX_00_EDX_POLICY_AND                           0x00000000
+#define CPUID_EAX_14_ECX_00_EDX_POLICY_OR                            0x00000000
 
 typedef struct {
   union {
     struct {
       uint32_t number_of_configurable_address_ranges_for_filtering   : 3;
-#define CPUID_EAX_NUMBER_OF_CONFIGURABLE_ADDRESS_RANGES_FOR_FILTERING 0x07
+#define CPUID_EAX_14_ECX_01_EAX_NUMBER_OF_CONFIGURABLE_ADDRESS_RANGES_FOR_FILTERING 0x07
       uint32_t reserved_1                                            : 13;
       uint32_t bitmap_of_supported_mtc_period_encodings              : 16;
-#define CPUID_EAX_BITMAP_OF_SUPPORTED_MTC_PERIOD_ENCODINGS           0xFFFF0000
+#define CPUID_EAX_14_ECX_01_EAX_BITMAP_OF_SUPPORTED_MTC_PERIOD_ENCODINGS 0xFFFF0000
     };
 
     uint32_t Flags;
   } eax;
+#define CPUID_EAX_14_ECX_01_EAX_RESERVED_BITS                        0xFFF8
 
   union {
     struct {
       uint32_t bitmap_of_supported_cycle_threshold_value_encodings   : 16;
-#define CPUID_EBX_BITMAP_OF_SUPPORTED_CYCLE_THRESHOLD_VALUE_ENCODINGS 0xFFFF
+#define CPUID_EAX_14_ECX_01_EBX_BITMAP_OF_SUPPORTED_CYCLE_THRESHOLD_VALUE_ENCODINGS 0xFFFF
       uint32_t bitmap_of_supported_configurable_psb_frequency_encodings: 16;
-#define CPUID_EBX_BITMAP_OF_SUPPORTED_CONFIGURABLE_PSB_FREQUENCY_ENCODINGS 0xFFFF0000
+#define CPUID_EAX_14_ECX_01_EBX_BITMAP_OF_SUPPORTED_CONFIGURABLE_PSB_FREQUENCY_ENCODINGS 0xFFFF0000
     };
 
     uint32_t Flags;
   } ebx;
+#define CPUID_EAX_14_ECX_01_EBX_RESERVED_BITS                        0x00
 
   union {
     struct {
       uint32_t reserved                                              : 32;
-#define CPUID_ECX_RESERVED                                           0xFFFFFFFF
+#define CPUID_EAX_14_ECX_01_ECX_RESERVED                             0xFFFFFFFF
     };
 
     uint32_t Flags;
   } ecx;
+#define CPUID_EAX_14_ECX_01_ECX_RESERVED_BITS                        0xFFFFFFFF
 
   union {
     struct {
       uint32_t reserved                                              : 32;
-#define CPUID_EDX_RESERVED                                           0xFFFFFFFF
+#define CPUID_EAX_14_ECX_01_EDX_RESERVED                             0xFFFFFFFF
     };
 
     uint32_t Flags;
   } edx;
+#define CPUID_EAX_14_ECX_01_EDX_RESERVED_BITS                        0xFFFFFFFF
 
 } cpuid_eax_14_ecx_01;
+#define CPUID_EAX_14_ECX_01_SNAPSHOT_INDEX                           19
+#define CPUID_EAX_14_ECX_01_EAX_POLICY_AND                           0xFFFF0007
+#define CPUID_EAX_14_ECX_01_EAX_POLICY_OR                            0x00000000
+#define CPUID_EAX_14_ECX_01_EBX_POLICY_AND                           0xFFFFFFFF
+#define CPUID_EAX_14_ECX_01_EBX_POLICY_OR                            0x00000000
+#define CPUID_EAX_14_ECX_01_ECX_POLICY_AND                           0x00000000
+#define CPUID_EAX_14_ECX_01_ECX_POLICY_OR                            0x00000000
+#define CPUID_EAX_14_ECX_01_EDX_POLICY_AND                           0x00000000
+#define CPUID_EAX_14_ECX_01_EDX_POLICY_OR                            0x00000000
 
 /**
  * @}
@@ -1845,83 +2368,109 @@ typedef struct {
   union {
     struct {
       uint32_t denominator                                           : 32;
-#define CPUID_EAX_DENOMINATOR                                        0xFFFFFFFF
+#define CPUID_EAX_15_EAX_DENOMINATOR                                 0xFFFFFFFF
     };
 
     uint32_t Flags;
   } eax;
+#define CPUID_EAX_15_EAX_RESERVED_BITS                               0x00
 
   union {
     struct {
       uint32_t numerator                                             : 32;
-#define CPUID_EBX_NUMERATOR                                          0xFFFFFFFF
+#define CPUID_EAX_15_EBX_NUMERATOR                                   0xFFFFFFFF
     };
 
     uint32_t Flags;
   } ebx;
+#define CPUID_EAX_15_EBX_RESERVED_BITS                               0x00
 
   union {
     struct {
       uint32_t nominal_frequency                                     : 32;
-#define CPUID_ECX_NOMINAL_FREQUENCY                                  0xFFFFFFFF
+#define CPUID_EAX_15_ECX_NOMINAL_FREQUENCY                           0xFFFFFFFF
     };
 
     uint32_t Flags;
   } ecx;
+#define CPUID_EAX_15_ECX_RESERVED_BITS                               0x00
 
   union {
     struct {
       uint32_t reserved                                              : 32;
-#define CPUID_EDX_RESERVED                                           0xFFFFFFFF
+#define CPUID_EAX_15_EDX_RESERVED                                    0xFFFFFFFF
     };
 
     uint32_t Flags;
   } edx;
+#define CPUID_EAX_15_EDX_RESERVED_BITS                               0xFFFFFFFF
 
 } cpuid_eax_15;
+#define CPUID_EAX_15_SNAPSHOT_INDEX                                  20
+#define CPUID_EAX_15_EAX_POLICY_AND                                  0xFFFFFFFF
+#define CPUID_EAX_15_EAX_POLICY_OR                                   0x00000000
+#define CPUID_EAX_15_EBX_POLICY_AND                                  0xFFFFFFFF
+#define CPUID_EAX_15_EBX_POLICY_OR                                   0x00000000
+#define CPUID_EAX_15_ECX_POLICY_AND                                  0xFFFFFFFF
+#define CPUID_EAX_15_ECX_POLICY_OR                                   0x00000000
+#define CPUID_EAX_15_EDX_POLICY_AND                                  0x00000000
+#define CPUID_EAX_15_EDX_POLICY_OR                                   0x00000000
 
 #define CPUID_PROCESSOR_FREQUENCY                                    0x00000016
 typedef struct {
   union {
     struct {
       uint32_t procesor_base_frequency_mhz                           : 16;
-#define CPUID_EAX_PROCESOR_BASE_FREQUENCY_MHZ                        0xFFFF
+#define CPUID_EAX_16_EAX_PROCESOR_BASE_FREQUENCY_MHZ                 0xFFFF
       uint32_t reserved_1                                            : 16;
     };
 
     uint32_t Flags;
   } eax;
+#define CPUID_EAX_16_EAX_RESERVED_BITS                               0xFFFF0000
 
   union {
     struct {
       uint32_t processor_maximum_frequency_mhz                       : 16;
-#define CPUID_EBX_PROCESSOR_MAXIMUM_FREQUENCY_MHZ                    0xFFFF
+#define CPUID_EAX_16_EBX_PROCESSOR_MAXIMUM_FREQUENCY_MHZ             0xFFFF
       uint32_t reserved_1                                            : 16;
     };
 
     uint32_t Flags;
   } ebx;
+#define CPUID_EAX_16_EBX_RESERVED_BITS                               0xFFFF0000
 
   union {
     struct {
       uint32_t bus_frequency_mhz                                     : 16;
-#define CPUID_ECX_BUS_FREQUENCY_MHZ                                  0xFFFF
+#define CPUID_EAX_16_ECX_BUS_FREQUENCY_MHZ                           0xFFFF
       uint32_t reserved_1                                            : 16;
     };
 
     uint32_t Flags;
   } ecx;
+#define CPUID_EAX_16_ECX_RESERVED_BITS                               0xFFFF0000
 
   union {
     struct {
       uint32_t reserved                                              : 32;
-#define CPUID_EDX_RESERVED                                           0xFFFFFFFF
+#define CPUID_EAX_16_EDX_RESERVED                                    0xFFFFFFFF
     };
 
     uint32_t Flags;
   } edx;
+#define CPUID_EAX_16_EDX_RESERVED_BITS                               0xFFFFFFFF
 
 } cpuid_eax_16;
+#define CPUID_EAX_16_SNAPSHOT_INDEX                                  21
+#define CPUID_EAX_16_EAX_POLICY_AND                                  0x0000FFFF
+#define CPUID_EAX_16_EAX_POLICY_OR                                   0x00000000
+#define CPUID_EAX_16_EBX_POLICY_AND                                  0x0000FFFF
+#define CPUID_EAX_16_EBX_POLICY_OR                                   0x00000000
+#define CPUID_EAX_16_ECX_POLICY_AND                                  0x0000FFFF
+#define CPUID_EAX_16_ECX_POLICY_OR                                   0x00000000
+#define CPUID_EAX_16_EDX_POLICY_AND                                  0x00000000
+#define CPUID_EAX_16_EDX_POLICY_OR                                   0x00000000
 
 /**
  * @defgroup cpuid_eax_17 \
@@ -1933,80 +2482,98 @@ typedef struct {
   union {
     struct {
       uint32_t max_soc_id_index                                      : 32;
-#define CPUID_EAX_MAX_SOC_ID_INDEX                                   0xFFFFFFFF
+#define CPUID_EAX_17_ECX_00_EAX_MAX_SOC_ID_INDEX                     0xFFFFFFFF
     };
 
     uint32_t Flags;
   } eax;
+#define CPUID_EAX_17_ECX_00_EAX_RESERVED_BITS                        0x00
 
   union {
     struct {
       uint32_t soc_vendor_id                                         : 16;
-#define CPUID_EBX_SOC_VENDOR_ID                                      0xFFFF
+#define CPUID_EAX_17_ECX_00_EBX_SOC_VENDOR_ID                        0xFFFF
       uint32_t is_vendor_scheme                                      : 1;
-#define CPUID_EBX_IS_VENDOR_SCHEME                                   0x10000
+#define CPUID_EAX_17_ECX_00_EBX_IS_VENDOR_SCHEME                     0x10000
+#define CPUID_EAX_17_ECX_00_EBX_IS_VENDOR_SCHEME_FEATURE             2864
       uint32_t reserved_1                                            : 15;
     };
 
     uint32_t Flags;
   } ebx;
+#define CPUID_EAX_17_ECX_00_EBX_RESERVED_BITS                        0xFFFE0000
 
   union {
     struct {
       uint32_t project_id                                            : 32;
-#define CPUID_ECX_PROJECT_ID                                         0xFFFFFFFF
+#define CPUID_EAX_17_ECX_00_ECX_PROJECT_ID                           0xFFFFFFFF
     };
 
     uint32_t Flags;
   } ecx;
+#define CPUID_EAX_17_ECX_00_ECX_RESERVED_BITS                        0x00
 
   union {
     struct {
       uint32_t stepping_id                                           : 32;
-#define CPUID_EDX_STEPPING_ID                                        0xFFFFFFFF
+#define CPUID_EAX_17_ECX_00_EDX_STEPPING_ID                          0xFFFFFFFF
     };
 
     uint32_t Flags;
   } edx;
+#define CPUID_EAX_17_ECX_00_EDX_RESERVED_BITS                        0x00
 
 } cpuid_eax_17_ecx_00;
+#define CPUID_EAX_17_ECX_00_SNAPSHOT_INDEX                           22
+#define CPUID_EAX_17_ECX_00_EAX_POLICY_AND                           0xFFFFFFFF
+#define CPUID_EAX_17_ECX_00_EAX_POLICY_OR                            0x00000000
+#define CPUID_EAX_17_ECX_00_EBX_POLICY_AND                           0x0001FFFF
+#define CPUID_EAX_17_ECX_00_EBX_POLICY_OR                            0x00000000
+#define CPUID_EAX_17_ECX_00_ECX_POLICY_AND                           0xFFFFFFFF
+#define CPUID_EAX_17_ECX_00_ECX_POLICY_OR                            0x00000000
+#define CPUID_EAX_17_ECX_00_EDX_POLICY_AND                           0xFFFFFFFF
+#define CPUID_EAX_17_ECX_00_EDX_POLICY_OR                            0x00000000
 
 typedef struct {
   union {
     struct {
       uint32_t soc_vendor_brand_string                               : 32;
-#define CPUID_EAX_SOC_VENDOR_BRAND_STRING                            0xFFFFFFFF
+#define CPUID_EAX_17_ECX_01_03_EAX_SOC_VENDOR_BRAND_STRING           0xFFFFFFFF
     };
 
     uint32_t Flags;
   } eax;
+#define CPUID_EAX_17_ECX_01_03_EAX_RESERVED_BITS                     0x00
 
   union {
     struct {
       uint32_t soc_vendor_brand_string                               : 32;
-#define CPUID_EBX_SOC_VENDOR_BRAND_STRING                            0xFFFFFFFF
+#define CPUID_EAX_17_ECX_01_03_EBX_SOC_VENDOR_BRAND_STRING           0xFFFFFFFF
     };
 
     uint32_t Flags;
   } ebx;
+#define CPUID_EAX_17_ECX_01_03_EBX_RESERVED_BITS                     0x00
 
   union {
     struct {
       uint32_t soc_vendor_brand_string                               : 32;
-#define CPUID_ECX_SOC_VENDOR_BRAND_STRING                            0xFFFFFFFF
+#define CPUID_EAX_17_ECX_01_03_ECX_SOC_VENDOR_BRAND_STRING           0xFFFFFFFF
     };
 
     uint32_t Flags;
   } ecx;
+#define CPUID_EAX_17_ECX_01_03_ECX_RESERVED_BITS                     0x00
 
   union {
     struct {
       uint32_t soc_vendor_brand_string                               : 32;
-#define CPUID_EDX_SOC_VENDOR_BRAND_STRING                            0xFFFFFFFF
+#define CPUID_EAX_17_ECX_01_03_EDX_SOC_VENDOR_BRAND_STRING           0xFFFFFFFF
     };
 
     uint32_t Flags;
   } edx;
+#define CPUID_EAX_17_ECX_01_03_EDX_RESERVED_BITS                     0x00
 
 } cpuid_eax_17_ecx_01_03;
 
@@ -2014,38 +2581,42 @@ typedef struct {
   union {
     struct {
       uint32_t reserved                                              : 32;
-#define CPUID_EAX_RESERVED                                           0xFFFFFFFF
+#define CPUID_EAX_17_ECX_N_EAX_RESERVED                              0xFFFFFFFF
     };
 
     uint32_t Flags;
   } eax;
+#define CPUID_EAX_17_ECX_N_EAX_RESERVED_BITS                         0xFFFFFFFF
 
   union {
     struct {
       uint32_t reserved                                              : 32;
-#define CPUID_EBX_RESERVED                                           0xFFFFFFFF
+#define CPUID_EAX_17_ECX_N_EBX_RESERVED                              0xFFFFFFFF
     };
 
     uint32_t Flags;
   } ebx;
+#define CPUID_EAX_17_ECX_N_EBX_RESERVED_BITS                         0xFFFFFFFF
 
   union {
     struct {
       uint32_t reserved                                              : 32;
-#define CPUID_ECX_RESERVED                                           0xFFFFFFFF
+#define CPUID_EAX_17_ECX_N_ECX_RESERVED                              0xFFFFFFFF
     };
 
     uint32_t Flags;
   } ecx;
+#define CPUID_EAX_17_ECX_N_ECX_RESERVED_BITS                         0xFFFFFFFF
 
   union {
     struct {
       uint32_t reserved                                              : 32;
-#define CPUID_EDX_RESERVED                                           0xFFFFFFFF
+#define CPUID_EAX_17_ECX_N_EDX_RESERVED                              0xFFFFFFFF
     };
 
     uint32_t Flags;
   } edx;
+#define CPUID_EAX_17_ECX_N_EDX_RESERVED_BITS                         0xFFFFFFFF
 
 } cpuid_eax_17_ecx_n;
 
@@ -2063,117 +2634,139 @@ typedef struct {
   union {
     struct {
       uint32_t max_sub_leaf                                          : 32;
-#define CPUID_EAX_MAX_SUB_LEAF                                       0xFFFFFFFF
+#define CPUID_EAX_18_ECX_00_EAX_MAX_SUB_LEAF                         0xFFFFFFFF
     };
 
     uint32_t Flags;
   } eax;
+#define CPUID_EAX_18_ECX_00_EAX_RESERVED_BITS                        0x00
 
   union {
     struct {
       uint32_t page_entries_4kb_supported                            : 1;
-#define CPUID_EBX_PAGE_ENTRIES_4KB_SUPPORTED                         0x01
+#define CPUID_EAX_18_ECX_00_EBX_PAGE_ENTRIES_4KB_SUPPORTED           0x01
+#define CPUID_EAX_18_ECX_00_EBX_PAGE_ENTRIES_4KB_SUPPORTED_FEATURE   2976
       uint32_t page_entries_2mb_supported                            : 1;
-#define CPUID_EBX_PAGE_ENTRIES_2MB_SUPPORTED                         0x02
+#define CPUID_EAX_18_ECX_00_EBX_PAGE_ENTRIES_2MB_SUPPORTED           0x02
+#define CPUID_EAX_18_ECX_00_EBX_PAGE_ENTRIES_2MB_SUPPORTED_FEATURE   2977
       uint32_t page_entries_4mb_supported                            : 1;
-#define CPUID_EBX_PAGE_ENTRIES_4MB_SUPPORTED                         0x04
+#define CPUID_EAX_18_ECX_00_EBX_PAGE_ENTRIES_4MB_SUPPORTED           0x04
+#define CPUID_EAX_18_ECX_00_EBX_PAGE_ENTRIES_4MB_SUPPORTED_FEATURE   2978
       uint32_t page_entries_1gb_supported                            : 1;
-#define CPUID_EBX_PAGE_ENTRIES_1GB_SUPPORTED                         0x08
+#define CPUID_EAX_18_ECX_00_EBX_PAGE_ENTRIES_1GB_SUPPORTED           0x08
+#define CPUID_EAX_18_ECX_00_EBX_PAGE_ENTRIES_1GB_SUPPORTED_FEATURE   2979
       uint32_t reserved_1                                            : 4;
       uint32_t partitioning                                          : 3;
-#define CPUID_EBX_PARTITIONING                                       0x700
+#define CPUID_EAX_18_ECX_00_EBX_PARTITIONING                         0x700
       uint32_t reserved_2                                            : 5;
       uint32_t ways_of_associativity_00                              : 16;
-#define CPUID_EBX_WAYS_OF_ASSOCIATIVITY_00                           0xFFFF0000
+#define CPUID_EAX_18_ECX_00_EBX_WAYS_OF_ASSOCIATIVITY_00             0xFFFF0000
     };
 
     uint32_t Flags;
   } ebx;
+#define CPUID_EAX_18_ECX_00_EBX_RESERVED_BITS                        0xF8F0
 
   union {
     struct {
       uint32_t number_of_sets                                        : 32;
-#define CPUID_ECX_NUMBER_OF_SETS                                     0xFFFFFFFF
+#define CPUID_EAX_18_ECX_00_ECX_NUMBER_OF_SETS                       0xFFFFFFFF
     };
 
     uint32_t Flags;
   } ecx;
+#define CPUID_EAX_18_ECX_00_ECX_RESERVED_BITS                        0x00
 
   union {
     struct {
       uint32_t translation_cache_type_field                          : 5;
-#define CPUID_EDX_TRANSLATION_CACHE_TYPE_FIELD                       0x1F
+#define CPUID_EAX_18_ECX_00_EDX_TRANSLATION_CACHE_TYPE_FIELD         0x1F
       uint32_t translation_cache_level                               : 3;
-#define CPUID_EDX_TRANSLATION_CACHE_LEVEL                            0xE0
+#define CPUID_EAX_18_ECX_00_EDX_TRANSLATION_CACHE_LEVEL              0xE0
       uint32_t fully_associative_structure                           : 1;
-#define CPUID_EDX_FULLY_ASSOCIATIVE_STRUCTURE                        0x100
+#define CPUID_EAX_18_ECX_00_EDX_FULLY_ASSOCIATIVE_STRUCTURE          0x100
+#define CPUID_EAX_18_ECX_00_EDX_FULLY_ASSOCIATIVE_STRUCTURE_FEATURE  3048
       uint32_t reserved_1                                            : 5;
       uint32_t max_addressable_ids_for_logical_processors            : 12;
-#define CPUID_EDX_MAX_ADDRESSABLE_IDS_FOR_LOGICAL_PROCESSORS         0x3FFC000
+#define CPUID_EAX_18_ECX_00_EDX_MAX_ADDRESSABLE_IDS_FOR_LOGICAL_PROCESSORS 0x3FFC000
       uint32_t reserved_2                                            : 6;
     };
 
     uint32_t Flags;
   } edx;
+#define CPUID_EAX_18_ECX_00_EDX_RESERVED_BITS                        0xFC003E00
 
 } cpuid_eax_18_ecx_00;
+#define CPUID_EAX_18_ECX_00_SNAPSHOT_INDEX                           23
+#define CPUID_EAX_18_ECX_00_EAX_POLICY_AND                           0xFFFFFFFF
+#define CPUID_EAX_18_ECX_00_EAX_POLICY_OR                            0x00000000
+#define CPUID_EAX_18_ECX_00_EBX_POLICY_AND                           0xFFFF070F
+#define CPUID_EAX_18_ECX_00_EBX_POLICY_OR                            0x00000000
+#define CPUID_EAX_18_ECX_00_ECX_POLICY_AND                           0xFFFFFFFF
+#define CPUID_EAX_18_ECX_00_ECX_POLICY_OR                            0x00000000
+#define CPUID_EAX_18_ECX_00_EDX_POLICY_AND                           0x03FFC1FF
+#define CPUID_EAX_18_ECX_00_EDX_POLICY_OR                            0x00000000
 
 typedef struct {
   union {
     struct {
       uint32_t reserved                                              : 32;
-#define CPUID_EAX_RESERVED                                           0xFFFFFFFF
+#define CPUID_EAX_18_ECX_01P_EAX_RESERVED                            0xFFFFFFFF
     };
 
     uint32_t Flags;
   } eax;
+#define CPUID_EAX_18_ECX_01P_EAX_RESERVED_BITS                       0xFFFFFFFF
 
   union {
     struct {
       uint32_t page_entries_4kb_supported                            : 1;
-#define CPUID_EBX_PAGE_ENTRIES_4KB_SUPPORTED                         0x01
+#define CPUID_EAX_18_ECX_01P_EBX_PAGE_ENTRIES_4KB_SUPPORTED          0x01
       uint32_t page_entries_2mb_supported                            : 1;
-#define CPUID_EBX_PAGE_ENTRIES_2MB_SUPPORTED                         0x02
+#define CPUID_EAX_18_ECX_01P_EBX_PAGE_ENTRIES_2MB_SUPPORTED          0x02
       uint32_t page_entries_4mb_supported                            : 1;
-#define CPUID_EBX_PAGE_ENTRIES_4MB_SUPPORTED                         0x04
+#define CPUID_EAX_18_ECX_01P_EBX_PAGE_ENTRIES_4MB_SUPPORTED          0x04
       uint32_t page_entries_1gb_supported                            : 1;
-#define CPUID_EBX_PAGE_ENTRIES_1GB_SUPPORTED                         0x08
+#define CPUID_EAX_18_ECX_01P_EBX_PAGE_ENTRIES_1GB_SUPPORTED          0x08
       uint32_t reserved_1                                            : 4;
       uint32_t partitioning                                          : 3;
-#define CPUID_EBX_PARTITIONING                                       0x700
+#define CPUID_EAX_18_ECX_01P_EBX_PARTITIONING                        0x700
       uint32_t reserved_2                                            : 5;
       uint32_t ways_of_associativity_01                              : 16;
-#define CPUID_EBX_WAYS_OF_ASSOCIATIVITY_01                           0xFFFF0000
+#define CPUID_EAX_18_ECX_01P_EBX_WAYS_OF_ASSOCIATIVITY_01            0xFFFF0000
     };
 
     uint32_t Flags;
   } ebx;
+#define CPUID_EAX_18_ECX_01P_EBX_RESERVED_BITS                       0xF8F0
 
   union {
     struct {
       uint32_t number_of_sets                                        : 32;
-#define CPUID_ECX_NUMBER_OF_SETS                                     0xFFFFFFFF
+#define CPUID_EAX_18_ECX_01P_ECX_NUMBER_OF_SETS                      0xFFFFFFFF
     };
 
     uint32_t Flags;
   } ecx;
+#define CPUID_EAX_18_ECX_01P_ECX_RESERVED_BITS                       0x00
 
   union {
     struct {
       uint32_t translation_cache_type_field                          : 5;
-#define CPUID_EDX_TRANSLATION_CACHE_TYPE_FIELD                       0x1F
+#define CPUID_EAX_18_ECX_01P_EDX_TRANSLATION_CACHE_TYPE_FIELD        0x1F
       uint32_t translation_cache_level                               : 3;
-#define CPUID_EDX_TRANSLATION_CACHE_LEVEL                            0xE0
+#define CPUID_EAX_18_ECX_01P_EDX_TRANSLATION_CACHE_LEVEL             0xE0
       uint32_t fully_associative_structure                           : 1;
-#define CPUID_EDX_FULLY_ASSOCIATIVE_STRUCTURE                        0x100
+#define CPUID_EAX_18_ECX_01P_EDX_FULLY_ASSOCIATIVE_STRUCTURE         0x100
       uint32_t reserved_1                                            : 5;
       uint32_t max_addressable_ids_for_logical_processors            : 12;
-#define CPUID_EDX_MAX_ADDRESSABLE_IDS_FOR_LOGICAL_PROCESSORS         0x3FFC000
+#define CPUID_EAX_18_ECX_01P_EDX_MAX_ADDRESSABLE_IDS_FOR_LOGICAL_PROCESSORS 0x3FFC000
       uint32_t reserved_2                                            : 6;
     };
 
     uint32_t Flags;
   } edx;
+#define CPUID_EAX_18_ECX_01P_EDX_RESERVED_BITS                       0xFC003E00
 
 } cpuid_eax_18_ecx_01p;
 
@@ -2186,100 +2779,134 @@ typedef struct {
   union {
     struct {
       uint32_t max_extended_functions                                : 32;
-#define CPUID_EAX_MAX_EXTENDED_FUNCTIONS                             0xFFFFFFFF
+#define CPUID_EAX_80000000_EAX_MAX_EXTENDED_FUNCTIONS                0xFFFFFFFF
     };
 
     uint32_t Flags;
   } eax;
+#define CPUID_EAX_80000000_EAX_RESERVED_BITS                         0x00
 
   union {
     struct {
       uint32_t reserved                                              : 32;
-#define CPUID_EBX_RESERVED                                           0xFFFFFFFF
+#define CPUID_EAX_80000000_EBX_RESERVED                              0xFFFFFFFF
     };
 
     uint32_t Flags;
   } ebx;
+#define CPUID_EAX_80000000_EBX_RESERVED_BITS                         0xFFFFFFFF
 
   union {
     struct {
       uint32_t reserved                                              : 32;
-#define CPUID_ECX_RESERVED                                           0xFFFFFFFF
+#define CPUID_EAX_80000000_ECX_RESERVED                              0xFFFFFFFF
     };
 
     uint32_t Flags;
   } ecx;
+#define CPUID_EAX_80000000_ECX_RESERVED_BITS                         0xFFFFFFFF
 
   union {
     struct {
       uint32_t reserved                                              : 32;
-#define CPUID_EDX_RESERVED                                           0xFFFFFFFF
+#define CPUID_EAX_80000000_EDX_RESERVED                              0xFFFFFFFF
     };
 
     uint32_t Flags;
   } edx;
+#define CPUID_EAX_80000000_EDX_RESERVED_BITS                         0xFFFFFFFF
 
 } cpuid_eax_80000000;
+#define CPUID_EAX_80000000_SNAPSHOT_INDEX                            24
+#define CPUID_EAX_80000000_EAX_POLICY_AND                            0xFFFFFFFF
+#define CPUID_EAX_80000000_EAX_POLICY_OR                             0x00000000
+#define CPUID_EAX_80000000_EBX_POLICY_AND                            0x00000000
+#define CPUID_EAX_80000000_EBX_POLICY_OR                             0x00000000
+#define CPUID_EAX_80000000_ECX_POLICY_AND                            0x00000000
+#define CPUID_EAX_80000000_ECX_POLICY_OR                             0x00000000
+#define CPUID_EAX_80000000_EDX_POLICY_AND                            0x00000000
+#define CPUID_EAX_80000000_EDX_POLICY_OR                             0x00000000
 
 #define CPUID_EXTENDED_CPU_SIGNATURE                                 0x80000001
 typedef struct {
   union {
     struct {
       uint32_t reserved                                              : 32;
-#define CPUID_EAX_RESERVED                                           0xFFFFFFFF
+#define CPUID_EAX_80000001_EAX_RESERVED                              0xFFFFFFFF
     };
 
     uint32_t Flags;
   } eax;
+#define CPUID_EAX_80000001_EAX_RESERVED_BITS                         0xFFFFFFFF
 
   union {
     struct {
       uint32_t reserved                                              : 32;
-#define CPUID_EBX_RESERVED                                           0xFFFFFFFF
+#define CPUID_EAX_80000001_EBX_RESERVED                              0xFFFFFFFF
     };
 
     uint32_t Flags;
   } ebx;
+#define CPUID_EAX_80000001_EBX_RESERVED_BITS                         0xFFFFFFFF
 
   union {
     struct {
       uint32_t lahf_sahf_available_in_64_bit_mode                    : 1;
-#define CPUID_ECX_LAHF_SAHF_AVAILABLE_IN_64_BIT_MODE                 0x01
+#define CPUID_EAX_80000001_ECX_LAHF_SAHF_AVAILABLE_IN_64_BIT_MODE    0x01
+#define CPUID_EAX_80000001_ECX_LAHF_SAHF_AVAILABLE_IN_64_BIT_MODE_FEATURE 3264
       uint32_t reserved_1                                            : 4;
       uint32_t lzcnt                                                 : 1;
-#define CPUID_ECX_LZCNT                                              0x20
+#define CPUID_EAX_80000001_ECX_LZCNT                                 0x20
+#define CPUID_EAX_80000001_ECX_LZCNT_FEATURE                         3269
       uint32_t reserved_2                                            : 2;
       uint32_t prefetchw                                             : 1;
-#define CPUID_ECX_PREFETCHW                                          0x100
+#define CPUID_EAX_80000001_ECX_PREFETCHW                             0x100
+#define CPUID_EAX_80000001_ECX_PREFETCHW_FEATURE                     3272
       uint32_t reserved_3                                            : 23;
     };
 
     uint32_t Flags;
   } ecx;
+#define CPUID_EAX_80000001_ECX_RESERVED_BITS                         0xFFFFFEDE
 
   union {
     struct {
       uint32_t reserved_1                                            : 11;
       uint32_t syscall_sysret_available_in_64_bit_mode               : 1;
-#define CPUID_EDX_SYSCALL_SYSRET_AVAILABLE_IN_64_BIT_MODE            0x800
+#define CPUID_EAX_80000001_EDX_SYSCALL_SYSRET_AVAILABLE_IN_64_BIT_MODE 0x800
+#define CPUID_EAX_80000001_EDX_SYSCALL_SYSRET_AVAILABLE_IN_64_BIT_MODE_FEATURE 3307
       uint32_t reserved_2                                            : 8;
       uint32_t execute_disable_bit_available                         : 1;
-#define CPUID_EDX_EXECUTE_DISABLE_BIT_AVAILABLE                      0x100000
+#define CPUID_EAX_80000001_EDX_EXECUTE_DISABLE_BIT_AVAILABLE         0x100000
+#define CPUID_EAX_80000001_EDX_EXECUTE_DISABLE_BIT_AVAILABLE_FEATURE 3316
       uint32_t reserved_3                                            : 5;
       uint32_t pages_1gb_available                                   : 1;
-#define CPUID_EDX_PAGES_1GB_AVAILABLE                                0x4000000
+#define CPUID_EAX_80000001_EDX_PAGES_1GB_AVAILABLE                   0x4000000
+#define CPUID_EAX_80000001_EDX_PAGES_1GB_AVAILABLE_FEATURE           3322
       uint32_t rdtscp_available                                      : 1;
-#define CPUID_EDX_RDTSCP_AVAILABLE                                   0x8000000
+#define CPUID_EAX_80000001_EDX_RDTSCP_AVAILABLE                      0x8000000
+#define CPUID_EAX_80000001_EDX_RDTSCP_AVAILABLE_FEATURE              3323
       uint32_t reserved_4                                            : 1;
       uint32_t ia64_available                                        : 1;
-#define CPUID_EDX_IA64_AVAILABLE                                     0x20000000
+#define CPUID_EAX_80000001_EDX_IA64_AVAILABLE                        0x20000000
+#define CPUID_EAX_80000001_EDX_IA64_AVAILABLE_FEATURE                3325
       uint32_t reserved_5                                            : 2;
     };
 
     uint32_t Flags;
   } edx;
+#define CPUID_EAX_80000001_EDX_RESERVED_BITS                         0xD3EFF7FF
 
 } cpuid_eax_80000001;
+#define CPUID_EAX_80000001_SNAPSHOT_INDEX                            25
+#define CPUID_EAX_80000001_EAX_POLICY_AND                            0x00000000
+#define CPUID_EAX_80000001_EAX_POLICY_OR                             0x00000000
+#define CPUID_EAX_80000001_EBX_POLICY_AND                            0x00000000
+#define CPUID_EAX_80000001_EBX_POLICY_OR                             0x00000000
+#define CPUID_EAX_80000001_ECX_POLICY_AND                            0x00000121
+#define CPUID_EAX_80000001_ECX_POLICY_OR                             0x00000000
+#define CPUID_EAX_80000001_EDX_POLICY_AND                            0x2C100800
+#define CPUID_EAX_80000001_EDX_POLICY_OR                             0x00000000
 
 #define CPUID_BRAND_STRING1                                          0x80000002
 #define CPUID_BRAND_STRING2                                          0x80000003
@@ -2288,288 +2915,457 @@ typedef struct {
   union {
     struct {
       uint32_t processor_brand_string_1                              : 32;
-#define CPUID_EAX_PROCESSOR_BRAND_STRING_1                           0xFFFFFFFF
+#define CPUID_EAX_80000002_EAX_PROCESSOR_BRAND_STRING_1              0xFFFFFFFF
     };
 
     uint32_t Flags;
   } eax;
+#define CPUID_EAX_80000002_EAX_RESERVED_BITS                         0x00
 
   union {
     struct {
       uint32_t processor_brand_string_2                              : 32;
-#define CPUID_EBX_PROCESSOR_BRAND_STRING_2                           0xFFFFFFFF
+#define CPUID_EAX_80000002_EBX_PROCESSOR_BRAND_STRING_2              0xFFFFFFFF
     };
 
     uint32_t Flags;
   } ebx;
+#define CPUID_EAX_80000002_EBX_RESERVED_BITS                         0x00
 
   union {
     struct {
       uint32_t processor_brand_string_3                              : 32;
-#define CPUID_ECX_PROCESSOR_BRAND_STRING_3                           0xFFFFFFFF
+#define CPUID_EAX_80000002_ECX_PROCESSOR_BRAND_STRING_3              0xFFFFFFFF
     };
 
     uint32_t Flags;
   } ecx;
+#define CPUID_EAX_80000002_ECX_RESERVED_BITS                         0x00
 
   union {
     struct {
       uint32_t processor_brand_string_4                              : 32;
-#define CPUID_EDX_PROCESSOR_BRAND_STRING_4                           0xFFFFFFFF
+#define CPUID_EAX_80000002_EDX_PROCESSOR_BRAND_STRING_4              0xFFFFFFFF
     };
 
     uint32_t Flags;
   } edx;
+#define CPUID_EAX_80000002_EDX_RESERVED_BITS                         0x00
 
 } cpuid_eax_80000002;
+#define CPUID_EAX_80000002_SNAPSHOT_INDEX                            26
+#define CPUID_EAX_80000002_EAX_POLICY_AND                            0xFFFFFFFF
+#define CPUID_EAX_80000002_EAX_POLICY_OR                             0x00000000
+#define CPUID_EAX_80000002_EBX_POLICY_AND                            0xFFFFFFFF
+#define CPUID_EAX_80000002_EBX_POLICY_OR                             0x00000000
+#define CPUID_EAX_80000002_ECX_POLICY_AND                            0xFFFFFFFF
+#define CPUID_EAX_80000002_ECX_POLICY_OR                             0x00000000
+#define CPUID_EAX_80000002_EDX_POLICY_AND                            0xFFFFFFFF
+#define CPUID_EAX_80000002_EDX_POLICY_OR                             0x00000000
 
 typedef struct {
   union {
     struct {
       uint32_t processor_brand_string_5                              : 32;
-#define CPUID_EAX_PROCESSOR_BRAND_STRING_5                           0xFFFFFFFF
+#define CPUID_EAX_80000003_EAX_PROCESSOR_BRAND_STRING_5              0xFFFFFFFF
     };
 
     uint32_t Flags;
   } eax;
+#define CPUID_EAX_80000003_EAX_RESERVED_BITS                         0x00
 
   union {
     struct {
       uint32_t processor_brand_string_6                              : 32;
-#define CPUID_EBX_PROCESSOR_BRAND_STRING_6                           0xFFFFFFFF
+#define CPUID_EAX_80000003_EBX_PROCESSOR_BRAND_STRING_6              0xFFFFFFFF
     };
 
     uint32_t Flags;
   } ebx;
+#define CPUID_EAX_80000003_EBX_RESERVED_BITS                         0x00
 
   union {
     struct {
       uint32_t processor_brand_string_7                              : 32;
-#define CPUID_ECX_PROCESSOR_BRAND_STRING_7                           0xFFFFFFFF
+#define CPUID_EAX_80000003_ECX_PROCESSOR_BRAND_STRING_7              0xFFFFFFFF
     };
 
     uint32_t Flags;
   } ecx;
+#define CPUID_EAX_80000003_ECX_RESERVED_BITS                         0x00
 
   union {
     struct {
       uint32_t processor_brand_string_8                              : 32;
-#define CPUID_EDX_PROCESSOR_BRAND_STRING_8                           0xFFFFFFFF
+#define CPUID_EAX_80000003_EDX_PROCESSOR_BRAND_STRING_8              0xFFFFFFFF
     };
 
     uint32_t Flags;
   } edx;
+#define CPUID_EAX_80000003_EDX_RESERVED_BITS                         0x00
 
 } cpuid_eax_80000003;
+#define CPUID_EAX_80000003_SNAPSHOT_INDEX                            27
+#define CPUID_EAX_80000003_EAX_POLICY_AND                            0xFFFFFFFF
+#define CPUID_EAX_80000003_EAX_POLICY_OR                             0x00000000
+#define CPUID_EAX_80000003_EBX_POLICY_AND                            0xFFFFFFFF
+#define CPUID_EAX_80000003_EBX_POLICY_OR                             0x00000000
+#define CPUID_EAX_80000003_ECX_POLICY_AND                            0xFFFFFFFF
+#define CPUID_EAX_80000003_ECX_POLICY_OR                             0x00000000
+#define CPUID_EAX_80000003_EDX_POLICY_AND                            0xFFFFFFFF
+#define CPUID_EAX_80000003_EDX_POLICY_OR                             0x00000000
 
 typedef struct {
   union {
     struct {
       uint32_t processor_brand_string_9                              : 32;
-#define CPUID_EAX_PROCESSOR_BRAND_STRING_9                           0xFFFFFFFF
+#define CPUID_EAX_80000004_EAX_PROCESSOR_BRAND_STRING_9              0xFFFFFFFF
     };
 
     uint32_t Flags;
   } eax;
+#define CPUID_EAX_80000004_EAX_RESERVED_BITS                         0x00
 
   union {
     struct {
       uint32_t processor_brand_string_10                             : 32;
-#define CPUID_EBX_PROCESSOR_BRAND_STRING_10                          0xFFFFFFFF
+#define CPUID_EAX_80000004_EBX_PROCESSOR_BRAND_STRING_10             0xFFFFFFFF
     };
 
     uint32_t Flags;
   } ebx;
+#define CPUID_EAX_80000004_EBX_RESERVED_BITS                         0x00
 
   union {
     struct {
       uint32_t processor_brand_string_11                             : 32;
-#define CPUID_ECX_PROCESSOR_BRAND_STRING_11                          0xFFFFFFFF
+#define CPUID_EAX_80000004_ECX_PROCESSOR_BRAND_STRING_11             0xFFFFFFFF
     };
 
     uint32_t Flags;
   } ecx;
+#define CPUID_EAX_80000004_ECX_RESERVED_BITS                         0x00
 
   union {
     struct {
       uint32_t processor_brand_string_12                             : 32;
-#define CPUID_EDX_PROCESSOR_BRAND_STRING_12                          0xFFFFFFFF
+#define CPUID_EAX_80000004_EDX_PROCESSOR_BRAND_STRING_12             0xFFFFFFFF
     };
 
     uint32_t Flags;
   } edx;
+#define CPUID_EAX_80000004_EDX_RESERVED_BITS                         0x00
 
 } cpuid_eax_80000004;
+#define CPUID_EAX_80000004_SNAPSHOT_INDEX                            28
+#define CPUID_EAX_80000004_EAX_POLICY_AND                            0xFFFFFFFF
+#define CPUID_EAX_80000004_EAX_POLICY_OR                             0x00000000
+#define CPUID_EAX_80000004_EBX_POLICY_AND                            0xFFFFFFFF
+#define CPUID_EAX_80000004_EBX_POLICY_OR                             0x00000000
+#define CPUID_EAX_80000004_ECX_POLICY_AND                            0xFFFFFFFF
+#define CPUID_EAX_80000004_ECX_POLICY_OR                             0x00000000
+#define CPUID_EAX_80000004_EDX_POLICY_AND                            0xFFFFFFFF
+#define CPUID_EAX_80000004_EDX_POLICY_OR                             0x00000000
 
 typedef struct {
   union {
     struct {
       uint32_t reserved                                              : 32;
-#define CPUID_EAX_RESERVED                                           0xFFFFFFFF
+#define CPUID_EAX_80000005_EAX_RESERVED                              0xFFFFFFFF
     };
 
     uint32_t Flags;
   } eax;
+#define CPUID_EAX_80000005_EAX_RESERVED_BITS                         0xFFFFFFFF
 
   union {
     struct {
       uint32_t reserved                                              : 32;
-#define CPUID_EBX_RESERVED                                           0xFFFFFFFF
+#define CPUID_EAX_80000005_EBX_RESERVED                              0xFFFFFFFF
     };
 
     uint32_t Flags;
   } ebx;
+#define CPUID_EAX_80000005_EBX_RESERVED_BITS                         0xFFFFFFFF
 
   union {
     struct {
       uint32_t reserved                                              : 32;
-#define CPUID_ECX_RESERVED                                           0xFFFFFFFF
+#define CPUID_EAX_80000005_ECX_RESERVED                              0xFFFFFFFF
     };
 
     uint32_t Flags;
   } ecx;
+#define CPUID_EAX_80000005_ECX_RESERVED_BITS                         0xFFFFFFFF
 
   union {
     struct {
       uint32_t reserved                                              : 32;
-#define CPUID_EDX_RESERVED                                           0xFFFFFFFF
+#define CPUID_EAX_80000005_EDX_RESERVED                              0xFFFFFFFF
     };
 
     uint32_t Flags;
   } edx;
+#define CPUID_EAX_80000005_EDX_RESERVED_BITS                         0xFFFFFFFF
 
 } cpuid_eax_80000005;
+#define CPUID_EAX_80000005_SNAPSHOT_INDEX                            29
+#define CPUID_EAX_80000005_EAX_POLICY_AND                            0x00000000
+#define CPUID_EAX_80000005_EAX_POLICY_OR                             0x00000000
+#define CPUID_EAX_80000005_EBX_POLICY_AND                            0x00000000
+#define CPUID_EAX_80000005_EBX_POLICY_OR                             0x00000000
+#define CPUID_EAX_80000005_ECX_POLICY_AND                            0x00000000
+#define CPUID_EAX_80000005_ECX_POLICY_OR                             0x00000000
+#define CPUID_EAX_80000005_EDX_POLICY_AND                            0x00000000
+#define CPUID_EAX_80000005_EDX_POLICY_OR                             0x00000000
 
 #define CPUID_EXTENDED_CACHE_INFO                                    0x80000006
 typedef struct {
   union {
     struct {
       uint32_t reserved                                              : 32;
-#define CPUID_EAX_RESERVED                                           0xFFFFFFFF
+#define CPUID_EAX_80000006_EAX_RESERVED                              0xFFFFFFFF
     };
 
     uint32_t Flags;
   } eax;
+#define CPUID_EAX_80000006_EAX_RESERVED_BITS                         0xFFFFFFFF
 
   union {
     struct {
       uint32_t reserved                                              : 32;
-#define CPUID_EBX_RESERVED                                           0xFFFFFFFF
+#define CPUID_EAX_80000006_EBX_RESERVED                              0xFFFFFFFF
     };
 
     uint32_t Flags;
   } ebx;
+#define CPUID_EAX_80000006_EBX_RESERVED_BITS                         0xFFFFFFFF
 
   union {
     struct {
       uint32_t cache_line_size_in_bytes                              : 8;
-#define CPUID_ECX_CACHE_LINE_SIZE_IN_BYTES                           0xFF
+#define CPUID_EAX_80000006_ECX_CACHE_LINE_SIZE_IN_BYTES              0xFF
       uint32_t reserved_1                                            : 4;
       uint32_t l2_associativity_field                                : 4;
-#define CPUID_ECX_L2_ASSOCIATIVITY_FIELD                             0xF000
+#define CPUID_EAX_80000006_ECX_L2_ASSOCIATIVITY_FIELD                0xF000
       uint32_t cache_size_in_1k_units                                : 16;
-#define CPUID_ECX_CACHE_SIZE_IN_1K_UNITS                             0xFFFF0000
+#define CPUID_EAX_80000006_ECX_CACHE_SIZE_IN_1K_UNITS                0xFFFF0000
     };
 
     uint32_t Flags;
   } ecx;
+#define CPUID_EAX_80000006_ECX_RESERVED_BITS                         0xF00
 
   union {
     struct {
       uint32_t reserved                                              : 32;
-#define CPUID_EDX_RESERVED                                           0xFFFFFFFF
+#define CPUID_EAX_80000006_EDX_RESERVED                              0xFFFFFFFF
     };
 
     uint32_t Flags;
   } edx;
+#define CPUID_EAX_80000006_EDX_RESERVED_BITS                         0xFFFFFFFF
 
 } cpuid_eax_80000006;
+#define CPUID_EAX_80000006_SNAPSHOT_INDEX                            30
+#define CPUID_EAX_80000006_EAX_POLICY_AND                            0x00000000
+#define CPUID_EAX_80000006_EAX_POLICY_OR                             0x00000000
+#define CPUID_EAX_80000006_EBX_POLICY_AND                            0x00000000
+#define CPUID_EAX_80000006_EBX_POLICY_OR                             0x00000000
+#define CPUID_EAX_80000006_ECX_POLICY_AND                            0xFFFFF0FF
+#define CPUID_EAX_80000006_ECX_POLICY_OR                             0x00000000
+#define CPUID_EAX_80000006_EDX_POLICY_AND                            0x00000000
+#define CPUID_EAX_80000006_EDX_POLICY_OR                             0x00000000
 
 #define CPUID_EXTENDED_TIME_STAMP_COUNTER                            0x80000007
 typedef struct {
   union {
     struct {
       uint32_t reserved                                              : 32;
-#define CPUID_EAX_RESERVED                                           0xFFFFFFFF
+#define CPUID_EAX_80000007_EAX_RESERVED                              0xFFFFFFFF
     };
 
     uint32_t Flags;
   } eax;
+#define CPUID_EAX_80000007_EAX_RESERVED_BITS                         0xFFFFFFFF
 
   union {
     struct {
       uint32_t reserved                                              : 32;
-#define CPUID_EBX_RESERVED                                           0xFFFFFFFF
+#define CPUID_EAX_80000007_EBX_RESERVED                              0xFFFFFFFF
     };
 
     uint32_t Flags;
   } ebx;
+#define CPUID_EAX_80000007_EBX_RESERVED_BITS                         0xFFFFFFFF
 
   union {
     struct {
       uint32_t reserved                                              : 32;
-#define CPUID_ECX_RESERVED                                           0xFFFFFFFF
+#define CPUID_EAX_80000007_ECX_RESERVED                              0xFFFFFFFF
     };
 
     uint32_t Flags;
   } ecx;
+#define CPUID_EAX_80000007_ECX_RESERVED_BITS                         0xFFFFFFFF
 
   union {
     struct {
       uint32_t reserved_1                                            : 8;
       uint32_t invariant_tsc_available                               : 1;
-#define CPUID_EDX_INVARIANT_TSC_AVAILABLE                            0x100
+#define CPUID_EAX_80000007_EDX_INVARIANT_TSC_AVAILABLE               0x100
+#define CPUID_EAX_80000007_EDX_INVARIANT_TSC_AVAILABLE_FEATURE       4072
       uint32_t reserved_2                                            : 23;
     };
 
     uint32_t Flags;
   } edx;
+#define CPUID_EAX_80000007_EDX_RESERVED_BITS                         0xFFFFFEFF
 
 } cpuid_eax_80000007;
+#define CPUID_EAX_80000007_SNAPSHOT_INDEX                            31
+#define CPUID_EAX_80000007_EAX_POLICY_AND                            0x00000000
+#define CPUID_EAX_80000007_EAX_POLICY_OR                             0x00000000
+#define CPUID_EAX_80000007_EBX_POLICY_AND                            0x00000000
+#define CPUID_EAX_80000007_EBX_POLICY_OR                             0x00000000
+#define CPUID_EAX_80000007_ECX_POLICY_AND                            0x00000000
+#define CPUID_EAX_80000007_ECX_POLICY_OR                             0x00000000
+#define CPUID_EAX_80000007_EDX_POLICY_AND                            0x00000100
+#define CPUID_EAX_80000007_EDX_POLICY_OR                             0x00000000
 
 #define CPUID_EXTENDED_VIRT_PHYS_ADDRESS_SIZE                        0x80000008
 typedef struct {
   union {
     struct {
       uint32_t number_of_physical_address_bits                       : 8;
-#define CPUID_EAX_NUMBER_OF_PHYSICAL_ADDRESS_BITS                    0xFF
+#define CPUID_EAX_80000008_EAX_NUMBER_OF_PHYSICAL_ADDRESS_BITS       0xFF
       uint32_t number_of_linear_address_bits                         : 8;
-#define CPUID_EAX_NUMBER_OF_LINEAR_ADDRESS_BITS                      0xFF00
+#define CPUID_EAX_80000008_EAX_NUMBER_OF_LINEAR_ADDRESS_BITS         0xFF00
       uint32_t reserved_1                                            : 16;
     };
 
     uint32_t Flags;
   } eax;
+#define CPUID_EAX_80000008_EAX_RESERVED_BITS                         0xFFFF0000
 
   union {
     struct {
       uint32_t reserved                                              : 32;
-#define CPUID_EBX_RESERVED                                           0xFFFFFFFF
+#define CPUID_EAX_80000008_EBX_RESERVED                              0xFFFFFFFF
     };
 
     uint32_t Flags;
   } ebx;
+#define CPUID_EAX_80000008_EBX_RESERVED_BITS                         0xFFFFFFFF
 
   union {
     struct {
       uint32_t reserved                                              : 32;
-#define CPUID_ECX_RESERVED                                           0xFFFFFFFF
+#define CPUID_EAX_80000008_ECX_RESERVED                              0xFFFFFFFF
     };
 
     uint32_t Flags;
   } ecx;
+#define CPUID_EAX_80000008_ECX_RESERVED_BITS                         0xFFFFFFFF
 
   union {
     struct {
       uint32_t reserved                                              : 32;
-#define CPUID_EDX_RESERVED                                           0xFFFFFFFF
+#define CPUID_EAX_80000008_EDX_RESERVED                              0xFFFFFFFF
     };
 
     uint32_t Flags;
   } edx;
+#define CPUID_EAX_80000008_EDX_RESERVED_BITS                         0xFFFFFFFF
 
 } cpuid_eax_80000008;
-
+#define CPUID_EAX_80000008_SNAPSHOT_INDEX                            32
+#define CPUID_EAX_80000008_EAX_POLICY_AND                            0x0000FFFF
+#define CPUID_EAX_80000008_EAX_POLICY_OR                             0x00000000
+#define CPUID_EAX_80000008_EBX_POLICY_AND                            0x00000000
+#define CPUID_EAX_80000008_EBX_POLICY_OR                             0x00000000
+#define CPUID_EAX_80000008_ECX_POLICY_AND                            0x00000000
+#define CPUID_EAX_80000008_ECX_POLICY_OR                             0x00000000
+#define CPUID_EAX_80000008_EDX_POLICY_AND                            0x00000000
+#define CPUID_EAX_80000008_EDX_POLICY_OR                             0x00000000
+
+#define CPUID_SNAPSHOT_COUNT                                         33
+
+#define CPUID_SNAPSHOT_INITIALIZER                                   \
+{                                                                    \
+  { 0x00000000, 0x00000000 },                                        \
+  { 0x00000001, 0x00000000 },                                        \
+  { 0x00000005, 0x00000000 },                                        \
+  { 0x00000006, 0x00000000 },                                        \
+  { 0x00000007, 0x00000000 },                                        \
+  { 0x00000007, 0x00000001 },                                        \
+  { 0x00000009, 0x00000000 },                                        \
+  { 0x0000000A, 0x00000000 },                                        \
+  { 0x0000000D, 0x00000000 },                                        \
+  { 0x0000000D, 0x00000001 },                                        \
+  { 0x0000000F, 0x00000000 },                                        \
+  { 0x0000000F, 0x00000001 },                                        \
+  { 0x00000010, 0x00000000 },                                        \
+  { 0x00000010, 0x00000001 },                                        \
+  { 0x00000010, 0x00000002 },                                        \
+  { 0x00000010, 0x00000003 },                                        \
+  { 0x00000012, 0x00000000 },                                        \
+  { 0x00000012, 0x00000001 },                                        \
+  { 0x00000014, 0x00000000 },                                        \
+  { 0x00000014, 0x00000001 },                                        \
+  { 0x00000015, 0x00000000 },                                        \
+  { 0x00000016, 0x00000000 },                                        \
+  { 0x00000017, 0x00000000 },                                        \
+  { 0x00000018, 0x00000000 },                                        \
+  { 0x80000000, 0x00000000 },                                        \
+  { 0x80000001, 0x00000000 },                                        \
+  { 0x80000002, 0x00000000 },                                        \
+  { 0x80000003, 0x00000000 },                                        \
+  { 0x80000004, 0x00000000 },                                        \
+  { 0x80000005, 0x00000000 },                                        \
+  { 0x80000006, 0x00000000 },                                        \
+  { 0x80000007, 0x00000000 },                                        \
+  { 0x80000008, 0x00000000 },                                        \
+}
+
+#define CPUID_SNAPSHOT_HAS_FEATURE(_, _feature)                      (((((const uint32_t *)(_))[(_feature) >> 5]) >> ((_feature) & 0x1F)) & 0x01)
+
+#define CPUID_SNAPSHOT_POLICY_INITIALIZER                            \
+{                                                                    \
+  { { 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF }, { 0x00000000, 0x00000000, 0x00000000, 0x00000000 } }, \
+  { { 0x0FFF3FFF, 0xFFFFFFFF, 0x7FFE760B, 0x1F8BFBFF }, { 0x00000000, 0x00000000, 0x00000000, 0x00000000 } }, \
+  { { 0x0000FFFF, 0x0000FFFF, 0x00000003, 0xFFFFFFFF }, { 0x00000000, 0x00000000, 0x00000000, 0x00000000 } }, \
+  { { 0x0097EFF7, 0x0000000F, 0x0000FF09, 0x00000000 }, { 0x00000000, 0x00000000, 0x00000000, 0x00000000 } }, \
+  { { 0xFFFFFFFF, 0xFFBFFFFB, 0x9AFF7FFF, 0xFC14C51C }, { 0x00000000, 0x00000000, 0x00000000, 0x00000000 } }, \
+  { { 0x4CEE1DF7, 0x0000000B, 0x00000003, 0x01CE4530 }, { 0x00000000, 0x00000000, 0x00000000, 0x00000000 } }, \
+  { { 0xFFFFFFFF, 0x00000000, 0x00000000, 0x00000000 }, { 0x00000000, 0x00000000, 0x00000000, 0x00000000 } }, \
+  { { 0xFFFFFFFF, 0x0000007F, 0x00000000, 0x00009FFF }, { 0x00000000, 0x00000000, 0x00000000, 0x00000000 } }, \
+  { { 0x000023FF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF }, { 0x00000000, 0x00000000, 0x00000000, 0x00000000 } }, \
+  { { 0x0000000E, 0xFFFFFFFF, 0x0001BBFF, 0xFFFFFFFF }, { 0x00000000, 0x00000000, 0x00000000, 0x00000000 } }, \
+  { { 0x00000000, 0xFFFFFFFF, 0x00000000, 0x00000002 }, { 0x00000000, 0x00000000, 0x00000000, 0x00000000 } }, \
+  { { 0x00000000, 0xFFFFFFFF, 0xFFFFFFFF, 0x00000007 }, { 0x00000000, 0x00000000, 0x00000000, 0x00000000 } }, \
+  { { 0xFFFFFFFF, 0x0000000E, 0x00000000, 0x00000000 }, { 0x00000000, 0x00000000, 0x00000000, 0x00000000 } }, \
+  { { 0x0000001F, 0xFFFFFFFF, 0x00000004, 0x0000FFFF }, { 0x00000000, 0x00000000, 0x00000000, 0x00000000 } }, \
+  { { 0x0000001F, 0xFFFFFFFF, 0x00000000, 0x0000FFFF }, { 0x00000000, 0x00000000, 0x00000000, 0x00000000 } }, \
+  { { 0x00000FFF, 0x00000000, 0x00000004, 0x0000FFFF }, { 0x00000000, 0x00000000, 0x00000000, 0x00000000 } }, \
+  { { 0x00000063, 0xFFFFFFFF, 0x00000000, 0x0000FFFF }, { 0x00000000, 0x00000000, 0x00000000, 0x00000000 } }, \
+  { { 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF }, { 0x00000000, 0x00000000, 0x00000000, 0x00000000 } }, \
+  { { 0xFFFFFFFF, 0x000001FF, 0x8000000F, 0x00000000 }, { 0x00000000, 0x00000000, 0x00000000, 0x00000000 } }, \
+  { { 0xFFFF0007, 0xFFFFFFFF, 0x00000000, 0x00000000 }, { 0x00000000, 0x00000000, 0x00000000, 0x00000000 } }, \
+  { { 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x00000000 }, { 0x00000000, 0x00000000, 0x00000000, 0x00000000 } }, \
+  { { 0x0000FFFF, 0x0000FFFF, 0x0000FFFF, 0x00000000 }, { 0x00000000, 0x00000000, 0x00000000, 0x00000000 } }, \
+  { { 0xFFFFFFFF, 0x0001FFFF, 0xFFFFFFFF, 0xFFFFFFFF }, { 0x00000000, 0x00000000, 0x00000000, 0x00000000 } }, \
+  { { 0xFFFFFFFF, 0xFFFF070F, 0xFFFFFFFF, 0x03FFC1FF }, { 0x00000000, 0x00000000, 0x00000000, 0x00000000 } }, \
+  { { 0xFFFFFFFF, 0x00000000, 0x00000000, 0x00000000 }, { 0x00000000, 0x00000000, 0x00000000, 0x00000000 } }, \
+  { { 0x00000000, 0x00000000, 0x00000121, 0x2C100800 }, { 0x00000000, 0x00000000, 0x00000000, 0x00000000 } }, \
+  { { 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF }, { 0x00000000, 0x00000000, 0x00000000, 0x00000000 } }, \
+  { { 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF }, { 0x00000000, 0x00000000, 0x00000000, 0x00000000 } }, \
+  { { 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF }, { 0x00000000, 0x00000000, 0x00000000, 0x00000000 } }, \
+  { { 0x00000000, 0x00000000, 0x00000000, 0x00000000 }, { 0x00000000, 0x00000000, 0x00000000, 0x00000000 } }, \
+  { { 0x00000000, 0x00000000, 0xFFFFF0FF, 0x00000000 }, { 0x00000000, 0x00000000, 0x00000000, 0x00000000 } }, \
+  { { 0x00000000, 0x00000000, 0x00000000, 0x00000100 }, { 0x00000000, 0x00000000, 0x00000000, 0x00000000 } }, \
+  { { 0x0000FFFF, 0x00000000, 0x00000000, 0x00000000 }, { 0x00000000, 0x00000000, 0x00000000, 0x00000000 } }, \
+}
 /**
  * @}
  */
@@ -2585,14 +3381,19 @@ typedef struct {
  * @{
  */
 #define IA32_P5_MC_ADDR                                              0x00000000
+#define IA32_P5_MC_ADDR_SLOT                                         0
 #define IA32_P5_MC_TYPE                                              0x00000001
+#define IA32_P5_MC_TYPE_SLOT                                         271
 /**
  * @}
  */
 
 #define IA32_MONITOR_FILTER_SIZE                                     0x00000006
+#define IA32_MONITOR_FILTER_SIZE_SLOT                                95
 #define IA32_TIME_STAMP_COUNTER                                      0x00000010
+#define IA32_TIME_STAMP_COUNTER_SLOT                                 250
 #define IA32_PLATFORM_ID                                             0x00000017
+#define IA32_PLATFORM_ID_SLOT                                        109
 typedef union {
   struct {
     uint64_t reserved_1                                              : 50;
@@ -2603,8 +3404,10 @@ typedef union {
 
   uint64_t Flags;
 } ia32_platform_id_register;
+#define IA32_PLATFORM_ID_RESERVED_BITS                               0xFFE3FFFFFFFFFFFF
 
 #define IA32_APIC_BASE                                               0x0000001B
+#define IA32_APIC_BASE_SLOT                                          163
 typedef union {
   struct {
     uint64_t reserved_1                                              : 8;
@@ -2622,8 +3425,11 @@ typedef union {
 
   uint64_t Flags;
 } ia32_apic_base_register;
+#define IA32_APIC_BASE_RESERVED_BITS                                 0xFFF00000000002FF
+#define IA32_APIC_BASE_ADDRESS_BITS                                  0xFFFFFFFFFF000
 
 #define IA32_FEATURE_CONTROL                                         0x0000003A
+#define IA32_FEATURE_CONTROL_SLOT                                    405
 typedef union {
   struct {
     uint64_t lock_bit                                                : 1;
@@ -2650,13 +3456,16 @@ typedef union {
 
   uint64_t Flags;
 } ia32_feature_control_register;
+#define IA32_FEATURE_CONTROL_RESERVED_BITS                           0xFFFFFFFFFFE900F8
 
 #define IA32_TSC_ADJUST                                              0x0000003B
+#define IA32_TSC_ADJUST_SLOT                                         166
 typedef struct {
   uint64_t thread_adjust;
 } ia32_tsc_adjust_register;
 
 #define IA32_SPEC_CTRL                                               0x00000048
+#define IA32_SPEC_CTRL_SLOT                                          103
 typedef union {
   struct {
     uint64_t ibrs                                                    : 1;
@@ -2670,8 +3479,10 @@ typedef union {
 
   uint64_t Flags;
 } ia32_spec_ctrl_register;
+#define IA32_SPEC_CTRL_RESERVED_BITS                                 0xFFFFFFFFFFFFFFF8
 
 #define IA32_PRED_CMD                                                0x00000049
+#define IA32_PRED_CMD_SLOT                                           389
 typedef union {
   struct {
     uint64_t ibpb                                                    : 1;
@@ -2681,9 +3492,12 @@ typedef union {
 
   uint64_t Flags;
 } ia32_pred_cmd_register;
+#define IA32_PRED_CMD_RESERVED_BITS                                  0xFFFFFFFFFFFFFFFE
 
 #define IA32_BIOS_UPDT_TRIG                                          0x00000079
+#define IA32_BIOS_UPDT_TRIG_SLOT                                     126
 #define IA32_BIOS_SIGN_ID                                            0x0000008B
+#define IA32_BIOS_SIGN_ID_SLOT                                       410
 typedef union {
   struct {
     uint64_t reserved                                                : 32;
@@ -2694,6 +3508,7 @@ typedef union {
 
   uint64_t Flags;
 } ia32_bios_sign_id_register;
+#define IA32_BIOS_SIGN_ID_RESERVED_BITS                              0x00
 
 /**
  * @defgroup ia32_sgxlepubkeyhash \
@@ -2701,14 +3516,19 @@ typedef union {
  * @{
  */
 #define IA32_SGXLEPUBKEYHASH0                                        0x0000008C
+#define IA32_SGXLEPUBKEYHASH0_SLOT                                   170
 #define IA32_SGXLEPUBKEYHASH1                                        0x0000008D
+#define IA32_SGXLEPUBKEYHASH1_SLOT                                   435
 #define IA32_SGXLEPUBKEYHASH2                                        0x0000008E
+#define IA32_SGXLEPUBKEYHASH2_SLOT                                   200
 #define IA32_SGXLEPUBKEYHASH3                                        0x0000008F
+#define IA32_SGXLEPUBKEYHASH3_SLOT                                   472
 /**
  * @}
  */
 
 #define IA32_SMM_MONITOR_CTL                                         0x0000009B
+#define IA32_SMM_MONITOR_CTL_SLOT                                    148
 typedef union {
   struct {
     uint64_t valid                                                   : 1;
@@ -2724,6 +3544,7 @@ typedef union {
 
   uint64_t Flags;
 } ia32_smm_monitor_ctl_register;
+#define IA32_SMM_MONITOR_CTL_RESERVED_BITS                           0xFFFFFFFF00000FFA
 
 typedef struct {
   uint32_t mseg_header_revision;
@@ -2739,34 +3560,60 @@ typedef struct {
 } ia32_mseg_header;
 
 #define IA32_SMBASE                                                  0x0000009E
+#define IA32_SMBASE_SLOT                                             455
 /**
  * @defgroup ia32_pmc \
  *           IA32_PMC(n)
  * @{
  */
 #define IA32_PMC0                                                    0x000000C1
+#define IA32_PMC0_SLOT                                               241
 #define IA32_PMC1                                                    0x000000C2
+#define IA32_PMC1_SLOT                                               8
 #define IA32_PMC2                                                    0x000000C3
+#define IA32_PMC2_SLOT                                               256
 #define IA32_PMC3                                                    0x000000C4
+#define IA32_PMC3_SLOT                                               34
 #define IA32_PMC4                                                    0x000000C5
+#define IA32_PMC4_SLOT                                               309
 #define IA32_PMC5                                                    0x000000C6
+#define IA32_PMC5_SLOT                                               64
 #define IA32_PMC6                                                    0x000000C7
+#define IA32_PMC6_SLOT                                               336
 #define IA32_PMC7                                                    0x000000C8
+#define IA32_PMC7_SLOT                                               96
+/**
+ * @defgroup ia32_pmc_encoding \
+ *           General-purpose performance counter helpers
+ * @{
+ */
+#define IA32_PMC_WIDTH_MASK(_cpuid_eax)                              ((1ULL << (((_cpuid_eax) >> 16) & 0xFF)) - 1)
+#define IA32_PMC_OVERFLOWED(_, _previous, _width_mask)               (((_) & (_width_mask)) < ((_previous) & (_width_mask)))
+#define IA32_PMC_MSR(_)                                              (0xC1 + (_))
+#define IA32_PMC_INDEX(_msr)                                         ((_msr) - 0xC1)
+#define IA32_PMC_IN_RANGE(_msr, _count)                              (((_msr) >= 0xC1) & ((_msr) < 0xC1 + (_count)))
+/**
+ * @}
+ */
+
 /**
  * @}
  */
 
 #define IA32_MPERF                                                   0x000000E7
+#define IA32_MPERF_SLOT                                              342
 typedef struct {
   uint64_t c0_mcnt;
 } ia32_mperf_register;
 
 #define IA32_APERF                                                   0x000000E8
+#define IA32_APERF_SLOT                                              82
 typedef struct {
   uint64_t c0_acnt;
 } ia32_aperf_register;
 
 #define IA32_MTRRCAP                                                 0x000000FE
+#define IA32_MTRRCAP_SLOT                                            442
 typedef union {
   struct {
     uint64_t variable_range_registers_count                          : 8;
@@ -2783,8 +3630,10 @@ typedef union {
 
   uint64_t Flags;
 } ia32_mtrrcap_register;
+#define IA32_MTRRCAP_RESERVED_BITS                                   0xFFFFFFFFFFFFF200
 
 #define IA32_ARCH_CAPABILITIES                                       0x0000010A
+#define IA32_ARCH_CAPABILITIES_SLOT                                  118
 typedef union {
   struct {
     uint64_t rdcl_no                                                 : 1;
@@ -2810,8 +3659,10 @@ typedef union {
 
   uint64_t Flags;
 } ia32_arch_capabilities_register;
+#define IA32_ARCH_CAPABILITIES_RESERVED_BITS                         0xFFFFFFFFFFFFFE00
 
 #define IA32_FLUSH_CMD                                               0x0000010B
+#define IA32_FLUSH_CMD_SLOT                                          391
 typedef union {
   struct {
     uint64_t l1d_flush                                               : 1;
@@ -2821,8 +3672,10 @@ typedef union {
 
   uint64_t Flags;
 } ia32_flush_cmd_register;
+#define IA32_FLUSH_CMD_RESERVED_BITS                                 0xFFFFFFFFFFFFFFFE
 
 #define IA32_TSX_CTRL                                                0x00000122
+#define IA32_TSX_CTRL_SLOT                                           499
 typedef union {
   struct {
     uint64_t rtm_disable                                             : 1;
@@ -2834,8 +3687,10 @@ typedef union {
 
   uint64_t Flags;
 } ia32_tsx_ctrl_register;
+#define IA32_TSX_CTRL_RESERVED_BITS                                  0xFFFFFFFFFFFFFFFC
 
 #define IA32_SYSENTER_CS                                             0x00000174
+#define IA32_SYSENTER_CS_SLOT                                        257
 typedef union {
   struct {
     uint64_t cs_selector                                             : 16;
@@ -2848,10 +3703,14 @@ typedef union {
 
   uint64_t Flags;
 } ia32_sysenter_cs_register;
+#define IA32_SYSENTER_CS_RESERVED_BITS                               0x00
 
 #define IA32_SYSENTER_ESP                                            0x00000175
+#define IA32_SYSENTER_ESP_SLOT                                       21
 #define IA32_SYSENTER_EIP                                            0x00000176
+#define IA32_SYSENTER_EIP_SLOT                                       293
 #define IA32_MCG_CAP                                                 0x00000179
+#define IA32_MCG_CAP_SLOT                                            85
 typedef union {
   struct {
     uint64_t count                                                   : 8;
@@ -2879,8 +3738,10 @@ typedef union {
 
   uint64_t Flags;
 } ia32_mcg_cap_register;
+#define IA32_MCG_CAP_RESERVED_BITS                                   0xFFFFFFFFF200F000
 
 #define IA32_MCG_STATUS                                              0x0000017A
+#define IA32_MCG_STATUS_SLOT                                         367
 typedef union {
   struct {
     uint64_t ripv                                                    : 1;
@@ -2896,17 +3757,23 @@ typedef union {
 
   uint64_t Flags;
 } ia32_mcg_status_register;
+#define IA32_MCG_STATUS_RESERVED_BITS                                0xFFFFFFFFFFFFFFF0
 
 #define IA32_MCG_CTL                                                 0x0000017B
+#define IA32_MCG_CTL_SLOT                                            117
 /**
  * @defgroup ia32_perfevtsel \
  *           IA32_PERFEVTSEL(n)
  * @{
  */
 #define IA32_PERFEVTSEL0                                             0x00000186
+#define IA32_PERFEVTSEL0_SLOT                                        35
 #define IA32_PERFEVTSEL1                                             0x00000187
+#define IA32_PERFEVTSEL1_SLOT                                        307
 #define IA32_PERFEVTSEL2                                             0x00000188
+#define IA32_PERFEVTSEL2_SLOT                                        67
 #define IA32_PERFEVTSEL3                                             0x00000189
+#define IA32_PERFEVTSEL3_SLOT                                        338
 typedef union {
   struct {
     uint64_t event_select                                            : 8;
@@ -2936,12 +3803,36 @@ typedef union {
 
   uint64_t Flags;
 } ia32_perfevtsel_register;
+#define IA32_PERFEVTSEL_RESERVED_BITS                                0xFFFFFFFF00000000
+
+/**
+ * @defgroup ia32_perfevtsel_encoding \
+ *           Performance event select encoding
+ * @{
+ */
+#define IA32_PERFEVTSEL_UNHALTED_CORE_CYCLES                         0x0000003C
+#define IA32_PERFEVTSEL_INSTRUCTIONS_RETIRED                         0x000000C0
+#define IA32_PERFEVTSEL_UNHALTED_REFERENCE_CYCLES                    0x0000013C
+#define IA32_PERFEVTSEL_LLC_REFERENCE                                0x00004F2E
+#define IA32_PERFEVTSEL_LLC_MISSES                                   0x0000412E
+#define IA32_PERFEVTSEL_BRANCH_INSTRUCTIONS_RETIRED                  0x000000C4
+#define IA32_PERFEVTSEL_BRANCH_MISSES_RETIRED                        0x000000C5
+#define IA32_PERFEVTSEL_TOPDOWN_SLOTS                                0x000001A4
+#define IA32_PERFEVTSEL_ARCHITECTURAL_EVENT_AVAILABLE(_, _cpuid_eax, _index) (((((_) >> (_index)) & 0x01) ^ 0x01) & ((((_cpuid_eax) >> 24) & 0xFF) > (_index)))
+#define IA32_PERFEVTSEL_ENCODE(_event, _cmask, _flags)               (((_event) & 0xFFFFULL) | (((_cmask) & 0xFFULL) << 24) | ((_flags) & 0xBF0000ULL) | 0x400000ULL)
+#define IA32_PERFEVTSEL_MSR(_)                                       (0x186 + (_))
+#define IA32_PERFEVTSEL_INDEX(_msr)                                  ((_msr) - 0x186)
+#define IA32_PERFEVTSEL_IN_RANGE(_msr, _count)                       (((_msr) >= 0x186) & ((_msr) < 0x186 + (_count)))
+/**
+ * @}
+ */
 
 /**
  * @}
  */
 
 #define IA32_PERF_STATUS                                             0x00000198
+#define IA32_PERF_STATUS_SLOT                                        321
 typedef union {
   struct {
     uint64_t current_performance_state_value                         : 16;
@@ -2951,8 +3842,10 @@ typedef union {
 
   uint64_t Flags;
 } ia32_perf_status_register;
+#define IA32_PERF_STATUS_RESERVED_BITS                               0xFFFFFFFFFFFF0000
 
 #define IA32_PERF_CTL                                                0x00000199
+#define IA32_PERF_CTL_SLOT                                           83
 typedef union {
   struct {
     uint64_t target_performance_state_value                          : 16;
@@ -2965,8 +3858,10 @@ typedef union {
 
   uint64_t Flags;
 } ia32_perf_ctl_register;
+#define IA32_PERF_CTL_RESERVED_BITS                                  0xFFFFFFFEFFFF0000
 
 #define IA32_CLOCK_MODULATION                                        0x0000019A
+#define IA32_CLOCK_MODULATION_SLOT                                   355
 typedef union {
   struct {
     uint64_t extended_on_demand_clock_modulation_duty_cycle          : 1;
@@ -2980,8 +3875,10 @@ typedef union {
 
   uint64_t Flags;
 } ia32_clock_modulation_register;
+#define IA32_CLOCK_MODULATION_RESERVED_BITS                          0xFFFFFFFFFFFFFFE0
 
 #define IA32_THERM_INTERRUPT                                         0x0000019B
+#define IA32_THERM_INTERRUPT_SLOT                                    123
 typedef union {
   struct {
     uint64_t high_temperature_interrupt_enable                       : 1;
@@ -3010,8 +3907,10 @@ typedef union {
 
   uint64_t Flags;
 } ia32_therm_interrupt_register;
+#define IA32_THERM_INTERRUPT_RESERVED_BITS                           0xFFFFFFFFFE0000E0
 
 #define IA32_THERM_STATUS                                            0x0000019C
+#define IA32_THERM_STATUS_SLOT                                       383
 typedef union {
   struct {
     uint64_t thermal_status                                          : 1;
@@ -3058,8 +3957,10 @@ typedef union {
 
   uint64_t Flags;
 } ia32_therm_status_register;
+#define IA32_THERM_STATUS_RESERVED_BITS                              0xFFFFFFFF07800000
 
 #define IA32_MISC_ENABLE                                             0x000001A0
+#define IA32_MISC_ENABLE_SLOT                                        444
 typedef union {
   struct {
     uint64_t fast_strings_enable                                     : 1;
@@ -3094,8 +3995,10 @@ typedef union {
 
   uint64_t Flags;
 } ia32_misc_enable_register;
+#define IA32_MISC_ENABLE_RESERVED_BITS                               0xFFFFFFFBFF3AE776
 
 #define IA32_ENERGY_PERF_BIAS                                        0x000001B0
+#define IA32_ENERGY_PERF_BIAS_SLOT                                   190
 typedef union {
   struct {
     uint64_t power_policy_preference                                 : 4;
@@ -3105,8 +4008,10 @@ typedef union {
 
   uint64_t Flags;
 } ia32_energy_perf_bias_register;
+#define IA32_ENERGY_PERF_BIAS_RESERVED_BITS                          0xFFFFFFFFFFFFFFF0
 
 #define IA32_PACKAGE_THERM_STATUS                                    0x000001B1
+#define IA32_PACKAGE_THERM_STATUS_SLOT                               463
 typedef union {
   struct {
     uint64_t thermal_status                                          : 1;
@@ -3141,8 +4046,10 @@ typedef union {
 
   uint64_t Flags;
 } ia32_package_therm_status_register;
+#define IA32_PACKAGE_THERM_STATUS_RESERVED_BITS                      0xFFFFFFFFFF80F000
 
 #define IA32_PACKAGE_THERM_INTERRUPT                                 0x000001B2
+#define IA32_PACKAGE_THERM_INTERRUPT_SLOT                            218
 typedef union {
   struct {
     uint64_t high_temperature_interrupt_enable                       : 1;
@@ -3170,8 +4077,10 @@ typedef union {
 
   uint64_t Flags;
 } ia32_package_therm_interrupt_register;
+#define IA32_PACKAGE_THERM_INTERRUPT_RESERVED_BITS                   0xFFFFFFFFFE0000E8
 
 #define IA32_DEBUGCTL                                                0x000001D9
+#define IA32_DEBUGCTL_SLOT                                           70
 typedef union {
   struct {
     uint64_t lbr                                                     : 1;
@@ -3204,8 +4113,10 @@ typedef union {
 
   uint64_t Flags;
 } ia32_debugctl_register;
+#define IA32_DEBUGCTL_RESERVED_BITS                                  0xFFFFFFFFFFFF003C
 
 #define IA32_SMRR_PHYSBASE                                           0x000001F2
+#define IA32_SMRR_PHYSBASE_SLOT                                      208
 typedef union {
   struct {
     uint64_t type                                                    : 8;
@@ -3218,8 +4129,10 @@ typedef union {
 
   uint64_t Flags;
 } ia32_smrr_physbase_register;
+#define IA32_SMRR_PHYSBASE_RESERVED_BITS                             0xFFFFFFFF00000F00
 
 #define IA32_SMRR_PHYSMASK                                           0x000001F3
+#define IA32_SMRR_PHYSMASK_SLOT                                      482
 typedef union {
   struct {
     uint64_t reserved_1                                              : 11;
@@ -3232,10 +4145,14 @@ typedef union {
 
   uint64_t Flags;
 } ia32_smrr_physmask_register;
+#define IA32_SMRR_PHYSMASK_RESERVED_BITS                             0xFFFFFFFF000007FF
 
 #define IA32_PLATFORM_DCA_CAP                                        0x000001F8
+#define IA32_PLATFORM_DCA_CAP_SLOT                                   305
 #define IA32_CPU_DCA_CAP                                             0x000001F9
+#define IA32_CPU_DCA_CAP_SLOT                                        66
 #define IA32_DCA_0_CAP                                               0x000001FA
+#define IA32_DCA_0_CAP_SLOT                                          337
 typedef union {
   struct {
     uint64_t dca_active                                              : 1;
@@ -3260,6 +4177,7 @@ typedef union {
 
   uint64_t Flags;
 } ia32_dca_0_cap_register;
+#define IA32_DCA_0_CAP_RESERVED_BITS                                 0xFFFFFFFFFAFE1800
 
 /**
  * @defgroup ia32_mtrr_physbase \
@@ -3278,17 +4196,29 @@ typedef union {
 
   uint64_t Flags;
 } ia32_mtrr_physbase_register;
+#define IA32_MTRR_PHYSBASE_RESERVED_BITS                             0xFFF0000000000F00
+#define IA32_MTRR_PHYSBASE_ADDRESS_BITS                              0xFFFFFFFFFF000
 
 #define IA32_MTRR_PHYSBASE0                                          0x00000200
+#define IA32_MTRR_PHYSBASE0_SLOT                                     437
 #define IA32_MTRR_PHYSBASE1                                          0x00000202
+#define IA32_MTRR_PHYSBASE1_SLOT                                     466
 #define IA32_MTRR_PHYSBASE2                                          0x00000204
+#define IA32_MTRR_PHYSBASE2_SLOT                                     494
 #define IA32_MTRR_PHYSBASE3                                          0x00000206
+#define IA32_MTRR_PHYSBASE3_SLOT                                     15
 #define IA32_MTRR_PHYSBASE4                                          0x00000208
+#define IA32_MTRR_PHYSBASE4_SLOT                                     47
 #define IA32_MTRR_PHYSBASE5                                          0x0000020A
+#define IA32_MTRR_PHYSBASE5_SLOT                                     78
 #define IA32_MTRR_PHYSBASE6                                          0x0000020C
+#define IA32_MTRR_PHYSBASE6_SLOT                                     111
 #define IA32_MTRR_PHYSBASE7                                          0x0000020E
+#define IA32_MTRR_PHYSBASE7_SLOT                                     142
 #define IA32_MTRR_PHYSBASE8                                          0x00000210
+#define IA32_MTRR_PHYSBASE8_SLOT                                     174
 #define IA32_MTRR_PHYSBASE9                                          0x00000212
+#define IA32_MTRR_PHYSBASE9_SLOT                                     205
 /**
  * @}
  */
@@ -3310,17 +4240,29 @@ typedef union {
 
   uint64_t Flags;
 } ia32_mtrr_physmask_register;
+#define IA32_MTRR_PHYSMASK_RESERVED_BITS                             0xFFF00000000007FF
+#define IA32_MTRR_PHYSMASK_ADDRESS_BITS                              0xFFFFFFFFFF000
 
 #define IA32_MTRR_PHYSMASK0                                          0x00000201
+#define IA32_MTRR_PHYSMASK0_SLOT                                     201
 #define IA32_MTRR_PHYSMASK1                                          0x00000203
+#define IA32_MTRR_PHYSMASK1_SLOT                                     221
 #define IA32_MTRR_PHYSMASK2                                          0x00000205
+#define IA32_MTRR_PHYSMASK2_SLOT                                     255
 #define IA32_MTRR_PHYSMASK3                                          0x00000207
+#define IA32_MTRR_PHYSMASK3_SLOT                                     285
 #define IA32_MTRR_PHYSMASK4                                          0x00000209
+#define IA32_MTRR_PHYSMASK4_SLOT                                     318
 #define IA32_MTRR_PHYSMASK5                                          0x0000020B
+#define IA32_MTRR_PHYSMASK5_SLOT                                     350
 #define IA32_MTRR_PHYSMASK6                                          0x0000020D
+#define IA32_MTRR_PHYSMASK6_SLOT                                     380
 #define IA32_MTRR_PHYSMASK7                                          0x0000020F
+#define IA32_MTRR_PHYSMASK7_SLOT                                     415
 #define IA32_MTRR_PHYSMASK8                                          0x00000211
+#define IA32_MTRR_PHYSMASK8_SLOT                                     445
 #define IA32_MTRR_PHYSMASK9                                          0x00000213
+#define IA32_MTRR_PHYSMASK9_SLOT                                     468
 /**
  * @}
  */
@@ -3338,6 +4280,7 @@ typedef union {
 #define IA32_MTRR_FIX64K_BASE                                        0x00000000
 #define IA32_MTRR_FIX64K_SIZE                                        0x00010000
 #define IA32_MTRR_FIX64K_00000                                       0x00000250
+#define IA32_MTRR_FIX64K_00000_SLOT                                  162
 /**
  * @}
  */
@@ -3350,7 +4293,9 @@ typedef union {
 #define IA32_MTRR_FIX16K_BASE                                        0x00080000
 #define IA32_MTRR_FIX16K_SIZE                                        0x00004000
 #define IA32_MTRR_FIX16K_80000                                       0x00000258
+#define IA32_MTRR_FIX16K_80000_SLOT                                  296
 #define IA32_MTRR_FIX16K_A0000                                       0x00000259
+#define IA32_MTRR_FIX16K_A0000_SLOT                                  50
 /**
  * @}
  */
@@ -3363,13 +4308,21 @@ typedef union {
 #define IA32_MTRR_FIX4K_BASE                                         0x000C0000
 #define IA32_MTRR_FIX4K_SIZE                                         0x00001000
 #define IA32_MTRR_FIX4K_C0000                                        0x00000268
+#define IA32_MTRR_FIX4K_C0000_SLOT                                   38
 #define IA32_MTRR_FIX4K_C8000                                        0x00000269
+#define IA32_MTRR_FIX4K_C8000_SLOT                                   288
 #define IA32_MTRR_FIX4K_D0000                                        0x0000026A
+#define IA32_MTRR_FIX4K_D0000_SLOT                                   63
 #define IA32_MTRR_FIX4K_D8000                                        0x0000026B
+#define IA32_MTRR_FIX4K_D8000_SLOT                                   326
 #define IA32_MTRR_FIX4K_E0000                                        0x0000026C
+#define IA32_MTRR_FIX4K_E0000_SLOT                                   89
 #define IA32_MTRR_FIX4K_E8000                                        0x0000026D
+#define IA32_MTRR_FIX4K_E8000_SLOT                                   358
 #define IA32_MTRR_FIX4K_F0000                                        0x0000026E
+#define IA32_MTRR_FIX4K_F0000_SLOT                                   101
 #define IA32_MTRR_FIX4K_F8000                                        0x0000026F
+#define IA32_MTRR_FIX4K_F8000_SLOT                                   390
 /**
  * @}
  */
@@ -3382,6 +4335,7 @@ typedef union {
  */
 
 #define IA32_PAT                                                     0x00000277
+#define IA32_PAT_SLOT                                                14
 typedef union {
   struct {
     uint64_t pa0                                                     : 3;
@@ -3412,6 +4366,7 @@ typedef union {
 
   uint64_t Flags;
 } ia32_pat_register;
+#define IA32_PAT_RESERVED_BITS                                       0xF8F8F8F8F8F8F8F8
 
 /**
  * @defgroup ia32_mc_ctl2 \
@@ -3419,37 +4374,69 @@ typedef union {
  * @{
  */
 #define IA32_MC0_CTL2                                                0x00000280
+#define IA32_MC0_CTL2_SLOT                                           404
 #define IA32_MC1_CTL2                                                0x00000281
+#define IA32_MC1_CTL2_SLOT                                           175
 #define IA32_MC2_CTL2                                                0x00000282
+#define IA32_MC2_CTL2_SLOT                                           441
 #define IA32_MC3_CTL2                                                0x00000283
+#define IA32_MC3_CTL2_SLOT                                           197
 #define IA32_MC4_CTL2                                                0x00000284
+#define IA32_MC4_CTL2_SLOT                                           473
 #define IA32_MC5_CTL2                                                0x00000285
+#define IA32_MC5_CTL2_SLOT                                           233
 #define IA32_MC6_CTL2                                                0x00000286
+#define IA32_MC6_CTL2_SLOT                                           506
 #define IA32_MC7_CTL2                                                0x00000287
+#define IA32_MC7_CTL2_SLOT                                           267
 #define IA32_MC8_CTL2                                                0x00000288
+#define IA32_MC8_CTL2_SLOT                                           27
 #define IA32_MC9_CTL2                                                0x00000289
+#define IA32_MC9_CTL2_SLOT                                           297
 #define IA32_MC10_CTL2                                               0x0000028A
+#define IA32_MC10_CTL2_SLOT                                          58
 #define IA32_MC11_CTL2                                               0x0000028B
+#define IA32_MC11_CTL2_SLOT                                          330
 #define IA32_MC12_CTL2                                               0x0000028C
+#define IA32_MC12_CTL2_SLOT                                          90
 #define IA32_MC13_CTL2                                               0x0000028D
+#define IA32_MC13_CTL2_SLOT                                          362
 #define IA32_MC14_CTL2                                               0x0000028E
+#define IA32_MC14_CTL2_SLOT                                          122
 #define IA32_MC15_CTL2                                               0x0000028F
+#define IA32_MC15_CTL2_SLOT                                          395
 #define IA32_MC16_CTL2                                               0x00000290
+#define IA32_MC16_CTL2_SLOT                                          155
 #define IA32_MC17_CTL2                                               0x00000291
+#define IA32_MC17_CTL2_SLOT                                          425
 #define IA32_MC18_CTL2                                               0x00000292
+#define IA32_MC18_CTL2_SLOT                                          184
 #define IA32_MC19_CTL2                                               0x00000293
+#define IA32_MC19_CTL2_SLOT                                          458
 #define IA32_MC20_CTL2                                               0x00000294
+#define IA32_MC20_CTL2_SLOT                                          217
 #define IA32_MC21_CTL2                                               0x00000295
+#define IA32_MC21_CTL2_SLOT                                          489
 #define IA32_MC22_CTL2                                               0x00000296
+#define IA32_MC22_CTL2_SLOT                                          240
 #define IA32_MC23_CTL2                                               0x00000297
+#define IA32_MC23_CTL2_SLOT                                          9
 #define IA32_MC24_CTL2                                               0x00000298
+#define IA32_MC24_CTL2_SLOT                                          281
 #define IA32_MC25_CTL2                                               0x00000299
+#define IA32_MC25_CTL2_SLOT                                          43
 #define IA32_MC26_CTL2                                               0x0000029A
+#define IA32_MC26_CTL2_SLOT                                          316
 #define IA32_MC27_CTL2                                               0x0000029B
+#define IA32_MC27_CTL2_SLOT                                          79
 #define IA32_MC28_CTL2                                               0x0000029C
+#define IA32_MC28_CTL2_SLOT                                          344
 #define IA32_MC29_CTL2                                               0x0000029D
+#define IA32_MC29_CTL2_SLOT                                          102
 #define IA32_MC30_CTL2                                               0x0000029E
+#define IA32_MC30_CTL2_SLOT                                          372
 #define IA32_MC31_CTL2                                               0x0000029F
+#define IA32_MC31_CTL2_SLOT                                          132
 typedef union {
   struct {
     uint64_t corrected_error_count_threshold                         : 15;
@@ -3462,12 +4449,14 @@ typedef union {
 
   uint64_t Flags;
 } ia32_mc_ctl2_register;
+#define IA32_MC_CTL2_RESERVED_BITS                                   0xFFFFFFFFBFFF8000
 
 /**
  * @}
  */
 
 #define IA32_MTRR_DEF_TYPE                                           0x000002FF
+#define IA32_MTRR_DEF_TYPE_SLOT                                      120
 typedef union {
   struct {
     uint64_t default_memory_type                                     : 3;
@@ -3482,6 +4471,7 @@ typedef union {
 
   uint64_t Flags;
 } ia32_mtrr_def_type_register;
+#define IA32_MTRR_DEF_TYPE_RESERVED_BITS                             0xFFFFFFFFFFFFF3F8
 
 /**
  * @defgroup ia32_fixed_ctr \
@@ -3489,13 +4479,29 @@ typedef union {
  * @{
  */
 #define IA32_FIXED_CTR0                                              0x00000309
+#define IA32_FIXED_CTR0_SLOT                                         278
 #define IA32_FIXED_CTR1                                              0x0000030A
+#define IA32_FIXED_CTR1_SLOT                                         39
 #define IA32_FIXED_CTR2                                              0x0000030B
+#define IA32_FIXED_CTR2_SLOT                                         310
+/**
+ * @defgroup ia32_fixed_ctr_encoding \
+ *           Fixed-function performance counter helpers
+ * @{
+ */
+#define IA32_FIXED_CTR_MSR(_)                                        (0x309 + (_))
+#define IA32_FIXED_CTR_INDEX(_msr)                                   ((_msr) - 0x309)
+#define IA32_FIXED_CTR_IN_RANGE(_msr, _count)                        (((_msr) >= 0x309) & ((_msr) < 0x309 + (_count)))
+/**
+ * @}
+ */
+
 /**
  * @}
  */
 
 #define IA32_PERF_CAPABILITIES                                       0x00000345
+#define IA32_PERF_CAPABILITIES_SLOT                                  204
 typedef union {
   struct {
     uint64_t lbr_format                                              : 6;
@@ -3515,8 +4521,10 @@ typedef union {
 
   uint64_t Flags;
 } ia32_perf_capabilities_register;
+#define IA32_PERF_CAPABILITIES_RESERVED_BITS                         0xFFFFFFFFFFFFC000
 
 #define IA32_FIXED_CTR_CTRL                                          0x0000038D
+#define IA32_FIXED_CTR_CTRL_SLOT                                     322
 typedef union {
   struct {
     uint64_t en0_os                                                  : 1;
@@ -3548,8 +4556,16 @@ typedef union {
 
   uint64_t Flags;
 } ia32_fixed_ctr_ctrl_register;
-
+#define IA32_FIXED_CTR_CTRL_RESERVED_BITS                            0xFFFFFFFFFFFFF000
+
+#define IA32_FIXED_CTR_CTRL_OS                                       0x00000001
+#define IA32_FIXED_CTR_CTRL_USR                                      0x00000002
+#define IA32_FIXED_CTR_CTRL_ANY_THREAD                               0x00000004
+#define IA32_FIXED_CTR_CTRL_PMI                                      0x00000008
+#define IA32_FIXED_CTR_CTRL_ENCODE(_n, _)                            (((_) & 0x0FULL) << ((_n) * 4))
+#define IA32_FIXED_CTR_CTRL_FIELD_MASK(_n)                           (0x0FULL << ((_n) * 4))
 #define IA32_PERF_GLOBAL_STATUS                                      0x0000038E
+#define IA32_PERF_GLOBAL_STATUS_SLOT                                 80
 typedef union {
   struct {
     uint64_t ovf_pmc0                                                : 1;
@@ -3587,8 +4603,10 @@ typedef union {
 
   uint64_t Flags;
 } ia32_perf_global_status_register;
+#define IA32_PERF_GLOBAL_STATUS_RESERVED_BITS                        0x37FFFF8FFFFFFF0
 
 #define IA32_PERF_GLOBAL_CTRL                                        0x0000038F
+#define IA32_PERF_GLOBAL_CTRL_SLOT                                   354
 typedef union {
   struct {
     uint64_t en_pmcn                                                 : 32;
@@ -3599,8 +4617,13 @@ typedef union {
 
   uint64_t Flags;
 } ia32_perf_global_ctrl_register;
+#define IA32_PERF_GLOBAL_CTRL_RESERVED_BITS                          0x00
 
+#define IA32_PERF_GLOBAL_CTRL_PMC_FLAG(_)                            (1ULL << (_))
+#define IA32_PERF_GLOBAL_CTRL_FIXED_CTR_FLAG(_)                      (1ULL << (32 + (_)))
+#define IA32_PERF_GLOBAL_CTRL_SUPPORTED(_cpuid_eax, _cpuid_edx)      (((1ULL << (((_cpuid_eax) >> 8) & 0xFF)) - 1) | (((1ULL << ((_cpuid_edx) & 0x1F)) - 1) << 32))
 #define IA32_PERF_GLOBAL_STATUS_RESET                                0x00000390
+#define IA32_PERF_GLOBAL_STATUS_RESET_SLOT                           114
 typedef union {
   struct {
     uint64_t clear_ovf_pmcn                                          : 32;
@@ -3627,8 +4650,11 @@ typedef union {
 
   uint64_t Flags;
 } ia32_perf_global_status_reset_register;
+#define IA32_PERF_GLOBAL_STATUS_RESET_RESERVED_BITS                  0x37FFFF800000000
 
+#define IA32_PERF_GLOBAL_STATUS_RESET_APPLY(_status, _)              ((_status) & ~(_))
 #define IA32_PERF_GLOBAL_STATUS_SET                                  0x00000391
+#define IA32_PERF_GLOBAL_STATUS_SET_SLOT                             386
 typedef union {
   struct {
     uint64_t ovf_pmcn                                                : 32;
@@ -3654,8 +4680,11 @@ typedef union {
 
   uint64_t Flags;
 } ia32_perf_global_status_set_register;
+#define IA32_PERF_GLOBAL_STATUS_SET_RESERVED_BITS                    0x837FFFF800000000
 
+#define IA32_PERF_GLOBAL_STATUS_SET_APPLY(_status, _)                ((_status) | (_))
 #define IA32_PERF_GLOBAL_INUSE                                       0x00000392
+#define IA32_PERF_GLOBAL_INUSE_SLOT                                  145
 typedef union {
   struct {
     uint64_t ia32_perfevtseln_in_use                                 : 32;
@@ -3669,8 +4698,10 @@ typedef union {
 
   uint64_t Flags;
 } ia32_perf_global_inuse_register;
+#define IA32_PERF_GLOBAL_INUSE_RESERVED_BITS                         0x7FFFFFF800000000
 
 #define IA32_PEBS_ENABLE                                             0x000003F1
+#define IA32_PEBS_ENABLE_SLOT                                        371
 typedef union {
   struct {
     uint64_t enable_pebs                                             : 1;
@@ -3685,6 +4716,7 @@ typedef union {
 
   uint64_t Flags;
 } ia32_pebs_enable_register;
+#define IA32_PEBS_ENABLE_RESERVED_BITS                               0xFFFFFFF0FFFFFFF0
 
 /**
  * @defgroup ia32_mc_ctl \
@@ -3692,34 +4724,63 @@ typedef union {
  * @{
  */
 #define IA32_MC0_CTL                                                 0x00000400
+#define IA32_MC0_CTL_SLOT                                            352
 #define IA32_MC1_CTL                                                 0x00000404
+#define IA32_MC1_CTL_SLOT                                            416
 #define IA32_MC2_CTL                                                 0x00000408
+#define IA32_MC2_CTL_SLOT                                            476
 #define IA32_MC3_CTL                                                 0x0000040C
+#define IA32_MC3_CTL_SLOT                                            28
 #define IA32_MC4_CTL                                                 0x00000410
+#define IA32_MC4_CTL_SLOT                                            92
 #define IA32_MC5_CTL                                                 0x00000414
+#define IA32_MC5_CTL_SLOT                                            157
 #define IA32_MC6_CTL                                                 0x00000418
+#define IA32_MC6_CTL_SLOT                                            220
 #define IA32_MC7_CTL                                                 0x0000041C
+#define IA32_MC7_CTL_SLOT                                            277
 #define IA32_MC8_CTL                                                 0x00000420
+#define IA32_MC8_CTL_SLOT                                            351
 #define IA32_MC9_CTL                                                 0x00000424
+#define IA32_MC9_CTL_SLOT                                            408
 #define IA32_MC10_CTL                                                0x00000428
+#define IA32_MC10_CTL_SLOT                                           475
 #define IA32_MC11_CTL                                                0x0000042C
+#define IA32_MC11_CTL_SLOT                                           25
 #define IA32_MC12_CTL                                                0x00000430
+#define IA32_MC12_CTL_SLOT                                           88
 #define IA32_MC13_CTL                                                0x00000434
+#define IA32_MC13_CTL_SLOT                                           152
 #define IA32_MC14_CTL                                                0x00000438
+#define IA32_MC14_CTL_SLOT                                           216
 #define IA32_MC15_CTL                                                0x0000043C
+#define IA32_MC15_CTL_SLOT                                           276
 #define IA32_MC16_CTL                                                0x00000440
+#define IA32_MC16_CTL_SLOT                                           341
 #define IA32_MC17_CTL                                                0x00000444
+#define IA32_MC17_CTL_SLOT                                           406
 #define IA32_MC18_CTL                                                0x00000448
+#define IA32_MC18_CTL_SLOT                                           469
 #define IA32_MC19_CTL                                                0x0000044C
+#define IA32_MC19_CTL_SLOT                                           23
 #define IA32_MC20_CTL                                                0x00000450
+#define IA32_MC20_CTL_SLOT                                           84
 #define IA32_MC21_CTL                                                0x00000454
+#define IA32_MC21_CTL_SLOT                                           151
 #define IA32_MC22_CTL                                                0x00000458
+#define IA32_MC22_CTL_SLOT                                           210
 #define IA32_MC23_CTL                                                0x0000045C
+#define IA32_MC23_CTL_SLOT                                           282
 #define IA32_MC24_CTL                                                0x00000460
+#define IA32_MC24_CTL_SLOT                                           347
 #define IA32_MC25_CTL                                                0x00000464
+#define IA32_MC25_CTL_SLOT                                           401
 #define IA32_MC26_CTL                                                0x00000468
+#define IA32_MC26_CTL_SLOT                                           464
 #define IA32_MC27_CTL                                                0x0000046C
+#define IA32_MC27_CTL_SLOT                                           1
 #define IA32_MC28_CTL                                                0x00000470
+#define IA32_MC28_CTL_SLOT                                           86
 /**
  * @}
  */
@@ -3730,34 +4791,63 @@ typedef union {
  * @{
  */
 #define IA32_MC0_STATUS                                              0x00000401
+#define IA32_MC0_STATUS_SLOT                                         112
 #define IA32_MC1_STATUS                                              0x00000405
+#define IA32_MC1_STATUS_SLOT                                         165
 #define IA32_MC2_STATUS                                              0x00000409
+#define IA32_MC2_STATUS_SLOT                                         234
 #define IA32_MC3_STATUS                                              0x0000040D
+#define IA32_MC3_STATUS_SLOT                                         303
 #define IA32_MC4_STATUS                                              0x00000411
+#define IA32_MC4_STATUS_SLOT                                         366
 #define IA32_MC5_STATUS                                              0x00000415
+#define IA32_MC5_STATUS_SLOT                                         428
 #define IA32_MC6_STATUS                                              0x00000419
+#define IA32_MC6_STATUS_SLOT                                         495
 #define IA32_MC7_STATUS                                              0x0000041D
+#define IA32_MC7_STATUS_SLOT                                         45
 #define IA32_MC8_STATUS                                              0x00000421
+#define IA32_MC8_STATUS_SLOT                                         108
 #define IA32_MC9_STATUS                                              0x00000425
+#define IA32_MC9_STATUS_SLOT                                         169
 #define IA32_MC10_STATUS                                             0x00000429
+#define IA32_MC10_STATUS_SLOT                                        235
 #define IA32_MC11_STATUS                                             0x0000042D
+#define IA32_MC11_STATUS_SLOT                                        289
 #define IA32_MC12_STATUS                                             0x00000431
+#define IA32_MC12_STATUS_SLOT                                        361
 #define IA32_MC13_STATUS                                             0x00000435
+#define IA32_MC13_STATUS_SLOT                                        424
 #define IA32_MC14_STATUS                                             0x00000439
+#define IA32_MC14_STATUS_SLOT                                        487
 #define IA32_MC15_STATUS                                             0x0000043D
+#define IA32_MC15_STATUS_SLOT                                        33
 #define IA32_MC16_STATUS                                             0x00000441
+#define IA32_MC16_STATUS_SLOT                                        99
 #define IA32_MC17_STATUS                                             0x00000445
+#define IA32_MC17_STATUS_SLOT                                        167
 #define IA32_MC18_STATUS                                             0x00000449
+#define IA32_MC18_STATUS_SLOT                                        228
 #define IA32_MC19_STATUS                                             0x0000044D
+#define IA32_MC19_STATUS_SLOT                                        292
 #define IA32_MC20_STATUS                                             0x00000451
+#define IA32_MC20_STATUS_SLOT                                        365
 #define IA32_MC21_STATUS                                             0x00000455
+#define IA32_MC21_STATUS_SLOT                                        418
 #define IA32_MC22_STATUS                                             0x00000459
+#define IA32_MC22_STATUS_SLOT                                        497
 #define IA32_MC23_STATUS                                             0x0000045D
+#define IA32_MC23_STATUS_SLOT                                        32
 #define IA32_MC24_STATUS                                             0x00000461
+#define IA32_MC24_STATUS_SLOT                                        97
 #define IA32_MC25_STATUS                                             0x00000465
+#define IA32_MC25_STATUS_SLOT                                        161
 #define IA32_MC26_STATUS                                             0x00000469
+#define IA32_MC26_STATUS_SLOT                                        226
 #define IA32_MC27_STATUS                                             0x0000046D
+#define IA32_MC27_STATUS_SLOT                                        287
 #define IA32_MC28_STATUS                                             0x00000471
+#define IA32_MC28_STATUS_SLOT                                        345
 /**
  * @}
  */
@@ -3768,34 +4858,63 @@ typedef union {
  * @{
  */
 #define IA32_MC0_ADDR                                                0x00000402
+#define IA32_MC0_ADDR_SLOT                                           387
 #define IA32_MC1_ADDR                                                0x00000406
+#define IA32_MC1_ADDR_SLOT                                           447
 #define IA32_MC2_ADDR                                                0x0000040A
+#define IA32_MC2_ADDR_SLOT                                           502
 #define IA32_MC3_ADDR                                                0x0000040E
+#define IA32_MC3_ADDR_SLOT                                           62
 #define IA32_MC4_ADDR                                                0x00000412
+#define IA32_MC4_ADDR_SLOT                                           125
 #define IA32_MC5_ADDR                                                0x00000416
+#define IA32_MC5_ADDR_SLOT                                           191
 #define IA32_MC6_ADDR                                                0x0000041A
+#define IA32_MC6_ADDR_SLOT                                           252
 #define IA32_MC7_ADDR                                                0x0000041E
+#define IA32_MC7_ADDR_SLOT                                           317
 #define IA32_MC8_ADDR                                                0x00000422
+#define IA32_MC8_ADDR_SLOT                                           379
 #define IA32_MC9_ADDR                                                0x00000426
+#define IA32_MC9_ADDR_SLOT                                           433
 #define IA32_MC10_ADDR                                               0x0000042A
+#define IA32_MC10_ADDR_SLOT                                          511
 #define IA32_MC11_ADDR                                               0x0000042E
+#define IA32_MC11_ADDR_SLOT                                          57
 #define IA32_MC12_ADDR                                               0x00000432
+#define IA32_MC12_ADDR_SLOT                                          121
 #define IA32_MC13_ADDR                                               0x00000436
+#define IA32_MC13_ADDR_SLOT                                          185
 #define IA32_MC14_ADDR                                               0x0000043A
+#define IA32_MC14_ADDR_SLOT                                          247
 #define IA32_MC15_ADDR                                               0x0000043E
+#define IA32_MC15_ADDR_SLOT                                          304
 #define IA32_MC16_ADDR                                               0x00000442
+#define IA32_MC16_ADDR_SLOT                                          373
 #define IA32_MC17_ADDR                                               0x00000446
+#define IA32_MC17_ADDR_SLOT                                          436
 #define IA32_MC18_ADDR                                               0x0000044A
+#define IA32_MC18_ADDR_SLOT                                          501
 #define IA32_MC19_ADDR                                               0x0000044E
+#define IA32_MC19_ADDR_SLOT                                          53
 #define IA32_MC20_ADDR                                               0x00000452
+#define IA32_MC20_ADDR_SLOT                                          98
 #define IA32_MC21_ADDR                                               0x00000456
+#define IA32_MC21_ADDR_SLOT                                          178
 #define IA32_MC22_ADDR                                               0x0000045A
+#define IA32_MC22_ADDR_SLOT                                          243
 #define IA32_MC23_ADDR                                               0x0000045E
+#define IA32_MC23_ADDR_SLOT                                          306
 #define IA32_MC24_ADDR                                               0x00000462
+#define IA32_MC24_ADDR_SLOT                                          368
 #define IA32_MC25_ADDR                                               0x00000466
+#define IA32_MC25_ADDR_SLOT                                          432
 #define IA32_MC26_ADDR                                               0x0000046A
+#define IA32_MC26_ADDR_SLOT                                          507
 #define IA32_MC27_ADDR                                               0x0000046E
+#define IA32_MC27_ADDR_SLOT                                          44
 #define IA32_MC28_ADDR                                               0x00000472
+#define IA32_MC28_ADDR_SLOT                                          127
 /**
  * @}
  */
@@ -3806,39 +4925,69 @@ typedef union {
  * @{
  */
 #define IA32_MC0_MISC                                                0x00000403
+#define IA32_MC0_MISC_SLOT                                           144
 #define IA32_MC1_MISC                                                0x00000407
+#define IA32_MC1_MISC_SLOT                                           199
 #define IA32_MC2_MISC                                                0x0000040B
+#define IA32_MC2_MISC_SLOT                                           269
 #define IA32_MC3_MISC                                                0x0000040F
+#define IA32_MC3_MISC_SLOT                                           334
 #define IA32_MC4_MISC                                                0x00000413
+#define IA32_MC4_MISC_SLOT                                           397
 #define IA32_MC5_MISC                                                0x00000417
+#define IA32_MC5_MISC_SLOT                                           461
 #define IA32_MC6_MISC                                                0x0000041B
+#define IA32_MC6_MISC_SLOT                                           12
 #define IA32_MC7_MISC                                                0x0000041F
+#define IA32_MC7_MISC_SLOT                                           72
 #define IA32_MC8_MISC                                                0x00000423
+#define IA32_MC8_MISC_SLOT                                           138
 #define IA32_MC9_MISC                                                0x00000427
+#define IA32_MC9_MISC_SLOT                                           202
 #define IA32_MC10_MISC                                               0x0000042B
+#define IA32_MC10_MISC_SLOT                                          265
 #define IA32_MC11_MISC                                               0x0000042F
+#define IA32_MC11_MISC_SLOT                                          329
 #define IA32_MC12_MISC                                               0x00000433
+#define IA32_MC12_MISC_SLOT                                          392
 #define IA32_MC13_MISC                                               0x00000437
+#define IA32_MC13_MISC_SLOT                                          456
 #define IA32_MC14_MISC                                               0x0000043B
+#define IA32_MC14_MISC_SLOT                                          5
 #define IA32_MC15_MISC                                               0x0000043F
+#define IA32_MC15_MISC_SLOT                                          69
 #define IA32_MC16_MISC                                               0x00000443
+#define IA32_MC16_MISC_SLOT                                          134
 #define IA32_MC17_MISC                                               0x00000447
+#define IA32_MC17_MISC_SLOT                                          196
 #define IA32_MC18_MISC                                               0x0000044B
+#define IA32_MC18_MISC_SLOT                                          261
 #define IA32_MC19_MISC                                               0x0000044F
+#define IA32_MC19_MISC_SLOT                                          327
 #define IA32_MC20_MISC                                               0x00000453
+#define IA32_MC20_MISC_SLOT                                          384
 #define IA32_MC21_MISC                                               0x00000457
+#define IA32_MC21_MISC_SLOT                                          451
 #define IA32_MC22_MISC                                               0x0000045B
+#define IA32_MC22_MISC_SLOT                                          2
 #define IA32_MC23_MISC                                               0x0000045F
+#define IA32_MC23_MISC_SLOT                                          73
 #define IA32_MC24_MISC                                               0x00000463
+#define IA32_MC24_MISC_SLOT                                          129
 #define IA32_MC25_MISC                                               0x00000467
+#define IA32_MC25_MISC_SLOT                                          193
 #define IA32_MC26_MISC                                               0x0000046B
+#define IA32_MC26_MISC_SLOT                                          260
 #define IA32_MC27_MISC                                               0x0000046F
+#define IA32_MC27_MISC_SLOT                                          314
 #define IA32_MC28_MISC                                               0x00000473
+#define IA32_MC28_MISC_SLOT                                          382
 /**
  * @}
  */
 
 #define IA32_VMX_BASIC                                               0x00000480
+#define IA32_VMX_BASIC_SLOT                                          335
 typedef union {
   struct {
     uint64_t vmcs_revision_id                                        : 31;
@@ -3863,8 +5012,10 @@ typedef union {
 
   uint64_t Flags;
 } ia32_vmx_basic_register;
+#define IA32_VMX_BASIC_RESERVED_BITS                                 0xFF00E00080000000
 
 #define IA32_VMX_PINBASED_CTLS                                       0x00000481
+#define IA32_VMX_PINBASED_CTLS_SLOT                                  91
 typedef union {
   struct {
     uint64_t external_interrupt_exiting                              : 1;
@@ -3884,8 +5035,10 @@ typedef union {
 
   uint64_t Flags;
 } ia32_vmx_pinbased_ctls_register;
+#define IA32_VMX_PINBASED_CTLS_RESERVED_BITS                         0xFFFFFFFFFFFFFF16
 
 #define IA32_VMX_PROCBASED_CTLS                                      0x00000482
+#define IA32_VMX_PROCBASED_CTLS_SLOT                                 364
 typedef union {
   struct {
     uint64_t reserved_1                                              : 2;
@@ -3943,8 +5096,10 @@ typedef union {
 
   uint64_t Flags;
 } ia32_vmx_procbased_ctls_register;
+#define IA32_VMX_PROCBASED_CTLS_RESERVED_BITS                        0xFFFFFFFF04046173
 
 #define IA32_VMX_EXIT_CTLS                                           0x00000483
+#define IA32_VMX_EXIT_CTLS_SLOT                                      124
 typedef union {
   struct {
     uint64_t reserved_1                                              : 2;
@@ -3993,8 +5148,10 @@ typedef union {
 
   uint64_t Flags;
 } ia32_vmx_exit_ctls_register;
+#define IA32_VMX_EXIT_CTLS_RESERVED_BITS                             0xFFFFFFFF00036DFB
 
 #define IA32_VMX_ENTRY_CTLS                                          0x00000484
+#define IA32_VMX_ENTRY_CTLS_SLOT                                     399
 typedef union {
   struct {
     uint64_t reserved_1                                              : 2;
@@ -4033,8 +5190,10 @@ typedef union {
 
   uint64_t Flags;
 } ia32_vmx_entry_ctls_register;
+#define IA32_VMX_ENTRY_CTLS_RESERVED_BITS                            0xFFFFFFFFFF8011FB
 
 #define IA32_VMX_MISC                                                0x00000485
+#define IA32_VMX_MISC_SLOT                                           156
 typedef union {
   struct {
     uint64_t preemption_timer_tsc_relationship                       : 5;
@@ -4065,12 +5224,18 @@ typedef union {
 
   uint64_t Flags;
 } ia32_vmx_misc_register;
+#define IA32_VMX_MISC_RESERVED_BITS                                  0x80003E00
 
 #define IA32_VMX_CR0_FIXED0                                          0x00000486
+#define IA32_VMX_CR0_FIXED0_SLOT                                     427
 #define IA32_VMX_CR0_FIXED1                                          0x00000487
+#define IA32_VMX_CR0_FIXED1_SLOT                                     177
 #define IA32_VMX_CR4_FIXED0                                          0x00000488
+#define IA32_VMX_CR4_FIXED0_SLOT                                     459
 #define IA32_VMX_CR4_FIXED1                                          0x00000489
+#define IA32_VMX_CR4_FIXED1_SLOT                                     211
 #define IA32_VMX_VMCS_ENUM                                           0x0000048A
+#define IA32_VMX_VMCS_ENUM_SLOT                                      488
 typedef union {
   struct {
     uint64_t access_type                                             : 1;
@@ -4087,8 +5252,10 @@ typedef union {
 
   uint64_t Flags;
 } ia32_vmx_vmcs_enum_register;
+#define IA32_VMX_VMCS_ENUM_RESERVED_BITS                             0xFFFFFFFFFFFF9000
 
 #define IA32_VMX_PROCBASED_CTLS2                                     0x0000048B
+#define IA32_VMX_PROCBASED_CTLS2_SLOT                                254
 typedef union {
   struct {
     uint64_t virtualize_apic_accesses                                : 1;
@@ -4159,8 +5326,10 @@ typedef union {
 
   uint64_t Flags;
 } ia32_vmx_procbased_ctls2_register;
+#define IA32_VMX_PROCBASED_CTLS2_RESERVED_BITS                       0xFFFFFFFF20000000
 
 #define IA32_VMX_EPT_VPID_CAP                                        0x0000048C
+#define IA32_VMX_EPT_VPID_CAP_SLOT                                   3
 typedef union {
   struct {
     uint64_t execute_only_pages                                      : 1;
@@ -4213,6 +5382,7 @@ typedef union {
 
   uint64_t Flags;
 } ia32_vmx_ept_vpid_cap_register;
+#define IA32_VMX_EPT_VPID_CAP_RESERVED_BITS                          0xFFC0F0FEF90CBEBE
 
 /**
  * @defgroup ia32_vmx_true_ctls \
@@ -4220,9 +5390,20 @@ typedef union {
  * @{
  */
 #define IA32_VMX_TRUE_PINBASED_CTLS                                  0x0000048D
+#define IA32_VMX_TRUE_PINBASED_CTLS_SLOT                             280
 #define IA32_VMX_TRUE_PROCBASED_CTLS                                 0x0000048E
+#define IA32_VMX_TRUE_PROCBASED_CTLS_SLOT                            40
 #define IA32_VMX_TRUE_EXIT_CTLS                                      0x0000048F
+#define IA32_VMX_TRUE_EXIT_CTLS_SLOT                                 315
 #define IA32_VMX_TRUE_ENTRY_CTLS                                     0x00000490
+#define IA32_VMX_TRUE_ENTRY_CTLS_SLOT                                74
+#define IA32_VMX_TRUE_CTLS_OFFSET                                    0x0000000C
+#define IA32_VMX_CTLS_SELECT(_, _msr)                                ((_msr) + (((_) >> 55) & 0x01) * IA32_VMX_TRUE_CTLS_OFFSET)
+#define IA32_VMX_ADJUST_CTLS(_, _desired)                            (((_desired) | (_)) & ((_) >> 32))
+#define IA32_VMX_PINBASED_CTLS_DEFAULT1                              0x00000016
+#define IA32_VMX_PROCBASED_CTLS_DEFAULT1                             0x0401E172
+#define IA32_VMX_EXIT_CTLS_DEFAULT1                                  0x00036DFF
+#define IA32_VMX_ENTRY_CTLS_DEFAULT1                                 0x000011FF
 typedef union {
   struct {
     uint64_t allowed_0_settings                                      : 32;
@@ -4233,12 +5414,14 @@ typedef union {
 
   uint64_t Flags;
 } ia32_vmx_true_ctls_register;
+#define IA32_VMX_TRUE_CTLS_RESERVED_BITS                             0x00
 
 /**
  * @}
  */
 
 #define IA32_VMX_VMFUNC                                              0x00000491
+#define IA32_VMX_VMFUNC_SLOT                                         346
 typedef union {
   struct {
     uint64_t eptp_switching                                          : 1;
@@ -4248,8 +5431,10 @@ typedef union {
 
   uint64_t Flags;
 } ia32_vmx_vmfunc_register;
+#define IA32_VMX_VMFUNC_RESERVED_BITS                                0xFFFFFFFFFFFFFFFE
 
 #define IA32_VMX_PROCBASED_CTLS3                                     0x00000492
+#define IA32_VMX_PROCBASED_CTLS3_SLOT                                104
 typedef union {
   struct {
     uint64_t loadiwkey_exiting                                       : 1;
@@ -4272,8 +5457,10 @@ typedef union {
 
   uint64_t Flags;
 } ia32_vmx_procbased_ctls3_register;
+#define IA32_VMX_PROCBASED_CTLS3_RESERVED_BITS                       0xFFFFFFFFFFFFFF20
 
 #define IA32_VMX_EXIT_CTLS2                                          0x00000493
+#define IA32_VMX_EXIT_CTLS2_SLOT                                     377
 typedef union {
   struct {
     uint64_t reserved_1                                              : 3;
@@ -4284,6 +5471,7 @@ typedef union {
 
   uint64_t Flags;
 } ia32_vmx_exit_ctls2_register;
+#define IA32_VMX_EXIT_CTLS2_RESERVED_BITS                            0xFFFFFFFFFFFFFFF7
 
 /**
  * @defgroup ia32_a_pmc \
@@ -4291,18 +5479,39 @@ typedef union {
  * @{
  */
 #define IA32_A_PMC0                                                  0x000004C1
+#define IA32_A_PMC0_SLOT                                             81
 #define IA32_A_PMC1                                                  0x000004C2
+#define IA32_A_PMC1_SLOT                                             353
 #define IA32_A_PMC2                                                  0x000004C3
+#define IA32_A_PMC2_SLOT                                             119
 #define IA32_A_PMC3                                                  0x000004C4
+#define IA32_A_PMC3_SLOT                                             385
 #define IA32_A_PMC4                                                  0x000004C5
+#define IA32_A_PMC4_SLOT                                             146
 #define IA32_A_PMC5                                                  0x000004C6
+#define IA32_A_PMC5_SLOT                                             417
 #define IA32_A_PMC6                                                  0x000004C7
+#define IA32_A_PMC6_SLOT                                             176
 #define IA32_A_PMC7                                                  0x000004C8
+#define IA32_A_PMC7_SLOT                                             448
+/**
+ * @defgroup ia32_a_pmc_encoding \
+ *           Full-width performance counter alias helpers
+ * @{
+ */
+#define IA32_A_PMC_MSR(_)                                            (0x4C1 + (_))
+#define IA32_A_PMC_INDEX(_msr)                                       ((_msr) - 0x4C1)
+#define IA32_A_PMC_IN_RANGE(_msr, _count)                            (((_msr) >= 0x4C1) & ((_msr) < 0x4C1 + (_count)))
+/**
+ * @}
+ */
+
 /**
  * @}
  */
 
 #define IA32_MCG_EXT_CTL                                             0x000004D0
+#define IA32_MCG_EXT_CTL_SLOT                                        65
 typedef union {
   struct {
     uint64_t lmce_en                                                 : 1;
@@ -4312,8 +5521,10 @@ typedef union {
 
   uint64_t Flags;
 } ia32_mcg_ext_ctl_register;
+#define IA32_MCG_EXT_CTL_RESERVED_BITS                               0xFFFFFFFFFFFFFFFE
 
 #define IA32_SGX_SVN_STATUS                                          0x00000500
+#define IA32_SGX_SVN_STATUS_SLOT                                     312
 typedef union {
   struct {
     uint64_t lock                                                    : 1;
@@ -4326,8 +5537,10 @@ typedef union {
 
   uint64_t Flags;
 } ia32_sgx_svn_status_register;
+#define IA32_SGX_SVN_STATUS_RESERVED_BITS                            0xFFFFFFFFFF00FFFE
 
 #define IA32_RTIT_OUTPUT_BASE                                        0x00000560
+#define IA32_RTIT_OUTPUT_BASE_SLOT                                   298
 typedef union {
   struct {
     uint64_t reserved_1                                              : 7;
@@ -4338,8 +5551,11 @@ typedef union {
 
   uint64_t Flags;
 } ia32_rtit_output_base_register;
+#define IA32_RTIT_OUTPUT_BASE_RESERVED_BITS                          0xFFF000000000007F
+#define IA32_RTIT_OUTPUT_BASE_ADDRESS_BITS                           0xFFFFFFFFFFF80
 
 #define IA32_RTIT_OUTPUT_MASK_PTRS                                   0x00000561
+#define IA32_RTIT_OUTPUT_MASK_PTRS_SLOT                              49
 typedef union {
   struct {
     uint64_t lower_mask                                              : 7;
@@ -4352,8 +5568,10 @@ typedef union {
 
   uint64_t Flags;
 } ia32_rtit_output_mask_ptrs_register;
+#define IA32_RTIT_OUTPUT_MASK_PTRS_RESERVED_BITS                     0x00
 
 #define IA32_RTIT_CTL                                                0x00000570
+#define IA32_RTIT_CTL_SLOT                                           41
 typedef union {
   struct {
     uint64_t trace_en                                                : 1;
@@ -4392,7 +5610,9 @@ typedef union {
     uint64_t reserved_2                                              : 1;
     uint64_t psb_freq                                                : 4;
 #define IA32_RTIT_CTL_PSB_FREQ                                       0xF000000
-    uint64_t reserved_3                                              : 4;
+    uint64_t reserved_3                                              : 3;
+    uint64_t event_en                                                : 1;
+#define IA32_RTIT_CTL_EVENT_EN                                       0x80000000
     uint64_t addr0_cfg                                               : 4;
 #define IA32_RTIT_CTL_ADDR0_CFG                                      0xF00000000
     uint64_t addr1_cfg                                               : 4;
@@ -4401,7 +5621,9 @@ typedef union {
 #define IA32_RTIT_CTL_ADDR2_CFG                                      0xF0000000000
     uint64_t addr3_cfg                                               : 4;
 #define IA32_RTIT_CTL_ADDR3_CFG                                      0xF00000000000
-    uint64_t reserved_4                                              : 8;
+    uint64_t reserved_4                                              : 7;
+    uint64_t dis_tnt                                                 : 1;
+#define IA32_RTIT_CTL_DIS_TNT                                        0x80000000000000
     uint64_t inject_psb_pmi_on_enable                                : 1;
 #define IA32_RTIT_CTL_INJECT_PSB_PMI_ON_ENABLE                       0x100000000000000
     uint64_t reserved_5                                              : 7;
@@ -4409,8 +5631,11 @@ typedef union {
 
   uint64_t Flags;
 } ia32_rtit_ctl_register;
+#define IA32_RTIT_CTL_RESERVED_BITS                                  0xFE7F000070840000
 
+#define IA32_RTIT_CTL_SUPPORTED(_cpuid_ebx, _cpuid_ecx)              (0x2C0DULL | (((_cpuid_ebx) & 0x01) * 0x80ULL) | ((((_cpuid_ebx) >> 1) & 0x01) * 0xF780002ULL) | ((((_cpuid_ebx) >> 2) & 0x01) * 0xFFFF00000000ULL) | ((((_cpuid_ebx) >> 3) & 0x01) * 0x3C200ULL) | ((((_cpuid_ebx) >> 4) & 0x01) * 0x1020ULL) | ((((_cpuid_ebx) >> 5) & 0x01) * 0x10ULL) | ((((_cpuid_ebx) >> 6) & 0x01) * 0x100000000000000ULL) | ((((_cpuid_ebx) >> 7) & 0x01) * 0x80000000ULL) | ((((_cpuid_ebx) >> 8) & 0x01) * 0x80000000000000ULL) | (((_cpuid_ecx) & 0x01) * 0x100ULL) | ((((_cpuid_ecx) >> 3) & 0x01) * 0x40ULL))
 #define IA32_RTIT_STATUS                                             0x00000571
+#define IA32_RTIT_STATUS_SLOT                                        311
 typedef union {
   struct {
     uint64_t filter_en                                               : 1;
@@ -4436,8 +5661,10 @@ typedef union {
 
   uint64_t Flags;
 } ia32_rtit_status_register;
+#define IA32_RTIT_STATUS_RESERVED_BITS                               0xFFFE0000FFFFFF08
 
 #define IA32_RTIT_CR3_MATCH                                          0x00000572
+#define IA32_RTIT_CR3_MATCH_SLOT                                     68
 typedef union {
   struct {
     uint64_t reserved_1                                              : 5;
@@ -4447,6 +5674,7 @@ typedef union {
 
   uint64_t Flags;
 } ia32_rtit_cr3_match_register;
+#define IA32_RTIT_CR3_MATCH_RESERVED_BITS                            0x1F
 
 /**
  * @defgroup ia32_rtit_addr \
@@ -4459,9 +5687,13 @@ typedef union {
  * @{
  */
 #define IA32_RTIT_ADDR0_A                                            0x00000580
+#define IA32_RTIT_ADDR0_A_SLOT                                       291
 #define IA32_RTIT_ADDR1_A                                            0x00000582
+#define IA32_RTIT_ADDR1_A_SLOT                                       324
 #define IA32_RTIT_ADDR2_A                                            0x00000584
+#define IA32_RTIT_ADDR2_A_SLOT                                       359
 #define IA32_RTIT_ADDR3_A                                            0x00000586
+#define IA32_RTIT_ADDR3_A_SLOT                                       388
 /**
  * @}
  */
@@ -4472,9 +5704,13 @@ typedef union {
  * @{
  */
 #define IA32_RTIT_ADDR0_B                                            0x00000581
+#define IA32_RTIT_ADDR0_B_SLOT                                       54
 #define IA32_RTIT_ADDR1_B                                            0x00000583
+#define IA32_RTIT_ADDR1_B_SLOT                                       87
 #define IA32_RTIT_ADDR2_B                                            0x00000585
+#define IA32_RTIT_ADDR2_B_SLOT                                       115
 #define IA32_RTIT_ADDR3_B                                            0x00000587
+#define IA32_RTIT_ADDR3_B_SLOT                                       147
 /**
  * @}
  */
@@ -4489,13 +5725,16 @@ typedef union {
 
   uint64_t Flags;
 } ia32_rtit_addr_register;
+#define IA32_RTIT_ADDR_RESERVED_BITS                                 0x00
 
 /**
  * @}
  */
 
 #define IA32_DS_AREA                                                 0x00000600
+#define IA32_DS_AREA_SLOT                                            273
 #define IA32_U_CET                                                   0x000006A0
+#define IA32_U_CET_SLOT                                              249
 typedef union {
   struct {
     uint64_t sh_stk_en                                               : 1;
@@ -4521,8 +5760,10 @@ typedef union {
 
   uint64_t Flags;
 } ia32_u_cet_register;
+#define IA32_U_CET_RESERVED_BITS                                     0x3C0
 
 #define IA32_S_CET                                                   0x000006A2
+#define IA32_S_CET_SLOT                                              279
 typedef union {
   struct {
     uint64_t sh_stk_en                                               : 1;
@@ -4548,14 +5789,22 @@ typedef union {
 
   uint64_t Flags;
 } ia32_s_cet_register;
+#define IA32_S_CET_RESERVED_BITS                                     0x3C0
 
 #define IA32_PL0_SSP                                                 0x000006A4
+#define IA32_PL0_SSP_SLOT                                            308
 #define IA32_PL1_SSP                                                 0x000006A5
+#define IA32_PL1_SSP_SLOT                                            71
 #define IA32_PL2_SSP                                                 0x000006A6
+#define IA32_PL2_SSP_SLOT                                            343
 #define IA32_PL3_SSP                                                 0x000006A7
+#define IA32_PL3_SSP_SLOT                                            110
 #define IA32_INTERRUPT_SSP_TABLE_ADDR                                0x000006A8
+#define IA32_INTERRUPT_SSP_TABLE_ADDR_SLOT                           375
 #define IA32_TSC_DEADLINE                                            0x000006E0
+#define IA32_TSC_DEADLINE_SLOT                                       239
 #define IA32_PM_ENABLE                                               0x00000770
+#define IA32_PM_ENABLE_SLOT                                          470
 typedef union {
   struct {
     uint64_t hwp_enable                                              : 1;
@@ -4565,8 +5814,10 @@ typedef union {
 
   uint64_t Flags;
 } ia32_pm_enable_register;
+#define IA32_PM_ENABLE_RESERVED_BITS                                 0xFFFFFFFFFFFFFFFE
 
 #define IA32_HWP_CAPABILITIES                                        0x00000771
+#define IA32_HWP_CAPABILITIES_SLOT                                   231
 typedef union {
   struct {
     uint64_t highest_performance                                     : 8;
@@ -4582,8 +5833,10 @@ typedef union {
 
   uint64_t Flags;
 } ia32_hwp_capabilities_register;
+#define IA32_HWP_CAPABILITIES_RESERVED_BITS                          0xFFFFFFFF00000000
 
 #define IA32_HWP_REQUEST_PKG                                         0x00000772
+#define IA32_HWP_REQUEST_PKG_SLOT                                    503
 typedef union {
   struct {
     uint64_t minimum_performance                                     : 8;
@@ -4601,8 +5854,10 @@ typedef union {
 
   uint64_t Flags;
 } ia32_hwp_request_pkg_register;
+#define IA32_HWP_REQUEST_PKG_RESERVED_BITS                           0xFFFFFC0000000000
 
 #define IA32_HWP_INTERRUPT                                           0x00000773
+#define IA32_HWP_INTERRUPT_SLOT                                      263
 typedef union {
   struct {
     uint64_t en_guaranteed_performance_change                        : 1;
@@ -4614,8 +5869,10 @@ typedef union {
 
   uint64_t Flags;
 } ia32_hwp_interrupt_register;
+#define IA32_HWP_INTERRUPT_RESERVED_BITS                             0xFFFFFFFFFFFFFFFC
 
 #define IA32_HWP_REQUEST                                             0x00000774
+#define IA32_HWP_REQUEST_SLOT                                        22
 typedef union {
   struct {
     uint64_t minimum_performance                                     : 8;
@@ -4635,8 +5892,10 @@ typedef union {
 
   uint64_t Flags;
 } ia32_hwp_request_register;
+#define IA32_HWP_REQUEST_RESERVED_BITS                               0xFFFFF80000000000
 
 #define IA32_HWP_STATUS                                              0x00000777
+#define IA32_HWP_STATUS_SLOT                                         333
 typedef union {
   struct {
     uint64_t guaranteed_performance_change                           : 1;
@@ -4649,27 +5908,60 @@ typedef union {
 
   uint64_t Flags;
 } ia32_hwp_status_register;
+#define IA32_HWP_STATUS_RESERVED_BITS                                0xFFFFFFFFFFFFFFFA
 
 #define IA32_X2APIC_APICID                                           0x00000802
+#define IA32_X2APIC_APICID_SLOT                                      225
 #define IA32_X2APIC_VERSION                                          0x00000803
+#define IA32_X2APIC_VERSION_SLOT                                     504
 #define IA32_X2APIC_TPR                                              0x00000808
+#define IA32_X2APIC_TPR_SLOT                                         320
 #define IA32_X2APIC_PPR                                              0x0000080A
+#define IA32_X2APIC_PPR_SLOT                                         349
 #define IA32_X2APIC_EOI                                              0x0000080B
+#define IA32_X2APIC_EOI_SLOT                                         105
 #define IA32_X2APIC_LDR                                              0x0000080D
+#define IA32_X2APIC_LDR_SLOT                                         143
+typedef union {
+  struct {
+    uint64_t logical_id                                              : 16;
+#define IA32_X2APIC_LDR_LOGICAL_ID                                   0xFFFF
+#define IA32_X2APIC_LDR_LOGICAL_ID_FROM_APIC_ID(_)                   (1U << ((_) & 0x0F))
+    uint64_t cluster_id                                              : 16;
+#define IA32_X2APIC_LDR_CLUSTER_ID                                   0xFFFF0000
+#define IA32_X2APIC_LDR_CLUSTER_ID_FROM_APIC_ID(_)                   ((_) >> 4)
+#define IA32_X2APIC_LDR_CLUSTER_ID_SIZE                              0x00000010
+    uint64_t reserved_1                                              : 32;
+  };
+
+  uint64_t Flags;
+} ia32_x2apic_ldr_register;
+#define IA32_X2APIC_LDR_RESERVED_BITS                                0xFFFFFFFF00000000
+
+#define IA32_X2APIC_LDR_FROM_APIC_ID(_)                              (((((_) >> 4) & 0xFFFFU) << 16) | (1U << ((_) & 0x0F)))
 #define IA32_X2APIC_SIVR                                             0x0000080F
+#define IA32_X2APIC_SIVR_SLOT                                        172
 /**
  * @defgroup ia32_x2apic_isr \
  *           IA32_X2APIC_ISR(n)
  * @{
  */
 #define IA32_X2APIC_ISR0                                             0x00000810
+#define IA32_X2APIC_ISR0_SLOT                                        440
 #define IA32_X2APIC_ISR1                                             0x00000811
+#define IA32_X2APIC_ISR1_SLOT                                        206
 #define IA32_X2APIC_ISR2                                             0x00000812
+#define IA32_X2APIC_ISR2_SLOT                                        478
 #define IA32_X2APIC_ISR3                                             0x00000813
+#define IA32_X2APIC_ISR3_SLOT                                        237
 #define IA32_X2APIC_ISR4                                             0x00000814
+#define IA32_X2APIC_ISR4_SLOT                                        510
 #define IA32_X2APIC_ISR5                                             0x00000815
+#define IA32_X2APIC_ISR5_SLOT                                        270
 #define IA32_X2APIC_ISR6                                             0x00000816
+#define IA32_X2APIC_ISR6_SLOT                                        30
 #define IA32_X2APIC_ISR7                                             0x00000817
+#define IA32_X2APIC_ISR7_SLOT                                        295
 /**
  * @}
  */
@@ -4680,13 +5972,21 @@ typedef union {
  * @{
  */
 #define IA32_X2APIC_TMR0                                             0x00000818
+#define IA32_X2APIC_TMR0_SLOT                                        61
 #define IA32_X2APIC_TMR1                                             0x00000819
+#define IA32_X2APIC_TMR1_SLOT                                        325
 #define IA32_X2APIC_TMR2                                             0x0000081A
+#define IA32_X2APIC_TMR2_SLOT                                        94
 #define IA32_X2APIC_TMR3                                             0x0000081B
+#define IA32_X2APIC_TMR3_SLOT                                        360
 #define IA32_X2APIC_TMR4                                             0x0000081C
+#define IA32_X2APIC_TMR4_SLOT                                        116
 #define IA32_X2APIC_TMR5                                             0x0000081D
+#define IA32_X2APIC_TMR5_SLOT                                        398
 #define IA32_X2APIC_TMR6                                             0x0000081E
+#define IA32_X2APIC_TMR6_SLOT                                        158
 #define IA32_X2APIC_TMR7                                             0x0000081F
+#define IA32_X2APIC_TMR7_SLOT                                        429
 /**
  * @}
  */
@@ -4697,31 +5997,92 @@ typedef union {
  * @{
  */
 #define IA32_X2APIC_IRR0                                             0x00000820
+#define IA32_X2APIC_IRR0_SLOT                                        188
 #define IA32_X2APIC_IRR1                                             0x00000821
+#define IA32_X2APIC_IRR1_SLOT                                        460
 #define IA32_X2APIC_IRR2                                             0x00000822
+#define IA32_X2APIC_IRR2_SLOT                                        222
 #define IA32_X2APIC_IRR3                                             0x00000823
+#define IA32_X2APIC_IRR3_SLOT                                        492
 #define IA32_X2APIC_IRR4                                             0x00000824
+#define IA32_X2APIC_IRR4_SLOT                                        251
 #define IA32_X2APIC_IRR5                                             0x00000825
+#define IA32_X2APIC_IRR5_SLOT                                        11
 #define IA32_X2APIC_IRR6                                             0x00000826
+#define IA32_X2APIC_IRR6_SLOT                                        283
 #define IA32_X2APIC_IRR7                                             0x00000827
+#define IA32_X2APIC_IRR7_SLOT                                        42
 /**
  * @}
  */
 
 #define IA32_X2APIC_ESR                                              0x00000828
+#define IA32_X2APIC_ESR_SLOT                                         313
 #define IA32_X2APIC_LVT_CMCI                                         0x0000082F
+#define IA32_X2APIC_LVT_CMCI_SLOT                                    171
 #define IA32_X2APIC_ICR                                              0x00000830
+#define IA32_X2APIC_ICR_SLOT                                         443
+typedef union {
+  struct {
+    uint64_t vector                                                  : 8;
+#define IA32_X2APIC_ICR_VECTOR                                       0xFF
+    uint64_t delivery_mode                                           : 3;
+#define IA32_X2APIC_ICR_DELIVERY_MODE                                0x700
+#define IA32_X2APIC_ICR_DELIVERY_MODE_FIXED                          0x00000000
+#define IA32_X2APIC_ICR_DELIVERY_MODE_LOWEST_PRIORITY                0x00000001
+#define IA32_X2APIC_ICR_DELIVERY_MODE_SMI                            0x00000002
+#define IA32_X2APIC_ICR_DELIVERY_MODE_NMI                            0x00000004
+#define IA32_X2APIC_ICR_DELIVERY_MODE_INIT                           0x00000005
+#define IA32_X2APIC_ICR_DELIVERY_MODE_STARTUP                        0x00000006
+    uint64_t destination_mode                                        : 1;
+#define IA32_X2APIC_ICR_DESTINATION_MODE                             0x800
+#define IA32_X2APIC_ICR_DESTINATION_MODE_PHYSICAL                    0x00000000
+#define IA32_X2APIC_ICR_DESTINATION_MODE_LOGICAL                     0x00000001
+    uint64_t reserved_1                                              : 2;
+    uint64_t level                                                   : 1;
+#define IA32_X2APIC_ICR_LEVEL                                        0x4000
+    uint64_t trigger_mode                                            : 1;
+#define IA32_X2APIC_ICR_TRIGGER_MODE                                 0x8000
+    uint64_t reserved_2                                              : 2;
+    uint64_t destination_shorthand                                   : 2;
+#define IA32_X2APIC_ICR_DESTINATION_SHORTHAND                        0xC0000
+#define IA32_X2APIC_ICR_DESTINATION_SHORTHAND_NONE                   0x00000000
+#define IA32_X2APIC_ICR_DESTINATION_SHORTHAND_SELF                   0x00000001
+#define IA32_X2APIC_ICR_DESTINATION_SHORTHAND_ALL_INCLUDING_SELF     0x00000002
+#define IA32_X2APIC_ICR_DESTINATION_SHORTHAND_ALL_EXCLUDING_SELF     0x00000003
+    uint64_t reserved_3                                              : 12;
+    uint64_t destination                                             : 32;
+#define IA32_X2APIC_ICR_DESTINATION                                  0xFFFFFFFF00000000
+#define IA32_X2APIC_ICR_DESTINATION_LOGICAL(_cluster, _logical_ids)  (((_cluster) << 16) | (_logical_ids))
+  };
+
+  uint64_t Flags;
+} ia32_x2apic_icr_register;
+#define IA32_X2APIC_ICR_RESERVED_BITS                                0xFFF33000
+
+#define IA32_X2APIC_ICR_VALUE(_destination, _vector, _delivery_mode, _destination_mode) (((_destination) * 0x100000000ULL) | ((_delivery_mode) << 8) | ((_destination_mode) << 11) | 0x4000 | (_vector))
 #define IA32_X2APIC_LVT_TIMER                                        0x00000832
+#define IA32_X2APIC_LVT_TIMER_SLOT                                   477
 #define IA32_X2APIC_LVT_THERMAL                                      0x00000833
+#define IA32_X2APIC_LVT_THERMAL_SLOT                                 238
 #define IA32_X2APIC_LVT_PMI                                          0x00000834
+#define IA32_X2APIC_LVT_PMI_SLOT                                     505
 #define IA32_X2APIC_LVT_LINT0                                        0x00000835
+#define IA32_X2APIC_LVT_LINT0_SLOT                                   264
 #define IA32_X2APIC_LVT_LINT1                                        0x00000836
+#define IA32_X2APIC_LVT_LINT1_SLOT                                   26
 #define IA32_X2APIC_LVT_ERROR                                        0x00000837
+#define IA32_X2APIC_LVT_ERROR_SLOT                                   299
 #define IA32_X2APIC_INIT_COUNT                                       0x00000838
+#define IA32_X2APIC_INIT_COUNT_SLOT                                  51
 #define IA32_X2APIC_CUR_COUNT                                        0x00000839
+#define IA32_X2APIC_CUR_COUNT_SLOT                                   328
 #define IA32_X2APIC_DIV_CONF                                         0x0000083E
+#define IA32_X2APIC_DIV_CONF_SLOT                                    159
 #define IA32_X2APIC_SELF_IPI                                         0x0000083F
+#define IA32_X2APIC_SELF_IPI_SLOT                                    423
 #define IA32_DEBUG_INTERFACE                                         0x00000C80
+#define IA32_DEBUG_INTERFACE_SLOT                                    6
 typedef union {
   struct {
     uint64_t enable                                                  : 1;
@@ -4736,8 +6097,10 @@ typedef union {
 
   uint64_t Flags;
 } ia32_debug_interface_register;
+#define IA32_DEBUG_INTERFACE_RESERVED_BITS                           0xFFFFFFFF3FFFFFFE
 
 #define IA32_L3_QOS_CFG                                              0x00000C81
+#define IA32_L3_QOS_CFG_SLOT                                         284
 typedef union {
   struct {
     uint64_t enable                                                  : 1;
@@ -4747,8 +6110,10 @@ typedef union {
 
   uint64_t Flags;
 } ia32_l3_qos_cfg_register;
+#define IA32_L3_QOS_CFG_RESERVED_BITS                                0xFFFFFFFFFFFFFFFE
 
 #define IA32_L2_QOS_CFG                                              0x00000C82
+#define IA32_L2_QOS_CFG_SLOT                                         46
 typedef union {
   struct {
     uint64_t enable                                                  : 1;
@@ -4758,8 +6123,10 @@ typedef union {
 
   uint64_t Flags;
 } ia32_l2_qos_cfg_register;
+#define IA32_L2_QOS_CFG_RESERVED_BITS                                0xFFFFFFFFFFFFFFFE
 
 #define IA32_QM_EVTSEL                                               0x00000C8D
+#define IA32_QM_EVTSEL_SLOT                                          471
 typedef union {
   struct {
     uint64_t event_id                                                : 8;
@@ -4771,8 +6138,10 @@ typedef union {
 
   uint64_t Flags;
 } ia32_qm_evtsel_register;
+#define IA32_QM_EVTSEL_RESERVED_BITS                                 0xFFFFFF00
 
 #define IA32_QM_CTR                                                  0x00000C8E
+#define IA32_QM_CTR_SLOT                                             232
 typedef union {
   struct {
     uint64_t resource_monitored_data                                 : 62;
@@ -4785,8 +6154,10 @@ typedef union {
 
   uint64_t Flags;
 } ia32_qm_ctr_register;
+#define IA32_QM_CTR_RESERVED_BITS                                    0x00
 
 #define IA32_PQR_ASSOC                                               0x00000C8F
+#define IA32_PQR_ASSOC_SLOT                                          498
 typedef union {
   struct {
     uint64_t resource_monitoring_id                                  : 32;
@@ -4797,8 +6168,10 @@ typedef union {
 
   uint64_t Flags;
 } ia32_pqr_assoc_register;
+#define IA32_PQR_ASSOC_RESERVED_BITS                                 0x00
 
 #define IA32_BNDCFGS                                                 0x00000D90
+#define IA32_BNDCFGS_SLOT                                            230
 typedef union {
   struct {
     uint64_t enable                                                  : 1;
@@ -4812,20 +6185,39 @@ typedef union {
 
   uint64_t Flags;
 } ia32_bndcfgs_register;
+#define IA32_BNDCFGS_RESERVED_BITS                                   0xFFC
 
 #define IA32_XSS                                                     0x00000DA0
+#define IA32_XSS_SLOT                                                481
 typedef union {
   struct {
     uint64_t reserved_1                                              : 8;
     uint64_t trace_packet_configuration_state                        : 1;
 #define IA32_XSS_TRACE_PACKET_CONFIGURATION_STATE                    0x100
-    uint64_t reserved_2                                              : 55;
+    uint64_t reserved_2                                              : 1;
+    uint64_t pasid_state                                             : 1;
+#define IA32_XSS_PASID_STATE                                         0x400
+    uint64_t cet_user_state                                          : 1;
+#define IA32_XSS_CET_USER_STATE                                      0x800
+    uint64_t cet_supervisor_state                                    : 1;
+#define IA32_XSS_CET_SUPERVISOR_STATE                                0x1000
+    uint64_t hdc_state                                               : 1;
+#define IA32_XSS_HDC_STATE                                           0x2000
+    uint64_t uintr_state                                             : 1;
+#define IA32_XSS_UINTR_STATE                                         0x4000
+    uint64_t lbr_state                                               : 1;
+#define IA32_XSS_LBR_STATE                                           0x8000
+    uint64_t hwp_state                                               : 1;
+#define IA32_XSS_HWP_STATE                                           0x10000
+    uint64_t reserved_3                                              : 47;
   };
 
   uint64_t Flags;
 } ia32_xss_register;
+#define IA32_XSS_RESERVED_BITS                                       0xFFFFFFFFFFFE02FF
 
 #define IA32_PKG_HDC_CTL                                             0x00000DB0
+#define IA32_PKG_HDC_CTL_SLOT                                        223
 typedef union {
   struct {
     uint64_t hdc_pkg_enable                                          : 1;
@@ -4835,8 +6227,10 @@ typedef union {
 
   uint64_t Flags;
 } ia32_pkg_hdc_ctl_register;
+#define IA32_PKG_HDC_CTL_RESERVED_BITS                               0xFFFFFFFFFFFFFFFE
 
 #define IA32_PM_CTL1                                                 0x00000DB1
+#define IA32_PM_CTL1_SLOT                                            486
 typedef union {
   struct {
     uint64_t hdc_allow_block                                         : 1;
@@ -4846,13 +6240,16 @@ typedef union {
 
   uint64_t Flags;
 } ia32_pm_ctl1_register;
+#define IA32_PM_CTL1_RESERVED_BITS                                   0xFFFFFFFFFFFFFFFE
 
 #define IA32_THREAD_STALL                                            0x00000DB2
+#define IA32_THREAD_STALL_SLOT                                       253
 typedef struct {
   uint64_t stall_cycle_cnt;
 } ia32_thread_stall_register;
 
 #define IA32_EFER                                                    0xC0000080
+#define IA32_EFER_SLOT                                               106
 typedef union {
   struct {
     uint64_t syscall_enable                                          : 1;
@@ -4870,15 +6267,24 @@ typedef union {
 
   uint64_t Flags;
 } ia32_efer_register;
+#define IA32_EFER_RESERVED_BITS                                      0xFFFFFFFFFFFFF2FE
 
 #define IA32_STAR                                                    0xC0000081
+#define IA32_STAR_SLOT                                               363
 #define IA32_LSTAR                                                   0xC0000082
+#define IA32_LSTAR_SLOT                                              139
 #define IA32_CSTAR                                                   0xC0000083
+#define IA32_CSTAR_SLOT                                              402
 #define IA32_FMASK                                                   0xC0000084
+#define IA32_FMASK_SLOT                                              173
 #define IA32_FS_BASE                                                 0xC0000100
+#define IA32_FS_BASE_SLOT                                            93
 #define IA32_GS_BASE                                                 0xC0000101
+#define IA32_GS_BASE_SLOT                                            369
 #define IA32_KERNEL_GS_BASE                                          0xC0000102
+#define IA32_KERNEL_GS_BASE_SLOT                                     113
 #define IA32_TSC_AUX                                                 0xC0000103
+#define IA32_TSC_AUX_SLOT                                            407
 typedef union {
   struct {
     uint64_t tsc_auxiliary_signature                                 : 32;
@@ -4888,7 +6294,293 @@ typedef union {
 
   uint64_t Flags;
 } ia32_tsc_aux_register;
-
+#define IA32_TSC_AUX_RESERVED_BITS                                   0xFFFFFFFF00000000
+
+#define IA32_MSR_SLOT_COUNT                                          512
+
+#define IA32_MSR_SLOT_BUCKET(_)                                      ((((uint32_t)(_)) * 0x01F7577D) >> 25)
+
+#define IA32_MSR_SLOT(_, _displacement)                              (((((uint32_t)(_)) * 0x87EC17FB) >> 23) ^ ((_displacement)[IA32_MSR_SLOT_BUCKET(_)]))
+
+#define IA32_MSR_SLOT_DISPLACEMENT_INITIALIZER                       \
+{                                                                    \
+  0x0000, 0x0000, 0x0000, 0x0001, 0x0002, 0x0000, 0x0001, 0x0003,    \
+  0x0000, 0x0000, 0x0009, 0x0001, 0x0001, 0x0003, 0x0004, 0x0007,    \
+  0x0000, 0x0001, 0x0003, 0x0003, 0x000B, 0x0000, 0x0001, 0x0005,    \
+  0x0003, 0x0000, 0x0008, 0x0000, 0x0000, 0x0001, 0x0000, 0x0001,    \
+  0x0000, 0x0000, 0x0000, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000,    \
+  0x0002, 0x0003, 0x0006, 0x0007, 0x0003, 0x0003, 0x0005, 0x0003,    \
+  0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0000, 0x0001, 0x0000,    \
+  0x0000, 0x0003, 0x0000, 0x0001, 0x0003, 0x0000, 0x0009, 0x0011,    \
+  0x0003, 0x0004, 0x0001, 0x0001, 0x0000, 0x0001, 0x0013, 0x0001,    \
+  0x0000, 0x0008, 0x0002, 0x0000, 0x0008, 0x000A, 0x0000, 0x0001,    \
+  0x0000, 0x0000, 0x0000, 0x0001, 0x0000, 0x0002, 0x000B, 0x0004,    \
+  0x000E, 0x0000, 0x0003, 0x0005, 0x0019, 0x0006, 0x0010, 0x0000,    \
+  0x0009, 0x0006, 0x0009, 0x001A, 0x0009, 0x0000, 0x0000, 0x0002,    \
+  0x0006, 0x0002, 0x0000, 0x0003, 0x0003, 0x0007, 0x0000, 0x0000,    \
+  0x0003, 0x0000, 0x0000, 0x000A, 0x0000, 0x0008, 0x0003, 0x0005,    \
+  0x0009, 0x0002, 0x0002, 0x0001, 0x0000, 0x0000, 0x0002, 0x0000,    \
+}
+
+#define IA32_MSR_SLOT_INITIALIZER                                                                                 \
+{                                                                                                                 \
+  { 0x00000000, 0x0000000000000000, 0x0000000000000000 }, { 0x0000046C, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x0000045B, 0x0000000000000000, 0x0000000000000000 }, { 0x0000048C, 0xFFC0F0FEF90CBEBE, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0x0000043B, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x00000C80, 0xFFFFFFFF3FFFFFFE, 0x0000000000000000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0x000000C2, 0x0000000000000000, 0x0000000000000000 }, { 0x00000297, 0xFFFFFFFFBFFF8000, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0x00000825, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x0000041B, 0x0000000000000000, 0x0000000000000000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0x00000277, 0xF8F8F8F8F8F8F8F8, 0x0000000000000000 }, { 0x00000206, 0xFFF0000000000F00, 0x000FFFFFFFFFF000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0x00000175, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x00000774, 0xFFFFF80000000000, 0x0000000000000000 }, { 0x0000044C, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0x0000042C, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x00000836, 0x0000000000000000, 0x0000000000000000 }, { 0x00000288, 0xFFFFFFFFBFFF8000, 0x0000000000000000 }, \
+  { 0x0000040C, 0x0000000000000000, 0x0000000000000000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0x00000816, 0x0000000000000000, 0x0000000000000000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0x0000045D, 0x0000000000000000, 0x0000000000000000 }, { 0x0000043D, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x000000C4, 0x0000000000000000, 0x0000000000000000 }, { 0x00000186, 0xFFFFFFFF00000000, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0x00000268, 0x0000000000000000, 0x0000000000000000 }, { 0x0000030A, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x0000048E, 0x0000000000000000, 0x0000000000000000 }, { 0x00000570, 0xFE7F000070840000, 0x0000000000000000 }, \
+  { 0x00000827, 0x0000000000000000, 0x0000000000000000 }, { 0x00000299, 0xFFFFFFFFBFFF8000, 0x0000000000000000 }, \
+  { 0x0000046E, 0x0000000000000000, 0x0000000000000000 }, { 0x0000041D, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x00000C82, 0xFFFFFFFFFFFFFFFE, 0x0000000000000000 }, { 0x00000208, 0xFFF0000000000F00, 0x000FFFFFFFFFF000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0x00000561, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x00000259, 0x0000000000000000, 0x0000000000000000 }, { 0x00000838, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0x0000044E, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x00000581, 0x0000000000000000, 0x0000000000000000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0x0000042E, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x0000028A, 0xFFFFFFFFBFFF8000, 0x0000000000000000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0x00000818, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x0000040E, 0x0000000000000000, 0x0000000000000000 }, { 0x0000026A, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x000000C6, 0x0000000000000000, 0x0000000000000000 }, { 0x000004D0, 0xFFFFFFFFFFFFFFFE, 0x0000000000000000 }, \
+  { 0x000001F9, 0x0000000000000000, 0x0000000000000000 }, { 0x00000188, 0xFFFFFFFF00000000, 0x0000000000000000 }, \
+  { 0x00000572, 0x000000000000001F, 0x0000000000000000 }, { 0x0000043F, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x000001D9, 0xFFFFFFFFFFFF003C, 0x0000000000000000 }, { 0x000006A5, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x0000041F, 0x0000000000000000, 0x0000000000000000 }, { 0x0000045F, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x00000490, 0x0000000000000000, 0x0000000000000000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0x0000020A, 0xFFF0000000000F00, 0x000FFFFFFFFFF000 }, { 0x0000029B, 0xFFFFFFFFBFFF8000, 0x0000000000000000 }, \
+  { 0x0000038E, 0x037FFFF8FFFFFFF0, 0x0000000000000000 }, { 0x000004C1, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x000000E8, 0x0000000000000000, 0x0000000000000000 }, { 0x00000199, 0xFFFFFFFEFFFF0000, 0x0000000000000000 }, \
+  { 0x00000450, 0x0000000000000000, 0x0000000000000000 }, { 0x00000179, 0xFFFFFFFFF200F000, 0x0000000000000000 }, \
+  { 0x00000470, 0x0000000000000000, 0x0000000000000000 }, { 0x00000583, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x00000430, 0x0000000000000000, 0x0000000000000000 }, { 0x0000026C, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x0000028C, 0xFFFFFFFFBFFF8000, 0x0000000000000000 }, { 0x00000481, 0xFFFFFFFFFFFFFF16, 0x0000000000000000 }, \
+  { 0x00000410, 0x0000000000000000, 0x0000000000000000 }, { 0xC0000100, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x0000081A, 0x0000000000000000, 0x0000000000000000 }, { 0x00000006, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x000000C8, 0x0000000000000000, 0x0000000000000000 }, { 0x00000461, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x00000452, 0x0000000000000000, 0x0000000000000000 }, { 0x00000441, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0x0000026E, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x0000029D, 0xFFFFFFFFBFFF8000, 0x0000000000000000 }, { 0x00000048, 0xFFFFFFFFFFFFFFF8, 0x0000000000000000 }, \
+  { 0x00000492, 0xFFFFFFFFFFFFFF20, 0x0000000000000000 }, { 0x0000080B, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0xC0000080, 0xFFFFFFFFFFFFF2FE, 0x0000000000000000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0x00000421, 0x0000000000000000, 0x0000000000000000 }, { 0x00000017, 0xFFE3FFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0x000006A7, 0x0000000000000000, 0x0000000000000000 }, { 0x0000020C, 0xFFF0000000000F00, 0x000FFFFFFFFFF000 }, \
+  { 0x00000401, 0x0000000000000000, 0x0000000000000000 }, { 0xC0000102, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x00000390, 0x037FFFF800000000, 0x0000000000000000 }, { 0x00000585, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x0000081C, 0x0000000000000000, 0x0000000000000000 }, { 0x0000017B, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x0000010A, 0xFFFFFFFFFFFFFE00, 0x0000000000000000 }, { 0x000004C3, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x000002FF, 0xFFFFFFFFFFFFF3F8, 0x0000000000000000 }, { 0x00000432, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x0000028E, 0xFFFFFFFFBFFF8000, 0x0000000000000000 }, { 0x0000019B, 0xFFFFFFFFFE0000E0, 0x0000000000000000 }, \
+  { 0x00000483, 0xFFFFFFFF00036DFB, 0x0000000000000000 }, { 0x00000412, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x00000079, 0x0000000000000000, 0x0000000000000000 }, { 0x00000472, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0x00000463, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0x0000029F, 0xFFFFFFFFBFFF8000, 0x0000000000000000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0x00000443, 0x0000000000000000, 0x0000000000000000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0x00000423, 0x0000000000000000, 0x0000000000000000 }, { 0xC0000082, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0x0000020E, 0xFFF0000000000F00, 0x000FFFFFFFFFF000 }, { 0x0000080D, 0xFFFFFFFF00000000, 0x0000000000000000 }, \
+  { 0x00000403, 0x0000000000000000, 0x0000000000000000 }, { 0x00000392, 0x7FFFFFF800000000, 0x0000000000000000 }, \
+  { 0x000004C5, 0x0000000000000000, 0x0000000000000000 }, { 0x00000587, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x0000009B, 0xFFFFFFFF00000FFA, 0x0000000000000000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0x00000454, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x00000434, 0x0000000000000000, 0x0000000000000000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0x00000290, 0xFFFFFFFFBFFF8000, 0x0000000000000000 }, \
+  { 0x00000485, 0x0000000080003E00, 0x0000000000000000 }, { 0x00000414, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x0000081E, 0x0000000000000000, 0x0000000000000000 }, { 0x0000083E, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0x00000465, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x00000250, 0x0000000000000000, 0x0000000000000000 }, { 0x0000001B, 0xFFF00000000002FF, 0x000FFFFFFFFFF000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0x00000405, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x0000003B, 0x0000000000000000, 0x0000000000000000 }, { 0x00000445, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0x00000425, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x0000008C, 0x0000000000000000, 0x0000000000000000 }, { 0x0000082F, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x0000080F, 0x0000000000000000, 0x0000000000000000 }, { 0xC0000084, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x00000210, 0xFFF0000000000F00, 0x000FFFFFFFFFF000 }, { 0x00000281, 0xFFFFFFFFBFFF8000, 0x0000000000000000 }, \
+  { 0x000004C7, 0x0000000000000000, 0x0000000000000000 }, { 0x00000487, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x00000456, 0x0000000000000000, 0x0000000000000000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0x00000292, 0xFFFFFFFFBFFF8000, 0x0000000000000000 }, { 0x00000436, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0x00000820, 0x0000000000000000, 0x0000000000000000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0x000001B0, 0xFFFFFFFFFFFFFFF0, 0x0000000000000000 }, { 0x00000416, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0x00000467, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0x00000447, 0x0000000000000000, 0x0000000000000000 }, { 0x00000283, 0xFFFFFFFFBFFF8000, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0x00000407, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x0000008E, 0x0000000000000000, 0x0000000000000000 }, { 0x00000201, 0xFFF00000000007FF, 0x000FFFFFFFFFF000 }, \
+  { 0x00000427, 0x0000000000000000, 0x0000000000000000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0x00000345, 0xFFFFFFFFFFFFC000, 0x0000000000000000 }, { 0x00000212, 0xFFF0000000000F00, 0x000FFFFFFFFFF000 }, \
+  { 0x00000811, 0x0000000000000000, 0x0000000000000000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0x000001F2, 0xFFFFFFFF00000F00, 0x0000000000000000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0x00000458, 0x0000000000000000, 0x0000000000000000 }, { 0x00000489, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0x00000438, 0x0000000000000000, 0x0000000000000000 }, { 0x00000294, 0xFFFFFFFFBFFF8000, 0x0000000000000000 }, \
+  { 0x000001B2, 0xFFFFFFFFFE0000E8, 0x0000000000000000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0x00000418, 0x0000000000000000, 0x0000000000000000 }, { 0x00000203, 0xFFF00000000007FF, 0x000FFFFFFFFFF000 }, \
+  { 0x00000822, 0x0000000000000000, 0x0000000000000000 }, { 0x00000DB0, 0xFFFFFFFFFFFFFFFE, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0x00000802, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x00000469, 0x0000000000000000, 0x0000000000000000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0x00000449, 0x0000000000000000, 0x0000000000000000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0x00000D90, 0x0000000000000FFC, 0x0000000000000000 }, { 0x00000771, 0xFFFFFFFF00000000, 0x0000000000000000 }, \
+  { 0x00000C8E, 0x0000000000000000, 0x0000000000000000 }, { 0x00000285, 0xFFFFFFFFBFFF8000, 0x0000000000000000 }, \
+  { 0x00000409, 0x0000000000000000, 0x0000000000000000 }, { 0x00000429, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0x00000813, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x00000833, 0x0000000000000000, 0x0000000000000000 }, { 0x000006E0, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x00000296, 0xFFFFFFFFBFFF8000, 0x0000000000000000 }, { 0x000000C1, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0x0000045A, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0x0000043A, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0x000006A0, 0x00000000000003C0, 0x0000000000000000 }, \
+  { 0x00000010, 0x0000000000000000, 0x0000000000000000 }, { 0x00000824, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x0000041A, 0x0000000000000000, 0x0000000000000000 }, { 0x00000DB2, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x0000048B, 0xFFFFFFFF20000000, 0x0000000000000000 }, { 0x00000205, 0xFFF00000000007FF, 0x000FFFFFFFFFF000 }, \
+  { 0x000000C3, 0x0000000000000000, 0x0000000000000000 }, { 0x00000174, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0x0000046B, 0x0000000000000000, 0x0000000000000000 }, { 0x0000044B, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0x00000773, 0xFFFFFFFFFFFFFFFC, 0x0000000000000000 }, \
+  { 0x00000835, 0x0000000000000000, 0x0000000000000000 }, { 0x0000042B, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0x00000287, 0xFFFFFFFFBFFF8000, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0x0000040B, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x00000815, 0x0000000000000000, 0x0000000000000000 }, { 0x00000001, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0x00000600, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0x0000043C, 0x0000000000000000, 0x0000000000000000 }, { 0x0000041C, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x00000309, 0x0000000000000000, 0x0000000000000000 }, { 0x000006A2, 0x00000000000003C0, 0x0000000000000000 }, \
+  { 0x0000048D, 0x0000000000000000, 0x0000000000000000 }, { 0x00000298, 0xFFFFFFFFBFFF8000, 0x0000000000000000 }, \
+  { 0x0000045C, 0x0000000000000000, 0x0000000000000000 }, { 0x00000826, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x00000C81, 0xFFFFFFFFFFFFFFFE, 0x0000000000000000 }, { 0x00000207, 0xFFF00000000007FF, 0x000FFFFFFFFFF000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0x0000046D, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x00000269, 0x0000000000000000, 0x0000000000000000 }, { 0x0000042D, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0x00000580, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x0000044D, 0x0000000000000000, 0x0000000000000000 }, { 0x00000176, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0x00000817, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x00000258, 0x0000000000000000, 0x0000000000000000 }, { 0x00000289, 0xFFFFFFFFBFFF8000, 0x0000000000000000 }, \
+  { 0x00000560, 0xFFF000000000007F, 0x000FFFFFFFFFFF80 }, { 0x00000837, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0x0000040D, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x0000043E, 0x0000000000000000, 0x0000000000000000 }, { 0x000001F8, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x0000045E, 0x0000000000000000, 0x0000000000000000 }, { 0x00000187, 0xFFFFFFFF00000000, 0x0000000000000000 }, \
+  { 0x000006A4, 0x0000000000000000, 0x0000000000000000 }, { 0x000000C5, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x0000030B, 0x0000000000000000, 0x0000000000000000 }, { 0x00000571, 0xFFFE0000FFFFFF08, 0x0000000000000000 }, \
+  { 0x00000500, 0xFFFFFFFFFF00FFFE, 0x0000000000000000 }, { 0x00000828, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x0000046F, 0x0000000000000000, 0x0000000000000000 }, { 0x0000048F, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x0000029A, 0xFFFFFFFFBFFF8000, 0x0000000000000000 }, { 0x0000041E, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x00000209, 0xFFF00000000007FF, 0x000FFFFFFFFFF000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0x00000808, 0x0000000000000000, 0x0000000000000000 }, { 0x00000198, 0xFFFFFFFFFFFF0000, 0x0000000000000000 }, \
+  { 0x0000038D, 0xFFFFFFFFFFFFF000, 0x0000000000000000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0x00000582, 0x0000000000000000, 0x0000000000000000 }, { 0x00000819, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x0000026B, 0x0000000000000000, 0x0000000000000000 }, { 0x0000044F, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x00000839, 0x0000000000000000, 0x0000000000000000 }, { 0x0000042F, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x0000028B, 0xFFFFFFFFBFFF8000, 0x0000000000000000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0x00000777, 0xFFFFFFFFFFFFFFFA, 0x0000000000000000 }, \
+  { 0x0000040F, 0x0000000000000000, 0x0000000000000000 }, { 0x00000480, 0xFF00E00080000000, 0x0000000000000000 }, \
+  { 0x000000C7, 0x0000000000000000, 0x0000000000000000 }, { 0x000001FA, 0xFFFFFFFFFAFE1800, 0x0000000000000000 }, \
+  { 0x00000189, 0xFFFFFFFF00000000, 0x0000000000000000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0x00000440, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x000000E7, 0x0000000000000000, 0x0000000000000000 }, { 0x000006A6, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x0000029C, 0xFFFFFFFFBFFF8000, 0x0000000000000000 }, { 0x00000471, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x00000491, 0xFFFFFFFFFFFFFFFE, 0x0000000000000000 }, { 0x00000460, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0x0000080A, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x0000020B, 0xFFF00000000007FF, 0x000FFFFFFFFFF000 }, { 0x00000420, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x00000400, 0x0000000000000000, 0x0000000000000000 }, { 0x000004C2, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x0000038F, 0x0000000000000000, 0x0000000000000000 }, { 0x0000019A, 0xFFFFFFFFFFFFFFE0, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0x0000026D, 0x0000000000000000, 0x0000000000000000 }, { 0x00000584, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x0000081B, 0x0000000000000000, 0x0000000000000000 }, { 0x00000431, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x0000028D, 0xFFFFFFFFBFFF8000, 0x0000000000000000 }, { 0xC0000081, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x00000482, 0xFFFFFFFF04046173, 0x0000000000000000 }, { 0x00000451, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x00000411, 0x0000000000000000, 0x0000000000000000 }, { 0x0000017A, 0xFFFFFFFFFFFFFFF0, 0x0000000000000000 }, \
+  { 0x00000462, 0x0000000000000000, 0x0000000000000000 }, { 0xC0000101, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0x000003F1, 0xFFFFFFF0FFFFFFF0, 0x0000000000000000 }, \
+  { 0x0000029E, 0xFFFFFFFFBFFF8000, 0x0000000000000000 }, { 0x00000442, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0x000006A8, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0x00000493, 0xFFFFFFFFFFFFFFF7, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0x00000422, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x0000020D, 0xFFF00000000007FF, 0x000FFFFFFFFFF000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0x00000473, 0x0000000000000000, 0x0000000000000000 }, { 0x0000019C, 0xFFFFFFFF07800000, 0x0000000000000000 }, \
+  { 0x00000453, 0x0000000000000000, 0x0000000000000000 }, { 0x000004C4, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x00000391, 0x837FFFF800000000, 0x0000000000000000 }, { 0x00000402, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x00000586, 0x0000000000000000, 0x0000000000000000 }, { 0x00000049, 0xFFFFFFFFFFFFFFFE, 0x0000000000000000 }, \
+  { 0x0000026F, 0x0000000000000000, 0x0000000000000000 }, { 0x0000010B, 0xFFFFFFFFFFFFFFFE, 0x0000000000000000 }, \
+  { 0x00000433, 0x0000000000000000, 0x0000000000000000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0x0000028F, 0xFFFFFFFFBFFF8000, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0x00000413, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x0000081D, 0x0000000000000000, 0x0000000000000000 }, { 0x00000484, 0xFFFFFFFFFF8011FB, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0x00000464, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0xC0000083, 0x0000000000000000, 0x0000000000000000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0x00000280, 0xFFFFFFFFBFFF8000, 0x0000000000000000 }, { 0x0000003A, 0xFFFFFFFFFFE900F8, 0x0000000000000000 }, \
+  { 0x00000444, 0x0000000000000000, 0x0000000000000000 }, { 0xC0000103, 0xFFFFFFFF00000000, 0x0000000000000000 }, \
+  { 0x00000424, 0x0000000000000000, 0x0000000000000000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0x0000008B, 0x0000000000000000, 0x0000000000000000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0x0000020F, 0xFFF00000000007FF, 0x000FFFFFFFFFF000 }, \
+  { 0x00000404, 0x0000000000000000, 0x0000000000000000 }, { 0x000004C6, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x00000455, 0x0000000000000000, 0x0000000000000000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0x0000083F, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x00000435, 0x0000000000000000, 0x0000000000000000 }, { 0x00000291, 0xFFFFFFFFBFFF8000, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0x00000486, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x00000415, 0x0000000000000000, 0x0000000000000000 }, { 0x0000081F, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0x00000466, 0x0000000000000000, 0x0000000000000000 }, { 0x00000426, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0x0000008D, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x00000446, 0x0000000000000000, 0x0000000000000000 }, { 0x00000200, 0xFFF0000000000F00, 0x000FFFFFFFFFF000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0x00000810, 0x0000000000000000, 0x0000000000000000 }, { 0x00000282, 0xFFFFFFFFBFFF8000, 0x0000000000000000 }, \
+  { 0x000000FE, 0xFFFFFFFFFFFFF200, 0x0000000000000000 }, { 0x00000830, 0x00000000FFF33000, 0x0000000000000000 }, \
+  { 0x000001A0, 0xFFFFFFFBFF3AE776, 0x0000000000000000 }, { 0x00000211, 0xFFF00000000007FF, 0x000FFFFFFFFFF000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0x00000406, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x000004C8, 0x0000000000000000, 0x0000000000000000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0x00000457, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0x0000009E, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x00000437, 0x0000000000000000, 0x0000000000000000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0x00000293, 0xFFFFFFFFBFFF8000, 0x0000000000000000 }, { 0x00000488, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x00000821, 0x0000000000000000, 0x0000000000000000 }, { 0x00000417, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0x000001B1, 0xFFFFFFFFFF80F000, 0x0000000000000000 }, \
+  { 0x00000468, 0x0000000000000000, 0x0000000000000000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0x00000202, 0xFFF0000000000F00, 0x000FFFFFFFFFF000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0x00000213, 0xFFF00000000007FF, 0x000FFFFFFFFFF000 }, { 0x00000448, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x00000770, 0xFFFFFFFFFFFFFFFE, 0x0000000000000000 }, { 0x00000C8D, 0x00000000FFFFFF00, 0x0000000000000000 }, \
+  { 0x0000008F, 0x0000000000000000, 0x0000000000000000 }, { 0x00000284, 0xFFFFFFFFBFFF8000, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0x00000428, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x00000408, 0x0000000000000000, 0x0000000000000000 }, { 0x00000832, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x00000812, 0x0000000000000000, 0x0000000000000000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0x00000DA0, 0xFFFFFFFFFFFE02FF, 0x0000000000000000 }, \
+  { 0x000001F3, 0xFFFFFFFF000007FF, 0x0000000000000000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0x00000DB1, 0xFFFFFFFFFFFFFFFE, 0x0000000000000000 }, { 0x00000439, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x0000048A, 0xFFFFFFFFFFFF9000, 0x0000000000000000 }, { 0x00000295, 0xFFFFFFFFBFFF8000, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0x00000823, 0x0000000000000000, 0x0000000000000000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0x00000204, 0xFFF0000000000F00, 0x000FFFFFFFFFF000 }, { 0x00000419, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0x00000459, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x00000C8F, 0x0000000000000000, 0x0000000000000000 }, { 0x00000122, 0xFFFFFFFFFFFFFFFC, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0x0000044A, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x0000040A, 0x0000000000000000, 0x0000000000000000 }, { 0x00000772, 0xFFFFFC0000000000, 0x0000000000000000 }, \
+  { 0x00000803, 0x0000000000000000, 0x0000000000000000 }, { 0x00000834, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0x00000286, 0xFFFFFFFFBFFF8000, 0x0000000000000000 }, { 0x0000046A, 0x0000000000000000, 0x0000000000000000 }, \
+  { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, { 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }, \
+  { 0x00000814, 0x0000000000000000, 0x0000000000000000 }, { 0x0000042A, 0x0000000000000000, 0x0000000000000000 }, \
+}
 /**
  * @}
  */
@@ -4936,6 +6628,7 @@ typedef union {
 
   uint32_t Flags;
 } pde_4mb_32;
+#define PDE_4MB_32_RESERVED_BITS                                     0x200000
 
 typedef union {
   struct {
@@ -4963,6 +6656,7 @@ typedef union {
 
   uint32_t Flags;
 } pde_32;
+#define PDE_32_RESERVED_BITS                                         0x00
 
 typedef union {
   struct {
@@ -4992,6 +6686,7 @@ typedef union {
 
   uint32_t Flags;
 } pte_32;
+#define PTE_32_RESERVED_BITS                                         0x00
 
 typedef union {
   struct {
@@ -5021,6 +6716,7 @@ typedef union {
 
   uint32_t Flags;
 } pt_entry_32;
+#define PT_ENTRY_32_RESERVED_BITS                                    0x00
 
 /**
  * @defgroup paging_structures_entry_count_32 \
@@ -5056,7 +6752,8 @@ typedef union {
 #define PML4E_64_PAGE_LEVEL_CACHE_DISABLE                            0x10
     uint64_t accessed                                                : 1;
 #define PML4E_64_ACCESSED                                            0x20
-    uint64_t reserved_1                                              : 1;
+    uint64_t ignored_0                                               : 1;
+#define PML4E_64_IGNORED_0                                           0x40
     uint64_t must_be_zero                                            : 1;
 #define PML4E_64_MUST_BE_ZERO                                        0x80
     uint64_t ignored_1                                               : 3;
@@ -5065,7 +6762,7 @@ typedef union {
 #define PML4E_64_RESTART                                             0x800
     uint64_t page_frame_number                                       : 36;
 #define PML4E_64_PAGE_FRAME_NUMBER                                   0xFFFFFFFFF000
-    uint64_t reserved_2                                              : 4;
+    uint64_t reserved_1                                              : 4;
     uint64_t ignored_2                                               : 11;
 #define PML4E_64_IGNORED_2                                           0x7FF0000000000000
     uint64_t execute_disable                                         : 1;
@@ -5074,6 +6771,8 @@ typedef union {
 
   uint64_t Flags;
 } pml4e_64;
+#define PML4E_64_RESERVED_BITS                                       0x80
+#define PML4E_64_ADDRESS_BITS                                        0xFFFFFFFFFF000
 
 typedef union {
   struct {
@@ -5115,6 +6814,8 @@ typedef union {
 
   uint64_t Flags;
 } pdpte_1gb_64;
+#define PDPTE_1GB_64_RESERVED_BITS                                   0x3FFFE000
+#define PDPTE_1GB_64_ADDRESS_BITS                                    0xFFFFFC0000000
 
 typedef union {
   struct {
@@ -5130,7 +6831,8 @@ typedef union {
 #define PDPTE_64_PAGE_LEVEL_CACHE_DISABLE                            0x10
     uint64_t accessed                                                : 1;
 #define PDPTE_64_ACCESSED                                            0x20
-    uint64_t reserved_1                                              : 1;
+    uint64_t ignored_0                                               : 1;
+#define PDPTE_64_IGNORED_0                                           0x40
     uint64_t large_page                                              : 1;
 #define PDPTE_64_LARGE_PAGE                                          0x80
     uint64_t ignored_1                                               : 3;
@@ -5139,7 +6841,7 @@ typedef union {
 #define PDPTE_64_RESTART                                             0x800
     uint64_t page_frame_number                                       : 36;
 #define PDPTE_64_PAGE_FRAME_NUMBER                                   0xFFFFFFFFF000
-    uint64_t reserved_2                                              : 4;
+    uint64_t reserved_1                                              : 4;
     uint64_t ignored_2                                               : 11;
 #define PDPTE_64_IGNORED_2                                           0x7FF0000000000000
     uint64_t execute_disable                                         : 1;
@@ -5148,6 +6850,8 @@ typedef union {
 
   uint64_t Flags;
 } pdpte_64;
+#define PDPTE_64_RESERVED_BITS                                       0x00
+#define PDPTE_64_ADDRESS_BITS                                        0xFFFFFFFFFF000
 
 typedef union {
   struct {
@@ -5189,6 +6893,8 @@ typedef union {
 
   uint64_t Flags;
 } pde_2mb_64;
+#define PDE_2MB_64_RESERVED_BITS                                     0x1FE000
+#define PDE_2MB_64_ADDRESS_BITS                                      0xFFFFFFFE00000
 
 typedef union {
   struct {
@@ -5204,7 +6910,8 @@ typedef union {
 #define PDE_64_PAGE_LEVEL_CACHE_DISABLE                              0x10
     uint64_t accessed                                                : 1;
 #define PDE_64_ACCESSED                                              0x20
-    uint64_t reserved_1                                              : 1;
+    uint64_t ignored_0                                               : 1;
+#define PDE_64_IGNORED_0                                             0x40
     uint64_t large_page                                              : 1;
 #define PDE_64_LARGE_PAGE                                            0x80
     uint64_t ignored_1                                               : 3;
@@ -5213,7 +6920,7 @@ typedef union {
 #define PDE_64_RESTART                                               0x800
     uint64_t page_frame_number                                       : 36;
 #define PDE_64_PAGE_FRAME_NUMBER                                     0xFFFFFFFFF000
-    uint64_t reserved_2                                              : 4;
+    uint64_t reserved_1                                              : 4;
     uint64_t ignored_2                                               : 11;
 #define PDE_64_IGNORED_2                                             0x7FF0000000000000
     uint64_t execute_disable                                         : 1;
@@ -5222,6 +6929,8 @@ typedef union {
 
   uint64_t Flags;
 } pde_64;
+#define PDE_64_RESERVED_BITS                                         0x00
+#define PDE_64_ADDRESS_BITS                                          0xFFFFFFFFFF000
 
 typedef union {
   struct {
@@ -5260,6 +6969,8 @@ typedef union {
 
   uint64_t Flags;
 } pte_64;
+#define PTE_64_RESERVED_BITS                                         0x00
+#define PTE_64_ADDRESS_BITS                                          0xFFFFFFFFFF000
 
 typedef union {
   struct {
@@ -5298,6 +7009,8 @@ typedef union {
 
   uint64_t Flags;
 } pt_entry_64;
+#define PT_ENTRY_64_RESERVED_BITS                                    0x00
+#define PT_ENTRY_64_ADDRESS_BITS                                     0xFFFFFFFFFF000
 
 /**
  * @defgroup paging_structures_entry_count_64 \
@@ -5340,6 +7053,18 @@ typedef union {
 
   uint64_t Flags;
 } invpcid_descriptor;
+#define INVPCID_DESCRIPTOR_RESERVED_BITS                             0xFFFFFFFFFFFFF000
+
+/**
+ * @defgroup pcid \
+ *           Process-context identifier limits
+ * @{
+ */
+#define PCID_MAX                                                     0x00000FFF
+#define PCID_NO_FLUSH                                                0x8000000000000000
+/**
+ * @}
+ */
 
 /**
  * @defgroup segment_descriptors \
@@ -5385,6 +7110,7 @@ typedef union {
 
   uint32_t Flags;
 } segment_access_rights;
+#define SEGMENT_ACCESS_RIGHTS_RESERVED_BITS                          0xFF0F00FF
 
 typedef struct {
   uint16_t segment_limit_low;
@@ -5392,31 +7118,32 @@ typedef struct {
   union {
     struct {
       uint32_t base_address_middle                                   : 8;
-#define SEGMENT__BASE_ADDRESS_MIDDLE                                 0xFF
+#define SEGMENT_DESCRIPTOR_32_BASE_ADDRESS_MIDDLE                    0xFF
       uint32_t type                                                  : 4;
-#define SEGMENT__TYPE                                                0xF00
+#define SEGMENT_DESCRIPTOR_32_TYPE                                   0xF00
       uint32_t descriptor_type                                       : 1;
-#define SEGMENT__DESCRIPTOR_TYPE                                     0x1000
+#define SEGMENT_DESCRIPTOR_32_DESCRIPTOR_TYPE                        0x1000
       uint32_t descriptor_privilege_level                            : 2;
-#define SEGMENT__DESCRIPTOR_PRIVILEGE_LEVEL                          0x6000
+#define SEGMENT_DESCRIPTOR_32_DESCRIPTOR_PRIVILEGE_LEVEL             0x6000
       uint32_t present                                               : 1;
-#define SEGMENT__PRESENT                                             0x8000
+#define SEGMENT_DESCRIPTOR_32_PRESENT                                0x8000
       uint32_t segment_limit_high                                    : 4;
-#define SEGMENT__SEGMENT_LIMIT_HIGH                                  0xF0000
+#define SEGMENT_DESCRIPTOR_32_SEGMENT_LIMIT_HIGH                     0xF0000
       uint32_t available_bit                                         : 1;
-#define SEGMENT__AVAILABLE_BIT                                       0x100000
+#define SEGMENT_DESCRIPTOR_32_AVAILABLE_BIT                          0x100000
       uint32_t long_mode                                             : 1;
-#define SEGMENT__LONG_MODE                                           0x200000
+#define SEGMENT_DESCRIPTOR_32_LONG_MODE                              0x200000
       uint32_t default_big                                           : 1;
-#define SEGMENT__DEFAULT_BIG                                         0x400000
+#define SEGMENT_DESCRIPTOR_32_DEFAULT_BIG                            0x400000
       uint32_t granularity                                           : 1;
-#define SEGMENT__GRANULARITY                                         0x800000
+#define SEGMENT_DESCRIPTOR_32_GRANULARITY                            0x800000
       uint32_t base_address_high                                     : 8;
-#define SEGMENT__BASE_ADDRESS_HIGH                                   0xFF000000
+#define SEGMENT_DESCRIPTOR_32_BASE_ADDRESS_HIGH                      0xFF000000
     };
 
     uint32_t Flags;
   } ;
+#define SEGMENT_DESCRIPTOR_32_RESERVED_BITS                          0x00
 
 } segment_descriptor_32;
 
@@ -5426,31 +7153,32 @@ typedef struct {
   union {
     struct {
       uint32_t base_address_middle                                   : 8;
-#define SEGMENT__BASE_ADDRESS_MIDDLE                                 0xFF
+#define SEGMENT_DESCRIPTOR_64_BASE_ADDRESS_MIDDLE                    0xFF
       uint32_t type                                                  : 4;
-#define SEGMENT__TYPE                                                0xF00
+#define SEGMENT_DESCRIPTOR_64_TYPE                                   0xF00
       uint32_t descriptor_type                                       : 1;
-#define SEGMENT__DESCRIPTOR_TYPE                                     0x1000
+#define SEGMENT_DESCRIPTOR_64_DESCRIPTOR_TYPE                        0x1000
       uint32_t descriptor_privilege_level                            : 2;
-#define SEGMENT__DESCRIPTOR_PRIVILEGE_LEVEL                          0x6000
+#define SEGMENT_DESCRIPTOR_64_DESCRIPTOR_PRIVILEGE_LEVEL             0x6000
       uint32_t present                                               : 1;
-#define SEGMENT__PRESENT                                             0x8000
+#define SEGMENT_DESCRIPTOR_64_PRESENT                                0x8000
       uint32_t segment_limit_high                                    : 4;
-#define SEGMENT__SEGMENT_LIMIT_HIGH                                  0xF0000
+#define SEGMENT_DESCRIPTOR_64_SEGMENT_LIMIT_HIGH                     0xF0000
       uint32_t available_bit                                         : 1;
-#define SEGMENT__AVAILABLE_BIT                                       0x100000
+#define SEGMENT_DESCRIPTOR_64_AVAILABLE_BIT                          0x100000
       uint32_t long_mode                                             : 1;
-#define SEGMENT__LONG_MODE                                           0x200000
+#define SEGMENT_DESCRIPTOR_64_LONG_MODE                              0x200000
       uint32_t default_big                                           : 1;
-#define SEGMENT__DEFAULT_BIG                                         0x400000
+#define SEGMENT_DESCRIPTOR_64_DEFAULT_BIG                            0x400000
       uint32_t granularity                                           : 1;
-#define SEGMENT__GRANULARITY                                         0x800000
+#define SEGMENT_DESCRIPTOR_64_GRANULARITY                            0x800000
       uint32_t base_address_high                                     : 8;
-#define SEGMENT__BASE_ADDRESS_HIGH                                   0xFF000000
+#define SEGMENT_DESCRIPTOR_64_BASE_ADDRESS_HIGH                      0xFF000000
     };
 
     uint32_t Flags;
   } ;
+#define SEGMENT_DESCRIPTOR_64_RESERVED_BITS                          0x00
 
   uint32_t base_address_upper;
   uint32_t must_be_zero;
@@ -5462,23 +7190,24 @@ typedef struct {
   union {
     struct {
       uint32_t interrupt_stack_table                                 : 3;
-#define SEGMENT__INTERRUPT_STACK_TABLE                               0x07
+#define SEGMENT_DESCRIPTOR_INTERRUPT_GATE_64_INTERRUPT_STACK_TABLE   0x07
       uint32_t must_be_zero_0                                        : 5;
-#define SEGMENT__MUST_BE_ZERO_0                                      0xF8
+#define SEGMENT_DESCRIPTOR_INTERRUPT_GATE_64_MUST_BE_ZERO_0          0xF8
       uint32_t type                                                  : 4;
-#define SEGMENT__TYPE                                                0xF00
+#define SEGMENT_DESCRIPTOR_INTERRUPT_GATE_64_TYPE                    0xF00
       uint32_t must_be_zero_1                                        : 1;
-#define SEGMENT__MUST_BE_ZERO_1                                      0x1000
+#define SEGMENT_DESCRIPTOR_INTERRUPT_GATE_64_MUST_BE_ZERO_1          0x1000
       uint32_t descriptor_privilege_level                            : 2;
-#define SEGMENT__DESCRIPTOR_PRIVILEGE_LEVEL                          0x6000
+#define SEGMENT_DESCRIPTOR_INTERRUPT_GATE_64_DESCRIPTOR_PRIVILEGE_LEVEL 0x6000
       uint32_t present                                               : 1;
-#define SEGMENT__PRESENT                                             0x8000
+#define SEGMENT_DESCRIPTOR_INTERRUPT_GATE_64_PRESENT                 0x8000
       uint32_t offset_middle                                         : 16;
-#define SEGMENT__OFFSET_MIDDLE                                       0xFFFF0000
+#define SEGMENT_DESCRIPTOR_INTERRUPT_GATE_64_OFFSET_MIDDLE           0xFFFF0000
     };
 
     uint32_t Flags;
   } ;
+#define SEGMENT_DESCRIPTOR_INTERRUPT_GATE_64_RESERVED_BITS           0x10F8
 
   uint32_t offset_high;
   uint32_t reserved;
@@ -5486,6 +7215,25 @@ typedef struct {
 
 #define SEGMENT_DESCRIPTOR_TYPE_SYSTEM                               0x00000000
 #define SEGMENT_DESCRIPTOR_TYPE_CODE_OR_DATA                         0x00000001
+/**
+ * @defgroup segment_descriptor_encoding \
+ *           Segment descriptor encoding and decoding
+ * @{
+ */
+#define SEGMENT_DESCRIPTOR_ENCODE(_base, _limit, _access_rights)     (((_limit) & 0xFFFFULL) | (((_base) & 0xFFFFFFULL) << 16) | (((_access_rights) & 0xF0FF00ULL) << 32) | (((_limit) & 0xF0000ULL) << 32) | (((_base) & 0xFF000000ULL) << 32))
+#define SEGMENT_DESCRIPTOR_DECODE_BASE(_)                            ((((_) >> 16) & 0xFFFFFF) | (((_) >> 32) & 0xFF000000))
+#define SEGMENT_DESCRIPTOR_DECODE_LIMIT(_)                           (((_) & 0xFFFF) | (((_) >> 32) & 0xF0000))
+#define SEGMENT_DESCRIPTOR_DECODE_LIMIT_BYTES(_)                     (((((_) & 0xFFFF) | (((_) >> 32) & 0xF0000)) << ((((_) >> 55) & 0x01) * 12)) | ((((_) >> 55) & 0x01) * 0xFFF))
+#define SEGMENT_DESCRIPTOR_DECODE_ACCESS_RIGHTS(_)                   (((_) >> 32) & 0xF0FF00)
+#define SEGMENT_DESCRIPTOR_DECODE_VMX_ACCESS_RIGHTS(_)               (((_) >> 40) & 0xF0FF)
+#define SEGMENT_INTERRUPT_GATE_ENCODE(_offset, _selector, _ist, _type, _dpl) (((_offset) & 0xFFFFULL) | (((_selector) & 0xFFFFULL) << 16) | (((_ist) & 0x07ULL) << 32) | (((_type) & 0x0FULL) << 40) | (((_dpl) & 0x03ULL) << 45) | 0x800000000000ULL | (((_offset) & 0xFFFF0000ULL) << 32))
+#define SEGMENT_INTERRUPT_GATE_ENCODE_UPPER(_offset)                 ((_offset) >> 32)
+#define SEGMENT_INTERRUPT_GATE_DECODE_OFFSET(_, _upper)              (((_) & 0xFFFF) | (((_) >> 32) & 0xFFFF0000) | ((_upper) << 32))
+#define SEGMENT_SELECTOR_DESCRIPTOR_OFFSET(_)                        ((_) & 0xFFF8)
+/**
+ * @}
+ */
+
 /**
  * @defgroup segment_descriptor_code_and_data_type \
  *           Code- and Data-Segment Descriptor Types
@@ -5548,6 +7296,7 @@ typedef union {
 
   uint16_t Flags;
 } segment_selector;
+#define SEGMENT_SELECTOR_RESERVED_BITS                               0x00
 
 /**
  * @}
@@ -5737,6 +7486,7 @@ typedef union {
 
   uint64_t Flags;
 } vmx_exit_qualification_debug_exception;
+#define VMX_EXIT_QUALIFICATION_DEBUG_EXCEPTION_RESERVED_BITS         0xFFFFFFFFFFFF9FF0
 
 typedef union {
   struct {
@@ -5754,6 +7504,7 @@ typedef union {
 
   uint64_t Flags;
 } vmx_exit_qualification_task_switch;
+#define VMX_EXIT_QUALIFICATION_TASK_SWITCH_RESERVED_BITS             0xFFFFFFFF3FFF0000
 
 typedef union {
   struct {
@@ -5793,6 +7544,7 @@ typedef union {
 #define VMX_EXIT_QUALIFICATION_GENREG_R13                            0x0000000D
 #define VMX_EXIT_QUALIFICATION_GENREG_R14                            0x0000000E
 #define VMX_EXIT_QUALIFICATION_GENREG_R15                            0x0000000F
+#define VMX_EXIT_QUALIFICATION_GENREG_OFFSET(_)                      ((((_) >> 8) & 0x0F) << 3)
     uint64_t reserved_2                                              : 4;
     uint64_t lmsw_source_data                                        : 16;
 #define VMX_EXIT_QUALIFICATION_CR_ACCESS_LMSW_SOURCE_DATA            0xFFFF0000
@@ -5801,6 +7553,7 @@ typedef union {
 
   uint64_t Flags;
 } vmx_exit_qualification_cr_access;
+#define VMX_EXIT_QUALIFICATION_CR_ACCESS_RESERVED_BITS               0xFFFFFFFF0000F080
 
 typedef union {
   struct {
@@ -5825,6 +7578,7 @@ typedef union {
 
   uint64_t Flags;
 } vmx_exit_qualification_dr_access;
+#define VMX_EXIT_QUALIFICATION_DR_ACCESS_RESERVED_BITS               0xFFFFFFFFFFFFF0E8
 
 typedef union {
   struct {
@@ -5833,6 +7587,7 @@ typedef union {
 #define VMX_EXIT_QUALIFICATION_WIDTH_1B                              0x00000000
 #define VMX_EXIT_QUALIFICATION_WIDTH_2B                              0x00000001
 #define VMX_EXIT_QUALIFICATION_WIDTH_4B                              0x00000003
+#define VMX_EXIT_QUALIFICATION_WIDTH_BYTES(_)                        (((_) & 0x07) + 1)
     uint64_t direction_of_access                                     : 1;
 #define VMX_EXIT_QUALIFICATION_IO_INST_DIRECTION_OF_ACCESS           0x08
 #define VMX_EXIT_QUALIFICATION_DIRECTION_OUT                         0x00000000
@@ -5857,6 +7612,7 @@ typedef union {
 
   uint64_t Flags;
 } vmx_exit_qualification_io_inst;
+#define VMX_EXIT_QUALIFICATION_IO_INST_RESERVED_BITS                 0xFFFFFFFF0000FF80
 
 typedef union {
   struct {
@@ -5875,6 +7631,7 @@ typedef union {
 
   uint64_t Flags;
 } vmx_exit_qualification_apic_access;
+#define VMX_EXIT_QUALIFICATION_APIC_ACCESS_RESERVED_BITS             0xFFFFFFFFFFFF0000
 
 typedef union {
   struct {
@@ -5917,6 +7674,23 @@ typedef union {
 
   uint64_t Flags;
 } vmx_exit_qualification_ept_violation;
+#define VMX_EXIT_QUALIFICATION_EPT_VIOLATION_RESERVED_BITS           0xFFFFFFFFFFFE0000
+
+#define VMX_EXIT_QUALIFICATION_EPT_VIOLATION_INDEX_COUNT             0x00000100
+#define VMX_EXIT_QUALIFICATION_EPT_VIOLATION_INDEX(_)                (((_) & (VMX_EXIT_QUALIFICATION_EPT_VIOLATION_DATA_READ | VMX_EXIT_QUALIFICATION_EPT_VIOLATION_DATA_WRITE | VMX_EXIT_QUALIFICATION_EPT_VIOLATION_INSTRUCTION_FETCH | VMX_EXIT_QUALIFICATION_EPT_VIOLATION_ENTRY_PRESENT | VMX_EXIT_QUALIFICATION_EPT_VIOLATION_ENTRY_WRITE | VMX_EXIT_QUALIFICATION_EPT_VIOLATION_ENTRY_EXECUTE)) | (((_) & (VMX_EXIT_QUALIFICATION_EPT_VIOLATION_VALID_GUEST_LINEAR_ADDRESS | VMX_EXIT_QUALIFICATION_EPT_VIOLATION_EPT_TRANSLATED_ACCESS)) >> 1))
+#define VMX_EXIT_QUALIFICATION_EPT_VIOLATION_DENIED(_)               ((_) & ~((_) >> 3) & (VMX_EXIT_QUALIFICATION_EPT_VIOLATION_DATA_READ | VMX_EXIT_QUALIFICATION_EPT_VIOLATION_DATA_WRITE | VMX_EXIT_QUALIFICATION_EPT_VIOLATION_INSTRUCTION_FETCH))
+/**
+ * @defgroup vmx_exit_qualification_entry_failure \
+ *           Exit Qualification for VM-Entry Failures During or After Loading Guest State
+ * @{
+ */
+#define VMX_EXIT_QUALIFICATION_ENTRY_FAILURE_NOT_USED                0x00000000
+#define VMX_EXIT_QUALIFICATION_ENTRY_FAILURE_PDPTE_LOAD              0x00000002
+#define VMX_EXIT_QUALIFICATION_ENTRY_FAILURE_NMI_INJECTION           0x00000003
+#define VMX_EXIT_QUALIFICATION_ENTRY_FAILURE_INVALID_VMCS_LINK_POINTER 0x00000004
+/**
+ * @}
+ */
 
 /**
  * @}
@@ -5940,6 +7714,7 @@ typedef union {
 
   uint64_t Flags;
 } vmx_vmexit_instruction_info_ins_outs;
+#define VMX_VMEXIT_INSTRUCTION_INFO_INS_OUTS_RESERVED_BITS           0xFFFFFFFFFFFC7C7F
 
 typedef union {
   struct {
@@ -5966,6 +7741,7 @@ typedef union {
 
   uint64_t Flags;
 } vmx_vmexit_instruction_info_invalidate;
+#define VMX_VMEXIT_INSTRUCTION_INFO_INVALIDATE_RESERVED_BITS         0xFFFFFFFF00007C7C
 
 typedef union {
   struct {
@@ -5995,6 +7771,7 @@ typedef union {
 
   uint64_t Flags;
 } vmx_vmexit_instruction_info_gdtr_idtr_access;
+#define VMX_VMEXIT_INSTRUCTION_INFO_GDTR_IDTR_ACCESS_RESERVED_BITS   0xFFFFFFFFC000747C
 
 typedef union {
   struct {
@@ -6025,6 +7802,7 @@ typedef union {
 
   uint64_t Flags;
 } vmx_vmexit_instruction_info_ldtr_tr_access;
+#define VMX_VMEXIT_INSTRUCTION_INFO_LDTR_TR_ACCESS_RESERVED_BITS     0xFFFFFFFFC0007804
 
 typedef union {
   struct {
@@ -6039,6 +7817,7 @@ typedef union {
 
   uint64_t Flags;
 } vmx_vmexit_instruction_info_rdrand_rdseed;
+#define VMX_VMEXIT_INSTRUCTION_INFO_RDRAND_RDSEED_RESERVED_BITS      0xFFFFFFFFFFFFE787
 
 typedef union {
   struct {
@@ -6063,6 +7842,7 @@ typedef union {
 
   uint64_t Flags;
 } vmx_vmexit_instruction_info_vmx_and_xsaves;
+#define VMX_VMEXIT_INSTRUCTION_INFO_VMX_AND_XSAVES_RESERVED_BITS     0xFFFFFFFFF0007C7C
 
 typedef union {
   struct {
@@ -6093,7 +7873,15 @@ typedef union {
 
   uint64_t Flags;
 } vmx_vmexit_instruction_info_vmread_vmwrite;
+#define VMX_VMEXIT_INSTRUCTION_INFO_VMREAD_VMWRITE_RESERVED_BITS     0xFFFFFFFF00007804
 
+#define VMX_VMEXIT_INSTRUCTION_INFO_SCALE(_)                         (1 << ((_) & 0x03))
+#define VMX_VMEXIT_INSTRUCTION_INFO_ADDRESS_SIZE_BYTES(_)            (2 << (((_) >> 7) & 0x07))
+#define VMX_VMEXIT_INSTRUCTION_INFO_ADDRESS_MASK(_)                  (0xFFFFFFFFFFFFFFFF >> (64 - (16 << (((_) >> 7) & 0x07))))
+#define VMX_VMEXIT_INSTRUCTION_INFO_INDEX_VALUE(_, _gpr)             ((_gpr)[((_) >> 18) & 0x0F] * ((((_) >> 22) & 0x01) ^ 0x01))
+#define VMX_VMEXIT_INSTRUCTION_INFO_BASE_VALUE(_, _gpr)              ((_gpr)[((_) >> 23) & 0x0F] * ((((_) >> 27) & 0x01) ^ 0x01))
+#define VMX_VMEXIT_INSTRUCTION_INFO_EFFECTIVE_ADDRESS(_, _displacement, _gpr) ((VMX_VMEXIT_INSTRUCTION_INFO_BASE_VALUE(_, _gpr) + (VMX_VMEXIT_INSTRUCTION_INFO_INDEX_VALUE(_, _gpr) << ((_) & 0x03)) + (_displacement)) & VMX_VMEXIT_INSTRUCTION_INFO_ADDRESS_MASK(_))
+#define VMX_VMEXIT_INSTRUCTION_INFO_LINEAR_ADDRESS(_, _displacement, _gpr, _segment_base) ((_segment_base)[((_) >> 15) & 0x07] + VMX_VMEXIT_INSTRUCTION_INFO_EFFECTIVE_ADDRESS(_, _displacement, _gpr))
 /**
  * @}
  */
@@ -6124,6 +7912,19 @@ typedef union {
 
   uint32_t Flags;
 } vmx_segment_access_rights;
+#define VMX_SEGMENT_ACCESS_RIGHTS_RESERVED_BITS                      0xFFFE0F00
+
+/**
+ * @defgroup vmx_segment_state \
+ *           Decoding of guest segment state held in the guest-state area
+ * @{
+ */
+#define VMX_SEGMENT_CODE_SIZE(_)                                     (16 << (((((_) >> 13) & 0x01) << 1) | (((_) >> 14) & ~((_) >> 13) & 0x01)))
+#define VMX_SEGMENT_CPL(_)                                           (((_) >> 5) & 0x03)
+#define VMX_SEGMENT_USABLE(_)                                        ((((_) >> 16) & 0x01) ^ 0x01)
+/**
+ * @}
+ */
 
 typedef union {
   struct {
@@ -6142,6 +7943,7 @@ typedef union {
 
   uint32_t Flags;
 } vmx_interruptibility_state;
+#define VMX_INTERRUPTIBILITY_STATE_RESERVED_BITS                     0xFFFFFFE0
 
 #define VMX_ACTIVE                                                   0x00000000
 #define VMX_HLT                                                      0x00000001
@@ -6175,6 +7977,23 @@ typedef union {
 
   uint64_t Flags;
 } vmx_pending_debug_exceptions;
+#define VMX_PENDING_DEBUG_EXCEPTIONS_RESERVED_BITS                   0xFFFFFFFFFFFEAFF0
+
+/**
+ * @defgroup vmx_guest_state_checks \
+ *           Checks of the guest-state area performed by VM entry. Each check evaluates to 1 if the field passes it, so
+ *                     that results of all checks can be combined into a bitmap without branches
+ * @{
+ */
+#define VMX_GUEST_STATE_CR_VALID(_, _fixed0, _fixed1)                ((((_) | (_fixed0)) & (_fixed1)) == (_))
+#define VMX_GUEST_STATE_RFLAGS_VALID(_)                              ((((_) & RFL_RESERVED_BITS) == 0) & (((_) & RFL_READ_AS_1) != 0))
+#define VMX_GUEST_STATE_SEGMENT_ACCESS_RIGHTS_VALID(_)               ((((_) & VMX_SEGMENT_ACCESS_RIGHTS_UNUSABLE) != 0) | (((_) & VMX_SEGMENT_ACCESS_RIGHTS_RESERVED_BITS) == 0))
+#define VMX_GUEST_STATE_INTERRUPTIBILITY_STATE_VALID(_)              ((((_) & VMX_INTERRUPTIBILITY_STATE_RESERVED_BITS) == 0) & (((_) & (VMX_INTERRUPTIBILITY_STATE_BLOCKING_BY_STI | VMX_INTERRUPTIBILITY_STATE_BLOCKING_BY_MOV_SS)) != (VMX_INTERRUPTIBILITY_STATE_BLOCKING_BY_STI | VMX_INTERRUPTIBILITY_STATE_BLOCKING_BY_MOV_SS)))
+#define VMX_GUEST_STATE_ACTIVITY_STATE_VALID(_)                      ((_) <= 3)
+#define VMX_GUEST_STATE_PENDING_DEBUG_EXCEPTIONS_VALID(_)            (((_) & VMX_PENDING_DEBUG_EXCEPTIONS_RESERVED_BITS) == 0)
+/**
+ * @}
+ */
 
 /**
  * @}
@@ -6202,6 +8021,7 @@ typedef union {
 
   uint32_t Flags;
 } vmx_vmexit_reason;
+#define VMX_VMEXIT_REASON_RESERVED_BITS                              0x47FE0000
 
 typedef struct {
 #define IO_BITMAP_A_MIN                                              0x00000000
@@ -6247,6 +8067,8 @@ typedef union {
 
   uint64_t Flags;
 } eptp;
+#define EPTP_RESERVED_BITS                                           0xFFF0000000000F00
+#define EPTP_ADDRESS_BITS                                            0xFFFFFFFFFF000
 
 typedef union {
   struct {
@@ -6259,17 +8081,23 @@ typedef union {
     uint64_t reserved_1                                              : 5;
     uint64_t accessed                                                : 1;
 #define EPML4E_ACCESSED                                              0x100
-    uint64_t reserved_2                                              : 1;
+    uint64_t ignored_1                                               : 1;
+#define EPML4E_IGNORED_1                                             0x200
     uint64_t user_mode_execute                                       : 1;
 #define EPML4E_USER_MODE_EXECUTE                                     0x400
-    uint64_t reserved_3                                              : 1;
+    uint64_t ignored_2                                               : 1;
+#define EPML4E_IGNORED_2                                             0x800
     uint64_t page_frame_number                                       : 36;
 #define EPML4E_PAGE_FRAME_NUMBER                                     0xFFFFFFFFF000
-    uint64_t reserved_4                                              : 16;
+    uint64_t reserved_2                                              : 4;
+    uint64_t ignored_3                                               : 12;
+#define EPML4E_IGNORED_3                                             0xFFF0000000000000
   };
 
   uint64_t Flags;
 } epml4e;
+#define EPML4E_RESERVED_BITS                                         0xF8
+#define EPML4E_ADDRESS_BITS                                          0xFFFFFFFFFF000
 
 typedef union {
   struct {
@@ -6291,24 +8119,32 @@ typedef union {
 #define EPDPTE_1GB_DIRTY                                             0x200
     uint64_t user_mode_execute                                       : 1;
 #define EPDPTE_1GB_USER_MODE_EXECUTE                                 0x400
-    uint64_t reserved_1                                              : 19;
+    uint64_t ignored_1                                               : 1;
+#define EPDPTE_1GB_IGNORED_1                                         0x800
+    uint64_t reserved_1                                              : 18;
     uint64_t page_frame_number                                       : 18;
 #define EPDPTE_1GB_PAGE_FRAME_NUMBER                                 0xFFFFC0000000
-    uint64_t reserved_2                                              : 9;
+    uint64_t reserved_2                                              : 4;
+    uint64_t ignored_2                                               : 5;
+#define EPDPTE_1GB_IGNORED_2                                         0x1F0000000000000
     uint64_t verify_guest_paging                                     : 1;
 #define EPDPTE_1GB_VERIFY_GUEST_PAGING                               0x200000000000000
     uint64_t paging_write_access                                     : 1;
 #define EPDPTE_1GB_PAGING_WRITE_ACCESS                               0x400000000000000
-    uint64_t reserved_3                                              : 1;
+    uint64_t ignored_3                                               : 1;
+#define EPDPTE_1GB_IGNORED_3                                         0x800000000000000
     uint64_t supervisor_shadow_stack                                 : 1;
 #define EPDPTE_1GB_SUPERVISOR_SHADOW_STACK                           0x1000000000000000
-    uint64_t reserved_4                                              : 2;
+    uint64_t ignored_4                                               : 2;
+#define EPDPTE_1GB_IGNORED_4                                         0x6000000000000000
     uint64_t suppress_ve                                             : 1;
 #define EPDPTE_1GB_SUPPRESS_VE                                       0x8000000000000000
   };
 
   uint64_t Flags;
 } epdpte_1gb;
+#define EPDPTE_1GB_RESERVED_BITS                                     0x3FFFF000
+#define EPDPTE_1GB_ADDRESS_BITS                                      0xFFFFFC0000000
 
 typedef union {
   struct {
@@ -6321,17 +8157,23 @@ typedef union {
     uint64_t reserved_1                                              : 5;
     uint64_t accessed                                                : 1;
 #define EPDPTE_ACCESSED                                              0x100
-    uint64_t reserved_2                                              : 1;
+    uint64_t ignored_1                                               : 1;
+#define EPDPTE_IGNORED_1                                             0x200
     uint64_t user_mode_execute                                       : 1;
 #define EPDPTE_USER_MODE_EXECUTE                                     0x400
-    uint64_t reserved_3                                              : 1;
+    uint64_t ignored_2                                               : 1;
+#define EPDPTE_IGNORED_2                                             0x800
     uint64_t page_frame_number                                       : 36;
 #define EPDPTE_PAGE_FRAME_NUMBER                                     0xFFFFFFFFF000
-    uint64_t reserved_4                                              : 16;
+    uint64_t reserved_2                                              : 4;
+    uint64_t ignored_3                                               : 12;
+#define EPDPTE_IGNORED_3                                             0xFFF0000000000000
   };
 
   uint64_t Flags;
 } epdpte;
+#define EPDPTE_RESERVED_BITS                                         0xF8
+#define EPDPTE_ADDRESS_BITS                                          0xFFFFFFFFFF000
 
 typedef union {
   struct {
@@ -6353,24 +8195,32 @@ typedef union {
 #define EPDE_2MB_DIRTY                                               0x200
     uint64_t user_mode_execute                                       : 1;
 #define EPDE_2MB_USER_MODE_EXECUTE                                   0x400
-    uint64_t reserved_1                                              : 10;
+    uint64_t ignored_1                                               : 1;
+#define EPDE_2MB_IGNORED_1                                           0x800
+    uint64_t reserved_1                                              : 9;
     uint64_t page_frame_number                                       : 27;
 #define EPDE_2MB_PAGE_FRAME_NUMBER                                   0xFFFFFFE00000
-    uint64_t reserved_2                                              : 9;
+    uint64_t reserved_2                                              : 4;
+    uint64_t ignored_2                                               : 5;
+#define EPDE_2MB_IGNORED_2                                           0x1F0000000000000
     uint64_t verify_guest_paging                                     : 1;
 #define EPDE_2MB_VERIFY_GUEST_PAGING                                 0x200000000000000
     uint64_t paging_write_access                                     : 1;
 #define EPDE_2MB_PAGING_WRITE_ACCESS                                 0x400000000000000
-    uint64_t reserved_3                                              : 1;
+    uint64_t ignored_3                                               : 1;
+#define EPDE_2MB_IGNORED_3                                           0x800000000000000
     uint64_t supervisor_shadow_stack                                 : 1;
 #define EPDE_2MB_SUPERVISOR_SHADOW_STACK                             0x1000000000000000
-    uint64_t reserved_4                                              : 2;
+    uint64_t ignored_4                                               : 2;
+#define EPDE_2MB_IGNORED_4                                           0x6000000000000000
     uint64_t suppress_ve                                             : 1;
 #define EPDE_2MB_SUPPRESS_VE                                         0x8000000000000000
   };
 
   uint64_t Flags;
 } epde_2mb;
+#define EPDE_2MB_RESERVED_BITS                                       0x1FF000
+#define EPDE_2MB_ADDRESS_BITS                                        0xFFFFFFFE00000
 
 typedef union {
   struct {
@@ -6383,17 +8233,23 @@ typedef union {
     uint64_t reserved_1                                              : 5;
     uint64_t accessed                                                : 1;
 #define EPDE_ACCESSED                                                0x100
-    uint64_t reserved_2                                              : 1;
+    uint64_t ignored_1                                               : 1;
+#define EPDE_IGNORED_1                                               0x200
     uint64_t user_mode_execute                                       : 1;
 #define EPDE_USER_MODE_EXECUTE                                       0x400
-    uint64_t reserved_3                                              : 1;
+    uint64_t ignored_2                                               : 1;
+#define EPDE_IGNORED_2                                               0x800
     uint64_t page_frame_number                                       : 36;
 #define EPDE_PAGE_FRAME_NUMBER                                       0xFFFFFFFFF000
-    uint64_t reserved_4                                              : 16;
+    uint64_t reserved_2                                              : 4;
+    uint64_t ignored_3                                               : 12;
+#define EPDE_IGNORED_3                                               0xFFF0000000000000
   };
 
   uint64_t Flags;
 } epde;
+#define EPDE_RESERVED_BITS                                           0xF8
+#define EPDE_ADDRESS_BITS                                            0xFFFFFFFFFF000
 
 typedef union {
   struct {
@@ -6407,33 +8263,41 @@ typedef union {
 #define EPTE_MEMORY_TYPE                                             0x38
     uint64_t ignore_pat                                              : 1;
 #define EPTE_IGNORE_PAT                                              0x40
-    uint64_t reserved_1                                              : 1;
+    uint64_t ignored_1                                               : 1;
+#define EPTE_IGNORED_1                                               0x80
     uint64_t accessed                                                : 1;
 #define EPTE_ACCESSED                                                0x100
     uint64_t dirty                                                   : 1;
 #define EPTE_DIRTY                                                   0x200
     uint64_t user_mode_execute                                       : 1;
 #define EPTE_USER_MODE_EXECUTE                                       0x400
-    uint64_t reserved_2                                              : 1;
+    uint64_t ignored_2                                               : 1;
+#define EPTE_IGNORED_2                                               0x800
     uint64_t page_frame_number                                       : 36;
 #define EPTE_PAGE_FRAME_NUMBER                                       0xFFFFFFFFF000
-    uint64_t reserved_3                                              : 9;
+    uint64_t reserved_1                                              : 4;
+    uint64_t ignored_3                                               : 5;
+#define EPTE_IGNORED_3                                               0x1F0000000000000
     uint64_t verify_guest_paging                                     : 1;
 #define EPTE_VERIFY_GUEST_PAGING                                     0x200000000000000
     uint64_t paging_write_access                                     : 1;
 #define EPTE_PAGING_WRITE_ACCESS                                     0x400000000000000
-    uint64_t reserved_4                                              : 1;
+    uint64_t ignored_4                                               : 1;
+#define EPTE_IGNORED_4                                               0x800000000000000
     uint64_t supervisor_shadow_stack                                 : 1;
 #define EPTE_SUPERVISOR_SHADOW_STACK                                 0x1000000000000000
     uint64_t sub_page_write_permissions                              : 1;
 #define EPTE_SUB_PAGE_WRITE_PERMISSIONS                              0x2000000000000000
-    uint64_t reserved_5                                              : 1;
+    uint64_t ignored_5                                               : 1;
+#define EPTE_IGNORED_5                                               0x4000000000000000
     uint64_t suppress_ve                                             : 1;
 #define EPTE_SUPPRESS_VE                                             0x8000000000000000
   };
 
   uint64_t Flags;
 } epte;
+#define EPTE_RESERVED_BITS                                           0x00
+#define EPTE_ADDRESS_BITS                                            0xFFFFFFFFFF000
 
 typedef union {
   struct {
@@ -6455,16 +8319,21 @@ typedef union {
 #define EPT_ENTRY_DIRTY                                              0x200
     uint64_t user_mode_execute                                       : 1;
 #define EPT_ENTRY_USER_MODE_EXECUTE                                  0x400
-    uint64_t reserved_1                                              : 1;
+    uint64_t ignored_1                                               : 1;
+#define EPT_ENTRY_IGNORED_1                                          0x800
     uint64_t page_frame_number                                       : 36;
 #define EPT_ENTRY_PAGE_FRAME_NUMBER                                  0xFFFFFFFFF000
-    uint64_t reserved_2                                              : 15;
+    uint64_t reserved_1                                              : 4;
+    uint64_t ignored_2                                               : 11;
+#define EPT_ENTRY_IGNORED_2                                          0x7FF0000000000000
     uint64_t suppress_ve                                             : 1;
 #define EPT_ENTRY_SUPPRESS_VE                                        0x8000000000000000
   };
 
   uint64_t Flags;
 } ept_entry;
+#define EPT_ENTRY_RESERVED_BITS                                      0x00
+#define EPT_ENTRY_ADDRESS_BITS                                       0xFFFFFFFFFF000
 
 /**
  * @defgroup ept_table_level \
@@ -6492,6 +8361,40 @@ typedef union {
  * @}
  */
 
+/**
+ * @defgroup ept_permission \
+ *           EPT permission masks
+ * @{
+ */
+#define EPT_PERMISSION_READ                                          0x00000001
+#define EPT_PERMISSION_WRITE                                         0x00000002
+#define EPT_PERMISSION_EXECUTE                                       0x00000004
+#define EPT_PERMISSION_USER_MODE_EXECUTE                             0x00000400
+#define EPT_PERMISSION_READ_WRITE_EXECUTE                            0x00000007
+#define EPT_PERMISSION_ALL                                           0x00000407
+#define EPT_PERMISSION_UPDATE(_, _and, _or)                          (((_) & (_and)) | (_or))
+#define EPT_PERMISSION_CHANGED(_, _and, _or)                         ((((_) & (_and)) | (_or)) ^ (_))
+/**
+ * @}
+ */
+
+/**
+ * @defgroup page_modification_log \
+ *           Page-Modification Logging
+ * @{
+ */
+#define PML_ENTRY_COUNT                                              0x00000200
+#define PML_INDEX_INITIAL                                            0x000001FF
+#define PML_ENTRY_ADDRESS_MASK                                       0xFFFFFFFFFFFFF000
+#define PML_FIRST_ENTRY(_)                                           (((_) + 1) & 0xFFFF)
+#define PML_ENTRY_USED_COUNT(_)                                      ((0x01FF - (_)) & 0xFFFF)
+#define PML_BITMAP_INDEX(_)                                          ((_) >> 18)
+#define PML_BITMAP_BIT(_)                                            (1ULL << (((_) >> 12) & 0x3F))
+#define PML_ACCESSED_DIRTY_MASK                                      0x00000300
+/**
+ * @}
+ */
+
 /**
  * @}
  */
@@ -6522,6 +8425,29 @@ typedef struct {
   uint64_t linear_address;
 } invvpid_descriptor;
 
+/**
+ * @defgroup vpid \
+ *           Virtual-processor identifier limits
+ * @{
+ */
+#define VPID_HOST                                                    0x00000000
+#define VPID_MIN                                                     0x00000001
+#define VPID_MAX                                                     0x0000FFFF
+/**
+ * @}
+ */
+
+/**
+ * @defgroup invalidation_type_support \
+ *           Supported invalidation types
+ * @{
+ */
+#define INVEPT_TYPE_SUPPORTED(_, _type)                              (((_) >> (24 + (_type))) & 0x01)
+#define INVVPID_TYPE_SUPPORTED(_, _type)                             (((_) >> (40 + (_type))) & 0x01)
+/**
+ * @}
+ */
+
 typedef union {
   struct {
     uint64_t reserved_1                                              : 3;
@@ -6537,6 +8463,8 @@ typedef union {
 
   uint64_t Flags;
 } hlatp;
+#define HLATP_RESERVED_BITS                                          0xFFF0000000000FE7
+#define HLATP_ADDRESS_BITS                                           0xFFFFFFFFFF000
 
 typedef struct {
   struct {
@@ -6579,6 +8507,7 @@ typedef union {
 
   uint16_t Flags;
 } vmcs_component_encoding;
+#define VMCS_COMPONENT_ENCODING_RESERVED_BITS                        0x9000
 
 /**
  * @defgroup vmcs_16_bit \
@@ -6931,6 +8860,30 @@ typedef union {
  * @}
  */
 
+/**
+ * @defgroup vmcs_guest_segment \
+ *           Encodings of guest segment register fields indexed by segment register
+ * @{
+ */
+#define VMCS_GUEST_SEGMENT_ES                                        0x00000000
+#define VMCS_GUEST_SEGMENT_CS                                        0x00000001
+#define VMCS_GUEST_SEGMENT_SS                                        0x00000002
+#define VMCS_GUEST_SEGMENT_DS                                        0x00000003
+#define VMCS_GUEST_SEGMENT_FS                                        0x00000004
+#define VMCS_GUEST_SEGMENT_GS                                        0x00000005
+#define VMCS_GUEST_SEGMENT_LDTR                                      0x00000006
+#define VMCS_GUEST_SEGMENT_TR                                        0x00000007
+#define VMCS_GUEST_SEGMENT_COUNT                                     0x00000008
+#define VMCS_GUEST_SEGMENT_SELECTOR(_)                               (0x0800 + ((_) << 1))
+#define VMCS_GUEST_SEGMENT_LIMIT(_)                                  (0x4800 + ((_) << 1))
+#define VMCS_GUEST_SEGMENT_ACCESS_RIGHTS(_)                          (0x4814 + ((_) << 1))
+#define VMCS_GUEST_SEGMENT_BASE(_)                                   (0x6806 + ((_) << 1))
+#define VMCS_GUEST_SEGMENT_FLAG(_)                                   (1 << (_))
+#define VMCS_GUEST_SEGMENT_ALL_FLAGS                                 0x000000FF
+/**
+ * @}
+ */
+
 /**
  * @}
  */
@@ -6961,6 +8914,18 @@ typedef union {
 
   uint32_t Flags;
 } vmentry_interrupt_info;
+#define VMENTRY_INTERRUPT_INFO_RESERVED_BITS                         0x7FFFF000
+
+/**
+ * @defgroup vmentry_interrupt_information_encoding \
+ *           Encoding of the VM-entry interruption-information field
+ * @{
+ */
+#define VMENTRY_INTERRUPT_INFORMATION_ENCODE(_vector, _type, _deliver_error_code) (((_vector) & 0xFF) | (((_type) & 0x07) << 8) | (((_deliver_error_code) & 0x01) << 11) | 0x80000000)
+#define VMENTRY_INTERRUPT_INFORMATION_FROM_VECTOR(_)                 VMENTRY_INTERRUPT_INFORMATION_ENCODE(_, EXCEPTION_VECTOR_INTERRUPTION_TYPE(_), EXCEPTION_VECTOR_HAS_ERROR_CODE(_))
+/**
+ * @}
+ */
 
 typedef union {
   struct {
@@ -6979,6 +8944,18 @@ typedef union {
 
   uint32_t Flags;
 } vmexit_interrupt_info;
+#define VMEXIT_INTERRUPT_INFO_RESERVED_BITS                          0x7FFFE000
+
+/**
+ * @defgroup vmexit_interrupt_information_merging \
+ *           Merging of events whose delivery caused a VM exit with a new exception
+ * @{
+ */
+#define VMEXIT_INTERRUPT_INFORMATION_EXCEPTION_VECTOR(_)             ((((_) & 0x80000700) == 0x80000300) ? ((_) & 0xFF) : 0x100)
+#define VMEXIT_INTERRUPT_INFORMATION_MERGE(_, _vector)               (EXCEPTION_VECTOR_MERGE(VMEXIT_INTERRUPT_INFORMATION_EXCEPTION_VECTOR(_), _vector) == EXCEPTION_VECTOR_MERGE_DOUBLE_FAULT ? VMENTRY_INTERRUPT_INFORMATION_ENCODE(8, 3, 1) : EXCEPTION_VECTOR_MERGE(VMEXIT_INTERRUPT_INFORMATION_EXCEPTION_VECTOR(_), _vector) == EXCEPTION_VECTOR_MERGE_TRIPLE_FAULT ? 0 : VMENTRY_INTERRUPT_INFORMATION_FROM_VECTOR(_vector))
+/**
+ * @}
+ */
 
 /**
  * @}
@@ -7037,6 +9014,13 @@ typedef union {
 #define APIC_INITIAL_COUNT                                           0x00000380
 #define APIC_CURRENT_COUNT                                           0x00000390
 #define APIC_DIVIDE_CONFIGURATION                                    0x000003E0
+#define APIC_REGISTER_STRIDE                                         0x00000010
+#define APIC_VECTOR_REGISTER_OFFSET(_, _vector)                      ((_) + (((_vector) >> 5) << 4))
+#define APIC_VECTOR_BIT(_vector)                                     (1U << ((_vector) & 0x1F))
+#define APIC_VECTOR(_register, _bit)                                 (((_register) << 5) | (_bit))
+#define APIC_PRIORITY_CLASS(_)                                       (((_) >> 4) & 0x0F)
+#define APIC_PPR_VALUE(_tpr, _isrv)                                  ((((_tpr) & 0xFF) * (((_tpr) & 0xF0) >= ((_isrv) & 0xF0))) | (((_isrv) & 0xF0) * (((_tpr) & 0xF0) < ((_isrv) & 0xF0))))
+#define APIC_INTERRUPT_ACCEPTED(_vector, _ppr)                       (((_vector) & 0xF0) > ((_ppr) & 0xF0))
 /**
  * @}
  */
@@ -7087,6 +9071,7 @@ typedef union {
 
   uint32_t Flags;
 } efl;
+#define EFL_RESERVED_BITS                                            0xFFC08028
 
 typedef union {
   struct {
@@ -7134,6 +9119,7 @@ typedef union {
 
   uint64_t Flags;
 } rfl;
+#define RFL_RESERVED_BITS                                            0xFFFFFFFFFFC08028
 
 /**
  * @defgroup exceptions \
@@ -7151,6 +9137,7 @@ typedef union {
 
   uint32_t Flags;
 } control_protection_exception;
+#define CONTROL_PROTECTION_EXCEPTION_RESERVED_BITS                   0xFFFF0000
 
 #define DIVIDE_ERROR                                                 0x00000000
 #define DEBUG                                                        0x00000001
@@ -7177,6 +9164,30 @@ typedef union {
  * @}
  */
 
+/**
+ * @defgroup exception_vector_properties \
+ *           Properties of exception vectors needed for event delivery and injection
+ * @{
+ */
+#define EXCEPTION_VECTOR_ERROR_CODE_MASK                             0x00227D00
+#define EXCEPTION_VECTOR_CONTRIBUTORY_MASK                           0x00203C01
+#define EXCEPTION_VECTOR_PAGE_FAULT_MASK                             0x00104000
+#define EXCEPTION_VECTOR_SOFTWARE_EXCEPTION_MASK                     0x00000018
+#define EXCEPTION_VECTOR_CLASS_BENIGN                                0x00000000
+#define EXCEPTION_VECTOR_CLASS_CONTRIBUTORY                          0x00000001
+#define EXCEPTION_VECTOR_CLASS_PAGE_FAULT                            0x00000002
+#define EXCEPTION_VECTOR_HAS_ERROR_CODE(_)                           (((EXCEPTION_VECTOR_ERROR_CODE_MASK >> ((_) & 0x1F)) & 0x01) & ((_) < 32))
+#define EXCEPTION_VECTOR_CLASS(_)                                    (((((EXCEPTION_VECTOR_CONTRIBUTORY_MASK >> ((_) & 0x1F)) & 0x01) | (((EXCEPTION_VECTOR_PAGE_FAULT_MASK >> ((_) & 0x1F)) & 0x01) << 1))) * ((_) < 32))
+#define EXCEPTION_VECTOR_INTERRUPTION_TYPE(_)                        ((3 ^ ((_) == 2) ^ (((EXCEPTION_VECTOR_SOFTWARE_EXCEPTION_MASK >> ((_) & 0x1F)) & 0x01) * 5)) * ((_) < 32))
+#define EXCEPTION_VECTOR_MERGE_TABLE                                 0x00000190
+#define EXCEPTION_VECTOR_MERGE_SERIAL                                0x00000000
+#define EXCEPTION_VECTOR_MERGE_DOUBLE_FAULT                          0x00000001
+#define EXCEPTION_VECTOR_MERGE_TRIPLE_FAULT                          0x00000002
+#define EXCEPTION_VECTOR_MERGE(_first, _second)                      (((EXCEPTION_VECTOR_MERGE_TABLE >> (EXCEPTION_VECTOR_CLASS(_first) * 3 + EXCEPTION_VECTOR_CLASS(_second))) & 0x01) | ((((_first) == 8) & (EXCEPTION_VECTOR_CLASS(_second) != 0)) << 1))
+/**
+ * @}
+ */
+
 typedef union {
   struct {
     uint32_t external_event                                          : 1;
@@ -7192,6 +9203,7 @@ typedef union {
 
   uint32_t Flags;
 } exception_error_code;
+#define EXCEPTION_ERROR_CODE_RESERVED_BITS                           0xFFFF0000
 
 typedef union {
   struct {
@@ -7219,6 +9231,7 @@ typedef union {
 
   uint32_t Flags;
 } page_fault_exception;
+#define PAGE_FAULT_EXCEPTION_RESERVED_BITS                           0xFFFF7F00
 
 /**
  * @}
@@ -7240,6 +9253,69 @@ typedef union {
  * @}
  */
 
+/**
+ * @defgroup intel_pt \
+ *           Intel Processor Trace
+ * @{
+ */
+typedef union {
+  struct {
+    uint64_t end                                                     : 1;
+#define TOPA_ENTRY_END                                               0x01
+    uint64_t reserved_1                                              : 1;
+    uint64_t interrupt                                               : 1;
+#define TOPA_ENTRY_INTERRUPT                                         0x04
+    uint64_t reserved_2                                              : 1;
+    uint64_t stop                                                    : 1;
+#define TOPA_ENTRY_STOP                                              0x10
+    uint64_t reserved_3                                              : 1;
+    uint64_t size                                                    : 4;
+#define TOPA_ENTRY_SIZE                                              0x3C0
+#define TOPA_ENTRY_SIZE_4K                                           0x00000000
+#define TOPA_ENTRY_SIZE_8K                                           0x00000001
+#define TOPA_ENTRY_SIZE_16K                                          0x00000002
+#define TOPA_ENTRY_SIZE_32K                                          0x00000003
+#define TOPA_ENTRY_SIZE_64K                                          0x00000004
+#define TOPA_ENTRY_SIZE_128K                                         0x00000005
+#define TOPA_ENTRY_SIZE_256K                                         0x00000006
+#define TOPA_ENTRY_SIZE_512K                                         0x00000007
+#define TOPA_ENTRY_SIZE_1M                                           0x00000008
+#define TOPA_ENTRY_SIZE_2M                                           0x00000009
+#define TOPA_ENTRY_SIZE_4M                                           0x0000000A
+#define TOPA_ENTRY_SIZE_8M                                           0x0000000B
+#define TOPA_ENTRY_SIZE_16M                                          0x0000000C
+#define TOPA_ENTRY_SIZE_32M                                          0x0000000D
+#define TOPA_ENTRY_SIZE_64M                                          0x0000000E
+#define TOPA_ENTRY_SIZE_128M                                         0x0000000F
+#define TOPA_ENTRY_SIZE_BYTES(_)                                     (4096ULL << (_))
+    uint64_t reserved_4                                              : 2;
+    uint64_t output_region_base_physical_address                     : 36;
+#define TOPA_ENTRY_OUTPUT_REGION_BASE_PHYSICAL_ADDRESS               0xFFFFFFFFF000
+    uint64_t reserved_5                                              : 16;
+  };
+
+  uint64_t Flags;
+} topa_entry;
+#define TOPA_ENTRY_RESERVED_BITS                                     0xFFF0000000000C2A
+#define TOPA_ENTRY_ADDRESS_BITS                                      0xFFFFFFFFFF000
+
+/**
+ * @defgroup topa_encoding \
+ *           ToPA table construction
+ * @{
+ */
+#define TOPA_ENTRY_COUNT                                             0x00000200
+#define TOPA_ENTRY_ENCODE(_address, _size, _flags)                   (((_address) & 0xFFFFFFFFFF000ULL) | (((_size) & 0x0FULL) << 6) | (_flags))
+#define TOPA_ENTRY_ENCODE_END(_)                                     (((_) & 0xFFFFFFFFFF000ULL) | 0x01)
+#define TOPA_OUTPUT_MASK_PTRS(_entry_index, _output_offset)          ((((_entry_index) & 0x1FFFFFFULL) << 7) | 0x7F | (((_output_offset) & 0xFFFFFFFFULL) << 32))
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
 /**
  * @defgroup vtd \
  *           VTD
@@ -7249,23 +9325,25 @@ typedef struct {
   union {
     struct {
       uint64_t present                                               : 1;
-#define VTD_Lower64_PRESENT                                          0x01
+#define VTD_ROOT_ENTRY_LOWER64_PRESENT                               0x01
       uint64_t reserved_1                                            : 11;
       uint64_t context_table_pointer                                 : 52;
-#define VTD_Lower64_CONTEXT_TABLE_POINTER                            0xFFFFFFFFFFFFF000
+#define VTD_ROOT_ENTRY_LOWER64_CONTEXT_TABLE_POINTER                 0xFFFFFFFFFFFFF000
     };
 
     uint64_t Flags;
   } lower64;
+#define VTD_ROOT_ENTRY_LOWER64_RESERVED_BITS                         0xFFE
 
   union {
     struct {
       uint64_t reserved                                              : 64;
-#define VTD_Upper64_RESERVED                                         0xFFFFFFFFFFFFFFFF
+#define VTD_ROOT_ENTRY_UPPER64_RESERVED                              0xFFFFFFFFFFFFFFFF
     };
 
     uint64_t Flags;
   } upper64;
+#define VTD_ROOT_ENTRY_UPPER64_RESERVED_BITS                         0xFFFFFFFFFFFFFFFF
 
 } vtd_root_entry;
 
@@ -7273,33 +9351,35 @@ typedef struct {
   union {
     struct {
       uint64_t present                                               : 1;
-#define VTD_Lower64_PRESENT                                          0x01
+#define VTD_CONTEXT_ENTRY_LOWER64_PRESENT                            0x01
       uint64_t fault_processing_disable                              : 1;
-#define VTD_Lower64_FAULT_PROCESSING_DISABLE                         0x02
+#define VTD_CONTEXT_ENTRY_LOWER64_FAULT_PROCESSING_DISABLE           0x02
       uint64_t translation_type                                      : 2;
-#define VTD_Lower64_TRANSLATION_TYPE                                 0x0C
+#define VTD_CONTEXT_ENTRY_LOWER64_TRANSLATION_TYPE                   0x0C
       uint64_t reserved_1                                            : 8;
       uint64_t second_level_page_translation_pointer                 : 52;
-#define VTD_Lower64_SECOND_LEVEL_PAGE_TRANSLATION_POINTER            0xFFFFFFFFFFFFF000
+#define VTD_CONTEXT_ENTRY_LOWER64_SECOND_LEVEL_PAGE_TRANSLATION_POINTER 0xFFFFFFFFFFFFF000
     };
 
     uint64_t Flags;
   } lower64;
+#define VTD_CONTEXT_ENTRY_LOWER64_RESERVED_BITS                      0xFF0
 
   union {
     struct {
       uint64_t address_width                                         : 3;
-#define VTD_Upper64_ADDRESS_WIDTH                                    0x07
+#define VTD_CONTEXT_ENTRY_UPPER64_ADDRESS_WIDTH                      0x07
       uint64_t ignored                                               : 4;
-#define VTD_Upper64_IGNORED                                          0x78
+#define VTD_CONTEXT_ENTRY_UPPER64_IGNORED                            0x78
       uint64_t reserved_1                                            : 1;
       uint64_t domain_identifier                                     : 10;
-#define VTD_Upper64_DOMAIN_IDENTIFIER                                0x3FF00
+#define VTD_CONTEXT_ENTRY_UPPER64_DOMAIN_IDENTIFIER                  0x3FF00
       uint64_t reserved_2                                            : 46;
     };
 
     uint64_t Flags;
   } upper64;
+#define VTD_CONTEXT_ENTRY_UPPER64_RESERVED_BITS                      0xFFFFFFFFFFFC0080
 
 } vtd_context_entry;
 
@@ -7310,6 +9390,54 @@ typedef struct {
  */
 #define VTD_ROOT_ENTRY_COUNT                                         0x00000100
 #define VTD_CONTEXT_ENTRY_COUNT                                      0x00000100
+#define VTD_SECOND_LEVEL_ENTRY_COUNT                                 0x00000200
+/**
+ * @}
+ */
+
+typedef union {
+  struct {
+    uint64_t read                                                    : 1;
+#define VTD_SECOND_LEVEL_PAGING_ENTRY_READ                           0x01
+    uint64_t write                                                   : 1;
+#define VTD_SECOND_LEVEL_PAGING_ENTRY_WRITE                          0x02
+    uint64_t execute                                                 : 1;
+#define VTD_SECOND_LEVEL_PAGING_ENTRY_EXECUTE                        0x04
+    uint64_t extended_memory_type                                    : 3;
+#define VTD_SECOND_LEVEL_PAGING_ENTRY_EXTENDED_MEMORY_TYPE           0x38
+    uint64_t ignore_pat                                              : 1;
+#define VTD_SECOND_LEVEL_PAGING_ENTRY_IGNORE_PAT                     0x40
+    uint64_t page_size                                               : 1;
+#define VTD_SECOND_LEVEL_PAGING_ENTRY_PAGE_SIZE                      0x80
+    uint64_t accessed                                                : 1;
+#define VTD_SECOND_LEVEL_PAGING_ENTRY_ACCESSED                       0x100
+    uint64_t dirty                                                   : 1;
+#define VTD_SECOND_LEVEL_PAGING_ENTRY_DIRTY                          0x200
+    uint64_t ignored_1                                               : 1;
+#define VTD_SECOND_LEVEL_PAGING_ENTRY_IGNORED_1                      0x400
+    uint64_t snoop                                                   : 1;
+#define VTD_SECOND_LEVEL_PAGING_ENTRY_SNOOP                          0x800
+    uint64_t address                                                 : 40;
+#define VTD_SECOND_LEVEL_PAGING_ENTRY_ADDRESS                        0xFFFFFFFFFF000
+    uint64_t ignored_2                                               : 11;
+#define VTD_SECOND_LEVEL_PAGING_ENTRY_IGNORED_2                      0x7FF0000000000000
+    uint64_t ignored_3                                               : 1;
+#define VTD_SECOND_LEVEL_PAGING_ENTRY_IGNORED_3                      0x8000000000000000
+  };
+
+  uint64_t Flags;
+} vtd_second_level_paging_entry;
+#define VTD_SECOND_LEVEL_PAGING_ENTRY_RESERVED_BITS                  0x00
+
+/**
+ * @defgroup vtd_second_level_paging \
+ *           Second-level paging helpers
+ * @{
+ */
+#define VTD_SECOND_LEVEL_LEVELS(_)                                   ((_) + 2)
+#define VTD_SECOND_LEVEL_ADDRESS_WIDTH(_)                            (30 + 9 * (_))
+#define VTD_SECOND_LEVEL_INDEX(_iova, _level)                        (((_iova) >> (3 + 9 * (_level))) & 0x1FF)
+#define VTD_SECOND_LEVEL_LARGE_PAGE_SUPPORTED(_, _level)             (((_) >> (32 + (_level))) & 0x01)
 /**
  * @}
  */
@@ -7326,6 +9454,7 @@ typedef union {
 
   uint32_t Flags;
 } vtd_version_register;
+#define VTD_VERSION_RESERVED_BITS                                    0xFFFFFF00
 
 #define VTD_CAPABILITY                                               0x00000008
 typedef union {
@@ -7382,6 +9511,7 @@ typedef union {
 
   uint64_t Flags;
 } vtd_capability_register;
+#define VTD_CAPABILITY_RESERVED_BITS                                 0x260000400000E000
 
 #define VTD_EXTENDED_CAPABILITY                                      0x00000010
 typedef union {
@@ -7457,6 +9587,7 @@ typedef union {
 
   uint64_t Flags;
 } vtd_extended_capability_register;
+#define VTD_EXTENDED_CAPABILITY_RESERVED_BITS                        0xFFCC0001880C0000
 
 #define VTD_GLOBAL_COMMAND                                           0x00000018
 typedef union {
@@ -7484,6 +9615,7 @@ typedef union {
 
   uint32_t Flags;
 } vtd_global_command_register;
+#define VTD_GLOBAL_COMMAND_RESERVED_BITS                             0x7FFFFF
 
 #define VTD_GLOBAL_STATUS                                            0x0000001C
 typedef union {
@@ -7511,6 +9643,7 @@ typedef union {
 
   uint32_t Flags;
 } vtd_global_status_register;
+#define VTD_GLOBAL_STATUS_RESERVED_BITS                              0x7FFFFF
 
 #define VTD_ROOT_TABLE_ADDRESS                                       0x00000020
 typedef union {
@@ -7524,6 +9657,7 @@ typedef union {
 
   uint64_t Flags;
 } vtd_root_table_address_register;
+#define VTD_ROOT_TABLE_ADDRESS_RESERVED_BITS                         0x3FF
 
 #define VTD_CONTEXT_COMMAND                                          0x00000028
 typedef union {
@@ -7545,6 +9679,61 @@ typedef union {
 
   uint64_t Flags;
 } vtd_context_command_register;
+#define VTD_CONTEXT_COMMAND_RESERVED_BITS                            0x7FFFFFC00000000
+
+#define VTD_INVALIDATION_QUEUE_HEAD                                  0x00000080
+typedef union {
+  struct {
+    uint64_t reserved_1                                              : 4;
+    uint64_t queue_head                                              : 15;
+#define VTD_INVALIDATION_QUEUE_HEAD_QUEUE_HEAD                       0x7FFF0
+    uint64_t reserved_2                                              : 45;
+  };
+
+  uint64_t Flags;
+} vtd_invalidation_queue_head_register;
+#define VTD_INVALIDATION_QUEUE_HEAD_RESERVED_BITS                    0xFFFFFFFFFFF8000F
+
+#define VTD_INVALIDATION_QUEUE_TAIL                                  0x00000088
+typedef union {
+  struct {
+    uint64_t reserved_1                                              : 4;
+    uint64_t queue_tail                                              : 15;
+#define VTD_INVALIDATION_QUEUE_TAIL_QUEUE_TAIL                       0x7FFF0
+    uint64_t reserved_2                                              : 45;
+  };
+
+  uint64_t Flags;
+} vtd_invalidation_queue_tail_register;
+#define VTD_INVALIDATION_QUEUE_TAIL_RESERVED_BITS                    0xFFFFFFFFFFF8000F
+
+#define VTD_INVALIDATION_QUEUE_ADDRESS                               0x00000090
+typedef union {
+  struct {
+    uint64_t queue_size                                              : 3;
+#define VTD_INVALIDATION_QUEUE_ADDRESS_QUEUE_SIZE                    0x07
+    uint64_t reserved_1                                              : 8;
+    uint64_t descriptor_width                                        : 1;
+#define VTD_INVALIDATION_QUEUE_ADDRESS_DESCRIPTOR_WIDTH              0x800
+    uint64_t invalidation_queue_base_address                         : 52;
+#define VTD_INVALIDATION_QUEUE_ADDRESS_INVALIDATION_QUEUE_BASE_ADDRESS 0xFFFFFFFFFFFFF000
+  };
+
+  uint64_t Flags;
+} vtd_invalidation_queue_address_register;
+#define VTD_INVALIDATION_QUEUE_ADDRESS_RESERVED_BITS                 0x7F8
+
+#define VTD_INVALIDATION_COMPLETION_STATUS                           0x0000009C
+typedef union {
+  struct {
+    uint32_t invalidation_wait_descriptor_complete                   : 1;
+#define VTD_INVALIDATION_COMPLETION_STATUS_INVALIDATION_WAIT_DESCRIPTOR_COMPLETE 0x01
+    uint32_t reserved_1                                              : 31;
+  };
+
+  uint32_t Flags;
+} vtd_invalidation_completion_status_register;
+#define VTD_INVALIDATION_COMPLETION_STATUS_RESERVED_BITS             0xFFFFFFFE
 
 #define VTD_INVALIDATE_ADDRESS                                       0x00000000
 typedef union {
@@ -7560,6 +9749,7 @@ typedef union {
 
   uint64_t Flags;
 } vtd_invalidate_address_register;
+#define VTD_INVALIDATE_ADDRESS_RESERVED_BITS                         0xF80
 
 #define VTD_IOTLB_INVALIDATE                                         0x00000008
 typedef union {
@@ -7584,6 +9774,157 @@ typedef union {
 
   uint64_t Flags;
 } vtd_iotlb_invalidate_register;
+#define VTD_IOTLB_INVALIDATE_RESERVED_BITS                           0x49FC0000FFFFFFFF
+
+/**
+ * @defgroup vtd_invalidation_descriptor_type \
+ *           Invalidation descriptor types
+ * @{
+ */
+#define VTD_INVALIDATION_DESCRIPTOR_CONTEXT_CACHE                    0x00000001
+#define VTD_INVALIDATION_DESCRIPTOR_IOTLB                            0x00000002
+#define VTD_INVALIDATION_DESCRIPTOR_DEVICE_TLB                       0x00000003
+#define VTD_INVALIDATION_DESCRIPTOR_WAIT                             0x00000005
+#define VTD_INVALIDATION_DESCRIPTOR_SIZE                             0x00000010
+#define VTD_INVALIDATION_DESCRIPTOR_COUNT(_)                         (0x100 << (_))
+#define VTD_INVALIDATION_DESCRIPTOR_NEXT(_, _qs)                     (((_) + 0x10) & ((0x1000 << (_qs)) - 1))
+/**
+ * @}
+ */
+
+typedef struct {
+  union {
+    struct {
+      uint64_t type                                                  : 4;
+#define VTD_CONTEXT_CACHE_INVALIDATE_DESCRIPTOR_LOWER64_TYPE         0x0F
+      uint64_t granularity                                           : 2;
+#define VTD_CONTEXT_CACHE_INVALIDATE_DESCRIPTOR_LOWER64_GRANULARITY  0x30
+      uint64_t reserved_1                                            : 10;
+      uint64_t domain_id                                             : 16;
+#define VTD_CONTEXT_CACHE_INVALIDATE_DESCRIPTOR_LOWER64_DOMAIN_ID    0xFFFF0000
+      uint64_t source_id                                             : 16;
+#define VTD_CONTEXT_CACHE_INVALIDATE_DESCRIPTOR_LOWER64_SOURCE_ID    0xFFFF00000000
+      uint64_t function_mask                                         : 2;
+#define VTD_CONTEXT_CACHE_INVALIDATE_DESCRIPTOR_LOWER64_FUNCTION_MASK 0x3000000000000
+      uint64_t reserved_2                                            : 14;
+    };
+
+    uint64_t Flags;
+  } lower64;
+#define VTD_CONTEXT_CACHE_INVALIDATE_DESCRIPTOR_LOWER64_RESERVED_BITS 0xFFFC00000000FFC0
+
+  uint64_t reserved;
+} vtd_context_cache_invalidate_descriptor;
+
+typedef struct {
+  union {
+    struct {
+      uint64_t type                                                  : 4;
+#define VTD_IOTLB_INVALIDATE_DESCRIPTOR_LOWER64_TYPE                 0x0F
+      uint64_t granularity                                           : 2;
+#define VTD_IOTLB_INVALIDATE_DESCRIPTOR_LOWER64_GRANULARITY          0x30
+      uint64_t drain_writes                                          : 1;
+#define VTD_IOTLB_INVALIDATE_DESCRIPTOR_LOWER64_DRAIN_WRITES         0x40
+      uint64_t drain_reads                                           : 1;
+#define VTD_IOTLB_INVALIDATE_DESCRIPTOR_LOWER64_DRAIN_READS          0x80
+      uint64_t reserved_1                                            : 8;
+      uint64_t domain_id                                             : 16;
+#define VTD_IOTLB_INVALIDATE_DESCRIPTOR_LOWER64_DOMAIN_ID            0xFFFF0000
+      uint64_t reserved_2                                            : 32;
+    };
+
+    uint64_t Flags;
+  } lower64;
+#define VTD_IOTLB_INVALIDATE_DESCRIPTOR_LOWER64_RESERVED_BITS        0xFFFFFFFF0000FF00
+
+  union {
+    struct {
+      uint64_t address_mask                                          : 6;
+#define VTD_IOTLB_INVALIDATE_DESCRIPTOR_UPPER64_ADDRESS_MASK         0x3F
+      uint64_t invalidation_hint                                     : 1;
+#define VTD_IOTLB_INVALIDATE_DESCRIPTOR_UPPER64_INVALIDATION_HINT    0x40
+      uint64_t reserved_1                                            : 5;
+      uint64_t page_address                                          : 52;
+#define VTD_IOTLB_INVALIDATE_DESCRIPTOR_UPPER64_PAGE_ADDRESS         0xFFFFFFFFFFFFF000
+    };
+
+    uint64_t Flags;
+  } upper64;
+#define VTD_IOTLB_INVALIDATE_DESCRIPTOR_UPPER64_RESERVED_BITS        0xF80
+
+} vtd_iotlb_invalidate_descriptor;
+
+typedef struct {
+  union {
+    struct {
+      uint64_t type                                                  : 4;
+#define VTD_DEVICE_TLB_INVALIDATE_DESCRIPTOR_LOWER64_TYPE            0x0F
+      uint64_t reserved_1                                            : 8;
+      uint64_t physical_function_source_id_low                       : 4;
+#define VTD_DEVICE_TLB_INVALIDATE_DESCRIPTOR_LOWER64_PHYSICAL_FUNCTION_SOURCE_ID_LOW 0xF000
+      uint64_t max_invalidations_pending                             : 5;
+#define VTD_DEVICE_TLB_INVALIDATE_DESCRIPTOR_LOWER64_MAX_INVALIDATIONS_PENDING 0x1F0000
+      uint64_t reserved_2                                            : 11;
+      uint64_t source_id                                             : 16;
+#define VTD_DEVICE_TLB_INVALIDATE_DESCRIPTOR_LOWER64_SOURCE_ID       0xFFFF00000000
+      uint64_t reserved_3                                            : 4;
+      uint64_t physical_function_source_id_high                      : 12;
+#define VTD_DEVICE_TLB_INVALIDATE_DESCRIPTOR_LOWER64_PHYSICAL_FUNCTION_SOURCE_ID_HIGH 0xFFF0000000000000
+    };
+
+    uint64_t Flags;
+  } lower64;
+#define VTD_DEVICE_TLB_INVALIDATE_DESCRIPTOR_LOWER64_RESERVED_BITS   0xF0000FFE00FF0
+
+  union {
+    struct {
+      uint64_t size                                                  : 1;
+#define VTD_DEVICE_TLB_INVALIDATE_DESCRIPTOR_UPPER64_SIZE            0x01
+      uint64_t reserved_1                                            : 11;
+      uint64_t page_address                                          : 52;
+#define VTD_DEVICE_TLB_INVALIDATE_DESCRIPTOR_UPPER64_PAGE_ADDRESS    0xFFFFFFFFFFFFF000
+    };
+
+    uint64_t Flags;
+  } upper64;
+#define VTD_DEVICE_TLB_INVALIDATE_DESCRIPTOR_UPPER64_RESERVED_BITS   0xFFE
+
+} vtd_device_tlb_invalidate_descriptor;
+
+typedef struct {
+  union {
+    struct {
+      uint64_t type                                                  : 4;
+#define VTD_INVALIDATION_WAIT_DESCRIPTOR_LOWER64_TYPE                0x0F
+      uint64_t interrupt_flag                                        : 1;
+#define VTD_INVALIDATION_WAIT_DESCRIPTOR_LOWER64_INTERRUPT_FLAG      0x10
+      uint64_t status_write                                          : 1;
+#define VTD_INVALIDATION_WAIT_DESCRIPTOR_LOWER64_STATUS_WRITE        0x20
+      uint64_t fence                                                 : 1;
+#define VTD_INVALIDATION_WAIT_DESCRIPTOR_LOWER64_FENCE               0x40
+      uint64_t page_request_drain                                    : 1;
+#define VTD_INVALIDATION_WAIT_DESCRIPTOR_LOWER64_PAGE_REQUEST_DRAIN  0x80
+      uint64_t reserved_1                                            : 24;
+      uint64_t status_data                                           : 32;
+#define VTD_INVALIDATION_WAIT_DESCRIPTOR_LOWER64_STATUS_DATA         0xFFFFFFFF00000000
+    };
+
+    uint64_t Flags;
+  } lower64;
+#define VTD_INVALIDATION_WAIT_DESCRIPTOR_LOWER64_RESERVED_BITS       0xFFFFFF00
+
+  union {
+    struct {
+      uint64_t reserved_1                                            : 2;
+      uint64_t status_address                                        : 62;
+#define VTD_INVALIDATION_WAIT_DESCRIPTOR_UPPER64_STATUS_ADDRESS      0xFFFFFFFFFFFFFFFC
+    };
+
+    uint64_t Flags;
+  } upper64;
+#define VTD_INVALIDATION_WAIT_DESCRIPTOR_UPPER64_RESERVED_BITS       0x03
+
+} vtd_invalidation_wait_descriptor;
 
 /**
  * @}
@@ -7610,11 +9951,91 @@ typedef union {
     uint64_t reserved_1                                              : 1;
     uint64_t pkru                                                    : 1;
 #define XCR0_PKRU                                                    0x200
-    uint64_t reserved_2                                              : 54;
+    uint64_t reserved_2                                              : 7;
+    uint64_t tilecfg                                                 : 1;
+#define XCR0_TILECFG                                                 0x20000
+    uint64_t tiledata                                                : 1;
+#define XCR0_TILEDATA                                                0x40000
+    uint64_t reserved_3                                              : 45;
   };
 
   uint64_t Flags;
 } xcr0;
+#define XCR0_RESERVED_BITS                                           0xFFFFFFFFFFF9FD00
+
+/**
+ * @defgroup xsave \
+ *           XSAVE area
+ * @{
+ */
+#define XSAVE_ALIGNMENT                                              0x00000040
+#define XSAVE_LEGACY_REGION_OFFSET                                   0x00000000
+#define XSAVE_LEGACY_REGION_SIZE                                     0x00000200
+#define XSAVE_HEADER_OFFSET                                          0x00000200
+#define XSAVE_HEADER_SIZE                                            0x00000040
+#define XSAVE_EXTENDED_REGION_OFFSET                                 0x00000240
+/**
+ * @defgroup xsave_component \
+ *           XSAVE-supported state components
+ * @{
+ */
+#define XSAVE_COMPONENT_X87                                          0x00000000
+#define XSAVE_COMPONENT_SSE                                          0x00000001
+#define XSAVE_COMPONENT_AVX                                          0x00000002
+#define XSAVE_COMPONENT_BNDREGS                                      0x00000003
+#define XSAVE_COMPONENT_BNDCSR                                       0x00000004
+#define XSAVE_COMPONENT_OPMASK                                       0x00000005
+#define XSAVE_COMPONENT_ZMM_HI256                                    0x00000006
+#define XSAVE_COMPONENT_HI16_ZMM                                     0x00000007
+#define XSAVE_COMPONENT_PT                                           0x00000008
+#define XSAVE_COMPONENT_PKRU                                         0x00000009
+#define XSAVE_COMPONENT_PASID                                        0x0000000A
+#define XSAVE_COMPONENT_CET_U                                        0x0000000B
+#define XSAVE_COMPONENT_CET_S                                        0x0000000C
+#define XSAVE_COMPONENT_HDC                                          0x0000000D
+#define XSAVE_COMPONENT_UINTR                                        0x0000000E
+#define XSAVE_COMPONENT_LBR                                          0x0000000F
+#define XSAVE_COMPONENT_HWP                                          0x00000010
+#define XSAVE_COMPONENT_TILECFG                                      0x00000011
+#define XSAVE_COMPONENT_TILEDATA                                     0x00000012
+#define XSAVE_COMPONENT_COUNT                                        0x00000013
+/**
+ * @}
+ */
+
+#define XSAVE_SUPERVISOR_COMPONENTS                                  0x0001FD00
+#define XSAVE_STANDARD_OFFSET(_i, _cpuid_ebx)                        ((_cpuid_ebx) * ((_i) >= 2))
+#define XSAVE_COMPACTED_OFFSET(_end, _cpuid_ecx)                     (((_end) + (((_cpuid_ecx) >> 1) & 0x01) * 63) & ~((((_cpuid_ecx) >> 1) & 0x01) * 63))
+typedef struct {
+  union {
+    struct {
+      uint64_t state_components                                      : 63;
+#define XSAVE_HEADER_XSTATE_BV_STATE_COMPONENTS                      0x7FFFFFFFFFFFFFFF
+      uint64_t reserved_1                                            : 1;
+    };
+
+    uint64_t Flags;
+  } xstate_bv;
+#define XSAVE_HEADER_XSTATE_BV_RESERVED_BITS                         0x8000000000000000
+
+  union {
+    struct {
+      uint64_t state_components                                      : 63;
+#define XSAVE_HEADER_XCOMP_BV_STATE_COMPONENTS                       0x7FFFFFFFFFFFFFFF
+      uint64_t compacted_format                                      : 1;
+#define XSAVE_HEADER_XCOMP_BV_COMPACTED_FORMAT                       0x8000000000000000
+    };
+
+    uint64_t Flags;
+  } xcomp_bv;
+#define XSAVE_HEADER_XCOMP_BV_RESERVED_BITS                          0x00
+
+  uint8_t reserved[48];
+} xsave_header;
+
+/**
+ * @}
+ */
 
 /**
  * @}
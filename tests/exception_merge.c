@@ -0,0 +1,130 @@
+/*
+ * Checks EXCEPTION_VECTOR_MERGE and VMEXIT_INTERRUPT_INFORMATION_MERGE against a straightforward
+ * implementation of Vol3A Table 6-5 (Conditions for Generating a Double Fault), for every exception
+ * vector, IDT-vectoring vector and interruption type. Checks EXCEPTION_VECTOR_INTERRUPTION_TYPE for
+ * every vector.
+ *
+ *   gcc -Wall -Iout tests/exception_merge.c -o exception_merge && ./exception_merge
+ */
+#include <stdio.h>
+#include "ia32.h"
+
+static unsigned int reference_class(unsigned int vector)
+{
+  if (vector >= 32)
+  {
+    return EXCEPTION_VECTOR_CLASS_BENIGN;
+  }
+
+  switch (vector)
+  {
+  case 0: case 10: case 11: case 12: case 13: case 21:
+    return EXCEPTION_VECTOR_CLASS_CONTRIBUTORY;
+
+  case 14: case 20:
+    return EXCEPTION_VECTOR_CLASS_PAGE_FAULT;
+
+  default:
+    return EXCEPTION_VECTOR_CLASS_BENIGN;
+  }
+}
+
+static unsigned int reference_interruption_type(unsigned int vector)
+{
+  if (vector >= 32)
+  {
+    return 0;
+  }
+
+  switch (vector)
+  {
+  case 2:
+    return 2;
+
+  case 3: case 4:
+    return 6;
+
+  default:
+    return 3;
+  }
+}
+
+static unsigned int reference_merge(unsigned int first, unsigned int second)
+{
+  unsigned int first_class = reference_class(first);
+  unsigned int second_class = reference_class(second);
+
+  if (first == 8 && second_class != EXCEPTION_VECTOR_CLASS_BENIGN)
+  {
+    return EXCEPTION_VECTOR_MERGE_TRIPLE_FAULT;
+  }
+
+  if ((first_class == EXCEPTION_VECTOR_CLASS_CONTRIBUTORY && second_class == EXCEPTION_VECTOR_CLASS_CONTRIBUTORY) ||
+      (first_class == EXCEPTION_VECTOR_CLASS_PAGE_FAULT && second_class != EXCEPTION_VECTOR_CLASS_BENIGN))
+  {
+    return EXCEPTION_VECTOR_MERGE_DOUBLE_FAULT;
+  }
+
+  return EXCEPTION_VECTOR_MERGE_SERIAL;
+}
+
+static unsigned int reference_vmexit_merge(unsigned int idt_vectoring, unsigned int vector)
+{
+  unsigned int first = ((idt_vectoring & 0x80000700) == 0x80000300) ? (idt_vectoring & 0xFF) : 0x100;
+
+  switch (reference_merge(first, vector))
+  {
+  case EXCEPTION_VECTOR_MERGE_DOUBLE_FAULT:
+    return 0x80000B08;
+
+  case EXCEPTION_VECTOR_MERGE_TRIPLE_FAULT:
+    return 0;
+
+  default:
+    return VMENTRY_INTERRUPT_INFORMATION_FROM_VECTOR(vector);
+  }
+}
+
+int main(void)
+{
+  unsigned int errors = 0;
+  unsigned int first;
+  unsigned int second;
+  unsigned int type;
+  unsigned int valid;
+
+  for (first = 0; first < 256; first++)
+  {
+    if ((unsigned int)EXCEPTION_VECTOR_INTERRUPTION_TYPE(first) != reference_interruption_type(first))
+    {
+      printf("EXCEPTION_VECTOR_INTERRUPTION_TYPE(%u) mismatch\n", first);
+      errors++;
+    }
+
+    for (second = 0; second < 256; second++)
+    {
+      if ((unsigned int)EXCEPTION_VECTOR_MERGE(first, second) != reference_merge(first, second))
+      {
+        printf("EXCEPTION_VECTOR_MERGE(%u, %u) mismatch\n", first, second);
+        errors++;
+      }
+
+      for (type = 0; type < 8; type++)
+      {
+        for (valid = 0; valid < 2; valid++)
+        {
+          unsigned int idt_vectoring = first | (type << 8) | (valid << 31);
+
+          if ((unsigned int)VMEXIT_INTERRUPT_INFORMATION_MERGE(idt_vectoring, second) !=
+              reference_vmexit_merge(idt_vectoring, second))
+          {
+            printf("VMEXIT_INTERRUPT_INFORMATION_MERGE(0x%08X, %u) mismatch\n", idt_vectoring, second);
+            errors++;
+          }
+        }
+      }
+    }
+  }
+
+  return errors != 0;
+}
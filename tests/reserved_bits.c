@@ -0,0 +1,56 @@
+/*
+ * Pins reserved-bit masks of CR3, CR8 and PML4E: bits of fields named RESERVED or MUST_BE_ZERO are
+ * reserved, ignored bits (including the PCID held in CR3 bits 11:0) are not.
+ *
+ *   gcc -Wall -Iout tests/reserved_bits.c -o reserved_bits && ./reserved_bits
+ */
+#include <stdio.h>
+#include "ia32.h"
+
+#define CHECK(_expression)                                                                                            \
+  if (!(_expression))                                                                                                 \
+  {                                                                                                                   \
+    printf("%s:%d: %s\n", __FILE__, __LINE__, #_expression);                                                         \
+    errors++;                                                                                                         \
+  }
+
+static int is_valid(unsigned long long value, unsigned long long reserved, unsigned long long address_bits,
+                    unsigned int maxphyaddr)
+{
+  return (value & (reserved | (address_bits & ~((1ULL << maxphyaddr) - 1)))) == 0;
+}
+
+int main(void)
+{
+  unsigned int errors = 0;
+
+  CHECK(CR8_RESERVED_BITS == 0xFFFFFFFFFFFFFFF0ULL);
+  CHECK(CR3_RESERVED_BITS == 0xFFF0000000000000ULL);
+  CHECK(CR3_ADDRESS_BITS == 0x000FFFFFFFFFF000ULL);
+  CHECK(PML4E_64_RESERVED_BITS == 0x80ULL);
+  CHECK(PML4E_64_ADDRESS_BITS == 0x000FFFFFFFFFF000ULL);
+  CHECK(PDPTE_64_RESERVED_BITS == 0);
+  CHECK(PDE_64_RESERVED_BITS == 0);
+
+  //
+  // CR8 holds only the task-priority level.
+  //
+  CHECK(is_valid(0x0F, CR8_RESERVED_BITS, 0, 52));
+  CHECK(!is_valid(0x10, CR8_RESERVED_BITS, 0, 52));
+
+  //
+  // CR3 with PCID 0xFFF is valid; address bits above MAXPHYADDR are not.
+  //
+  CHECK(is_valid(0x0000001234567FFFULL, CR3_RESERVED_BITS, CR3_ADDRESS_BITS, 39));
+  CHECK(!is_valid(0x0000801234567000ULL, CR3_RESERVED_BITS, CR3_ADDRESS_BITS, 39));
+  CHECK(is_valid(0x0000801234567000ULL, CR3_RESERVED_BITS, CR3_ADDRESS_BITS, 48));
+  CHECK(!is_valid(0x0010000000000000ULL, CR3_RESERVED_BITS, CR3_ADDRESS_BITS, 52));
+
+  //
+  // PML4E: ignored bits 6, 8-10 and 52-62 are free for software, bit 7 must be zero.
+  //
+  CHECK(is_valid(0xFFF0000000000F7FULL, PML4E_64_RESERVED_BITS, PML4E_64_ADDRESS_BITS, 48));
+  CHECK(!is_valid(0x0000000000000081ULL, PML4E_64_RESERVED_BITS, PML4E_64_ADDRESS_BITS, 48));
+
+  return errors != 0;
+}
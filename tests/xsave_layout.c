@@ -0,0 +1,131 @@
+/*
+ * Computes standard and compacted XSAVE layouts with XSAVE_STANDARD_OFFSET and XSAVE_COMPACTED_OFFSET from
+ * CPUID.(EAX=0DH) recorded on a Sapphire Rapids guest (family 6, model 8FH), and checks them against the sizes
+ * reported by the same CPUID leaf and against known offsets.
+ *
+ *   gcc -Wall -Iout tests/xsave_layout.c -o xsave_layout && ./xsave_layout
+ */
+#include <stdio.h>
+#include "ia32.h"
+
+#define CHECK(_expression)                                                                                            \
+  if (!(_expression))                                                                                                 \
+  {                                                                                                                   \
+    printf("%s:%d: %s\n", __FILE__, __LINE__, #_expression);                                                         \
+    errors++;                                                                                                         \
+  }
+
+/*
+ * CPUID.(EAX=0DH, ECX=n) for n = 0..XSAVE_COMPONENT_COUNT-1 (EAX, EBX, ECX, EDX), recorded with
+ * XCR0 = 0x602E7 and IA32_XSS = 0.
+ */
+static const unsigned int cpuid_0d[XSAVE_COMPONENT_COUNT][4] =
+{
+  { 0x000602E7, 0x00002B00, 0x00002B00, 0x00000000 },
+  { 0x0000001F, 0x00002A00, 0x00001800, 0x00000000 },
+  { 0x00000100, 0x00000240, 0x00000000, 0x00000000 },
+  { 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+  { 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+  { 0x00000040, 0x00000440, 0x00000000, 0x00000000 },
+  { 0x00000200, 0x00000480, 0x00000000, 0x00000000 },
+  { 0x00000400, 0x00000680, 0x00000000, 0x00000000 },
+  { 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+  { 0x00000008, 0x00000A80, 0x00000000, 0x00000000 },
+  { 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+  { 0x00000010, 0x00000000, 0x00000001, 0x00000000 },
+  { 0x00000018, 0x00000000, 0x00000001, 0x00000000 },
+  { 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+  { 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+  { 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+  { 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+  { 0x00000040, 0x00000AC0, 0x00000002, 0x00000000 },
+  { 0x00002000, 0x00000B00, 0x00000006, 0x00000000 },
+};
+
+typedef struct
+{
+  unsigned long long mask;
+  unsigned int standard_offset[XSAVE_COMPONENT_COUNT];
+  unsigned int compacted_offset[XSAVE_COMPONENT_COUNT];
+  unsigned int standard_size;
+  unsigned int compacted_size;
+} XSAVE_LAYOUT;
+
+/*
+ * Computed once per XCR0 | IA32_XSS mask, offsets are then looked up by component index.
+ */
+static void xsave_layout(XSAVE_LAYOUT *layout, unsigned long long mask)
+{
+  unsigned int end = XSAVE_EXTENDED_REGION_OFFSET;
+  unsigned int i;
+
+  layout->mask = mask;
+  layout->standard_size = XSAVE_EXTENDED_REGION_OFFSET;
+
+  for (i = 0; i < XSAVE_COMPONENT_COUNT; i++)
+  {
+    layout->standard_offset[i] = XSAVE_STANDARD_OFFSET(i, cpuid_0d[i][1]);
+    layout->compacted_offset[i] = 0;
+
+    if (i < 2 || !((mask >> i) & 1))
+    {
+      continue;
+    }
+
+    if (layout->standard_size < layout->standard_offset[i] + cpuid_0d[i][0])
+    {
+      layout->standard_size = layout->standard_offset[i] + cpuid_0d[i][0];
+    }
+
+    layout->compacted_offset[i] = XSAVE_COMPACTED_OFFSET(end, cpuid_0d[i][2]);
+    end = layout->compacted_offset[i] + cpuid_0d[i][0];
+  }
+
+  layout->compacted_size = end;
+}
+
+int main(void)
+{
+  unsigned int errors = 0;
+  XSAVE_LAYOUT layout;
+
+  //
+  // Sizes reported for the enabled XCR0 (standard and compacted format with IA32_XSS = 0).
+  //
+  xsave_layout(&layout, cpuid_0d[0][0]);
+  CHECK(layout.standard_size == cpuid_0d[0][1]);
+  CHECK(layout.compacted_size == cpuid_0d[1][1]);
+
+  CHECK(layout.standard_offset[XSAVE_COMPONENT_SSE] == 0);
+  CHECK(layout.standard_offset[XSAVE_COMPONENT_AVX] == 0x240);
+  CHECK(layout.standard_offset[XSAVE_COMPONENT_TILEDATA] == 0xB00);
+
+  //
+  // AVX, AVX-512 and PKRU are packed; TILECFG and TILEDATA are 64-byte aligned.
+  //
+  CHECK(layout.compacted_offset[XSAVE_COMPONENT_AVX] == 576);
+  CHECK(layout.compacted_offset[XSAVE_COMPONENT_OPMASK] == 832);
+  CHECK(layout.compacted_offset[XSAVE_COMPONENT_ZMM_HI256] == 896);
+  CHECK(layout.compacted_offset[XSAVE_COMPONENT_HI16_ZMM] == 1408);
+  CHECK(layout.compacted_offset[XSAVE_COMPONENT_PKRU] == 2432);
+  CHECK(layout.compacted_offset[XSAVE_COMPONENT_TILECFG] == 2496);
+  CHECK(layout.compacted_offset[XSAVE_COMPONENT_TILEDATA] == 2560);
+
+  //
+  // With CET state (IA32_XSS), both supervisor components fit into the padding before TILECFG.
+  //
+  xsave_layout(&layout, cpuid_0d[0][0] | cpuid_0d[1][2]);
+  CHECK(layout.compacted_offset[XSAVE_COMPONENT_CET_U] == 2440);
+  CHECK(layout.compacted_offset[XSAVE_COMPONENT_CET_S] == 2456);
+  CHECK(layout.compacted_offset[XSAVE_COMPONENT_TILECFG] == 2496);
+  CHECK(layout.compacted_size == cpuid_0d[1][1]);
+
+  //
+  // Without AMX, the area ends right after PKRU.
+  //
+  xsave_layout(&layout, 0x2E7);
+  CHECK(layout.compacted_size == 2440);
+  CHECK(layout.standard_size == 0xA88);
+
+  return errors != 0;
+}